@@ -179,6 +179,22 @@ class V8_EXPORT Heap {
       const char* source, const char* reason,
       StackState stack_state = StackState::kMayContainHeapPointers);
 
+  /**
+   * Requests heap compaction for the next garbage collection cycle. Compaction
+   * defragments compactable heap spaces by moving live objects, releasing
+   * fragmented page memory back to the operating system. The request is best
+   * effort and carried over to subsequent cycles as long as garbage
+   * collections cannot use compaction (e.g. because they may observe pointers
+   * on the stack).
+   */
+  void EnableCompactionForNextGarbageCollection();
+
+  /**
+   * \returns the number of bytes of page memory released by the most recent
+   *   heap compaction, or 0 if compaction has not run yet.
+   */
+  size_t GetLastCompactionReleasedBytes() const;
+
   /**
    * \returns the opaque handle for allocating objects using
    * `MakeGarbageCollected()`.
@@ -170,6 +170,17 @@ class V8_PLATFORM_EXPORT TraceBuffer {
   static TraceBuffer* CreateTraceBufferRingBuffer(size_t max_chunks,
                                                   TraceWriter* trace_writer);
 
+  // Creates a buffer that keeps one chunk of trace events per traced thread
+  // and streams full chunks to |trace_writer| incrementally while tracing is
+  // running, instead of serializing everything when tracing stops. Threads
+  // never contend with each other when recording events, which makes this
+  // buffer suitable for always-on tracing. The trade-off is that events
+  // handed to the writer are final: the duration of an event whose scope
+  // outlives its chunk is not recorded. At most |max_retired_chunks| full
+  // chunks are buffered before the oldest ones are dropped.
+  static TraceBuffer* CreateTraceBufferStreamingBuffer(
+      size_t max_retired_chunks, TraceWriter* trace_writer);
+
  private:
   // Disallow copy and assign
   TraceBuffer(const TraceBuffer&) = delete;
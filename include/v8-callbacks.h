@@ -201,6 +201,18 @@ using InterruptCallback = void (*)(Isolate* isolate, void* data);
 using NearHeapLimitCallback = size_t (*)(void* data, size_t current_heap_limit,
                                          size_t initial_heap_limit);
 
+/**
+ * This callback is invoked on the foreground thread after a full garbage
+ * collection observed a context whose attributed heap usage exceeds the limit
+ * configured via Context::SetMemoryLimit(). The callback is invoked again
+ * after every subsequent full garbage collection for which the context is
+ * still over its limit. The embedder is expected to react by unloading or
+ * throttling the offending context; V8 itself does not terminate it.
+ */
+using ContextMemoryLimitCallback = void (*)(Local<Context> context,
+                                            size_t usage_in_bytes,
+                                            size_t limit_in_bytes);
+
 /**
  * Callback function passed to SetUnhandledExceptionCallback.
  */
@@ -311,6 +311,17 @@ class V8_EXPORT Context : public Data {
    */
   void SetErrorMessageForWasmCodeGeneration(Local<String> message);
 
+  /**
+   * Sets a limit on the heap usage attributed to this context. The usage is
+   * computed with the same per-context accounting that backs
+   * Isolate::MeasureMemory() and is checked after each full garbage
+   * collection; when it exceeds the limit, the callback registered via
+   * Isolate::SetContextMemoryLimitCallback() is invoked instead of the
+   * whole-isolate out-of-memory handling. The limit is rounded up to a
+   * multiple of 1 KB. Passing zero removes the limit.
+   */
+  void SetMemoryLimit(size_t limit_in_bytes);
+
   /**
    * Return data that was previously attached to the context snapshot via
    * SnapshotCreator, and removes the reference to it.
@@ -5,6 +5,7 @@
 #ifndef INCLUDE_V8_EMBEDDER_HEAP_H_
 #define INCLUDE_V8_EMBEDDER_HEAP_H_
 
+#include "v8-memory-span.h"    // NOLINT(build/include_directory)
 #include "v8-traced-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"          // NOLINT(build/include_directory)
 
@@ -70,6 +71,39 @@ class V8_EXPORT EmbedderRootsHandler {
     return true;
   }
 
+  /**
+   * Batched version of |IsRoot()|. Instead of issuing one |IsRoot()| call per
+   * handle, V8 may pass spans of |TracedReference| handles that need a
+   * liveness answer. For each handle in |handles| the embedder must write the
+   * answer |IsRoot()| would return into the corresponding element of
+   * |is_root|. Both spans have the same size and are only valid for the
+   * duration of the call.
+   *
+   * The default implementation forwards each handle to |IsRoot()|.
+   */
+  virtual void AreRoots(
+      MemorySpan<const v8::TracedReference<v8::Value>> handles,
+      MemorySpan<bool> is_root) {
+    for (size_t i = 0; i < handles.size(); ++i) {
+      is_root[i] = IsRoot(handles[i]);
+    }
+  }
+
+  /**
+   * Batched version of |ResetRoot()|. Instead of issuing one |ResetRoot()|
+   * call per handle, V8 may pass spans of |TracedReference| handles whose
+   * objects have been reclaimed. The span is only valid for the duration of
+   * the call.
+   *
+   * The default implementation forwards each handle to |ResetRoot()|.
+   */
+  virtual void ResetRoots(
+      MemorySpan<const v8::TracedReference<v8::Value>> handles) {
+    for (const auto& handle : handles) {
+      ResetRoot(handle);
+    }
+  }
+
  private:
   const RootHandling default_traced_reference_handling_ =
       RootHandling::kQueryEmbedderForNonDroppableReferences;
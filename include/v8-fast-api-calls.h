@@ -492,6 +492,28 @@ class V8_EXPORT CFunction {
   }
   const CFunctionInfo* GetTypeInfo() const { return type_info_; }
 
+  bool HasBatchVariant() const { return batch_address_ != nullptr; }
+  const void* GetBatchAddress() const { return batch_address_; }
+  const CFunctionInfo* GetBatchTypeInfo() const { return batch_type_info_; }
+
+  /**
+   * Returns a copy of this CFunction with {batch} attached as its batch
+   * variant. A batch variant processes whole arrays instead of scalars: by
+   * convention it takes, for each scalar argument of this function, a
+   * TypedArray of the corresponding element type, plus a trailing element
+   * count. V8 publishes the variant as an additional overload of the same
+   * template, selected by the regular compile time (arity based) overload
+   * resolution, so a call site that passes TypedArrays and a count compiles
+   * to a single call to the batch entry point instead of one call per
+   * element. The variant must therefore differ in arity from this function.
+   */
+  CFunction WithBatchVariant(const CFunction& batch) const {
+    CFunction result = *this;
+    result.batch_address_ = batch.address_;
+    result.batch_type_info_ = batch.type_info_;
+    return result;
+  }
+
   enum class OverloadResolution { kImpossible, kAtRuntime, kAtCompileTime };
 
   // Returns whether an overload between this and the given CFunction can
@@ -551,6 +573,8 @@ class V8_EXPORT CFunction {
  private:
   const void* address_;
   const CFunctionInfo* type_info_;
+  const void* batch_address_ = nullptr;
+  const CFunctionInfo* batch_type_info_ = nullptr;
 
   template <typename F>
   class ArgUnwrap {
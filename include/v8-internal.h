@@ -661,6 +661,11 @@ class Internals {
   static const int kExternalTwoByteRepresentationTag = 0x02;
   static const int kExternalOneByteRepresentationTag = 0x0a;
 
+  // Constants sized to hold an internal DisallowGarbageCollection scope
+  // without exposing its definition (see String::ValueView).
+  static const int kDisallowGarbageCollectionAlign = 8;
+  static const int kDisallowGarbageCollectionSize = 16;
+
   static const uint32_t kNumIsolateDataSlots = 4;
   static const int kStackGuardSize = 8 * kApiSystemPointerSize;
   static const int kNumberOfBooleanFlags = 6;
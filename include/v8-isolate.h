@@ -36,7 +36,10 @@ class StartupData;
 class ScriptOrModule;
 class SharedArrayBuffer;
 
+enum class TaskPriority : uint8_t;  // Defined in v8-platform.h.
+
 namespace internal {
+class IsolatePool;
 class MicrotaskQueue;
 class ThreadLocalTop;
 }  // namespace internal
@@ -300,6 +303,18 @@ class V8_EXPORT Isolate {
      * CppHeap passed this way.
      */
     CppHeap* cpp_heap = nullptr;
+
+    /**
+     * The NUMA node this isolate's heap pages should preferably be placed
+     * on, or -1 for no preference. This is useful in multi-isolate processes
+     * on multi-socket machines where each isolate is served by threads
+     * pinned to one node: without a preference, heap pages tend to
+     * concentrate on the node that happened to fault them in first, and
+     * isolates running on the other node pay remote-memory latency. The
+     * preference is best effort and ignored on platforms without a NUMA
+     * memory policy API.
+     */
+    int preferred_numa_node = -1;
   };
 
   /**
@@ -705,6 +720,21 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Pre-allocates internal storage for at least `capacity` additional global
+   * handles (Global, Persistent). Embedders that are about to create handles
+   * in bulk can use this to avoid incremental internal block allocations;
+   * freshly reserved nodes are handed out from contiguous blocks, which also
+   * improves locality of the subsequent handle creations.
+   */
+  void ReserveGlobalHandleCapacity(size_t capacity);
+
+  /**
+   * Same as ReserveGlobalHandleCapacity(), but for traced handles
+   * (TracedReference).
+   */
+  void ReserveTracedHandleCapacity(size_t capacity);
+
   /**
    * Optional request from the embedder to tune v8 towards energy efficiency
    * rather than speed if `battery_saver_mode_enabled` is true, because the
@@ -713,6 +743,32 @@ class V8_EXPORT Isolate {
    */
   void SetBatterySaverMode(bool battery_saver_mode_enabled);
 
+  /**
+   * Sets the priority at which this isolate posts background GC jobs (such
+   * as concurrent sweeping) to the platform. Defaults to
+   * TaskPriority::kUserVisible. In multi-isolate processes, embedders can
+   * lower the priority for bulk isolates so their background GC work does
+   * not steal cores from latency-critical isolates, and raise it for
+   * interactive ones. Takes effect the next time a background GC job is
+   * posted; it is safe to call from any thread.
+   */
+  void SetBackgroundGCTaskPriority(TaskPriority priority);
+
+  /**
+   * Sets a soft budget, in milliseconds, for individual main-thread GC
+   * pauses. While a budget is configured, incremental marking uses step
+   * sizes no larger than the budget, lazy sweeping from allocation stops
+   * contributing once the budget is exhausted, and background GC jobs are
+   * posted at blocking priority so concurrent threads pick up the deferred
+   * work. The budget is best-effort: atomic pauses (e.g. marking
+   * finalization) cannot be subdivided and may overrun it; overruns are
+   * reported per GC cycle via
+   * v8::metrics::GarbageCollectionPauseBudget. Passing a budget <= 0
+   * restores the default heuristics. The budget can be adjusted at any time,
+   * e.g. relaxed during off-peak hours.
+   */
+  void SetGCPauseBudget(double budget_in_ms);
+
   /**
    * Drop non-essential caches. Should only be called from testing code.
    * The method can potentially block for a long time and does not necessarily
@@ -848,6 +904,13 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about zone memory usage and segment pool effectiveness.
+   *
+   * \param zone_statistics The ZoneStatistics object to fill in statistics.
+   */
+  void GetZoneStatistics(ZoneStatistics* zone_statistics);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -900,6 +963,51 @@ class V8_EXPORT Isolate {
    */
   HeapProfiler* GetHeapProfiler();
 
+  /**
+   * Entry of the function self-time attribution table, see
+   * StartFunctionSelfTimeAttribution().
+   */
+  struct FunctionSelfTime {
+    /** Function debug name. Only valid during the callback invocation. */
+    const char* name;
+    /** Id of the script the function belongs to, or
+     * UnboundScript::kNoScriptId. */
+    int script_id;
+    /** Start position of the function within the script. */
+    int start_position;
+    /** Number of bytecode budget interrupts attributed to the function. */
+    size_t ticks;
+    /** Approximate wall-clock self time in milliseconds. */
+    double self_time_ms;
+  };
+
+  using FunctionSelfTimeCallback = void (*)(const FunctionSelfTime& entry,
+                                            void* data);
+
+  /**
+   * Starts collecting approximate per-function self-time counters. The
+   * counters are fed by the existing bytecode budget interrupts that
+   * interpreted and baseline code already emit, so the overhead is bounded by
+   * the interrupt budget and no profiler thread or signal-based sampling is
+   * needed. The attribution is approximate: wall-clock time between
+   * consecutive interrupts is credited to the function that triggered the
+   * later interrupt.
+   */
+  void StartFunctionSelfTimeAttribution();
+
+  /**
+   * Invokes |callback| for each function that has accumulated self-time
+   * counters since StartFunctionSelfTimeAttribution() was called. Does
+   * nothing if attribution is not active.
+   */
+  void GetFunctionSelfTimeAttribution(FunctionSelfTimeCallback callback,
+                                      void* data);
+
+  /**
+   * Stops collecting self-time counters and discards the accumulated values.
+   */
+  void StopFunctionSelfTimeAttribution();
+
   /**
    * Tells the VM whether the embedder is idle or not.
    */
@@ -1385,6 +1493,36 @@ class V8_EXPORT Isolate {
    */
   void LowMemoryNotification();
 
+  /**
+   * The number of bytes TrimMemory() returned to the operating system, per
+   * source.
+   */
+  struct TrimMemoryReport {
+    /** Pages buffered for reuse by the heap's page pool. */
+    size_t pooled_pages_bytes = 0;
+    /** Heap pages whose memory was entirely on a free list. */
+    size_t free_list_pages_bytes = 0;
+    /** Committed new-space capacity beyond the current usage. */
+    size_t new_space_bytes = 0;
+    /** Zone memory buffered for reuse by the compiler and parser. */
+    size_t zone_segment_bytes = 0;
+  };
+
+  /**
+   * Returns committed but currently unused memory to the operating system,
+   * doing the most profitable work first and stopping once
+   * |deadline_in_seconds| is reached. The deadline is compared against
+   * MonotonicallyIncreasingTime() and should be based on the same timebase as
+   * that function. Unlike LowMemoryNotification() this does not trigger a
+   * garbage collection, so it only returns memory that previous garbage
+   * collections have already freed up.
+   *
+   * Returns the total number of bytes released; if |report| is non-null it
+   * receives a per-source breakdown.
+   */
+  size_t TrimMemory(double deadline_in_seconds,
+                    TrimMemoryReport* report = nullptr);
+
   /**
    * Optional notification that a context has been disposed. V8 uses these
    * notifications to guide the GC heuristic and cancel FinalizationRegistry
@@ -1543,6 +1681,12 @@ class V8_EXPORT Isolate {
   void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  /**
+   * Set the callback to invoke when a context exceeds the memory limit
+   * configured for it via Context::SetMemoryLimit().
+   */
+  void SetContextMemoryLimitCallback(ContextMemoryLimitCallback callback);
+
   /**
    * If the heap limit was changed by the NearHeapLimitCallback, then the
    * initial heap limit will be restored once the heap size falls below the
@@ -1671,6 +1815,18 @@ class V8_EXPORT Isolate {
    */
   void SetAllowAtomicsWait(bool allow);
 
+  /**
+   * Set the minimum length, in characters, at which substring creation
+   * returns a zero-copy slice referencing the parent string instead of
+   * copying the characters. The default is an internally tuned constant.
+   * Lowering the threshold avoids copies for workloads that produce many
+   * short substrings of stable parents, at the cost of keeping the parents
+   * alive and of more frequent flattening when the slices are consumed by
+   * operations requiring sequential strings. Values below 3 are clamped;
+   * shorter substrings are served from internalized-string caches.
+   */
+  void SetSlicedStringMinLength(int min_length);
+
   /**
    * Time zone redetection indicator for
    * DateTimeConfigurationChangeNotification.
@@ -1729,6 +1885,82 @@ class V8_EXPORT Isolate {
   void ReportExternalAllocationLimitReached();
 };
 
+/**
+ * A pool of pre-initialized spare isolates for embedders that create
+ * short-lived isolates at a high rate (e.g. one per request). Acquire()
+ * returns a pre-warmed isolate without paying for snapshot deserialization,
+ * and Release() resets an isolate for reuse instead of disposing it.
+ *
+ * Before calling Release() the embedder must exit the isolate and release
+ * all handles, contexts and microtask queues referring to it. Release()
+ * verifies this rather than trusting it: it discards pending microtasks,
+ * clears the compilation caches and performs a full garbage collection, and
+ * only returns the isolate to the pool if no context survived. Otherwise the
+ * isolate is disposed as if Isolate::Dispose() had been called.
+ *
+ * The pool is thread-safe. |params| must remain valid for the lifetime of
+ * the pool; it is used for every isolate the pool creates.
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  IsolatePool(const Isolate::CreateParams& params, size_t capacity);
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  /**
+   * Creates spare isolates until the pool holds |count| of them, bounded by
+   * the pool's capacity. Call this off the critical path.
+   */
+  void Prewarm(size_t count);
+
+  /**
+   * Returns a pooled isolate, or a freshly created one if the pool is empty.
+   * The caller owns the isolate until it is passed back to Release().
+   */
+  Isolate* Acquire();
+
+  /**
+   * Resets |isolate| and returns it to the pool. Returns false if the reset
+   * verification failed or the pool is at capacity; in that case the isolate
+   * has been disposed and must no longer be used. The isolate must not be
+   * entered by any thread.
+   */
+  bool Release(Isolate* isolate);
+
+ private:
+  internal::IsolatePool* const impl_;
+};
+
+/**
+ * A scope for bulk object creation through the API.
+ *
+ * While the scope is active, per-allocation bookkeeping (allocation
+ * observers and the inline-allocation step tracking that caps the linear
+ * allocation buffer) is paused, so repeated factory calls such as
+ * Object::New() bump-allocate from the full linear allocation buffer the
+ * same way JITted code does. Objects are created in the young generation,
+ * where write barriers are already elided.
+ *
+ * Side effects of the paused bookkeeping — incremental marking steps, heap
+ * sampling and stack-guard interrupts driven by allocation — are deferred
+ * until the scope closes, so scopes should be kept short (e.g. one ingest
+ * batch). Garbage collection may still run if the heap is exhausted.
+ * Scopes may be nested and must be closed on the thread that opened them.
+ */
+class V8_EXPORT ObjectFactoryScope {
+ public:
+  explicit ObjectFactoryScope(Isolate* isolate);
+  ~ObjectFactoryScope();
+
+  ObjectFactoryScope(const ObjectFactoryScope&) = delete;
+  ObjectFactoryScope& operator=(const ObjectFactoryScope&) = delete;
+
+ private:
+  internal::Isolate* const i_isolate_;
+};
+
 void Isolate::SetData(uint32_t slot, void* data) {
   using I = internal::Internals;
   I::SetEmbedderData(this, slot, data);
@@ -5,20 +5,54 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
 class Value;
 class String;
 
+namespace internal {
+class JsonStreamedSource;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
 class V8_EXPORT JSON {
  public:
+  /**
+   * Source text for JSON::ParseStreamed, fed to V8 chunk by chunk as the
+   * data arrives (e.g. from the network), so the embedder does not need to
+   * buffer the whole payload before parsing can be requested.
+   */
+  class V8_EXPORT StreamedSource {
+   public:
+    StreamedSource();
+    ~StreamedSource();
+
+    StreamedSource(const StreamedSource&) = delete;
+    StreamedSource& operator=(const StreamedSource&) = delete;
+
+    /**
+     * Appends a chunk of UTF-8 encoded JSON text. The bytes are copied, so
+     * the caller may release |data| when the call returns. Returns false if
+     * the accumulated source exceeds the maximum string length V8 supports.
+     */
+    bool AppendChunk(const uint8_t* data, size_t length);
+
+    internal::JsonStreamedSource* impl() const { return impl_; }
+
+   private:
+    internal::JsonStreamedSource* impl_;
+  };
+
   /**
    * Tries to parse the string |json_string| and returns it as value if
    * successful.
@@ -30,6 +64,17 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Local<Context> context, Local<String> json_string);
 
+  /**
+   * Parses the chunks accumulated in |source| and returns the corresponding
+   * value if successful. |source| is consumed and must not be reused.
+   *
+   * \param context The context in which to parse and create the value.
+   * \param source The streamed source holding the accumulated chunks.
+   * \return The corresponding value if successfully parsed.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> ParseStreamed(
+      Local<Context> context, StreamedSource* source);
+
   /**
    * Tries to stringify the JSON-serializable object |json_object| and returns
    * it as string if successful.
@@ -97,6 +97,22 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+// Reported instead of individual GarbageCollectionYoungCycle events when
+// --metrics-batch-young-gc-events is enabled.
+using GarbageCollectionYoungBatchedCycles =
+    GarbageCollectionBatchedEvents<GarbageCollectionYoungCycle>;
+
+// Reported once per full GC cycle while a pause budget is configured via
+// Isolate::SetGCPauseBudget(). Counts every main-thread pause of the cycle:
+// each incremental marking and sweeping step as well as the atomic pause.
+struct GarbageCollectionPauseBudget {
+  int64_t budget_wall_clock_duration_in_us = -1;
+  int64_t longest_pause_wall_clock_duration_in_us = -1;
+  int64_t atomic_pause_wall_clock_duration_in_us = -1;
+  int64_t pause_count = -1;
+  int64_t pauses_over_budget = -1;
+};
+
 struct WasmModuleDecoded {
   WasmModuleDecoded() = default;
   WasmModuleDecoded(bool async, bool streamed, bool success,
@@ -205,6 +221,8 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungBatchedCycles)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionPauseBudget)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
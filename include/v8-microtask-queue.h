@@ -86,6 +86,41 @@ class V8_EXPORT MicrotaskQueue {
    */
   virtual void PerformCheckpoint(Isolate* isolate) = 0;
 
+  /**
+   * Limits for a budgeted microtask checkpoint. The checkpoint stops once
+   * either limit is reached; microtasks that did not run stay in the queue.
+   */
+  struct Budget {
+    /**
+     * Maximum number of microtasks to run. Negative means no count limit.
+     */
+    int max_count = -1;
+
+    /**
+     * Maximum wall-clock duration in milliseconds. Negative means no time
+     * limit. The deadline is only checked between microtasks, so a single
+     * long-running microtask can overshoot the budget.
+     */
+    double max_duration_ms = -1;
+  };
+
+  /**
+   * Runs microtasks like PerformCheckpoint, but stops once the given budget
+   * is exhausted. Returns the number of microtasks that ran, or -1 if
+   * execution was terminated. Use PendingMicrotaskCount() to observe how many
+   * microtasks remain. Embedders that host multiple tenants can give each
+   * tenant its own MicrotaskQueue (see New() and Context::New()) and
+   * interleave them fairly by performing budgeted checkpoints in a
+   * priority-ordered round-robin.
+   */
+  virtual int PerformCheckpointWithBudget(Isolate* isolate,
+                                          const Budget& budget) = 0;
+
+  /**
+   * Returns the number of microtasks currently queued.
+   */
+  virtual size_t PendingMicrotaskCount() const = 0;
+
   /**
    * Returns true if a microtask is running on this MicrotaskQueue instance.
    */
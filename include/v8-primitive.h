@@ -446,6 +446,28 @@ class V8_EXPORT String : public Name {
   static Local<String> Concat(Isolate* isolate, Local<String> left,
                               Local<String> right);
 
+  /**
+   * A half-open character range [start, start + length) within a string,
+   * used with NewSubStrings().
+   */
+  struct SubStringRange {
+    uint32_t start;
+    uint32_t length;
+  };
+
+  /**
+   * Creates one substring of `string` per entry in `ranges` and writes the
+   * results to `out`, which must have space for `count` elements. The parent
+   * string is flattened and unwrapped only once, and every range of at least
+   * the isolate's sliced-string threshold (see
+   * Isolate::SetSlicedStringMinLength()) becomes a zero-copy slice of the
+   * parent. Returns false without creating any substring if a range exceeds
+   * the bounds of `string`.
+   */
+  static bool NewSubStrings(Isolate* isolate, Local<String> string,
+                            const SubStringRange* ranges, size_t count,
+                            Local<String>* out);
+
   /**
    * Creates a new external string using the data defined in the given
    * resource. When the external string is no longer live on V8's heap the
@@ -548,6 +570,55 @@ class V8_EXPORT String : public Name {
     int length_;
   };
 
+  /**
+   * Returns a view onto a string's contents without copying them.
+   *
+   * The view exposes the raw flat storage of the string: a one-byte
+   * (Latin-1) or two-byte (UTF-16) span, as indicated by is_one_byte().
+   * Non-flat strings are flattened on construction.
+   *
+   * While a ValueView is alive, garbage collection is not allowed, so no
+   * V8 heap allocating operations may be performed. The data becomes
+   * invalid when the view is destroyed; callers needing longer-lived
+   * access must copy it out.
+   */
+  class V8_EXPORT ValueView {
+   public:
+    ValueView(v8::Isolate* isolate, v8::Local<v8::String> str);
+    ~ValueView();
+
+    const uint8_t* data8() const {
+#ifdef V8_ENABLE_CHECKS
+      CheckOneByte(true);
+#endif
+      return static_cast<const uint8_t*>(data_);
+    }
+    const uint16_t* data16() const {
+#ifdef V8_ENABLE_CHECKS
+      CheckOneByte(false);
+#endif
+      return static_cast<const uint16_t*>(data_);
+    }
+    uint32_t length() const { return length_; }
+    bool is_one_byte() const { return is_one_byte_; }
+
+    // Disallow copying and assigning.
+    ValueView(const ValueView&) = delete;
+    void operator=(const ValueView&) = delete;
+
+   private:
+    void CheckOneByte(bool is_one_byte) const;
+
+    Local<v8::String> flat_str_;
+    const void* data_;
+    uint32_t length_;
+    bool is_one_byte_;
+    // Avoids exposing the internal DisallowGarbageCollection object to the
+    // public API; see v8-internal.h.
+    alignas(internal::Internals::kDisallowGarbageCollectionAlign) char
+        no_gc_debug_scope_[internal::Internals::kDisallowGarbageCollectionSize];
+  };
+
  private:
   void VerifyExternalStringResourceBase(ExternalStringResourceBase* v,
                                         Encoding encoding) const;
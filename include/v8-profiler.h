@@ -1042,6 +1042,21 @@ class V8_EXPORT HeapProfiler {
     kExposeNumericValues
   };
 
+  enum class GarbageCollectionMode {
+    /**
+     * Perform a full garbage collection before taking the snapshot, so that
+     * only reachable objects are included.
+     */
+    kFull,
+    /**
+     * Do not trigger a garbage collection before taking the snapshot. This
+     * bounds the pause to the heap traversal itself, which makes snapshotting
+     * large heaps in production feasible, at the cost of possibly including
+     * objects that are no longer reachable but have not been collected yet.
+     */
+    kNone,
+  };
+
   struct HeapSnapshotOptions final {
     // Manually define default constructor here to be able to use it in
     // `TakeSnapshot()` below.
@@ -1069,6 +1084,10 @@ class V8_EXPORT HeapProfiler {
      */
     cppgc::EmbedderStackState stack_state =
         cppgc::EmbedderStackState::kMayContainHeapPointers;
+    /**
+     * GC to perform before taking the snapshot, see `GarbageCollectionMode`.
+     */
+    GarbageCollectionMode gc_mode = GarbageCollectionMode::kFull;
   };
 
   /**
@@ -1166,6 +1185,47 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Entry of an allocation type histogram, see
+   * StartAllocationTypeHistogram().
+   */
+  struct AllocationTypeHistogramEntry {
+    /** Name of the instance type, e.g. "JS_OBJECT_TYPE". The string has
+     * static storage duration. */
+    const char* type_name;
+    /** Number of sampled allocations of this type. */
+    size_t count;
+    /** Total size in bytes of sampled allocations of this type. */
+    size_t bytes;
+  };
+
+  /**
+   * Starts recording a histogram of sampled allocations keyed by instance
+   * type. Unlike StartSamplingHeapProfiler, no stack traces and no per-sample
+   * state are recorded, so the overhead is low enough for always-on use in
+   * production; the data is suited for watching object population drift
+   * rather than attributing allocations to code.
+   *
+   * On average one allocation is sampled every |sample_interval| bytes
+   * allocated.
+   *
+   * Returns false if an allocation type histogram is already being recorded.
+   */
+  bool StartAllocationTypeHistogram(uint64_t sample_interval = 512 * 1024);
+
+  /**
+   * Returns the histogram entries accumulated since the previous call to this
+   * function (or since StartAllocationTypeHistogram), and resets the
+   * histogram. Returns an empty vector if recording is not active.
+   */
+  std::vector<AllocationTypeHistogramEntry> GetAllocationTypeHistogramDelta();
+
+  /**
+   * Stops recording the allocation type histogram and discards the current
+   * entries.
+   */
+  void StopAllocationTypeHistogram();
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
@@ -550,6 +550,16 @@ class V8_EXPORT ScriptCompiler {
      * V8 has parsed the data it received so far.
      */
     virtual size_t GetMoreData(const uint8_t** src) = 0;
+
+    /**
+     * Returns true if the chunks returned by GetMoreData remain owned by the
+     * embedder and stay valid until the StreamedSource is destroyed. By
+     * default V8 takes ownership of each chunk and frees it with delete[].
+     * Embedders that stream out of a persistent backing store, e.g. a
+     * memory-mapped file, can override this to avoid copying the source an
+     * additional time.
+     */
+    virtual bool ChunksOwnedByEmbedder() const { return false; }
   };
 
   /**
@@ -837,6 +847,25 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Configures a directory in which V8 persists per-script code caches
+   * across isolate restarts. When set, scripts compiled without explicit
+   * cached data consult the directory first; on a miss, or when a stale
+   * entry is rejected, the freshly compiled script is written back. Entries
+   * are keyed by a hash of the script source and origin, so no embedder-side
+   * bookkeeping is required. The embedder must ensure the directory exists
+   * and is writable. Pass nullptr to disable.
+   */
+  static void SetCodeCacheDirectory(Isolate* isolate, const char* path);
+
+  /**
+   * Rewrites the code cache directory entry for the given script, including
+   * bytecode for inner functions that were lazily compiled after the script
+   * was first cached. Does nothing if no code cache directory is configured.
+   */
+  static void UpdateCodeCacheDirectoryEntry(
+      Local<UnboundScript> unbound_script);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
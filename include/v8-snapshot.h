@@ -12,6 +12,7 @@
 
 namespace v8 {
 
+class Context;
 class Object;
 
 namespace internal {
@@ -214,6 +215,28 @@ class V8_EXPORT SnapshotCreator {
   friend class internal::SnapshotCreatorImpl;
 };
 
+/**
+ * Captures a warmed |context| from a running isolate into a startup blob, at
+ * runtime. This lets embedders install their native bindings once, snapshot
+ * the resulting context, and create subsequent isolates from the blob so that
+ * their contexts deserialize instead of re-instantiating every binding.
+ *
+ * In contrast to SnapshotCreator, the isolate does not need to have been set
+ * up for serialization; the serializer runs in a permissive mode suitable for
+ * live isolates. The caller must capture at a quiescent point (no pending
+ * microtasks or in-flight background compilations), and all external
+ * references used by the bindings must have been passed via
+ * CreateParams::external_references to both the capturing and the consuming
+ * isolates. Compiled function code is not included in the blob.
+ *
+ * \returns { nullptr, 0 } on failure, and a startup snapshot on success. The
+ *          caller acquires ownership of the data array in the return value.
+ */
+V8_EXPORT StartupData CreateWarmedContextSnapshot(
+    Isolate* isolate, Local<Context> context,
+    SerializeInternalFieldsCallback internal_fields_serializer =
+        SerializeInternalFieldsCallback());
+
 template <class T>
 size_t SnapshotCreator::AddData(Local<Context> context, Local<T> object) {
   return AddData(context, internal::ValueHelper::ValueAsAddress(*object));
@@ -248,12 +248,55 @@ class V8_EXPORT HeapCodeStatistics {
   size_t bytecode_and_metadata_size() { return bytecode_and_metadata_size_; }
   size_t external_script_source_size() { return external_script_source_size_; }
   size_t cpu_profiler_metadata_size() { return cpu_profiler_metadata_size_; }
+  /**
+   * Cumulative size of bytecode discarded by code flushing since the isolate
+   * was created.
+   */
+  size_t flushed_code_size() { return flushed_code_size_; }
+  /**
+   * Cumulative size of source position tables discarded from bytecode that
+   * has not been executed recently. The tables are recollected on demand when
+   * source positions are requested again.
+   */
+  size_t flushed_source_position_size() {
+    return flushed_source_position_size_;
+  }
 
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
   size_t external_script_source_size_;
   size_t cpu_profiler_metadata_size_;
+  size_t flushed_code_size_;
+  size_t flushed_source_position_size_;
+
+  friend class Isolate;
+};
+
+/**
+ * Statistics about zone memory, the temporary memory backing parser and
+ * compiler jobs.
+ *
+ * Instances of this class can be passed to v8::Isolate::GetZoneStatistics to
+ * get zone allocator statistics from V8.
+ */
+class V8_EXPORT ZoneStatistics {
+ public:
+  ZoneStatistics();
+  size_t allocated_bytes() { return allocated_bytes_; }
+  size_t peak_allocated_bytes() { return peak_allocated_bytes_; }
+  /** Bytes held in the zone segment pool, waiting for reuse. */
+  size_t pooled_bytes() { return pooled_bytes_; }
+  /** Segment allocations served from resp. missing the segment pool. */
+  size_t segment_pool_hits() { return segment_pool_hits_; }
+  size_t segment_pool_misses() { return segment_pool_misses_; }
+
+ private:
+  size_t allocated_bytes_;
+  size_t peak_allocated_bytes_;
+  size_t pooled_bytes_;
+  size_t segment_pool_hits_;
+  size_t segment_pool_misses_;
 
   friend class Isolate;
 };
@@ -259,6 +259,28 @@ using GenericNamedPropertyDeleterCallback =
 using GenericNamedPropertyEnumeratorCallback =
     void (*)(const PropertyCallbackInfo<Array>& info);
 
+/**
+ * Returns all properties the named property getter intercepts together with
+ * their current values in a single callback, i.e., a combined enumerator and
+ * getter. Embedders whose objects are commonly read wholesale (for example
+ * with `Object.keys()` followed by reads of every property, or with
+ * `JSON.stringify()`) can implement this callback to reduce N API crossings
+ * to one.
+ *
+ * Use `info.GetReturnValue().Set(array)` with an array containing an even
+ * number of elements, alternating property names (which must be strings) and
+ * their values. The array must cover exactly the own enumerable string-keyed
+ * properties the interceptor provides; it also serves as the enumerator when
+ * no enumerator callback is installed. Not setting a return value makes V8
+ * fall back to the per-property callbacks.
+ *
+ * V8 consults this callback only for bulk own-property operations and only
+ * when the interceptor is the sole source of the object's properties;
+ * individual property reads continue to use the getter callback.
+ */
+using GenericNamedPropertyBulkGetterCallback =
+    void (*)(const PropertyCallbackInfo<Array>& info);
+
 /**
  * Interceptor for defineProperty requests on an object.
  *
@@ -695,6 +717,8 @@ struct NamedPropertyHandlerConfiguration {
   GenericNamedPropertyEnumeratorCallback enumerator;
   GenericNamedPropertyDefinerCallback definer;
   GenericNamedPropertyDescriptorCallback descriptor;
+  /** Optional, see `GenericNamedPropertyBulkGetterCallback`. */
+  GenericNamedPropertyBulkGetterCallback bulk_getter = nullptr;
   Local<Value> data;
   PropertyHandlerFlags flags;
 };
@@ -947,6 +971,17 @@ class V8_EXPORT ObjectTemplate : public Template {
   void SetCodeLike();
   bool IsCodeLike() const;
 
+  /**
+   * Hints that instances created from this template are long-lived. Instances
+   * are then allocated directly in the old generation, which avoids the cost
+   * of moving them out of the young generation during their first garbage
+   * collection. Only use this for objects that are known to survive, e.g.
+   * wrappers with application lifetime; pretenuring short-lived objects makes
+   * old-generation garbage collections more expensive.
+   */
+  void SetPretenured();
+  bool IsPretenured() const;
+
   V8_INLINE static ObjectTemplate* Cast(Data* data);
 
  private:
@@ -68,6 +68,14 @@ class V8_EXPORT Uint8Array : public TypedArray {
                                size_t byte_offset, size_t length);
   static Local<Uint8Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Uint8Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Uint8Array>* out_views);
   V8_INLINE static Uint8Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -97,6 +105,14 @@ class V8_EXPORT Uint8ClampedArray : public TypedArray {
   static Local<Uint8ClampedArray> New(
       Local<SharedArrayBuffer> shared_array_buffer, size_t byte_offset,
       size_t length);
+  /**
+   * Creates |count| Uint8ClampedArrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Uint8ClampedArray>* out_views);
   V8_INLINE static Uint8ClampedArray* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -125,6 +141,14 @@ class V8_EXPORT Int8Array : public TypedArray {
                               size_t byte_offset, size_t length);
   static Local<Int8Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                               size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Int8Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Int8Array>* out_views);
   V8_INLINE static Int8Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -153,6 +177,14 @@ class V8_EXPORT Uint16Array : public TypedArray {
                                 size_t byte_offset, size_t length);
   static Local<Uint16Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                 size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Uint16Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Uint16Array>* out_views);
   V8_INLINE static Uint16Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -181,6 +213,14 @@ class V8_EXPORT Int16Array : public TypedArray {
                                size_t byte_offset, size_t length);
   static Local<Int16Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Int16Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Int16Array>* out_views);
   V8_INLINE static Int16Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -209,6 +249,14 @@ class V8_EXPORT Uint32Array : public TypedArray {
                                 size_t byte_offset, size_t length);
   static Local<Uint32Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                 size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Uint32Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Uint32Array>* out_views);
   V8_INLINE static Uint32Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -237,6 +285,14 @@ class V8_EXPORT Int32Array : public TypedArray {
                                size_t byte_offset, size_t length);
   static Local<Int32Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Int32Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Int32Array>* out_views);
   V8_INLINE static Int32Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -265,6 +321,14 @@ class V8_EXPORT Float32Array : public TypedArray {
                                  size_t byte_offset, size_t length);
   static Local<Float32Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                  size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Float32Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Float32Array>* out_views);
   V8_INLINE static Float32Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -293,6 +357,14 @@ class V8_EXPORT Float64Array : public TypedArray {
                                  size_t byte_offset, size_t length);
   static Local<Float64Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                  size_t byte_offset, size_t length);
+  /**
+   * Creates |count| Float64Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<Float64Array>* out_views);
   V8_INLINE static Float64Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -321,6 +393,14 @@ class V8_EXPORT BigInt64Array : public TypedArray {
                                   size_t byte_offset, size_t length);
   static Local<BigInt64Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                   size_t byte_offset, size_t length);
+  /**
+   * Creates |count| BigInt64Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<BigInt64Array>* out_views);
   V8_INLINE static BigInt64Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -349,6 +429,14 @@ class V8_EXPORT BigUint64Array : public TypedArray {
                                    size_t byte_offset, size_t length);
   static Local<BigUint64Array> New(Local<SharedArrayBuffer> shared_array_buffer,
                                    size_t byte_offset, size_t length);
+  /**
+   * Creates |count| BigUint64Arrays viewing |array_buffer|, one per
+   * (byte offset, length) pair, and writes them to |out_views|. Returns
+   * false and creates no views if a length exceeds kMaxLength.
+   */
+  static bool NewBatch(Local<ArrayBuffer> array_buffer,
+                       const size_t* byte_offsets, const size_t* lengths,
+                       size_t count, Local<BigUint64Array>* out_views);
   V8_INLINE static BigUint64Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
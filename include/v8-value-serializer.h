@@ -109,6 +109,26 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetSharedArrayBufferId(
         Isolate* isolate, Local<SharedArrayBuffer> shared_array_buffer);
 
+    /**
+     * Called when the ValueSerializer serializes an ArrayBuffer while
+     * out-of-band ArrayBuffer treatment is enabled (see
+     * ValueSerializer::SetTreatArrayBuffersAsOutOfBand). The embedder must
+     * keep the buffer's backing store alive until the data has been
+     * deserialized, and must return an ID under which the receiving side
+     * will register a corresponding ArrayBuffer via
+     * ValueDeserializer::TransferArrayBuffer. The ID shares the number space
+     * with IDs passed to ValueSerializer::TransferArrayBuffer.
+     *
+     * Unlike a transferred buffer, the serialized buffer is not detached;
+     * the embedder is responsible for ensuring that sharing the backing
+     * store with the deserializing context is safe.
+     *
+     * If the object cannot be serialized, an exception should be thrown and
+     * Nothing<uint32_t>() returned.
+     */
+    virtual Maybe<uint32_t> GetOutOfBandArrayBufferId(
+        Isolate* isolate, Local<ArrayBuffer> array_buffer);
+
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
 
@@ -190,6 +210,18 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether to serialize ArrayBuffers out of band, i.e. emit only a
+   * reference obtained from Delegate::GetOutOfBandArrayBufferId instead of
+   * copying the buffer's contents into the wire format. This avoids the
+   * O(bytes) copy for large payloads; the backing store is shared with the
+   * deserializing context rather than detached. This should not be called
+   * when no Delegate was passed.
+   *
+   * The default is to copy ArrayBuffer contents into the buffer.
+   */
+  void SetTreatArrayBuffersAsOutOfBand(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
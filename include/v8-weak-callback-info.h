@@ -63,6 +63,21 @@ enum class WeakCallbackType {
    * Passes the first two internal fields of the object back to the callback.
    */
   kInternalFields,
+  /**
+   * Same as kParameter, but additionally signals that the first pass of the
+   * callback is safe to invoke from a background thread. V8 may then fan out
+   * large batches of such callbacks over worker threads during weak handle
+   * processing; all callbacks are still completed before the GC cycle
+   * finishes. The restrictions documented on |WeakCallbackInfo| apply
+   * unchanged, i.e. the callback must reset the handle and may not call any
+   * other V8 API.
+   */
+  kParameterThreadSafe,
+  /**
+   * Same as kInternalFields, with the thread-safety guarantee of
+   * kParameterThreadSafe.
+   */
+  kInternalFieldsThreadSafe,
 };
 
 template <class T>
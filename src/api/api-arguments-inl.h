@@ -123,6 +123,19 @@ Handle<JSObject> PropertyCallbackArguments::CallNamedEnumerator(
   return CallPropertyEnumerator(interceptor);
 }
 
+Handle<JSObject> PropertyCallbackArguments::CallNamedBulkGetter(
+    Handle<InterceptorInfo> interceptor) {
+  DCHECK(interceptor->is_named());
+  Isolate* isolate = this->isolate();
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kNamedBulkGetterCallback);
+  GenericNamedPropertyBulkGetterCallback f =
+      ToCData<GenericNamedPropertyBulkGetterCallback>(
+          interceptor->bulk_getter());
+  PREPARE_CALLBACK_INFO_INTERCEPTOR(isolate, f, v8::Array, interceptor);
+  f(callback_info);
+  return GetReturnValue<JSObject>(isolate);
+}
+
 Handle<Object> PropertyCallbackArguments::CallNamedQuery(
     Handle<InterceptorInfo> interceptor, Handle<Name> name) {
   DCHECK_NAME_COMPATIBLE(interceptor, name);
@@ -119,6 +119,8 @@ class PropertyCallbackArguments final
                                             Handle<Name> name);
   inline Handle<JSObject> CallNamedEnumerator(
       Handle<InterceptorInfo> interceptor);
+  inline Handle<JSObject> CallNamedBulkGetter(
+      Handle<InterceptorInfo> interceptor);
 
   // -------------------------------------------------------------------------
   // Indexed Interceptor Callbacks
@@ -401,6 +401,12 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
   RCS_SCOPE(isolate, RuntimeCallCounterId::kInstantiateObject);
   Handle<JSFunction> constructor;
   bool should_cache = info->should_cache();
+  // Templates marked as pretenured allocate their instances directly in old
+  // space, skipping the young generation for objects the embedder knows are
+  // long-lived.
+  const AllocationType allocation = info->should_pretenure()
+                                        ? AllocationType::kOld
+                                        : AllocationType::kYoung;
   if (!new_target.is_null()) {
     if (IsSimpleInstantiation(isolate, *info, *new_target)) {
       constructor = Handle<JSFunction>::cast(new_target);
@@ -415,7 +421,7 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
     if (ProbeInstantiationsCache(isolate, isolate->native_context(),
                                  info->serial_number(), CachingMode::kLimited)
             .ToHandle(&result)) {
-      return isolate->factory()->CopyJSObject(result);
+      return isolate->factory()->CopyJSObject(result, allocation);
     }
   }
 
@@ -441,7 +447,8 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
   Handle<JSObject> object;
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, object,
-      JSObject::New(constructor, new_target, Handle<AllocationSite>::null()),
+      JSObject::New(constructor, new_target, Handle<AllocationSite>::null(),
+                    allocation),
       JSObject);
 
   if (is_prototype) JSObject::OptimizeAsPrototype(object);
@@ -459,7 +466,7 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
     if (should_cache) {
       CacheTemplateInstantiation(isolate, isolate->native_context(), info,
                                  CachingMode::kLimited, result);
-      result = isolate->factory()->CopyJSObject(result);
+      result = isolate->factory()->CopyJSObject(result, allocation);
     }
   }
 
@@ -7,6 +7,7 @@
 #include <algorithm>  // For min
 #include <cmath>      // For isnan.
 #include <limits>
+#include <map>
 #include <sstream>
 #include <string>
 #include <utility>  // For move
@@ -30,9 +31,11 @@
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/bits.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/platform/memory.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
@@ -56,6 +59,7 @@
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
 #include "src/execution/simulator.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
@@ -67,9 +71,11 @@
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
+#include "src/init/isolate-pool.h"
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -121,6 +127,7 @@
 #include "src/runtime/runtime.h"
 #include "src/sandbox/external-pointer.h"
 #include "src/sandbox/sandbox.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/snapshot.h"
@@ -131,6 +138,7 @@
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
 #include "src/utils/version.h"
+#include "src/zone/accounting-allocator.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
@@ -515,22 +523,98 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
 
 class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
  public:
-  void* Allocate(size_t length) override { return base::Calloc(length, 1); }
+  ~ArrayBufferAllocator() override {
+    for (const auto& size_class : pool_) {
+      for (void* block : size_class.second) {
+        base::Free(block);
+      }
+    }
+  }
+
+  void* Allocate(size_t length) override {
+    if (IsPoolable(length)) {
+      if (void* data = TryAllocatePooled(length)) {
+        memset(data, 0, length);
+        return data;
+      }
+      return base::Calloc(SizeClass(length), 1);
+    }
+    return base::Calloc(length, 1);
+  }
 
   void* AllocateUninitialized(size_t length) override {
+    if (IsPoolable(length)) {
+      if (void* data = TryAllocatePooled(length)) return data;
+      return base::Malloc(SizeClass(length));
+    }
     return base::Malloc(length);
   }
 
-  void Free(void* data, size_t) override { base::Free(data); }
+  void Free(void* data, size_t length) override {
+    if (IsPoolable(length) && TryFreePooled(data, length)) return;
+    base::Free(data);
+  }
 
   void* Reallocate(void* data, size_t old_length, size_t new_length) override {
-    void* new_data = base::Realloc(data, new_length);
+    // Poolable blocks are allocated at their full size class, so growing
+    // within the class needs no reallocation.
+    const size_t allocated_size =
+        IsPoolable(old_length) ? SizeClass(old_length) : old_length;
+    void* new_data = data;
+    if (new_length > allocated_size || !IsPoolable(new_length)) {
+      new_data = base::Realloc(
+          data, IsPoolable(new_length) ? SizeClass(new_length) : new_length);
+      if (new_data == nullptr) return nullptr;
+    }
     if (new_length > old_length) {
       memset(reinterpret_cast<uint8_t*>(new_data) + old_length, 0,
              new_length - old_length);
     }
     return new_data;
   }
+
+ private:
+  // With --array-buffer-pooling, freed backing stores between kMinPooledSize
+  // and kMaxPooledSize are held back in per-size-class free lists and reused
+  // by later allocations of the same class, which avoids the allocation and
+  // page fault churn of workloads that rapidly cycle through similar-sized
+  // buffers. Poolable blocks are always allocated at their full power-of-two
+  // size class so that recycled blocks can serve any request of that class.
+  static constexpr size_t kMinPooledSize = 64 * i::KB;
+  static constexpr size_t kMaxPooledSize = 4 * i::MB;
+  static constexpr size_t kMaxPooledBytes = 64 * i::MB;
+
+  static size_t SizeClass(size_t length) {
+    return base::bits::RoundUpToPowerOfTwo(length);
+  }
+
+  static bool IsPoolable(size_t length) {
+    return i::v8_flags.array_buffer_pooling && length >= kMinPooledSize &&
+           length <= kMaxPooledSize;
+  }
+
+  void* TryAllocatePooled(size_t length) {
+    base::MutexGuard guard(&mutex_);
+    auto it = pool_.find(SizeClass(length));
+    if (it == pool_.end() || it->second.empty()) return nullptr;
+    void* data = it->second.back();
+    it->second.pop_back();
+    pooled_bytes_ -= SizeClass(length);
+    return data;
+  }
+
+  bool TryFreePooled(void* data, size_t length) {
+    const size_t size_class = SizeClass(length);
+    base::MutexGuard guard(&mutex_);
+    if (pooled_bytes_ + size_class > kMaxPooledBytes) return false;
+    pool_[size_class].push_back(data);
+    pooled_bytes_ += size_class;
+    return true;
+  }
+
+  base::Mutex mutex_;
+  std::map<size_t, std::vector<void*>> pool_;
+  size_t pooled_bytes_ = 0;
 };
 #endif  // V8_ENABLE_SANDBOX
 
@@ -588,6 +672,16 @@ StartupData SnapshotCreator::CreateBlob(
   return impl_->CreateBlob(function_code_handling);
 }
 
+StartupData CreateWarmedContextSnapshot(
+    Isolate* v8_isolate, Local<Context> context,
+    SerializeInternalFieldsCallback internal_fields_serializer) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::Context> i_context = Utils::OpenHandle(*context);
+  return i::Snapshot::CreateWarmStartupBlob(i_isolate, i_context,
+                                            internal_fields_serializer);
+}
+
 bool StartupData::CanBeRehashed() const {
   DCHECK(i::Snapshot::VerifyChecksum(this));
   return i::Snapshot::ExtractRehashability(this);
@@ -1427,23 +1521,43 @@ void FunctionTemplate::SetCallHandler(
   if (!c_function_overloads.empty()) {
     // Stores the data for a sequence of CFunction overloads into a single
     // FixedArray, as [address_0, signature_0, ... address_n-1, signature_n-1].
-    i::Handle<i::FixedArray> function_overloads =
-        i_isolate->factory()->NewFixedArray(static_cast<int>(
-            c_function_overloads.size() *
-            i::FunctionTemplateInfo::kFunctionOverloadEntrySize));
+    // A CFunction's batch variant is stored as an overload entry of its own;
+    // since it must differ in arity from its base function, call sites select
+    // it through the regular compile time overload resolution.
     int function_count = static_cast<int>(c_function_overloads.size());
-    for (int i = 0; i < function_count; i++) {
+    for (size_t i = 0; i < c_function_overloads.size(); i++) {
+      if (c_function_overloads.data()[i].HasBatchVariant()) function_count++;
+    }
+    i::Handle<i::FixedArray> function_overloads =
+        i_isolate->factory()->NewFixedArray(
+            function_count *
+            i::FunctionTemplateInfo::kFunctionOverloadEntrySize);
+    int entry_index = 0;
+    for (size_t i = 0; i < c_function_overloads.size(); i++) {
       const CFunction& c_function = c_function_overloads.data()[i];
       i::Handle<i::Object> address =
           FromCData(i_isolate, c_function.GetAddress());
-      function_overloads->set(
-          i::FunctionTemplateInfo::kFunctionOverloadEntrySize * i, *address);
+      function_overloads->set(entry_index++, *address);
       i::Handle<i::Object> signature =
           FromCData(i_isolate, c_function.GetTypeInfo());
-      function_overloads->set(
-          i::FunctionTemplateInfo::kFunctionOverloadEntrySize * i + 1,
-          *signature);
+      function_overloads->set(entry_index++, *signature);
+      if (c_function.HasBatchVariant()) {
+        Utils::ApiCheck(c_function.GetBatchTypeInfo()->ArgumentCount() !=
+                            c_function.GetTypeInfo()->ArgumentCount(),
+                        "v8::FunctionTemplate::SetCallHandler",
+                        "The batch variant of a CFunction must differ in "
+                        "arity from its base function");
+        i::Handle<i::Object> batch_address =
+            FromCData(i_isolate, c_function.GetBatchAddress());
+        function_overloads->set(entry_index++, *batch_address);
+        i::Handle<i::Object> batch_signature =
+            FromCData(i_isolate, c_function.GetBatchTypeInfo());
+        function_overloads->set(entry_index++, *batch_signature);
+      }
     }
+    DCHECK_EQ(entry_index,
+              function_count *
+                  i::FunctionTemplateInfo::kFunctionOverloadEntrySize);
     i::FunctionTemplateInfo::SetCFunctionOverloads(i_isolate, info,
                                                    function_overloads);
   }
@@ -1750,11 +1864,15 @@ template <typename Getter, typename Setter, typename Query, typename Descriptor,
 i::Handle<i::InterceptorInfo> CreateNamedInterceptorInfo(
     i::Isolate* i_isolate, Getter getter, Setter setter, Query query,
     Descriptor descriptor, Deleter remover, Enumerator enumerator,
-    Definer definer, Local<Value> data, PropertyHandlerFlags flags) {
+    Definer definer, Local<Value> data, PropertyHandlerFlags flags,
+    GenericNamedPropertyBulkGetterCallback bulk_getter = nullptr) {
   auto interceptor =
       CreateInterceptorInfo(i_isolate, getter, setter, query, descriptor,
                             remover, enumerator, definer, data, flags);
   interceptor->set_is_named(true);
+  if (bulk_getter != nullptr) {
+    SET_FIELD_WRAPPED(i_isolate, interceptor, set_bulk_getter, bulk_getter);
+  }
   return interceptor;
 }
 
@@ -1776,15 +1894,16 @@ template <typename Getter, typename Setter, typename Query, typename Descriptor,
 void ObjectTemplateSetNamedPropertyHandler(
     ObjectTemplate* templ, Getter getter, Setter setter, Query query,
     Descriptor descriptor, Deleter remover, Enumerator enumerator,
-    Definer definer, Local<Value> data, PropertyHandlerFlags flags) {
+    Definer definer, Local<Value> data, PropertyHandlerFlags flags,
+    GenericNamedPropertyBulkGetterCallback bulk_getter = nullptr) {
   i::Isolate* i_isolate = Utils::OpenDirectHandle(templ)->GetIsolate();
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
   i::HandleScope scope(i_isolate);
   auto cons = EnsureConstructor(i_isolate, templ);
   EnsureNotPublished(cons, "ObjectTemplateSetNamedPropertyHandler");
-  auto obj =
-      CreateNamedInterceptorInfo(i_isolate, getter, setter, query, descriptor,
-                                 remover, enumerator, definer, data, flags);
+  auto obj = CreateNamedInterceptorInfo(i_isolate, getter, setter, query,
+                                        descriptor, remover, enumerator,
+                                        definer, data, flags, bulk_getter);
   i::FunctionTemplateInfo::SetNamedPropertyHandler(i_isolate, cons, obj);
 }
 }  // namespace
@@ -1794,7 +1913,7 @@ void ObjectTemplate::SetHandler(
   ObjectTemplateSetNamedPropertyHandler(
       this, config.getter, config.setter, config.query, config.descriptor,
       config.deleter, config.enumerator, config.definer, config.data,
-      config.flags);
+      config.flags, config.bulk_getter);
 }
 
 void ObjectTemplate::MarkAsUndetectable() {
@@ -1852,7 +1971,7 @@ void ObjectTemplate::SetAccessCheckCallbackAndHandler(
       i_isolate, named_handler.getter, named_handler.setter,
       named_handler.query, named_handler.descriptor, named_handler.deleter,
       named_handler.enumerator, named_handler.definer, named_handler.data,
-      named_handler.flags);
+      named_handler.flags, named_handler.bulk_getter);
   info->set_named_interceptor(*named_interceptor);
   auto indexed_interceptor = CreateIndexedInterceptorInfo(
       i_isolate, indexed_handler.getter, indexed_handler.setter,
@@ -1945,6 +2064,17 @@ void ObjectTemplate::SetCodeLike() {
   self->set_code_like(true);
 }
 
+bool ObjectTemplate::IsPretenured() const {
+  return Utils::OpenDirectHandle(this)->should_pretenure();
+}
+
+void ObjectTemplate::SetPretenured() {
+  auto self = Utils::OpenDirectHandle(this);
+  i::Isolate* i_isolate = self->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  self->set_should_pretenure(true);
+}
+
 Local<DictionaryTemplate> DictionaryTemplate::New(
     Isolate* isolate, MemorySpan<const std::string_view> names) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
@@ -2650,10 +2780,33 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
             source->compile_hint_callback_data, options, no_cache_reason,
             i::NOT_NATIVES_CODE, &source->compilation_details);
   } else {
-    // Compile without any cache.
-    maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
-        i_isolate, str, script_details, options, no_cache_reason,
-        i::NOT_NATIVES_CODE, &source->compilation_details);
+    // Compile without embedder-provided cached data. If a code cache
+    // directory is configured, consult it first and write back on a miss.
+    std::unique_ptr<i::CodeCacheDirectory::Entry> directory_entry;
+    if (options == kNoCompileOptions &&
+        !i_isolate->code_cache_directory().empty()) {
+      directory_entry = i::CodeCacheDirectory::Load(
+          i_isolate, str, script_details.origin_options);
+    }
+    if (directory_entry) {
+      maybe_function_info =
+          i::Compiler::GetSharedFunctionInfoForScriptWithCachedData(
+              i_isolate, str, script_details, directory_entry->cached_data(),
+              kConsumeCodeCache, no_cache_reason, i::NOT_NATIVES_CODE,
+              &source->compilation_details);
+    } else {
+      maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
+          i_isolate, str, script_details, options, no_cache_reason,
+          i::NOT_NATIVES_CODE, &source->compilation_details);
+    }
+    // Refresh the directory entry if there was none or it was stale.
+    i::Handle<i::SharedFunctionInfo> compiled;
+    if (options == kNoCompileOptions &&
+        !i_isolate->code_cache_directory().empty() &&
+        (!directory_entry || directory_entry->cached_data()->rejected()) &&
+        maybe_function_info.ToHandle(&compiled)) {
+      i::CodeCacheDirectory::Store(i_isolate, compiled);
+    }
   }
 
   has_exception = !maybe_function_info.ToHandle(&result);
@@ -2975,6 +3128,26 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+void ScriptCompiler::SetCodeCacheDirectory(Isolate* v8_isolate,
+                                           const char* path) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->set_code_cache_directory(path == nullptr ? std::string()
+                                                      : std::string(path));
+}
+
+void ScriptCompiler::UpdateCodeCacheDirectoryEntry(
+    Local<UnboundScript> unbound_script) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  DCHECK(!InReadOnlySpace(*shared));
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared);
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  Utils::ApiCheck(shared->is_toplevel(),
+                  "v8::ScriptCompiler::UpdateCodeCacheDirectoryEntry",
+                  "Expected top-level SharedFunctionInfo");
+  if (i_isolate->code_cache_directory().empty()) return;
+  i::CodeCacheDirectory::Store(i_isolate, shared);
+}
+
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
     Local<Function> function) {
   auto js_function =
@@ -3449,6 +3622,24 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::StreamedSource::StreamedSource() : impl_(new i::JsonStreamedSource()) {}
+
+JSON::StreamedSource::~StreamedSource() { delete impl_; }
+
+bool JSON::StreamedSource::AppendChunk(const uint8_t* data, size_t length) {
+  return impl_->AppendChunk(data, length);
+}
+
+MaybeLocal<Value> JSON::ParseStreamed(Local<Context> context,
+                                      StreamedSource* source) {
+  PREPARE_FOR_EXECUTION(context, JSON, ParseStreamed);
+  auto maybe = source->impl()->Parse(i_isolate);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3518,6 +3709,15 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetSharedArrayBufferId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetOutOfBandArrayBufferId(
+    Isolate* v8_isolate, Local<ArrayBuffer> array_buffer) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(), i::MessageTemplate::kDataCloneError,
+      Utils::OpenHandle(*array_buffer)));
+  return Nothing<uint32_t>();
+}
+
 Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
     Isolate* v8_isolate, Local<WasmModuleObject> module) {
   return Nothing<uint32_t>();
@@ -3565,6 +3765,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetTreatArrayBuffersAsOutOfBand(bool mode) {
+  private_->serializer.SetTreatArrayBuffersAsOutOfBand(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -6520,7 +6724,16 @@ HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0),
-      cpu_profiler_metadata_size_(0) {}
+      cpu_profiler_metadata_size_(0),
+      flushed_code_size_(0),
+      flushed_source_position_size_(0) {}
+
+ZoneStatistics::ZoneStatistics()
+    : allocated_bytes_(0),
+      peak_allocated_bytes_(0),
+      pooled_bytes_(0),
+      segment_pool_hits_(0),
+      segment_pool_misses_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -7202,6 +7415,11 @@ void Context::SetErrorMessageForWasmCodeGeneration(Local<String> error) {
   context->set_error_message_for_wasm_code_gen(*error_handle);
 }
 
+void Context::SetMemoryLimit(size_t limit_in_bytes) {
+  auto context = Utils::OpenDirectHandle(this);
+  context->native_context()->SetMemoryLimit(limit_in_bytes);
+}
+
 void Context::SetAbortScriptExecution(
     Context::AbortScriptExecutionCallback callback) {
   auto context = Utils::OpenDirectHandle(this);
@@ -7586,6 +7804,33 @@ Local<String> v8::String::Concat(Isolate* v8_isolate, Local<String> left,
   return Utils::ToLocal(result);
 }
 
+bool v8::String::NewSubStrings(Isolate* v8_isolate, Local<String> string,
+                               const SubStringRange* ranges, size_t count,
+                               Local<String>* out) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  auto str = Utils::OpenHandle(*string);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewSubStrings);
+  const uint32_t str_length = static_cast<uint32_t>(str->length());
+  for (size_t i = 0; i < count; ++i) {
+    if (ranges[i].start > str_length ||
+        ranges[i].length > str_length - ranges[i].start) {
+      return false;
+    }
+  }
+  static_assert(sizeof(SubStringRange) == sizeof(i::Factory::SubStringRange));
+  std::vector<i::Handle<i::String>> results(count);
+  i_isolate->factory()->NewSubStrings(
+      str,
+      base::Vector<const i::Factory::SubStringRange>(
+          reinterpret_cast<const i::Factory::SubStringRange*>(ranges), count),
+      base::VectorOf(results));
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = Utils::ToLocal(results[i]);
+  }
+  return true;
+}
+
 MaybeLocal<String> v8::String::NewExternalTwoByte(
     Isolate* v8_isolate, v8::String::ExternalStringResource* resource) {
   CHECK(resource && resource->data());
@@ -9155,6 +9400,33 @@ static_assert(v8::TypedArray::kMaxByteLength == i::JSTypedArray::kMaxByteLength,
     i::Handle<i::JSTypedArray> obj = i_isolate->factory()->NewJSTypedArray( \
         i::kExternal##Type##Array, buffer, byte_offset, length);            \
     return Utils::ToLocal##Type##Array(obj);                                \
+  }                                                                         \
+  bool Type##Array::NewBatch(Local<ArrayBuffer> array_buffer,               \
+                             const size_t* byte_offsets,                    \
+                             const size_t* lengths, size_t count,           \
+                             Local<Type##Array>* out_views) {               \
+    i::Isolate* i_isolate =                                                 \
+        Utils::OpenDirectHandle(*array_buffer)->GetIsolate();               \
+    API_RCS_SCOPE(i_isolate, Type##Array, NewBatch);                        \
+    ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);                             \
+    for (size_t i = 0; i < count; i++) {                                    \
+      if (!Utils::ApiCheck(lengths[i] <= kMaxLength,                        \
+                           "v8::" #Type                                     \
+                           "Array::NewBatch(Local<ArrayBuffer>, ...)",      \
+                           "length exceeds max allowed value")) {           \
+        return false;                                                       \
+      }                                                                     \
+    }                                                                       \
+    auto buffer = Utils::OpenHandle(*array_buffer);                         \
+    std::vector<i::Handle<i::JSTypedArray>> views(count);                   \
+    i_isolate->factory()->NewJSTypedArrayBatch(i::kExternal##Type##Array,   \
+                                               buffer, byte_offsets,        \
+                                               lengths, count,              \
+                                               views.data());               \
+    for (size_t i = 0; i < count; i++) {                                    \
+      out_views[i] = Utils::ToLocal##Type##Array(views[i]);                 \
+    }                                                                       \
+    return true;                                                            \
   }
 
 TYPED_ARRAYS(TYPED_ARRAY_NEW)
@@ -9420,6 +9692,24 @@ HeapProfiler* Isolate::GetHeapProfiler() {
   return reinterpret_cast<HeapProfiler*>(heap_profiler);
 }
 
+void Isolate::StartFunctionSelfTimeAttribution() {
+  reinterpret_cast<i::Isolate*>(this)
+      ->tiering_manager()
+      ->StartSelfTimeAttribution();
+}
+
+void Isolate::GetFunctionSelfTimeAttribution(FunctionSelfTimeCallback callback,
+                                             void* data) {
+  reinterpret_cast<i::Isolate*>(this)->tiering_manager()->GetSelfTimeAttribution(
+      callback, data);
+}
+
+void Isolate::StopFunctionSelfTimeAttribution() {
+  reinterpret_cast<i::Isolate*>(this)
+      ->tiering_manager()
+      ->StopSelfTimeAttribution();
+}
+
 void Isolate::SetIdle(bool is_idle) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->SetIdle(is_idle);
@@ -9695,6 +9985,8 @@ void Isolate::Initialize(Isolate* v8_isolate,
 
   i_isolate->set_api_external_references(params.external_references);
   i_isolate->set_allow_atomics_wait(params.allow_atomics_wait);
+  // Must be set before the heap allocates its first chunks below.
+  i_isolate->set_preferred_numa_node(params.preferred_numa_node);
 
   i_isolate->heap()->ConfigureHeap(params.constraints, params.cpp_heap);
   if (params.constraints.stack_limit() != nullptr) {
@@ -9748,6 +10040,26 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
   return v8_isolate;
 }
 
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t capacity)
+    : impl_(new i::IsolatePool(params, capacity)) {}
+
+IsolatePool::~IsolatePool() { delete impl_; }
+
+void IsolatePool::Prewarm(size_t count) { impl_->Prewarm(count); }
+
+Isolate* IsolatePool::Acquire() { return impl_->Acquire(); }
+
+bool IsolatePool::Release(Isolate* isolate) { return impl_->Release(isolate); }
+
+ObjectFactoryScope::ObjectFactoryScope(Isolate* v8_isolate)
+    : i_isolate_(reinterpret_cast<i::Isolate*>(v8_isolate)) {
+  i_isolate_->heap()->StartBulkAllocation();
+}
+
+ObjectFactoryScope::~ObjectFactoryScope() {
+  i_isolate_->heap()->EndBulkAllocation();
+}
+
 void Isolate::Dispose() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   if (!Utils::ApiCheck(!i_isolate->IsInUse(), "v8::Isolate::Dispose()",
@@ -10056,10 +10368,24 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
       i_isolate->external_script_source_size();
   code_statistics->cpu_profiler_metadata_size_ =
       i::CpuProfiler::GetAllProfilersMemorySize(i_isolate);
+  code_statistics->flushed_code_size_ = i_isolate->heap()->flushed_code_size();
+  code_statistics->flushed_source_position_size_ =
+      i_isolate->heap()->flushed_source_position_size();
 
   return true;
 }
 
+void Isolate::GetZoneStatistics(ZoneStatistics* zone_statistics) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::AccountingAllocator* allocator = i_isolate->allocator();
+
+  zone_statistics->allocated_bytes_ = allocator->GetCurrentMemoryUsage();
+  zone_statistics->peak_allocated_bytes_ = allocator->GetMaxMemoryUsage();
+  zone_statistics->pooled_bytes_ = allocator->GetPooledMemory();
+  zone_statistics->segment_pool_hits_ = allocator->GetSegmentPoolHits();
+  zone_statistics->segment_pool_misses_ = allocator->GetSegmentPoolMisses();
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10269,6 +10595,13 @@ void Isolate::LowMemoryNotification() {
   }
 }
 
+size_t Isolate::TrimMemory(double deadline_in_seconds,
+                           TrimMemoryReport* report) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  TRACE_EVENT0("v8", "V8.TrimMemory");
+  return i_isolate->heap()->TrimMemory(deadline_in_seconds * 1000, report);
+}
+
 int Isolate::ContextDisposedNotification(bool dependant_context) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
 #if V8_ENABLE_WEBASSEMBLY
@@ -10306,11 +10639,31 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   i_isolate->heap()->MemoryPressureNotification(level, on_isolate_thread);
 }
 
+void Isolate::ReserveGlobalHandleCapacity(size_t capacity) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->global_handles()->ReserveCapacity(capacity);
+}
+
+void Isolate::ReserveTracedHandleCapacity(size_t capacity) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->traced_handles()->ReserveCapacity(capacity);
+}
+
 void Isolate::SetBatterySaverMode(bool battery_saver_mode_enabled) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->set_battery_saver_mode_enabled(battery_saver_mode_enabled);
 }
 
+void Isolate::SetBackgroundGCTaskPriority(TaskPriority priority) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->set_background_gc_task_priority(priority);
+}
+
+void Isolate::SetGCPauseBudget(double budget_in_ms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetGCPauseBudget(budget_in_ms);
+}
+
 void Isolate::ClearCachesForTesting() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->AbortConcurrentOptimization(i::BlockingBehavior::kBlock);
@@ -10451,6 +10804,9 @@ CALLBACK_SETTER(JavaScriptCompileHintsMagicEnabledCallback,
                 JavaScriptCompileHintsMagicEnabledCallback,
                 compile_hints_magic_enabled_callback)
 
+CALLBACK_SETTER(ContextMemoryLimitCallback, ContextMemoryLimitCallback,
+                context_memory_limit_callback)
+
 void Isolate::InstallConditionalFeatures(Local<Context> context) {
   v8::HandleScope handle_scope(this);
   v8::Context::Scope context_scope(context);
@@ -10560,11 +10916,21 @@ void Isolate::SetAllowAtomicsWait(bool allow) {
   i_isolate->set_allow_atomics_wait(allow);
 }
 
+void Isolate::SetSlicedStringMinLength(int min_length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  // Substrings of fewer than 3 characters are served from the
+  // internalized-string caches and never sliced.
+  i_isolate->set_sliced_string_min_length(std::max(min_length, 3));
+}
+
 void v8::Isolate::DateTimeConfigurationChangeNotification(
     TimeZoneDetection time_zone_detection) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   API_RCS_SCOPE(i_isolate, Isolate, DateTimeConfigurationChangeNotification);
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  // The time zone is process state; throw away the offset segments shared
+  // across isolates before resetting this isolate's own caches.
+  i::SharedLocalTimeOffsetCache::Get()->Invalidate();
   i_isolate->date_cache()->ResetDateCache(
       static_cast<base::TimezoneCache::TimeZoneDetection>(time_zone_detection));
 #ifdef V8_INTL_SUPPORT
@@ -10707,6 +11073,50 @@ String::Value::Value(v8::Isolate* v8_isolate, v8::Local<v8::Value> obj)
 
 String::Value::~Value() { i::DeleteArray(str_); }
 
+String::ValueView::ValueView(v8::Isolate* v8_isolate,
+                             v8::Local<v8::String> str) {
+  i::Handle<i::String> i_str = Utils::OpenHandle(*str);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  // Flattening may allocate, so it has to happen before entering the no-GC
+  // scope below.
+  i::Handle<i::String> i_flat_str = i::String::Flatten(i_isolate, i_str);
+  flat_str_ = Utils::ToLocal(i_flat_str);
+
+  static_assert(sizeof(i::DisallowGarbageCollection) <=
+                sizeof(no_gc_debug_scope_));
+  static_assert(alignof(i::DisallowGarbageCollection) <=
+                internal::Internals::kDisallowGarbageCollectionAlign);
+  auto* no_gc = new (no_gc_debug_scope_) i::DisallowGarbageCollection();
+
+  i::String::FlatContent flat_content = i_flat_str->GetFlatContent(*no_gc);
+  DCHECK(flat_content.IsFlat());
+  is_one_byte_ = flat_content.IsOneByte();
+  length_ = i_flat_str->length();
+  if (is_one_byte_) {
+    data_ = flat_content.ToOneByteVector().begin();
+  } else {
+    data_ = flat_content.ToUC16Vector().begin();
+  }
+}
+
+String::ValueView::~ValueView() {
+  using DisallowGarbageCollection = i::DisallowGarbageCollection;
+  auto* no_gc =
+      reinterpret_cast<DisallowGarbageCollection*>(no_gc_debug_scope_);
+  no_gc->~DisallowGarbageCollection();
+}
+
+void String::ValueView::CheckOneByte(bool is_one_byte) const {
+  if (is_one_byte) {
+    Utils::ApiCheck(is_one_byte_, "v8::String::ValueView::data8",
+                    "Called the one-byte accessor on a two-byte string view.");
+  } else {
+    Utils::ApiCheck(!is_one_byte_, "v8::String::ValueView::data16",
+                    "Called the two-byte accessor on a one-byte string view.");
+  }
+}
+
 #define DEFINE_ERROR(NAME, name)                                              \
   Local<Value> Exception::NAME(v8::Local<v8::String> raw_message,             \
                                v8::Local<v8::Value> raw_options) {            \
@@ -11361,6 +11771,21 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+bool HeapProfiler::StartAllocationTypeHistogram(uint64_t sample_interval) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->StartAllocationTypeHistogram(
+      sample_interval);
+}
+
+std::vector<HeapProfiler::AllocationTypeHistogramEntry>
+HeapProfiler::GetAllocationTypeHistogramDelta() {
+  return reinterpret_cast<i::HeapProfiler*>(this)
+      ->GetAllocationTypeHistogramDelta();
+}
+
+void HeapProfiler::StopAllocationTypeHistogram() {
+  reinterpret_cast<i::HeapProfiler*>(this)->StopAllocationTypeHistogram();
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
@@ -11730,10 +12155,23 @@ void InvokeFinalizationRegistryCleanupFromTask(
   Local<v8::Context> api_context = Utils::ToLocal(native_context);
   CallDepthScope<true> call_depth_scope(i_isolate, api_context);
   VMState<OTHER> state(i_isolate);
-  Handle<Object> argv[] = {callback};
-  USE(Execution::CallBuiltin(i_isolate,
-                             i_isolate->finalization_registry_cleanup_some(),
-                             finalization_registry, arraysize(argv), argv));
+  Handle<Object> argv[] = {
+      callback,
+      handle(i::Smi::FromInt(
+                 i::v8_flags.finalization_registry_cleanup_batch_size),
+             i_isolate)};
+  i::Handle<i::Object> result;
+  if (!Execution::CallBuiltin(
+           i_isolate, i_isolate->finalization_registry_cleanup_from_task(),
+           finalization_registry, arraysize(argv), argv)
+           .ToHandle(&result)) {
+    return;
+  }
+  if (i::v8_flags.trace_finalization_registry_cleanup) {
+    i::PrintF("[finalization-registry] cleanup task processed %d cells (%s)\n",
+              i::Smi::ToInt(*result),
+              finalization_registry->NeedsCleanup() ? "more pending" : "done");
+  }
 }
 
 template <>
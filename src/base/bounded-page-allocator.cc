@@ -212,5 +212,14 @@ bool BoundedPageAllocator::DecommitPages(void* address, size_t size) {
   return page_allocator_->DecommitPages(address, size);
 }
 
+BoundedPageAllocator::Stats BoundedPageAllocator::GetStats() {
+  MutexGuard guard(&mutex_);
+  Stats stats;
+  stats.free_size = region_allocator_.free_size();
+  stats.free_region_count = region_allocator_.free_region_count();
+  stats.largest_free_region_size = region_allocator_.largest_free_region_size();
+  return stats;
+}
+
 }  // namespace base
 }  // namespace v8
@@ -94,6 +94,15 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
   // Allocates pages at given address, returns true on success.
   bool AllocatePagesAt(Address address, size_t size, Permission access);
 
+  // Snapshot of the region allocator's occupancy, for monitoring how
+  // fragmented the managed range has become.
+  struct Stats {
+    size_t free_size = 0;
+    size_t free_region_count = 0;
+    size_t largest_free_region_size = 0;
+  };
+  Stats GetStats();
+
   bool FreePages(void* address, size_t size) override;
 
   bool ReleasePages(void* address, size_t size, size_t new_size) override;
@@ -6,9 +6,11 @@
 
 #include <errno.h>
 
+#include <algorithm>
 #include <atomic>
 
 #include "src/base/platform/condition-variable.h"
+#include "src/base/platform/yield-processor.h"
 
 #if DEBUG
 #include <unordered_set>
@@ -443,6 +445,10 @@ void Mutex::Lock() { SbMutexAcquire(&native_handle_); }
 
 void Mutex::Unlock() { SbMutexRelease(&native_handle_); }
 
+bool Mutex::TryLock() {
+  return SbMutexIsSuccess(SbMutexAcquireTry(&native_handle_));
+}
+
 RecursiveMutex::RecursiveMutex() {}
 
 RecursiveMutex::~RecursiveMutex() {}
@@ -488,5 +494,31 @@ bool SharedMutex::TryLockExclusive() {
 }
 #endif  // V8_OS_STARBOARD
 
+void AdaptiveMutex::LockSlow() {
+  contended_locks_.fetch_add(1, std::memory_order_relaxed);
+  int spin_limit = spin_limit_.load(std::memory_order_relaxed);
+#if !defined(THREAD_SANITIZER)
+  // Under TSan, YIELD_PROCESSOR expands to a real sleep (see
+  // yield-processor.h), so spinning would turn every contended lock into a
+  // series of millisecond stalls; block right away instead.
+  for (int i = 0; i < spin_limit; i++) {
+    YIELD_PROCESSOR;
+    if (mutex_.TryLock()) {
+      // Spinning paid off; allow spinning a little longer next time.
+      if (spin_limit < kMaxSpinCount) {
+        spin_limit_.store(spin_limit + 1, std::memory_order_relaxed);
+      }
+      spin_acquisitions_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+#endif  // !defined(THREAD_SANITIZER)
+  // The owner holds the mutex for longer than it is worth spinning; shrink
+  // the spin limit and suspend in the operating system.
+  spin_limit_.store(std::max(spin_limit / 2, kMinSpinCount),
+                    std::memory_order_relaxed);
+  mutex_.Lock();
+}
+
 }  // namespace base
 }  // namespace v8
@@ -681,6 +681,46 @@ bool OS::HasLazyCommits() {
 }
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX
+  constexpr uintptr_t kHugePageSize = uintptr_t{2} * 1024 * 1024;
+  const uintptr_t huge_start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kHugePageSize);
+  const uintptr_t huge_end =
+      RoundDown(reinterpret_cast<uintptr_t>(address) + size, kHugePageSize);
+  if (huge_end <= huge_start) return;
+  // This is advisory; it fails e.g. when transparent huge pages are disabled
+  // system-wide, so the result is deliberately ignored.
+  madvise(reinterpret_cast<void*>(huge_start), huge_end - huge_start,
+          MADV_HUGEPAGE);
+#endif  // V8_OS_LINUX
+}
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int numa_node) {
+#if V8_OS_LINUX && defined(__NR_mbind)
+  DCHECK_GE(numa_node, 0);
+  // A single mask word limits us to the first 64 nodes, which is plenty for
+  // the multi-socket machines this is meant for.
+  if (numa_node >=
+      static_cast<int>(sizeof(unsigned long) * CHAR_BIT)) {  // NOLINT
+    return false;
+  }
+  // MPOL_PREFERRED places pages on the given node when they are faulted in
+  // but falls back to other nodes under memory pressure. Issued as a raw
+  // syscall to avoid a libnuma dependency; glibc provides no wrapper.
+  constexpr int kMpolPreferred = 1;
+  const unsigned long nodemask = 1UL << numa_node;  // NOLINT(runtime/int)
+  const unsigned long maxnode =  // NOLINT(runtime/int)
+      sizeof(nodemask) * CHAR_BIT + 1;
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &nodemask, maxnode,
+                 0) == 0;
+#else
+  return false;
+#endif  // V8_OS_LINUX && defined(__NR_mbind)
+}
+
 const char* OS::GetGCFakeMMapFile() {
   return g_gc_fake_mmap;
 }
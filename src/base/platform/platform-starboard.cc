@@ -489,6 +489,17 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // Starboard API does not support this function.
+}
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int numa_node) {
+  // Starboard API does not support this function.
+  return false;
+}
+
 // static
 Stack::StackSlot Stack::GetCurrentStackPosition() {
   void* addresses[kStackSize];
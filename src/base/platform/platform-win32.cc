@@ -1043,6 +1043,19 @@ bool OS::RecommitPages(void* address, size_t size, MemoryPermission access) {
   return SetPermissions(address, size, access);
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // There is no advisory large-page API for already-committed memory on
+  // Windows.
+}
+
+// static
+bool OS::BindMemoryToNumaNode(void* address, size_t size, int numa_node) {
+  // Windows only supports NUMA placement at allocation time
+  // (VirtualAllocExNuma), not for existing reservations.
+  return false;
+}
+
 // static
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // On Windows, discarded pages are not returned to the system immediately and
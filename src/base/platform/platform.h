@@ -350,6 +350,19 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Advises the kernel to back the huge-page-aligned portion of the given
+  // region with transparent huge pages, reducing i-TLB/d-TLB pressure for hot
+  // regions. Best effort and advisory only; a no-op on platforms without
+  // such an API.
+  static void AdviseHugePages(void* address, size_t size);
+
+  // Requests that pages in the given region be placed on the given NUMA node
+  // when they are faulted in. The preference is best effort: under memory
+  // pressure the kernel may still place pages elsewhere, and pages that are
+  // already resident are not migrated. Returns false on platforms without a
+  // NUMA memory policy API or if the request was rejected.
+  static bool BindMemoryToNumaNode(void* address, size_t size, int numa_node);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -64,25 +64,58 @@ RegionAllocator::AllRegionsSet::iterator RegionAllocator::FindRegion(
   return iter;
 }
 
+int RegionAllocator::SizeBucket(size_t size) const {
+  DCHECK_GE(size, page_size_);
+  return 63 - static_cast<int>(bits::CountLeadingZeros64(size / page_size_));
+}
+
 void RegionAllocator::FreeListAddRegion(Region* region) {
   free_size_ += region->size();
-  free_regions_.insert(region);
+  int bucket = SizeBucket(region->size());
+  free_region_buckets_[bucket].insert(region);
+  free_bucket_bitmap_ |= uint64_t{1} << bucket;
+  ++free_region_count_;
 }
 
 RegionAllocator::Region* RegionAllocator::FreeListFindRegion(size_t size) {
+  // The requested size falls into |bucket|, but that bucket also holds
+  // regions smaller than the request; look for the best fit among the
+  // sufficiently large ones.
+  int bucket = SizeBucket(size);
   Region key(0, size, RegionState::kFree);
-  auto iter = free_regions_.lower_bound(&key);
-  return iter == free_regions_.end() ? nullptr : *iter;
+  auto iter = free_region_buckets_[bucket].lower_bound(&key);
+  if (iter != free_region_buckets_[bucket].end()) return *iter;
+  // Any region in a higher bucket is large enough, so the smallest region of
+  // the next non-empty bucket is the overall best fit.
+  uint64_t higher_buckets =
+      free_bucket_bitmap_ & ~((uint64_t{2} << bucket) - 1);
+  if (higher_buckets == 0) return nullptr;
+  int next_bucket = static_cast<int>(bits::CountTrailingZeros64(higher_buckets));
+  DCHECK(!free_region_buckets_[next_bucket].empty());
+  return *free_region_buckets_[next_bucket].begin();
 }
 
 void RegionAllocator::FreeListRemoveRegion(Region* region) {
   DCHECK(region->is_free());
-  auto iter = free_regions_.find(region);
-  DCHECK_NE(iter, free_regions_.end());
+  FreeRegionsSet& bucket_set = free_region_buckets_[SizeBucket(region->size())];
+  auto iter = bucket_set.find(region);
+  DCHECK_NE(iter, bucket_set.end());
   DCHECK_EQ(region, *iter);
   DCHECK_LE(region->size(), free_size_);
   free_size_ -= region->size();
-  free_regions_.erase(iter);
+  bucket_set.erase(iter);
+  if (bucket_set.empty()) {
+    free_bucket_bitmap_ &= ~(uint64_t{1} << SizeBucket(region->size()));
+  }
+  --free_region_count_;
+}
+
+size_t RegionAllocator::largest_free_region_size() const {
+  if (free_bucket_bitmap_ == 0) return 0;
+  int bucket =
+      63 - static_cast<int>(bits::CountLeadingZeros64(free_bucket_bitmap_));
+  DCHECK(!free_region_buckets_[bucket].empty());
+  return (*free_region_buckets_[bucket].rbegin())->size();
 }
 
 RegionAllocator::Region* RegionAllocator::Split(Region* region,
@@ -126,7 +159,7 @@ void RegionAllocator::Merge(AllRegionsSet::iterator prev_iter,
   all_regions_.erase(next_iter);  // prev_iter stays valid.
 
   // The |next| region must already not be in the free list.
-  DCHECK_EQ(free_regions_.find(next), free_regions_.end());
+  DCHECK_EQ(free_region_buckets_[SizeBucket(next->size())].count(next), 0u);
   delete next;
 }
 
@@ -274,7 +307,7 @@ size_t RegionAllocator::TrimRegion(Address address, size_t new_size) {
   }
 
   // The region must not be in the free list.
-  DCHECK_EQ(free_regions_.find(*region_iter), free_regions_.end());
+  DCHECK_EQ(free_region_buckets_[SizeBucket(region->size())].count(region), 0u);
 
   if (new_size > 0) {
     region = Split(region, new_size);
@@ -371,9 +404,11 @@ void RegionAllocator::Print(std::ostream& os) const {
   }
 
   os << "\nfree regions: ";
-  for (const Region* region : free_regions_) {
-    os << "\n  ";
-    region->Print(os);
+  for (const FreeRegionsSet& bucket_set : free_region_buckets_) {
+    for (const Region* region : bucket_set) {
+      os << "\n  ";
+      region->Print(os);
+    }
   }
   os << "\n";
   os.flags(flags);
@@ -5,6 +5,7 @@
 #ifndef V8_BASE_REGION_ALLOCATOR_H_
 #define V8_BASE_REGION_ALLOCATOR_H_
 
+#include <cstdint>
 #include <set>
 
 #include "src/base/address-region.h"
@@ -127,6 +128,13 @@ class V8_BASE_EXPORT RegionAllocator final {
   // Total size of not yet aquired regions.
   size_t free_size() const { return free_size_; }
 
+  // Number of free regions. Together with |largest_free_region_size()| this
+  // is a measure of how fragmented the managed region has become.
+  size_t free_region_count() const { return free_region_count_; }
+
+  // Size of the largest free region, or 0 if everything is allocated.
+  size_t largest_free_region_size() const;
+
   // The alignment of the allocated region's addresses and granularity of
   // the allocated region's sizes.
   size_t page_size() const { return page_size_; }
@@ -183,8 +191,19 @@ class V8_BASE_EXPORT RegionAllocator final {
       return a->begin() < b->begin();
     }
   };
-  // Free regions ordered by sizes and addresses.
-  std::set<Region*, SizeAddressOrder> free_regions_;
+  using FreeRegionsSet = std::set<Region*, SizeAddressOrder>;
+  // Free regions, binned by the power of two of their size in pages and
+  // ordered by sizes and addresses within each bucket. A best-fit search only
+  // has to consult the bucket matching the requested size and, if that bucket
+  // has no fitting region, the next non-empty bucket (found via
+  // |free_bucket_bitmap_|), independently of how many free regions of other
+  // sizes fragmentation has produced.
+  static constexpr int kNumSizeBuckets = 64;
+  FreeRegionsSet free_region_buckets_[kNumSizeBuckets];
+  // Bit i is set iff free_region_buckets_[i] is non-empty.
+  uint64_t free_bucket_bitmap_ = 0;
+  // Number of regions currently in the free lists.
+  size_t free_region_count_ = 0;
 
   // Callbacks called when regions are split or merged.
   SplitMergeCallback on_split_;
@@ -193,6 +212,9 @@ class V8_BASE_EXPORT RegionAllocator final {
   // Returns region containing given address or nullptr.
   AllRegionsSet::iterator FindRegion(Address address);
 
+  // Returns the free list bucket for a region of given size.
+  int SizeBucket(size_t size) const;
+
   // Adds given region to the set of free regions.
   void FreeListAddRegion(Region* region);
 
@@ -23,6 +23,15 @@ class TimezoneCache {
   // https://github.com/tc39/ecma262/pull/778
   virtual double LocalTimeOffset(double time_ms, bool is_utc) = 0;
 
+  // Computes the maximal interval [start_ms, end_ms) of UTC times around
+  // time_ms over which the local time offset is constant, along with that
+  // offset. Implementations without exact transition data return false, in
+  // which case callers fall back to per-point LocalTimeOffset queries.
+  virtual bool LocalTimeOffsetSegment(double time_ms, double* start_ms,
+                                      double* end_ms, int* offset_ms) {
+    return false;
+  }
+
   /**
    * Time zone redetection indicator for Clear function.
    *
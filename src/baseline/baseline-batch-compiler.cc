@@ -16,6 +16,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
+#include "src/objects/script-inl.h"
 #include "src/utils/locked-queue-inl.h"
 
 namespace v8 {
@@ -322,6 +323,28 @@ void BaselineBatchCompiler::CompileBatch(Handle<JSFunction> function) {
   ClearBatch();
 }
 
+void BaselineBatchCompiler::CompileScriptConcurrent(Handle<Script> script) {
+  DCHECK(v8_flags.concurrent_sparkplug_for_scripts);
+  if (!is_enabled() || !concurrent()) return;
+  SharedFunctionInfo::ScriptIterator iterator(isolate_, *script);
+  for (Tagged<SharedFunctionInfo> shared = iterator.Next(); !shared.is_null();
+       shared = iterator.Next()) {
+    if (!CanCompileWithConcurrentBaseline(shared, isolate_)) continue;
+    if (shared->is_sparkplug_compiling()) continue;
+    HandleScope scope(isolate_);
+    Enqueue(handle(shared, isolate_));
+  }
+  if (last_index_ == 0) return;
+  if (v8_flags.trace_baseline_batch_compilation) {
+    CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+    PrintF(trace_scope.file(),
+           "[Baseline batch compilation] Compiling %d functions of script %d\n",
+           last_index_, script->id());
+  }
+  concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+  ClearBatch();
+}
+
 void BaselineBatchCompiler::CompileBatchConcurrent(
     Tagged<SharedFunctionInfo> shared) {
   Enqueue(Handle<SharedFunctionInfo>(shared, isolate_));
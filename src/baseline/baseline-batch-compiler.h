@@ -12,6 +12,9 @@
 
 namespace v8 {
 namespace internal {
+
+class Script;
+
 namespace baseline {
 
 class BaselineCompiler;
@@ -27,6 +30,12 @@ class BaselineBatchCompiler {
   void EnqueueFunction(Handle<JSFunction> function);
   void EnqueueSFI(Tagged<SharedFunctionInfo> shared);
 
+  // Enqueues all compiled functions of |script| and kicks off a concurrent
+  // batch immediately, regardless of the batch size threshold. Functions
+  // whose bytecode has not been generated yet (e.g. lazily parsed inner
+  // functions) are skipped.
+  void CompileScriptConcurrent(Handle<Script> script);
+
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
 
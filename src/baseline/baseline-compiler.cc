@@ -1002,6 +1002,14 @@ void BaselineCompiler::VisitAdd() {
       RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
 }
 
+void BaselineCompiler::VisitLdarAdd() {
+  // Fused Ldar+Add superinstruction; the first two operands match Add's
+  // layout.
+  LoadRegister(kInterpreterAccumulatorRegister, 2);
+  CallBuiltin<Builtin::kAdd_Baseline>(
+      RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
+}
+
 void BaselineCompiler::VisitSub() {
   CallBuiltin<Builtin::kSubtract_Baseline>(
       RegisterOperand(0), kInterpreterAccumulatorRegister, Index(1));
@@ -7,6 +7,12 @@
 // Christoph Lüders: Fast Multiplication of Large Integers,
 // http://arxiv.org/abs/1503.04955
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/digit-arithmetic.h"
 #include "src/bigint/util.h"
@@ -424,6 +430,39 @@ int GetParameters(int N, Parameters* params) {
 ////////////////////////////////////////////////////////////////////////////////
 // Part 3: Fast Fourier Transformation.
 
+// The embedder's {Platform} may only be queried from the thread that owns
+// the {Processor}, so worker threads poll this relay instead: the main
+// thread observes the real platform and sets the flag when an interrupt
+// is requested.
+class WorkerPlatform : public Platform {
+ public:
+  explicit WorkerPlatform(std::atomic<bool>* terminate)
+      : terminate_(terminate) {}
+  bool InterruptRequested() override {
+    return terminate_->load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool>* terminate_;
+};
+
+// Decides how many threads to use for the pointwise multiplications of {n}
+// parts of {length} digits each. Starting and joining a thread costs tens
+// of microseconds, so stay single-threaded unless every thread gets at
+// least a few milliseconds worth of multiplication work.
+int PointwiseMultiplyThreads(int n, int length) {
+  unsigned hardware_threads = std::thread::hardware_concurrency();
+  if (hardware_threads <= 1) return 1;
+  constexpr uint64_t kMinDigitsPerThread = uint64_t{1} << 18;
+  uint64_t total_digits = static_cast<uint64_t>(n) * length;
+  uint64_t threads =
+      std::min<uint64_t>(hardware_threads, total_digits / kMinDigitsPerThread);
+  // Each chunk must hold at least one pair of parts, see
+  // {DoPointwiseMultiplication}.
+  threads = std::min<uint64_t>(threads, n / 2);
+  return threads < 1 ? 1 : static_cast<int>(threads);
+}
+
 class FFTContainer {
  public:
   // {n} is the number of chunks, whose length is {K}+1.
@@ -461,9 +500,10 @@ class FFTContainer {
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
 
-  void PointwiseMultiply(const FFTContainer& other);
+  void PointwiseMultiply(const FFTContainer& other, bool parallel);
+  void PointwiseMultiplyParallel(const FFTContainer& other, int num_threads);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -710,7 +750,9 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
   FFTContainer b(params.n, params.K, processor);
   b.Start_Default(Y, params.s, theta, omega);
 
-  a.PointwiseMultiply(b);
+  // Never parallelize here: this already runs on a worker thread when the
+  // outer layer's pointwise multiplications were distributed.
+  a.PointwiseMultiply(b, /* parallel */ false);
   if (processor->should_terminate()) return;
 
   FFTContainer& c = a;
@@ -720,9 +762,11 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 }
 
 // Actual implementation of pointwise multiplications.
+// Safe to run on a worker thread for pair-aligned {start}/{end} ranges, as
+// long as {temp} and {processor} are owned by the calling thread.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
-                                             int start, int end,
-                                             digit_t* temp) {
+                                             int start, int end, digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +777,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -747,10 +791,60 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
   }
 }
 
+// Distributes the pointwise multiplications over {num_threads} threads. The
+// calling thread processes the first chunk itself, using its regular
+// processor so that the embedder's interrupt requests keep being observed,
+// and relays them to the workers via the shared termination flag.
+void FFTContainer::PointwiseMultiplyParallel(const FFTContainer& other,
+                                             int num_threads) {
+  // Chunks must hold an even number of parts, because the first level of
+  // the backwards FFT combines pairs of parts.
+  const int chunk_size = (n_ / num_threads) & ~1;
+  DCHECK(chunk_size >= 2);
+  std::atomic<bool> terminate{false};
+  std::atomic<int> active_workers{num_threads - 1};
+  std::vector<std::unique_ptr<ProcessorImpl>> worker_processors;
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads - 1);
+  for (int t = 1; t < num_threads; t++) {
+    worker_processors.emplace_back(
+        new ProcessorImpl(new WorkerPlatform(&terminate)));
+    ProcessorImpl* processor = worker_processors.back().get();
+    const int start = t * chunk_size;
+    const int end = t == num_threads - 1 ? n_ : start + chunk_size;
+    threads.emplace_back(
+        [this, &other, &active_workers, processor, start, end]() {
+          std::unique_ptr<digit_t[]> temp(new digit_t[2 * length_]);
+          DoPointwiseMultiplication(other, start, end, temp.get(), processor);
+          active_workers.fetch_sub(1, std::memory_order_release);
+        });
+  }
+  DoPointwiseMultiplication(other, 0, chunk_size, temp_, processor_);
+  // While the workers finish, keep polling for interrupt requests so that
+  // interrupt latency does not regress compared to the serial version.
+  while (active_workers.load(std::memory_order_acquire) > 0) {
+    if (!terminate.load(std::memory_order_relaxed)) {
+      processor_->AddWorkEstimate(ProcessorImpl::kWorkEstimateThreshold);
+      if (processor_->should_terminate()) {
+        terminate.store(true, std::memory_order_relaxed);
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  for (std::thread& thread : threads) thread.join();
+}
+
 // Convenient entry point for pointwise multiplications.
-void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
+void FFTContainer::PointwiseMultiply(const FFTContainer& other,
+                                     bool parallel) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  if (parallel) {
+    int num_threads = PointwiseMultiplyThreads(n_, length_);
+    if (num_threads > 1) {
+      return PointwiseMultiplyParallel(other, num_threads);
+    }
+  }
+  DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
 }
 
 }  // namespace
@@ -773,11 +867,11 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
-    a.PointwiseMultiply(a);
+    a.PointwiseMultiply(a, /* parallel */ true);
   } else {
     FFTContainer b(params.n, params.K, this);
     b.Start(Y, params.s, 0, omega);
-    a.PointwiseMultiply(b);
+    a.PointwiseMultiply(b, /* parallel */ true);
   }
   if (should_terminate()) return;
 
@@ -17,6 +17,7 @@
 #include "src/objects/contexts.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-regexp-inl.h"
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/module-inl.h"
 #include "src/objects/property-details.h"
@@ -266,6 +267,27 @@ Handle<AccessorInfo> Accessors::MakeModuleNamespaceEntryInfo(
                       &ModuleNamespaceEntrySetter);
 }
 
+//
+// Accessors::RegExpResultGroupsGetter
+//
+
+void Accessors::RegExpResultGroupsGetter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
+  HandleScope scope(isolate);
+  Handle<JSObject> holder =
+      Handle<JSObject>::cast(Utils::OpenHandle(*info.Holder()));
+  Handle<Object> groups;
+  if (JSRegExpResult::GetGroups(isolate, holder).ToHandle(&groups)) {
+    info.GetReturnValue().Set(Utils::ToLocal(groups));
+  }
+}
+
+Handle<AccessorInfo> Accessors::MakeRegExpResultGroupsInfo(Isolate* isolate) {
+  return MakeAccessor(isolate, isolate->factory()->groups_string(),
+                      &RegExpResultGroupsGetter, nullptr);
+}
+
 //
 // Accessors::StringLength
 //
@@ -49,7 +49,9 @@ class JavaScriptFrame;
   V(_, wrapped_function_name, WrappedFunctionName, kHasNoSideEffect,          \
     kHasSideEffectToReceiver)
 
-#define ACCESSOR_GETTER_LIST(V) V(ModuleNamespaceEntryGetter)
+#define ACCESSOR_GETTER_LIST(V) \
+  V(ModuleNamespaceEntryGetter)  \
+  V(RegExpResultGroupsGetter)
 
 #define ACCESSOR_SETTER_LIST(V) \
   V(ArrayLengthSetter)          \
@@ -108,6 +110,10 @@ class Accessors : public AllStatic {
   static Handle<AccessorInfo> MakeModuleNamespaceEntryInfo(Isolate* isolate,
                                                            Handle<String> name);
 
+  // Used instead of a "groups" data property on regexp result objects when
+  // --lazy-regexp-result-groups is enabled.
+  static Handle<AccessorInfo> MakeRegExpResultGroupsInfo(Isolate* isolate);
+
   // Accessor function called directly from the runtime system. Returns the
   // newly materialized arguments object for the given {frame}. Note that for
   // optimized frames it is possible to specify an {inlined_jsframe_index}.
@@ -592,6 +592,49 @@ TF_BUILTIN(TypedArrayPrototypeMap, ArrayBuiltinsAssembler) {
   TNode<Object> callbackfn = args.GetOptionalArgumentValue(0);
   TNode<Object> this_arg = args.GetOptionalArgumentValue(1);
 
+  // Fast path for float64array.map(Math.sin) and friends: when the callback
+  // is one of the supported Math builtins it is pure, so the whole map can be
+  // computed by a single batched runtime call instead of one JS dispatch per
+  // element. Only plain (non-RAB/GSAB) Float64Arrays with the default species
+  // qualify; anything else falls through to the generic implementation.
+  Label generic(this), batch(this);
+  GotoIf(TaggedIsSmi(receiver), &generic);
+  TNode<Map> receiver_map = LoadMap(CAST(receiver));
+  GotoIfNot(IsJSTypedArrayMap(receiver_map), &generic);
+  GotoIfNot(Word32Equal(LoadMapElementsKind(receiver_map),
+                        Int32Constant(FLOAT64_ELEMENTS)),
+            &generic);
+  TNode<JSTypedArray> typed_array = CAST(receiver);
+  GotoIf(IsDetachedBuffer(LoadJSArrayBufferViewBuffer(typed_array)), &generic);
+  GotoIf(TaggedIsSmi(callbackfn), &generic);
+  GotoIfNot(IsJSFunction(CAST(callbackfn)), &generic);
+  TNode<SharedFunctionInfo> shared = LoadObjectField<SharedFunctionInfo>(
+      CAST(callbackfn), JSFunction::kSharedFunctionInfoOffset);
+  // Builtin functions store their builtin id as a Smi in the data field.
+  TNode<Object> function_data = LoadSharedFunctionInfoData(shared);
+  GotoIfNot(TaggedIsSmi(function_data), &generic);
+  TNode<Smi> builtin_id = CAST(function_data);
+  GotoIf(SmiEqual(builtin_id, SmiConstant(Builtins::ToInt(Builtin::kMathSin))),
+         &batch);
+  GotoIf(SmiEqual(builtin_id, SmiConstant(Builtins::ToInt(Builtin::kMathCos))),
+         &batch);
+  Branch(
+      SmiEqual(builtin_id, SmiConstant(Builtins::ToInt(Builtin::kMathExp))),
+      &batch, &generic);
+
+  BIND(&batch);
+  {
+    // Same conditions under which TypedArraySpeciesCreate skips the
+    // constructor lookup: default prototype (rules out subclasses and
+    // cross-realm receivers) and intact species protector.
+    GotoIfNot(IsPrototypeTypedArrayPrototype(context, receiver_map), &generic);
+    GotoIf(IsTypedArraySpeciesProtectorCellInvalid(), &generic);
+    TNode<Object> result = CallRuntime(Runtime::kTypedArrayMapMathUnary,
+                                       context, typed_array, builtin_id);
+    args.PopAndReturn(result);
+  }
+
+  BIND(&generic);
   InitIteratingArrayBuiltinBody(context, receiver, callbackfn, this_arg, argc);
 
   GenerateIteratingTypedArrayBuiltinBody(
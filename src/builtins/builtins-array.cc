@@ -1522,7 +1522,27 @@ MaybeHandle<JSArray> Fast_ArrayConcat(Isolate* isolate,
     // and calculating total length.
     for (int i = 0; i < n_arguments; i++) {
       Tagged<Object> arg = (*args)[i];
-      if (!IsJSArray(arg)) return MaybeHandle<JSArray>();
+      if (!IsJSArray(arg)) {
+        // Receivers with a proxy in their prototype chain need a
+        // @@isConcatSpreadable lookup even while the protector is intact;
+        // any other non-array argument is non-spreadable (checked above) and
+        // is appended as a single element.
+        if (IsJSReceiver(arg) &&
+            JSReceiver::cast(arg)->HasProxyInPrototype(isolate)) {
+          return MaybeHandle<JSArray>();
+        }
+        result_len += 1;
+        DCHECK_GE(result_len, 0);
+        // Throw an Error if we overflow the FixedArray limits
+        if (FixedDoubleArray::kMaxLength < result_len ||
+            FixedArray::kMaxLength < result_len) {
+          AllowGarbageCollection gc;
+          THROW_NEW_ERROR(isolate,
+                          NewRangeError(MessageTemplate::kInvalidArrayLength),
+                          JSArray);
+        }
+        continue;
+      }
       if (!HasOnlySimpleReceiverElements(isolate, JSObject::cast(arg))) {
         return MaybeHandle<JSArray>();
       }
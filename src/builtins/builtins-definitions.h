@@ -741,6 +741,10 @@ namespace internal {
   TFJ(MapIteratorPrototypeNext, kJSArgcReceiverSlots, kReceiver)               \
   TFS(MapIteratorToList, NeedsContext::kYes, kSource)                          \
                                                                                \
+  /* Math */                                                                   \
+  /* (nonstandard) Math.randomFill, behind --expose-math-random-fill */        \
+  CPP(MathRandomFill)                                                          \
+                                                                               \
   /* ES #sec-number-constructor */                                             \
   CPP(NumberPrototypeToExponential)                                            \
   CPP(NumberPrototypeToFixed)                                                  \
@@ -1050,6 +1054,12 @@ namespace internal {
   CPP(SharedStructConstructor)                                                 \
   CPP(SharedArrayConstructor)                                                  \
   CPP(SharedArrayIsSharedArray)                                                \
+  CPP(SharedMapConstructor)                                                    \
+  CPP(SharedMapIsSharedMap)                                                    \
+  CPP(SharedMapGet)                                                            \
+  CPP(SharedMapSet)                                                            \
+  CPP(SharedMapHas)                                                            \
+  CPP(SharedMapDelete)                                                         \
   CPP(AtomicsMutexConstructor)                                                 \
   CPP(AtomicsMutexIsMutex)                                                     \
   CPP(AtomicsMutexLock)                                                        \
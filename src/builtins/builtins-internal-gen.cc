@@ -824,6 +824,8 @@ class DeletePropertyBaseAssembler : public AccessorAssembler {
                                          SKIP_WRITE_BARRIER);
     StoreDetailsByKeyIndex<NameDictionary>(properties, key_index,
                                            SmiConstant(0));
+    StoreFixedArrayElement(properties, NameDictionary::kEnumCacheIndex,
+                           UndefinedConstant(), SKIP_WRITE_BARRIER);
 
     // Update bookkeeping information (see NameDictionary::ElementRemoved).
     TNode<Smi> nof = GetNumberOfElements<NameDictionary>(properties);
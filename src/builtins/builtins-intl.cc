@@ -1176,10 +1176,8 @@ BUILTIN(CollatorInternalCompare) {
                                      Object::ToString(isolate, y));
 
   // 7. Return CompareStrings(collator, X, Y).
-  icu::Collator* icu_collator = collator->icu_collator()->raw();
-  CHECK_NOT_NULL(icu_collator);
   return Smi::FromInt(
-      Intl::CompareStrings(isolate, *icu_collator, string_x, string_y));
+      JSCollator::CompareWithSortKeys(isolate, collator, string_x, string_y));
 }
 
 // ecma402 #sec-%segmentiteratorprototype%.next
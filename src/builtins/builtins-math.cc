@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/builtins/builtins-utils-inl.h"
+#include "src/builtins/builtins.h"
+#include "src/numbers/math-random.h"
+#include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// -----------------------------------------------------------------------------
+// ES6 section 20.2 The Math Object
+
+// Nonstandard, installed behind --expose-math-random-fill. Fills the given
+// Float64Array with random numbers from the same per-context xorshift128+
+// stream that backs Math.random, amortizing the builtin call boundary over
+// the whole buffer. Returns the array.
+BUILTIN(MathRandomFill) {
+  HandleScope scope(isolate);
+  const char* method_name = "Math.randomFill";
+
+  Handle<Object> target = args.atOrUndefined(isolate, 1);
+  if (!IsJSTypedArray(*target)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotTypedArray));
+  }
+  Handle<JSTypedArray> array = Handle<JSTypedArray>::cast(target);
+  if (array->type() != kExternalFloat64Array) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotFloat64TypedArray, target));
+  }
+  bool out_of_bounds = false;
+  size_t length = array->GetLengthOrOutOfBounds(out_of_bounds);
+  if (V8_UNLIKELY(array->WasDetached() || out_of_bounds)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kDetachedOperation,
+                              isolate->factory()->NewStringFromAsciiChecked(
+                                  method_name)));
+  }
+
+  if (length > 0) {
+    DisallowGarbageCollection no_gc;
+    MathRandom::FillBuffer(isolate, *isolate->native_context(),
+                           static_cast<double*>(array->DataPtr()), length);
+  }
+  return *array;
+}
+
+}  // namespace internal
+}  // namespace v8
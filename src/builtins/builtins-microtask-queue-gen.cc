@@ -30,6 +30,10 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
   TNode<IntPtrT> GetMicrotaskQueueStart(TNode<RawPtrT> microtask_queue);
   void SetMicrotaskQueueStart(TNode<RawPtrT> microtask_queue,
                               TNode<IntPtrT> new_start);
+  TNode<IntPtrT> GetMicrotaskQueueRemainingBudget(
+      TNode<RawPtrT> microtask_queue);
+  void SetMicrotaskQueueRemainingBudget(TNode<RawPtrT> microtask_queue,
+                                        TNode<IntPtrT> new_budget);
   TNode<IntPtrT> CalculateRingBufferOffset(TNode<IntPtrT> capacity,
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
@@ -97,6 +101,19 @@ void MicrotaskQueueBuiltinsAssembler::SetMicrotaskQueueStart(
                       IntPtrConstant(MicrotaskQueue::kStartOffset), new_start);
 }
 
+TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::GetMicrotaskQueueRemainingBudget(
+    TNode<RawPtrT> microtask_queue) {
+  return Load<IntPtrT>(
+      microtask_queue, IntPtrConstant(MicrotaskQueue::kRemainingBudgetOffset));
+}
+
+void MicrotaskQueueBuiltinsAssembler::SetMicrotaskQueueRemainingBudget(
+    TNode<RawPtrT> microtask_queue, TNode<IntPtrT> new_budget) {
+  StoreNoWriteBarrier(MachineType::PointerRepresentation(), microtask_queue,
+                      IntPtrConstant(MicrotaskQueue::kRemainingBudgetOffset),
+                      new_budget);
+}
+
 TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
     TNode<IntPtrT> capacity, TNode<IntPtrT> start, TNode<IntPtrT> index) {
   return TimesSystemPointerSize(
@@ -619,6 +636,15 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Exit if the queue is empty.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
 
+  // Exit if the count budget for this round is exhausted. The budget is
+  // MicrotaskQueue::kUnlimitedBudget unless the embedder requested a budgeted
+  // checkpoint, so the unconditional decrement below can never exhaust it in
+  // the unlimited case.
+  TNode<IntPtrT> budget = GetMicrotaskQueueRemainingBudget(microtask_queue);
+  GotoIf(WordEqual(budget, IntPtrConstant(0)), &done);
+  SetMicrotaskQueueRemainingBudget(microtask_queue,
+                                   IntPtrSub(budget, IntPtrConstant(1)));
+
   TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
   TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
   TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
@@ -275,6 +275,22 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     // Stash names in case we need them to build the indices array later.
     StoreObjectField(result, JSRegExpResult::kNamesOffset, names);
 
+    // If groups objects are materialized lazily, the groups map descriptor is
+    // an accessor and the in-object slot merely caches its input resp. result;
+    // stash the capture name map there and skip the allocation (see
+    // Accessors::RegExpResultGroupsGetter).
+    Label materialize_groups(this);
+    TNode<Word32T> lazy_groups_flag = UncheckedCast<Word32T>(Load(
+        MachineType::Uint8(),
+        ExternalConstant(
+            ExternalReference::address_of_lazy_regexp_result_groups())));
+    GotoIf(Word32Equal(Word32And(lazy_groups_flag, Int32Constant(0xFF)),
+                       Int32Constant(0)),
+           &materialize_groups);
+    StoreObjectField(result, JSRegExpResult::kGroupsOffset, names);
+    Goto(&maybe_build_indices);
+
+    BIND(&materialize_groups);
     // Allocate a new object to store the named capture properties.
     // TODO(jgruber): Could be optimized by adding the object map to the heap
     // root list.
@@ -0,0 +1,75 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/builtins/builtins-utils-inl.h"
+#include "src/objects/js-shared-map-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// The SharedMap methods are installed as static functions on the constructor,
+// like the Atomics.Mutex methods, since shared objects have no prototype.
+// Each takes the map as its first argument and the key as its second.
+#define CHECK_SHARED_MAP_ARGUMENTS(method_name)                        \
+  Handle<Object> shared_map_obj = args.atOrUndefined(isolate, 1);      \
+  if (!IsJSSharedMap(*shared_map_obj)) {                               \
+    THROW_NEW_ERROR_RETURN_FAILURE(                                    \
+        isolate,                                                       \
+        NewTypeError(MessageTemplate::kMethodInvokedOnWrongType,       \
+                     isolate->factory()->NewStringFromAsciiChecked(    \
+                         method_name)));                               \
+  }                                                                    \
+  Handle<JSSharedMap> shared_map =                                     \
+      Handle<JSSharedMap>::cast(shared_map_obj);                       \
+  Handle<Object> key_obj = args.atOrUndefined(isolate, 2);             \
+  if (!IsString(*key_obj)) {                                           \
+    THROW_NEW_ERROR_RETURN_FAILURE(                                    \
+        isolate, NewTypeError(MessageTemplate::kInvalidArgument));     \
+  }                                                                    \
+  Handle<String> key = Handle<String>::cast(key_obj)
+
+BUILTIN(SharedMapConstructor) {
+  DCHECK(v8_flags.shared_string_table);
+  HandleScope scope(isolate);
+  return *isolate->factory()->NewJSSharedMap(args.target());
+}
+
+BUILTIN(SharedMapIsSharedMap) {
+  HandleScope scope(isolate);
+  return isolate->heap()->ToBoolean(
+      IsJSSharedMap(*args.atOrUndefined(isolate, 1)));
+}
+
+BUILTIN(SharedMapGet) {
+  HandleScope scope(isolate);
+  CHECK_SHARED_MAP_ARGUMENTS("SharedMap.get");
+  return *JSSharedMap::Get(isolate, shared_map, key);
+}
+
+BUILTIN(SharedMapSet) {
+  HandleScope scope(isolate);
+  CHECK_SHARED_MAP_ARGUMENTS("SharedMap.set");
+  Handle<Object> value = args.atOrUndefined(isolate, 3);
+  MAYBE_RETURN(JSSharedMap::Set(isolate, shared_map, key, value),
+               ReadOnlyRoots(isolate).exception());
+  return *shared_map;
+}
+
+BUILTIN(SharedMapHas) {
+  HandleScope scope(isolate);
+  CHECK_SHARED_MAP_ARGUMENTS("SharedMap.has");
+  return isolate->heap()->ToBoolean(JSSharedMap::Has(isolate, shared_map, key));
+}
+
+BUILTIN(SharedMapDelete) {
+  HandleScope scope(isolate);
+  CHECK_SHARED_MAP_ARGUMENTS("SharedMap.delete");
+  return isolate->heap()->ToBoolean(
+      JSSharedMap::Delete(isolate, shared_map, key));
+}
+
+#undef CHECK_SHARED_MAP_ARGUMENTS
+
+}  // namespace internal
+}  // namespace v8
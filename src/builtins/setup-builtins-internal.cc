@@ -370,6 +370,14 @@ void SetupIsolateDelegate::SetupBuiltinsInternal(Isolate* isolate) {
   AddBuiltin(builtins, Builtin::k##Name, code);                     \
   index++;
 
+  // Note on parallelism: builtin generation is deliberately serial. The CSA
+  // and bytecode-handler builders embed Handles to heap constants in their
+  // graphs while Code finalization allocates (and may thus move objects), so
+  // worker threads would need LocalHeap-aware handle access through the whole
+  // stub pipeline; the interface descriptor and counters tables are likewise
+  // initialized for main-thread use only. Parallelizing this loop requires
+  // first making Pipeline::GenerateCodeForCodeStub run against a LocalIsolate
+  // with main-thread finalization, as the JS pipeline does.
   BUILTIN_LIST(BUILD_CPP, BUILD_TFJ, BUILD_TFC, BUILD_TFS, BUILD_TFH, BUILD_BCH,
                BUILD_ASM);
 
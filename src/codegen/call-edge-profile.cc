@@ -0,0 +1,106 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/call-edge-profile.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/utils/ostreams.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+const CallEdgeProfile* CallEdgeProfile::ReadFromFile(const char* filename) {
+  // Leaked intentionally; the profile is immutable and lives for the rest of
+  // the process, like the builtins profile data.
+  CallEdgeProfile* profile = new CallEdgeProfile();
+  std::ifstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't read call-edge profile");
+  for (std::string line; std::getline(file, line);) {
+    std::string token;
+    std::istringstream line_stream(line);
+    if (!std::getline(line_stream, token, ',')) continue;
+    if (token != kCallEdgeMarker) continue;
+    char* end = nullptr;
+    errno = 0;
+    CHECK(std::getline(line_stream, token, ','));
+    int caller_position = static_cast<int>(strtol(token.c_str(), &end, 10));
+    CHECK(errno == 0 && end != token.c_str());
+    CHECK(std::getline(line_stream, token, ','));
+    int callee_position = static_cast<int>(strtol(token.c_str(), &end, 10));
+    CHECK(errno == 0 && end != token.c_str());
+    std::getline(line_stream, token, ',');
+    CHECK(line_stream.eof());
+    float frequency = static_cast<float>(strtod(token.c_str(), &end));
+    CHECK(errno == 0 && end != token.c_str());
+    // We allow concatenating profiles from several runs or isolates; keep the
+    // hottest observation for each edge.
+    float& recorded = profile->frequencies_by_edge_[MakeKey(caller_position,
+                                                            callee_position)];
+    if (frequency > recorded) recorded = frequency;
+  }
+  return profile;
+}
+
+float CallEdgeProfile::GetCallFrequency(int caller_position,
+                                        int callee_position) const {
+  auto it =
+      frequencies_by_edge_.find(MakeKey(caller_position, callee_position));
+  return it == frequencies_by_edge_.end() ? 0.0f : it->second;
+}
+
+// static
+const CallEdgeProfile* CallEdgeProfile::TryRead() {
+  const char* filename = v8_flags.turbo_inline_profile_input;
+  if (filename == nullptr) return nullptr;
+  static const CallEdgeProfile* profile = ReadFromFile(filename);
+  return profile;
+}
+
+// static
+void CallEdgeProfile::Dump(Isolate* isolate, const char* filename) {
+  FILE* f = std::fopen(filename, "w");
+  if (f == nullptr) {
+    FATAL("Unable to open file \"%s\" for writing.\n", filename);
+  }
+  OFStream stream(f);
+  HeapObjectIterator iterator(isolate->heap());
+  DisallowGarbageCollection no_gc;
+  for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!IsFeedbackVector(obj)) continue;
+    Tagged<FeedbackVector> vector = FeedbackVector::cast(obj);
+    int caller_position = vector->shared_function_info()->StartPosition();
+    FeedbackMetadataIterator iter(vector->metadata());
+    while (iter.HasNext()) {
+      FeedbackSlot slot = iter.Next();
+      if (!IsCallICKind(iter.kind())) continue;
+      FeedbackNexus nexus(vector, slot);
+      MaybeObject maybe_target = nexus.GetFeedback();
+      Tagged<HeapObject> target;
+      if (!maybe_target.GetHeapObject(&target) || !IsJSFunction(target)) {
+        continue;
+      }
+      // Only record edges the inlining heuristic would actually act on.
+      float frequency = nexus.ComputeCallFrequency();
+      if (frequency < v8_flags.min_inlining_frequency) continue;
+      int callee_position =
+          JSFunction::cast(target)->shared()->StartPosition();
+      stream << kCallEdgeMarker << ',' << caller_position << ','
+             << callee_position << ',' << frequency << '\n';
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
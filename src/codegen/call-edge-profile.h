@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_CALL_EDGE_PROFILE_H_
+#define V8_CODEGEN_CALL_EDGE_PROFILE_H_
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// A persisted call-edge profile for profile-guided inlining.
+//
+// With --turbo-inline-profile-output, the call edges observed in feedback
+// vectors that are hot enough to be inlined are written to a file when the
+// isolate is torn down. A later process started with
+// --turbo-inline-profile-input reads that file, and JSInliningHeuristic uses
+// the recorded call frequencies as a lower bound for call sites whose own
+// feedback is still sparse, so that steady-state inlining decisions are
+// reached on the first optimization instead of after warmup.
+//
+// Call edges are keyed by the source start positions of the caller and the
+// callee, which are stable across process restarts as long as the script
+// sources are unchanged. Positions from different scripts may collide; since
+// the profile only biases a heuristic, such collisions are harmless.
+class V8_EXPORT_PRIVATE CallEdgeProfile {
+ public:
+  // Any line in a profile beginning with this string records one call edge.
+  // The format is:
+  //   literal kCallEdgeMarker , caller_position , callee_position , frequency
+  static constexpr char kCallEdgeMarker[] = "call_edge";
+
+  // Returns the profiled call frequency for the given edge, or 0 if the edge
+  // is not in the profile. Frequencies use the same unit as CallFrequency,
+  // i.e. call count relative to the caller's invocation count.
+  float GetCallFrequency(int caller_position, int callee_position) const;
+
+  // Loads the profile named by --turbo-inline-profile-input, if any. The file
+  // is read once per process; returns nullptr when no profile is configured.
+  static const CallEdgeProfile* TryRead();
+
+  // Writes all call edges in {isolate}'s feedback vectors whose frequency is
+  // at least --min-inlining-frequency to {filename}.
+  static void Dump(Isolate* isolate, const char* filename);
+
+ private:
+  static const CallEdgeProfile* ReadFromFile(const char* filename);
+
+  static uint64_t MakeKey(int caller_position, int callee_position) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(caller_position))
+            << 32) |
+           static_cast<uint32_t>(callee_position);
+  }
+
+  std::unordered_map<uint64_t, float> frequencies_by_edge_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_CALL_EDGE_PROFILE_H_
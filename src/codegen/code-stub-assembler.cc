@@ -35,6 +35,7 @@
 #include "src/objects/ordered-hash-table-inl.h"
 #include "src/objects/property-cell.h"
 #include "src/objects/property-descriptor-object.h"
+#include "src/objects/string-table.h"
 #include "src/objects/tagged-field.h"
 #include "src/roots/roots.h"
 
@@ -4222,6 +4223,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
     StoreFixedArrayElement(result, NameDictionary::kFlagsIndex,
                            SmiConstant(NameDictionary::kFlagsDefault),
                            SKIP_WRITE_BARRIER);
+    StoreFixedArrayElement(result, NameDictionary::kEnumCacheIndex,
+                           UndefinedConstant(), SKIP_WRITE_BARRIER);
   }
 
   // Initialize NameDictionary elements.
@@ -4837,6 +4840,32 @@ TNode<JSArray> CodeStubAssembler::CloneFastJSArray(
            &holey_extract);
   }
 
+  if (!allocation_site && !need_conversion) {
+    // For large packed Smi/object arrays, share the backing store with the
+    // source instead of copying it: the source's elements are made
+    // copy-on-write in place, and the first write to either array performs
+    // the deferred copy (see {JSObject::EnsureWritableFastElements}). Only
+    // worthwhile when the eager copy would not fit into new space; for
+    // smaller arrays the copy is cheap and keeps the source cheaply writable.
+    Label no_cow_share(this);
+    GotoIfNot(Word32Or(Word32Equal(var_elements_kind.value(),
+                                   Int32Constant(PACKED_SMI_ELEMENTS)),
+                       Word32Equal(var_elements_kind.value(),
+                                   Int32Constant(PACKED_ELEMENTS))),
+              &no_cow_share);
+    GotoIf(TaggedIsNotSmi(length), &no_cow_share);
+    GotoIfNot(SmiGreaterThan(CAST(length),
+                             SmiConstant(FixedArray::kMaxRegularLength)),
+              &no_cow_share);
+    TNode<FixedArrayBase> source_elements = LoadElements(array);
+    // Harmless if the backing store is already copy-on-write.
+    StoreMapNoWriteBarrier(source_elements, RootIndex::kFixedCOWArrayMap);
+    var_new_elements = source_elements;
+    Goto(&allocate_jsarray);
+
+    BIND(&no_cow_share);
+  }
+
   // Simple extraction that preserves holes.
   new_elements = ExtractFixedArray(
       LoadElements(array),
@@ -9091,10 +9120,110 @@ TNode<RawPtr<Uint8T>> CodeStubAssembler::IntlAsciiCollationWeightsL3() {
 #endif
 }
 
+void CodeStubAssembler::TryProbeStringTable(TNode<String> string,
+                                            TNode<Uint32T> hash,
+                                            Label* if_found,
+                                            TVariable<Name>* var_internalized,
+                                            Label* if_not_found,
+                                            Label* if_bailout) {
+  Comment("TryProbeStringTable");
+  // Load the current table data. Loads of the table contents below are
+  // ordered after this load by the address dependency; a racing resize at
+  // worst causes a false miss, and old table data stays alive until the next
+  // safepoint, so this probe is safe without taking the table's lock.
+  TNode<RawPtrT> data = Load<RawPtrT>(ExternalConstant(
+      ExternalReference::string_table_data_address(isolate())));
+  TNode<IntPtrT> capacity = ChangeInt32ToIntPtr(
+      Load<Int32T>(data, IntPtrConstant(StringTable::CapacityOffset())));
+  TNode<IntPtrT> mask = IntPtrSub(capacity, IntPtrConstant(1));
+  TNode<IntPtrT> length = LoadStringLengthAsWord(string);
+
+  // Open-addressed lookup with quadratic probing, matching
+  // OffHeapHashTableBase::FindEntry. Termination is guaranteed because the
+  // table always keeps at least one empty entry.
+  TVARIABLE(IntPtrT, var_entry,
+            Signed(WordAnd(ChangeUint32ToWord(hash), mask)));
+  TVARIABLE(IntPtrT, var_count, IntPtrConstant(0));
+  Label loop(this, {&var_entry, &var_count}), next_probe(this);
+  Goto(&loop);
+
+  BIND(&loop);
+  {
+    TNode<IntPtrT> offset =
+        IntPtrAdd(IntPtrConstant(StringTable::ElementsOffset()),
+                  Signed(WordShl(var_entry.value(), kTaggedSizeLog2)));
+    TNode<Object> candidate;
+#ifdef V8_COMPRESS_POINTERS
+    // The table stores compressed values; decompress against the cage base.
+    TNode<RawPtrT> cage_base = LoadPointerFromRootRegister(
+        IntPtrConstant(IsolateData::cage_base_offset()));
+    TNode<UintPtrT> ptr = UncheckedCast<UintPtrT>(
+        WordOr(cage_base, ChangeUint32ToWord(Load<Uint32T>(data, offset))));
+    candidate = UncheckedCast<Object>(BitcastWordToTagged(ptr));
+#else
+    candidate = Load<Object>(data, offset);
+#endif  // V8_COMPRESS_POINTERS
+
+    Label if_string(this);
+    GotoIfNot(TaggedIsSmi(candidate), &if_string);
+    // Empty sentinel (Smi 0): the string is not in the table. Deleted
+    // sentinel (Smi 1): keep probing.
+    GotoIf(TaggedEqual(candidate, SmiConstant(0)), if_not_found);
+    CSA_DCHECK(this, TaggedEqual(candidate, SmiConstant(1)));
+    Goto(&next_probe);
+
+    BIND(&if_string);
+    {
+      TNode<String> candidate_string = CAST(candidate);
+      TNode<Uint32T> candidate_hash_field =
+          LoadNameRawHashField(candidate_string);
+      // Table entries with a forwarding-index hash need the forwarding table,
+      // so leave them to the C++ slow path.
+      GotoIf(IsEqualInWord32<Name::HashFieldTypeBits>(
+                 candidate_hash_field, Name::HashFieldType::kForwardingIndex),
+             if_bailout);
+      GotoIfNot(Word32Equal(DecodeWord32<Name::HashBits>(candidate_hash_field),
+                            hash),
+                &next_probe);
+      GotoIfNot(IntPtrEqual(LoadStringLengthAsWord(candidate_string), length),
+                &next_probe);
+      // {string} is not internalized and {candidate_string} is, so they are
+      // never the same object, as StringEqual requires.
+      TNode<Boolean> equal =
+          CAST(CallBuiltin(Builtin::kStringEqual, NoContextConstant(), string,
+                           candidate_string, length));
+      GotoIfNot(TaggedEqual(equal, TrueConstant()), &next_probe);
+      *var_internalized = candidate_string;
+      Goto(if_found);
+    }
+
+    BIND(&next_probe);
+    // See OffHeapHashTableBase::NextProbe().
+    Increment(&var_count);
+    var_entry = Signed(
+        WordAnd(IntPtrAdd(var_entry.value(), var_count.value()), mask));
+    Goto(&loop);
+  }
+}
+
 void CodeStubAssembler::TryInternalizeString(
     TNode<String> string, Label* if_index, TVariable<IntPtrT>* var_index,
     Label* if_internalized, TVariable<Name>* var_internalized,
     Label* if_not_internalized, Label* if_bailout) {
+  // Probe the string table in generated code first if the string's hash is
+  // already computed and is a plain hash. This keeps the common megamorphic
+  // IC miss -- a key whose contents are already internalized -- out of C++
+  // entirely.
+  Label fallback(this, Label::kDeferred);
+  TNode<Uint32T> raw_hash_field = LoadNameRawHashField(string);
+  GotoIfNot(IsEqualInWord32<Name::HashFieldTypeBits>(
+                raw_hash_field, Name::HashFieldType::kHash),
+            &fallback);
+  TryProbeStringTable(string, DecodeWord32<Name::HashBits>(raw_hash_field),
+                      if_internalized, var_internalized, if_not_internalized,
+                      &fallback);
+
+  BIND(&fallback);
   TNode<ExternalReference> function = ExternalConstant(
       ExternalReference::try_string_to_index_or_lookup_existing());
   const TNode<ExternalReference> isolate_ptr =
@@ -9728,6 +9857,11 @@ void CodeStubAssembler::InsertEntry<NameDictionary>(
   // Finally, store the details.
   StoreDetailsByKeyIndex<NameDictionary>(dictionary, index,
                                          var_details.value());
+
+  // The new entry invalidates any cached enumeration order (see
+  // NameDictionary::clear_enum_cache).
+  StoreFixedArrayElement(dictionary, NameDictionary::kEnumCacheIndex,
+                         UndefinedConstant(), SKIP_WRITE_BARRIER);
 }
 
 template <>
@@ -3417,6 +3417,16 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
                             TVariable<Name>* var_internalized,
                             Label* if_not_internalized, Label* if_bailout);
 
+  // Read-only probe of the string table for an internalized string with the
+  // same contents as {string}, without calling into C++. {hash} must be
+  // {string}'s computed hash (Name::HashFieldType::kHash). Jumps to:
+  // - |if_found| with the internalized string in |var_internalized|.
+  // - |if_not_found| if there is no such string in the table.
+  // - |if_bailout| for entries that need the C++ slow path.
+  void TryProbeStringTable(TNode<String> string, TNode<Uint32T> hash,
+                           Label* if_found, TVariable<Name>* var_internalized,
+                           Label* if_not_found, Label* if_bailout);
+
   // Calculates array index for given dictionary entry and entry field.
   // See Dictionary::EntryToIndex().
   template <typename Dictionary>
@@ -4,6 +4,8 @@
 
 #include "src/codegen/compilation-cache.h"
 
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
 #include "src/common/globals.h"
 #include "src/heap/factory.h"
 #include "src/logging/counters.h"
@@ -382,5 +384,54 @@ void CompilationCache::DisableScriptAndEval() {
   Clear();
 }
 
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedCompilationCache,
+                                GetSharedCompilationCache)
+
+// static
+SharedCompilationCache* SharedCompilationCache::GetInstance() {
+  return GetSharedCompilationCache();
+}
+
+// static
+uint64_t SharedCompilationCache::Key(Isolate* isolate, Handle<String> source,
+                                     LanguageMode language_mode,
+                                     int origin_flags) {
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  size_t content_hash;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    content_hash = base::hash_range(chars.begin(), chars.end());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    content_hash = base::hash_range(chars.begin(), chars.end());
+  }
+  // The one-byte bit distinguishes encodings, since equal text hashes
+  // differently depending on the character width.
+  return base::hash_combine(content_hash, source->length(),
+                            static_cast<int>(language_mode), origin_flags,
+                            content.IsOneByte() ? 1 : 0);
+}
+
+SharedCompilationCache::SerializedCode SharedCompilationCache::Lookup(
+    uint64_t key) {
+  base::AdaptiveMutexGuard guard(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return {};
+  return it->second;
+}
+
+void SharedCompilationCache::Put(uint64_t key,
+                                 base::Vector<const uint8_t> data) {
+  auto code = std::make_shared<const std::vector<uint8_t>>(data.begin(),
+                                                           data.end());
+  base::AdaptiveMutexGuard guard(&mutex_);
+  if (total_byte_size_ + data.size() > kMaxTotalByteSize) return;
+  auto result = entries_.emplace(key, std::move(code));
+  if (result.second) total_byte_size_ += data.size();
+}
+
 }  // namespace internal
 }  // namespace v8
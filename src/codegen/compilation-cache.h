@@ -5,7 +5,13 @@
 #ifndef V8_CODEGEN_COMPILATION_CACHE_H_
 #define V8_CODEGEN_COMPILATION_CACHE_H_
 
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "src/base/hashmap.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
 #include "src/objects/compilation-cache-table.h"
 #include "src/utils/allocation.h"
 
@@ -232,6 +238,43 @@ class V8_EXPORT_PRIVATE CompilationCache {
   friend class Isolate;
 };
 
+// A process-wide cache of serialized code for top-level scripts, keyed by a
+// hash of the source text and the compile flags that affect the result.
+// Opt-in via --shared-compilation-cache: isolates then consume code that
+// another isolate in the same process produced for the same script (e.g. a
+// framework bundle loaded into every isolate) instead of parsing and
+// compiling it again. Entries are produced by CodeSerializer, whose sanity
+// check re-validates source hash and flags on consumption, so a key
+// collision merely falls back to a regular compile.
+class V8_EXPORT_PRIVATE SharedCompilationCache {
+ public:
+  using SerializedCode = std::shared_ptr<const std::vector<uint8_t>>;
+
+  static SharedCompilationCache* GetInstance();
+
+  // Computes the cache key for the given source and compile flags;
+  // |origin_flags| are the ScriptOriginOptions flags. Flattens |source| if
+  // needed.
+  static uint64_t Key(Isolate* isolate, Handle<String> source,
+                      LanguageMode language_mode, int origin_flags);
+
+  // Returns the serialized code stored under |key|, or an empty pointer.
+  SerializedCode Lookup(uint64_t key);
+
+  // Stores a copy of |data| under |key|, unless the cache is full or the key
+  // is already present.
+  void Put(uint64_t key, base::Vector<const uint8_t> data);
+
+ private:
+  // Bounds the memory the process-wide cache may retain. Scripts compiled
+  // after the limit is reached are simply not shared.
+  static constexpr size_t kMaxTotalByteSize = 128 * MB;
+
+  base::AdaptiveMutex mutex_;
+  std::unordered_map<uint64_t, SerializedCode> entries_;
+  size_t total_byte_size_ = 0;
+};
+
 }  // namespace internal
 }  // namespace v8
 
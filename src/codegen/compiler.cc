@@ -14,6 +14,7 @@
 #include "src/base/logging.h"
 #include "src/base/optional.h"
 #include "src/base/platform/time.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -1612,6 +1613,9 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
 
   if (v8_flags.always_sparkplug) {
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
+  } else if (v8_flags.concurrent_sparkplug_for_scripts &&
+             !parse_info->flags().is_eval()) {
+    isolate->baseline_batch_compiler()->CompileScriptConcurrent(script);
   }
 
   return shared_info;
@@ -2469,6 +2473,36 @@ MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
 // ----------------------------------------------------------------------------
 // Implementation of Compiler
 
+namespace {
+
+// Provides the ReusableUnoptimizedCompileState for a main-thread compile.
+// Sequential compiles (e.g. a bundler compiling many small modules
+// back-to-back) share the isolate's cached state, so the AST Zone segments
+// and the AstValueFactory survive across compiles and are cheaply reset
+// rather than freed and re-allocated each time. Nested compiles fall back to
+// a fresh, local state.
+class V8_NODISCARD ReusableCompileStateScope {
+ public:
+  explicit ReusableCompileStateScope(Isolate* isolate)
+      : isolate_(isolate), cached_(isolate->AcquireReusableCompileState()) {
+    if (cached_ == nullptr) local_.emplace(isolate);
+  }
+  ~ReusableCompileStateScope() {
+    if (cached_ != nullptr) isolate_->ReleaseReusableCompileState(cached_);
+  }
+
+  ReusableUnoptimizedCompileState* state() {
+    return cached_ != nullptr ? cached_ : &local_.value();
+  }
+
+ private:
+  Isolate* isolate_;
+  ReusableUnoptimizedCompileState* cached_;
+  base::Optional<ReusableUnoptimizedCompileState> local_;
+};
+
+}  // namespace
+
 // static
 bool Compiler::CollectSourcePositions(Isolate* isolate,
                                       Handle<SharedFunctionInfo> shared_info) {
@@ -2523,10 +2557,11 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
+  flags.set_post_parallel_compile_tasks_for_streaming(false);
 
   UnoptimizedCompileState compile_state;
-  ReusableUnoptimizedCompileState reusable_state(isolate);
-  ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
+  ReusableCompileStateScope reusable_state(isolate);
+  ParseInfo parse_info(isolate, flags, &compile_state, reusable_state.state());
 
   // Parse and update ParseInfo with the results. Don't update parsing
   // statistics since we've already parsed the code before.
@@ -2606,8 +2641,8 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   }
 
   UnoptimizedCompileState compile_state;
-  ReusableUnoptimizedCompileState reusable_state(isolate);
-  ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
+  ReusableCompileStateScope reusable_state(isolate);
+  ParseInfo parse_info(isolate, flags, &compile_state, reusable_state.state());
 
   // Check if the compiler dispatcher has shared_info enqueued for compile.
   LazyCompileDispatcher* dispatcher = isolate->lazy_compile_dispatcher();
@@ -2933,8 +2968,9 @@ MaybeHandle<JSFunction> Compiler::GetFunctionFromEval(
     flags.set_parse_restriction(restriction);
 
     UnoptimizedCompileState compile_state;
-    ReusableUnoptimizedCompileState reusable_state(isolate);
-    ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
+    ReusableCompileStateScope reusable_state(isolate);
+    ParseInfo parse_info(isolate, flags, &compile_state,
+                         reusable_state.state());
     parse_info.set_parameters_end_pos(parameters_end_pos);
 
     MaybeHandle<ScopeInfo> maybe_outer_scope_info;
@@ -3404,8 +3440,8 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnMainThread(
     CompileHintCallback compile_hint_callback = nullptr,
     void* compile_hint_callback_data = nullptr) {
   UnoptimizedCompileState compile_state;
-  ReusableUnoptimizedCompileState reusable_state(isolate);
-  ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
+  ReusableCompileStateScope reusable_state(isolate);
+  ParseInfo parse_info(isolate, flags, &compile_state, reusable_state.state());
   parse_info.set_extension(extension);
   parse_info.SetCompileHintCallbackAndData(compile_hint_callback,
                                            compile_hint_callback_data);
@@ -3683,6 +3719,38 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     }
   }
 
+  // Then check the process-wide cache of serialized code, which shares the
+  // compilation work for identical scripts across isolates.
+  if (maybe_result.is_null() && use_compilation_cache &&
+      v8_flags.shared_compilation_cache && natives == NOT_NATIVES_CODE &&
+      (compile_options == ScriptCompiler::kNoCompileOptions ||
+       compile_options == ScriptCompiler::kConsumeCodeCache)) {
+    const uint64_t key = SharedCompilationCache::Key(
+        isolate, source, language_mode, script_details.origin_options.Flags());
+    if (SharedCompilationCache::SerializedCode serialized =
+            SharedCompilationCache::GetInstance()->Lookup(key)) {
+      NestedTimedHistogramScope timer(
+          isolate->counters()->compile_deserialize());
+      RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                   "V8.CompileDeserialize");
+      AlignedCachedData aligned_data(serialized->data(),
+                                     static_cast<int>(serialized->size()));
+      Handle<SharedFunctionInfo> result;
+      if (CodeSerializer::Deserialize(isolate, &aligned_data, source,
+                                      script_details.origin_options,
+                                      maybe_script)
+              .ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        if (is_compiled_scope.is_compiled()) {
+          maybe_result = result;
+          // Promote to the per-isolate compilation cache.
+          compilation_cache->PutScript(source, language_mode, result);
+        }
+      }
+    }
+  }
+
   if (maybe_result.is_null()) {
     // No cache entry found compile the script.
     if (v8_flags.stress_background_compile &&
@@ -3718,6 +3786,19 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (v8_flags.shared_compilation_cache && natives == NOT_NATIVES_CODE &&
+          (compile_options == ScriptCompiler::kNoCompileOptions ||
+           compile_options == ScriptCompiler::kConsumeCodeCache)) {
+        // Share the result with other isolates in the process.
+        std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+            CodeSerializer::Serialize(isolate, result));
+        if (cached_data) {
+          SharedCompilationCache::GetInstance()->Put(
+              SharedCompilationCache::Key(isolate, source, language_mode,
+                                          script_details.origin_options.Flags()),
+              base::VectorOf(cached_data->data, cached_data->length));
+        }
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -3868,8 +3949,9 @@ MaybeHandle<JSFunction> Compiler::GetWrappedFunction(
     flags.set_is_eager(compile_options == ScriptCompiler::kEagerCompile);
 
     UnoptimizedCompileState compile_state;
-    ReusableUnoptimizedCompileState reusable_state(isolate);
-    ParseInfo parse_info(isolate, flags, &compile_state, &reusable_state);
+    ReusableCompileStateScope reusable_state(isolate);
+    ParseInfo parse_info(isolate, flags, &compile_state,
+                         reusable_state.state());
 
     MaybeHandle<ScopeInfo> maybe_outer_scope_info;
     if (!IsNativeContext(*context)) {
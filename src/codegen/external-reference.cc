@@ -32,6 +32,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/simd.h"
+#include "src/objects/string-table.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
@@ -269,6 +270,11 @@ ExternalReference ExternalReference::interpreter_dispatch_table_address(
   return ExternalReference(isolate->interpreter()->dispatch_table_address());
 }
 
+ExternalReference ExternalReference::string_table_data_address(
+    Isolate* isolate) {
+  return ExternalReference(isolate->string_table()->data_address());
+}
+
 ExternalReference ExternalReference::interpreter_dispatch_counters(
     Isolate* isolate) {
   return ExternalReference(
@@ -806,6 +812,10 @@ ExternalReference::address_of_enable_experimental_regexp_engine() {
   return ExternalReference(&v8_flags.enable_experimental_regexp_engine);
 }
 
+ExternalReference ExternalReference::address_of_lazy_regexp_result_groups() {
+  return ExternalReference(&v8_flags.lazy_regexp_result_groups);
+}
+
 namespace {
 
 static uintptr_t BaselinePCForBytecodeOffset(Address raw_code_obj,
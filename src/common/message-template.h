@@ -198,6 +198,7 @@ namespace internal {
   T(NotSuperConstructorAnonymousClass,                                         \
     "Super constructor % of anonymous class is not a constructor")             \
   T(NotIntegerTypedArray, "% is not an integer typed array.")                  \
+  T(NotFloat64TypedArray, "% is not a Float64Array.")                          \
   T(NotInt32OrBigInt64TypedArray,                                              \
     "% is not an int32 or BigInt64 typed array.")                              \
   T(NotSharedTypedArray, "% is not a shared typed array.")                     \
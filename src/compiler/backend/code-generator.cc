@@ -17,6 +17,7 @@
 #include "src/execution/frames.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/objects/deoptimization-data.h"
 #include "src/objects/smi.h"
 #include "src/utils/address-map.h"
 #include "src/utils/utils.h"
@@ -920,6 +921,10 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
   Handle<DeoptimizationFrameTranslation> translation_array =
       translations_.ToFrameTranslation(
           isolate()->main_thread_local_isolate()->factory());
+  if (v8_flags.share_frame_translations) {
+    translation_array =
+        FrameTranslationCache::Canonicalize(isolate(), translation_array);
+  }
 
   data->SetFrameTranslation(*translation_array);
   data->SetInlinedFunctionCount(
@@ -939,9 +939,17 @@ void InstructionSequence::ComputeAssemblyOrder() {
     block->set_ao_number(RpoNumber::FromInt(ao++));
     ao_blocks_->push_back(block);
   }
-  // Add all leftover (deferred) blocks.
+  // Add all leftover (deferred) blocks. The first one starts the cold section
+  // of the instruction stream; align it so that the hot code above packs into
+  // complete instruction fetch lines and the padding bytes land in front of
+  // code that is rarely executed.
+  bool first_deferred = true;
   for (InstructionBlock* const block : *instruction_blocks_) {
     if (block->ao_number() == invalid) {
+      if (first_deferred && v8_flags.turbo_align_cold_blocks) {
+        block->set_code_target_alignment(true);
+        first_deferred = false;
+      }
       block->set_ao_number(RpoNumber::FromInt(ao++));
       ao_blocks_->push_back(block);
     }
@@ -3059,6 +3059,16 @@ void BytecodeGraphBuilder::VisitAdd() {
   BuildBinaryOp(javascript()->Add(feedback));
 }
 
+void BytecodeGraphBuilder::VisitLdarAdd() {
+  // Fused Ldar+Add superinstruction. Replay the Ldar, which is just an
+  // environment update here, and reuse the Add lowering, which takes its
+  // right operand from the accumulator. The first two operands of LdarAdd
+  // match Add's layout.
+  environment()->BindAccumulator(environment()->LookupRegister(
+      bytecode_iterator().GetRegisterOperand(2)));
+  VisitAdd();
+}
+
 void BytecodeGraphBuilder::VisitSub() {
   FeedbackSource feedback = CreateFeedbackSource(
       bytecode_iterator().GetSlotOperand(kBinaryOperationHintIndex));
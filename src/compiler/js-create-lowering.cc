@@ -1392,11 +1392,14 @@ Reduction JSCreateLowering::ReduceJSCreateObject(Node* node) {
     // Initialize NameDictionary fields.
     a.Store(AccessBuilder::ForNameDictionaryFlagsIndex(),
             jsgraph()->SmiConstant(NameDictionary::kFlagsDefault));
-    // Initialize the Properties fields.
+    // Initialize the enum cache slot and the Properties fields, all of which
+    // start out undefined.
     Node* undefined = jsgraph()->UndefinedConstant();
-    static_assert(NameDictionary::kElementsStartIndex ==
+    static_assert(NameDictionary::kEnumCacheIndex ==
                   NameDictionary::kFlagsIndex + 1);
-    for (int index = NameDictionary::kElementsStartIndex; index < length;
+    static_assert(NameDictionary::kElementsStartIndex ==
+                  NameDictionary::kEnumCacheIndex + 1);
+    for (int index = NameDictionary::kEnumCacheIndex; index < length;
          index++) {
       a.Store(AccessBuilder::ForFixedArraySlot(index, kNoWriteBarrier),
               undefined);
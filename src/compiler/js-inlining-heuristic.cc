@@ -246,6 +246,32 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     candidate.frequency = p.frequency();
   }
 
+  // Give call sites recorded in a persisted call-edge profile at least their
+  // profiled frequency, so that edges that were hot in a previous run are
+  // inlined even while feedback in this process is still sparse.
+  if (call_edge_profile_ != nullptr) {
+    int const caller_position = info_->shared_info()->StartPosition();
+    float profiled_frequency = 0.0f;
+    for (int i = 0; i < candidate.num_functions; ++i) {
+      if (!candidate.can_inline_function[i]) continue;
+      SharedFunctionInfoRef shared =
+          candidate.functions[i].has_value()
+              ? candidate.functions[i].value().shared(broker())
+              : candidate.shared_info.value();
+      float const frequency = call_edge_profile_->GetCallFrequency(
+          caller_position, shared.StartPosition());
+      if (frequency > profiled_frequency) profiled_frequency = frequency;
+    }
+    if (profiled_frequency > 0.0f &&
+        (!candidate.frequency.IsKnown() ||
+         candidate.frequency.value() < profiled_frequency)) {
+      TRACE("Raising frequency of call site #"
+            << node->id() << ":" << node->op()->mnemonic() << " to "
+            << profiled_frequency << " from call-edge profile");
+      candidate.frequency = CallFrequency(profiled_frequency);
+    }
+  }
+
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
   // invocations of the caller.
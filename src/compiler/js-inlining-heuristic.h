@@ -5,6 +5,7 @@
 #ifndef V8_COMPILER_JS_INLINING_HEURISTIC_H_
 #define V8_COMPILER_JS_INLINING_HEURISTIC_H_
 
+#include "src/codegen/call-edge-profile.h"
 #include "src/compiler/js-inlining.h"
 
 namespace v8 {
@@ -39,7 +40,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
         max_inlined_bytecode_size_cumulative_(
             v8_flags.max_inlined_bytecode_size_cumulative),
         max_inlined_bytecode_size_absolute_(
-            v8_flags.max_inlined_bytecode_size_absolute) {
+            v8_flags.max_inlined_bytecode_size_absolute),
+        call_edge_profile_(CallEdgeProfile::TryRead()) {
     DCHECK_EQ(mode == kWasmWrappersOnly || mode == kWasmFullInlining,
               wasm_module != nullptr);
   }
@@ -126,6 +128,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
   const Mode mode_;
   const int max_inlined_bytecode_size_cumulative_;
   const int max_inlined_bytecode_size_absolute_;
+  // Call-edge profile from a previous run, or nullptr; see
+  // --turbo-inline-profile-input.
+  const CallEdgeProfile* const call_edge_profile_;
 };
 
 }  // namespace compiler
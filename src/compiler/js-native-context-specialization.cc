@@ -989,12 +989,37 @@ Reduction JSNativeContextSpecialization::ReduceJSPromiseResolve(Node* node) {
     return NoChange();
   }
 
-  // Only optimize if {value} cannot be a JSPromise.
   MapInference inference(broker(), value, effect);
-  if (!inference.HaveMaps() ||
-      inference.AnyOfInstanceTypesAre(JS_PROMISE_TYPE)) {
-    return NoChange();
+  if (!inference.HaveMaps()) return NoChange();
+
+  // If {value} is known to be a JSPromise with the initial %Promise% map,
+  // then PromiseResolve returns {value} itself and the wrapper promise
+  // allocation can be elided entirely. This is the compile-time counterpart
+  // of the fast path in the Await builtin and typically triggers when the
+  // result of a known async function (or another native promise) is
+  // immediately awaited or re-resolved. The initial map guarantees that the
+  // "constructor" lookup on {value} starts at the initial Promise.prototype,
+  // and the species protector guards that lookup yielding %Promise%.
+  MapRef initial_promise_map =
+      native_context().promise_function(broker()).initial_map(broker());
+  bool value_is_native_promise = true;
+  for (MapRef map : inference.GetMaps()) {
+    if (!map.equals(initial_promise_map)) {
+      value_is_native_promise = false;
+      break;
+    }
   }
+  if (value_is_native_promise) {
+    if (!dependencies()->DependOnPromiseSpeciesProtector() ||
+        !inference.RelyOnMapsViaStability(dependencies())) {
+      return inference.NoChange();
+    }
+    ReplaceWithValue(node, value, effect, control);
+    return Replace(value);
+  }
+
+  // Otherwise only optimize if {value} cannot be a JSPromise.
+  if (inference.AnyOfInstanceTypesAre(JS_PROMISE_TYPE)) return NoChange();
 
   if (!dependencies()->DependOnPromiseHookProtector()) return NoChange();
 
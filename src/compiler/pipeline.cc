@@ -4493,6 +4493,52 @@ void TraceSequence(OptimizedCompilationInfo* info, PipelineData* data,
 
 }  // namespace
 
+namespace {
+
+// Prints one machine-readable line of spill statistics for the function that
+// was just register-allocated; see --turbo-spill-stats-nvp.
+void PrintSpillStatistics(OptimizedCompilationInfo* info,
+                          const RegisterAllocationData* data,
+                          const InstructionSequence* sequence,
+                          const Frame* frame) {
+  int spilled_ranges = 0;
+  for (const TopLevelLiveRange* range : data->live_ranges()) {
+    if (range == nullptr) continue;
+    if (range->HasSpillRange()) spilled_ranges++;
+  }
+  int reloads = 0;
+  int spills = 0;
+  int stack_to_stack = 0;
+  for (const Instruction* instr : sequence->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; i++) {
+      const ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (const MoveOperands* move : *moves) {
+        if (move->IsEliminated()) continue;
+        const bool from_stack = move->source().IsAnyStackSlot();
+        const bool to_stack = move->destination().IsAnyStackSlot();
+        if (from_stack && to_stack) {
+          stack_to_stack++;
+        } else if (from_stack) {
+          reloads++;
+        } else if (to_stack) {
+          spills++;
+        }
+      }
+    }
+  }
+  StdoutStream os;
+  os << "spill_stats, function=" << info->GetDebugName().get()
+     << ", spilled_ranges=" << spilled_ranges
+     << ", spill_slots=" << frame->GetSpillSlotCount()
+     << ", spill_moves=" << spills << ", reload_moves=" << reloads
+     << ", stack_to_stack_moves=" << stack_to_stack << std::endl;
+}
+
+}  // namespace
+
 void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                      CallDescriptor* call_descriptor,
                                      bool run_verifier) {
@@ -4567,6 +4613,11 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
 
   TraceSequence(info(), data, "after register allocation");
 
+  if (V8_UNLIKELY(v8_flags.turbo_spill_stats_nvp)) {
+    PrintSpillStatistics(info(), data->register_allocation_data(),
+                         data->sequence(), data->frame());
+  }
+
   if (verifier != nullptr) {
     verifier->VerifyAssignment("End of regalloc pipeline.");
     verifier->VerifyGapMoves();
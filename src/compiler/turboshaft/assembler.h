@@ -564,6 +564,10 @@ class ReducerStack<Assembler<Reducers>, has_gvn> {
   Assembler<ReducerList>& Asm() {
     return *static_cast<Assembler<ReducerList>*>(this);
   }
+
+  // Terminates the reducer name collection started by the
+  // TURBOSHAFT_REDUCER_BOILERPLATE macros further up the stack.
+  static void CollectReducerNames(base::SmallVector<const char*, 16>* names) {}
 };
 
 template <class Reducers>
@@ -593,11 +597,19 @@ class GenericReducerBase;
   using ScopedVar = turboshaft::ScopedVariable<T, Assembler<ReducerList>>; \
   using CatchScope = CatchScopeImpl<Assembler<ReducerList>>;
 
-// Defines a few helpers to use the Assembler and its stack in Reducers.
-#define TURBOSHAFT_REDUCER_BOILERPLATE()   \
-  TURBOSHAFT_REDUCER_GENERIC_BOILERPLATE() \
-  using node_t = typename Next::node_t;    \
-  using block_t = typename Next::block_t;
+// Defines a few helpers to use the Assembler and its stack in Reducers. The
+// reducer |Name| is recorded so that the stack composition can be reported,
+// e.g. in the per-phase trace events emitted by CopyingPhase.
+#define TURBOSHAFT_REDUCER_BOILERPLATE(Name)                          \
+  TURBOSHAFT_REDUCER_GENERIC_BOILERPLATE()                            \
+  using node_t = typename Next::node_t;                               \
+  using block_t = typename Next::block_t;                             \
+  static constexpr char kReducerName[] = #Name;                       \
+  static void CollectReducerNames(                                    \
+      base::SmallVector<const char*, 16>* names) {                    \
+    names->push_back(kReducerName);                                   \
+    Next::CollectReducerNames(names);                                 \
+  }
 
 template <class T, class Assembler>
 class ScopedVariable : Variable {
@@ -655,7 +667,7 @@ template <class Next>
 class EmitProjectionReducer
     : public UniformReducerAdapter<EmitProjectionReducer, Next> {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(EmitProjection)
 
   OpIndex ReduceCatchBlockBegin() {
     // CatchBlockBegin have a single output, so they never have projections,
@@ -767,7 +779,7 @@ class TSReducerBase : public Next {
 template <class Next>
 class ReducerBaseForwarder : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(ReducerBaseForwarder)
 
 #define EMIT_OP(Name)                                                    \
   OpIndex ReduceInputGraph##Name(OpIndex ig_index, const Name##Op& op) { \
@@ -788,7 +800,7 @@ class ReducerBaseForwarder : public Next {
 template <class Next>
 class GenericReducerBase : public ReducerBaseForwarder<Next> {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(GenericReducerBase)
 
   using Base = ReducerBaseForwarder<Next>;
 
@@ -974,7 +986,7 @@ class GenericReducerBase : public ReducerBaseForwarder<Next> {
 template <class Next>
 class GenericAssemblerOpInterface : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(GenericAssemblerOpInterface)
 
   ~GenericAssemblerOpInterface() {
     // If the {if_scope_stack_} is not empty, it means that a END_IF is missing.
@@ -1105,7 +1117,7 @@ template <class Next>
 class TurboshaftAssemblerOpInterface
     : public GenericAssemblerOpInterface<Next> {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(TurboshaftAssemblerOpInterface)
 
   template <typename... Args>
   explicit TurboshaftAssemblerOpInterface(Args... args)
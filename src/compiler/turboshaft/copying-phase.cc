@@ -4,8 +4,47 @@
 
 #include "src/compiler/turboshaft/copying-phase.h"
 
+#include <sstream>
+
+#include "src/compiler/pipeline-statistics.h"
+#include "src/tracing/trace-event.h"
+
 namespace v8::internal::compiler::turboshaft {
 
+namespace {
+
+// Reuse the Turbofan pipeline categories so that copying-phase events show
+// up next to the existing per-phase events.
+constexpr const char* kTraceCategory =
+    TurbofanPipelineStatistics::kTraceCategory;
+
+}  // namespace
+
+CopyingPhaseTracingScope::CopyingPhaseTracingScope(
+    Zone* phase_zone, base::Vector<const char* const> reducer_names)
+    : phase_zone_(phase_zone) {
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(kTraceCategory, &enabled_);
+  if (!enabled_) return;
+  std::ostringstream reducers;
+  for (size_t i = 0; i < reducer_names.size(); ++i) {
+    if (i > 0) reducers << ",";
+    reducers << reducer_names[i];
+  }
+  TRACE_EVENT_BEGIN1(kTraceCategory, "V8.TurboshaftCopyingPhase", "reducers",
+                     TRACE_STR_COPY(reducers.str().c_str()));
+  initial_allocation_size_ = phase_zone_->allocation_size();
+  timer_.Start();
+}
+
+CopyingPhaseTracingScope::~CopyingPhaseTracingScope() {
+  if (!enabled_) return;
+  TRACE_EVENT_END2(
+      kTraceCategory, "V8.TurboshaftCopyingPhase", "time_us",
+      timer_.Elapsed().InMicroseconds(), "phase_zone_bytes",
+      static_cast<uint64_t>(phase_zone_->allocation_size() -
+                            initial_allocation_size_));
+}
+
 int CountDecimalDigits(uint32_t value) {
   int result = 1;
   while (value > 9) {
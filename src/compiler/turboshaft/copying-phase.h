@@ -12,6 +12,7 @@
 
 #include "src/base/iterator.h"
 #include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/small-vector.h"
 #include "src/base/vector.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -37,6 +38,26 @@ struct PaddingSpace {
 V8_EXPORT_PRIVATE std::ostream& operator<<(std::ostream& os,
                                            PaddingSpace padding);
 
+// Streams one trace event per copying phase through the tracing protocol,
+// annotated with the composition of the reducer stack and, on completion,
+// with the wall time and phase-zone memory the pass consumed. This makes
+// compile-time regressions attributable to individual reducer stacks in
+// production builds, where the fused reducers cannot be timed individually.
+class V8_NODISCARD V8_EXPORT_PRIVATE CopyingPhaseTracingScope {
+ public:
+  CopyingPhaseTracingScope(Zone* phase_zone,
+                           base::Vector<const char* const> reducer_names);
+  ~CopyingPhaseTracingScope();
+  CopyingPhaseTracingScope(const CopyingPhaseTracingScope&) = delete;
+  CopyingPhaseTracingScope& operator=(const CopyingPhaseTracingScope&) = delete;
+
+ private:
+  Zone* const phase_zone_;
+  size_t initial_allocation_size_ = 0;
+  base::ElapsedTimer timer_;
+  bool enabled_ = false;
+};
+
 template <typename Next>
 class ReducerBaseForwarder;
 
@@ -47,7 +68,7 @@ class GraphVisitor : public VariableReducer<AfterNext> {
 
  public:
   using Next = VariableReducer<AfterNext>;
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(GraphVisitor)
 
   GraphVisitor()
       : input_graph_(Asm().modifiable_input_graph()),
@@ -1573,6 +1594,11 @@ class CopyingPhaseImpl {
                   bool trace_reductions = false) {
     TSAssembler<GraphVisitor, Reducers...> phase(
         input_graph, input_graph.GetOrCreateCompanion(), phase_zone);
+    base::SmallVector<const char*, 16> reducer_names;
+    TSAssembler<GraphVisitor, Reducers...>::CollectReducerNames(
+        &reducer_names);
+    CopyingPhaseTracingScope tracing_scope(phase_zone,
+                                           base::VectorOf(reducer_names));
 #ifdef DEBUG
     if (trace_reductions) {
       phase.template VisitGraph<true>();
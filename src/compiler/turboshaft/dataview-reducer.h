@@ -14,7 +14,7 @@ namespace v8::internal::compiler::turboshaft {
 template <typename Next>
 class DataViewReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(DataView)
 
   OpIndex BuildReverseBytes(ExternalArrayType type, OpIndex value) {
     switch (type) {
@@ -21,7 +21,7 @@ namespace v8::internal::compiler::turboshaft {
 template <typename Next>
 class FastApiCallReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(FastApiCall)
 
   OpIndex REDUCE(FastApiCall)(OpIndex data_argument,
                               base::Vector<const OpIndex> arguments,
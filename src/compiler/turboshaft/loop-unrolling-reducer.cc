@@ -23,6 +23,32 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   }
 }
 
+int LoopUnrollingAnalyzer::GetPartialUnrollCount(const Block* loop_header) {
+  DCHECK(ShouldPartiallyUnrollLoop(loop_header));
+  auto info = loop_finder_.GetLoopInfo(loop_header);
+  if (is_wasm_ || info.op_count > kMaxLoopSizeForTypedArrayPartialUnrolling) {
+    return static_cast<int>(kPartialUnrollingCount);
+  }
+  // In the JS pipeline, loads and stores without the {load_eliminable} bit
+  // are exactly the accesses to ArrayBuffer-backed views (TypedArrays and
+  // DataViews); see the comment on LoadOp::Kind. Loops containing such
+  // accesses are the typical numeric kernels and get the higher count.
+  for (const Block* block : loop_finder_.GetLoopBody(loop_header)) {
+    for (const Operation& op : input_graph_->operations(*block)) {
+      if (const LoadOp* load = op.TryCast<LoadOp>()) {
+        if (!load->kind.load_eliminable) {
+          return static_cast<int>(kTypedArrayLoopPartialUnrollingCount);
+        }
+      } else if (const StoreOp* store = op.TryCast<StoreOp>()) {
+        if (!store->kind.load_eliminable) {
+          return static_cast<int>(kTypedArrayLoopPartialUnrollingCount);
+        }
+      }
+    }
+  }
+  return static_cast<int>(kPartialUnrollingCount);
+}
+
 bool LoopUnrollingAnalyzer::CanFullyUnrollLoop(const LoopFinder::LoopInfo& info,
                                                int* iter_count) const {
   const Block* start = info.start;
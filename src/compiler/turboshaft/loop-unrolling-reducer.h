@@ -131,6 +131,14 @@ class LoopUnrollingAnalyzer {
            info.op_count < kMaxLoopSizeForPartialUnrolling;
   }
 
+  // Returns the number of iterations to fold into the body of a partially
+  // unrolled loop. Small counted loops over TypedArray/DataView data are
+  // unrolled more aggressively: their bodies are mostly raw memory accesses
+  // whose unrolled copies are independent and can be issued in parallel by
+  // out-of-order cores, and the per-iteration overhead (counter update and
+  // branch) makes up a large fraction of such loops.
+  int GetPartialUnrollCount(const Block* loop_header);
+
   bool ShouldRemoveLoop(const Block* loop_header) const {
     auto iter_count = GetIterationCount(loop_header);
     return iter_count.has_value() && *iter_count == 0;
@@ -162,6 +170,8 @@ class LoopUnrollingAnalyzer {
   static constexpr size_t kWasmMaxLoopSizeForPartialUnrolling = 80;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kPartialUnrollingCount = 4;
+  static constexpr size_t kTypedArrayLoopPartialUnrollingCount = 8;
+  static constexpr size_t kMaxLoopSizeForTypedArrayPartialUnrolling = 25;
 
  private:
   void DetectUnrollableLoops();
@@ -179,6 +189,10 @@ class LoopUnrollingAnalyzer {
   const size_t kMaxLoopSizeForPartialUnrolling =
       PipelineData::Get().is_wasm() ? kWasmMaxLoopSizeForPartialUnrolling
                                     : kJSMaxLoopSizeForPartialUnrolling;
+  // The aggressive typed-array unrolling count only applies to the JS
+  // pipeline; wasm memory accesses are also untagged but have their own loop
+  // optimizations (and revectorization) already.
+  const bool is_wasm_ = PipelineData::Get().is_wasm();
   bool can_unroll_at_least_one_loop_ = false;
 };
 
@@ -188,7 +202,7 @@ class LoopPeelingReducer;
 template <class Next>
 class LoopUnrollingReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopUnrolling)
 
 #if defined(__clang__)
   // LoopUnrolling and LoopPeeling shouldn't be performed in the same phase, see
@@ -369,7 +383,7 @@ void LoopUnrollingReducer<Next>::PartiallyUnrollLoop(const Block* header) {
   auto loop_body = analyzer_.GetLoopBody(header);
   current_loop_header_ = header;
 
-  int unroll_count = LoopUnrollingAnalyzer::kPartialUnrollingCount;
+  int unroll_count = analyzer_.GetPartialUnrollCount(header);
 
   ScopedModification<bool> set_true(__ turn_loop_without_backedge_into_merge(),
                                     false);
@@ -25,7 +25,7 @@ namespace v8::internal::compiler::turboshaft {
 template <class Next>
 class RequiredOptimizationReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(RequiredOptimization)
 
   OpIndex REDUCE(Phi)(base::Vector<const OpIndex> inputs,
                       RegisterRepresentation rep) {
@@ -19,7 +19,7 @@ namespace v8::internal::compiler::turboshaft {
 template <class Next>
 class StackCheckReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(StackCheck)
 
   OpIndex REDUCE(StackCheck)(StackCheckOp::CheckOrigin origin,
                              StackCheckOp::CheckKind kind) {
@@ -19,7 +19,7 @@ namespace v8::internal::compiler::turboshaft {
 // template <typename Next>
 // class MyReducer : public UniformReducerAdapter<MyReducer, Next> {
 //  public:
-//   TURBOSHAFT_REDUCER_BOILERPLATE()
+//   TURBOSHAFT_REDUCER_BOILERPLATE(My)
 //   using Adapter = UniformReducerAdapter<MyReducer, Next>;
 //
 //   OpIndex ReduceInputGraphConstant(OpIndex ig_index, const ConstantOp& op) {
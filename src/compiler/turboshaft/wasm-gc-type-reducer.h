@@ -121,7 +121,7 @@ class WasmGCTypeAnalyzer {
 template <class Next>
 class WasmGCTypeReducer : public Next {
  public:
-  TURBOSHAFT_REDUCER_BOILERPLATE()
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmGCType)
 
   void Analyze() {
     analyzer_.Run();
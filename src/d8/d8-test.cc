@@ -444,6 +444,88 @@ class FastCApiObject {
     }
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType AddAllBatchScalarFastCallbackPatch(AnyCType receiver,
+                                                     AnyCType arg) {
+    AnyCType ret;
+    ret.double_value =
+        AddAllBatchScalarFastCallback(receiver.object_value, arg.double_value);
+    return ret;
+  }
+  static AnyCType AddAllBatchFastCallbackPatch(AnyCType receiver,
+                                               AnyCType typed_array_arg,
+                                               AnyCType count) {
+    AnyCType ret;
+    ret.double_value =
+        AddAllBatchFastCallback(receiver.object_value,
+                                *typed_array_arg.double_ta_value,
+                                count.uint32_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  // Scalar entry point of "add_all_batch": returns its argument, so that a JS
+  // loop accumulating the results computes the same sum as one batch call.
+  static double AddAllBatchScalarFastCallback(Local<Object> receiver,
+                                              double arg) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_NOT_NULL(self);
+    self->fast_call_count_++;
+
+    return arg;
+  }
+  // Batch variant of "add_all_batch": sums the first |count| elements of the
+  // typed array in a single call.
+  static double AddAllBatchFastCallback(Local<Object> receiver,
+                                        const FastApiTypedArray<double>& values,
+                                        uint32_t count) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_NOT_NULL(self);
+    self->fast_call_count_++;
+
+    if (count > values.length()) {
+      count = static_cast<uint32_t>(values.length());
+    }
+    double sum = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+      sum += values.get(i);
+    }
+    return sum;
+  }
+  static void AddAllBatchSlowCallback(const FunctionCallbackInfo<Value>& info) {
+    DCHECK(i::ValidateCallbackInfo(info));
+    Isolate* isolate = info.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(info.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+    Local<Context> context = isolate->GetCurrentContext();
+
+    if (info.Length() > 1 && info[0]->IsFloat64Array()) {
+      // Batch shape: a Float64Array and an element count.
+      Local<Float64Array> values = info[0].As<Float64Array>();
+      uint32_t count = info[1]->Uint32Value(context).FromJust();
+      size_t length = values->Length();
+      if (count > length) count = static_cast<uint32_t>(length);
+      double* data =
+          static_cast<double*>(values->Buffer()->GetBackingStore()->Data());
+      double sum = 0;
+      for (uint32_t i = 0; i < count; ++i) {
+        sum += data[i];
+      }
+      info.GetReturnValue().Set(Number::New(isolate, sum));
+      return;
+    }
+    if (info.Length() < 1 || !info[0]->IsNumber()) {
+      isolate->ThrowError(
+          "This method expects a number, or a Float64Array and a count.");
+      return;
+    }
+    info.GetReturnValue().Set(
+        Number::New(isolate, info[0]->NumberValue(context).FromJust()));
+  }
+
   static int32_t AddAllIntInvalidCallback(Local<Object> receiver,
                                           bool should_fallback, int32_t arg_i32,
                                           FastApiCallbackOptions& options) {
@@ -1632,6 +1714,22 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             Local<Signature>(), 1, ConstructorBehavior::kThrow,
             SideEffectType::kHasSideEffect, &add_all_no_options_c_func));
 
+    CFunction add_all_batch_scalar_c_func = CFunction::Make(
+        FastCApiObject::AddAllBatchScalarFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddAllBatchScalarFastCallbackPatch));
+    CFunction add_all_batch_variant_c_func = CFunction::Make(
+        FastCApiObject::AddAllBatchFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddAllBatchFastCallbackPatch));
+    CFunction add_all_batch_c_func =
+        add_all_batch_scalar_c_func.WithBatchVariant(
+            add_all_batch_variant_c_func);
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_batch",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllBatchSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_batch_c_func));
+
     CFunction add_32bit_int_c_func = CFunction::Make(
         FastCApiObject::Add32BitIntFastCallback V8_IF_USE_SIMULATOR(
             FastCApiObject::Add32BitIntFastCallbackPatch));
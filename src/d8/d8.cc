@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -100,7 +101,10 @@
 #endif  // V8_INTL_SUPPORT
 
 #ifdef V8_OS_LINUX
-#include <sys/mman.h>  // For MultiMappedAllocator.
+#include <linux/perf_event.h>  // For Shell::RunBenchmarks.
+#include <sys/ioctl.h>         // For Shell::RunBenchmarks.
+#include <sys/mman.h>          // For MultiMappedAllocator.
+#include <sys/syscall.h>       // For Shell::RunBenchmarks.
 #endif
 
 #if defined(V8_OS_WIN)
@@ -533,6 +537,9 @@ std::map<v8::Isolate*, int> Shell::isolate_running_streaming_tasks_;
 base::LazyMutex Shell::cached_code_mutex_;
 std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
     Shell::cached_code_map_;
+base::LazyMutex Shell::produced_compile_hints_mutex_;
+std::set<int> Shell::produced_compile_hints_;
+std::vector<int> Shell::consumed_compile_hints_;
 std::atomic<int> Shell::unhandled_promise_rejections_{0};
 
 Global<Context> Shell::evaluation_context_;
@@ -603,14 +610,51 @@ class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
   bool done_;
 };
 
+// Source stream that serves fixed-size chunks straight out of an external
+// one-byte string resource, which in d8 is typically a memory-mapped file
+// (see Shell::ReadFile). The chunks stay owned by the resource, so the
+// background parser reads the mapped pages directly and page faults let the
+// OS readahead schedule the file I/O; nothing is double-buffered.
+class ExternalOneByteSourceStream
+    : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  static constexpr size_t kChunkSize = 1 * i::MB;
+
+  explicit ExternalOneByteSourceStream(
+      const String::ExternalOneByteStringResource* resource)
+      : data_(reinterpret_cast<const uint8_t*>(resource->data())),
+        length_(resource->length()) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    if (position_ == length_) return 0;
+    const size_t chunk_size = std::min(kChunkSize, length_ - position_);
+    *src = data_ + position_;
+    position_ += chunk_size;
+    return chunk_size;
+  }
+
+  bool ChunksOwnedByEmbedder() const override { return true; }
+
+ private:
+  const uint8_t* const data_;
+  const size_t length_;
+  size_t position_ = 0;
+};
+
 class StreamingCompileTask final : public v8::Task {
  public:
   StreamingCompileTask(Isolate* isolate,
                        v8::ScriptCompiler::StreamedSource* streamed_source,
-                       v8::ScriptType type)
+                       v8::ScriptType type,
+                       v8::ScriptCompiler::CompileOptions options =
+                           v8::ScriptCompiler::kNoCompileOptions,
+                       v8::ScriptCompiler::CompileHintCallback
+                           compile_hint_callback = nullptr,
+                       void* compile_hint_callback_data = nullptr)
       : isolate_(isolate),
         script_streaming_task_(v8::ScriptCompiler::StartStreaming(
-            isolate, streamed_source, type)) {
+            isolate, streamed_source, type, options, compile_hint_callback,
+            compile_hint_callback_data)) {
     Shell::NotifyStartStreamingTask(isolate_);
   }
 
@@ -676,25 +720,66 @@ MaybeLocal<Module> Compile(Local<Context> context,
   return ScriptCompiler::CompileModule(context->GetIsolate(), source, options);
 }
 
+// Callback for kConsumeCompileHints; |data| is the sorted vector of function
+// start positions loaded from the --consume-compile-hints sidecar.
+bool SidecarCompileHintCallback(int position, void* data) {
+  auto* hints = static_cast<std::vector<int>*>(data);
+  return std::binary_search(hints->begin(), hints->end(), position);
+}
+
 }  // namespace
 
 template <class T>
 MaybeLocal<T> Shell::CompileString(Isolate* isolate, Local<Context> context,
                                    Local<String> source,
                                    const ScriptOrigin& origin) {
+  // Compile hints from a --consume-compile-hints sidecar take effect through
+  // the embedder callback; --produce-compile-hints makes V8 record the lazy
+  // functions which end up being compiled.
+  ScriptCompiler::CompileOptions hint_options =
+      ScriptCompiler::kNoCompileOptions;
+  ScriptCompiler::CompileHintCallback hint_callback = nullptr;
+  void* hint_callback_data = nullptr;
+  if (options.consume_compile_hints_file) {
+    hint_options = ScriptCompiler::kConsumeCompileHints;
+    hint_callback = SidecarCompileHintCallback;
+    hint_callback_data = &consumed_compile_hints_;
+  } else if (options.produce_compile_hints_file) {
+    hint_options = ScriptCompiler::kProduceCompileHints;
+  }
+
   if (options.streaming_compile) {
-    v8::ScriptCompiler::StreamedSource streamed_source(
-        std::make_unique<DummySourceStream>(source),
-        v8::ScriptCompiler::StreamedSource::UTF8);
+    // Sources backed by an external resource (a memory-mapped file, see
+    // Shell::ReadFile) are streamed without copying; everything else goes
+    // through a single heap copy of the source.
+    std::unique_ptr<v8::ScriptCompiler::ExternalSourceStream> stream;
+    v8::ScriptCompiler::StreamedSource::Encoding encoding =
+        v8::ScriptCompiler::StreamedSource::UTF8;
+    if (source->IsExternalOneByte()) {
+      stream = std::make_unique<ExternalOneByteSourceStream>(
+          source->GetExternalOneByteStringResource());
+      encoding = v8::ScriptCompiler::StreamedSource::ONE_BYTE;
+    } else {
+      stream = std::make_unique<DummySourceStream>(source);
+    }
+    v8::ScriptCompiler::StreamedSource streamed_source(std::move(stream),
+                                                       encoding);
     PostBlockingBackgroundTask(std::make_unique<StreamingCompileTask>(
         isolate, &streamed_source,
         std::is_same<T, Module>::value ? v8::ScriptType::kModule
-                                       : v8::ScriptType::kClassic));
+                                       : v8::ScriptType::kClassic,
+        hint_options, hint_callback, hint_callback_data));
     // Pump the loop until the streaming task completes.
     Shell::CompleteMessageLoop(isolate);
     return CompileStreamed<T>(context, &streamed_source, source, origin);
   }
 
+  if (hint_options == ScriptCompiler::kConsumeCompileHints) {
+    ScriptCompiler::Source script_source(source, origin, hint_callback,
+                                         hint_callback_data);
+    return Compile<T>(context, &script_source, hint_options);
+  }
+
   ScriptCompiler::CachedData* cached_code = nullptr;
   if (options.compile_options == ScriptCompiler::kConsumeCodeCache) {
     cached_code = LookupCodeCache(isolate, source);
@@ -703,7 +788,7 @@ MaybeLocal<T> Shell::CompileString(Isolate* isolate, Local<Context> context,
   MaybeLocal<T> result =
       Compile<T>(context, &script_source,
                  cached_code ? ScriptCompiler::kConsumeCodeCache
-                             : ScriptCompiler::kNoCompileOptions);
+                             : hint_options);
   if (cached_code) CHECK(!cached_code->rejected);
   return result;
 }
@@ -990,6 +1075,14 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
       if (!CompleteMessageLoop(isolate)) success = false;
       if (!HandleUnhandledPromiseRejections(isolate)) success = false;
     }
+    if (options.produce_compile_hints_file) {
+      // Remember which lazy functions were compiled while the script ran; the
+      // accumulated positions are written to the sidecar file when the isolate
+      // is done.
+      std::vector<int> produced = script->GetProducedCompileHints();
+      base::MutexGuard lock_guard(produced_compile_hints_mutex_.Pointer());
+      produced_compile_hints_.insert(produced.begin(), produced.end());
+    }
     data->realm_current_ = data->realm_switch_;
   }
   Local<Value> result;
@@ -3795,6 +3888,16 @@ void Shell::WriteLcovData(v8::Isolate* isolate, const char* file) {
   }
 }
 
+void Shell::WriteCompileHints(const char* file) {
+  if (!file) return;
+  base::MutexGuard lock_guard(produced_compile_hints_mutex_.Pointer());
+  // Write the full accumulated set, one function start position per line.
+  std::ofstream sink(file, std::ofstream::trunc);
+  for (int position : produced_compile_hints_) {
+    sink << position << std::endl;
+  }
+}
+
 void Shell::OnExit(v8::Isolate* isolate, bool dispose) {
   platform::NotifyIsolateShutdown(g_default_platform, isolate);
 
@@ -4472,6 +4575,128 @@ void SerializationDataQueue::Clear() {
   data_.clear();
 }
 
+base::LazyMutex Worker::pooled_threads_mutex_;
+std::vector<Worker::PooledThread*> Worker::pooled_threads_;
+std::vector<Worker::PooledThread*> Worker::idle_pooled_threads_;
+bool Worker::pool_shutting_down_ = false;
+
+// A worker thread used with --worker-pool. It creates its isolate once and
+// keeps it alive while parked between Worker instances, so starting a worker
+// only pays for a fresh context rather than full isolate setup and teardown.
+class Worker::PooledThread : public base::Thread {
+ public:
+  // Hands {worker} to an idle pooled thread, or starts a new one if all
+  // pooled threads are busy. Returns false if a new thread was needed but
+  // could not be started. The worker must already be in
+  // State::kPrepareRunning.
+  static bool AssignWorker(std::shared_ptr<Worker> worker,
+                           base::Thread::Priority priority);
+
+  void Run() override;
+
+ private:
+  PooledThread(std::shared_ptr<Worker> worker, base::Thread::Priority priority)
+      : base::Thread(base::Thread::Options("PooledWorkerThread", priority)),
+        next_worker_(std::move(worker)) {}
+
+  // Parks this thread until the next worker is assigned. Returns nullptr
+  // when the pool is shutting down. {isolate} is this thread's isolate; the
+  // thread parks it so that it cannot stall shared GCs while idle.
+  std::shared_ptr<Worker> WaitForNextWorker(Isolate* isolate);
+
+  std::shared_ptr<Worker> next_worker_;  // Guarded by pooled_threads_mutex_.
+  i::ParkingSemaphore next_worker_semaphore_{0};
+
+  friend class Worker;
+};
+
+// static
+bool Worker::PooledThread::AssignWorker(std::shared_ptr<Worker> worker,
+                                        base::Thread::Priority priority) {
+  {
+    base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+    DCHECK(!pool_shutting_down_);
+    if (!idle_pooled_threads_.empty()) {
+      PooledThread* thread = idle_pooled_threads_.back();
+      idle_pooled_threads_.pop_back();
+      DCHECK(!thread->next_worker_);
+      // A recycled thread keeps the priority it was started with.
+      thread->next_worker_ = std::move(worker);
+      thread->next_worker_semaphore_.Signal();
+      return true;
+    }
+  }
+  auto thread = new PooledThread(std::move(worker), priority);
+  if (!thread->Start()) {
+    delete thread;
+    return false;
+  }
+  base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+  pooled_threads_.push_back(thread);
+  return true;
+}
+
+std::shared_ptr<Worker> Worker::PooledThread::WaitForNextWorker(
+    Isolate* isolate) {
+  {
+    base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+    if (pool_shutting_down_) return nullptr;
+    DCHECK(!next_worker_);
+    idle_pooled_threads_.push_back(this);
+  }
+  next_worker_semaphore_.ParkedWait(
+      reinterpret_cast<i::Isolate*>(isolate)->main_thread_local_isolate());
+  base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+  // Waking up without a worker assigned means the pool is shutting down.
+  return std::move(next_worker_);
+}
+
+void Worker::PooledThread::Run() {
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+  Isolate* isolate = Isolate::New(create_params);
+  {
+    Isolate::Scope isolate_scope(isolate);
+    D8Console console(isolate);
+    Shell::Initialize(isolate, &console, false);
+    PerIsolateData data(isolate);
+    std::shared_ptr<Worker> worker = std::move(next_worker_);
+    while (worker) {
+      worker->ExecuteOnIsolate(isolate);
+      Shell::RemoveRunningWorker(worker);
+      // Clear any termination that Worker::Terminate scheduled but the event
+      // loop never got to; each worker still got a fresh context created from
+      // the snapshot, so the isolate can be reused as-is.
+      isolate->CancelTerminateExecution();
+      worker->finished_semaphore_.Signal();
+      worker.reset();
+      worker = WaitForNextWorker(isolate);
+    }
+  }
+  isolate->Dispose();
+}
+
+// static
+void Worker::ShutdownPooledThreads() {
+  std::vector<PooledThread*> threads;
+  {
+    base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+    if (pooled_threads_.empty()) return;
+    pool_shutting_down_ = true;
+    for (PooledThread* thread : idle_pooled_threads_) {
+      thread->next_worker_semaphore_.Signal();
+    }
+    idle_pooled_threads_.clear();
+    threads.swap(pooled_threads_);
+  }
+  for (PooledThread* thread : threads) {
+    thread->Join();
+    delete thread;
+  }
+  base::MutexGuard lock_guard(pooled_threads_mutex_.Pointer());
+  pool_shutting_down_ = false;
+}
+
 Worker::Worker(const char* script) : script_(i::StrDup(script)) {
   state_.store(State::kReady);
 }
@@ -4493,9 +4718,13 @@ bool Worker::StartWorkerThread(Isolate* requester,
   auto expected = State::kReady;
   CHECK(
       worker->state_.compare_exchange_strong(expected, State::kPrepareRunning));
-  auto thread = new WorkerThread(worker, priority);
-  worker->thread_ = thread;
-  if (!thread->Start()) return false;
+  if (Shell::options.enable_worker_pool) {
+    if (!PooledThread::AssignWorker(worker, priority)) return false;
+  } else {
+    auto thread = new WorkerThread(worker, priority);
+    worker->thread_ = thread;
+    if (!thread->Start()) return false;
+  }
   // Wait until the worker is ready to receive messages.
   worker->started_semaphore_.ParkedWait(
       reinterpret_cast<i::Isolate*>(requester)->main_thread_local_isolate());
@@ -4547,8 +4776,13 @@ class TerminateTask : public i::CancelableTask {
 
   void RunInternal() override {
     auto expected = Worker::State::kTerminating;
-    CHECK(worker_->state_.compare_exchange_strong(expected,
-                                                  Worker::State::kTerminated));
+    if (!worker_->state_.compare_exchange_strong(expected,
+                                                 Worker::State::kTerminated)) {
+      // The worker may have finished on its own before this task ran; with
+      // --worker-pool its task runner survives into the next worker's run,
+      // so the task can still be executed afterwards.
+      CHECK_EQ(expected, Worker::State::kTerminated);
+    }
   }
 
  private:
@@ -4576,7 +4810,13 @@ void Worker::TerminateAndWaitForThread(const i::ParkedScope& parked) {
     if (is_joined_) return;
     is_joined_ = true;
   }
-  thread_->Join();
+  if (thread_) {
+    thread_->Join();
+  } else {
+    // Pooled workers have no dedicated thread to join; wait for the pooled
+    // thread to finish running this worker instead.
+    finished_semaphore_.ParkedWait(parked);
+  }
 }
 
 void Worker::Terminate() {
@@ -4646,13 +4886,32 @@ void Worker::SetCurrentWorker(Worker* worker) {
   current_worker_ = worker;
 }
 
+// static
+void Worker::ClearCurrentWorker() {
+  CHECK_NOT_NULL(current_worker_);
+  current_worker_ = nullptr;
+}
+
 // static
 Worker* Worker::GetCurrentWorker() { return current_worker_; }
 
 void Worker::ExecuteInThread() {
   Isolate::CreateParams create_params;
   create_params.array_buffer_allocator = Shell::array_buffer_allocator;
-  isolate_ = Isolate::New(create_params);
+  Isolate* isolate = Isolate::New(create_params);
+  {
+    Isolate::Scope isolate_scope(isolate);
+    D8Console console(isolate);
+    Shell::Initialize(isolate, &console, false);
+    PerIsolateData data(isolate);
+    ExecuteOnIsolate(isolate);
+    platform::NotifyIsolateShutdown(g_default_platform, isolate);
+  }
+  isolate->Dispose();
+}
+
+void Worker::ExecuteOnIsolate(Isolate* isolate) {
+  isolate_ = isolate;
 
   // Make the Worker instance available to the whole thread.
   SetCurrentWorker(this);
@@ -4667,77 +4926,70 @@ void Worker::ExecuteInThread() {
   // The Worker is now ready to receive messages.
   started_semaphore_.Signal();
 
-  {
-    Isolate::Scope isolate_scope(isolate_);
-    D8Console console(isolate_);
-    Shell::Initialize(isolate_, &console, false);
-    PerIsolateData data(isolate_);
-    // This is not really a loop, but the loop allows us to break out of this
-    // block easily.
-    for (bool execute = true; execute; execute = false) {
+  // This is not really a loop, but the loop allows us to break out of this
+  // block easily.
+  for (bool execute = true; execute; execute = false) {
+    {
+      HandleScope scope(isolate_);
+      Local<Context> context;
+      if (!Shell::CreateEvaluationContext(isolate_).ToLocal(&context)) {
+        DCHECK(isolate_->IsExecutionTerminating());
+        break;
+      }
+      context_.Reset(isolate_, context);
       {
-        HandleScope scope(isolate_);
-        Local<Context> context;
-        if (!Shell::CreateEvaluationContext(isolate_).ToLocal(&context)) {
-          DCHECK(isolate_->IsExecutionTerminating());
-          break;
+        Context::Scope context_scope(context);
+        PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate_));
+
+        Local<Object> global = context->Global();
+        Local<Value> this_value = External::New(isolate_, this);
+        Local<FunctionTemplate> postmessage_fun_template =
+            FunctionTemplate::New(isolate_, PostMessageOut, this_value);
+
+        Local<Function> postmessage_fun;
+        if (postmessage_fun_template->GetFunction(context).ToLocal(
+                &postmessage_fun)) {
+          global
+              ->Set(
+                  context,
+                  v8::String::NewFromUtf8Literal(
+                      isolate_, "postMessage", NewStringType::kInternalized),
+                  postmessage_fun)
+              .FromJust();
         }
-        context_.Reset(isolate_, context);
-        {
-          Context::Scope context_scope(context);
-          PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate_));
-
-          Local<Object> global = context->Global();
-          Local<Value> this_value = External::New(isolate_, this);
-          Local<FunctionTemplate> postmessage_fun_template =
-              FunctionTemplate::New(isolate_, PostMessageOut, this_value);
-
-          Local<Function> postmessage_fun;
-          if (postmessage_fun_template->GetFunction(context).ToLocal(
-                  &postmessage_fun)) {
-            global
-                ->Set(
-                    context,
-                    v8::String::NewFromUtf8Literal(
-                        isolate_, "postMessage", NewStringType::kInternalized),
-                    postmessage_fun)
-                .FromJust();
-          }
 
-          // First run the script
-          Local<String> file_name =
-              String::NewFromUtf8Literal(isolate_, "unnamed");
-          Local<String> source =
-              String::NewFromUtf8(isolate_, script_).ToLocalChecked();
-          if (Shell::ExecuteString(
-                  isolate_, source, file_name, Shell::kNoPrintResult,
-                  Shell::kReportExceptions, Shell::kProcessMessageQueue)) {
-            // Check that there's a message handler
-            MaybeLocal<Value> maybe_onmessage = global->Get(
-                context,
-                String::NewFromUtf8Literal(isolate_, "onmessage",
-                                           NewStringType::kInternalized));
-            Local<Value> onmessage;
-            if (maybe_onmessage.ToLocal(&onmessage) &&
-                onmessage->IsFunction()) {
-              // Now wait for messages.
-              ProcessMessages();
-            }
+        // First run the script
+        Local<String> file_name =
+            String::NewFromUtf8Literal(isolate_, "unnamed");
+        Local<String> source =
+            String::NewFromUtf8(isolate_, script_).ToLocalChecked();
+        if (Shell::ExecuteString(
+                isolate_, source, file_name, Shell::kNoPrintResult,
+                Shell::kReportExceptions, Shell::kProcessMessageQueue)) {
+          // Check that there's a message handler
+          MaybeLocal<Value> maybe_onmessage = global->Get(
+              context,
+              String::NewFromUtf8Literal(isolate_, "onmessage",
+                                         NewStringType::kInternalized));
+          Local<Value> onmessage;
+          if (maybe_onmessage.ToLocal(&onmessage) &&
+              onmessage->IsFunction()) {
+            // Now wait for messages.
+            ProcessMessages();
           }
         }
       }
-      Shell::CollectGarbage(isolate_);
     }
+    Shell::CollectGarbage(isolate_);
+  }
 
-    EnterTerminatedState();
+  EnterTerminatedState();
 
-    Shell::ResetOnProfileEndListener(isolate_);
-    context_.Reset();
-    platform::NotifyIsolateShutdown(g_default_platform, isolate_);
-  }
+  Shell::ResetOnProfileEndListener(isolate_);
+  context_.Reset();
 
-  isolate_->Dispose();
   isolate_ = nullptr;
+  ClearCurrentWorker();
 
   // Post nullptr to wake the thread waiting on GetMessage() if there is one.
   out_queue_.Enqueue(nullptr);
@@ -4925,6 +5177,10 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--enable-tracing") == 0) {
       options.trace_enabled = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--streaming-trace-buffer") == 0) {
+      options.streaming_trace_buffer = true;
+      options.trace_enabled = true;
+      argv[i] = nullptr;
     } else if (strncmp(argv[i], "--trace-path=", 13) == 0) {
       options.trace_path = argv[i] + 13;
       argv[i] = nullptr;
@@ -4937,6 +5193,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--lcov=", 7) == 0) {
       options.lcov_file = argv[i] + 7;
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--produce-compile-hints=", 24) == 0) {
+      options.produce_compile_hints_file = argv[i] + 24;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--consume-compile-hints=", 24) == 0) {
+      options.consume_compile_hints_file = argv[i] + 24;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--disable-in-process-stack-traces") == 0) {
       options.disable_in_process_stack_traces = true;
       argv[i] = nullptr;
@@ -4951,6 +5213,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--no-apply-priority") == 0) {
       options.apply_priority = false;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--worker-pool") == 0) {
+      options.enable_worker_pool = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--quiet-load") == 0) {
       options.quiet_load = true;
       argv[i] = nullptr;
@@ -4977,10 +5242,19 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat-compile=", 17) == 0) {
       options.repeat_compile = atoi(argv[i] + 17);
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      options.bench = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-runs=", 13) == 0) {
+      options.bench_runs = atoi(argv[i] + 13);
+      argv[i] = nullptr;
     } else if (strncmp(argv[i], "--max-serializer-memory=", 24) == 0) {
       // Value is expressed in MB.
       options.max_serializer_memory = atoi(argv[i] + 24) * i::MB;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--serialize-array-buffers-out-of-band") == 0) {
+      options.serialize_array_buffers_out_of_band = true;
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = true;
@@ -5093,6 +5367,16 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     V8::SetFlagsFromString("--no-logfile-per-isolate");
   }
 
+  if (options.consume_compile_hints_file) {
+    // Load the sidecar produced by an earlier --produce-compile-hints run.
+    std::ifstream stream(options.consume_compile_hints_file);
+    int position;
+    while (stream >> position) {
+      consumed_compile_hints_.push_back(position);
+    }
+    std::sort(consumed_compile_hints_.begin(), consumed_compile_hints_.end());
+  }
+
   return true;
 }
 
@@ -5192,11 +5476,216 @@ bool Shell::RunMainIsolate(v8::Isolate* isolate, bool keep_context_alive) {
     PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
     if (!options.isolate_sources[0].Execute(isolate)) success = false;
     if (!CompleteMessageLoop(isolate)) success = false;
+    if (success && options.bench) {
+      if (!RunBenchmarks(isolate, context)) success = false;
+    }
   }
   WriteLcovData(isolate, options.lcov_file);
+  WriteCompileHints(options.produce_compile_hints_file);
   return success;
 }
 
+namespace {
+
+#ifdef V8_OS_LINUX
+// Counts retired instructions and cache misses across a benchmark's measured
+// runs via perf_event_open(2). Collection is best-effort: if the kernel
+// refuses the events (e.g. because of perf_event_paranoid), the JSON output
+// simply omits the counter fields.
+class BenchPerfCounters {
+ public:
+  BenchPerfCounters() {
+    instructions_fd_ = OpenCounter(PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if (instructions_fd_ < 0) return;
+    cache_misses_fd_ =
+        OpenCounter(PERF_COUNT_HW_CACHE_MISSES, instructions_fd_);
+  }
+  ~BenchPerfCounters() {
+    if (cache_misses_fd_ >= 0) close(cache_misses_fd_);
+    if (instructions_fd_ >= 0) close(instructions_fd_);
+  }
+  BenchPerfCounters(const BenchPerfCounters&) = delete;
+  BenchPerfCounters& operator=(const BenchPerfCounters&) = delete;
+
+  bool available() const { return instructions_fd_ >= 0; }
+
+  void Start() {
+    ioctl(instructions_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(instructions_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+  void Stop() {
+    ioctl(instructions_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    instructions_ = ReadCounter(instructions_fd_);
+    cache_misses_ = cache_misses_fd_ >= 0 ? ReadCounter(cache_misses_fd_) : 0;
+  }
+
+  uint64_t instructions() const { return instructions_; }
+  uint64_t cache_misses() const { return cache_misses_; }
+
+ private:
+  static int OpenCounter(uint64_t config, int group_fd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+
+  static uint64_t ReadCounter(int fd) {
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != sizeof(value)) return 0;
+    return value;
+  }
+
+  int instructions_fd_ = -1;
+  int cache_misses_fd_ = -1;
+  uint64_t instructions_ = 0;
+  uint64_t cache_misses_ = 0;
+};
+#endif  // V8_OS_LINUX
+
+struct BenchStats {
+  size_t samples = 0;
+  size_t rejected = 0;
+  double mean_ms = 0;
+  double stddev_ms = 0;
+  double ci95_ms = 0;
+  double min_ms = 0;
+  double max_ms = 0;
+};
+
+// Rejects outliers beyond 1.5 IQR from the quartiles, then reports the mean
+// with its 95% confidence interval over the remaining samples.
+BenchStats ComputeBenchStats(std::vector<double> samples_ms) {
+  BenchStats stats;
+  std::sort(samples_ms.begin(), samples_ms.end());
+  auto quartile = [&samples_ms](double q) {
+    const double index = q * static_cast<double>(samples_ms.size() - 1);
+    const size_t lo = static_cast<size_t>(index);
+    const size_t hi = std::min(lo + 1, samples_ms.size() - 1);
+    return samples_ms[lo] + (index - static_cast<double>(lo)) *
+                                (samples_ms[hi] - samples_ms[lo]);
+  };
+  const double iqr = quartile(0.75) - quartile(0.25);
+  const double lower_bound = quartile(0.25) - 1.5 * iqr;
+  const double upper_bound = quartile(0.75) + 1.5 * iqr;
+  std::vector<double> kept;
+  for (double sample : samples_ms) {
+    if (sample < lower_bound || sample > upper_bound) continue;
+    kept.push_back(sample);
+  }
+  stats.samples = kept.size();
+  stats.rejected = samples_ms.size() - kept.size();
+  stats.min_ms = kept.front();
+  stats.max_ms = kept.back();
+  for (double sample : kept) stats.mean_ms += sample;
+  stats.mean_ms /= static_cast<double>(kept.size());
+  if (kept.size() > 1) {
+    double sum_of_squares = 0;
+    for (double sample : kept) {
+      sum_of_squares += (sample - stats.mean_ms) * (sample - stats.mean_ms);
+    }
+    stats.stddev_ms =
+        std::sqrt(sum_of_squares / static_cast<double>(kept.size() - 1));
+    stats.ci95_ms =
+        1.96 * stats.stddev_ms / std::sqrt(static_cast<double>(kept.size()));
+  }
+  return stats;
+}
+
+}  // namespace
+
+bool Shell::RunBenchmarks(Isolate* isolate, Local<Context> context) {
+  constexpr int kMinWarmupRuns = 5;
+  constexpr int kMaxWarmupRuns = 50;
+  HandleScope handle_scope(isolate);
+  Local<Object> global = context->Global();
+  Local<Array> property_names;
+  if (!global->GetOwnPropertyNames(context).ToLocal(&property_names)) {
+    return false;
+  }
+  std::ostringstream json;
+  json << "{\"benchmarks\":[";
+  bool first = true;
+  for (uint32_t i = 0; i < property_names->Length(); i++) {
+    Local<Value> name_value;
+    if (!property_names->Get(context, i).ToLocal(&name_value)) return false;
+    if (!name_value->IsString()) continue;
+    String::Utf8Value name(isolate, name_value);
+    if (strncmp(*name, "benchmark", 9) != 0) continue;
+    Local<Value> function_value;
+    if (!global->Get(context, name_value).ToLocal(&function_value)) {
+      return false;
+    }
+    if (!function_value->IsFunction()) continue;
+    Local<Function> function = function_value.As<Function>();
+    TryCatch try_catch(isolate);
+    // Warm up until the running mean stabilizes so that tiering has reached a
+    // steady state before we start measuring.
+    double warmup_total_ms = 0;
+    double previous_mean_ms = 0;
+    for (int run = 0; run < kMaxWarmupRuns; run++) {
+      base::TimeTicks start = base::TimeTicks::Now();
+      if (function->Call(context, Undefined(isolate), 0, nullptr).IsEmpty()) {
+        ReportException(isolate, try_catch);
+        return false;
+      }
+      warmup_total_ms += (base::TimeTicks::Now() - start).InMillisecondsF();
+      const double mean_ms = warmup_total_ms / (run + 1);
+      if (run >= kMinWarmupRuns &&
+          std::fabs(mean_ms - previous_mean_ms) < 0.02 * mean_ms) {
+        break;
+      }
+      previous_mean_ms = mean_ms;
+    }
+    const int bench_runs = std::max(2, options.bench_runs.get());
+    std::vector<double> samples_ms;
+    samples_ms.reserve(bench_runs);
+#ifdef V8_OS_LINUX
+    BenchPerfCounters counters;
+    if (counters.available()) counters.Start();
+#endif  // V8_OS_LINUX
+    for (int run = 0; run < bench_runs; run++) {
+      base::TimeTicks start = base::TimeTicks::Now();
+      if (function->Call(context, Undefined(isolate), 0, nullptr).IsEmpty()) {
+        ReportException(isolate, try_catch);
+        return false;
+      }
+      samples_ms.push_back((base::TimeTicks::Now() - start).InMillisecondsF());
+    }
+    BenchStats stats = ComputeBenchStats(std::move(samples_ms));
+    if (!first) json << ",";
+    first = false;
+    json << "{\"name\":\"" << *name << "\",\"samples\":" << stats.samples
+         << ",\"rejected\":" << stats.rejected
+         << ",\"mean_ms\":" << stats.mean_ms
+         << ",\"stddev_ms\":" << stats.stddev_ms
+         << ",\"ci95_ms\":" << stats.ci95_ms << ",\"min_ms\":" << stats.min_ms
+         << ",\"max_ms\":" << stats.max_ms;
+#ifdef V8_OS_LINUX
+    if (counters.available()) {
+      counters.Stop();
+      // Per-run averages over the measured (pre-rejection) runs; the counters
+      // cover the whole measured region, so attribute them evenly.
+      json << ",\"instructions_per_run\":"
+           << counters.instructions() / bench_runs
+           << ",\"cache_misses_per_run\":"
+           << counters.cache_misses() / bench_runs;
+    }
+#endif  // V8_OS_LINUX
+    json << "}";
+  }
+  json << "]}";
+  printf("%s\n", json.str().c_str());
+  return true;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     isolate->ContextDisposedNotification();
@@ -5333,7 +5822,11 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    if (Shell::options.serialize_array_buffers_out_of_band) {
+      serializer_.SetTreatArrayBuffersAsOutOfBand(true);
+    }
+  }
 
   Serializer(const Serializer&) = delete;
   Serializer& operator=(const Serializer&) = delete;
@@ -5393,6 +5886,25 @@ class Serializer : public ValueSerializer::Delegate {
     return Just<uint32_t>(static_cast<uint32_t>(index));
   }
 
+  Maybe<uint32_t> GetOutOfBandArrayBufferId(
+      Isolate* isolate, Local<ArrayBuffer> array_buffer) override {
+    DCHECK_NOT_NULL(data_);
+    for (size_t index = 0; index < out_of_band_array_buffers_.size();
+         ++index) {
+      if (out_of_band_array_buffers_[index] == array_buffer) {
+        return Just<uint32_t>(
+            static_cast<uint32_t>(array_buffers_.size() + index));
+      }
+    }
+
+    // Out-of-band buffers share the id space with the transfer list, whose
+    // entries received ids 0..n-1 in {PrepareTransfer}.
+    size_t index = array_buffers_.size() + out_of_band_array_buffers_.size();
+    out_of_band_array_buffers_.emplace_back(isolate_, array_buffer);
+    out_of_band_backing_stores_.push_back(array_buffer->GetBackingStore());
+    return Just<uint32_t>(static_cast<uint32_t>(index));
+  }
+
   Maybe<uint32_t> GetWasmModuleTransferId(
       Isolate* isolate, Local<WasmModuleObject> module) override {
     DCHECK_NOT_NULL(data_);
@@ -5486,6 +5998,15 @@ class Serializer : public ValueSerializer::Delegate {
       }
     }
 
+    // Out-of-band buffers are conveyed through the same backing store list as
+    // transferred buffers, after them so that the list order matches the ids
+    // handed out in {GetOutOfBandArrayBufferId}. In contrast to transferred
+    // buffers they are shared with the receiving isolate, not detached.
+    for (auto& backing_store : out_of_band_backing_stores_) {
+      data_->backing_stores_.push_back(std::move(backing_store));
+    }
+    out_of_band_backing_stores_.clear();
+
     return Just(true);
   }
 
@@ -5494,6 +6015,8 @@ class Serializer : public ValueSerializer::Delegate {
   ValueSerializer serializer_;
   std::unique_ptr<SerializationData> data_;
   std::vector<Global<ArrayBuffer>> array_buffers_;
+  std::vector<Global<ArrayBuffer>> out_of_band_array_buffers_;
+  std::vector<std::shared_ptr<v8::BackingStore>> out_of_band_backing_stores_;
   std::vector<Global<SharedArrayBuffer>> shared_array_buffers_;
   std::vector<Global<WasmModuleObject>> wasm_modules_;
   std::vector<std::shared_ptr<v8::BackingStore>> backing_stores_;
@@ -5632,6 +6155,10 @@ void Shell::WaitForRunningWorkers(const i::ParkedScope& parked) {
     worker->TerminateAndWaitForThread(parked);
   }
 
+  // Pooled threads keep their isolates alive between workers; stop them too
+  // now that no worker can be running.
+  Worker::ShutdownPooledThreads();
+
   // Now that all workers are terminated, we can re-enable Worker creation.
   base::MutexGuard lock_guard(workers_mutex_.Pointer());
   DCHECK(running_workers_.empty());
@@ -5732,6 +6259,13 @@ int Shell::Main(int argc, char* argv[]) {
                   CreateSystemInstrumentationTraceWriter());
     }
 #endif  // V8_ENABLE_SYSTEM_INSTRUMENTATION
+    if (!trace_buffer && options.streaming_trace_buffer) {
+      trace_buffer =
+          platform::tracing::TraceBuffer::CreateTraceBufferStreamingBuffer(
+              platform::tracing::TraceBuffer::kRingBufferChunks,
+              platform::tracing::TraceWriter::CreateJSONTraceWriter(
+                  trace_file));
+    }
     if (!trace_buffer) {
       trace_buffer =
           platform::tracing::TraceBuffer::CreateTraceBufferRingBuffer(
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <queue>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -210,6 +211,10 @@ class Worker : public std::enable_shared_from_this<Worker> {
                                 std::shared_ptr<Worker> worker,
                                 base::Thread::Priority priority);
 
+  // Stop and join all pooled worker threads, disposing their isolates. Only
+  // relevant with --worker-pool; a no-op when the pool is empty.
+  static void ShutdownPooledThreads();
+
   // Enters State::kTerminated for the Worker and resets the task runner.
   void EnterTerminatedState();
 
@@ -245,10 +250,19 @@ class Worker : public std::enable_shared_from_this<Worker> {
     std::shared_ptr<Worker> worker_;
   };
 
+  // A thread that keeps its isolate alive while parked between Worker
+  // instances, used with --worker-pool. Defined in d8.cc.
+  class PooledThread;
+
   void ExecuteInThread();
+  // The per-worker part of ExecuteInThread: runs the script and the message
+  // loop on an isolate that has already been set up via Shell::Initialize.
+  // Pooled threads call this with a recycled isolate.
+  void ExecuteOnIsolate(Isolate* isolate);
   static void PostMessageOut(const v8::FunctionCallbackInfo<v8::Value>& info);
 
   static void SetCurrentWorker(Worker* worker);
+  static void ClearCurrentWorker();
 
   i::ParkingSemaphore out_semaphore_{0};
   SerializationDataQueue out_queue_;
@@ -258,6 +272,9 @@ class Worker : public std::enable_shared_from_this<Worker> {
   bool is_joined_ = false;
   // For signalling that the worker has started.
   i::ParkingSemaphore started_semaphore_{0};
+  // For signalling that a pooled thread has finished running this worker.
+  // Only used with --worker-pool, where there is no dedicated thread to join.
+  i::ParkingSemaphore finished_semaphore_{0};
 
   // For posting tasks to the worker
   std::shared_ptr<TaskRunner> task_runner_;
@@ -273,6 +290,13 @@ class Worker : public std::enable_shared_from_this<Worker> {
 
   // Only accessed by the worker thread.
   v8::Persistent<v8::Context> context_;
+
+  // State for --worker-pool: threads that keep their isolate alive while
+  // parked between Worker instances.
+  static base::LazyMutex pooled_threads_mutex_;  // Guards the members below.
+  static std::vector<PooledThread*> pooled_threads_;
+  static std::vector<PooledThread*> idle_pooled_threads_;
+  static bool pool_shutting_down_;
 };
 
 class PerIsolateData {
@@ -450,15 +474,22 @@ class ShellOptions {
   DisallowReassignment<const char*> icu_locale = {"icu-locale", nullptr};
   DisallowReassignment<const char*> snapshot_blob = {"snapshot_blob", nullptr};
   DisallowReassignment<bool> trace_enabled = {"trace-enabled", false};
+  DisallowReassignment<bool> streaming_trace_buffer = {"streaming-trace-buffer",
+                                                       false};
   DisallowReassignment<const char*> trace_path = {"trace-path", nullptr};
   DisallowReassignment<const char*> trace_config = {"trace-config", nullptr};
   DisallowReassignment<const char*> lcov_file = {"lcov", nullptr};
+  DisallowReassignment<const char*> produce_compile_hints_file = {
+      "produce-compile-hints", nullptr};
+  DisallowReassignment<const char*> consume_compile_hints_file = {
+      "consume-compile-hints", nullptr};
   DisallowReassignment<bool> disable_in_process_stack_traces = {
       "disable-in-process-stack-traces", false};
   DisallowReassignment<int> read_from_tcp_port = {"read-from-tcp-port", -1};
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<bool> apply_priority = {"apply-priority", true};
+  DisallowReassignment<bool> enable_worker_pool = {"worker-pool", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
@@ -475,6 +506,8 @@ class ShellOptions {
   DisallowReassignment<bool> stress_deserialize = {"stress-deserialize", false};
   DisallowReassignment<bool> compile_only = {"compile-only", false};
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
+  DisallowReassignment<bool> bench = {"bench", false};
+  DisallowReassignment<int> bench_runs = {"bench-runs", 30};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -485,6 +518,8 @@ class ShellOptions {
 #endif  // V8_ENABLE_SANDBOX
   DisallowReassignment<size_t> max_serializer_memory = {"max-serializer-memory",
                                                         1 * i::MB};
+  DisallowReassignment<bool> serialize_array_buffers_out_of_band = {
+      "serialize-array-buffers-out-of-band", false};
 };
 
 class Shell : public i::AllStatic {
@@ -762,10 +797,15 @@ class Shell : public i::AllStatic {
   static void WriteIgnitionDispatchCountersFile(v8::Isolate* isolate);
   // Append LCOV coverage data to file.
   static void WriteLcovData(v8::Isolate* isolate, const char* file);
+  // Write the compile-hints sidecar collected via --produce-compile-hints.
+  static void WriteCompileHints(const char* file);
   static Counter* GetCounter(const char* name, bool is_histogram);
   static Local<String> Stringify(Isolate* isolate, Local<Value> value);
   static void RunShell(Isolate* isolate);
   static bool RunMainIsolate(Isolate* isolate, bool keep_context_alive);
+  // Run all global functions whose names start with "benchmark" and print
+  // timing statistics as JSON; used by --bench.
+  static bool RunBenchmarks(Isolate* isolate, Local<Context> context);
   static bool SetOptions(int argc, char* argv[]);
 
   static void NodeTypeCallback(const v8::FunctionCallbackInfo<v8::Value>& info);
@@ -816,6 +856,13 @@ class Shell : public i::AllStatic {
   static base::LazyMutex cached_code_mutex_;
   static std::map<std::string, std::unique_ptr<ScriptCompiler::CachedData>>
       cached_code_map_;
+
+  // Function start positions collected with --produce-compile-hints, and the
+  // positions loaded from the sidecar given to --consume-compile-hints. The
+  // consumed positions are sorted and read-only after option parsing.
+  static base::LazyMutex produced_compile_hints_mutex_;
+  static std::set<int> produced_compile_hints_;
+  static std::vector<int> consumed_compile_hints_;
   static std::atomic<int> unhandled_promise_rejections_;
 };
 
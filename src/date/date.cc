@@ -4,6 +4,9 @@
 
 #include "src/date/date.h"
 
+#include <algorithm>
+
+#include "src/base/lazy-instance.h"
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -25,6 +28,43 @@ static const int kYearsOffset = 400000;
 static const char kDaysInMonths[] = {31, 28, 31, 30, 31, 30,
                                      31, 31, 30, 31, 30, 31};
 
+SharedLocalTimeOffsetCache* SharedLocalTimeOffsetCache::Get() {
+  static base::LazyInstance<SharedLocalTimeOffsetCache>::type instance =
+      LAZY_INSTANCE_INITIALIZER;
+  return instance.Pointer();
+}
+
+std::shared_ptr<const SharedLocalTimeOffsetCache::Snapshot>
+SharedLocalTimeOffsetCache::Acquire() {
+  base::MutexGuard guard(&mutex_);
+  return snapshot_;
+}
+
+void SharedLocalTimeOffsetCache::Publish(uint32_t version,
+                                         const Segment& segment) {
+  base::MutexGuard guard(&mutex_);
+  // The time zone changed after the segment was computed; drop it.
+  if (version != version_.load(std::memory_order_relaxed)) return;
+  auto snapshot = std::make_shared<Snapshot>(*snapshot_);
+  if (snapshot->size() >= kMaxSegments) snapshot->clear();
+  auto it = std::lower_bound(snapshot->begin(), snapshot->end(), segment,
+                             [](const Segment& a, const Segment& b) {
+                               return a.start_ms < b.start_ms;
+                             });
+  // Another isolate may have published the same segment concurrently.
+  if (it != snapshot->end() && it->start_ms == segment.start_ms) return;
+  snapshot->insert(it, segment);
+  snapshot_ = std::move(snapshot);
+  sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void SharedLocalTimeOffsetCache::Invalidate() {
+  base::MutexGuard guard(&mutex_);
+  snapshot_ = std::make_shared<Snapshot>();
+  version_.fetch_add(1, std::memory_order_release);
+  sequence_.fetch_add(1, std::memory_order_release);
+}
+
 DateCache::DateCache()
     : stamp_(kNullAddress),
       tz_cache_(
@@ -62,6 +102,9 @@ void DateCache::ResetDateCache(
   tz_cache_->Clear(time_zone_detection);
   tz_name_ = nullptr;
   dst_tz_name_ = nullptr;
+  // Drop our snapshot of the shared offset cache; the next lookup
+  // re-acquires a current one.
+  shared_snapshot_.reset();
 }
 
 // ECMA 262 - ES#sec-timeclip TimeClip (time)
@@ -212,10 +255,59 @@ void DateCache::BreakDownTime(int64_t time_ms, int* year, int* month, int* day,
 
 // Implements LocalTimeZonedjustment(t, isUTC)
 // ECMA 262 - ES#sec-local-time-zone-adjustment
+bool DateCache::LookupSharedOffset(int64_t time_ms, int* offset_ms) {
+  SharedLocalTimeOffsetCache* shared = SharedLocalTimeOffsetCache::Get();
+  uint32_t sequence = shared->sequence();
+  if (sequence != shared_sequence_ || !shared_snapshot_) {
+    shared_snapshot_ = shared->Acquire();
+    shared_sequence_ = sequence;
+  }
+  const SharedLocalTimeOffsetCache::Snapshot& segments = *shared_snapshot_;
+  auto it = std::upper_bound(
+      segments.begin(), segments.end(), time_ms,
+      [](int64_t time, const SharedLocalTimeOffsetCache::Segment& segment) {
+        return time < segment.start_ms;
+      });
+  if (it == segments.begin()) return false;
+  --it;
+  if (time_ms >= it->end_ms) return false;
+  *offset_ms = it->offset_ms;
+  return true;
+}
+
+// Segment bounds come in as doubles, with sentinels beyond the int64 range
+// when there is no transition on one side.
+static int64_t ClampTimeToInt64(double time_ms) {
+  constexpr double kLimit =
+      static_cast<double>(std::numeric_limits<int64_t>::max() / 2);
+  if (time_ms <= -kLimit) return std::numeric_limits<int64_t>::min() / 2;
+  if (time_ms >= kLimit) return std::numeric_limits<int64_t>::max() / 2;
+  return static_cast<int64_t>(time_ms);
+}
+
 int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   double offset;
 #ifdef V8_INTL_SUPPORT
   if (v8_flags.icu_timezone_data) {
+    if (is_utc) {
+      // UTC-to-local offsets are identical in every isolate, so serve them
+      // from the process-wide segment cache when possible. Local-to-UTC
+      // queries are ambiguous around transitions and stay on the per-point
+      // ICU path.
+      SharedLocalTimeOffsetCache* shared = SharedLocalTimeOffsetCache::Get();
+      uint32_t version = shared->version();
+      int shared_offset;
+      if (LookupSharedOffset(time_ms, &shared_offset)) return shared_offset;
+      double start_ms, end_ms;
+      if (tz_cache_->LocalTimeOffsetSegment(static_cast<double>(time_ms),
+                                            &start_ms, &end_ms,
+                                            &shared_offset)) {
+        shared->Publish(version,
+                        {ClampTimeToInt64(start_ms), ClampTimeToInt64(end_ms),
+                         shared_offset});
+        return shared_offset;
+      }
+    }
     offset = tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), is_utc);
   } else {
 #endif
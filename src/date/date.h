@@ -5,6 +5,11 @@
 #ifndef V8_DATE_DATE_H_
 #define V8_DATE_DATE_H_
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
 #include "src/base/small-vector.h"
 #include "src/base/timezone-cache.h"
 #include "src/common/globals.h"
@@ -13,6 +18,62 @@
 namespace v8 {
 namespace internal {
 
+// Process-wide cache of UTC-to-local time offset segments, shared by the
+// DateCaches of all isolates. The host time zone is process state, so every
+// isolate resolves identical offsets; without sharing, each isolate's
+// timezone cache repopulates the same ICU transition data. Readers work on
+// an immutable snapshot that is replaced wholesale when a segment is added
+// or the time zone changes, so lookups never take the lock once a DateCache
+// holds a current snapshot.
+class V8_EXPORT_PRIVATE SharedLocalTimeOffsetCache {
+ public:
+  // A run of UTC time [start_ms, end_ms) with a constant local time offset,
+  // bounded by time zone transitions.
+  struct Segment {
+    int64_t start_ms;
+    int64_t end_ms;
+    int offset_ms;
+  };
+  // Sorted by start_ms; segments never overlap since they all derive from
+  // the same transition data.
+  using Snapshot = std::vector<Segment>;
+
+  static SharedLocalTimeOffsetCache* Get();
+
+  // Invalidation epoch. Segments looked up under an older epoch must not be
+  // published; see Publish().
+  uint32_t version() const {
+    return version_.load(std::memory_order_acquire);
+  }
+
+  // Bumped on every snapshot replacement. DateCaches compare it against the
+  // value they cached alongside their snapshot to decide when to re-Acquire.
+  uint32_t sequence() const {
+    return sequence_.load(std::memory_order_acquire);
+  }
+
+  std::shared_ptr<const Snapshot> Acquire();
+
+  // Publishes a snapshot extended with {segment}. {version} is the epoch the
+  // segment was computed under; if the time zone changed in the meantime the
+  // stale segment is dropped.
+  void Publish(uint32_t version, const Segment& segment);
+
+  // Drops all segments and starts a new epoch. Called on
+  // DateTimeConfigurationChangeNotification.
+  void Invalidate();
+
+ private:
+  // Keep at most this many segments; pathological access patterns spread
+  // over many distinct eras reset the cache instead of growing it.
+  static const size_t kMaxSegments = 64;
+
+  base::Mutex mutex_;
+  std::shared_ptr<const Snapshot> snapshot_{std::make_shared<Snapshot>()};
+  std::atomic<uint32_t> version_{0};
+  std::atomic<uint32_t> sequence_{0};
+};
+
 class V8_EXPORT_PRIVATE DateCache {
  public:
   static const int kMsPerMin = 60 * 1000;
@@ -213,6 +274,10 @@ class V8_EXPORT_PRIVATE DateCache {
     return segment->start_sec > segment->end_sec;
   }
 
+  // Consults the process-wide offset segment cache, re-acquiring our
+  // snapshot of it when it has changed.
+  bool LookupSharedOffset(int64_t time_ms, int* offset_ms);
+
   Tagged<Smi> stamp_;
 
   // Daylight Saving Time cache.
@@ -234,6 +299,10 @@ class V8_EXPORT_PRIVATE DateCache {
   const char* tz_name_;
   const char* dst_tz_name_;
 
+  // This isolate's view of the process-wide offset segment cache.
+  std::shared_ptr<const SharedLocalTimeOffsetCache::Snapshot> shared_snapshot_;
+  uint32_t shared_sequence_ = 0;
+
   base::TimezoneCache* tz_cache_;
 };
 
@@ -446,6 +446,7 @@ bool BytecodeHasNoSideEffect(interpreter::Bytecode bytecode) {
     case Bytecode::kGetIterator:
     // Arithmetics.
     case Bytecode::kAdd:
+    case Bytecode::kLdarAdd:
     case Bytecode::kAddSmi:
     case Bytecode::kSub:
     case Bytecode::kSubSmi:
@@ -3067,6 +3067,21 @@ bool Debug::PerformSideEffectCheck(Handle<JSFunction> function,
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
   DCHECK_EQ(isolate_->debug_execution_mode(), DebugInfo::kSideEffects);
   DisallowJavascriptExecution no_js(isolate_);
+  // This hook runs on every call while side-effect checking is active, so
+  // repeated calls to functions that have already been classified as
+  // side-effect free (the common case in eager REPL previews) should be as
+  // cheap as possible. Such functions need no debug bytecode and no further
+  // preparation; consult the cached classification without creating handles.
+  {
+    base::Optional<Tagged<DebugInfo>> debug_info =
+        TryGetDebugInfo(function->shared());
+    if (debug_info.has_value() &&
+        debug_info.value()->side_effect_state() ==
+            DebugInfo::kHasNoSideEffect &&
+        function->is_compiled(isolate_)) {
+      return true;
+    }
+  }
   IsCompiledScope is_compiled_scope(
       function->shared()->is_compiled_scope(isolate_));
   if (!function->is_compiled(isolate_) &&
@@ -3097,7 +3112,11 @@ bool Debug::PerformSideEffectCheck(Handle<JSFunction> function,
       // execution to perform runtime side effect checks.
       DCHECK(shared->is_compiled());
       PrepareFunctionForDebugExecution(shared);
-      ApplySideEffectChecks(debug_info);
+      // Patching the debug bytecode walks the whole array; skip it if this
+      // DebugInfo is already instrumented for side-effect checks.
+      if (debug_info->DebugExecutionMode() != DebugInfo::kSideEffects) {
+        ApplySideEffectChecks(debug_info);
+      }
       return true;
     }
     case DebugInfo::kHasNoSideEffect:
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/base/logging.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/common/globals.h"
@@ -71,6 +73,7 @@
 #include "src/objects/hole-inl.h"
 #include "src/objects/js-raw-json-inl.h"
 #include "src/objects/js-shared-array-inl.h"
+#include "src/objects/js-shared-map-inl.h"
 #include "src/objects/js-struct-inl.h"
 #include "src/objects/js-temporal-objects-inl.h"
 #include "src/objects/js-weak-refs-inl.h"
@@ -643,7 +646,8 @@ void Map::MapVerify(Isolate* isolate) {
              inobject_fields_start_offset);
 
     if (IsJSSharedStructMap(*this) || IsJSSharedArrayMap(*this) ||
-        IsJSAtomicsMutex(*this) || IsJSAtomicsCondition(*this)) {
+        IsJSSharedMapMap(*this) || IsJSAtomicsMutex(*this) ||
+        IsJSAtomicsCondition(*this)) {
       if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL) {
         // TODO(v8:14089): Verify what should be checked in this configuration
         // and again merge with the else-branch below.
@@ -1099,8 +1103,10 @@ void SlicedString::SlicedStringVerify(Isolate* isolate) {
     // Turbofan's string builder optimization can introduce SlicedString that
     // are less than SlicedString::kMinLength characters. Their live range and
     // scope are pretty limitted, but they can be visible to the GC, which
-    // shouldn't treat them as invalid.
-    CHECK_GE(length(), SlicedString::kMinLength);
+    // shouldn't treat them as invalid. Embedders can additionally lower the
+    // slicing threshold via v8::Isolate::SetSlicedStringMinLength().
+    CHECK_GE(length(), std::min(SlicedString::kMinLength,
+                                isolate->sliced_string_min_length()));
   }
 #endif
 }
@@ -1588,6 +1594,29 @@ void JSSharedArray::JSSharedArrayVerify(Isolate* isolate) {
   }
 }
 
+void JSSharedMap::JSSharedMapVerify(Isolate* isolate) {
+  CHECK(IsJSSharedMap(*this));
+  JSObjectVerify(isolate);
+  Tagged<FixedArray> stripes = this->stripes();
+  CHECK_EQ(kNumStripes * kSlotsPerStripe, stripes->length());
+  for (int i = 0; i < kNumStripes; i++) {
+    CHECK(IsJSAtomicsMutex(stripes->get(i * kSlotsPerStripe +
+                                        kStripeMutexSlot)));
+    Tagged<Object> table = stripes->get(i * kSlotsPerStripe + kStripeTableSlot);
+    CHECK(IsNameDictionary(table));
+    // Entries can only point to primitives or other shared HeapObjects, even
+    // internally.
+    Tagged<NameDictionary> dict = NameDictionary::cast(table);
+    ReadOnlyRoots roots(isolate);
+    for (InternalIndex entry : dict->IterateEntries()) {
+      Tagged<Object> key;
+      if (!dict->ToKey(roots, entry, &key)) continue;
+      CHECK(IsInternalizedString(key));
+      VerifyElementIsShared(dict->ValueAt(entry));
+    }
+  }
+}
+
 void JSIteratorMapHelper::JSIteratorMapHelperVerify(Isolate* isolate) {
   TorqueGeneratedClassVerifiers::JSIteratorMapHelperVerify(*this, isolate);
   CHECK(IsCallable(mapper()));
@@ -1901,6 +1930,11 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK_EQ(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
                uninitialized);
       CHECK_EQ(arr->get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
+      CHECK_EQ(arr->get(JSRegExp::kIrregexpExecCountIndex), uninitialized);
+      CHECK_EQ(arr->get(JSRegExp::kIrregexpInterpretedCharsIndex),
+               uninitialized);
+      CHECK_EQ(arr->get(JSRegExp::kIrregexpPrefilterLiteralIndex),
+               uninitialized);
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1941,6 +1975,10 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpBacktrackLimit)));
+      CHECK(IsSmi(arr->get(JSRegExp::kIrregexpExecCountIndex)));
+      CHECK(IsSmi(arr->get(JSRegExp::kIrregexpInterpretedCharsIndex)));
+      CHECK(IsSmi(arr->get(JSRegExp::kIrregexpPrefilterLiteralIndex)) ||
+            IsString(arr->get(JSRegExp::kIrregexpPrefilterLiteralIndex)));
       break;
     }
     default:
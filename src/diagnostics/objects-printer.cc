@@ -1708,6 +1708,15 @@ void JSSharedArray::JSSharedArrayPrint(std::ostream& os) {
   JSObjectPrintBody(os, *this);
 }
 
+void JSSharedMap::JSSharedMapPrint(std::ostream& os) {
+  JSObjectPrintHeader(os, *this, "JSSharedMap");
+  Isolate* isolate = GetIsolateFromWritableObject(*this);
+  os << "\n - isolate: " << isolate;
+  if (InWritableSharedSpace(*this)) os << " (shared)";
+  os << "\n - stripes: " << Brief(stripes());
+  JSObjectPrintBody(os, *this);
+}
+
 void JSSharedStruct::JSSharedStructPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSSharedStruct");
   Isolate* isolate = GetIsolateFromWritableObject(*this);
@@ -38,11 +38,14 @@
 #include <unistd.h>
 
 #include <memory>
+#include <unordered_map>
 
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
+#include "src/objects/code-inl.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -61,6 +64,13 @@ base::LazyRecursiveMutex& GetFileMutex() {
   return file_mutex;
 }
 
+// Maps code start addresses to the code_id_ used in their load record, so
+// that move records can refer back to the load. Protected by GetFileMutex().
+std::unordered_map<uint64_t, uint64_t>* GetCodeIndexMap() {
+  static base::LeakyObject<std::unordered_map<uint64_t, uint64_t>> map;
+  return map.get();
+}
+
 struct PerfJitHeader {
   uint32_t magic_;
   uint32_t version_;
@@ -98,6 +108,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -291,6 +311,10 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  // Remember the index of this load record so that a move record can refer
+  // back to it when the GC relocates the code.
+  (*GetCodeIndexMap())[reinterpret_cast<uint64_t>(code_pointer)] = code_index_;
+
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -299,6 +323,46 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+void LinuxPerfJitLogger::CodeMoveEvent(Tagged<InstructionStream> from,
+                                       Tagged<InstructionStream> to) {
+  // Note this method is called in a concurrent setting during evacuation, but
+  // all file accesses go through GetFileMutex().
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  Tagged<Code> code;
+  if (!from->TryGetCodeUnchecked(&code, kAcquireLoad)) {
+    // Not yet fully initialized and no load record has been emitted yet.
+    return;
+  }
+
+  const uint64_t from_address = from->instruction_start();
+  const uint64_t to_address = to->instruction_start();
+  auto* code_indices = GetCodeIndexMap();
+  auto entry = code_indices->find(from_address);
+  // Code for which no load record was written (e.g. created before the
+  // logger was attached) has no index to refer back to.
+  if (entry == code_indices->end()) return;
+  const uint64_t code_id = entry->second;
+  code_indices->erase(entry);
+  (*code_indices)[to_address] = code_id;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitBase::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = to_address;
+  code_move.old_code_address_ = from_address;
+  code_move.new_code_address_ = to_address;
+  code_move.code_size_ = code->instruction_size();
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 namespace {
 
 constexpr char kUnknownScriptNameString[] = "<unknown>";
@@ -45,9 +45,7 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   ~LinuxPerfJitLogger() override;
 
   void CodeMoveEvent(Tagged<InstructionStream> from,
-                     Tagged<InstructionStream> to) override {
-    UNREACHABLE();  // Unsupported.
-  }
+                     Tagged<InstructionStream> to) override;
   void BytecodeMoveEvent(Tagged<BytecodeArray> from,
                          Tagged<BytecodeArray> to) override {}
   void CodeDisableOptEvent(Handle<AbstractCode> code,
@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "src/api/api-inl.h"
+#include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
@@ -25,16 +26,81 @@ namespace v8::internal {
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
 // A {FutexWaitList} manages all contexts waiting (synchronously or
-// asynchronously) on any address.
+// asynchronously) on any address. To reduce contention between unrelated
+// addresses, the wait locations are sharded by address; each shard has its own
+// mutex and its own per-location lists.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  struct Shard {
+    // `mutex` protects the composition of `location_lists` (i.e. no elements
+    // may be added or removed without holding this mutex), as well as the
+    // `waiting_` field for each individual list node that is currently on one
+    // of the shard's lists. It must be the mutex used together with the
+    // `cond_` condition variable of such nodes.
+    base::Mutex mutex;
+
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    // As long as the map does not grow beyond 16 entries, there is no dynamic
+    // allocation and deallocation happening in wait or wake, which reduces the
+    // time spend in the critical section.
+    base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists;
+  };
+
+  static constexpr int kNumShards = 16;
+  static_assert(base::bits::IsPowerOfTwo(kNumShards));
+
+  Shard& ShardFor(void* wait_location) {
+    // Wait locations are at least 4-byte aligned, so drop the alignment bits
+    // before taking the modulus; neighbouring 32-bit wait locations then land
+    // in different shards.
+    uintptr_t addr = reinterpret_cast<uintptr_t>(wait_location);
+    return shards_[(addr >> 2) & (kNumShards - 1)];
+  }
+
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
+  // Runs {action} while holding the mutex of the shard that {node} is (or will
+  // next be) waiting on. The waiting thread may concurrently start a wait on
+  // another location, under a different shard mutex; in that case {action} is
+  // re-run under the new shard's mutex, so it must be idempotent. The seq_cst
+  // loads here pair with the seq_cst store of {wait_location_} in {WaitSync}:
+  // either the second load observes the new location and we re-lock, or the
+  // waiting thread observes the effects of {action} when it checks
+  // {interrupted_} under the new shard's mutex before blocking.
+  template <typename Action>
+  void RunUnderShardLockForNode(FutexWaitListNode* node, Action action) {
+    while (true) {
+      void* location = node->wait_location_.load(std::memory_order_seq_cst);
+      Shard& shard = ShardFor(location);
+      {
+        NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+        action();
+      }
+      if (node->wait_location_.load(std::memory_order_seq_cst) == location) {
+        return;
+      }
+    }
+  }
+
+  // Moves the woken async waiters in {woken} into the per-isolate lists of
+  // Promises to resolve, and schedules one resolution task for each isolate
+  // which doesn't have one in flight yet. Processing the whole batch under a
+  // single acquisition of {promise_mutex_} keeps wake-many operations cheap.
+  // The caller must hold the shard mutex of the nodes' wait location, so that
+  // {IsolateDeinit} cannot run in between and miss the woken nodes.
+  void ScheduleAsyncWaiterResolution(HeadAndTail woken);
+
   static void* ToWaitLocation(Tagged<JSArrayBuffer> array_buffer, size_t addr) {
     DCHECK_LT(addr, array_buffer->GetByteLength());
     // Use the cheaper JSArrayBuffer::backing_store() accessor, but DCHECK that
@@ -82,34 +148,29 @@ class FutexWaitList {
     *tail = new_tail;
   }
 
-  // For checking the internal consistency of the FutexWaitList.
-  void Verify() const;
+  // For checking the internal consistency of one shard of the FutexWaitList.
+  // The caller must hold the shard's mutex.
+  static void Verify(const Shard& shard);
+  // Ditto for the per-isolate lists of Promises waiting to be resolved. The
+  // caller must hold `promise_mutex_`.
+  void VerifyPromises() const;
   // Returns true if |node| is on the linked list starting with |head|.
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
-  base::Mutex* mutex() { return &mutex_; }
-
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
+  // Checks the link invariants of |node| on the list from |head| to |tail|.
+  static void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
+                         FutexWaitListNode* tail);
 
-  // `mutex` protects the composition of the fields below (i.e. no elements may
-  // be added or removed without holding this mutex), as well as the `waiting_`
-  // and `interrupted_` fields for each individual list node that is currently
-  // part of the list. It must be the mutex used together with the `cond_`
-  // condition variable of such nodes.
-  base::Mutex mutex_;
+  Shard shards_[kNumShards];
 
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  // As long as the map does not grow beyond 16 entries, there is no dynamic
-  // allocation and deallocation happening in wait or wake, which reduces the
-  // time spend in the critical section.
-  base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists_;
+  // `promise_mutex_` protects `isolate_promises_to_resolve_`, as well as the
+  // `prev_` and `next_` fields of the nodes on its lists. Lock ordering: a
+  // shard mutex may be held while acquiring `promise_mutex_`, never the other
+  // way around.
+  base::Mutex promise_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -138,17 +199,18 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
+  // Lock the mutex of the shard this node is waiting on before notifying. We
+  // know that the mutex will have been unlocked if we are currently waiting on
+  // the condition variable. The mutex will not be locked if
+  // FutexEmulation::Wait hasn't locked it yet. In that case, we set the
+  // interrupted_ flag to true, which will be tested after the mutex is locked
+  // by a future wait.
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-
-  // if not waiting, this will not have any effect.
-  cond_.NotifyOne();
-  interrupted_ = true;
+  wait_list->RunUnderShardLockForNode(this, [this]() {
+    // if not waiting, this will not have any effect.
+    cond_.NotifyOne();
+    interrupted_ = true;
+  });
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -178,58 +240,60 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
   FutexWaitListNode* node_;
 };
 
-void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
-  DCHECK(node->IsAsync());
-  // This function can run in any thread.
-
-  FutexWaitList* wait_list = GetWaitList();
-  wait_list->mutex()->AssertHeld();
-
-  // Nullify the timeout time; this distinguishes timed out waiters from
-  // woken up ones.
-  node->async_state_->timeout_time = base::TimeTicks();
+void FutexWaitList::ScheduleAsyncWaiterResolution(HeadAndTail woken) {
+  // This function can run in any thread, while holding the shard mutex of the
+  // woken nodes' wait location.
+  NoGarbageCollectionMutexGuard lock_guard(&promise_mutex_);
 
-  wait_list->RemoveNode(node);
-
-  // Schedule a task for resolving the Promise. It's still possible that the
-  // timeout task runs before the promise resolving task. In that case, the
-  // timeout task will just ignore the node.
-  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
-  auto it = isolate_map.find(node->async_state_->isolate_for_async_waiters);
-  if (it == isolate_map.end()) {
-    // This Isolate doesn't have other Promises to resolve at the moment.
-    isolate_map.insert(
-        std::make_pair(node->async_state_->isolate_for_async_waiters,
-                       FutexWaitList::HeadAndTail{node, node}));
-    auto task = std::make_unique<ResolveAsyncWaiterPromisesTask>(
-        node->async_state_->isolate_for_async_waiters);
-    node->async_state_->task_runner->PostNonNestableTask(std::move(task));
-  } else {
-    // Add this Node into the existing list.
-    node->prev_ = it->second.tail;
-    it->second.tail->next_ = node;
-    it->second.tail = node;
+  for (FutexWaitListNode* node = woken.head; node;) {
+    FutexWaitListNode* next = node->next_;
+    node->prev_ = node->next_ = nullptr;
+    DCHECK(node->IsAsync());
+    Isolate* isolate = node->async_state_->isolate_for_async_waiters;
+    auto it = isolate_promises_to_resolve_.find(isolate);
+    if (it == isolate_promises_to_resolve_.end()) {
+      // This Isolate doesn't have other Promises to resolve at the moment.
+      isolate_promises_to_resolve_.insert(
+          std::make_pair(isolate, HeadAndTail{node, node}));
+      // Schedule a task for resolving the Promises. It's still possible that
+      // a timeout task runs before the promise resolving task. In that case,
+      // the timeout task will just ignore the node.
+      auto task = std::make_unique<ResolveAsyncWaiterPromisesTask>(isolate);
+      node->async_state_->task_runner->PostNonNestableTask(std::move(task));
+    } else {
+      // Add this Node into the existing list.
+      node->prev_ = it->second.tail;
+      it->second.tail->next_ = node;
+      it->second.tail = node;
+    }
+    node = next;
   }
 }
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
+  void* wait_location = node->wait_location_.load(std::memory_order_relaxed);
+  Shard& shard = ShardFor(wait_location);
+  shard.mutex.AssertHeld();
   auto [it, inserted] =
-      location_lists_.insert({node->wait_location_, HeadAndTail{node, node}});
+      shard.location_lists.insert({wait_location, HeadAndTail{node, node}});
   if (!inserted) {
     it->second.tail->next_ = node;
     node->prev_ = it->second.tail;
     it->second.tail = node;
   }
 
-  Verify();
+  Verify(shard);
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
+  void* wait_location = node->wait_location_.load(std::memory_order_relaxed);
+  Shard& shard = ShardFor(wait_location);
+  shard.mutex.AssertHeld();
   if (!node->prev_ && !node->next_) {
     // If the node was the last one on its list, delete the whole list.
-    size_t erased = location_lists_.erase(node->wait_location_);
+    size_t erased = shard.location_lists.erase(wait_location);
     DCHECK_EQ(1, erased);
     USE(erased);
   } else if (node->prev_ && node->next_) {
@@ -241,8 +305,8 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
   } else {
     // Otherwise we have to lookup in the list to find the head and tail
     // pointers.
-    auto it = location_lists_.find(node->wait_location_);
-    DCHECK_NE(location_lists_.end(), it);
+    auto it = shard.location_lists.find(wait_location);
+    DCHECK_NE(shard.location_lists.end(), it);
     DCHECK(NodeIsOnList(node, it->second.head));
 
     if (node->prev_) {
@@ -260,7 +324,7 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
     }
   }
 
-  Verify();
+  Verify(shard);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
@@ -269,11 +333,9 @@ void AtomicsWaitWakeHandle::Wake() {
   // The split lock by itself isn’t an issue, as long as the caller properly
   // synchronizes this with the closing `AtomicsWaitCallback`.
   FutexWaitList* wait_list = GetWaitList();
-  {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
-    stopped_ = true;
-  }
-  isolate_->futex_wait_list_node()->NotifyWake();
+  FutexWaitListNode* node = isolate_->futex_wait_list_node();
+  wait_list->RunUnderShardLockForNode(node, [this]() { stopped_ = true; });
+  node->NotifyWake();
 }
 
 enum WaitReturnValue : int { kOk = 0, kNotEqualValue = 1, kTimedOut = 2 };
@@ -408,6 +470,7 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
   FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node = isolate->futex_wait_list_node();
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
+  FutexWaitList::Shard& shard = wait_list->ShardFor(wait_location);
 
   base::TimeTicks timeout_time;
   if (use_timeout) {
@@ -420,7 +483,7 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
   // Keep the code in the loop as minimal as possible, because this is all in
   // the critical section.
   do {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
     std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
@@ -437,7 +500,11 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
       break;
     }
 
-    node->wait_location_ = wait_location;
+    // The seq_cst store pairs with the loads in
+    // {FutexWaitList::RunUnderShardLockForNode}; a notifier holding the mutex
+    // of a shard this node waited on earlier is guaranteed to re-run its
+    // notification under {shard}'s mutex.
+    node->wait_location_.store(wait_location, std::memory_order_seq_cst);
     node->waiting_ = true;
     wait_list->AddNode(node);
 
@@ -503,10 +570,10 @@ Tagged<Object> FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(wait_list->mutex(), time_until_timeout);
+            node->cond_.WaitFor(&shard.mutex, time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(wait_list->mutex());
+        node->cond_.Wait(&shard.mutex);
       }
 
       // Spurious wakeup, interrupt or timeout.
@@ -571,9 +638,10 @@ Tagged<Object> FutexEmulation::WaitAsync(Isolate* isolate,
   // the node.
   std::weak_ptr<BackingStore> backing_store{array_buffer->GetBackingStore()};
   FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList::Shard& shard = wait_list->ShardFor(wait_location);
   {
     // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
     std::atomic<T>* p = static_cast<std::atomic<T>*>(wait_location);
@@ -687,12 +755,18 @@ int FutexEmulation::Wake(Tagged<JSArrayBuffer> array_buffer, size_t addr,
 int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
   int num_waiters_woken = 0;
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexWaitList::Shard& shard = wait_list->ShardFor(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
-  auto& location_lists = wait_list->location_lists_;
+  auto& location_lists = shard.location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) return num_waiters_woken;
 
+  // Woken async waiters are collected here and handed over to the promise
+  // resolution machinery in one batch below, so that waking many waiters
+  // takes the promise resolution mutex and posts per-isolate tasks only once.
+  FutexWaitList::HeadAndTail woken_async = {nullptr, nullptr};
+
   FutexWaitListNode* node = it->second.head;
   while (node && num_waiters_to_wake > 0) {
     if (!node->waiting_) {
@@ -714,11 +788,22 @@ int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
     if (V8_LIKELY(matching_backing_store)) {
       node->waiting_ = false;
 
-      // Retrieve the next node to iterate before calling NotifyAsyncWaiter,
-      // since NotifyAsyncWaiter will take the node out of the linked list.
+      // Retrieve the next node to iterate before unlinking the woken node
+      // from the location list.
       FutexWaitListNode* next_node = node->next_;
       if (node->IsAsync()) {
-        NotifyAsyncWaiter(node);
+        // Nullify the timeout time; this distinguishes timed out waiters from
+        // woken up ones.
+        node->async_state_->timeout_time = base::TimeTicks();
+        wait_list->RemoveNode(node);
+        // Append the node to the batch of woken async waiters.
+        if (woken_async.head == nullptr) {
+          woken_async.head = woken_async.tail = node;
+        } else {
+          node->prev_ = woken_async.tail;
+          woken_async.tail->next_ = node;
+          woken_async.tail = node;
+        }
       } else {
         // WaitSync will remove the node from the list.
         node->cond_.NotifyOne();
@@ -774,14 +859,20 @@ int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
     node = next_node;
   }
 
+  if (woken_async.head != nullptr) {
+    // Schedule the promise resolutions while still holding the shard mutex,
+    // so that IsolateDeinit cannot run in between and miss the woken nodes.
+    wait_list->ScheduleAsyncWaiterResolution(woken_async);
+  }
+
   return num_waiters_woken;
 }
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding the
-  // FutexEmulationGlobalState::mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of
+  // the FutexWaitList mutexes.
 
   Isolate* isolate = node->async_state_->isolate_for_async_waiters;
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
@@ -857,7 +948,7 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promise_mutex_);
 
     auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
@@ -894,7 +985,10 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   FutexWaitList* wait_list = GetWaitList();
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    // Async waiters never change their wait location, so the shard is stable.
+    FutexWaitList::Shard& shard = wait_list->ShardFor(
+        node->wait_location_.load(std::memory_order_relaxed));
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
     node->async_state_->timeout_task_id = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -916,14 +1010,14 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = wait_list->location_lists_;
+  for (FutexWaitList::Shard& shard : wait_list->shards_) {
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    auto& location_lists = shard.location_lists;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
@@ -937,9 +1031,11 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
         ++it;
       }
     }
+    FutexWaitList::Verify(shard);
   }
 
   {
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promise_mutex_);
     auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
@@ -952,19 +1048,19 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    wait_list->VerifyPromises();
   }
-
-  wait_list->Verify();
 }
 
 int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
                                          size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexWaitList::Shard& shard = wait_list->ShardFor(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
   int num_waiters = 0;
-  auto& location_lists = wait_list->location_lists_;
+  auto& location_lists = shard.location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) return num_waiters;
 
@@ -983,15 +1079,17 @@ int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
 
 int FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   int num_waiters = 0;
-  for (const auto& it : wait_list->location_lists_) {
-    for (FutexWaitListNode* node = it.second.head; node; node = node->next_) {
-      if (!node->IsAsync()) continue;
-      if (!node->waiting_) continue;
-      if (node->async_state_->isolate_for_async_waiters != isolate) continue;
-      num_waiters++;
+  for (FutexWaitList::Shard& shard : wait_list->shards_) {
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    for (const auto& it : shard.location_lists) {
+      for (FutexWaitListNode* node = it.second.head; node; node = node->next_) {
+        if (!node->IsAsync()) continue;
+        if (!node->waiting_) continue;
+        if (node->async_state_->isolate_for_async_waiters != isolate) continue;
+        num_waiters++;
+      }
     }
   }
 
@@ -1002,7 +1100,7 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     Tagged<JSArrayBuffer> array_buffer, size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(array_buffer, addr);
   FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  NoGarbageCollectionMutexGuard lock_guard(&wait_list->promise_mutex_);
 
   int num_waiters = 0;
   auto& isolate_map = wait_list->isolate_promises_to_resolve_;
@@ -1010,7 +1108,8 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     for (FutexWaitListNode* node = it.second.head; node; node = node->next_) {
       DCHECK(node->IsAsync());
       if (node->waiting_) continue;
-      if (wait_location != node->wait_location_) continue;
+      if (wait_location != node->wait_location_.load(std::memory_order_relaxed))
+        continue;
       if (node->async_state_->backing_store.expired()) continue;
       DCHECK_EQ(array_buffer->GetBackingStore(),
                 node->async_state_->backing_store.lock());
@@ -1021,33 +1120,41 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   return num_waiters;
 }
 
-void FutexWaitList::Verify() const {
 #ifdef DEBUG
-  auto VerifyNode = [](FutexWaitListNode* node, FutexWaitListNode* head,
-                       FutexWaitListNode* tail) {
-    if (node->next_ != nullptr) {
-      DCHECK_NE(node, tail);
-      DCHECK_EQ(node, node->next_->prev_);
-    } else {
-      DCHECK_EQ(node, tail);
-    }
-    if (node->prev_ != nullptr) {
-      DCHECK_NE(node, head);
-      DCHECK_EQ(node, node->prev_->next_);
-    } else {
-      DCHECK_EQ(node, head);
-    }
+// static
+void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
+                               FutexWaitListNode* tail) {
+  if (node->next_ != nullptr) {
+    DCHECK_NE(node, tail);
+    DCHECK_EQ(node, node->next_->prev_);
+  } else {
+    DCHECK_EQ(node, tail);
+  }
+  if (node->prev_ != nullptr) {
+    DCHECK_NE(node, head);
+    DCHECK_EQ(node, node->prev_->next_);
+  } else {
+    DCHECK_EQ(node, head);
+  }
 
-    DCHECK(NodeIsOnList(node, head));
-  };
+  DCHECK(NodeIsOnList(node, head));
+}
+#endif  // DEBUG
 
-  for (const auto& [addr, head_and_tail] : location_lists_) {
+// static
+void FutexWaitList::Verify(const Shard& shard) {
+#ifdef DEBUG
+  for (const auto& [addr, head_and_tail] : shard.location_lists) {
     auto [head, tail] = head_and_tail;
     for (FutexWaitListNode* node = head; node; node = node->next_) {
       VerifyNode(node, head, tail);
     }
   }
+#endif  // DEBUG
+}
 
+void FutexWaitList::VerifyPromises() const {
+#ifdef DEBUG
   for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
     auto [head, tail] = head_and_tail;
     for (FutexWaitListNode* node = head; node; node = node->next_) {
@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "include/v8-persistent-handle.h"
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -48,7 +50,10 @@ class AtomicsWaitWakeHandle {
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  // Atomic because {Wake} may set it while holding the mutex of a shard the
+  // waiting node has already moved away from; see
+  // {FutexWaitList::RunUnderShardLockForNode}.
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -124,23 +129,30 @@ class FutexWaitListNode {
   };
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulationGlobalState::mutex.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList shard the
+  // node is on, or, while the node waits for its Promise to be resolved, by
+  // the promise resolution mutex.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
   // The memory location the FutexWaitListNode is waiting on. Equals
   // backing_store_->buffer_start() + wait_addr at FutexWaitListNode creation
   // time. This address is used find the node in the per-location list, or to
-  // remove it.
+  // remove it. It also selects the FutexWaitList shard whose mutex protects
+  // the node while it is on a wait list; it is atomic because {NotifyWake}
+  // reads it from another thread to determine which shard mutex to take (see
+  // {FutexWaitList::RunUnderShardLockForNode}).
   // Note that during an async wait the BackingStore might get deleted while
   // this node is alive.
-  void* wait_location_ = nullptr;
+  std::atomic<void*> wait_location_{nullptr};
 
-  // waiting_ and interrupted_ are protected by FutexEmulationGlobalState::mutex
-  // if this node is currently contained in FutexEmulationGlobalState::wait_list
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the FutexWaitList shard containing
+  // wait_location_ if this node is currently on one of that shard's wait lists
+  // or an AtomicsWaitWakeHandle has access to it. interrupted_ is atomic
+  // because a concurrent {NotifyWake} may set it while holding the mutex of a
+  // shard the node has already moved away from.
   bool waiting_ = false;
-  bool interrupted_ = false;
+  std::atomic<bool> interrupted_{false};
 
   // State used for an async wait; nullptr on sync waits.
   const std::unique_ptr<AsyncState> async_state_;
@@ -247,8 +259,6 @@ class FutexEmulation : public AllStatic {
 
   static void HandleAsyncWaiterTimeout(FutexWaitListNode* node);
 
-  static void NotifyAsyncWaiter(FutexWaitListNode* node);
-
   // Remove the node's Promise from the NativeContext's Promise set.
   static void CleanupAsyncWaiterPromise(FutexWaitListNode* node);
 };
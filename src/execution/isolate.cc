@@ -32,6 +32,7 @@
 #include "src/builtins/builtins.h"
 #include "src/builtins/constants-table-builder.h"
 #include "src/codegen/assembler-inl.h"
+#include "src/codegen/call-edge-profile.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/flush-instruction-cache.h"
 #include "src/common/assert-scope.h"
@@ -76,8 +77,11 @@
 #include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/hash-seed-inl.h"
+#include "src/objects/background-string-flattener.h"
 #include "src/objects/backing-store.h"
+#include "src/objects/bytecode-array-inl.h"
 #include "src/objects/call-site-info-inl.h"
+#include "src/objects/code-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/hash-table-inl.h"
@@ -97,6 +101,7 @@
 #include "src/objects/source-text-module-inl.h"
 #include "src/objects/string-set-inl.h"
 #include "src/objects/visitors.h"
+#include "src/parsing/parse-info.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
 #include "src/regexp/regexp-stack.h"
@@ -779,7 +784,9 @@ class CallSiteBuilder {
         mode_(mode),
         limit_(limit),
         caller_(caller),
-        skip_next_frame_(mode != SKIP_NONE) {
+        skip_next_frame_(mode != SKIP_NONE),
+        compact_(v8_flags.lazy_error_stack_capture &&
+                 !isolate->get_capture_stack_trace_for_uncaught_exceptions()) {
     DCHECK_IMPLIES(mode_ == SKIP_UNTIL_SEEN, IsJSFunction(*caller_));
     // Modern web applications are usually built with multiple layers of
     // framework and library code, and stack depth tends to be more than
@@ -909,7 +916,8 @@ class CallSiteBuilder {
   bool Full() { return index_ >= limit_; }
 
   Handle<FixedArray> Build() {
-    return FixedArray::RightTrimOrEmpty(isolate_, elements_, index_);
+    int length = compact_ ? index_ * CallSiteInfo::kCompactFrameSize : index_;
+    return FixedArray::RightTrimOrEmpty(isolate_, elements_, length);
   }
 
  private:
@@ -980,17 +988,57 @@ class CallSiteBuilder {
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
+    if (compact_) {
+      AppendCompactFrame(receiver_or_instance, function, code, offset, flags);
+      return;
+    }
     auto info = isolate_->factory()->NewCallSiteInfo(
         receiver_or_instance, function, code, offset, flags, parameters);
     elements_ = FixedArray::SetAndGrow(isolate_, elements_, index_++, info);
   }
 
+  // Deferred capture (--lazy-error-stack-capture): instead of allocating one
+  // CallSiteInfo per frame, record the frame components flat into the
+  // elements array and leave the CallSiteInfo materialization to
+  // CallSiteInfo::MaterializeCompactStackTrace, which runs only if the stack
+  // trace is actually accessed. Code and BytecodeArray live in trusted space
+  // and are recorded via their in-sandbox wrapper objects.
+  void AppendCompactFrame(Handle<Object> receiver_or_instance,
+                          Handle<Object> function, Handle<HeapObject> code,
+                          int offset, int flags) {
+    Handle<HeapObject> code_or_wrapper = code;
+    if (IsCode(*code)) {
+      code_or_wrapper = handle(Code::cast(*code)->wrapper(), isolate_);
+    } else if (IsBytecodeArray(*code)) {
+      code_or_wrapper = handle(BytecodeArray::cast(*code)->wrapper(), isolate_);
+    }
+    int base = index_ * CallSiteInfo::kCompactFrameSize;
+    // Growing via the last slot ensures a single (amortized) copy per frame.
+    elements_ = FixedArray::SetAndGrow(
+        isolate_, elements_, base + CallSiteInfo::kCompactFrameSize - 1,
+        isolate_->factory()->undefined_value());
+    elements_->set(base + CallSiteInfo::kCompactFlagsIndex,
+                   Smi::FromInt(flags));
+    elements_->set(base + CallSiteInfo::kCompactCodeOffsetIndex,
+                   Smi::FromInt(offset));
+    elements_->set(base + CallSiteInfo::kCompactReceiverOrInstanceIndex,
+                   *receiver_or_instance);
+    elements_->set(base + CallSiteInfo::kCompactFunctionIndex, *function);
+    elements_->set(base + CallSiteInfo::kCompactCodeObjectIndex,
+                   *code_or_wrapper);
+    index_++;
+  }
+
   Isolate* isolate_;
   const FrameSkipMode mode_;
   int index_ = 0;
   const int limit_;
   const Handle<Object> caller_;
   bool skip_next_frame_;
+  // Whether to record frames in the compact deferred encoding. The inspector
+  // path wraps the result in an ErrorStackData and consumes the CallSiteInfos
+  // right away, so it always captures eagerly.
+  const bool compact_;
   bool encountered_strict_function_ = false;
   Handle<FixedArray> elements_;
 };
@@ -1020,11 +1068,24 @@ void CaptureAsyncStackTrace(Isolate* isolate, Handle<JSPromise> promise,
     // Check that the {promise} is not settled.
     if (promise->status() != Promise::kPending) return;
 
-    // Check that we have exactly one PromiseReaction on the {promise}.
+    // Check that we have at least one PromiseReaction on the {promise}.
     if (!IsPromiseReaction(promise->reactions())) return;
     Handle<PromiseReaction> reaction(
         PromiseReaction::cast(promise->reactions()), isolate);
-    if (!IsSmi(reaction->next())) return;
+    // If there are multiple reactions, prefer the await reaction (if any),
+    // since that is the one the async stack continues through. Otherwise
+    // continue with the first (oldest) reaction, the last element of the
+    // list (reactions are stored in reverse insertion order). Additional
+    // monitoring or logging handlers attached to an awaited promise would
+    // otherwise cut the async stack short here.
+    if (!IsSmi(reaction->next())) {
+      Handle<PromiseReaction> current = reaction;
+      while (ToAsyncGenerator(isolate, current).is_null()) {
+        if (IsSmi(current->next())) break;
+        current = handle(PromiseReaction::cast(current->next()), isolate);
+      }
+      reaction = current;
+    }
 
     Handle<JSGeneratorObject> generator_object =
         ToAsyncGenerator(isolate, reaction);
@@ -1363,7 +1424,21 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
       ErrorUtils::GetErrorStackProperty(this, maybe_error_object);
 
   if (IsFixedArray(*lookup.error_stack)) {
-    return Handle<FixedArray>::cast(lookup.error_stack);
+    Handle<FixedArray> stack_trace =
+        Handle<FixedArray>::cast(lookup.error_stack);
+    if (CallSiteInfo::IsCompactStackTrace(*stack_trace)) {
+      stack_trace =
+          CallSiteInfo::MaterializeCompactStackTrace(this, stack_trace);
+      // Remember the materialized frames so that repeated accesses don't
+      // pay for the materialization again.
+      Object::SetProperty(this,
+                          lookup.error_stack_symbol_holder.ToHandleChecked(),
+                          factory()->error_stack_symbol(), stack_trace,
+                          StoreOrigin::kMaybeKeyed,
+                          Just(ShouldThrow::kThrowOnError))
+          .Check();
+    }
+    return stack_trace;
   }
   if (!IsErrorStackData(*lookup.error_stack)) {
     return factory()->empty_fixed_array();
@@ -3844,6 +3919,9 @@ void Isolate::Deinit() {
     lazy_compile_dispatcher_.reset();
   }
 
+  DCHECK(!reusable_compile_state_in_use_);
+  reusable_compile_state_.reset();
+
   // At this point there are no more background threads left in this isolate.
   heap_.safepoint()->AssertMainThreadIsOnlyThread();
 
@@ -3973,6 +4051,34 @@ void Isolate::Deinit() {
   }
 }
 
+bool Isolate::ResetForReuse() {
+  DCHECK(IsInUse());
+  DCHECK_EQ(this, TryGetCurrent());
+
+  // Drop transient state that a subsequent user of this isolate must not
+  // observe.
+  if (has_exception()) clear_exception();
+  CancelTerminateExecution();
+  MicrotaskQueue* queue = default_microtask_queue();
+  do {
+    queue->DiscardMicrotasks();
+    queue = queue->next();
+  } while (queue != default_microtask_queue());
+  // Compiled user code is keyed by source text and would be served to the
+  // next user on a cache hit.
+  compilation_cache()->Clear();
+
+  // Severing contexts, handles and embedder references is the caller's job;
+  // rather than trusting that it happened, perform a full garbage collection
+  // and check that no native context survived. With the shared caches above
+  // cleared, a surviving native context is the only conduit through which
+  // code running in a freshly created context could observe the previous
+  // user's state.
+  heap()->CollectAllAvailableGarbage(
+      GarbageCollectionReason::kLowMemoryNotification);
+  return IsUndefined(heap()->native_contexts_list(), this);
+}
+
 void Isolate::SetIsolateThreadLocals(Isolate* isolate,
                                      PerIsolateThreadData* data) {
   g_current_isolate_ = isolate;
@@ -4021,6 +4127,9 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete json_shape_cache_;
+  json_shape_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -4586,6 +4695,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  json_shape_cache_ = new JsonShapeCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
@@ -4679,6 +4789,14 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     // embedded blob.
     MaybeRemapEmbeddedBuiltinsIntoCodeRange();
   }
+  if (v8_flags.embedded_builtins_huge_pages && embedded_blob_code_ != nullptr) {
+    // With a snapshot built with --reorder-builtins the hottest builtins are
+    // packed at the start of the blob, so backing it with transparent huge
+    // pages concentrates the hot code on as few i-TLB entries as possible.
+    // Advisory and idempotent across isolates sharing the blob.
+    base::OS::AdviseHugePages(const_cast<uint8_t*>(embedded_blob_code_),
+                              embedded_blob_code_size_);
+  }
   {
     // Must be done before deserializing RO space since the deserialization
     // process refers to these data structures.
@@ -4717,6 +4835,11 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     DCHECK_NOT_NULL(string_forwarding_table());
   }
 
+  if (v8_flags.background_flatten_strings) {
+    background_string_flattener_ =
+        std::make_unique<BackgroundStringFlattener>(this);
+  }
+
 #ifdef V8_EXTERNAL_CODE_SPACE
   {
     VirtualMemoryCage* code_cage;
@@ -5119,6 +5242,9 @@ void Isolate::DumpAndResetStats() {
     counters()->runtime_call_stats()->Reset();
   }
 #endif  // V8_RUNTIME_CALL_STATS
+  if (v8_flags.turbo_inline_profile_output) {
+    CallEdgeProfile::Dump(this, v8_flags.turbo_inline_profile_output);
+  }
   if (BasicBlockProfiler::Get()->HasData(this)) {
     if (v8_flags.turbo_profiling_output) {
       FILE* f = std::fopen(v8_flags.turbo_profiling_output, "w");
@@ -5178,8 +5304,17 @@ CodeTracer* Isolate::GetCodeTracer() {
 
 bool Isolate::use_optimizer() {
   // TODO(v8:7700): Update this predicate for a world with multiple tiers.
+  // Precise-count coverage relies on the interpreter and baseline tiers
+  // bumping the feedback vector's invocation count, so it disables the
+  // optimizer by default. With --optimized-code-coverage the optimizer stays
+  // enabled and invocation counts of optimized functions become lower bounds
+  // (their first invocations still run unoptimized). Block coverage modes
+  // derive all reported counts from IncBlockCounter, which Maglev and
+  // TurboFan compile as well, and thus never disable the optimizer.
   return (v8_flags.turbofan || v8_flags.maglev) && !serializer_enabled_ &&
-         CpuFeatures::SupportsOptimizer() && !is_precise_count_code_coverage();
+         CpuFeatures::SupportsOptimizer() &&
+         (!is_precise_count_code_coverage() ||
+          v8_flags.optimized_code_coverage);
 }
 
 void Isolate::IncreaseTotalRegexpCodeGenerated(Handle<HeapObject> code) {
@@ -5278,6 +5413,24 @@ Isolate::KnownPrototype Isolate::IsArrayOrObjectOrStringPrototype(
   return KnownPrototype::kNone;
 }
 
+ReusableUnoptimizedCompileState* Isolate::AcquireReusableCompileState() {
+  if (reusable_compile_state_in_use_) return nullptr;
+  if (!reusable_compile_state_) {
+    reusable_compile_state_ =
+        std::make_unique<ReusableUnoptimizedCompileState>(this);
+  }
+  reusable_compile_state_in_use_ = true;
+  return reusable_compile_state_.get();
+}
+
+void Isolate::ReleaseReusableCompileState(
+    ReusableUnoptimizedCompileState* state) {
+  DCHECK_EQ(state, reusable_compile_state_.get());
+  DCHECK(reusable_compile_state_in_use_);
+  state->Reset();
+  reusable_compile_state_in_use_ = false;
+}
+
 bool Isolate::IsInAnyContext(Tagged<Object> object, uint32_t index) {
   DisallowGarbageCollection no_gc;
   Tagged<Object> context = heap()->native_contexts_list();
@@ -5383,12 +5536,16 @@ ISOLATE_INIT_ARRAY_LIST(ISOLATE_FIELD_OFFSET)
 
 Handle<Symbol> Isolate::SymbolFor(RootIndex dictionary_index,
                                   Handle<String> name, bool private_symbol) {
-  Handle<String> key = factory()->InternalizeString(name);
   Handle<RegisteredSymbolTable> dictionary =
       Handle<RegisteredSymbolTable>::cast(root_handle(dictionary_index));
-  InternalIndex entry = dictionary->FindEntry(this, key);
+  // The table is keyed on string contents, so the lookup does not require an
+  // internalized key; this keeps repeated lookups of registered symbols off
+  // the (process-wide) string table. Only insertion internalizes, so that the
+  // stored key is the canonical description of the symbol.
+  InternalIndex entry = dictionary->FindEntry(this, name);
   Handle<Symbol> symbol;
   if (entry.is_not_found()) {
+    Handle<String> key = factory()->InternalizeString(name);
     symbol =
         private_symbol ? factory()->NewPrivateSymbol() : factory()->NewSymbol();
     symbol->set_description(*key);
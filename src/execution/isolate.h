@@ -109,6 +109,7 @@ class MaglevConcurrentDispatcher;
 
 class AddressToIndexHashMap;
 class AstStringConstants;
+class BackgroundStringFlattener;
 class Bootstrapper;
 class BuiltinsConstantsTableBuilder;
 class CancelableTaskManager;
@@ -123,6 +124,7 @@ class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class JsonShapeCache;
 class GlobalHandles;
 class GlobalSafepoint;
 class HandleScopeImplementer;
@@ -140,6 +142,7 @@ class PersistentHandles;
 class PersistentHandlesList;
 class ReadOnlyArtifacts;
 class RegExpStack;
+class ReusableUnoptimizedCompileState;
 class RootVisitor;
 class SetupIsolateDelegate;
 class SharedStructTypeRegistry;
@@ -523,6 +526,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(MicrotaskQueue*, default_microtask_queue, nullptr)                        \
   V(CodeTracer*, code_tracer, nullptr)                                        \
   V(PromiseRejectCallback, promise_reject_callback, nullptr)                  \
+  V(ContextMemoryLimitCallback, context_memory_limit_callback, nullptr)       \
   V(const v8::StartupData*, snapshot_blob, nullptr)                           \
   V(int, code_and_metadata_size, 0)                                           \
   V(int, bytecode_and_metadata_size, 0)                                       \
@@ -544,7 +548,11 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(bool, deoptimization_assert, true)                                        \
   V(bool, compilation_assert, true)                                           \
   V(bool, no_exception_assert, true)                                          \
-  V(uint32_t, wasm_switch_to_the_central_stack_counter, 0)
+  V(uint32_t, wasm_switch_to_the_central_stack_counter, 0)                    \
+  /* Minimum length at which Factory::NewSubString creates a SlicedString */  \
+  /* instead of copying. Defaults to SlicedString::kMinLength; embedders */   \
+  /* can lower it via v8::Isolate::SetSlicedStringMinLength(). */             \
+  V(int, sliced_string_min_length, 13)
 
 #define THREAD_LOCAL_TOP_ACCESSOR(type, name)                         \
   inline void set_##name(type v) { thread_local_top()->name##_ = v; } \
@@ -689,6 +697,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // at the same time, this should be prevented using external locking.
   void Exit();
 
+  // Clears transient state (exceptions, microtasks, compilation caches) and
+  // verifies that no user state survived, so the isolate can be handed to a
+  // new user instead of being disposed. The isolate must be entered and the
+  // embedder must have released all handles and contexts beforehand; returns
+  // false if user state is still reachable, in which case the isolate must
+  // not be reused. Called by v8::IsolatePool.
+  V8_WARN_UNUSED_RESULT bool ResetForReuse();
+
   // Find the PerThread for this particular (isolate, thread) combination.
   // If one does not yet exist, allocate a new one.
   PerIsolateThreadData* FindOrAllocatePerThreadDataForThisThread();
@@ -763,6 +779,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
                : shared_space_isolate()->string_forwarding_table_.get();
   }
 
+  // nullptr unless --background-flatten-strings is enabled.
+  BackgroundStringFlattener* background_string_flattener() const {
+    return background_string_flattener_.get();
+  }
+
   SharedStructTypeRegistry* shared_struct_type_registry() const {
     return is_shared_space_isolate()
                ? shared_struct_type_registry_.get()
@@ -1327,6 +1348,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  JsonShapeCache* json_shape_cache() const { return json_shape_cache_; }
+
   V8_INLINE HandleScopeData* handle_scope_data() {
     return &isolate_data_.handle_scope_data_;
   }
@@ -1878,6 +1901,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  // Returns the cached main-thread ReusableUnoptimizedCompileState, marking
+  // it as in use, so that back-to-back compiles reuse the AST Zone segments
+  // and AstValueFactory instead of re-allocating them. Returns nullptr if a
+  // compile is already using the cached state; callers then create their own.
+  ReusableUnoptimizedCompileState* AcquireReusableCompileState();
+  // Resets {state} for the next compile and releases it back to the cache.
+  void ReleaseReusableCompileState(ReusableUnoptimizedCompileState* state);
+
   bool IsInAnyContext(Tagged<Object> object, uint32_t index);
 
   void ClearKeptObjects();
@@ -1995,6 +2026,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void set_allow_atomics_wait(bool set) { allow_atomics_wait_ = set; }
   bool allow_atomics_wait() { return allow_atomics_wait_; }
 
+  // The NUMA node heap pages should preferably be allocated on, or -1 for no
+  // preference. See v8::Isolate::CreateParams::preferred_numa_node.
+  void set_preferred_numa_node(int node) { preferred_numa_node_ = node; }
+  int preferred_numa_node() const { return preferred_numa_node_; }
+
   // Register a finalizer to be called at isolate teardown.
   void RegisterManagedPtrDestructor(ManagedPtrDestructor* finalizer);
 
@@ -2231,6 +2267,29 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     battery_saver_mode_enabled_ = battery_saver_mode_enabled;
   }
 
+  // The priority at which background GC jobs (e.g. concurrent sweeping) are
+  // posted to the platform for this isolate. Embedders lower this for bulk
+  // isolates whose background GC work would otherwise steal cores from
+  // latency-critical isolates in the same process, and raise it for
+  // interactive ones.
+  v8::TaskPriority background_gc_task_priority() const {
+    return background_gc_task_priority_;
+  }
+
+  void set_background_gc_task_priority(v8::TaskPriority priority) {
+    background_gc_task_priority_ = priority;
+  }
+
+  // Directory for the V8-managed on-disk code cache, empty if disabled. See
+  // v8::ScriptCompiler::SetCodeCacheDirectory.
+  const std::string& code_cache_directory() const {
+    return code_cache_directory_;
+  }
+
+  void set_code_cache_directory(std::string path) {
+    code_cache_directory_ = std::move(path);
+  }
+
  private:
   explicit Isolate(std::unique_ptr<IsolateAllocator> isolate_allocator);
   ~Isolate();
@@ -2358,6 +2417,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   std::unique_ptr<StringTable> string_table_;
   std::unique_ptr<StringForwardingTable> string_forwarding_table_;
 
+  std::unique_ptr<BackgroundStringFlattener> background_string_flattener_;
+
   const int id_;
   std::atomic<EntryStackItem*> entry_stack_ = nullptr;
   int stack_trace_nesting_level_ = 0;
@@ -2387,6 +2448,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  JsonShapeCache* json_shape_cache_ = nullptr;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
@@ -2424,6 +2486,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::atomic<bool> battery_saver_mode_enabled_ = false;
 
+  std::atomic<v8::TaskPriority> background_gc_task_priority_ =
+      v8::TaskPriority::kUserVisible;
+
+  std::string code_cache_directory_;
+
   // Helper function for RunHostImportModuleDynamicallyCallback.
   // Unpacks import attributes, if present, from the second argument to dynamic
   // import() and returns them in a FixedArray, sorted by code point order of
@@ -2512,6 +2579,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+
+  // Lazily-created compile state shared by sequential main-thread compiles;
+  // see AcquireReusableCompileState.
+  std::unique_ptr<ReusableUnoptimizedCompileState> reusable_compile_state_;
+  bool reusable_compile_state_in_use_ = false;
 #ifdef V8_ENABLE_SPARKPLUG
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #endif  // V8_ENABLE_SPARKPLUG
@@ -2636,6 +2708,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool allow_atomics_wait_ = true;
 
+  int preferred_numa_node_ = -1;
+
   // Cache for the JavaScriptCompileHintsMagic origin trial.
   // TODO(v8:13917): Remove when the origin trial is removed.
   std::atomic<bool> allow_compile_hints_magic_ = false;
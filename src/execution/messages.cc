@@ -4,6 +4,7 @@
 
 #include "src/execution/messages.h"
 
+#include <cstring>
 #include <memory>
 
 #include "src/api/api-inl.h"
@@ -446,6 +447,14 @@ MaybeHandle<String> MessageFormatter::TryFormat(
     base::Vector<const Handle<String>> args) {
   const char* template_string = TemplateString(index);
 
+  // Messages without substitutions are constant; hand out the internalized
+  // template instead of rebuilding the same string on every throw. This
+  // matters for code that throws and catches typed errors at a high rate
+  // without ever reading the message.
+  if (args.empty() && strchr(template_string, '%') == nullptr) {
+    return isolate->factory()->InternalizeUtf8String(template_string);
+  }
+
   IncrementalStringBuilder builder(isolate);
 
   // TODO(14386): Get this list empty.
@@ -1079,12 +1088,19 @@ MaybeHandle<Object> ErrorUtils::GetFormattedStack(
   if (IsFixedArray(*lookup.error_stack)) {
     Handle<JSObject> error_object =
         lookup.error_stack_symbol_holder.ToHandleChecked();
+    Handle<FixedArray> call_site_infos =
+        Handle<FixedArray>::cast(lookup.error_stack);
+    if (CallSiteInfo::IsCompactStackTrace(*call_site_infos)) {
+      // The stack trace was captured in the compact deferred form; this is
+      // the first access, so materialize the CallSiteInfos now. No need to
+      // remember them, the formatted stack replaces them below anyway.
+      call_site_infos =
+          CallSiteInfo::MaterializeCompactStackTrace(isolate, call_site_infos);
+    }
     Handle<Object> formatted_stack;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, formatted_stack,
-        FormatStackTrace(isolate, error_object,
-                         Handle<FixedArray>::cast(lookup.error_stack)),
-        Object);
+        FormatStackTrace(isolate, error_object, call_site_infos), Object);
     RETURN_ON_EXCEPTION(
         isolate,
         Object::SetProperty(isolate, error_object,
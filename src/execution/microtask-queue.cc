@@ -10,6 +10,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
+#include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/microtask-inl.h"
@@ -28,6 +29,8 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kRemainingBudgetOffset =
+    OFFSET_OF(MicrotaskQueue, remaining_budget_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
 
@@ -149,6 +152,11 @@ class SetIsRunningMicrotasks {
 }  // namespace
 
 int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
+  return RunMicrotasks(isolate, kUnlimitedBudget);
+}
+
+int MicrotaskQueue::RunMicrotasks(Isolate* isolate, intptr_t max_count) {
+  DCHECK_GT(max_count, 0);
   SetIsRunningMicrotasks scope(&is_running_microtasks_);
   v8::Isolate::SuppressMicrotaskExecutionScope suppress(
       reinterpret_cast<v8::Isolate*>(isolate), this);
@@ -173,7 +181,9 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     TRACE_EVENT_BEGIN0("v8.execute", "RunMicrotasks");
     {
       TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.RunMicrotasks");
+      remaining_budget_ = max_count;
       maybe_result = Execution::TryRunMicrotasks(isolate, this);
+      remaining_budget_ = kUnlimitedBudget;
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
     }
@@ -193,12 +203,59 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     OnCompleted(isolate);
     return -1;
   }
-  DCHECK_EQ(0, size());
+  DCHECK_IMPLIES(max_count == kUnlimitedBudget, size() == 0);
   OnCompleted(isolate);
 
   return processed_microtask_count;
 }
 
+void MicrotaskQueue::DiscardMicrotasks() {
+  DCHECK(!IsRunningMicrotasks());
+  delete[] ring_buffer_;
+  ring_buffer_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  start_ = 0;
+}
+
+int MicrotaskQueue::PerformCheckpointWithBudget(v8::Isolate* v8_isolate,
+                                                const Budget& budget) {
+  if (!ShouldPerfomCheckpoint()) return 0;
+  base::Optional<MicrotasksScope> microtasks_scope;
+  if (microtasks_policy_ == v8::MicrotasksPolicy::kScoped) {
+    // See the comment in PerformCheckpointInternal.
+    microtasks_scope.emplace(v8_isolate, this,
+                             v8::MicrotasksScope::kDoNotRunMicrotasks);
+  }
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+
+  const bool use_deadline = budget.max_duration_ms >= 0;
+  base::TimeTicks deadline;
+  if (use_deadline) {
+    deadline = base::TimeTicks::Now() +
+               base::TimeDelta::FromMillisecondsD(budget.max_duration_ms);
+  }
+  intptr_t count_remaining =
+      budget.max_count < 0 ? kUnlimitedBudget : budget.max_count;
+
+  // The RunMicrotasks builtin only understands a count budget, so apply the
+  // time budget by draining in bounded slices and re-checking the deadline in
+  // between.
+  static constexpr intptr_t kTimeBudgetSliceSize = 64;
+  int total_processed_count = 0;
+  while (size_ > 0 && count_remaining > 0) {
+    intptr_t slice = count_remaining;
+    if (use_deadline) slice = std::min(slice, kTimeBudgetSliceSize);
+    int processed_count = RunMicrotasks(isolate, slice);
+    if (processed_count < 0) return -1;
+    total_processed_count += processed_count;
+    count_remaining -= processed_count;
+    if (use_deadline && base::TimeTicks::Now() >= deadline) break;
+  }
+  isolate->ClearKeptObjects();
+  return total_processed_count;
+}
+
 void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
   if (size_) {
     // Iterate pending Microtasks as root objects to avoid the write barrier for
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -47,6 +48,11 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
     if (!ShouldPerfomCheckpoint()) return;
     PerformCheckpointInternal(isolate);
   }
+  int PerformCheckpointWithBudget(v8::Isolate* isolate,
+                                  const Budget& budget) override;
+  size_t PendingMicrotaskCount() const override {
+    return static_cast<size_t>(size_);
+  }
 
   bool ShouldPerfomCheckpoint() const {
     return !IsRunningMicrotasks() && !GetMicrotasksScopeDepth() &&
@@ -65,6 +71,15 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // of microtasks that ran in this round.
   int RunMicrotasks(Isolate* isolate);
 
+  // Like RunMicrotasks, but runs at most |max_count| Microtasks; the rest
+  // (including Microtasks enqueued while running) stay in the queue.
+  // |max_count| must be positive.
+  int RunMicrotasks(Isolate* isolate, intptr_t max_count);
+
+  // Drops all pending Microtasks without running them. Used when an isolate
+  // is reset for reuse.
+  void DiscardMicrotasks();
+
   // Iterate all pending Microtasks in this queue as strong roots, so that
   // builtins can update the queue directly without the write barrier.
   void IterateMicrotasks(RootVisitor* visitor);
@@ -112,9 +127,16 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kRemainingBudgetOffset;
 
   static const intptr_t kMinimumCapacity;
 
+  // Sentinel for |remaining_budget_| meaning no count limit. The RunMicrotasks
+  // builtin decrements the budget unconditionally, so the sentinel is simply a
+  // count that can never be exhausted in practice.
+  static constexpr intptr_t kUnlimitedBudget =
+      std::numeric_limits<intptr_t>::max();
+
  private:
   void PerformCheckpointInternal(v8::Isolate* v8_isolate);
 
@@ -134,6 +156,10 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // The number of Microtasks the RunMicrotasks builtin may still run before it
+  // returns; set by RunMicrotasks and read and decremented by the builtin.
+  intptr_t remaining_budget_ = kUnlimitedBudget;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
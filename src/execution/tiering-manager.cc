@@ -4,6 +4,7 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include "include/v8-script.h"
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler.h"
@@ -325,7 +326,16 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
 
     // OSR kicks in only once we've previously decided to tier up, but we are
     // still in a lower-tier frame (this implies a long-running loop).
-    TryIncrementOsrUrgency(isolate_, function);
+    if (v8_flags.fast_osr_for_startup_loops &&
+        function->feedback_vector()->invocation_count() <= 1) {
+      // The function is stuck in its very first invocation, i.e. this is a
+      // one-shot startup loop. Ramping the urgency up one interrupt budget
+      // drain at a time would burn tens of thousands of back edges before the
+      // loop becomes eligible; make any loop depth eligible right away.
+      TryRequestOsrAtNextOpportunity(isolate_, function);
+    } else {
+      TryIncrementOsrUrgency(isolate_, function);
+    }
 
     // Return unconditionally and don't run through the optimization decision
     // again; we've already decided to tier up previously.
@@ -469,8 +479,61 @@ TieringManager::OnInterruptTickScope::OnInterruptTickScope() {
                "V8.MarkCandidatesForOptimization");
 }
 
+void TieringManager::StartSelfTimeAttribution() {
+  self_time_entries_.clear();
+  last_self_time_tick_ = base::TimeTicks::Now();
+  self_time_attribution_enabled_ = true;
+}
+
+void TieringManager::StopSelfTimeAttribution() {
+  self_time_attribution_enabled_ = false;
+  self_time_entries_.clear();
+}
+
+void TieringManager::GetSelfTimeAttribution(
+    v8::Isolate::FunctionSelfTimeCallback callback, void* data) const {
+  for (const auto& it : self_time_entries_) {
+    const SelfTimeEntry& entry = it.second;
+    v8::Isolate::FunctionSelfTime function_self_time;
+    function_self_time.name = entry.name.c_str();
+    function_self_time.script_id = entry.script_id;
+    function_self_time.start_position = entry.start_position;
+    function_self_time.ticks = entry.ticks;
+    function_self_time.self_time_ms = entry.self_time.InMillisecondsF();
+    callback(function_self_time, data);
+  }
+}
+
+void TieringManager::RecordSelfTimeTick(Tagged<JSFunction> function) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  const int script_id = IsScript(shared->script())
+                            ? Script::cast(shared->script())->id()
+                            : v8::UnboundScript::kNoScriptId;
+  const int start_position = shared->StartPosition();
+  const uint64_t key =
+      (static_cast<uint64_t>(static_cast<uint32_t>(script_id)) << 32) |
+      static_cast<uint32_t>(start_position);
+  SelfTimeEntry& entry = self_time_entries_[key];
+  if (entry.ticks == 0) {
+    entry.name = shared->DebugNameCStr().get();
+    entry.script_id = script_id;
+    entry.start_position = start_position;
+  }
+  entry.ticks++;
+  // Credit the wall time since the previous budget interrupt to the function
+  // that triggered this one. This is approximate: time spent in callees that
+  // never tick is attributed to their caller.
+  entry.self_time += now - last_self_time_tick_;
+  last_self_time_tick_ = now;
+}
+
 void TieringManager::OnInterruptTick(Handle<JSFunction> function,
                                      CodeKind code_kind) {
+  if (V8_UNLIKELY(self_time_attribution_enabled_)) {
+    RecordSelfTimeTick(*function);
+  }
+
   IsCompiledScope is_compiled_scope(
       function->shared()->is_compiled_scope(isolate_));
 
@@ -6,7 +6,11 @@
 #define V8_EXECUTION_TIERING_MANAGER_H_
 
 #include <optional>
+#include <string>
+#include <unordered_map>
 
+#include "include/v8-isolate.h"
+#include "src/base/platform/time.h"
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/utils/allocation.h"
@@ -42,6 +46,13 @@ class TieringManager {
 
   void MarkForTurboFanOptimization(Tagged<JSFunction> function);
 
+  // Approximate per-function self-time counters fed by bytecode budget
+  // interrupts; see Isolate::StartFunctionSelfTimeAttribution.
+  void StartSelfTimeAttribution();
+  void StopSelfTimeAttribution();
+  void GetSelfTimeAttribution(v8::Isolate::FunctionSelfTimeCallback callback,
+                              void* data) const;
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -64,7 +75,23 @@ class TieringManager {
     DisallowGarbageCollection no_gc;
   };
 
+  struct SelfTimeEntry {
+    std::string name;
+    int script_id;
+    int start_position;
+    size_t ticks = 0;
+    base::TimeDelta self_time;
+  };
+
+  void RecordSelfTimeTick(Tagged<JSFunction> function);
+
   Isolate* const isolate_;
+
+  // Keyed by (script id, start position), which is stable across GCs, unlike
+  // the SharedFunctionInfo itself.
+  std::unordered_map<uint64_t, SelfTimeEntry> self_time_entries_;
+  base::TimeTicks last_self_time_tick_;
+  bool self_time_attribution_enabled_ = false;
 };
 
 }  // namespace internal
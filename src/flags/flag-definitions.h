@@ -769,6 +769,9 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
+DEFINE_BOOL(large_page_pooling, false,
+            "pool freed large pages of a matching size class for reuse by "
+            "subsequent large object allocations")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
            "in full GCs")
@@ -794,6 +797,10 @@ DEFINE_BOOL(trace_pretenuring_statistics, false,
 DEFINE_BOOL(track_field_types, true, "track field types")
 DEFINE_BOOL(trace_block_coverage, false,
             "trace collected block coverage information")
+DEFINE_BOOL(optimized_code_coverage, false,
+            "keep Maglev/TurboFan enabled while collecting precise-count "
+            "code coverage; invocation counts of optimized functions become "
+            "lower bounds, block counts are unaffected")
 DEFINE_BOOL(trace_protector_invalidation, false,
             "trace protector cell invalidations")
 
@@ -828,6 +835,10 @@ DEFINE_INT(invocation_count_for_maglev, 400,
            "invocation count required for optimizing with Maglev")
 DEFINE_INT(invocation_count_for_maglev_osr, 100,
            "invocation count required for maglev OSR")
+DEFINE_BOOL(fast_osr_for_startup_loops, true,
+            "request OSR at maximum urgency for functions that are still in "
+            "their first invocation when a tier-up request is pending, so "
+            "one-shot long-running loops enter optimized code sooner")
 DEFINE_BOOL(osr_from_maglev, false,
             "whether we try to OSR to Turbofan from OSR'd Maglev")
 DEFINE_BOOL(always_osr_from_maglev, false,
@@ -881,6 +892,9 @@ DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "the same object")
 DEFINE_BOOL(ignition_elide_redundant_tdz_checks, true,
             "elide TDZ checks dominated by other TDZ checks")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse common bytecode pairs into superinstructions when writing "
+            "bytecode arrays")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
@@ -949,10 +963,17 @@ DEFINE_UINT(
     "max number of threads that concurrent Sparkplug can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
+DEFINE_BOOL(concurrent_sparkplug_for_scripts, false,
+            "eagerly compile all compiled functions of a script with "
+            "concurrent Sparkplug after top-level compilation finishes")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
+DEFINE_BOOL_READONLY(concurrent_sparkplug_for_scripts, false,
+                     "eagerly compile all compiled functions of a script with "
+                     "concurrent Sparkplug after top-level compilation "
+                     "finishes")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
@@ -979,10 +1000,26 @@ DEFINE_EXPERIMENTAL_FEATURE(
 // (enabled by --shared-string-table) are not supported using a single shared
 // forwarding table.
 DEFINE_NEG_IMPLICATION(shared_string_table, always_use_string_forwarding_table)
+DEFINE_EXPERIMENTAL_FEATURE(
+    concurrent_string_internalization,
+    "internalize duplicates of string-table entries in place during "
+    "concurrent marking")
+// Concurrently recorded forwarding indices are only valid when all strings go
+// through the forwarding table; MakeThin-based internalization does not expect
+// them.
+DEFINE_IMPLICATION(concurrent_string_internalization,
+                   always_use_string_forwarding_table)
+DEFINE_NEG_IMPLICATION(shared_string_table, concurrent_string_internalization)
 
 DEFINE_BOOL(transition_strings_during_gc_with_stack, false,
             "Transition strings during a full GC with stack")
 
+DEFINE_BOOL(background_flatten_strings, false,
+            "proactively flatten large cons strings on a background thread")
+DEFINE_INT(background_flatten_min_length, 1024 * 1024,
+           "minimum cons string length (in characters) for proactive "
+           "background flattening")
+
 DEFINE_SIZE_T(initial_shared_heap_size, 0,
               "initial size of the shared heap (in Mbytes); "
               "other heap size flags (e.g. initial_heap_size) take precedence")
@@ -1123,6 +1160,9 @@ DEFINE_BOOL_READONLY(fixed_array_bounds_checks, true,
 DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
+DEFINE_BOOL(turbo_spill_stats_nvp, false,
+            "print per-function spill statistics after register allocation in "
+            "machine-readable format")
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
@@ -1191,8 +1231,31 @@ DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
     "(requires that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_STRING(turbo_inline_profile_output, nullptr,
+              "write the hot call edges observed in feedback vectors to this "
+              "file on isolate teardown, for later use with "
+              "--turbo-inline-profile-input")
+DEFINE_STRING(turbo_inline_profile_input, nullptr,
+              "read a call-edge profile written by "
+              "--turbo-inline-profile-output and use the recorded call "
+              "frequencies to guide inlining while feedback is still sparse")
 DEFINE_BOOL(reorder_builtins, false,
             "enable builtin reordering when run mksnapshot.")
+DEFINE_BOOL(embedded_builtins_huge_pages, false,
+            "advise transparent huge pages for the embedded builtins code "
+            "section at startup (Linux only, best effort); most effective "
+            "with a snapshot built with --reorder-builtins, which packs the "
+            "hottest builtins into the fewest huge pages")
+
+DEFINE_BOOL(huge_pages_for_heap, false,
+            "advise transparent huge pages for the pointer compression cage "
+            "and code range reservations, so committed heap pages get huge "
+            "page backing (Linux only, best effort)")
+
+DEFINE_BOOL(huge_pages_for_large_array_buffers, false,
+            "advise transparent huge pages for the committed portion of "
+            "large resizable and growable (shared) array buffer backing "
+            "stores (Linux only, best effort)")
 
 DEFINE_BOOL(abort_on_bad_builtin_profile_data, false,
             "flag for mksnapshot, abort if builtins profile can't be applied")
@@ -1210,6 +1273,9 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_align_cold_blocks, true,
+            "align the first deferred block in TurboFan code so that hot code "
+            "does not share its last instruction fetch line with cold code")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
@@ -1249,6 +1315,9 @@ DEFINE_BOOL_READONLY(
     turbo_compress_frame_translations, false,
     "compress deoptimization frame translations (experimental)")
 #endif  // V8_USE_ZLIB
+DEFINE_BOOL(share_frame_translations, true,
+            "reuse identical deoptimization frame translations across "
+            "optimized code objects")
 DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
@@ -1347,6 +1416,12 @@ DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, false,
             "profile guided optimization for empty feedback vector")
 DEFINE_INT(invocation_count_for_early_optimization, 20,
            "invocation count threshold for early optimization")
+DEFINE_BOOL(serialize_cached_tiering_decisions, false,
+            "persist early tiering decisions in code caches, so that "
+            "deserialized functions tier up to Maglev/Turbofan at the early "
+            "optimization budget")
+DEFINE_WEAK_IMPLICATION(serialize_cached_tiering_decisions,
+                        profile_guided_optimization)
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1401,6 +1476,13 @@ DEFINE_BOOL(wasm_dynamic_tiering, true,
 DEFINE_NEG_NEG_IMPLICATION(liftoff, wasm_dynamic_tiering)
 DEFINE_INT(wasm_tiering_budget, 13'000'000,
            "budget for dynamic tiering (rough approximation of bytes executed")
+DEFINE_BOOL(wasm_tiering_sampler, false,
+            "also drive wasm tier-up by periodically sampling the main "
+            "thread's pc, so that loop-dominated functions with few calls "
+            "tier up promptly")
+DEFINE_INT(wasm_tiering_sampler_interval, 10,
+           "sampling interval in ms for --wasm-tiering-sampler")
+DEFINE_IMPLICATION(wasm_tiering_sampler, wasm_dynamic_tiering)
 DEFINE_INT(wasm_wrapper_tiering_budget, wasm::kGenericWrapperBudget,
            "budget for wrapper tierup (number of calls until tier-up)")
 DEFINE_INT(max_wasm_functions, wasm::kV8MaxWasmFunctions,
@@ -1443,6 +1525,10 @@ DEFINE_DEBUG_BOOL(
 // We can't tier up (from Liftoff to TurboFan) in single-threaded mode, hence
 // disable tier up in that configuration for now.
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_tier_up)
+// The tiering sampler needs a background thread and is inherently
+// non-deterministic.
+DEFINE_NEG_IMPLICATION(single_threaded, wasm_tiering_sampler)
+DEFINE_NEG_IMPLICATION(predictable, wasm_tiering_sampler)
 DEFINE_DEBUG_BOOL(trace_liftoff, false,
                   "trace Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(trace_wasm_memory, false,
@@ -1634,6 +1720,14 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(adaptive_new_space_sizing, false,
+            "resize the new space between GCs based on survival rate and the "
+            "scavenge pause target instead of the static grow/shrink "
+            "heuristics")
+DEFINE_FLOAT(scavenge_pause_target_ms, 4.0,
+             "scavenge pause target used by --adaptive-new-space-sizing; the "
+             "new space is shrunk when the predicted scavenge pause exceeds "
+             "this target")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1645,6 +1739,14 @@ DEFINE_BOOL(huge_max_old_generation_size, true,
             "Increase max size of the old space to 4 GB for x64 systems with"
             "the physical memory bigger than 16 GB")
 DEFINE_SIZE_T(initial_old_space_size, 0, "initial old space size (in Mbytes)")
+DEFINE_INT(number_string_cache_size, 0,
+           "maximum number of entries in the number to string cache, rounded "
+           "up to a power of two (0 derives the size from the max semi-space "
+           "size)")
+DEFINE_BOOL(adaptive_number_string_cache, false,
+            "grow the number to string cache geometrically once its hit rate "
+            "drops below one half, instead of jumping to the maximum size on "
+            "the first conflict")
 DEFINE_BOOL(separate_gc_phases, false,
             "young and full garbage collection phases are not overlapping")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
@@ -1667,6 +1769,12 @@ DEFINE_BOOL(trace_gc_nvp, false,
             "after each garbage collection")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
+DEFINE_INT(finalization_registry_cleanup_batch_size, 16384,
+           "maximum number of FinalizationRegistry cells to clean up per "
+           "cleanup task (0 for no limit)")
+DEFINE_BOOL(trace_finalization_registry_cleanup, false,
+            "print one trace line following each FinalizationRegistry "
+            "cleanup task")
 DEFINE_BOOL(trace_memory_reducer, false, "print memory reducer behavior")
 DEFINE_BOOL(trace_idle_notification, false,
             "print one trace line following each idle notification")
@@ -1700,6 +1808,9 @@ DEFINE_INT(trace_duplicate_threshold_kb, 0,
 DEFINE_BOOL(trace_fragmentation, false, "report fragmentation for old space")
 DEFINE_BOOL(trace_fragmentation_verbose, false,
             "report fragmentation for old space (detailed)")
+DEFINE_BOOL(trace_fragmentation_stats, false,
+            "report per-page fragmentation statistics with dominant object "
+            "types after full GC marking")
 DEFINE_BOOL(minor_ms_trace_fragmentation, false,
             "trace fragmentation after marking")
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
@@ -1725,9 +1836,8 @@ DEFINE_UINT(minor_gc_task_trigger, 80,
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
-DEFINE_EXPERIMENTAL_FEATURE(
-    cppgc_young_generation,
-    "run young generation garbage collections in Oilpan")
+DEFINE_BOOL(cppgc_young_generation, false,
+            "run young generation garbage collections in Oilpan")
 // CppGC young generation (enables unified young heap) is based on Minor MS.
 DEFINE_IMPLICATION(cppgc_young_generation, minor_ms)
 // Unified young generation disables the unmodified wrapper reclamation
@@ -1746,9 +1856,18 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(array_buffer_pooling, false,
+            "recycle freed array buffer backing stores of the same "
+            "power-of-two size class in the default allocator")
+DEFINE_BOOL(parallel_array_sort, false,
+            "sort large typed arrays without a comparison function with a "
+            "parallel merge sort")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
+DEFINE_UINT(marking_slot_batch_size, 16,
+            "number of tagged slots decoded and prefetched ahead of marking "
+            "them; 0 or 1 disables batching")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
@@ -1761,6 +1880,9 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_BOOL(parallel_weak_callbacks, true,
+            "dispatch first pass weak callbacks that the embedder marked as "
+            "thread-safe on the job system")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1779,6 +1901,12 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_high_watermark, 8 * MB,
+              "maximum number of bytes of zone segments cached for reuse "
+              "across zones (0 disables the segment pool)")
+DEFINE_SIZE_T(zone_segment_pool_low_watermark, 4 * MB,
+              "number of cached zone segment bytes to trim the segment pool "
+              "down to when the high watermark is exceeded")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1825,6 +1953,9 @@ DEFINE_BOOL(memory_reducer_single_gc, false,
 DEFINE_WEAK_IMPLICATION(future, memory_reducer_single_gc)
 DEFINE_INT(memory_reducer_gc_count, 3,
            "Maximum number of memory reducer GCs scheduled")
+DEFINE_BOOL(memory_reducer_trims_memory, false,
+            "release committed but unused memory back to the OS after the "
+            "memory reducer finishes its GC sequence")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
@@ -1840,6 +1971,10 @@ DEFINE_BOOL(compact_with_stack, true,
 DEFINE_BOOL(
     compact_code_space_with_stack, true,
     "Perform code space compaction when finalizing a full GC with stack")
+DEFINE_BOOL(deduplicate_heap_numbers, false,
+            "Canonicalize bit-identical HeapNumbers referenced from "
+            "FixedArrays during full GCs; abandoned duplicates are reclaimed "
+            "by the following full GC")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
@@ -1858,6 +1993,13 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
+DEFINE_BOOL(flush_code_cost_model, false,
+            "weigh recompilation cost against reclaimed bytes when deciding "
+            "which old code to flush")
+DEFINE_BOOL(flush_source_positions, false,
+            "flush source position tables of bytecode that has not been "
+            "executed recently; they are recollected on demand")
+DEFINE_IMPLICATION(flush_source_positions, enable_lazy_source_positions)
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -2042,6 +2184,8 @@ DEFINE_BOOL(experimental_stack_trace_frames, false,
 DEFINE_BOOL(disallow_code_generation_from_strings, false,
             "disallow eval and friends")
 DEFINE_BOOL(expose_async_hooks, false, "expose async_hooks object")
+DEFINE_BOOL(expose_math_random_fill, false,
+            "expose nonstandard Math.randomFill(float64Array) batch generator")
 DEFINE_STRING(expose_cputracemark_as, nullptr,
               "expose cputracemark extension under the specified name")
 #ifdef ENABLE_VTUNE_TRACEMARK
@@ -2119,9 +2263,17 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_BOOL(shared_compilation_cache, false,
+            "share serialized code for identical scripts between isolates in "
+            "the same process")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
+// scope-info.cc, feedback-vector.cc
+DEFINE_BOOL(deduplicate_compilation_metadata, false,
+            "reuse identical ScopeInfo and FeedbackMetadata objects across "
+            "functions (experimental)")
+
 // lazy-compile-dispatcher.cc
 DEFINE_BOOL(lazy_compile_dispatcher, false, "enable compiler dispatcher")
 DEFINE_UINT(lazy_compile_dispatcher_max_threads, 0,
@@ -2136,11 +2288,23 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_streaming, false,
+            "spawn parallel compile tasks for lazy top-level functions of "
+            "streamed scripts, so that they are likely compiled by first call")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_streaming,
+                   lazy_compile_dispatcher)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
 
+// tick-sample.cc
+DEFINE_BOOL(cpu_profiler_frame_pointer_unwind, false,
+            "capture raw frame pointer chains in the CPU profiler instead of "
+            "performing a full stack walk; cheap enough for always-on "
+            "profiling, but attributes interpreted frames to the interpreter "
+            "trampoline rather than the executed bytecode")
+
 // debugger
 DEFINE_BOOL(
     trace_side_effect_free_debug_evaluate, false,
@@ -2180,6 +2344,16 @@ DEFINE_BOOL(clear_exceptions_on_js_entry, false,
 DEFINE_INT(histogram_interval, 600000,
            "time interval in ms for aggregating memory histograms")
 
+// logging/metrics.cc
+DEFINE_INT(metrics_flush_interval_ms, 1000,
+           "time interval in ms for flushing delayed metric events to the "
+           "embedder recorder")
+
+// heap/gc-tracer.cc
+DEFINE_BOOL(metrics_batch_young_gc_events, false,
+            "report young generation GC cycle metric events in batches "
+            "instead of one embedder callback per cycle")
+
 // heap-snapshot-generator.cc
 DEFINE_BOOL(heap_profiler_trace_objects, false,
             "Dump heap object allocations/movements/size_updates")
@@ -2218,6 +2392,12 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_INT(max_extended_polymorphic_map_count, 16,
+           "maximum number of valid maps to track in POLYMORPHIC state for "
+           "hot named access sites whose maps are all stable")
+DEFINE_INT(extended_polymorphism_invocation_threshold, 64,
+           "minimum feedback vector invocation count before a polymorphic IC "
+           "may grow beyond max_valid_polymorphic_map_count")
 
 // map-inl.h
 DEFINE_INT(fast_properties_soft_limit, 12,
@@ -2311,6 +2491,12 @@ DEFINE_BOOL(print_all_exceptions, false,
 DEFINE_BOOL(
     detailed_error_stack_trace, false,
     "includes arguments for each function call in the error stack frames array")
+DEFINE_BOOL(lazy_error_stack_capture, false,
+            "capture error stack traces in a compact deferred form and only "
+            "materialize the call sites when the stack trace is accessed")
+// Detailed stack traces need the per-frame parameters, which the compact
+// representation doesn't record.
+DEFINE_NEG_IMPLICATION(detailed_error_stack_trace, lazy_error_stack_capture)
 DEFINE_BOOL(adjust_os_scheduling_parameters, true,
             "adjust OS specific scheduling params for the isolate")
 DEFINE_BOOL(experimental_flush_embedded_blob_icache, true,
@@ -2360,6 +2546,12 @@ DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
 
+DEFINE_INT(rcs_sampling_interval, 0,
+           "when non-zero, runtime call stats count every call but only take "
+           "timestamps for one out of every N top-level scopes, scaling the "
+           "recorded time by N; cheap enough to leave enabled in production")
+DEFINE_VALUE_IMPLICATION(rcs_sampling_interval, rcs, true)
+
 // snapshot-common.cc
 DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
@@ -2381,6 +2573,16 @@ DEFINE_BOOL(regexp_tier_up, true,
             "enable regexp interpreter and tier up to the compiler after the "
             "number of executions set by the tier up ticks flag")
 DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
+DEFINE_BOOL(regexp_literal_prefilter, true,
+            "reject subjects that lack a regexp's mandatory literal "
+            "substring before entering the irregexp engine")
+DEFINE_BOOL(lazy_regexp_result_groups, false,
+            "materialize the groups object of regexp match results on first "
+            "access (observable through property descriptors)")
+DEFINE_INT(regexp_tier_up_cost, 0,
+           "if non-zero, tier up a regexp once the cumulative number of "
+           "subject characters it has interpreted exceeds this value, "
+           "instead of after a fixed number of executions")
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
@@ -2403,6 +2605,10 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_INT(experimental_regexp_quantifier_limit, 16,
+           "maximum bytecode replication of counted repetition accepted by "
+           "the experimental regexp engine; patterns over the limit fall "
+           "back to the backtracking engines")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -2412,6 +2618,10 @@ DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
             "to experimental engine if "
             "enable_experimental_regexp_engine_on_excessive_backtracks is set")
 
+DEFINE_BOOL(mergeable_read_only_pages, false,
+            "advise the kernel (MADV_MERGEABLE) that sealed read-only heap "
+            "pages may be deduplicated across processes; Linux only, requires "
+            "KSM to be enabled on the host")
 DEFINE_BOOL(trace_read_only_promotion, false,
             "trace the read-only promotion pass")
 DEFINE_BOOL(trace_read_only_promotion_verbose, false,
@@ -2651,6 +2861,11 @@ DEFINE_STRING(logfile, "v8.log",
               "Specify the name of the log file, use '-' for console, '+' for "
               "a temporary file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(log_buffering, false,
+            "Hand complete log lines to a background writer thread through a "
+            "circular buffer instead of writing them synchronously. Lines are "
+            "dropped when the buffer is full; the number of dropped lines is "
+            "recorded at the end of the log.")
 
 DEFINE_BOOL(log, false,
             "Minimal logging (no API, code, GC, suspect, or handles samples).")
@@ -2739,7 +2954,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 
 // --perf-prof-unwinding-info is available only on selected architectures.
 #if V8_TARGET_ARCH_ARM || V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64 || \
@@ -2841,6 +3055,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -2868,6 +3083,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -2883,6 +3099,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_callbacks)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
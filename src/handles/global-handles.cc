@@ -10,9 +10,11 @@
 #include <cstdint>
 #include <map>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/logging.h"
+#include "src/base/optional.h"
 #include "src/base/sanitizer/asan.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -40,6 +42,11 @@ namespace {
 
 constexpr size_t kBlockSize = 256;
 
+// Minimum number of pending first pass callbacks marked as thread-safe that
+// warrants fanning them out to the job system; smaller batches are invoked on
+// the calling thread.
+constexpr size_t kMinWeakCallbacksForParallelDispatch = 8;
+
 }  // namespace
 
 // Various internal weakness types for Persistent and Global handles.
@@ -207,6 +214,7 @@ class GlobalHandles::NodeSpace final {
   ~NodeSpace();
 
   V8_INLINE NodeType* Allocate();
+  void Reserve(size_t count);
 
   iterator begin() { return iterator(first_used_block_); }
   iterator end() { return iterator(nullptr); }
@@ -256,6 +264,21 @@ NodeType* GlobalHandles::NodeSpace<NodeType>::Allocate() {
   return node;
 }
 
+template <class NodeType>
+void GlobalHandles::NodeSpace<NodeType>::Reserve(size_t count) {
+  // Grow the free list upfront so that `count` subsequent allocations are
+  // pure free-list pops. Freshly added blocks are handed out front to back,
+  // so a reservation followed by a burst of creations also gets contiguous
+  // nodes.
+  size_t free_nodes = blocks_ * kBlockSize - handles_count_;
+  while (free_nodes < count) {
+    first_block_ = new BlockType(global_handles_, this, first_block_);
+    blocks_++;
+    PutNodesOnFreeList(first_block_);
+    free_nodes += kBlockSize;
+  }
+}
+
 template <class NodeType>
 void GlobalHandles::NodeSpace<NodeType>::PutNodesOnFreeList(BlockType* block) {
   for (int32_t i = kBlockSize - 1; i >= 0; --i) {
@@ -276,6 +299,14 @@ void GlobalHandles::NodeSpace<NodeType>::Release(NodeType* node) {
 
 template <class NodeType>
 void GlobalHandles::NodeSpace<NodeType>::Free(NodeType* node) {
+  // First pass callbacks marked as thread-safe reset their handles from
+  // worker threads; serialize free list updates while such a dispatch is in
+  // flight. See GlobalHandles::InvokeFirstPassWeakCallbacks().
+  base::Optional<base::MutexGuard> guard;
+  if (V8_UNLIKELY(global_handles_->parallel_first_pass_active_.load(
+          std::memory_order_relaxed))) {
+    guard.emplace(&global_handles_->first_pass_callback_mutex_);
+  }
   CHECK(node->IsInUse());
   node->Release(first_free_);
   first_free_ = node;
@@ -467,6 +498,13 @@ class GlobalHandles::Node final : public NodeBase<GlobalHandles::Node> {
     flags_ = NodeWeaknessType::update(flags_, weakness_type);
   }
 
+  bool has_thread_safe_callback() const {
+    return HasThreadSafeCallback::decode(flags_);
+  }
+  void set_has_thread_safe_callback(bool v) {
+    flags_ = HasThreadSafeCallback::update(flags_, v);
+  }
+
   bool IsWeak() const { return state() == WEAK; }
 
   bool IsInUse() const { return state() != FREE; }
@@ -500,12 +538,17 @@ class GlobalHandles::Node final : public NodeBase<GlobalHandles::Node> {
     set_state(WEAK);
     switch (type) {
       case v8::WeakCallbackType::kParameter:
+      case v8::WeakCallbackType::kParameterThreadSafe:
         set_weakness_type(WeaknessType::kCallback);
         break;
       case v8::WeakCallbackType::kInternalFields:
+      case v8::WeakCallbackType::kInternalFieldsThreadSafe:
         set_weakness_type(WeaknessType::kCallbackWithTwoEmbedderFields);
         break;
     }
+    set_has_thread_safe_callback(
+        type == v8::WeakCallbackType::kParameterThreadSafe ||
+        type == v8::WeakCallbackType::kInternalFieldsThreadSafe);
     set_parameter(parameter);
     weak_callback_ = phantom_callback;
   }
@@ -589,6 +632,9 @@ class GlobalHandles::Node final : public NodeBase<GlobalHandles::Node> {
   // when young nodes are proccessed.
   using IsInYoungList = NodeState::Next<bool, 1>;
   using NodeWeaknessType = IsInYoungList::Next<WeaknessType, 2>;
+  // Set iff the embedder registered the weak callback with a thread-safe
+  // v8::WeakCallbackType, allowing its first pass to run off the main thread.
+  using HasThreadSafeCallback = NodeWeaknessType::Next<bool, 1>;
 
   // Handle specific callback - might be a weak reference in disguise.
   WeakCallbackInfo<void>::Callback weak_callback_;
@@ -634,6 +680,10 @@ Handle<Object> GlobalHandles::Create(Address value) {
   return Create(Tagged<Object>(value));
 }
 
+void GlobalHandles::ReserveCapacity(size_t capacity) {
+  regular_nodes_->Reserve(capacity);
+}
+
 Handle<Object> GlobalHandles::CopyGlobal(Address* location) {
   DCHECK_NOT_NULL(location);
   GlobalHandles* global_handles =
@@ -822,6 +872,39 @@ void GlobalHandles::ClearListOfYoungNodes() {
   ClearListOfYoungNodesImpl(isolate_, &young_nodes_);
 }
 
+// Invokes first pass callbacks that the embedder registered with a
+// thread-safe v8::WeakCallbackType. The callbacks reset their handles from
+// worker threads, which is safe because free list updates are serialized
+// while the job is in flight; see NodeSpace::Free().
+class GlobalHandles::FirstPassCallbackJob final : public v8::JobTask {
+ public:
+  FirstPassCallbackJob(
+      Isolate* isolate,
+      std::vector<std::pair<Node*, PendingPhantomCallback>>* callbacks)
+      : isolate_(isolate), callbacks_(callbacks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      const size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= callbacks_->size()) return;
+      auto& pair = (*callbacks_)[index];
+      DCHECK_EQ(Node::NEAR_DEATH, pair.first->state());
+      pair.second.Invoke(isolate_, PendingPhantomCallback::kFirstPass);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t claimed =
+        std::min(next_.load(std::memory_order_relaxed), callbacks_->size());
+    return callbacks_->size() - claimed;
+  }
+
+ private:
+  Isolate* const isolate_;
+  std::vector<std::pair<Node*, PendingPhantomCallback>>* const callbacks_;
+  std::atomic<size_t> next_{0};
+};
+
 size_t GlobalHandles::InvokeFirstPassWeakCallbacks() {
   last_gc_custom_callbacks_ = 0;
   if (pending_phantom_callbacks_.empty()) return 0;
@@ -833,6 +916,37 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks() {
   std::vector<std::pair<Node*, PendingPhantomCallback>>
       pending_phantom_callbacks;
   pending_phantom_callbacks.swap(pending_phantom_callbacks_);
+
+  // Split off callbacks that may run on worker threads if there are enough of
+  // them to pay for the job system round trip.
+  std::vector<std::pair<Node*, PendingPhantomCallback>> parallel_callbacks;
+  if (v8_flags.parallel_weak_callbacks) {
+    const size_t thread_safe_count = static_cast<size_t>(std::count_if(
+        pending_phantom_callbacks.begin(), pending_phantom_callbacks.end(),
+        [](const std::pair<Node*, PendingPhantomCallback>& pair) {
+          return pair.first->has_thread_safe_callback();
+        }));
+    if (thread_safe_count >= kMinWeakCallbacksForParallelDispatch) {
+      auto split = std::stable_partition(
+          pending_phantom_callbacks.begin(), pending_phantom_callbacks.end(),
+          [](const std::pair<Node*, PendingPhantomCallback>& pair) {
+            return !pair.first->has_thread_safe_callback();
+          });
+      parallel_callbacks.assign(split, pending_phantom_callbacks.end());
+      pending_phantom_callbacks.erase(split, pending_phantom_callbacks.end());
+    }
+  }
+
+  std::unique_ptr<v8::JobHandle> job_handle;
+  if (!parallel_callbacks.empty()) {
+    parallel_first_pass_active_.store(true, std::memory_order_relaxed);
+    job_handle = V8::GetCurrentPlatform()->CreateJob(
+        v8::TaskPriority::kUserBlocking,
+        std::make_unique<FirstPassCallbackJob>(isolate(),
+                                               &parallel_callbacks));
+    job_handle->NotifyConcurrencyIncrease();
+  }
+
   // The initial pass callbacks must simply clear the nodes.
   for (auto& pair : pending_phantom_callbacks) {
     Node* node = pair.first;
@@ -849,6 +963,22 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks() {
     if (pair.second.callback()) second_pass_callbacks_.push_back(pair.second);
     freed_nodes++;
   }
+
+  if (job_handle) {
+    // Completion fence: every handle must have been reset before the caller
+    // may start the next GC cycle.
+    job_handle->Join();
+    parallel_first_pass_active_.store(false, std::memory_order_relaxed);
+    for (auto& pair : parallel_callbacks) {
+      Node* node = pair.first;
+      CHECK_WITH_MSG(Node::FREE == node->state(),
+                     "Handle not reset in first callback. See comments on "
+                     "|v8::WeakCallbackInfo|.");
+      if (pair.second.callback()) second_pass_callbacks_.push_back(pair.second);
+      freed_nodes++;
+    }
+  }
+
   last_gc_custom_callbacks_ = freed_nodes;
   return 0;
 }
@@ -5,6 +5,7 @@
 #ifndef V8_HANDLES_GLOBAL_HANDLES_H_
 #define V8_HANDLES_GLOBAL_HANDLES_H_
 
+#include <atomic>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -13,6 +14,7 @@
 #include "include/v8-callbacks.h"
 #include "include/v8-persistent-handle.h"
 #include "include/v8-profiler.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 #include "src/heap/heap.h"
 #include "src/objects/heap-object.h"
@@ -77,6 +79,11 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   template <typename T>
   inline Handle<T> Create(Tagged<T> value);
 
+  // Pre-allocates node blocks so that at least `capacity` handles can be
+  // created without growing the free list. Used by embedders that create
+  // handles in bulk.
+  void ReserveCapacity(size_t capacity);
+
   void RecordStats(HeapStats* stats);
 
   size_t InvokeFirstPassWeakCallbacks();
@@ -140,6 +147,7 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   template <class NodeType>
   class NodeSpace;
   class PendingPhantomCallback;
+  class FirstPassCallbackJob;
 
   void ApplyPersistentHandleVisitor(v8::PersistentHandleVisitor* visitor,
                                     Node* node);
@@ -162,6 +170,11 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   std::vector<PendingPhantomCallback> second_pass_callbacks_;
   bool second_pass_callbacks_task_posted_ = false;
   size_t last_gc_custom_callbacks_ = 0;
+  // Serializes free list updates while first pass callbacks marked as
+  // thread-safe by the embedder run on worker threads. See
+  // InvokeFirstPassWeakCallbacks().
+  base::Mutex first_pass_callback_mutex_;
+  std::atomic<bool> parallel_first_pass_active_{false};
 };
 
 class GlobalHandles::PendingPhantomCallback final {
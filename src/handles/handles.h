@@ -219,6 +219,15 @@ std::ostream& operator<<(std::ostream& os, Handle<T> handle);
 // garbage collector will no longer track the object stored in the
 // handle and may deallocate it.  The behavior of accessing a handle
 // for which the handle scope has been deleted is undefined.
+//
+// TODO(cheri): on capability hardware, handle blocks of Address-sized slots
+// double in size because Address becomes a 128-bit capability, which hurts
+// cache density in handle-heavy phases such as parsing and compilation. Once
+// the capability port lands (Address = uintcap_t and a Morello backend), the
+// blocks should instead store 64-bit offsets that dereference re-derives from
+// a per-scope base capability, restoring the footprint of the non-capability
+// build while keeping provenance via the base. This only becomes expressible
+// with the ported Address type and therefore cannot be prepared here yet.
 class V8_NODISCARD HandleScope {
  public:
   explicit V8_INLINE HandleScope(Isolate* isolate);
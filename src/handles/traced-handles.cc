@@ -4,6 +4,8 @@
 
 #include "src/handles/traced-handles.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 
 #include "include/v8-embedder-heap.h"
@@ -126,6 +128,21 @@ void TracedHandles::RefillUsableNodeBlocks() {
   DCHECK(!usable_blocks_.empty());
 }
 
+void TracedHandles::ReserveCapacity(size_t capacity) {
+  // Only cached empty blocks are counted towards the reservation; scanning
+  // partially used blocks for free nodes is not worth it since reservations
+  // are about avoiding block allocations during a burst of creations.
+  size_t available = 0;
+  for (auto* block : empty_blocks_) available += block->capacity();
+  for (auto* block : empty_block_candidates_) available += block->capacity();
+  while (available < capacity) {
+    auto* block = TracedNodeBlock::Create(*this);
+    block_size_bytes_ += block->size_bytes();
+    empty_blocks_.push_back(block);
+    available += block->capacity();
+  }
+}
+
 void TracedHandles::FreeNode(TracedNode* node) {
   auto& block = TracedNodeBlock::From(*node);
   if (V8_UNLIKELY(block.IsFull())) {
@@ -313,17 +330,21 @@ void TracedHandles::ClearListOfYoungNodes() {
 }
 
 void TracedHandles::DeleteEmptyBlocks() {
-  // Keep one node block around for fast allocation/deallocation patterns.
-  if (empty_blocks_.size() <= 1) return;
-
-  for (size_t i = 1; i < empty_blocks_.size(); i++) {
+  // Keep a few empty blocks around for fast allocation/deallocation
+  // patterns. The retained cache scales with the number of blocks in use so
+  // that churn-heavy embedders don't bounce on the allocator, while small
+  // users keep at most one block.
+  const size_t retained_blocks = std::max<size_t>(1, num_blocks_ / 4);
+  if (empty_blocks_.size() <= retained_blocks) return;
+
+  for (size_t i = retained_blocks; i < empty_blocks_.size(); i++) {
     auto* block = empty_blocks_[i];
     DCHECK(block->IsEmpty());
     DCHECK_GE(block_size_bytes_, block->size_bytes());
     block_size_bytes_ -= block->size_bytes();
     TracedNodeBlock::Delete(block);
   }
-  empty_blocks_.resize(1);
+  empty_blocks_.resize(retained_blocks);
   empty_blocks_.shrink_to_fit();
 }
 
@@ -370,22 +391,16 @@ void TracedHandles::ResetYoungDeadNodes(
 }
 
 namespace {
-void ComputeWeaknessForYoungObject(
-    EmbedderRootsHandler* handler, TracedNode* node,
-    bool should_call_is_root_for_default_traced_reference) {
-  DCHECK(!node->is_weak());
-  bool is_unmodified_api_object =
-      JSObject::IsUnmodifiedApiObject(node->location());
-  if (is_unmodified_api_object) {
-    FullObjectSlot slot = node->location();
-    const bool is_weak =
-        node->is_droppable() ||
-        (should_call_is_root_for_default_traced_reference &&
-         !handler->IsRoot(
-             *reinterpret_cast<v8::TracedReference<v8::Value>*>(&slot)));
-    node->set_weak(is_weak);
-  }
-}
+
+// Number of traced references passed to the embedder per AreRoots() and
+// ResetRoots() call. Batching avoids one virtual call across the API boundary
+// per reference.
+constexpr size_t kEmbedderBatchSize = 512;
+
+// The spans handed to the embedder reinterpret buffered slots as
+// TracedReferences, mirroring the single-handle protocol.
+static_assert(sizeof(v8::TracedReference<v8::Value>) == sizeof(FullObjectSlot));
+
 }  // namespace
 
 void TracedHandles::ComputeWeaknessForYoungObjects() {
@@ -403,11 +418,40 @@ void TracedHandles::ComputeWeaknessForYoungObjects() {
       handler->default_traced_reference_handling_ ==
       EmbedderRootsHandler::RootHandling::
           kQueryEmbedderForNonDroppableReferences;
+
+  // Handles whose liveness must be queried from the embedder, batched
+  // together with the nodes they belong to and the embedder's answers.
+  std::array<FullObjectSlot, kEmbedderBatchSize> query_slots;
+  std::array<TracedNode*, kEmbedderBatchSize> query_nodes;
+  std::array<bool, kEmbedderBatchSize> query_results;
+  size_t query_size = 0;
+
+  const auto flush_batch = [&]() {
+    if (query_size == 0) return;
+    handler->AreRoots({reinterpret_cast<const v8::TracedReference<v8::Value>*>(
+                           query_slots.data()),
+                       query_size},
+                      {query_results.data(), query_size});
+    for (size_t i = 0; i < query_size; ++i) {
+      if (!query_results[i]) query_nodes[i]->set_weak(true);
+    }
+    query_size = 0;
+  };
+
   for (TracedNode* node : young_nodes_) {
     if (!node->is_in_use()) continue;
-    ComputeWeaknessForYoungObject(
-        handler, node, should_call_is_root_for_default_traced_reference);
+    DCHECK(!node->is_weak());
+    if (!JSObject::IsUnmodifiedApiObject(node->location())) continue;
+    if (node->is_droppable()) {
+      node->set_weak(true);
+      continue;
+    }
+    if (!should_call_is_root_for_default_traced_reference) continue;
+    query_slots[query_size] = node->location();
+    query_nodes[query_size] = node;
+    if (++query_size == kEmbedderBatchSize) flush_batch();
   }
+  flush_batch();
 }
 
 void TracedHandles::ProcessYoungObjects(
@@ -423,6 +467,20 @@ void TracedHandles::ProcessYoungObjects(
     cpp_heap->EnterNoGCScope();
   }
 
+  // Handles whose objects are dead and that must be reset by the embedder,
+  // batched to avoid one ResetRoot() call per handle.
+  std::array<FullObjectSlot, kEmbedderBatchSize> reset_slots;
+  size_t reset_size = 0;
+
+  const auto flush_batch = [&]() {
+    if (reset_size == 0) return;
+    handler->ResetRoots(
+        {reinterpret_cast<const v8::TracedReference<v8::Value>*>(
+             reset_slots.data()),
+         reset_size});
+    reset_size = 0;
+  };
+
   for (TracedNode* node : young_nodes_) {
     if (!node->is_in_use()) continue;
 
@@ -430,9 +488,8 @@ void TracedHandles::ProcessYoungObjects(
     CHECK_IMPLIES(!node->is_weak(), !should_reset);
     if (should_reset) {
       CHECK(!is_marking_);
-      FullObjectSlot slot = node->location();
-      handler->ResetRoot(
-          *reinterpret_cast<v8::TracedReference<v8::Value>*>(&slot));
+      reset_slots[reset_size] = node->location();
+      if (++reset_size == kEmbedderBatchSize) flush_batch();
       // We cannot check whether a node is in use here as the reset behavior
       // depends on whether incremental marking is running when reclaiming
       // young objects.
@@ -446,6 +503,7 @@ void TracedHandles::ProcessYoungObjects(
       }
     }
   }
+  flush_batch();
 
   if (auto* cpp_heap = CppHeap::From(isolate_->heap()->cpp_heap())) {
     cpp_heap->LeaveNoGCScope();
@@ -247,6 +247,7 @@ class TracedNodeBlock final {
 
   bool IsFull() const { return used_ == capacity_; }
   bool IsEmpty() const { return used_ == 0; }
+  TracedNode::IndexType capacity() const { return capacity_; }
 
   size_t size_bytes() const {
     return sizeof(*this) + capacity_ * sizeof(TracedNode);
@@ -290,6 +291,11 @@ class V8_EXPORT_PRIVATE TracedHandles final {
                                   TracedReferenceStoreMode store_mode,
                                   TracedReferenceHandling reference_handling);
 
+  // Pre-allocates empty node blocks so that at least `capacity` handles can
+  // be created without hitting the allocator. Used by embedders that create
+  // handles in bulk.
+  void ReserveCapacity(size_t capacity);
+
   using NodeBounds = std::vector<std::pair<const void*, const void*>>;
   const NodeBounds GetNodeBounds() const;
 
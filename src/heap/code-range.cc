@@ -5,8 +5,10 @@
 #include "src/heap/code-range.h"
 
 #include "src/base/bits.h"
+#include "src/base/bounded-page-allocator.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/once.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/constants-arch.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -239,6 +241,14 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     }
     if (!params.page_allocator->DiscardSystemPages(base, size)) return false;
   }
+
+  if (v8_flags.huge_pages_for_heap) {
+    // Huge page advice is tracked per VMA and survives the permission changes
+    // that carve code pages out of the reservation, so advising the whole
+    // range upfront lets the kernel back code pages with huge pages as they
+    // get committed. Advisory, Linux-only and best effort.
+    base::OS::AdviseHugePages(reinterpret_cast<void*>(base()), size());
+  }
   return true;
 }
 
@@ -482,5 +492,16 @@ CodeRange* CodeRange::GetProcessWideCodeRange() {
   return process_wide_code_range_;
 }
 
+CodeRange::OccupancyStats CodeRange::GetOccupancyStats() const {
+  OccupancyStats stats;
+  base::BoundedPageAllocator* allocator = page_allocator();
+  stats.allocatable_size = allocator->size();
+  base::BoundedPageAllocator::Stats allocator_stats = allocator->GetStats();
+  stats.free_size = allocator_stats.free_size;
+  stats.free_region_count = allocator_stats.free_region_count;
+  stats.largest_free_region_size = allocator_stats.largest_free_region_size;
+  return stats;
+}
+
 }  // namespace internal
 }  // namespace v8
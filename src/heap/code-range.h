@@ -121,6 +121,18 @@ class CodeRange final : public VirtualMemoryCage {
   // initialized CodeRange. Otherwise returns a null pointer.
   V8_EXPORT_PRIVATE static CodeRange* GetProcessWideCodeRange();
 
+  // Occupancy of the allocatable region, for monitoring how fragmented the
+  // code range has become, e.g. under wasm module churn. A large
+  // |free_region_count| combined with a |largest_free_region_size| well below
+  // |free_size| indicates heavy fragmentation.
+  struct OccupancyStats {
+    size_t allocatable_size = 0;
+    size_t free_size = 0;
+    size_t free_region_count = 0;
+    size_t largest_free_region_size = 0;
+  };
+  V8_EXPORT_PRIVATE OccupancyStats GetOccupancyStats() const;
+
  private:
   static base::AddressRegion GetPreferredRegion(size_t radius_in_megabytes,
                                                 size_t allocate_page_size);
@@ -41,8 +41,12 @@
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
+#include "src/objects/instance-type-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/name-inl.h"
 #include "src/objects/slots-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/transitions-inl.h"
 #include "src/objects/visitors.h"
 #include "src/utils/utils-inl.h"
@@ -88,6 +92,20 @@ class ConcurrentMarkingVisitor final
     return false;
   }
 
+  V8_INLINE int VisitSeqOneByteString(Tagged<Map> map,
+                                      Tagged<SeqOneByteString> object) {
+    MaybeRecordInternalizedForwarding(map, object);
+    return FullMarkingVisitorBase<ConcurrentMarkingVisitor>::
+        VisitSeqOneByteString(map, object);
+  }
+
+  V8_INLINE int VisitSeqTwoByteString(Tagged<Map> map,
+                                      Tagged<SeqTwoByteString> object) {
+    MaybeRecordInternalizedForwarding(map, object);
+    return FullMarkingVisitorBase<ConcurrentMarkingVisitor>::
+        VisitSeqTwoByteString(map, object);
+  }
+
   template <typename TSlot>
   void RecordSlot(Tagged<HeapObject> object, TSlot slot,
                   Tagged<HeapObject> target) {
@@ -101,6 +119,32 @@ class ConcurrentMarkingVisitor final
   }
 
  private:
+  // Short strings are the most likely to be property-key-shaped and keep
+  // probing the string table cheap.
+  static constexpr int kMaxConcurrentInternalizationLength = 128;
+
+  // If {object} has a computed hash and an equal string is already in the
+  // string table, record a forwarding entry so that {object} is internalized
+  // in place at the end of this GC cycle. Purely opportunistic: the string
+  // table is only probed, never modified, and lost races are benign.
+  template <typename TString>
+  void MaybeRecordInternalizedForwarding(Tagged<Map> map,
+                                         Tagged<TString> object) {
+    if (!v8_flags.concurrent_string_internalization) return;
+    if (InstanceTypeChecker::IsInternalizedString(map->instance_type())) return;
+    // Young strings may be evacuated while the forwarding table entry's
+    // original-string pointer is live; restrict to old generation.
+    if (Heap::InYoungGeneration(object)) return;
+    if (object->length() > kMaxConcurrentInternalizationLength) return;
+    // Only strings whose regular hash was already computed are considered;
+    // this excludes integer indices and strings that already forward.
+    const uint32_t raw_hash_field = object->raw_hash_field(kAcquireLoad);
+    if (!Name::IsHash(raw_hash_field)) return;
+    Isolate* isolate = heap_->isolate();
+    isolate->string_table()->TryRecordInternalizedForwarding(isolate, object,
+                                                             raw_hash_field);
+  }
+
   void RecordRelocSlot(Tagged<InstructionStream> host, RelocInfo* rinfo,
                        Tagged<HeapObject> target) {
     if (!MarkCompactCollector::ShouldRecordRelocSlot(host, rinfo, target)) {
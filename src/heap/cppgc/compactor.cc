@@ -288,9 +288,12 @@ class CompactionState final {
     for (NormalPage* page : available_pages_) {
       SetMemoryInaccessible(page->PayloadStart(), page->PayloadSize());
       NormalPage::Destroy(page, FreeMemoryHandling::kDiscardWherePossible);
+      released_bytes_ += kPageSize;
     }
   }
 
+  size_t released_bytes() const { return released_bytes_; }
+
   void FinishCompactingPage(NormalPage* page) {
 #if DEBUG || defined(V8_USE_MEMORY_SANITIZER) || \
     defined(V8_USE_ADDRESS_SANITIZER)
@@ -330,6 +333,8 @@ class CompactionState final {
   // Additional pages in the current space that can be used as compaction
   // targets. Pages that remain available at the compaction can be released.
   Pages available_pages_;
+  // Bytes of page memory released back to the backend.
+  size_t released_bytes_ = 0;
 };
 
 enum class StickyBits : uint8_t {
@@ -392,8 +397,10 @@ void CompactPage(NormalPage* page, CompactionState& compaction_state,
   compaction_state.FinishCompactingPage(page);
 }
 
-void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
-                  StickyBits sticky_bits) {
+// Compacts |space| and returns the bytes of page memory that were released.
+size_t CompactSpace(NormalPageSpace* space,
+                    MovableReferences& movable_references,
+                    StickyBits sticky_bits) {
   using Pages = NormalPageSpace::Pages;
 
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -431,7 +438,7 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // arena's pages, package it up into a |CompactionState|.
 
   Pages pages = space->RemoveAllPages();
-  if (pages.empty()) return;
+  if (pages.empty()) return 0;
 
   CompactionState compaction_state(space, movable_references);
   for (BasePage* page : pages) {
@@ -441,6 +448,7 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
 
   compaction_state.FinishCompactingSpace();
   // Sweeping will verify object start bitmap of compacted space.
+  return compaction_state.released_bytes();
 }
 
 size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
@@ -473,7 +481,7 @@ bool Compactor::ShouldCompact(GCConfig::MarkingType marking_type,
     return false;
   }
 
-  if (enable_for_next_gc_for_testing_) {
+  if (enable_for_next_gc_ || enable_for_next_gc_for_testing_) {
     return true;
   }
 
@@ -524,17 +532,22 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
 
+  size_t released_bytes = 0;
   for (NormalPageSpace* space : compactable_spaces_) {
-    CompactSpace(
+    released_bytes += CompactSpace(
         space, movable_references,
         young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
   }
+  released_bytes_for_last_gc_ = released_bytes;
 
+  enable_for_next_gc_ = false;
   enable_for_next_gc_for_testing_ = false;
   is_enabled_ = false;
   return CompactableSpaceHandling::kIgnore;
 }
 
+void Compactor::EnableForNextGC() { enable_for_next_gc_ = true; }
+
 void Compactor::EnableForNextGCForTesting() {
   DCHECK_NULL(heap_.heap()->marker());
   enable_for_next_gc_for_testing_ = true;
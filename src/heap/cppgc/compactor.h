@@ -34,6 +34,15 @@ class V8_EXPORT_PRIVATE Compactor final {
     return compaction_worklists_.get();
   }
 
+  // Requests compaction for the next garbage collection cycle. The request is
+  // best effort and carried over to subsequent cycles as long as they cannot
+  // use compaction (e.g. because the stack may contain heap pointers).
+  void EnableForNextGC();
+  // Returns the bytes of page memory released by the most recent compaction.
+  size_t released_bytes_for_last_gc() const {
+    return released_bytes_for_last_gc_;
+  }
+
   void EnableForNextGCForTesting();
   bool IsEnabledForTesting() const { return is_enabled_; }
 
@@ -46,8 +55,11 @@ class V8_EXPORT_PRIVATE Compactor final {
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
+  size_t released_bytes_for_last_gc_ = 0;
+
   bool is_enabled_ = false;
   bool is_cancelled_ = false;
+  bool enable_for_next_gc_ = false;
   bool enable_for_next_gc_for_testing_ = false;
 };
 
@@ -23,6 +23,10 @@ class GarbageCollector {
   // GC invocation.
   virtual size_t epoch() const = 0;
 
+  // Returns whether the underlying heap supports generational (young
+  // generation) garbage collections.
+  virtual bool generational_gc_supported() const = 0;
+
   // Returns a non-null state if the stack state if overriden.
   virtual const EmbedderStackState* override_stack_state() const = 0;
 };
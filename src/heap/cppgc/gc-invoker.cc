@@ -27,6 +27,9 @@ class GCInvoker::GCInvokerImpl final : public GarbageCollector {
   const EmbedderStackState* override_stack_state() const final {
     return collector_->override_stack_state();
   }
+  bool generational_gc_supported() const final {
+    return collector_->generational_gc_supported();
+  }
 
  private:
   class GCTask final : public cppgc::Task {
@@ -144,5 +147,9 @@ const EmbedderStackState* GCInvoker::override_stack_state() const {
   return impl_->override_stack_state();
 }
 
+bool GCInvoker::generational_gc_supported() const {
+  return impl_->generational_gc_supported();
+}
+
 }  // namespace internal
 }  // namespace cppgc
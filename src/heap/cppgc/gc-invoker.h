@@ -38,6 +38,7 @@ class V8_EXPORT_PRIVATE GCInvoker final : public GarbageCollector {
   void StartIncrementalGarbageCollection(GCConfig) final;
   size_t epoch() const final;
   const EmbedderStackState* override_stack_state() const final;
+  bool generational_gc_supported() const final;
 
  private:
   class GCInvokerImpl;
@@ -128,6 +128,7 @@ class V8_EXPORT_PRIVATE HeapBase : public cppgc::HeapHandle {
   std::unique_ptr<MarkerBase>& GetMarkerRefForTesting() { return marker_; }
 
   Compactor& compactor() { return compactor_; }
+  const Compactor& compactor() const { return compactor_; }
 
   ObjectAllocator& object_allocator() { return object_allocator_; }
   const ObjectAllocator& object_allocator() const { return object_allocator_; }
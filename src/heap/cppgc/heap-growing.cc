@@ -25,6 +25,19 @@ constexpr double kMaximumLimitRatioForIncrementalGC = 0.9;
 // Minimum ratio between limit for incremental GC and limit for atomic GC
 // (to guarantee that limit is not too close to current allocated size).
 constexpr double kMinimumLimitRatioForIncrementalGC = 0.5;
+
+// Ratio of the atomic GC headroom that is used as young generation capacity
+// for generational heaps. The ratio starts at the initial value and is adapted
+// based on the survival rate of the previous minor GC. Capping it at the
+// minimum limit ratio for incremental GC guarantees that minor GCs are
+// scheduled before major GCs take over.
+constexpr double kInitialYoungCapacityRatio = 0.25;
+constexpr double kMinimumYoungCapacityRatio = 0.05;
+constexpr double kMaximumYoungCapacityRatio = kMinimumLimitRatioForIncrementalGC;
+// Survival rates of a minor GC above (below) which the young generation
+// capacity is doubled (halved).
+constexpr double kHighSurvivalRate = 0.75;
+constexpr double kLowSurvivalRate = 0.25;
 }  // namespace
 
 class HeapGrowing::HeapGrowingImpl final
@@ -45,6 +58,7 @@ class HeapGrowing::HeapGrowingImpl final
 
   size_t limit_for_atomic_gc() const { return limit_for_atomic_gc_; }
   size_t limit_for_incremental_gc() const { return limit_for_incremental_gc_; }
+  size_t limit_for_minor_gc() const { return limit_for_minor_gc_; }
 
   void DisableForTesting();
 
@@ -57,6 +71,9 @@ class HeapGrowing::HeapGrowingImpl final
   size_t initial_heap_size_ = 1 * kMB;
   size_t limit_for_atomic_gc_ = 0;       // See ConfigureLimit().
   size_t limit_for_incremental_gc_ = 0;  // See ConfigureLimit().
+  size_t limit_for_minor_gc_ = 0;        // See ConfigureLimit().
+  size_t young_capacity_bytes_ = 0;      // See ConfigureLimit().
+  double young_capacity_ratio_ = kInitialYoungCapacityRatio;
 
   SingleThreadedHandle gc_task_handle_;
 
@@ -100,11 +117,38 @@ void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
     collector_->StartIncrementalGarbageCollection(
         {CollectionType::kMajor, StackState::kMayContainHeapPointers,
          marking_support_, sweeping_support_});
+  } else if (allocated_object_size > limit_for_minor_gc_ &&
+             collector_->generational_gc_supported()) {
+    collector_->CollectGarbage(
+        {CollectionType::kMinor, StackState::kMayContainHeapPointers,
+         GCConfig::MarkingType::kAtomic, sweeping_support_});
   }
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
+  if (stats_collector_->collection_type_on_current_cycle() ==
+      CollectionType::kMinor) {
+    // Use the survival rate of the young generation as promotion feedback:
+    // with sticky bits all surviving objects are promoted in place, so a
+    // mostly-surviving young generation means minor GCs reclaim little and
+    // should back off towards major GCs, while a mostly-dying one is worth
+    // collecting frequently and cheaply.
+    const double survival_rate =
+        young_capacity_bytes_ == 0
+            ? 1.0
+            : std::min(1.0,
+                       static_cast<double>(
+                           stats_collector_->marked_bytes_on_current_cycle()) /
+                           young_capacity_bytes_);
+    if (survival_rate > kHighSurvivalRate) {
+      young_capacity_ratio_ =
+          std::min(kMaximumYoungCapacityRatio, 2 * young_capacity_ratio_);
+    } else if (survival_rate < kLowSurvivalRate) {
+      young_capacity_ratio_ =
+          std::max(kMinimumYoungCapacityRatio, young_capacity_ratio_ / 2);
+    }
+  }
   ConfigureLimit(allocated_object_size);
 }
 
@@ -137,6 +181,12 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
       std::max(minimum_limit_incremental_gc,
                std::min(maximum_limit_incremental_gc,
                         limit_incremental_gc_based_on_allocation_rate));
+  // For generational heaps, schedule minor GCs within the window in which
+  // neither incremental nor atomic major GCs would be triggered. The limit is
+  // only consulted when the collector supports generational GC.
+  young_capacity_bytes_ = static_cast<size_t>((limit_for_atomic_gc_ - size) *
+                                              young_capacity_ratio_);
+  limit_for_minor_gc_ = size + young_capacity_bytes_;
 }
 
 void HeapGrowing::HeapGrowingImpl::DisableForTesting() {
@@ -160,6 +210,9 @@ size_t HeapGrowing::limit_for_atomic_gc() const {
 size_t HeapGrowing::limit_for_incremental_gc() const {
   return impl_->limit_for_incremental_gc();
 }
+size_t HeapGrowing::limit_for_minor_gc() const {
+  return impl_->limit_for_minor_gc();
+}
 
 void HeapGrowing::DisableForTesting() { impl_->DisableForTesting(); }
 
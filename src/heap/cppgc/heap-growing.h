@@ -23,7 +23,9 @@ class StatsCollector;
 // on allocation statistics provided by StatsCollector and ResourceConstraints.
 //
 // Implements a fixed-ratio growing strategy with an initial heap size that the
-// GC can ignore to avoid excessive GCs for smaller heaps.
+// GC can ignore to avoid excessive GCs for smaller heaps. For generational
+// heaps, additionally schedules minor GCs with a young generation capacity
+// that adapts to the survival rate of previous minor GCs.
 class V8_EXPORT_PRIVATE HeapGrowing final {
  public:
   // Constant growing factor for growing the heap limit.
@@ -43,6 +45,7 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
 
   size_t limit_for_atomic_gc() const;
   size_t limit_for_incremental_gc() const;
+  size_t limit_for_minor_gc() const;
 
   void DisableForTesting();
 
@@ -52,6 +52,14 @@ void Heap::ForceGarbageCollectionSlow(const char* source, const char* reason,
        internal::GCConfig::IsForcedGC::kForced});
 }
 
+void Heap::EnableCompactionForNextGarbageCollection() {
+  internal::Heap::From(this)->compactor().EnableForNextGC();
+}
+
+size_t Heap::GetLastCompactionReleasedBytes() const {
+  return internal::Heap::From(this)->compactor().released_bytes_for_last_gc();
+}
+
 AllocationHandle& Heap::GetAllocationHandle() {
   return internal::Heap::From(this)->object_allocator();
 }
@@ -40,6 +40,9 @@ class V8_EXPORT_PRIVATE Heap final : public HeapBase,
   const EmbedderStackState* override_stack_state() const final {
     return HeapBase::override_stack_state();
   }
+  bool generational_gc_supported() const final {
+    return HeapBase::generational_gc_supported();
+  }
 
   void EnableGenerationalGC();
 
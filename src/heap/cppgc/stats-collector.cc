@@ -311,6 +311,11 @@ size_t StatsCollector::marked_bytes_on_current_cycle() const {
   return current_.marked_bytes;
 }
 
+CollectionType StatsCollector::collection_type_on_current_cycle() const {
+  DCHECK_NE(GarbageCollectionState::kNotRunning, gc_state_);
+  return current_.collection_type;
+}
+
 v8::base::TimeDelta StatsCollector::marking_time() const {
   DCHECK_NE(GarbageCollectionState::kMarking, gc_state_);
   // During sweeping we refer to the current Event as that already holds the
@@ -304,6 +304,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // within GC cycle.
   size_t marked_bytes_on_current_cycle() const;
 
+  // Returns the collection type of the current cycle. Should only be called
+  // within GC cycle.
+  CollectionType collection_type_on_current_cycle() const;
+
   // Returns the overall duration of the most recent marking phase. Should not
   // be called during marking.
   v8::base::TimeDelta marking_time() const;
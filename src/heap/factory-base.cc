@@ -17,6 +17,7 @@
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
 #include "src/objects/arguments-inl.h"
+#include "src/objects/background-string-flattener.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/module-inl.h"
@@ -901,7 +902,14 @@ MaybeHandle<String> FactoryBase<Impl>::NewConsString(
     return result;
   }
 
-  return NewConsString(left, right, length, is_one_byte, allocation);
+  Handle<String> result =
+      NewConsString(left, right, length, is_one_byte, allocation);
+  if (V8_UNLIKELY(v8_flags.background_flatten_strings) &&
+      length >= v8_flags.background_flatten_min_length &&
+      allocation != AllocationType::kSharedOld) {
+    BackgroundStringFlattener::MaybeScheduleProactiveFlatten(isolate(), result);
+  }
+  return result;
 }
 
 template <typename Impl>
@@ -111,11 +111,22 @@ void Factory::NumberToStringCacheSet(DirectHandle<Object> number, int hash,
                                      DirectHandle<String> js_string) {
   if (!IsUndefined(number_string_cache()->get(hash * 2), isolate()) &&
       !v8_flags.optimize_for_size) {
-    int full_size = isolate()->heap()->MaxNumberToStringCacheSize();
-    if (number_string_cache()->length() != full_size) {
+    Heap* heap = isolate()->heap();
+    const int full_size = heap->MaxNumberToStringCacheSize();
+    const int length = number_string_cache()->length();
+    if (length != full_size && (!v8_flags.adaptive_number_string_cache ||
+                                heap->ShouldGrowNumberStringCache())) {
+      // Resizing discards all cached entries. With
+      // --adaptive-number-string-cache the cache grows geometrically as long
+      // as its hit rate stays low; otherwise it jumps to the full size on the
+      // first conflict.
+      const int new_length = v8_flags.adaptive_number_string_cache
+                                 ? std::min(length * 2, full_size)
+                                 : full_size;
       Handle<FixedArray> new_cache =
-          NewFixedArray(full_size, AllocationType::kOld);
-      isolate()->heap()->set_number_string_cache(*new_cache);
+          NewFixedArray(new_length, AllocationType::kOld);
+      heap->set_number_string_cache(*new_cache);
+      heap->ResetNumberStringCacheStatistics();
       return;
     }
   }
@@ -132,8 +143,10 @@ Handle<Object> Factory::NumberToStringCacheGet(Tagged<Object> number,
   Tagged<Object> key = cache->get(hash * 2);
   if (key == number || (IsHeapNumber(key) && IsHeapNumber(number) &&
                         Object::Number(key) == Object::Number(number))) {
+    isolate()->heap()->RecordNumberStringCacheHit();
     return Handle<String>(String::cast(cache->get(hash * 2 + 1)), isolate());
   }
+  isolate()->heap()->RecordNumberStringCacheMiss();
   return undefined_value();
 }
 
@@ -5,7 +5,8 @@
 #include "src/heap/factory.h"
 
 #include <algorithm>  // For copy
-#include <memory>     // For shared_ptr<>
+#include <limits>
+#include <memory>  // For shared_ptr<>
 #include <string>
 #include <utility>  // For move
 
@@ -58,6 +59,7 @@
 #include "src/objects/js-objects.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/js-shared-array-inl.h"
+#include "src/objects/js-shared-map-inl.h"
 #include "src/objects/js-struct-inl.h"
 #include "src/objects/js-weak-refs-inl.h"
 #include "src/objects/literal-objects-inl.h"
@@ -1079,7 +1081,8 @@ Handle<String> Factory::NewProperSubString(Handle<String> str, int begin,
     return MakeOrFindTwoCharacterString(c1, c2);
   }
 
-  if (!v8_flags.string_slices || length < SlicedString::kMinLength) {
+  if (!v8_flags.string_slices ||
+      length < isolate()->sliced_string_min_length()) {
     return NewCopiedSubstring(str, begin, length);
   }
 
@@ -1109,6 +1112,67 @@ Handle<String> Factory::NewProperSubString(Handle<String> str, int begin,
   return handle(slice, isolate());
 }
 
+void Factory::NewSubStrings(Handle<String> str,
+                            base::Vector<const SubStringRange> ranges,
+                            base::Vector<Handle<String>> out) {
+  DCHECK_EQ(ranges.size(), out.size());
+#if VERIFY_HEAP
+  if (v8_flags.verify_heap) str->StringVerify(isolate());
+#endif
+
+  Handle<String> flat = String::Flatten(isolate(), str);
+
+  // Unwrap the parent once so that all slices point directly at the
+  // underlying sequential or external string.
+  Handle<String> parent = flat;
+  int parent_offset = 0;
+  if (IsSlicedString(*parent)) {
+    Handle<SlicedString> slice = Handle<SlicedString>::cast(parent);
+    parent_offset = slice->offset();
+    parent = handle(slice->parent(), isolate());
+  }
+  if (IsThinString(*parent)) {
+    Handle<ThinString> thin = Handle<ThinString>::cast(parent);
+    parent = handle(thin->actual(), isolate());
+  }
+  DCHECK(IsSeqString(*parent) || IsExternalString(*parent));
+
+  const int min_slice_length = v8_flags.string_slices
+                                   ? isolate()->sliced_string_min_length()
+                                   : std::numeric_limits<int>::max();
+  Handle<Map> map = parent->IsOneByteRepresentation()
+                        ? sliced_one_byte_string_map()
+                        : sliced_two_byte_string_map();
+
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const int begin = static_cast<int>(ranges[i].start);
+    const int length = static_cast<int>(ranges[i].length);
+    DCHECK_LE(ranges[i].start + static_cast<uint64_t>(ranges[i].length),
+              static_cast<uint64_t>(flat->length()));
+    if (length <= 0) {
+      out[i] = empty_string();
+    } else if (length == 1) {
+      out[i] = LookupSingleCharacterStringFromCode(flat->Get(begin));
+    } else if (length == 2) {
+      out[i] =
+          MakeOrFindTwoCharacterString(flat->Get(begin), flat->Get(begin + 1));
+    } else if (length < min_slice_length) {
+      out[i] = NewCopiedSubstring(flat, begin, length);
+    } else if (begin == 0 && length == flat->length()) {
+      out[i] = flat;
+    } else {
+      Tagged<SlicedString> slice =
+          Tagged<SlicedString>::cast(New(map, AllocationType::kYoung));
+      DisallowGarbageCollection no_gc;
+      slice->set_raw_hash_field(String::kEmptyHashField);
+      slice->set_length(length);
+      slice->set_parent(*parent);
+      slice->set_offset(begin + parent_offset);
+      out[i] = handle(slice, isolate());
+    }
+  }
+}
+
 MaybeHandle<String> Factory::NewExternalStringFromOneByte(
     const ExternalOneByteString::Resource* resource) {
   size_t length = resource->length();
@@ -1291,6 +1355,7 @@ Handle<NativeContext> Factory::NewNativeContext() {
   context->set_errors_thrown(Smi::zero());
   context->set_is_wasm_js_installed(Smi::zero());
   context->set_math_random_index(Smi::zero());
+  context->set_memory_limit_in_kb(Smi::zero());
   context->set_serialized_objects(*empty_fixed_array());
   context->init_microtask_queue(isolate(), nullptr);
   context->set_retained_maps(*empty_weak_array_list());
@@ -2241,12 +2306,15 @@ Handle<Map> Factory::NewContextlessMap(InstanceType type, int instance_size,
   return map;
 }
 
-Handle<JSObject> Factory::CopyJSObject(DirectHandle<JSObject> source) {
-  return CopyJSObjectWithAllocationSite(source, Handle<AllocationSite>());
+Handle<JSObject> Factory::CopyJSObject(DirectHandle<JSObject> source,
+                                       AllocationType allocation) {
+  return CopyJSObjectWithAllocationSite(source, Handle<AllocationSite>(),
+                                        allocation);
 }
 
 Handle<JSObject> Factory::CopyJSObjectWithAllocationSite(
-    DirectHandle<JSObject> source, DirectHandle<AllocationSite> site) {
+    DirectHandle<JSObject> source, DirectHandle<AllocationSite> site,
+    AllocationType allocation) {
   Handle<Map> map(source->map(), isolate());
 
   // We can only clone regexps, normal objects, api objects, errors or arrays.
@@ -2268,6 +2336,8 @@ Handle<JSObject> Factory::CopyJSObjectWithAllocationSite(
   CHECK(is_clonable_js_type || is_clonable_wasm_type);
 
   DCHECK(site.is_null() || AllocationSite::CanTrack(instance_type));
+  // Allocation mementos are only traversed for young objects.
+  DCHECK_IMPLIES(!site.is_null(), allocation == AllocationType::kYoung);
 
   int object_size = map->instance_size();
   int aligned_object_size = ALIGN_TO_ALLOCATION_ALIGNMENT(object_size);
@@ -2279,16 +2349,20 @@ Handle<JSObject> Factory::CopyJSObjectWithAllocationSite(
   }
   Tagged<HeapObject> raw_clone =
       allocator()->AllocateRawWith<HeapAllocator::kRetryOrFail>(
-          adjusted_object_size, AllocationType::kYoung);
+          adjusted_object_size, allocation);
 
-  DCHECK(Heap::InYoungGeneration(raw_clone) || v8_flags.single_generation);
+  DCHECK_IMPLIES(allocation == AllocationType::kYoung,
+                 Heap::InYoungGeneration(raw_clone) ||
+                     v8_flags.single_generation);
 
   Heap::CopyBlock(raw_clone.address(), source->address(), object_size);
   Handle<JSObject> clone(JSObject::cast(raw_clone), isolate());
 
-  if (v8_flags.enable_unconditional_write_barriers) {
-    // By default, we shouldn't need to update the write barrier here, as the
-    // clone will be allocated in new space.
+  if (allocation == AllocationType::kOld ||
+      v8_flags.enable_unconditional_write_barriers) {
+    // For clones allocated in new space no write barrier is needed. Old space
+    // clones may contain references to young objects that were copied from the
+    // source without a barrier.
     const ObjectSlot start(raw_clone.address());
     const ObjectSlot end(raw_clone.address() + object_size);
     isolate()->heap()->WriteBarrierForRange(raw_clone, start, end);
@@ -3359,6 +3433,58 @@ Handle<JSTypedArray> Factory::NewJSTypedArray(
   return typed_array;
 }
 
+void Factory::NewJSTypedArrayBatch(ExternalArrayType type,
+                                   DirectHandle<JSArrayBuffer> buffer,
+                                   const size_t* byte_offsets,
+                                   const size_t* lengths, size_t count,
+                                   Handle<JSTypedArray>* results) {
+  size_t element_size;
+  ElementsKind elements_kind;
+  JSTypedArray::ForFixedTypedArray(type, &element_size, &elements_kind);
+
+  CHECK(!buffer->is_resizable_by_js());
+
+  // The map lookup, elements array, and buffer limits are shared by all views
+  // in the batch.
+  DirectHandle<Map> map(
+      isolate()->raw_native_context()->TypedArrayElementsKindToCtorMap(
+          elements_kind),
+      isolate());
+  DirectHandle<ByteArray> elements = empty_byte_array();
+  const size_t buffer_byte_length = buffer->GetByteLength();
+  void* backing_store = buffer->backing_store();
+
+  for (size_t i = 0; i < count; i++) {
+    const size_t byte_offset = byte_offsets[i];
+    const size_t length = lengths[i];
+    CHECK_LE(length, JSTypedArray::kMaxByteLength / element_size);
+    CHECK_EQ(0, byte_offset % element_size);
+    const size_t byte_length = length * element_size;
+    CHECK_LE(byte_length, buffer_byte_length);
+    CHECK_LE(byte_offset, buffer_byte_length);
+    CHECK_LE(byte_offset + byte_length, buffer_byte_length);
+
+    Handle<JSTypedArray> typed_array = Handle<JSTypedArray>::cast(
+        NewJSObjectFromMap(map, AllocationType::kYoung));
+    DisallowGarbageCollection no_gc;
+    Tagged<JSTypedArray> raw = *typed_array;
+    raw->set_elements(*elements, SKIP_WRITE_BARRIER);
+    raw->set_buffer(*buffer, SKIP_WRITE_BARRIER);
+    raw->set_byte_offset(byte_offset);
+    raw->set_byte_length(byte_length);
+    raw->set_bit_field(0);
+    // TODO(v8) remove once embedder data slots are always zero-initialized.
+    InitEmbedderFields(raw, Smi::zero());
+    DCHECK_EQ(raw->GetEmbedderFieldCount(),
+              v8::ArrayBufferView::kEmbedderFieldCount);
+    raw->set_length(length);
+    raw->SetOffHeapDataPtr(isolate(), backing_store, byte_offset);
+    raw->set_is_length_tracking(false);
+    raw->set_is_backed_by_rab(false);
+    results[i] = typed_array;
+  }
+}
+
 Handle<JSDataViewOrRabGsabDataView> Factory::NewJSDataViewOrRabGsabDataView(
     DirectHandle<JSArrayBuffer> buffer, size_t byte_offset, size_t byte_length,
     bool is_length_tracking) {
@@ -3849,6 +3975,9 @@ void Factory::SetRegExpIrregexpData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, ticks_until_tier_up);
   store->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  store->set(JSRegExp::kIrregexpExecCountIndex, Smi::zero());
+  store->set(JSRegExp::kIrregexpInterpretedCharsIndex, Smi::zero());
+  store->set(JSRegExp::kIrregexpPrefilterLiteralIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -3873,6 +4002,9 @@ void Factory::SetRegExpExperimentalData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store->set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store->set(JSRegExp::kIrregexpExecCountIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpInterpretedCharsIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpPrefilterLiteralIndex, uninitialized);
   regexp->set_data(store);
 }
 
@@ -4216,6 +4348,29 @@ Handle<JSSharedArray> Factory::NewJSSharedArray(Handle<JSFunction> constructor,
   return instance;
 }
 
+Handle<JSSharedMap> Factory::NewJSSharedMap(Handle<JSFunction> constructor) {
+  SharedObjectSafePublishGuard publish_guard;
+  Handle<FixedArray> stripes =
+      NewFixedArray(JSSharedMap::kNumStripes * JSSharedMap::kSlotsPerStripe,
+                    AllocationType::kSharedOld);
+  for (int i = 0; i < JSSharedMap::kNumStripes; i++) {
+    Handle<JSAtomicsMutex> mutex = NewJSAtomicsMutex();
+    Handle<NameDictionary> table =
+        NameDictionary::New(isolate(), JSSharedMap::kInitialStripeCapacity,
+                            AllocationType::kSharedOld);
+    stripes->set(i * JSSharedMap::kSlotsPerStripe +
+                     JSSharedMap::kStripeMutexSlot,
+                 *mutex);
+    stripes->set(i * JSSharedMap::kSlotsPerStripe +
+                     JSSharedMap::kStripeTableSlot,
+                 *table);
+  }
+  Handle<JSSharedMap> instance = Handle<JSSharedMap>::cast(
+      NewJSObject(constructor, AllocationType::kSharedOld));
+  instance->set_stripes(*stripes);
+  return instance;
+}
+
 Handle<JSAtomicsMutex> Factory::NewJSAtomicsMutex() {
   SharedObjectSafePublishGuard publish_guard;
   Handle<Map> map = read_only_roots().js_atomics_mutex_map_handle();
@@ -341,6 +341,22 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   // Create a new string object which holds a substring of a string.
   inline Handle<String> NewSubString(Handle<String> str, int begin, int end);
 
+  // A half-open character range [start, start + length) passed to
+  // NewSubStrings(). Mirrors v8::String::SubStringRange.
+  struct SubStringRange {
+    uint32_t start;
+    uint32_t length;
+  };
+
+  // Bulk version of NewSubString(): creates one substring of {str} per range
+  // and writes it to the corresponding element of {out}. The parent string is
+  // flattened and unwrapped only once, and every range of at least
+  // sliced_string_min_length() characters becomes a SlicedString sharing the
+  // flattened parent. All ranges must be within the bounds of {str}.
+  void NewSubStrings(Handle<String> str,
+                     base::Vector<const SubStringRange> ranges,
+                     base::Vector<Handle<String>> out);
+
   // Creates a new external String object.  There are two String encodings
   // in the system: one-byte and two-byte.  Unlike other String types, it does
   // not make sense to have a UTF-8 factory function for external strings,
@@ -519,11 +535,14 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
 
   // Returns a deep copy of the JavaScript object.
   // Properties and elements are copied too.
-  Handle<JSObject> CopyJSObject(DirectHandle<JSObject> object);
+  Handle<JSObject> CopyJSObject(DirectHandle<JSObject> object,
+                                AllocationType allocation =
+                                    AllocationType::kYoung);
   // Same as above, but also takes an AllocationSite to be appended in an
   // AllocationMemento.
   Handle<JSObject> CopyJSObjectWithAllocationSite(
-      DirectHandle<JSObject> object, DirectHandle<AllocationSite> site);
+      DirectHandle<JSObject> object, DirectHandle<AllocationSite> site,
+      AllocationType allocation = AllocationType::kYoung);
 
   Handle<FixedArray> CopyFixedArrayWithMap(
       DirectHandle<FixedArray> array, DirectHandle<Map> map,
@@ -781,6 +800,15 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
                                        size_t byte_offset, size_t length,
                                        bool is_length_tracking = false);
 
+  // Creates |count| JSTypedArrays over the same buffer, one per
+  // (byte offset, length) pair, sharing the map lookup and per-view setup
+  // across the batch. Does not support resizable buffers or length-tracking
+  // views; those must go through NewJSTypedArray.
+  void NewJSTypedArrayBatch(ExternalArrayType type,
+                            DirectHandle<JSArrayBuffer> buffer,
+                            const size_t* byte_offsets, const size_t* lengths,
+                            size_t count, Handle<JSTypedArray>* results);
+
   Handle<JSDataViewOrRabGsabDataView> NewJSDataViewOrRabGsabDataView(
       DirectHandle<JSArrayBuffer> buffer, size_t byte_offset,
       size_t byte_length, bool is_length_tracking = false);
@@ -985,6 +1013,8 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   Handle<JSSharedArray> NewJSSharedArray(Handle<JSFunction> constructor,
                                          int length);
 
+  Handle<JSSharedMap> NewJSSharedMap(Handle<JSFunction> constructor);
+
   Handle<JSAtomicsMutex> NewJSAtomicsMutex();
 
   Handle<JSAtomicsCondition> NewJSAtomicsCondition();
@@ -667,13 +667,24 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
     current_.incremental_marking_duration +=
         base::TimeDelta::FromMillisecondsD(duration);
   }
+  AddMainThreadPause(base::TimeDelta::FromMillisecondsD(duration));
   ReportIncrementalMarkingStepToRecorder(duration);
 }
 
 void GCTracer::AddIncrementalSweepingStep(double duration) {
+  AddMainThreadPause(base::TimeDelta::FromMillisecondsD(duration));
   ReportIncrementalSweepingStepToRecorder(duration);
 }
 
+void GCTracer::AddMainThreadPause(base::TimeDelta duration) {
+  pause_count_++;
+  if (duration > longest_pause_) longest_pause_ = duration;
+  const base::TimeDelta pause_budget = heap_->gc_pause_budget();
+  if (!pause_budget.IsZero() && duration > pause_budget) {
+    pauses_over_budget_++;
+  }
+}
+
 void GCTracer::Output(const char* format, ...) const {
   if (v8_flags.trace_gc) {
     va_list arguments;
@@ -991,6 +1002,12 @@ void GCTracer::PrintNVP() const {
           "sweep.new_lo=%.1f "
           "sweep.old=%.1f "
           "sweep.start_jobs=%.1f "
+#ifdef V8_ENABLE_SANDBOX
+          "sweep.external_pointer_table=%.1f "
+          "external_pointer_table_capacity=%u "
+          "external_pointer_table_live=%u "
+          "external_pointer_table_fragmentation=%.1f%% "
+#endif  // V8_ENABLE_SANDBOX
           "incremental=%.1f "
           "incremental.finalize=%.1f "
           "incremental.finalize.external.prologue=%.1f "
@@ -1078,6 +1095,17 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MC_SWEEP_NEW_LO),
           current_scope(Scope::MC_SWEEP_OLD),
           current_scope(Scope::MC_SWEEP_START_JOBS),
+#ifdef V8_ENABLE_SANDBOX
+          current_scope(Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE),
+          current_.external_pointer_table_capacity,
+          current_.external_pointer_table_live_entries,
+          current_.external_pointer_table_capacity > 0
+              ? 100.0 *
+                    (current_.external_pointer_table_capacity -
+                     current_.external_pointer_table_live_entries) /
+                    current_.external_pointer_table_capacity
+              : 0.0,
+#endif  // V8_ENABLE_SANDBOX
           current_scope(Scope::MC_INCREMENTAL),
           current_scope(Scope::MC_INCREMENTAL_FINALIZE),
           current_scope(Scope::MC_INCREMENTAL_EXTERNAL_PROLOGUE),
@@ -1154,6 +1182,15 @@ void GCTracer::RecordEmbedderSpeed(size_t bytes, double duration) {
   }
 }
 
+#ifdef V8_ENABLE_SANDBOX
+void GCTracer::RecordExternalPointerTableStats(uint32_t capacity,
+                                               uint32_t live_entries) {
+  DCHECK_LE(live_entries, capacity);
+  current_.external_pointer_table_capacity += capacity;
+  current_.external_pointer_table_live_entries += live_entries;
+}
+#endif  // V8_ENABLE_SANDBOX
+
 void GCTracer::RecordMutatorUtilization(base::TimeTicks mark_compact_end_time,
                                         base::TimeDelta mark_compact_duration) {
   const base::TimeDelta total_duration =
@@ -1499,6 +1536,10 @@ void GCTracer::ReportFullCycleToRecorder() {
   if (!recorder->HasEmbedderRecorder()) {
     incremental_mark_batched_events_ = {};
     incremental_sweep_batched_events_ = {};
+    young_cycle_batched_events_ = {};
+    pause_count_ = 0;
+    pauses_over_budget_ = 0;
+    longest_pause_ = base::TimeDelta();
     if (cpp_heap) {
       cpp_heap->GetMetricRecorder()->ClearCachedEvents();
     }
@@ -1510,6 +1551,9 @@ void GCTracer::ReportFullCycleToRecorder() {
   if (!incremental_sweep_batched_events_.events.empty()) {
     FlushBatchedEvents(incremental_sweep_batched_events_, heap_->isolate());
   }
+  if (!young_cycle_batched_events_.events.empty()) {
+    FlushBatchedEvents(young_cycle_batched_events_, heap_->isolate());
+  }
 
   v8::metrics::GarbageCollectionFullCycle event;
   event.reason = static_cast<int>(current_.gc_reason);
@@ -1631,6 +1675,26 @@ void GCTracer::ReportFullCycleToRecorder() {
   // - event.main_thread_efficiency_in_bytes_per_us
 
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+
+  // Pause-budget conformance, see v8::Isolate::SetGCPauseBudget. The atomic
+  // pause counts as the last pause of the cycle.
+  const base::TimeDelta pause_budget = heap_->gc_pause_budget();
+  if (!pause_budget.IsZero()) {
+    AddMainThreadPause(atomic_pause_duration);
+    v8::metrics::GarbageCollectionPauseBudget budget_event;
+    budget_event.budget_wall_clock_duration_in_us =
+        pause_budget.InMicroseconds();
+    budget_event.longest_pause_wall_clock_duration_in_us =
+        longest_pause_.InMicroseconds();
+    budget_event.atomic_pause_wall_clock_duration_in_us =
+        atomic_pause_duration.InMicroseconds();
+    budget_event.pause_count = pause_count_;
+    budget_event.pauses_over_budget = pauses_over_budget_;
+    recorder->AddMainThreadEvent(budget_event, GetContextId(heap_->isolate()));
+  }
+  pause_count_ = 0;
+  pauses_over_budget_ = 0;
+  longest_pause_ = base::TimeDelta();
 }
 
 void GCTracer::ReportIncrementalMarkingStepToRecorder(double v8_duration) {
@@ -1758,6 +1822,18 @@ void GCTracer::ReportYoungCycleToRecorder() {
       main_thread_wall_clock_duration.IsZero()
           ? std::numeric_limits<double>::infinity()
           : freed_bytes / main_thread_wall_clock_duration.InMicroseconds();
+
+  if (v8_flags.metrics_batch_young_gc_events) {
+    // Accumulate and deliver the batch with the next full GC cycle report,
+    // following the incremental mark/sweep batches above.
+    static constexpr int kMaxBatchedEvents =
+        CppHeap::MetricRecorderAdapter::kMaxBatchedEvents;
+    young_cycle_batched_events_.events.push_back(event);
+    if (young_cycle_batched_events_.events.size() == kMaxBatchedEvents) {
+      FlushBatchedEvents(young_cycle_batched_events_, heap_->isolate());
+    }
+    return;
+  }
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
@@ -234,6 +234,14 @@ class V8_EXPORT_PRIVATE GCTracer {
 
     // Holds details for incremental marking scopes.
     IncrementalInfos incremental_scopes[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
+
+#ifdef V8_ENABLE_SANDBOX
+    // Capacity and number of live entries of the external pointer table after
+    // sweeping, summed over all spaces swept by this isolate. Recorded by the
+    // mark-compactor.
+    uint32_t external_pointer_table_capacity = 0;
+    uint32_t external_pointer_table_live_entries = 0;
+#endif  // V8_ENABLE_SANDBOX
   };
 
   class RecordGCPhasesInfo final {
@@ -336,6 +344,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Log an incremental marking step.
   void AddIncrementalSweepingStep(double duration);
 
+  // Log a main-thread pause for pause-budget conformance tracking, see
+  // v8::Isolate::SetGCPauseBudget.
+  void AddMainThreadPause(base::TimeDelta duration);
+
   // Compute the average incremental marking speed in bytes/millisecond.
   // Returns a conservative value if no events have been recorded.
   double IncrementalMarkingSpeedInBytesPerMillisecond() const;
@@ -435,6 +447,16 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void RecordEmbedderSpeed(size_t bytes, double duration);
 
+#ifdef V8_ENABLE_SANDBOX
+  // Reports the capacity and number of live entries of an external pointer
+  // table space after it has been swept. Accumulates over all spaces swept
+  // during the current cycle and is emitted with --trace-gc-nvp, together
+  // with the sweep time, so that table occupancy and fragmentation can be
+  // monitored per GC.
+  void RecordExternalPointerTableStats(uint32_t capacity,
+                                       uint32_t live_entries);
+#endif  // V8_ENABLE_SANDBOX
+
   // Returns the average time between scheduling and invocation of an
   // incremental marking task.
   base::Optional<base::TimeDelta> AverageTimeToIncrementalMarkingTask() const;
@@ -525,6 +547,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   // here are merged back upon starting/stopping the GC tracer.
   IncrementalInfos incremental_scopes_[Scope::NUMBER_OF_INCREMENTAL_SCOPES];
 
+  // Pause-budget conformance counters for the current full cycle; reported
+  // and reset by ReportFullCycleToRecorder().
+  int pause_count_ = 0;
+  int pauses_over_budget_ = 0;
+  base::TimeDelta longest_pause_;
+
   // Timestamp and allocation counter at the last sampled allocation event.
   base::TimeTicks allocation_time_;
   size_t new_space_allocation_counter_bytes_ = 0;
@@ -575,6 +603,9 @@ class V8_EXPORT_PRIVATE GCTracer {
       incremental_mark_batched_events_;
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalSweep
       incremental_sweep_batched_events_;
+  // Only used with --metrics-batch-young-gc-events; flushed together with the
+  // incremental batches above.
+  v8::metrics::GarbageCollectionYoungBatchedCycles young_cycle_batched_events_;
 
   mutable base::Mutex background_scopes_mutex_;
   base::TimeDelta background_scopes_[Scope::NUMBER_OF_SCOPES];
@@ -12,6 +12,7 @@
 // Avoid including anything but `heap.h` from `src/heap` where possible.
 #include "src/base/atomic-utils.h"
 #include "src/base/atomicops.h"
+#include "src/base/bits.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
@@ -499,13 +500,24 @@ int Heap::GetNextTemplateSerialNumber() {
 }
 
 int Heap::MaxNumberToStringCacheSize() const {
-  // Compute the size of the number string cache based on the max newspace size.
-  // The number string cache has a minimum size based on twice the initial cache
-  // size to ensure that it is bigger after being made 'full size'.
-  size_t number_string_cache_size = max_semi_space_size_ / 512;
-  number_string_cache_size =
-      std::max(static_cast<size_t>(kInitialNumberStringCacheSize * 2),
-               std::min(static_cast<size_t>(0x4000), number_string_cache_size));
+  size_t number_string_cache_size;
+  if (v8_flags.number_string_cache_size > 0) {
+    // Explicitly configured capacity, in entries. The cache is a flat hash
+    // table, so round up to the next power of two.
+    number_string_cache_size =
+        std::min(static_cast<size_t>(0x100000),
+                 static_cast<size_t>(base::bits::RoundUpToPowerOfTwo32(
+                     static_cast<uint32_t>(v8_flags.number_string_cache_size))));
+  } else {
+    // Compute the size of the number string cache based on the max newspace
+    // size. The number string cache has a minimum size based on twice the
+    // initial cache size to ensure that it is bigger after being made 'full
+    // size'.
+    number_string_cache_size = max_semi_space_size_ / 512;
+    number_string_cache_size = std::max(
+        static_cast<size_t>(kInitialNumberStringCacheSize * 2),
+        std::min(static_cast<size_t>(0x4000), number_string_cache_size));
+  }
   // There is a string and a number per entry so the length is twice the number
   // of entries.
   return static_cast<int>(number_string_cache_size * 2);
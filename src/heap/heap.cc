@@ -63,6 +63,7 @@
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/large-spaces.h"
+#include "src/heap/live-object-range-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
@@ -100,12 +101,15 @@
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/data-handler.h"
+#include "src/objects/deoptimization-data.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/free-space-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/hash-table.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/objects.h"
+#include "src/objects/scope-info.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
@@ -119,6 +123,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -794,6 +799,77 @@ void Heap::PrintFreeListsStats() {
   PrintIsolate(isolate_, "%s", out_str.str().c_str());
 }
 
+void Heap::CollectFragmentationStats() {
+  DCHECK(v8_flags.trace_fragmentation_stats);
+  // Requires valid marking bitmaps and per-page live byte counts, so this must
+  // run after marking has finished and before sweeping tears them down.
+  PtrComprCageBase cage_base(isolate());
+  PrintIsolate(isolate_,
+               "Fragmentation statistics per old space page: "
+               "[live KB | free KB | free gaps >= 1K | dominant type]\n");
+
+  size_t total_live_bytes = 0;
+  size_t total_free_bytes = 0;
+  int page_count = 0;
+  for (Page* page : *old_space()) {
+    size_t live_bytes = 0;
+    size_t free_bytes = 0;
+    int large_gaps = 0;
+    std::map<InstanceType, size_t> live_bytes_by_type;
+    Address free_start = page->area_start();
+    for (auto [object, size] : LiveObjectRange(page)) {
+      if (object.address() != free_start) {
+        const size_t gap = object.address() - free_start;
+        free_bytes += gap;
+        if (gap >= KB) large_gaps++;
+      }
+      live_bytes += size;
+      live_bytes_by_type[object->map(cage_base)->instance_type()] += size;
+      free_start = object.address() + size;
+    }
+    if (free_start != page->area_end()) {
+      const size_t gap = page->area_end() - free_start;
+      free_bytes += gap;
+      if (gap >= KB) large_gaps++;
+    }
+
+    InstanceType dominant_type = FIRST_TYPE;
+    size_t dominant_bytes = 0;
+    for (const auto& [type, bytes] : live_bytes_by_type) {
+      if (bytes > dominant_bytes) {
+        dominant_bytes = bytes;
+        dominant_type = type;
+      }
+    }
+
+    std::ostringstream out_str;
+    out_str << "Page " << std::setw(4) << page_count << ": [" << std::setw(6)
+            << live_bytes / KB << " KB | " << std::setw(6) << free_bytes / KB
+            << " KB | " << std::setw(4) << large_gaps << " | ";
+    if (dominant_bytes > 0) {
+      out_str << dominant_type << " (" << dominant_bytes / KB << " KB)";
+    } else {
+      out_str << "empty";
+    }
+    out_str << "]\n";
+    PrintIsolate(isolate_, "%s", out_str.str().c_str());
+
+    total_live_bytes += live_bytes;
+    total_free_bytes += free_bytes;
+    page_count++;
+  }
+
+  const size_t total_bytes = total_live_bytes + total_free_bytes;
+  PrintIsolate(isolate_,
+               "Fragmentation statistics: %d pages, live: %.1f MB, free: "
+               "%.1f MB (%.2f%%)\n",
+               page_count, static_cast<double>(total_live_bytes) / MB,
+               static_cast<double>(total_free_bytes) / MB,
+               total_bytes == 0
+                   ? 0.0
+                   : static_cast<double>(total_free_bytes) / total_bytes * 100);
+}
+
 void Heap::DumpJSONHeapStatistics(std::stringstream& stream) {
   HeapStatistics stats;
   reinterpret_cast<v8::Isolate*>(isolate())->GetHeapStatistics(&stats);
@@ -2733,8 +2809,12 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->json_shape_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  FrameTranslationCache::Clear(frame_translation_cache());
+  ScopeInfoDedupCache::Clear(scope_info_dedup_cache());
+  FeedbackMetadataDedupCache::Clear(feedback_metadata_dedup_cache());
 
   FlushNumberStringCache();
 }
@@ -3244,6 +3324,31 @@ void Heap::FlushNumberStringCache() {
   for (int i = 0; i < len; i++) {
     number_string_cache()->set(i, roots.undefined_value(), SKIP_WRITE_BARRIER);
   }
+  ResetNumberStringCacheStatistics();
+}
+
+void Heap::RecordNumberStringCacheHit() {
+  ++number_string_cache_lookups_;
+  ++number_string_cache_hits_;
+  isolate()->counters()->number_string_cache_hits()->Increment();
+}
+
+void Heap::RecordNumberStringCacheMiss() {
+  ++number_string_cache_lookups_;
+  isolate()->counters()->number_string_cache_misses()->Increment();
+}
+
+bool Heap::ShouldGrowNumberStringCache() {
+  // Growing discards all cached entries, so require at least one recorded
+  // lookup per entry and a hit rate below one half before paying for it.
+  size_t entries = static_cast<size_t>(number_string_cache()->length()) / 2;
+  if (number_string_cache_lookups_ < entries) return false;
+  return number_string_cache_hits_ * 2 < number_string_cache_lookups_;
+}
+
+void Heap::ResetNumberStringCacheStatistics() {
+  number_string_cache_lookups_ = 0;
+  number_string_cache_hits_ = 0;
 }
 
 namespace {
@@ -3848,6 +3953,10 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
                                   : ResizeNewSpaceMode::kShrink;
   }
 
+  if (v8_flags.adaptive_new_space_sizing && !v8_flags.predictable) {
+    return AdaptiveResizeNewSpaceMode();
+  }
+
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
@@ -3865,6 +3974,61 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
 }
 
+Heap::ResizeNewSpaceMode Heap::AdaptiveResizeNewSpaceMode() {
+  // Grow the new space while allocation pressure is high, most objects die
+  // young and scavenges have headroom below the pause target: a larger
+  // nursery amortizes the per-scavenge fixed costs over more garbage. Shrink
+  // it when the predicted scavenge pause exceeds the target or when survival
+  // is high enough that copying dominates; in both cases a smaller nursery
+  // bounds pause times and promotes long-lived objects sooner. A direction
+  // has to win on consecutive GCs before it is applied, so that bursty
+  // phases do not make the capacity oscillate.
+  static constexpr double kHighSurvivalRatePercent = 40;
+  static constexpr int kResizeHysteresis = 2;
+
+  const size_t total_capacity = new_space_->TotalCapacity();
+  const double survival_rate = tracer()->AverageSurvivalRatio();
+  const double scavenge_speed =
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects);
+
+  // Predicted cost of evacuating a nursery of the current size, assuming
+  // recent survival behavior. Zero (i.e. never over target) until enough
+  // scavenges have been recorded.
+  const double predicted_surviving_bytes =
+      survival_rate / 100.0 * static_cast<double>(total_capacity);
+  const double predicted_pause_ms =
+      scavenge_speed > 0 ? predicted_surviving_bytes / scavenge_speed : 0;
+  const bool pause_over_target =
+      predicted_pause_ms > v8_flags.scavenge_pause_target_ms;
+
+  int vote = 0;
+  if (pause_over_target || survival_rate >= kHighSurvivalRatePercent) {
+    vote = -1;
+  } else if (survived_since_last_expansion_ > total_capacity &&
+             total_capacity < new_space_->MaximumCapacity()) {
+    vote = 1;
+  }
+
+  if (vote == 0) {
+    adaptive_new_space_resize_votes_ = 0;
+    return ResizeNewSpaceMode::kNone;
+  }
+  if ((vote > 0) != (adaptive_new_space_resize_votes_ > 0)) {
+    adaptive_new_space_resize_votes_ = 0;
+  }
+  adaptive_new_space_resize_votes_ += vote;
+  if (adaptive_new_space_resize_votes_ >= kResizeHysteresis) {
+    adaptive_new_space_resize_votes_ = 0;
+    survived_since_last_expansion_ = 0;
+    return ResizeNewSpaceMode::kGrow;
+  }
+  if (adaptive_new_space_resize_votes_ <= -kResizeHysteresis) {
+    adaptive_new_space_resize_votes_ = 0;
+    return ResizeNewSpaceMode::kShrink;
+  }
+  return ResizeNewSpaceMode::kNone;
+}
+
 void Heap::ExpandNewSpaceSize() {
   // Grow the size of new space if there is room to grow, and enough data
   // has survived scavenge since the last expansion.
@@ -3882,6 +4046,54 @@ void Heap::ReduceNewSpaceSize() {
   new_lo_space_->SetCapacity(new_space()->TotalCapacity());
 }
 
+size_t Heap::TrimMemory(double deadline_in_ms,
+                        v8::Isolate::TrimMemoryReport* report) {
+  v8::Isolate::TrimMemoryReport local_report;
+  if (report == nullptr) report = &local_report;
+  *report = {};
+  // Trimming walks page lists and free lists, so it must not race with a
+  // garbage collection.
+  if (gc_state() != NOT_IN_GC || IsTearingDown()) return 0;
+  const auto out_of_time = [&]() {
+    return MonotonicallyIncreasingTimeInMs() >= deadline_in_ms;
+  };
+  // Pages buffered for reuse by the page pool are the cheapest to give back.
+  if (!out_of_time()) {
+    MemoryAllocator::Pool* pool = memory_allocator()->pool();
+    report->pooled_pages_bytes = pool->CommittedBufferedMemory();
+    pool->ReleasePooledChunks();
+  }
+  // Pages whose memory is entirely on a free list, including code-space
+  // pages, can be released without moving any objects. Skip this while
+  // sweeping is in progress; until sweeping is done the free lists are
+  // incomplete and pages may still be picked up for allocation.
+  if (!out_of_time() && !sweeper()->sweeping_in_progress()) {
+    FreeMainThreadLinearAllocationAreas();
+    PagedSpaceIterator spaces(this);
+    for (PagedSpace* space = spaces.Next(); space != nullptr;
+         space = spaces.Next()) {
+      if (out_of_time()) break;
+      report->free_list_pages_bytes += space->ReleaseEmptyFreeListPages();
+    }
+  }
+  // Committed semispace capacity beyond the current usage. MinorMS shrinks
+  // new space as part of sweeping instead.
+  if (!out_of_time() && new_space() && !v8_flags.minor_ms) {
+    const size_t committed_before = new_space()->CommittedMemory();
+    SemiSpaceNewSpace::From(new_space())->Shrink();
+    new_lo_space()->SetCapacity(new_space()->TotalCapacity());
+    report->new_space_bytes = committed_before - new_space()->CommittedMemory();
+  }
+  // Zone segments buffered for reuse by the compiler and parser.
+  if (!out_of_time()) {
+    AccountingAllocator* zone_allocator = isolate()->allocator();
+    report->zone_segment_bytes = zone_allocator->GetPooledMemory();
+    zone_allocator->ClearPool();
+  }
+  return report->pooled_pages_bytes + report->free_list_pages_bytes +
+         report->new_space_bytes + report->zone_segment_bytes;
+}
+
 size_t Heap::NewSpaceSize() { return new_space() ? new_space()->Size() : 0; }
 
 size_t Heap::NewSpaceCapacity() const {
@@ -5955,6 +6167,35 @@ EmbedderRootsHandler* Heap::GetEmbedderRootsHandler() const {
   return embedder_roots_handler_;
 }
 
+void Heap::SetGCPauseBudget(double budget_in_ms) {
+  const int64_t budget_in_us =
+      budget_in_ms > 0
+          ? base::TimeDelta::FromMillisecondsD(budget_in_ms).InMicroseconds()
+          : 0;
+  gc_pause_budget_in_us_.store(budget_in_us, std::memory_order_relaxed);
+  // With a pause budget the main thread defers work, so run concurrent GC
+  // jobs at blocking priority to compensate. Embedders can still override
+  // this with a later SetBackgroundGCTaskPriority() call.
+  isolate()->set_background_gc_task_priority(
+      budget_in_us > 0 ? v8::TaskPriority::kUserBlocking
+                       : v8::TaskPriority::kUserVisible);
+}
+
+void Heap::StartBulkAllocation() {
+  DCHECK(IsMainThread());
+  if (bulk_allocation_depth_++ == 0) {
+    bulk_allocation_pause_.emplace(this);
+  }
+}
+
+void Heap::EndBulkAllocation() {
+  DCHECK(IsMainThread());
+  DCHECK_GT(bulk_allocation_depth_, 0);
+  if (--bulk_allocation_depth_ == 0) {
+    bulk_allocation_pause_.reset();
+  }
+}
+
 void Heap::AttachCppHeap(v8::CppHeap* cpp_heap) {
   // The API function should be a noop in case a CppHeap was passed on Isolate
   // creation.
@@ -539,6 +539,12 @@ class Heap final {
   //  each FreeListCategory of each page.
   void PrintFreeListsStats();
 
+  // Print per-page fragmentation statistics for old space, attributing live
+  // bytes on each page to the dominant instance type. Only valid while the
+  // full GC marking bitmaps are intact, i.e. after marking and before
+  // sweeping.
+  void CollectFragmentationStats();
+
   // Dump heap statistics in JSON format.
   void DumpJSONHeapStatistics(std::stringstream& stream);
 
@@ -582,6 +588,15 @@ class Heap final {
   bool IdleNotification(double deadline_in_seconds);
   bool IdleNotification(int idle_time_in_ms);
 
+  // Returns committed but currently unused memory to the operating system:
+  // pooled pages, pages whose memory is entirely on a free list, excess
+  // semispace capacity and the zone segment pool, in that order. Work stops
+  // once {deadline_in_ms} (compared against MonotonicallyIncreasingTimeInMs())
+  // is reached. Returns the total number of bytes released and optionally
+  // reports the bytes per category. Does nothing during a GC.
+  V8_EXPORT_PRIVATE size_t TrimMemory(
+      double deadline_in_ms, v8::Isolate::TrimMemoryReport* report = nullptr);
+
   V8_EXPORT_PRIVATE void MemoryPressureNotification(
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
@@ -1114,6 +1129,31 @@ class Heap final {
 
   EmbedderRootsHandler* GetEmbedderRootsHandler() const;
 
+  // ===========================================================================
+  // Pause budget. =============================================================
+  // ===========================================================================
+
+  // Sets a soft budget for individual main-thread GC pauses, see
+  // v8::Isolate::SetGCPauseBudget. A budget <= 0 clears it.
+  V8_EXPORT_PRIVATE void SetGCPauseBudget(double budget_in_ms);
+
+  // The configured pause budget; zero when no budget is set.
+  base::TimeDelta gc_pause_budget() const {
+    return base::TimeDelta::FromMicroseconds(
+        gc_pause_budget_in_us_.load(std::memory_order_relaxed));
+  }
+
+  // ===========================================================================
+  // Bulk allocation. ==========================================================
+  // ===========================================================================
+
+  // Backs v8::ObjectFactoryScope: pauses allocation observers so API object
+  // creation bump-allocates from the full linear allocation buffer without
+  // per-object step bookkeeping. Nestable; every StartBulkAllocation() must
+  // be matched by an EndBulkAllocation() on the main thread.
+  V8_EXPORT_PRIVATE void StartBulkAllocation();
+  V8_EXPORT_PRIVATE void EndBulkAllocation();
+
   // ===========================================================================
   // External string table API. ================================================
   // ===========================================================================
@@ -1212,6 +1252,20 @@ class Heap final {
   // Collect code (Code and BytecodeArray objects) statistics.
   void CollectCodeStatistics();
 
+  // Cumulative size of bytecode discarded by code flushing since the isolate
+  // was created, surfaced via v8::Isolate::GetHeapCodeAndMetadataStatistics.
+  size_t flushed_code_size() const { return flushed_code_size_; }
+  void IncrementFlushedCodeSize(size_t delta) { flushed_code_size_ += delta; }
+
+  // Cumulative size of source position tables discarded from old bytecode,
+  // surfaced via v8::Isolate::GetHeapCodeAndMetadataStatistics.
+  size_t flushed_source_position_size() const {
+    return flushed_source_position_size_;
+  }
+  void IncrementFlushedSourcePositionSize(size_t delta) {
+    flushed_source_position_size_ += delta;
+  }
+
   // ===========================================================================
   // GC statistics. ============================================================
   // ===========================================================================
@@ -1576,6 +1630,17 @@ class Heap final {
   // Calculates the nof entries for the full sized number to string cache.
   inline int MaxNumberToStringCacheSize() const;
 
+  // Instrumentation for the number to string cache. Hits and misses are
+  // forwarded to the V8.NumberStringCacheHits/Misses counters; the totals
+  // recorded since the last resize or flush drive the growth policy of
+  // --adaptive-number-string-cache.
+  void RecordNumberStringCacheHit();
+  void RecordNumberStringCacheMiss();
+  // Whether the lookups recorded since the last resize justify growing the
+  // cache. Only consulted with --adaptive-number-string-cache.
+  bool ShouldGrowNumberStringCache();
+  void ResetNumberStringCacheStatistics();
+
   static Isolate* GetIsolateFromWritableObject(Tagged<HeapObject> object);
 
   // Ensure that we have swept all spaces in such a way that we can iterate
@@ -1776,6 +1841,9 @@ class Heap final {
 
   enum class ResizeNewSpaceMode { kShrink, kGrow, kNone };
   ResizeNewSpaceMode ShouldResizeNewSpace();
+  // Survival-rate and pause-target driven resize decision, used when
+  // --adaptive-new-space-sizing is enabled.
+  ResizeNewSpaceMode AdaptiveResizeNewSpaceMode();
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
@@ -2100,6 +2168,18 @@ class Heap final {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  // Consecutive resize votes of the adaptive new space controller; positive
+  // for grow, negative for shrink. Used for hysteresis.
+  int adaptive_new_space_resize_votes_ = 0;
+
+  // Cumulative size of bytecode discarded by code flushing. Only updated on
+  // the main thread during the mark-compact atomic pause.
+  size_t flushed_code_size_ = 0;
+
+  // Cumulative size of source position tables discarded from old bytecode.
+  // Only updated on the main thread during the mark-compact atomic pause.
+  size_t flushed_source_position_size_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -2217,6 +2297,11 @@ class Heap final {
   int nodes_copied_in_new_space_ = 0;
   int nodes_promoted_ = 0;
 
+  // Number to string cache lookups since the last resize or flush of the
+  // cache, and how many of them hit.
+  size_t number_string_cache_lookups_ = 0;
+  size_t number_string_cache_hits_ = 0;
+
   // Total time spent in GC.
   base::TimeDelta total_gc_time_ms_;
 
@@ -2275,6 +2360,15 @@ class Heap final {
   EmbedderRootsHandler* embedder_roots_handler_ =
       nullptr;  // Owned by the embedder.
 
+  // Soft budget for main-thread GC pauses in microseconds; zero when no
+  // budget is configured. Atomic because sweeping from allocation may read it
+  // on background threads.
+  std::atomic<int64_t> gc_pause_budget_in_us_{0};
+
+  // State for StartBulkAllocation()/EndBulkAllocation().
+  int bulk_allocation_depth_ = 0;
+  base::Optional<PauseAllocationObserversScope> bulk_allocation_pause_;
+
   cppgc::EmbedderStackState embedder_stack_state_ =
       cppgc::EmbedderStackState::kMayContainHeapPointers;
 
@@ -61,16 +61,26 @@ static constexpr size_t kV8ActivationThreshold = 0;
 static constexpr size_t kEmbedderActivationThreshold = 0;
 #endif  // DEBUG
 
-base::TimeDelta GetMaxDuration(StepOrigin step_origin) {
+base::TimeDelta GetMaxDuration(Heap* heap, StepOrigin step_origin) {
   if (v8_flags.predictable) {
     return base::TimeDelta::Max();
   }
+  base::TimeDelta max_duration;
   switch (step_origin) {
     case StepOrigin::kTask:
-      return kMaxStepSizeOnTask;
+      max_duration = kMaxStepSizeOnTask;
+      break;
     case StepOrigin::kV8:
-      return kMaxStepSizeOnAllocation;
+      max_duration = kMaxStepSizeOnAllocation;
+      break;
   }
+  // An embedder-configured pause budget caps steps further, see
+  // v8::Isolate::SetGCPauseBudget.
+  const base::TimeDelta pause_budget = heap->gc_pause_budget();
+  if (!pause_budget.IsZero() && pause_budget < max_duration) {
+    return pause_budget;
+  }
+  return max_duration;
 }
 
 }  // namespace
@@ -743,7 +753,7 @@ size_t IncrementalMarking::GetScheduledBytes(StepOrigin step_origin) {
 
 void IncrementalMarking::AdvanceAndFinalizeIfComplete() {
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kTask);
-  Step(GetMaxDuration(StepOrigin::kTask), max_bytes_to_process,
+  Step(GetMaxDuration(heap_, StepOrigin::kTask), max_bytes_to_process,
        StepOrigin::kTask);
   if (IsMajorMarkingComplete()) {
     heap()->FinalizeIncrementalMarkingAtomically(
@@ -787,7 +797,8 @@ void IncrementalMarking::AdvanceOnAllocation() {
   DCHECK(IsMajorMarking());
 
   const size_t max_bytes_to_process = GetScheduledBytes(StepOrigin::kV8);
-  Step(GetMaxDuration(StepOrigin::kV8), max_bytes_to_process, StepOrigin::kV8);
+  Step(GetMaxDuration(heap_, StepOrigin::kV8), max_bytes_to_process,
+       StepOrigin::kV8);
 
   // Bail out when an AlwaysAllocateScope is active as the assumption is that
   // there's no GC being triggered. Check this condition at last position to
@@ -416,8 +416,10 @@ void NewLargeObjectSpace::FreeDeadObjects(
     Tagged<HeapObject> object = page->GetObject();
     if (is_dead(object)) {
       RemovePage(page);
-      heap()->memory_allocator()->Free(MemoryAllocator::FreeMode::kImmediately,
-                                       page);
+      heap()->memory_allocator()->Free(
+          v8_flags.large_page_pooling ? MemoryAllocator::FreeMode::kPool
+                                      : MemoryAllocator::FreeMode::kImmediately,
+          page);
       if (v8_flags.concurrent_marking && is_marking) {
         heap()->concurrent_marking()->ClearMemoryChunkData(page);
       }
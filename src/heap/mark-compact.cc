@@ -11,6 +11,7 @@
 #include <unordered_set>
 
 #include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
@@ -69,8 +70,10 @@
 #include "src/init/v8.h"
 #include "src/logging/tracing-flags.h"
 #include "src/objects/embedder-data-array-inl.h"
+#include "src/objects/fixed-array-inl.h"
 #include "src/objects/foreign.h"
 #include "src/objects/hash-table-inl.h"
+#include "src/objects/heap-number-inl.h"
 #include "src/objects/heap-object-inl.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -82,6 +85,7 @@
 #include "src/objects/string-forwarding-table-inl.h"
 #include "src/objects/transitions-inl.h"
 #include "src/objects/visitors.h"
+#include "src/sandbox/external-pointer-table-inl.h"
 #include "src/snapshot/shared-heap-serializer.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/tracing-category-observer.h"
@@ -414,6 +418,10 @@ void MarkCompactCollector::CollectGarbage() {
   VerifyMarking();
   heap_->memory_measurement()->FinishProcessing(native_context_stats_);
 
+  if (V8_UNLIKELY(v8_flags.trace_fragmentation_stats)) {
+    heap_->CollectFragmentationStats();
+  }
+
   Sweep();
   Evacuate();
   Finish();
@@ -2772,6 +2780,68 @@ class ClearSharedStructTypeRegistryJobItem final
   Isolate* const isolate_;
 };
 
+class ClearExternalStringTableJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearExternalStringTableJobItem(MarkCompactCollector* collector)
+      : collector_(collector),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  collector->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_EXTERNAL_STRING_TABLE)) {}
+
+  void Run(JobDelegate* delegate) final {
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(
+        collector_->heap()->isolate());
+
+    TRACE_GC1_WITH_FLOW(collector_->heap()->tracer(),
+                        GCTracer::Scope::MC_CLEAR_EXTERNAL_STRING_TABLE,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    // Note that dead external string resources are disposed on this thread,
+    // which may be a background worker.
+    collector_->ClearNonLiveExternalStringTableEntries();
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  MarkCompactCollector* const collector_;
+  const uint64_t trace_id_;
+};
+
+class ClearWeakCollectionsJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearWeakCollectionsJobItem(MarkCompactCollector* collector)
+      : collector_(collector),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  collector->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS)) {}
+
+  void Run(JobDelegate* delegate) final {
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(
+        collector_->heap()->isolate());
+
+    TRACE_GC1_WITH_FLOW(collector_->heap()->tracer(),
+                        GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    collector_->ClearWeakCollections();
+  }
+
+  uint64_t trace_id() const { return trace_id_; }
+
+ private:
+  MarkCompactCollector* const collector_;
+  const uint64_t trace_id_;
+};
+
 }  // namespace
 
 void MarkCompactCollector::ClearNonLiveReferences() {
@@ -2819,20 +2889,31 @@ void MarkCompactCollector::ClearNonLiveReferences() {
         std::make_unique<ClearSharedStructTypeRegistryJobItem>(isolate);
     clearing_job->Add(std::move(clear_shared_struct_type_registry_job_item));
   }
+  auto clear_external_string_table_job_item =
+      std::make_unique<ClearExternalStringTableJobItem>(this);
+  const uint64_t external_string_table_trace_id =
+      clear_external_string_table_job_item->trace_id();
+  clearing_job->Add(std::move(clear_external_string_table_job_item));
+  TRACE_GC_NOTE_WITH_FLOW("ClearExternalStringTableJob started",
+                          external_string_table_trace_id,
+                          TRACE_EVENT_FLAG_FLOW_OUT);
+  // Ephemeron resolution only depends on the final marking state and thus can
+  // run concurrently with the main-thread clearing phases below; the join
+  // before sweeping starts is the only handshake needed.
+  auto clear_weak_collections_job_item =
+      std::make_unique<ClearWeakCollectionsJobItem>(this);
+  const uint64_t weak_collections_trace_id =
+      clear_weak_collections_job_item->trace_id();
+  clearing_job->Add(std::move(clear_weak_collections_job_item));
+  TRACE_GC_NOTE_WITH_FLOW("ClearWeakCollectionsJob started",
+                          weak_collections_trace_id,
+                          TRACE_EVENT_FLAG_FLOW_OUT);
   auto clearing_job_handle = V8::GetCurrentPlatform()->CreateJob(
       TaskPriority::kUserBlocking, std::move(clearing_job));
   if (v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()) {
     clearing_job_handle->NotifyConcurrencyIncrease();
   }
 
-  {
-    TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_EXTERNAL_STRING_TABLE);
-    ExternalStringTableCleanerVisitor<ExternalStringTableCleaningMode::kAll>
-        external_visitor(heap_);
-    heap_->external_string_table_.IterateAll(&external_visitor);
-    heap_->external_string_table_.CleanUpAll();
-  }
-
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_GLOBAL_HANDLES);
     // We depend on `IterateWeakRootsForPhantomHandles()` being called before
@@ -2883,8 +2964,8 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   }
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
+    // ClearWeakCollections() runs concurrently in the clearing job.
     ClearWeakReferences();
-    ClearWeakCollections();
     ClearJSWeakRefs();
   }
 
@@ -2902,11 +2983,23 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // Note we explicitly do NOT run SweepAndCompact on
     // read_only_external_pointer_space since these entries are all immortal by
     // definition.
-    isolate->external_pointer_table().SweepAndCompact(
-        isolate->heap()->external_pointer_space(), isolate->counters());
+    ExternalPointerTable::Space* space =
+        isolate->heap()->external_pointer_space();
+    uint32_t live_entries = isolate->external_pointer_table().SweepAndCompact(
+        space, isolate->counters());
+    // With the mutator stopped and sweeping done, the freelist length is
+    // exact, so capacity can be derived from it and the live entry count.
+    heap_->tracer()->RecordExternalPointerTableStats(
+        live_entries + space->freelist_length(), live_entries);
     if (isolate->owns_shareable_data()) {
-      isolate->shared_external_pointer_table().SweepAndCompact(
-          isolate->shared_external_pointer_space(), isolate->counters());
+      ExternalPointerTable::Space* shared_space =
+          isolate->shared_external_pointer_space();
+      uint32_t shared_live_entries =
+          isolate->shared_external_pointer_table().SweepAndCompact(
+              shared_space, isolate->counters());
+      heap_->tracer()->RecordExternalPointerTableStats(
+          shared_live_entries + shared_space->freelist_length(),
+          shared_live_entries);
     }
   }
 #endif  // V8_ENABLE_SANDBOX
@@ -2933,6 +3026,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   }
 
   DCHECK(weak_objects_.transition_arrays.IsEmpty());
+  DCHECK(weak_objects_.ephemeron_hash_tables.IsEmpty());
   DCHECK(weak_objects_.weak_references.IsEmpty());
   DCHECK(weak_objects_.weak_objects_in_code.IsEmpty());
   DCHECK(weak_objects_.js_weak_refs.IsEmpty());
@@ -3057,6 +3151,8 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
 
   shared_info->set_uncompiled_data(uncompiled_data);
   DCHECK(!shared_info->is_compiled());
+
+  heap_->IncrementFlushedCodeSize(bytecode_array->Size());
 }
 
 void MarkCompactCollector::ProcessOldCodeCandidates() {
@@ -3073,7 +3169,11 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
       is_bytecode_live = ProcessOldBytecodeSFI(flushing_candidate);
     }
 
-    if (!is_bytecode_live) number_of_flushed_sfis++;
+    if (!is_bytecode_live) {
+      number_of_flushed_sfis++;
+    } else if (v8_flags.flush_source_positions) {
+      FlushSourcePositionsFromSFI(flushing_candidate);
+    }
 
     // Now record the slot, which has either been updated to an uncompiled data,
     // Baseline code or BytecodeArray which is still alive. If the sandbox is
@@ -3181,6 +3281,23 @@ void MarkCompactCollector::FlushSFI(Tagged<SharedFunctionInfo> sfi,
   }
 }
 
+void MarkCompactCollector::FlushSourcePositionsFromSFI(
+    Tagged<SharedFunctionInfo> sfi) {
+  // The candidate is old enough to be flushed but its bytecode is kept alive,
+  // e.g. by an activation on the stack or by another SharedFunctionInfo
+  // sharing the same BytecodeArray. The source position table is only needed
+  // for stack traces and debugging and can be recollected on demand, so drop
+  // it to reclaim the memory. Resetting the field to undefined restores the
+  // state of a lazily compiled function whose source positions were never
+  // collected; no slot needs to be recorded for the read-only value.
+  Tagged<BytecodeArray> bytecode = sfi->GetBytecodeArray(heap_->isolate());
+  if (!bytecode->HasSourcePositionTable()) return;
+  heap_->IncrementFlushedSourcePositionSize(
+      bytecode->SourcePositionTable()->Size());
+  bytecode->set_source_position_table(
+      ReadOnlyRoots(heap_->isolate()).undefined_value(), kReleaseStore);
+}
+
 void MarkCompactCollector::ClearFlushedJsFunctions() {
   DCHECK(v8_flags.flush_bytecode ||
          weak_objects_.flushed_js_functions.IsEmpty());
@@ -3444,7 +3561,8 @@ void MarkCompactCollector::TrimEnumCache(Tagged<Map> map,
 }
 
 void MarkCompactCollector::ClearWeakCollections() {
-  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+  // Traced by the caller (ClearWeakCollectionsJobItem), which may run this on
+  // a background thread.
   Tagged<EphemeronHashTable> table;
   while (local_weak_objects()->ephemeron_hash_tables_local.Pop(&table)) {
     for (InternalIndex i : table->IterateEntries()) {
@@ -3477,6 +3595,13 @@ void MarkCompactCollector::ClearWeakCollections() {
   }
 }
 
+void MarkCompactCollector::ClearNonLiveExternalStringTableEntries() {
+  ExternalStringTableCleanerVisitor<ExternalStringTableCleaningMode::kAll>
+      external_visitor(heap_);
+  heap_->external_string_table_.IterateAll(&external_visitor);
+  heap_->external_string_table_.CleanUpAll();
+}
+
 void MarkCompactCollector::ClearWeakReferences() {
   TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
   HeapObjectAndSlot slot;
@@ -4521,10 +4646,104 @@ class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
   }
 };
 
+namespace {
+
+// Fixed-size cache mapping HeapNumber bit patterns to a canonical live
+// HeapNumber. Colliding bit patterns simply evict each other; the table is a
+// best-effort cache, not an exhaustive index.
+class HeapNumberDedupTable {
+ public:
+  static constexpr size_t kNumBuckets = 4096;
+
+  Tagged<HeapNumber> Lookup(uint64_t bits) const {
+    const Entry& entry = entries_[BucketFor(bits)];
+    return entry.bits == bits ? entry.number : Tagged<HeapNumber>();
+  }
+
+  void Insert(uint64_t bits, Tagged<HeapNumber> number) {
+    entries_[BucketFor(bits)] = {bits, number};
+  }
+
+ private:
+  struct Entry {
+    uint64_t bits = kHoleNanInt64;
+    Tagged<HeapNumber> number;
+  };
+
+  static size_t BucketFor(uint64_t bits) {
+    return base::hash_value(bits) & (kNumBuckets - 1);
+  }
+
+  Entry entries_[kNumBuckets];
+};
+
+}  // namespace
+
+void MarkCompactCollector::DeduplicateHeapNumbers() {
+  // Only FixedArray slots are rewritten: HeapNumbers reachable from them are
+  // value objects, never the mutable boxes backing double-representation
+  // property fields, so aliasing them is unobservable. Duplicates abandoned
+  // here are still marked and get reclaimed by the next full GC.
+  PtrComprCageBase cage_base(heap_->isolate());
+  auto table = std::make_unique<HeapNumberDedupTable>();
+  size_t deduplicated_slots = 0;
+  for (Page* page : *heap_->old_space()) {
+    if (page->IsEvacuationCandidate()) continue;
+    for (auto [object, size] : LiveObjectRange(page)) {
+      USE(size);
+      if (object->map(cage_base)->instance_type() != FIXED_ARRAY_TYPE) {
+        continue;
+      }
+      Tagged<FixedArray> array = FixedArray::cast(object);
+      const int length = array->length();
+      for (int i = 0; i < length; i++) {
+        ObjectSlot slot = array->RawFieldOfElementAt(i);
+        Tagged<Object> value = slot.Relaxed_Load(cage_base);
+        if (!IsHeapObject(value)) continue;
+        Tagged<HeapObject> heap_object = HeapObject::cast(value);
+        if (!IsHeapNumber(heap_object, cage_base)) continue;
+        Tagged<HeapNumber> number = HeapNumber::cast(heap_object);
+        const uint64_t bits = number->value_as_bits();
+        // The hole NaN bit pattern is a sentinel; never alias it.
+        if (bits == kHoleNanInt64) continue;
+        Tagged<HeapNumber> canonical = table->Lookup(bits);
+        if (canonical.is_null()) {
+          // Only numbers that are guaranteed not to move during this cycle
+          // may serve as canonical targets; everything else is deduplicated
+          // against them on later visits only.
+          MemoryChunk* chunk = MemoryChunk::FromHeapObject(number);
+          if (chunk->InYoungGeneration() || chunk->IsEvacuationCandidate() ||
+              chunk->owner_identity() != OLD_SPACE) {
+            continue;
+          }
+          table->Insert(bits, number);
+        } else if (canonical != number) {
+          // No write barrier is needed: marking is finished and |canonical|
+          // is marked; stale remembered set entries for this slot are
+          // filtered during pointer updating.
+          slot.Relaxed_Store(canonical);
+          deduplicated_slots++;
+        }
+      }
+    }
+  }
+  if (v8_flags.trace_gc_verbose) {
+    PrintIsolate(heap_->isolate(),
+                 "Deduplicated %zu HeapNumber slots in old space\n",
+                 deduplicated_slots);
+  }
+}
+
 void MarkCompactCollector::Evacuate() {
   TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_EVACUATE);
   base::MutexGuard guard(heap_->relocation_mutex());
 
+  if (V8_UNLIKELY(v8_flags.deduplicate_heap_numbers)) {
+    TRACE_GC(heap_->tracer(),
+             GCTracer::Scope::MC_EVACUATE_DEDUPLICATE_HEAP_NUMBERS);
+    DeduplicateHeapNumbers();
+  }
+
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_EVACUATE_PROLOGUE);
     EvacuatePrologue();
@@ -4671,6 +4890,9 @@ class PointersUpdatingJob : public v8::JobTask {
 
 namespace {
 
+// PrefetchObjectHeader is shared with the marking visitors and lives in
+// marking-visitor-inl.h.
+
 class RememberedSetUpdatingItem : public UpdatingItem {
  public:
   explicit RememberedSetUpdatingItem(Heap* heap, MemoryChunk* chunk)
@@ -4681,6 +4903,9 @@ class RememberedSetUpdatingItem : public UpdatingItem {
                                     !chunk->InWritableSharedSpace()) {}
   ~RememberedSetUpdatingItem() override = default;
 
+  // Number of slots whose targets are prefetched ahead of updating them.
+  static constexpr size_t kSlotBatchSize = 64;
+
   void Process() override {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                  "RememberedSetUpdatingItem::Process");
@@ -4809,20 +5034,44 @@ class RememberedSetUpdatingItem : public UpdatingItem {
           },
           SlotSet::KEEP_EMPTY_BUCKETS);
     } else {
+      // Updating a slot chases the referenced object's map word, which is a
+      // dependent cache miss per slot since evacuated targets are scattered
+      // across the heap. Batch the slots and prefetch the targets' headers
+      // ahead of the updates to overlap those misses. Deferring the updates
+      // is safe because all slots are kept during iteration and dropped at
+      // once afterwards.
+      Address slot_batch[kSlotBatchSize];
+      size_t batch_size = 0;
+      auto flush_batch = [&]() {
+        for (size_t i = 0; i < batch_size; i++) {
+          MaybeObjectSlot slot(slot_batch[i]);
+          Tagged<HeapObject> heap_object;
+          if (slot.load(cage_base).GetHeapObject(&heap_object)) {
+            PrefetchObjectHeader(heap_object);
+          }
+        }
+        for (size_t i = 0; i < batch_size; i++) {
+          MaybeObjectSlot slot(slot_batch[i]);
+          UpdateSlot(cage_base, slot);
+          // A string might have been promoted into the shared heap during
+          // GC.
+          if (record_old_to_shared_slots_) {
+            CheckSlotForOldToSharedUntyped(cage_base, chunk_, slot);
+          }
+        }
+        batch_size = 0;
+      };
       RememberedSet<OLD_TO_OLD>::Iterate(
           chunk_,
           [&](MaybeObjectSlot slot) {
-            UpdateSlot(cage_base, slot);
-            // A string might have been promoted into the shared heap during
-            // GC.
-            if (record_old_to_shared_slots_) {
-              CheckSlotForOldToSharedUntyped(cage_base, chunk_, slot);
-            }
+            slot_batch[batch_size++] = slot.address();
+            if (batch_size == kSlotBatchSize) flush_batch();
             // Always keep slot since all slots are dropped at once after
             // iteration.
             return KEEP_SLOT;
           },
           SlotSet::KEEP_EMPTY_BUCKETS);
+      flush_batch();
     }
 
     chunk_->ReleaseSlotSet(OLD_TO_OLD);
@@ -4992,14 +5241,26 @@ template <typename IterateableSpace>
 void CollectRememberedSetUpdatingItems(
     std::vector<std::unique_ptr<UpdatingItem>>* items,
     IterateableSpace* space) {
+  std::vector<MemoryChunk*> chunks;
   for (MemoryChunk* chunk : *space) {
     // No need to update pointers on evacuation candidates. Evacuated pages will
     // be released after this phase.
     if (chunk->IsEvacuationCandidate()) continue;
     if (chunk->ContainsAnySlots()) {
-      items->emplace_back(
-          std::make_unique<RememberedSetUpdatingItem>(space->heap(), chunk));
-    }
+      chunks.push_back(chunk);
+    }
+  }
+  // Workers of the pointer-updating job claim runs of consecutive items.
+  // Address-sorting the items turns those runs into contiguous page spans, so
+  // each task's slot walk stays cache- and TLB-local instead of hopping
+  // across the space in allocation order.
+  std::sort(chunks.begin(), chunks.end(),
+            [](const MemoryChunk* a, const MemoryChunk* b) {
+              return a->address() < b->address();
+            });
+  for (MemoryChunk* chunk : chunks) {
+    items->emplace_back(
+        std::make_unique<RememberedSetUpdatingItem>(space->heap(), chunk));
   }
 }
 }  // namespace
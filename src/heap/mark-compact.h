@@ -162,6 +162,18 @@ class MarkCompactCollector final {
     return use_background_threads_in_cycle_;
   }
 
+  // After all reachable objects have been marked those weak map entries
+  // with an unreachable key are removed from all encountered weak maps.
+  // The linked list of all encountered weak maps is destroyed. May run on a
+  // background thread as part of the parallel clearing job, see
+  // ClearNonLiveReferences().
+  void ClearWeakCollections();
+
+  // Removes dead entries from the external string table and disposes their
+  // external resources. May run on a background thread as part of the
+  // parallel clearing job, see ClearNonLiveReferences().
+  void ClearNonLiveExternalStringTableEntries();
+
   Heap* heap() { return heap_; }
 
   explicit MarkCompactCollector(Heap* heap);
@@ -272,6 +284,11 @@ class MarkCompactCollector final {
   void FlushSFI(Tagged<SharedFunctionInfo> sfi,
                 bool bytecode_already_decompiled);
 
+  // Flushes the source position table of a bytecode array that is old enough
+  // to be a flushing candidate but is kept alive. The table is recollected on
+  // demand when source positions are requested again.
+  void FlushSourcePositionsFromSFI(Tagged<SharedFunctionInfo> sfi);
+
   void ProcessFlushedBaselineCandidates();
 
   // Resets any JSFunctions which have had their bytecode flushed.
@@ -290,11 +307,6 @@ class MarkCompactCollector final {
                                       int num_transitions);
   void WeakenStrongDescriptorArrays();
 
-  // After all reachable objects have been marked those weak map entries
-  // with an unreachable key are removed from all encountered weak maps.
-  // The linked list of all encountered weak maps is destroyed.
-  void ClearWeakCollections();
-
   // Goes through the list of encountered weak references and clears those with
   // dead values. If the value is a dead map and the parent map transitions to
   // the dead map via weak cell, then this function also clears the map
@@ -316,6 +328,11 @@ class MarkCompactCollector final {
   void EvacuatePagesInParallel();
   void UpdatePointersAfterEvacuation();
 
+  // With --deduplicate-heap-numbers, canonicalizes bit-identical HeapNumbers
+  // referenced from FixedArrays in old space. Runs in the atomic pause before
+  // evacuation starts, while markbits are still valid.
+  void DeduplicateHeapNumbers();
+
   void ReleaseEvacuationCandidates();
   // Returns number of aborted pages.
   size_t PostProcessAbortedEvacuationCandidates();
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_MARKING_VISITOR_INL_H_
 #define V8_HEAP_MARKING_VISITOR_INL_H_
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/marking-state-inl.h"
@@ -28,6 +30,14 @@
 namespace v8 {
 namespace internal {
 
+// Hints the CPU to bring the header of |object| into the cache ahead of a
+// map-word access. A no-op on compilers without a prefetch builtin.
+V8_INLINE void PrefetchObjectHeader(Tagged<HeapObject> object) {
+#if V8_CC_GNU
+  __builtin_prefetch(reinterpret_cast<void*>(object.address()), 0, 3);
+#endif
+}
+
 // ===========================================================================
 // Visiting strong and weak pointers =========================================
 // ===========================================================================
@@ -96,26 +106,61 @@ void MarkingVisitorBase<ConcreteVisitor>::ProcessWeakHeapObject(
   }
 }
 
+// class template arguments
+template <typename ConcreteVisitor>
+// method template arguments
+template <typename TSlot>
+void MarkingVisitorBase<ConcreteVisitor>::VisitSlot(Tagged<HeapObject> host,
+                                                    TSlot slot) {
+  using THeapObjectSlot = typename TSlot::THeapObjectSlot;
+  typename TSlot::TObject object =
+      slot.Relaxed_Load(ObjectVisitorWithCageBases::cage_base());
+  Tagged<HeapObject> heap_object;
+  if (object.GetHeapObjectIfStrong(&heap_object)) {
+    // If the reference changes concurrently from strong to weak, the write
+    // barrier will treat the weak reference as strong, so we won't miss the
+    // weak reference.
+    ProcessStrongHeapObject(host, THeapObjectSlot(slot), heap_object);
+  } else if (TSlot::kCanBeWeak && object.GetHeapObjectIfWeak(&heap_object)) {
+    ProcessWeakHeapObject(host, THeapObjectSlot(slot), heap_object);
+  }
+}
+
 // class template arguments
 template <typename ConcreteVisitor>
 // method template arguments
 template <typename TSlot>
 void MarkingVisitorBase<ConcreteVisitor>::VisitPointersImpl(
     Tagged<HeapObject> host, TSlot start, TSlot end) {
-  using THeapObjectSlot = typename TSlot::THeapObjectSlot;
-  for (TSlot slot = start; slot < end; ++slot) {
-    typename TSlot::TObject object =
-        slot.Relaxed_Load(ObjectVisitorWithCageBases::cage_base());
-    Tagged<HeapObject> heap_object;
-    if (object.GetHeapObjectIfStrong(&heap_object)) {
-      // If the reference changes concurrently from strong to weak, the write
-      // barrier will treat the weak reference as strong, so we won't miss the
-      // weak reference.
-      ProcessStrongHeapObject(host, THeapObjectSlot(slot), heap_object);
-    } else if (TSlot::kCanBeWeak && object.GetHeapObjectIfWeak(&heap_object)) {
-      ProcessWeakHeapObject(host, THeapObjectSlot(slot), heap_object);
+  TSlot slot = start;
+  // Wide slot ranges -- DescriptorArrays, Maps and FixedArrays make up most
+  // of the marked heap -- are dominated by cache misses on the targets' map
+  // words. Decode a batch of slots and prefetch every target's header before
+  // marking the batch, so the misses overlap instead of serializing. The
+  // slots are re-read in the marking loop below; a concurrent update in
+  // between only wastes a prefetch hint.
+  const size_t batch_size =
+      std::min<size_t>(v8_flags.marking_slot_batch_size, kMaxSlotBatchSize);
+  if (batch_size > 1) {
+    while (end - slot >= batch_size) {
+      const TSlot batch_end = slot + static_cast<int>(batch_size);
+      for (TSlot p = slot; p < batch_end; ++p) {
+        typename TSlot::TObject object =
+            p.Relaxed_Load(ObjectVisitorWithCageBases::cage_base());
+        Tagged<HeapObject> heap_object;
+        if (object.GetHeapObjectIfStrong(&heap_object) ||
+            (TSlot::kCanBeWeak && object.GetHeapObjectIfWeak(&heap_object))) {
+          PrefetchObjectHeader(heap_object);
+        }
+      }
+      for (; slot < batch_end; ++slot) {
+        VisitSlot(host, slot);
+      }
     }
   }
+  for (; slot < end; ++slot) {
+    VisitSlot(host, slot);
+  }
 }
 
 // class template arguments
@@ -349,7 +394,47 @@ bool MarkingVisitorBase<ConcreteVisitor>::HasBytecodeArrayForFlushing(
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushCode(
     Tagged<SharedFunctionInfo> sfi) const {
-  return IsStressFlushingEnabled(code_flush_mode_) || IsOld(sfi);
+  if (IsStressFlushingEnabled(code_flush_mode_)) return true;
+  if (!IsOld(sfi)) return false;
+  return !v8_flags.flush_code_cost_model || IsFlushingCostEffective(sfi);
+}
+
+// Estimates whether flushing {sfi} reclaims enough memory to justify the
+// recompilation it causes if the function runs again. Functions whose
+// recompilation is expensive relative to the reclaimed bytes -- little
+// bytecode, baseline code that needs re-tiering, or a feedback vector with
+// many IC slots to re-warm -- are only flushed once they have aged to twice
+// the regular threshold.
+template <typename ConcreteVisitor>
+bool MarkingVisitorBase<ConcreteVisitor>::IsFlushingCostEffective(
+    Tagged<SharedFunctionInfo> sfi) const {
+  // Get a snapshot of the function data field the same way
+  // HasBytecodeArrayForFlushing does, since this function can be called by
+  // the concurrent marker.
+  Tagged<Object> data = sfi->GetData(heap_->isolate());
+  bool has_baseline_code = false;
+  if (IsCode(data)) {
+    has_baseline_code = true;
+    data = Code::cast(data)->bytecode_or_interpreter_data(heap_->isolate());
+  }
+  if (!IsBytecodeArray(data)) return true;
+  Tagged<BytecodeArray> bytecode = BytecodeArray::cast(data);
+
+  bool is_expensive_to_recompile =
+      has_baseline_code || bytecode->length() < kCostModelMinBytecodeSize;
+  if (!is_expensive_to_recompile && sfi->HasFeedbackMetadata(kAcquireLoad)) {
+    is_expensive_to_recompile =
+        sfi->feedback_metadata(kAcquireLoad)->slot_count(kAcquireLoad) >=
+        kCostModelRichFeedbackSlotCount;
+  }
+  if (!is_expensive_to_recompile) return true;
+
+  if (v8_flags.flush_code_based_on_time) {
+    return sfi->age() >= 2 * v8_flags.bytecode_old_time;
+  } else if (v8_flags.flush_code_based_on_tab_visibility) {
+    return V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
+  }
+  return sfi->age() >= 2 * v8_flags.bytecode_old_age;
 }
 
 template <typename ConcreteVisitor>
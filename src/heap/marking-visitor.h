@@ -185,6 +185,9 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   void ProcessWeakHeapObject(Tagged<HeapObject> host, THeapObjectSlot slot,
                              Tagged<HeapObject> heap_object);
 
+  template <typename TSlot>
+  V8_INLINE void VisitSlot(Tagged<HeapObject> host, TSlot slot);
+
   template <typename TSlot>
   V8_INLINE void VisitPointersImpl(Tagged<HeapObject> host, TSlot start,
                                    TSlot end);
@@ -215,8 +218,19 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
 
   bool HasBytecodeArrayForFlushing(Tagged<SharedFunctionInfo> sfi) const;
   bool IsOld(Tagged<SharedFunctionInfo> sfi) const;
+  bool IsFlushingCostEffective(Tagged<SharedFunctionInfo> sfi) const;
   void MakeOlder(Tagged<SharedFunctionInfo> sfi) const;
 
+  // Thresholds for the --flush-code-cost-model heuristic: bytecode below the
+  // minimum size reclaims too little to be worth a recompile, and feedback
+  // vectors with many slots indicate ICs that were expensive to warm up.
+  static constexpr int kCostModelMinBytecodeSize = 128;
+  static constexpr int kCostModelRichFeedbackSlotCount = 16;
+
+  // Upper bound for --marking-slot-batch-size; larger batches evict their own
+  // prefetched lines before the marking loop reaches them.
+  static constexpr size_t kMaxSlotBatchSize = 64;
+
   MarkingWorklists::Local* const local_marking_worklists_;
   WeakObjects::Local* const local_weak_objects_;
   Heap* const heap_;
@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -64,11 +65,59 @@ void MemoryAllocator::TearDown() {
   trusted_page_allocator_ = nullptr;
 }
 
+void MemoryAllocator::Pool::AddLarge(MemoryChunk* chunk) {
+  DCHECK_NOT_NULL(chunk);
+  DCHECK(chunk->IsLargePage());
+  DCHECK(!chunk->IsTrusted());
+  DCHECK_NE(chunk->executable(), EXECUTABLE);
+  chunk->ReleaseAllAllocatedMemory();
+
+  MemoryChunk* evicted = nullptr;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (pooled_large_chunks_.size() >= kMaxPooledLargeChunks) {
+      // Evict the oldest chunk; it is the least likely to still match the
+      // sizes the workload currently allocates.
+      evicted = pooled_large_chunks_.front();
+      pooled_large_chunks_.erase(pooled_large_chunks_.begin());
+    }
+    pooled_large_chunks_.push_back(chunk);
+  }
+  if (evicted != nullptr) {
+    VirtualMemory* reservation = evicted->reserved_memory();
+    DCHECK(reservation->IsReserved());
+    reservation->Free();
+  }
+}
+
+MemoryChunk* MemoryAllocator::Pool::TryGetPooledLarge(size_t chunk_size) {
+  base::MutexGuard guard(&mutex_);
+  // Pick the smallest pooled chunk that can back |chunk_size| bytes without
+  // wasting more than half of its committed memory. This approximates a free
+  // list of power-of-two size classes.
+  auto best = pooled_large_chunks_.end();
+  for (auto it = pooled_large_chunks_.begin();
+       it != pooled_large_chunks_.end(); ++it) {
+    const size_t size = (*it)->size();
+    if (size < chunk_size || chunk_size < size / 2) continue;
+    if (best == pooled_large_chunks_.end() || size < (*best)->size()) {
+      best = it;
+    }
+  }
+  if (best == pooled_large_chunks_.end()) return nullptr;
+  MemoryChunk* chunk = *best;
+  pooled_large_chunks_.erase(best);
+  return chunk;
+}
+
 void MemoryAllocator::Pool::ReleasePooledChunks() {
   std::vector<MemoryChunk*> copied_pooled;
   {
     base::MutexGuard guard(&mutex_);
     std::swap(copied_pooled, pooled_chunks_);
+    copied_pooled.insert(copied_pooled.end(), pooled_large_chunks_.begin(),
+                         pooled_large_chunks_.end());
+    pooled_large_chunks_.clear();
   }
   for (auto* chunk : copied_pooled) {
     DCHECK_NOT_NULL(chunk);
@@ -89,7 +138,12 @@ int MemoryAllocator::Pool::NumberOfChunks() const {
 }
 
 size_t MemoryAllocator::Pool::CommittedBufferedMemory() const {
-  return NumberOfCommittedChunks() * Page::kPageSize;
+  base::MutexGuard guard(&mutex_);
+  size_t buffered = pooled_chunks_.size() * Page::kPageSize;
+  for (const MemoryChunk* chunk : pooled_large_chunks_) {
+    buffered += chunk->size();
+  }
+  return buffered;
 }
 
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation,
@@ -144,6 +198,14 @@ Address MemoryAllocator::AllocateAlignedMemory(
 
   Address base = reservation.address();
 
+  if (V8_UNLIKELY(isolate_->preferred_numa_node() >= 0)) {
+    // Best effort: have this chunk's pages placed on the isolate's node when
+    // they are faulted in. Pages recycled from the pool that are already
+    // resident on another node are not migrated.
+    base::OS::BindMemoryToNumaNode(reinterpret_cast<void*>(base), chunk_size,
+                                   isolate_->preferred_numa_node());
+  }
+
   if (executable == EXECUTABLE) {
     if (!SetPermissionsOnExecutableMemoryChunk(&reservation, base, area_size,
                                                chunk_size)) {
@@ -159,6 +221,12 @@ Address MemoryAllocator::AllocateAlignedMemory(
     if (reservation.SetPermissions(base, commit_size,
                                    PageAllocator::kReadWrite)) {
       UpdateAllocatedSpaceLimits(base, base + commit_size, NOT_EXECUTABLE);
+      if (V8_UNLIKELY(v8_flags.huge_pages_for_heap)) {
+        // Only has an effect for chunks spanning at least one aligned huge
+        // page (e.g. in large object space); regular chunks rely on the
+        // advice placed on the pointer compression cage instead.
+        base::OS::AdviseHugePages(reinterpret_cast<void*>(base), commit_size);
+      }
     } else {
       return HandleAllocationFailure(NOT_EXECUTABLE);
     }
@@ -432,11 +500,15 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
       queued_pages_to_be_freed_.push_back(chunk);
       break;
     case FreeMode::kPool:
-      DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
       DCHECK_EQ(chunk->executable(), NOT_EXECUTABLE);
       PreFreeMemory(chunk);
-      // The chunks added to this queue will be cached until memory reducing GC.
-      pool()->Add(chunk);
+      // The chunks added to the pool will be cached until memory reducing GC.
+      if (chunk->IsLargePage()) {
+        pool()->AddLarge(chunk);
+      } else {
+        DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
+        pool()->Add(chunk);
+      }
       break;
   }
 }
@@ -493,9 +565,16 @@ MemoryAllocator::RemapSharedPage(
 LargePage* MemoryAllocator::AllocateLargePage(LargeObjectSpace* space,
                                               size_t object_size,
                                               Executability executable) {
-  base::Optional<MemoryChunkAllocationResult> chunk_info =
-      AllocateUninitializedChunk(space, object_size, executable,
-                                 PageSize::kLarge);
+  base::Optional<MemoryChunkAllocationResult> chunk_info;
+  if (v8_flags.large_page_pooling && executable == NOT_EXECUTABLE &&
+      (space->identity() == LO_SPACE || space->identity() == NEW_LO_SPACE)) {
+    chunk_info = AllocateUninitializedLargePageFromPool(space, object_size);
+  }
+
+  if (!chunk_info) {
+    chunk_info = AllocateUninitializedChunk(space, object_size, executable,
+                                            PageSize::kLarge);
+  }
 
   if (!chunk_info) return nullptr;
 
@@ -535,6 +614,33 @@ MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   };
 }
 
+base::Optional<MemoryAllocator::MemoryChunkAllocationResult>
+MemoryAllocator::AllocateUninitializedLargePageFromPool(LargeObjectSpace* space,
+                                                        size_t object_size) {
+  const size_t chunk_size =
+      ComputeChunkSize(object_size, space->identity(), NOT_EXECUTABLE);
+  MemoryChunk* chunk = pool()->TryGetPooledLarge(chunk_size);
+  if (chunk == nullptr) return {};
+  // The pooled chunk may be larger than required; the slack beyond the object
+  // area stays committed but unused, just like the rounding slack of a
+  // freshly allocated chunk.
+  const size_t size = chunk->size();
+  const Address start = chunk->address();
+  const Address area_start =
+      start +
+      MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(space->identity());
+  const Address area_end = area_start + object_size;
+  VirtualMemory reservation(data_page_allocator(), start, size);
+  if (heap::ShouldZapGarbage()) {
+    heap::ZapBlock(start, size, kZapValue);
+  }
+
+  size_ += size;
+  return MemoryChunkAllocationResult{
+      chunk, size, area_start, area_end, std::move(reservation),
+  };
+}
+
 void MemoryAllocator::InitializeOncePerProcess() {
   commit_page_size_ = v8_flags.v8_os_page_size > 0
                           ? v8_flags.v8_os_page_size * KB
@@ -70,6 +70,15 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Adds a large chunk to the pool. If the pool is at capacity, the oldest
+    // pooled large chunk is released to the OS.
+    void AddLarge(MemoryChunk* chunk);
+
+    // Returns a pooled large chunk that can back a chunk of |chunk_size|
+    // bytes without wasting more than half of its committed memory, or null
+    // if there is no such chunk.
+    MemoryChunk* TryGetPooledLarge(size_t chunk_size);
+
     void ReleasePooledChunks();
 
     size_t NumberOfCommittedChunks() const;
@@ -77,8 +86,14 @@ class MemoryAllocator {
     size_t CommittedBufferedMemory() const;
 
    private:
+    // Large chunks are only buffered up to this count to bound the memory
+    // held by the pool; regular chunks are released in bulk on memory
+    // reducing GCs instead.
+    static constexpr size_t kMaxPooledLargeChunks = 8;
+
     MemoryAllocator* const allocator_;
     std::vector<MemoryChunk*> pooled_chunks_;
+    std::vector<MemoryChunk*> pooled_large_chunks_;
     mutable base::Mutex mutex_;
 
     friend class MemoryAllocator;
@@ -322,6 +337,12 @@ class MemoryAllocator {
   base::Optional<MemoryChunkAllocationResult> AllocateUninitializedPageFromPool(
       Space* space);
 
+  // See AllocateLargePage for public interface. Tries to reuse a pooled large
+  // chunk of a matching size class for a NOT_EXECUTABLE large page.
+  base::Optional<MemoryChunkAllocationResult>
+  AllocateUninitializedLargePageFromPool(LargeObjectSpace* space,
+                                         size_t object_size);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -216,16 +216,29 @@ bool MemoryMeasurement::EnqueueRequest(
 }
 
 std::vector<Address> MemoryMeasurement::StartProcessing() {
-  if (received_.empty()) return {};
   std::unordered_set<Address> unique_contexts;
-  DCHECK(processing_.empty());
-  processing_ = std::move(received_);
-  for (const auto& request : processing_) {
-    Handle<WeakFixedArray> contexts = request.contexts;
-    for (int i = 0; i < contexts->length(); i++) {
-      Tagged<HeapObject> context;
-      if (contexts->get(i).GetHeapObject(&context)) {
-        unique_contexts.insert(context.ptr());
+  if (!received_.empty()) {
+    DCHECK(processing_.empty());
+    processing_ = std::move(received_);
+    for (const auto& request : processing_) {
+      Handle<WeakFixedArray> contexts = request.contexts;
+      for (int i = 0; i < contexts->length(); i++) {
+        Tagged<HeapObject> context;
+        if (contexts->get(i).GetHeapObject(&context)) {
+          unique_contexts.insert(context.ptr());
+        }
+      }
+    }
+  }
+  // Contexts with a configured memory limit are accounted on every full GC,
+  // independently of pending measurement requests, so that limit violations
+  // are detected without the embedder polling.
+  if (isolate_->context_memory_limit_callback() != nullptr) {
+    HandleScope handle_scope(isolate_);
+    for (Handle<NativeContext> context :
+         isolate_->heap()->FindAllNativeContexts()) {
+      if (context->GetMemoryLimit() > 0) {
+        unique_contexts.insert(context->ptr());
       }
     }
   }
@@ -233,6 +246,7 @@ std::vector<Address> MemoryMeasurement::StartProcessing() {
 }
 
 void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
+  CheckMemoryLimits(stats);
   if (processing_.empty()) return;
 
   size_t shared = stats.Get(MarkingWorklists::kSharedContext);
@@ -262,6 +276,40 @@ void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
   ScheduleReportingTask();
 }
 
+void MemoryMeasurement::CheckMemoryLimits(const NativeContextStats& stats) {
+  if (isolate_->context_memory_limit_callback() == nullptr) return;
+  HandleScope handle_scope(isolate_);
+  for (Handle<NativeContext> context :
+       isolate_->heap()->FindAllNativeContexts()) {
+    size_t limit = context->GetMemoryLimit();
+    if (limit == 0) continue;
+    size_t usage = stats.Get(context->ptr());
+    if (usage <= limit) continue;
+    limit_violations_.push_back(
+        {isolate_->global_handles()->Create(*context), usage, limit});
+  }
+  if (!limit_violations_.empty()) ScheduleReportingTask();
+}
+
+void MemoryMeasurement::ReportLimitViolations() {
+  std::vector<LimitViolation> violations = std::move(limit_violations_);
+  limit_violations_.clear();
+  ContextMemoryLimitCallback callback =
+      isolate_->context_memory_limit_callback();
+  for (LimitViolation& violation : violations) {
+    {
+      HandleScope handle_scope(isolate_);
+      Local<v8::Context> context = Utils::Convert<HeapObject, v8::Context>(
+          violation.context, isolate_);
+      // The callback may have been removed between the GC and this task.
+      if (callback != nullptr) {
+        callback(context, violation.usage, violation.limit);
+      }
+    }
+    isolate_->global_handles()->Destroy(violation.context.location());
+  }
+}
+
 void MemoryMeasurement::ScheduleReportingTask() {
   if (reporting_task_pending_) return;
   reporting_task_pending_ = true;
@@ -373,6 +421,7 @@ void MemoryMeasurement::ReportResults() {
     isolate_->counters()->measure_memory_delay_ms()->AddSample(
         static_cast<int>(request.timer.Elapsed().InMilliseconds()));
   }
+  ReportLimitViolations();
 }
 
 std::unique_ptr<v8::MeasureMemoryDelegate> MemoryMeasurement::DefaultDelegate(
@@ -47,8 +47,16 @@ class MemoryMeasurement {
     size_t wasm_metadata;
     base::ElapsedTimer timer;
   };
+  struct LimitViolation {
+    // Global handle keeping the context alive until the callback ran.
+    Handle<NativeContext> context;
+    size_t usage;
+    size_t limit;
+  };
   void ScheduleReportingTask();
   void ReportResults();
+  void CheckMemoryLimits(const NativeContextStats& stats);
+  void ReportLimitViolations();
   void ScheduleGCTask(v8::MeasureMemoryExecution execution);
   bool IsGCTaskPending(v8::MeasureMemoryExecution execution);
   void SetGCTaskPending(v8::MeasureMemoryExecution execution);
@@ -58,6 +66,7 @@ class MemoryMeasurement {
   std::list<Request> received_;
   std::list<Request> processing_;
   std::list<Request> done_;
+  std::vector<LimitViolation> limit_violations_;
   Isolate* isolate_;
   std::shared_ptr<v8::TaskRunner> task_runner_;
   bool reporting_task_pending_ = false;
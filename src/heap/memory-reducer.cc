@@ -19,6 +19,7 @@ const int MemoryReducer::kShortDelayMs = 500;
 const int MemoryReducer::kWatchdogDelayMs = 100000;
 const double MemoryReducer::kCommittedMemoryFactor = 1.1;
 const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
+const double MemoryReducer::kTrimBudgetMs = 2;
 
 MemoryReducer::MemoryReducer(Heap* heap)
     : heap_(heap),
@@ -67,6 +68,25 @@ void MemoryReducer::TimerTask::RunInternal() {
 }
 
 
+MemoryReducer::TrimTask::TrimTask(MemoryReducer* memory_reducer)
+    : CancelableTask(memory_reducer->heap()->isolate()),
+      memory_reducer_(memory_reducer) {}
+
+void MemoryReducer::TrimTask::RunInternal() {
+  Heap* heap = memory_reducer_->heap();
+  v8::Isolate::TrimMemoryReport report;
+  const size_t released = heap->TrimMemory(
+      heap->MonotonicallyIncreasingTimeInMs() + kTrimBudgetMs, &report);
+  if (v8_flags.trace_memory_reducer) {
+    heap->isolate()->PrintWithTimestamp(
+        "Memory reducer: trimmed %zu KB (pooled %zu KB, free-list pages %zu "
+        "KB, new space %zu KB, zone %zu KB)\n",
+        released / KB, report.pooled_pages_bytes / KB,
+        report.free_list_pages_bytes / KB, report.new_space_bytes / KB,
+        report.zone_segment_bytes / KB);
+  }
+}
+
 void MemoryReducer::NotifyTimer(const Event& event) {
   if (state_.id() != kWait) return;
   DCHECK_EQ(kTimer, event.type);
@@ -118,6 +138,12 @@ void MemoryReducer::NotifyMarkCompact(size_t committed_memory_before) {
         "Memory reducer: finished GC #%d (%s)\n", old_state.started_gcs(),
         state_.id() == kWait ? "will do more" : "done");
   }
+  if (old_state.id() == kRun && state_.id() == kDone &&
+      v8_flags.memory_reducer_trims_memory) {
+    // The GC sequence is done; return committed but unused memory to the OS
+    // once concurrent sweeping has had a chance to finish.
+    ScheduleTrim(kShortDelayMs);
+  }
 }
 
 void MemoryReducer::NotifyPossibleGarbage() {
@@ -224,6 +250,13 @@ void MemoryReducer::ScheduleTimer(double delay_ms) {
                                (delay_ms + kSlackMs) / 1000.0);
 }
 
+void MemoryReducer::ScheduleTrim(double delay_ms) {
+  DCHECK_LT(0, delay_ms);
+  if (heap()->IsTearingDown()) return;
+  taskrunner_->PostDelayedTask(std::make_unique<MemoryReducer::TrimTask>(this),
+                               delay_ms / 1000.0);
+}
+
 void MemoryReducer::TearDown() { state_ = State::CreateUninitialized(); }
 
 // static
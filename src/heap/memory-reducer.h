@@ -169,6 +169,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   static const int kLongDelayMs;
   static const int kShortDelayMs;
   static const int kWatchdogDelayMs;
+  // Time budget for a single Heap::TrimMemory call scheduled after the GC
+  // sequence is done (with --memory-reducer-trims-memory).
+  static const double kTrimBudgetMs;
   // The committed memory has to increase by at least this factor since the
   // last run in order to trigger a new run after mark-compact.
   static const double kCommittedMemoryFactor;
@@ -195,7 +198,21 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     MemoryReducer* memory_reducer_;
   };
 
+  class TrimTask : public v8::internal::CancelableTask {
+   public:
+    explicit TrimTask(MemoryReducer* memory_reducer);
+    TrimTask(const TrimTask&) = delete;
+    TrimTask& operator=(const TrimTask&) = delete;
+
+   private:
+    // v8::internal::CancelableTask overrides.
+    void RunInternal() override;
+    MemoryReducer* memory_reducer_;
+  };
+
   void NotifyTimer(const Event& event);
+  // Posts a task that returns committed but unused memory to the OS.
+  void ScheduleTrim(double delay_ms);
 
   static bool WatchdogGC(const State& state, const Event& event);
 
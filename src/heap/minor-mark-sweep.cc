@@ -668,7 +668,17 @@ void MinorMarkSweepCollector::MarkLiveObjects() {
 
   {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MINOR_MS_MARK_CLOSURE);
+    // Conservative stack scanning may have discovered a new sub-graph to mark.
+    // The concurrent marking job was joined above, so rescheduling spawns a
+    // fresh job over the same worklists to process that sub-graph in parallel
+    // with the main thread.
+    if (v8_flags.parallel_marking) {
+      local_marking_worklists()->Publish();
+      heap_->concurrent_marking()->RescheduleJobIfNeeded(
+          GarbageCollector::MINOR_MARK_SWEEPER, TaskPriority::kUserBlocking);
+    }
     DrainMarkingWorklist();
+    FinishConcurrentMarking();
   }
   CHECK(local_marking_worklists()->IsEmpty());
 
@@ -876,8 +886,10 @@ bool MinorMarkSweepCollector::SweepNewLargeSpace() {
     if (!non_atomic_marking_state_->IsMarked(object)) {
       // Object is dead and page can be released.
       new_lo_space->RemovePage(current);
-      heap_->memory_allocator()->Free(MemoryAllocator::FreeMode::kImmediately,
-                                      current);
+      heap_->memory_allocator()->Free(
+          v8_flags.large_page_pooling ? MemoryAllocator::FreeMode::kPool
+                                      : MemoryAllocator::FreeMode::kImmediately,
+          current);
       continue;
     }
     current->ClearFlag(MemoryChunk::TO_PAGE);
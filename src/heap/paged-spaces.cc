@@ -360,6 +360,24 @@ void PagedSpaceBase::ReleasePageImpl(Page* page,
   heap()->memory_allocator()->Free(free_mode, page);
 }
 
+size_t PagedSpaceBase::ReleaseEmptyFreeListPages() {
+  // Guard against concurrent free list allocation from background threads.
+  base::MutexGuard guard(mutex());
+  size_t released = 0;
+  for (auto it = begin(); it != end();) {
+    Page* page = *(it++);
+    // Pages backing a background linear allocation area have allocated bytes
+    // accounted to them and are skipped here.
+    if (page->allocated_bytes() > 0 || page->live_bytes() > 0 ||
+        !page->SweepingDone()) {
+      continue;
+    }
+    released += page->size();
+    ReleasePageImpl(page, MemoryAllocator::FreeMode::kImmediately);
+  }
+  return released;
+}
+
 std::unique_ptr<ObjectIterator> PagedSpaceBase::GetObjectIterator(Heap* heap) {
   return std::unique_ptr<ObjectIterator>(
       new PagedSpaceObjectIterator(heap, this));
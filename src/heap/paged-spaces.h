@@ -199,6 +199,11 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
 
   virtual void ReleasePage(Page* page);
 
+  // Releases all pages whose memory is entirely on the free list back to the
+  // OS and returns the number of bytes of committed memory released. Must not
+  // be called while sweeping is in progress.
+  size_t ReleaseEmptyFreeListPages();
+
   // Adds the page to this space and returns the number of bytes added to the
   // free list of the space.
   virtual size_t AddPage(Page* page);
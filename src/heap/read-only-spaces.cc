@@ -24,6 +24,10 @@
 #include "src/snapshot/snapshot-source-sink.h"
 #include "src/snapshot/snapshot-utils.h"
 
+#if V8_OS_LINUX
+#include <sys/mman.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -381,6 +385,19 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if (v8_flags.mergeable_read_only_pages) {
+#if V8_OS_LINUX
+    // The sealed read-only pages are byte-identical in every process built
+    // from the same snapshot, so let KSM deduplicate them across the
+    // processes on the host. This is advisory; errors (e.g. KSM disabled)
+    // are ignored.
+    for (BasicMemoryChunk* chunk : pages_) {
+      madvise(reinterpret_cast<void*>(chunk->address()), chunk->size(),
+              MADV_MERGEABLE);
+    }
+#endif  // V8_OS_LINUX
+  }
 }
 
 void ReadOnlySpace::Unseal() {
@@ -590,11 +590,23 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
 
 int ScavengerCollector::NumberOfScavengeTasks() {
   if (!v8_flags.parallel_scavenge) return 1;
+  // Estimate the number of tasks from the bytes the scavenge will actually
+  // have to copy or promote, not from total young generation capacity: a
+  // large, mostly-dead young gen otherwise spawns tasks with nothing to do,
+  // while a small young gen with high survival is starved. The expected
+  // survivor volume is predicted from the current live young-gen size and
+  // the survival ratios recorded by the tracer for recent scavenges (in
+  // percent). Before the first scavenge there is no feedback yet; assume
+  // everything survives.
+  const size_t young_size = heap_->new_space()->Size();
+  double survival_ratio = heap_->tracer()->SurvivalEventsRecorded()
+                              ? heap_->tracer()->AverageSurvivalRatio() / 100.0
+                              : 1.0;
+  survival_ratio = std::min(survival_ratio, 1.0);
+  const size_t expected_survivor_bytes =
+      static_cast<size_t>(young_size * survival_ratio);
   const int num_scavenge_tasks =
-      static_cast<int>(
-          SemiSpaceNewSpace::From(heap_->new_space())->TotalCapacity()) /
-          MB +
-      1;
+      static_cast<int>(expected_survivor_bytes / kSurvivorBytesPerTask) + 1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
   int tasks = std::max(
       1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
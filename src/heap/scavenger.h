@@ -248,6 +248,9 @@ class ScavengerCollector {
  public:
   static const int kMaxScavengerTasks = 8;
   static const int kMainThreadId = 0;
+  // Expected volume of copied plus promoted bytes one scavenge task is sized
+  // to handle, see NumberOfScavengeTasks.
+  static const size_t kSurvivorBytesPerTask = 512 * KB;
 
   explicit ScavengerCollector(Heap* heap);
 
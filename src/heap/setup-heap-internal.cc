@@ -22,8 +22,10 @@
 #include "src/objects/contexts.h"
 #include "src/objects/data-handler.h"
 #include "src/objects/debug-objects.h"
+#include "src/objects/deoptimization-data.h"
 #include "src/objects/descriptor-array.h"
 #include "src/objects/dictionary.h"
+#include "src/objects/feedback-vector.h"
 #include "src/objects/foreign.h"
 #include "src/objects/heap-number.h"
 #include "src/objects/instance-type-inl.h"
@@ -41,6 +43,7 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/promise.h"
 #include "src/objects/property-descriptor-object.h"
+#include "src/objects/scope-info.h"
 #include "src/objects/script.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/smi.h"
@@ -1307,6 +1310,20 @@ void Heap::CreateInitialMutableObjects() {
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
+  // Allocate cache for sharing deoptimization frame translations.
+  set_frame_translation_cache(*factory->NewFixedArray(
+      FrameTranslationCache::kCacheSize * FrameTranslationCache::kEntrySize,
+      AllocationType::kOld));
+
+  // Allocate caches for sharing compilation metadata across functions.
+  set_scope_info_dedup_cache(*factory->NewFixedArray(
+      ScopeInfoDedupCache::kCacheSize * ScopeInfoDedupCache::kEntrySize,
+      AllocationType::kOld));
+  set_feedback_metadata_dedup_cache(*factory->NewFixedArray(
+      FeedbackMetadataDedupCache::kCacheSize *
+          FeedbackMetadataDedupCache::kEntrySize,
+      AllocationType::kOld));
+
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
       factory->NewManyClosuresCell(factory->undefined_value());
@@ -305,8 +305,9 @@ void Sweeper::SweepingState<scope>::StartConcurrentSweeping() {
       }
     }
     DCHECK_EQ(max_concurrent_sweeper_count, concurrent_sweepers_.size());
-    job_handle_ = V8::GetCurrentPlatform()->PostJob(TaskPriority::kUserVisible,
-                                                    std::move(job));
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        sweeper_->heap_->isolate()->background_gc_task_priority(),
+        std::move(job));
   }
 }
 
@@ -343,7 +344,7 @@ template <Sweeper::SweepingScope scope>
 void Sweeper::SweepingState<scope>::Resume() {
   DCHECK(in_progress_);
   job_handle_ = V8::GetCurrentPlatform()->PostJob(
-      TaskPriority::kUserVisible,
+      sweeper_->heap_->isolate()->background_gc_task_priority(),
       std::make_unique<SweeperJob>(sweeper_->heap_->isolate(), sweeper_));
 }
 
@@ -361,7 +362,11 @@ void Sweeper::LocalSweeper::ContributeAndWaitForPromotedPagesIteration() {
 
 void Sweeper::LocalSweeper::ParallelSweepSpace(AllocationSpace identity,
                                                SweepingMode sweeping_mode,
-                                               int max_pages) {
+                                               int max_pages,
+                                               base::TimeDelta max_duration) {
+  const bool is_time_bounded = max_duration < base::TimeDelta::Max();
+  const base::TimeTicks start =
+      is_time_bounded ? base::TimeTicks::Now() : base::TimeTicks();
   int pages_freed = 0;
   Page* page = nullptr;
   while ((page = sweeper_->GetSweepingPageSafe(identity)) != nullptr) {
@@ -372,6 +377,9 @@ void Sweeper::LocalSweeper::ParallelSweepSpace(AllocationSpace identity,
       continue;
     }
     if ((max_pages > 0) && (pages_freed >= max_pages)) return;
+    if (is_time_bounded && (base::TimeTicks::Now() - start >= max_duration)) {
+      return;
+    }
   }
 }
 
@@ -1056,8 +1064,16 @@ size_t Sweeper::ConcurrentMajorSweepingPageCount() {
 void Sweeper::ParallelSweepSpace(AllocationSpace identity,
                                  SweepingMode sweeping_mode, int max_pages) {
   DCHECK_IMPLIES(identity == NEW_SPACE, heap_->IsMainThread());
+  // Lazy sweeping from the mutator honors the embedder's pause budget, see
+  // v8::Isolate::SetGCPauseBudget. The Finish* paths bypass this method and
+  // always drain all pages.
+  base::TimeDelta max_duration = base::TimeDelta::Max();
+  if (sweeping_mode == SweepingMode::kLazyOrConcurrent) {
+    const base::TimeDelta pause_budget = heap_->gc_pause_budget();
+    if (!pause_budget.IsZero()) max_duration = pause_budget;
+  }
   main_thread_local_sweeper_.ParallelSweepSpace(identity, sweeping_mode,
-                                                max_pages);
+                                                max_pages, max_duration);
 }
 
 void Sweeper::EnsurePageIsSwept(Page* page) {
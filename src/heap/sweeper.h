@@ -72,8 +72,9 @@ class Sweeper {
     }
     ~LocalSweeper() = default;
 
-    void ParallelSweepSpace(AllocationSpace identity,
-                            SweepingMode sweeping_mode, int max_pages);
+    void ParallelSweepSpace(
+        AllocationSpace identity, SweepingMode sweeping_mode, int max_pages,
+        base::TimeDelta max_duration = base::TimeDelta::Max());
     void ContributeAndWaitForPromotedPagesIteration();
 
    private:
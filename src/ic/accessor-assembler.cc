@@ -641,6 +641,7 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
       nonexistent(this), accessor(this, Label::kDeferred),
       global(this, Label::kDeferred), module_export(this, Label::kDeferred),
       proxy(this, Label::kDeferred),
+      proxy_get_trap(this, Label::kDeferred),
       native_data_property(this, Label::kDeferred),
       api_getter(this, Label::kDeferred);
 
@@ -670,6 +671,8 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
 
   GotoIf(Word32Equal(handler_kind, LOAD_KIND(kProxy)), &proxy);
 
+  GotoIf(Word32Equal(handler_kind, LOAD_KIND(kProxyGetTrap)), &proxy_get_trap);
+
   Branch(Word32Equal(handler_kind, LOAD_KIND(kModuleExport)), &module_export,
          &interceptor);
 
@@ -803,6 +806,50 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
     }
   }
 
+  BIND(&proxy_get_trap);
+  {
+    Comment("proxy_get_trap");
+    // This handler is only ever installed when the proxy is the lookup start
+    // object, so the feedback map check has already matched its map. The
+    // name is guaranteed to be unique because keyed accesses only reach this
+    // handler through the megamorphic stub cache.
+    CSA_DCHECK(this, IsName(CAST(p->name())));
+    TNode<JSProxy> proxy = CAST(p->lookup_start_object());
+    TNode<Object> proxy_handler =
+        LoadObjectField(proxy, JSProxy::kHandlerOffset);
+    CSA_DCHECK(this, TaggedIsNotSmi(proxy_handler));
+    // The map check against the cached handler map guarantees that the "get"
+    // trap is still stored at the cached field location. It also misses for
+    // revoked proxies, whose handler is null.
+    TNode<MaybeObject> maybe_handler_map =
+        LoadHandlerDataField(CAST(handler), 1);
+    TNode<HeapObject> handler_map =
+        GetHeapObjectAssumeWeak(maybe_handler_map, miss);
+    GotoIfNot(TaggedEqual(LoadMap(CAST(proxy_handler)), handler_map), miss);
+    TNode<JSObject> trap_holder = CAST(proxy_handler);
+
+    // Only the trap's location is cached, so reload its current value. It
+    // may have been overwritten with a non-callable value, in which case the
+    // generic path reports the proper error.
+    TNode<IntPtrT> index =
+        Signed(DecodeWordFromWord32<LoadHandler::FieldIndexBits>(handler_word));
+    TNode<IntPtrT> offset = IntPtrMul(index, IntPtrConstant(kTaggedSize));
+    TNode<BoolT> is_inobject =
+        IsSetWord32<LoadHandler::IsInobjectBits>(handler_word);
+    TNode<HeapObject> property_storage = Select<HeapObject>(
+        is_inobject, [&]() -> TNode<HeapObject> { return trap_holder; },
+        [&]() -> TNode<HeapObject> {
+          return LoadFastProperties(trap_holder, true);
+        });
+    TNode<Object> trap = LoadObjectField(property_storage, offset);
+    GotoIf(TaggedIsSmi(trap), miss);
+    GotoIfNot(IsCallable(CAST(trap)), miss);
+
+    exit_point->ReturnCallBuiltin(Builtin::kProxyGetPropertyWithTrap,
+                                  p->context(), trap, proxy, p->name(),
+                                  p->receiver());
+  }
+
   BIND(&global);
   {
     CSA_DCHECK(this, IsPropertyCell(CAST(holder)));
@@ -907,11 +954,18 @@ void AccessorAssembler::HandleLoadICSmiHandlerHasNamedCase(
 
   BIND(&return_lookup);
   {
-    CSA_DCHECK(this,
-               Word32Or(Word32Equal(handler_kind, LOAD_KIND(kInterceptor)),
-                        Word32Or(Word32Equal(handler_kind, LOAD_KIND(kProxy)),
-                                 Word32Equal(handler_kind,
-                                             LOAD_KIND(kModuleExport)))));
+    CSA_DCHECK(
+        this,
+        Word32Or(
+            Word32Equal(handler_kind, LOAD_KIND(kInterceptor)),
+            Word32Or(Word32Equal(handler_kind, LOAD_KIND(kProxy)),
+                     Word32Or(Word32Equal(handler_kind,
+                                          LOAD_KIND(kProxyGetTrap)),
+                              Word32Equal(handler_kind,
+                                          LOAD_KIND(kModuleExport))))));
+    // Note: kProxyGetTrap caches the location of the proxy's "get" trap,
+    // which is of no use for a "has" access; fall back to the generic
+    // HasProperty builtin.
     exit_point->ReturnCallBuiltin(Builtin::kHasProperty, p->context(),
                                   p->receiver(), p->name());
   }
@@ -2855,7 +2909,8 @@ void AccessorAssembler::GenericPropertyLoad(
 
 enum AccessorAssembler::StubCacheTable : int {
   kPrimary = static_cast<int>(StubCache::kPrimary),
-  kSecondary = static_cast<int>(StubCache::kSecondary)
+  kSecondary = static_cast<int>(StubCache::kSecondary),
+  kTertiary = static_cast<int>(StubCache::kTertiary)
 };
 
 TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
@@ -2901,6 +2956,21 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   return Signed(result);
 }
 
+TNode<IntPtrT> AccessorAssembler::StubCacheTertiaryOffset(TNode<Name> name,
+                                                          TNode<Map> map) {
+  // See v8::internal::StubCache::TertiaryOffset().
+  TNode<Int32T> name32 = TruncateIntPtrToInt32(BitcastTaggedToWord(name));
+  TNode<Int32T> map32 = TruncateIntPtrToInt32(BitcastTaggedToWord(map));
+  TNode<Word32T> hash_a = Word32Xor(map32, Word32Shr(name32, 2));
+  TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kTertiaryTableBits);
+  TNode<Word32T> hash = Int32Add(hash_a, hash_b);
+  int32_t mask = (StubCache::kTertiaryTableSize - 1)
+                 << StubCache::kCacheIndexShift;
+  TNode<UintPtrT> result =
+      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  return Signed(result);
+}
+
 void AccessorAssembler::TryProbeStubCacheTable(
     StubCache* stub_cache, StubCacheTable table_id, TNode<IntPtrT> entry_offset,
     TNode<Object> name, TNode<Map> map, Label* if_handler,
@@ -2943,7 +3013,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
                                           TNode<Name> name, Label* if_handler,
                                           TVariable<MaybeObject>* var_handler,
                                           Label* if_miss) {
-  Label try_secondary(this), miss(this);
+  Label try_secondary(this), try_tertiary(this), miss(this);
 
   Counters* counters = isolate()->counters();
   IncrementCounter(counters->megamorphic_stub_cache_probes(), 1);
@@ -2961,6 +3031,17 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
     TNode<IntPtrT> secondary_offset =
         StubCacheSecondaryOffset(name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
+                           lookup_start_object_map, if_handler, var_handler,
+                           &try_tertiary);
+  }
+
+  BIND(&try_tertiary);
+  {
+    // Probe the tertiary table, which holds entries evicted from the
+    // secondary one.
+    TNode<IntPtrT> tertiary_offset =
+        StubCacheTertiaryOffset(name, lookup_start_object_map);
+    TryProbeStubCacheTable(stub_cache, kTertiary, tertiary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
   }
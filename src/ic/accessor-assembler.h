@@ -102,6 +102,10 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                                                     TNode<Map> map) {
     return StubCacheSecondaryOffset(name, map);
   }
+  TNode<IntPtrT> StubCacheTertiaryOffsetForTesting(TNode<Name> name,
+                                                   TNode<Map> map) {
+    return StubCacheTertiaryOffset(name, map);
+  }
 
   struct LoadICParameters {
     LoadICParameters(
@@ -573,6 +577,7 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
 
   TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
   TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCacheTertiaryOffset(TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
                               TNode<IntPtrT> entry_offset, TNode<Object> name,
@@ -7,6 +7,8 @@
 #include "src/codegen/code-factory.h"
 #include "src/ic/handler-configuration-inl.h"
 #include "src/objects/data-handler-inl.h"
+#include "src/objects/js-objects-inl.h"
+#include "src/objects/js-proxy-inl.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/transitions.h"
 
@@ -167,6 +169,50 @@ Handle<Object> LoadHandler::LoadFullChain(Isolate* isolate,
   return handler;
 }
 
+// static
+MaybeObjectHandle LoadHandler::LoadProxyGetTrap(Isolate* isolate,
+                                                Handle<JSProxy> proxy) {
+  Tagged<Object> maybe_handler = proxy->handler();
+  if (!IsJSObject(maybe_handler)) return MaybeObjectHandle();
+  Tagged<JSObject> trap_holder = JSObject::cast(maybe_handler);
+  Tagged<Map> map = trap_holder->map();
+  // Require the trap to be a fast own data property of the handler object, so
+  // that a map check at dispatch time pins down where it is stored. The trap
+  // itself is reloaded on every access, so no assumptions about its value are
+  // baked into the handler.
+  if (map->is_dictionary_map() || map->is_access_check_needed() ||
+      map->has_named_interceptor() || map->is_deprecated()) {
+    return MaybeObjectHandle();
+  }
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate);
+  InternalIndex entry =
+      descriptors->Search(ReadOnlyRoots(isolate).get_string(), map);
+  if (entry.is_not_found()) return MaybeObjectHandle();
+  PropertyDetails details = descriptors->GetDetails(entry);
+  if (details.kind() != PropertyKind::kData ||
+      details.location() != PropertyLocation::kField ||
+      details.representation().IsDouble()) {
+    return MaybeObjectHandle();
+  }
+  FieldIndex field_index = FieldIndex::ForDetails(map, details);
+  // A trap that is currently missing or not callable is handled by the
+  // generic path; the IC would miss on every access anyway.
+  Tagged<Object> trap = trap_holder->RawFastPropertyAt(field_index);
+  if (!IsCallable(trap)) return MaybeObjectHandle();
+
+  int config = KindBits::encode(Kind::kProxyGetTrap) |
+               IsInobjectBits::encode(field_index.is_inobject()) |
+               FieldIndexBits::encode(field_index.index());
+  Handle<Map> trap_holder_map(map, isolate);
+  Handle<LoadHandler> handler = isolate->factory()->NewLoadHandler(1);
+  handler->set_smi_handler(Smi::FromInt(config));
+  // Correctness does not depend on any prototype chain, so no validity cell
+  // is needed.
+  handler->set_validity_cell(Smi::FromInt(Map::kPrototypeChainValid));
+  handler->set_data1(HeapObjectReference::Weak(*trap_holder_map));
+  return MaybeObjectHandle(handler);
+}
+
 // static
 KeyedAccessLoadMode LoadHandler::GetKeyedAccessLoadMode(MaybeObject handler) {
   DisallowGarbageCollection no_gc;
@@ -436,6 +482,12 @@ void PrintSmiLoadHandler(int raw_handler, std::ostream& os) {
       os << "kModuleExport, exports index = "
          << LoadHandler::ExportsIndexBits::decode(raw_handler);
       break;
+    case LoadHandler::Kind::kProxyGetTrap:
+      os << "kProxyGetTrap, is in object = "
+         << LoadHandler::IsInobjectBits::decode(raw_handler)
+         << ", field index = "
+         << LoadHandler::FieldIndexBits::decode(raw_handler);
+      break;
     default:
       os << "<invalid value " << static_cast<int>(kind) << ">";
       break;
@@ -63,7 +63,8 @@ class LoadHandler final : public DataHandler {
     kSlow,
     kProxy,
     kNonExistent,
-    kModuleExport
+    kModuleExport,
+    kProxyGetTrap
   };
   using KindBits = base::BitField<Kind, 0, 4>;
 
@@ -90,7 +91,9 @@ class LoadHandler final : public DataHandler {
   static_assert(DescriptorBits::kLastUsedBit < kSmiValueSize);
 
   //
-  // Encoding when KindBits contains kField.
+  // Encoding when KindBits contains kField or kProxyGetTrap. For the latter
+  // the field index describes where the "get" trap is stored on the proxy's
+  // handler object.
   //
   using IsWasmStructBits = LookupOnLookupStartObjectBits::Next<bool, 1>;
 
@@ -176,6 +179,13 @@ class LoadHandler final : public DataHandler {
   // Creates a Smi-handler for calling a getter on a proxy.
   static inline Handle<Smi> LoadProxy(Isolate* isolate);
 
+  // Creates a data handler that caches where the "get" trap is stored on the
+  // proxy's handler object, so that the trap can be loaded and called directly
+  // without a property lookup. Returns an empty handle when the trap is not
+  // a fast own data property of the handler object.
+  static MaybeObjectHandle LoadProxyGetTrap(Isolate* isolate,
+                                            Handle<JSProxy> proxy);
+
   // Creates a Smi-handler for loading a native data property from fast object.
   static inline Handle<Smi> LoadNativeDataProperty(Isolate* isolate,
                                                    int descriptor);
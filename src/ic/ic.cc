@@ -628,6 +628,32 @@ bool IC::UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name) {
   return true;
 }
 
+bool IC::ShouldExtendPolymorphicFeedback(
+    Handle<Map> new_map, const std::vector<MapAndHandler>& maps_and_handlers) {
+  if (v8_flags.max_extended_polymorphic_map_count <=
+      v8_flags.max_valid_polymorphic_map_count) {
+    return false;
+  }
+  // Keyed accesses compute element handler sets whose size is bounded by the
+  // base limit elsewhere; only named accesses are allowed to grow.
+  if (is_keyed()) return false;
+  // Only extend hot sites: a cold site gains little from the longer probe
+  // loop and would merely delay the transition to MEGAMORPHIC.
+  if (nexus()->vector()->invocation_count() <
+      v8_flags.extended_polymorphism_invocation_threshold) {
+    return false;
+  }
+  // Require a stable map set. Unstable maps are likely still in flux, so new
+  // shapes keep arriving and the stub cache handles that case better.
+  if (!new_map->is_stable()) return false;
+  for (const MapAndHandler& map_and_handler : maps_and_handlers) {
+    Handle<Map> existing_map = map_and_handler.first;
+    if (existing_map->is_deprecated()) continue;
+    if (!existing_map->is_stable()) return false;
+  }
+  return true;
+}
+
 bool IC::UpdatePolymorphicIC(Handle<Name> name,
                              const MaybeObjectHandle& handler) {
   DCHECK(IsHandler(*handler));
@@ -684,7 +710,12 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= v8_flags.max_valid_polymorphic_map_count) {
+  int max_valid_map_count = v8_flags.max_valid_polymorphic_map_count;
+  if (number_of_valid_maps >= max_valid_map_count &&
+      ShouldExtendPolymorphicFeedback(map, maps_and_handlers)) {
+    max_valid_map_count = v8_flags.max_extended_polymorphic_map_count;
+  }
+  if (number_of_valid_maps >= max_valid_map_count) {
     return false;
   }
   if (deprecated_maps >= v8_flags.max_valid_polymorphic_map_count) {
@@ -1132,7 +1163,37 @@ MaybeObjectHandle LoadIC::ComputeHandler(LookupIterator* lookup) {
         return MaybeObjectHandle(LoadHandler::LoadSlow(isolate()));
       }
       Handle<Smi> smi_handler = LoadHandler::LoadProxy(isolate());
-      if (holder_is_lookup_start_object) return MaybeObjectHandle(smi_handler);
+      if (holder_is_lookup_start_object) {
+        // When the "get" trap is a fast own data property of the handler
+        // object, cache its location so the dispatcher can call it directly
+        // instead of looking it up on every access. Has ICs need the "has"
+        // trap and keep using the generic path. All proxies share a map, so
+        // if a specialized handler already missed at this site (e.g. because
+        // it sees proxies whose handler objects have different shapes),
+        // degrade to the generic proxy handler instead of thrashing.
+        if (IsLoadIC()) {
+          bool specialized_handler_missed = false;
+          MaybeObjectHandle previous =
+              nexus()->FindHandlerForMap(lookup_start_object_map());
+          if (!previous.is_null() && IsLoadHandler(*previous.object())) {
+            Tagged<Object> previous_smi_handler =
+                LoadHandler::cast(*previous.object())->smi_handler();
+            specialized_handler_missed =
+                IsSmi(previous_smi_handler) &&
+                LoadHandler::GetHandlerKind(Smi::cast(previous_smi_handler)) ==
+                    LoadHandler::Kind::kProxyGetTrap;
+          }
+          if (!specialized_handler_missed) {
+            MaybeObjectHandle trap_handler = LoadHandler::LoadProxyGetTrap(
+                isolate(), lookup->GetHolder<JSProxy>());
+            if (!trap_handler.is_null()) {
+              TRACE_HANDLER_STATS(isolate(), LoadIC_LoadProxyGetTrapDH);
+              return trap_handler;
+            }
+          }
+        }
+        return MaybeObjectHandle(smi_handler);
+      }
 
       Handle<JSProxy> holder_proxy = lookup->GetHolder<JSProxy>();
       return MaybeObjectHandle(LoadHandler::LoadFromPrototype(
@@ -104,6 +104,8 @@ class IC {
   void UpdateMonomorphicIC(const MaybeObjectHandle& handler, Handle<Name> name);
   bool UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name);
   bool UpdatePolymorphicIC(Handle<Name> name, const MaybeObjectHandle& handler);
+  bool ShouldExtendPolymorphicFeedback(
+      Handle<Map> new_map, const std::vector<MapAndHandler>& maps_and_handlers);
   void UpdateMegamorphicCache(Handle<Map> map, Handle<Name> name,
                               const MaybeObjectHandle& handler);
 
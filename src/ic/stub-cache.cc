@@ -23,6 +23,7 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
 void StubCache::Initialize() {
   DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
   DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(kTertiaryTableSize));
   Clear();
 }
 
@@ -55,6 +56,19 @@ int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
   return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
 }
 
+// Hash algorithm for the tertiary table.  This algorithm is replicated in
+// assembler. Xoring the map with a shifted copy of the name keeps this hash
+// sufficiently different from both the primary and the secondary one, so an
+// entry colliding in those tables is unlikely to collide here as well.
+// Returns an index into the table that is scaled by 1 << kCacheIndexShift.
+int StubCache::TertiaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
+  uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
+  uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
+  uint32_t key = map_low32bits ^ (name_low32bits >> 2);
+  key = key + (key >> kTertiaryTableBits);
+  return key & ((kTertiaryTableSize - 1) << kCacheIndexShift);
+}
+
 int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
   return PrimaryOffset(name, map);
 }
@@ -63,6 +77,10 @@ int StubCache::SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
   return SecondaryOffset(name, map);
 }
 
+int StubCache::TertiaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
+  return TertiaryOffset(name, map);
+}
+
 #ifdef DEBUG
 namespace {
 
@@ -89,16 +107,28 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map, MaybeObject handler) {
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
-  // secondary cache before overwriting it.
-  if (old_handler != MaybeObject::FromObject(
-                         isolate()->builtins()->code(Builtin::kIllegal)) &&
-      !primary->map.IsSmi()) {
+  // secondary cache before overwriting it. A useful secondary entry that
+  // would be displaced is in turn retired to the tertiary cache.
+  MaybeObject empty_handler =
+      MaybeObject::FromObject(isolate()->builtins()->code(Builtin::kIllegal));
+  if (old_handler != empty_handler && !primary->map.IsSmi()) {
     Tagged<Map> old_map =
         Map::cast(StrongTaggedValue::ToObject(isolate(), primary->map));
     Tagged<Name> old_name =
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
     int secondary_offset = SecondaryOffset(old_name, old_map);
     Entry* secondary = entry(secondary_, secondary_offset);
+    MaybeObject secondary_handler(
+        TaggedValue::ToMaybeObject(isolate(), secondary->value));
+    if (secondary_handler != empty_handler && !secondary->map.IsSmi()) {
+      Tagged<Map> displaced_map =
+          Map::cast(StrongTaggedValue::ToObject(isolate(), secondary->map));
+      Tagged<Name> displaced_name =
+          Name::cast(StrongTaggedValue::ToObject(isolate(), secondary->key));
+      int tertiary_offset = TertiaryOffset(displaced_name, displaced_map);
+      Entry* tertiary = entry(tertiary_, tertiary_offset);
+      *tertiary = *secondary;
+    }
     *secondary = *primary;
   }
 
@@ -121,6 +151,11 @@ MaybeObject StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
+  int tertiary_offset = TertiaryOffset(name, map);
+  Entry* tertiary = entry(tertiary_, tertiary_offset);
+  if (tertiary->key == name && tertiary->map == map) {
+    return TaggedValue::ToMaybeObject(isolate(), tertiary->value);
+  }
   return MaybeObject();
 }
 
@@ -138,6 +173,11 @@ void StubCache::Clear() {
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
   }
+  for (int k = 0; k < kTertiaryTableSize; k++) {
+    tertiary_[k].key = StrongTaggedValue(empty_string);
+    tertiary_[k].map = StrongTaggedValue(Smi::zero());
+    tertiary_[k].value = TaggedValue(empty);
+  }
 }
 
 }  // namespace internal
@@ -49,7 +49,7 @@ class V8_EXPORT_PRIVATE StubCache {
   // Clear the lookup table (@ mark compact collection).
   void Clear();
 
-  enum Table { kPrimary, kSecondary };
+  enum Table { kPrimary, kSecondary, kTertiary };
 
   SCTableReference key_reference(StubCache::Table table) {
     return SCTableReference(
@@ -72,6 +72,8 @@ class V8_EXPORT_PRIVATE StubCache {
         return StubCache::primary_;
       case StubCache::kSecondary:
         return StubCache::secondary_;
+      case StubCache::kTertiary:
+        return StubCache::tertiary_;
     }
     UNREACHABLE();
   }
@@ -89,9 +91,15 @@ class V8_EXPORT_PRIVATE StubCache {
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The tertiary table is a larger victim cache for entries evicted from the
+  // secondary table, for workloads whose working set of (map, name) pairs
+  // exceeds the primary and secondary capacity.
+  static const int kTertiaryTableBits = 13;
+  static const int kTertiaryTableSize = (1 << kTertiaryTableBits);
 
   static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
   static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  static int TertiaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
@@ -99,12 +107,13 @@ class V8_EXPORT_PRIVATE StubCache {
   StubCache& operator=(const StubCache&) = delete;
 
  private:
-  // The stub cache has a primary and secondary level.  The two levels have
-  // different hashing algorithms in order to avoid simultaneous collisions
-  // in both caches.  Unlike a probing strategy (quadratic or otherwise) the
-  // update strategy on updates is fairly clear and simple:  Any existing entry
-  // in the primary cache is moved to the secondary cache, and secondary cache
-  // entries are overwritten.
+  // The stub cache has a primary, secondary and tertiary level.  The levels
+  // have different hashing algorithms in order to avoid simultaneous
+  // collisions in all caches.  Unlike a probing strategy (quadratic or
+  // otherwise) the update strategy on updates is fairly clear and simple:
+  // Any existing entry in the primary cache is moved to the secondary cache,
+  // any displaced secondary entry is moved to the tertiary cache, and
+  // tertiary cache entries are overwritten.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
@@ -116,6 +125,11 @@ class V8_EXPORT_PRIVATE StubCache {
   // is scaled by 1 << kCacheIndexShift.
   static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
 
+  // Hash algorithm for the tertiary table.  This algorithm is replicated in
+  // assembler for every architecture.  Returns an index into the table that
+  // is scaled by 1 << kCacheIndexShift.
+  static int TertiaryOffset(Tagged<Name> name, Tagged<Map> map);
+
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
   // ends in Name::HashBits::kShift 0s.  Then we multiply it so it is a multiple
@@ -133,6 +147,7 @@ class V8_EXPORT_PRIVATE StubCache {
  private:
   Entry primary_[kPrimaryTableSize];
   Entry secondary_[kSecondaryTableSize];
+  Entry tertiary_[kTertiaryTableSize];
   Isolate* isolate_;
 
   friend class Isolate;
@@ -68,6 +68,7 @@
 #include "src/codegen/script-details.h"
 #include "src/objects/js-raw-json.h"
 #include "src/objects/js-shared-array.h"
+#include "src/objects/js-shared-map.h"
 #include "src/objects/js-struct.h"
 #include "src/objects/js-temporal-objects-inl.h"
 #include "src/objects/js-weak-refs.h"
@@ -3584,6 +3585,10 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
     SimpleInstallFunction(isolate_, math, "pow", Builtin::kMathPow, 2, true);
     SimpleInstallFunction(isolate_, math, "random", Builtin::kMathRandom, 0,
                           true);
+    if (v8_flags.expose_math_random_fill) {
+      SimpleInstallFunction(isolate_, math, "randomFill",
+                            Builtin::kMathRandomFill, 1, true);
+    }
     SimpleInstallFunction(isolate_, math, "round", Builtin::kMathRound, 1,
                           true);
     SimpleInstallFunction(isolate_, math, "sign", Builtin::kMathSign, 1, true);
@@ -4695,6 +4700,13 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
         isolate_, factory->InternalizeUtf8String("cleanupSome"),
         Builtin::kFinalizationRegistryPrototypeCleanupSome, 0, false);
     native_context()->set_finalization_registry_cleanup_some(*cleanup_some_fun);
+
+    // The bounded variant used by the cleanup task; never exposed to JS.
+    Handle<JSFunction> cleanup_from_task_fun = SimpleCreateFunction(
+        isolate_, factory->InternalizeUtf8String("cleanupFromTask"),
+        Builtin::kFinalizationRegistryCleanupFromTask, 0, false);
+    native_context()->set_finalization_registry_cleanup_from_task(
+        *cleanup_from_task_fun);
   }
 
   {  // -- W e a k R e f
@@ -5623,6 +5635,36 @@ void Genesis::InitializeGlobal_harmony_struct() {
                           Builtin::kSharedArrayIsSharedArray, 1, true);
   }
 
+  {  // SharedMap
+    Handle<String> shared_map_str =
+        isolate()->factory()->InternalizeUtf8String("SharedMap");
+    Handle<Map> shared_map_instance_map =
+        JSSharedMap::CreateInstanceMap(isolate());
+    Handle<JSFunction> shared_map_fun = CreateSharedObjectConstructor(
+        isolate(), shared_map_str, shared_map_instance_map,
+        Builtin::kSharedMapConstructor);
+    shared_map_fun->shared()->set_internal_formal_parameter_count(
+        JSParameterCount(0));
+    shared_map_fun->shared()->set_length(0);
+
+    // Install SharedMap constructor.
+    JSObject::AddProperty(isolate(), global, "SharedMap", shared_map_fun,
+                          DONT_ENUM);
+
+    // Like the Atomics.Mutex methods, the accessors are static functions on
+    // the constructor because shared objects have no prototype.
+    SimpleInstallFunction(isolate(), shared_map_fun, "get",
+                          Builtin::kSharedMapGet, 2, true);
+    SimpleInstallFunction(isolate(), shared_map_fun, "set",
+                          Builtin::kSharedMapSet, 3, true);
+    SimpleInstallFunction(isolate(), shared_map_fun, "has",
+                          Builtin::kSharedMapHas, 2, true);
+    SimpleInstallFunction(isolate(), shared_map_fun, "delete",
+                          Builtin::kSharedMapDelete, 2, true);
+    SimpleInstallFunction(isolate(), shared_map_fun, "isSharedMap",
+                          Builtin::kSharedMapIsSharedMap, 1, true);
+  }
+
   {  // Atomics.Mutex
     Handle<String> mutex_str =
         isolate()->factory()->InternalizeUtf8String("Mutex");
@@ -6224,7 +6266,17 @@ bool Genesis::InstallABunchOfRandomThings() {
     }
 
     // groups descriptor.
-    {
+    if (v8_flags.lazy_regexp_result_groups) {
+      // With lazily materialized groups objects, "groups" becomes an accessor
+      // property (appended below, after the internal fields) and the in-object
+      // slot caches the capture name map resp. the materialized groups object
+      // under a private name (see Accessors::RegExpResultGroupsGetter).
+      Handle<Symbol> cached_groups_symbol = factory()->NewPrivateSymbol();
+      Descriptor d = Descriptor::DataField(isolate(), cached_groups_symbol,
+                                           JSRegExpResult::kGroupsIndex,
+                                           DONT_ENUM, Representation::Tagged());
+      initial_map->AppendDescriptor(isolate(), &d);
+    } else {
       Descriptor d = Descriptor::DataField(
           isolate(), factory()->groups_string(), JSRegExpResult::kGroupsIndex,
           NONE, Representation::Tagged());
@@ -6263,6 +6315,17 @@ bool Genesis::InstallABunchOfRandomThings() {
       }
     }
 
+    // Lazily materialized groups accessor, replacing the "groups" data
+    // property above.
+    if (v8_flags.lazy_regexp_result_groups) {
+      Handle<AccessorInfo> groups_info =
+          Accessors::MakeRegExpResultGroupsInfo(isolate());
+      Descriptor d = Descriptor::AccessorConstant(factory()->groups_string(),
+                                                  groups_info, NONE);
+      Map::EnsureDescriptorSlack(isolate(), initial_map, 1);
+      initial_map->AppendDescriptor(isolate(), &d);
+    }
+
     // Set up the map for RegExp results objects for regexps with the /d flag.
     Handle<Map> initial_with_indices_map =
         Map::Copy(isolate(), initial_map, "JSRegExpResult with indices");
@@ -665,6 +665,7 @@
   F(MC_EVACUATE_CLEAN_UP)                       \
   F(MC_EVACUATE_COPY)                           \
   F(MC_EVACUATE_COPY_PARALLEL)                  \
+  F(MC_EVACUATE_DEDUPLICATE_HEAP_NUMBERS)       \
   F(MC_EVACUATE_EPILOGUE)                       \
   F(MC_EVACUATE_PROLOGUE)                       \
   F(MC_EVACUATE_REBALANCE)                      \
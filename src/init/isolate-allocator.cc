@@ -6,8 +6,10 @@
 
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/platform/memory.h"
+#include "src/base/platform/platform.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/heap/code-range.h"
 #include "src/heap/trusted-range.h"
 #include "src/sandbox/sandbox.h"
@@ -83,6 +85,15 @@ void IsolateAllocator::InitializeOncePerProcess() {
         "Failed to reserve virtual memory for process-wide V8 "
         "pointer compression cage");
   }
+  if (v8_flags.huge_pages_for_heap) {
+    // The advice is tracked per VMA and survives the permission changes that
+    // commit individual memory chunks, so advising the whole cage upfront
+    // gives committed heap pages huge page backing. Advisory, Linux-only and
+    // best effort.
+    base::OS::AdviseHugePages(
+        reinterpret_cast<void*>(GetProcessWidePtrComprCage()->base()),
+        GetProcessWidePtrComprCage()->size());
+  }
   V8HeapCompressionScheme::InitBase(GetProcessWidePtrComprCage()->base());
 #ifdef V8_EXTERNAL_CODE_SPACE
   // Speculatively set the code cage base to the same value in case jitless
@@ -105,6 +116,12 @@ IsolateAllocator::IsolateAllocator() {
         nullptr,
         "Failed to reserve memory for Isolate V8 pointer compression cage");
   }
+  if (v8_flags.huge_pages_for_heap) {
+    // See InitializeOncePerProcess for the shared cage equivalent.
+    base::OS::AdviseHugePages(
+        reinterpret_cast<void*>(isolate_ptr_compr_cage_.base()),
+        isolate_ptr_compr_cage_.size());
+  }
   page_allocator_ = isolate_ptr_compr_cage_.page_allocator();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
   CHECK(GetProcessWidePtrComprCage()->IsReserved());
@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/init/isolate-pool.h"
+
+#include <algorithm>
+
+#include "src/execution/isolate.h"
+
+namespace v8 {
+namespace internal {
+
+IsolatePool::IsolatePool(const v8::Isolate::CreateParams& params,
+                         size_t capacity)
+    : params_(params), capacity_(capacity) {}
+
+IsolatePool::~IsolatePool() {
+  for (v8::Isolate* isolate : spares_) {
+    isolate->Dispose();
+  }
+}
+
+void IsolatePool::Prewarm(size_t count) {
+  count = std::min(count, capacity_);
+  while (true) {
+    {
+      base::MutexGuard guard(&mutex_);
+      if (spares_.size() >= count) return;
+    }
+    // Isolate creation deserializes the snapshot and is the expensive part;
+    // keep it outside the lock so concurrent Acquire() calls don't stall.
+    v8::Isolate* isolate = v8::Isolate::New(params_);
+    base::MutexGuard guard(&mutex_);
+    spares_.push_back(isolate);
+  }
+}
+
+v8::Isolate* IsolatePool::Acquire() {
+  {
+    base::MutexGuard guard(&mutex_);
+    if (!spares_.empty()) {
+      v8::Isolate* isolate = spares_.back();
+      spares_.pop_back();
+      return isolate;
+    }
+  }
+  return v8::Isolate::New(params_);
+}
+
+bool IsolatePool::Release(v8::Isolate* isolate) {
+  DCHECK_NOT_NULL(isolate);
+  bool reusable;
+  {
+    v8::Isolate::Scope scope(isolate);
+    reusable = reinterpret_cast<Isolate*>(isolate)->ResetForReuse();
+  }
+  if (reusable) {
+    base::MutexGuard guard(&mutex_);
+    if (spares_.size() < capacity_) {
+      spares_.push_back(isolate);
+      return true;
+    }
+  }
+  isolate->Dispose();
+  return false;
+}
+
+}  // namespace internal
+}  // namespace v8
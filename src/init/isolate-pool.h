@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INIT_ISOLATE_POOL_H_
+#define V8_INIT_ISOLATE_POOL_H_
+
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// Backing implementation of v8::IsolatePool: keeps up to |capacity| spare
+// isolates whose snapshot deserialization already happened, so acquiring an
+// isolate on the critical path is a mutex-protected pop. Returned isolates
+// are only pooled again if Isolate::ResetForReuse() verified that no user
+// state survived.
+class V8_EXPORT_PRIVATE IsolatePool final {
+ public:
+  IsolatePool(const v8::Isolate::CreateParams& params, size_t capacity);
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  void Prewarm(size_t count);
+  v8::Isolate* Acquire();
+  bool Release(v8::Isolate* isolate);
+
+ private:
+  const v8::Isolate::CreateParams params_;
+  const size_t capacity_;
+  base::Mutex mutex_;
+  std::vector<v8::Isolate*> spares_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INIT_ISOLATE_POOL_H_
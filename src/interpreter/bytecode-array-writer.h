@@ -103,6 +103,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
+  // Tries to replace the last bytecode and |node| with a single fused
+  // superinstruction. Returns true if the superinstruction was emitted.
+  bool TryFuseLastBytecode(BytecodeNode* node);
   void InvalidateLastBytecode();
 
   void StartBasicBlock();
@@ -122,8 +125,10 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
 
   Bytecode last_bytecode_;
   size_t last_bytecode_offset_;
+  uint32_t last_bytecode_operand0_;
   bool last_bytecode_had_source_info_;
   bool elide_noneffectful_bytecodes_;
+  bool fuse_superinstructions_;
 
   bool exit_seen_in_block_;
 
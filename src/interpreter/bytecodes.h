@@ -185,6 +185,12 @@ namespace interpreter {
   V(ShiftRightLogical, ImplicitRegisterUse::kReadWriteAccumulator,             \
     OperandType::kReg, OperandType::kIdx)                                      \
                                                                                \
+  /* Fused binary operators (superinstructions). The operand layout matches  */\
+  /* the unfused bytecode, with the register read by the fused Ldar          */\
+  /* appended, so that the compilers can share the unfused lowering.         */\
+  V(LdarAdd, ImplicitRegisterUse::kWriteAccumulator, OperandType::kReg,        \
+    OperandType::kIdx, OperandType::kReg)                                      \
+                                                                               \
   /* Binary operators with immediate operands */                               \
   V(AddSmi, ImplicitRegisterUse::kReadWriteAccumulator, OperandType::kImm,     \
     OperandType::kIdx)                                                         \
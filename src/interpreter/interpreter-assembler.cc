@@ -1634,7 +1634,11 @@ TNode<FixedArray> InterpreterAssembler::ImportRegisterFile(
         IntPtrSub(IntPtrConstant(Register(0).ToOperand()), index);
     StoreRegister(value, reg_index);
 
-    StoreFixedArrayElement(array, array_index, StaleRegisterConstant());
+    // The stale register sentinel lives in the read-only heap, so clearing
+    // the slot never needs a write barrier (Maglev's GeneratorRestoreRegister
+    // already relies on the same fact).
+    StoreFixedArrayElement(array, array_index, StaleRegisterConstant(),
+                           SKIP_WRITE_BARRIER);
 
     var_index = IntPtrAdd(index, IntPtrConstant(1));
     Goto(&loop);
@@ -878,6 +878,23 @@ class InterpreterBinaryOpAssembler : public InterpreterAssembler {
     Dispatch();
   }
 
+  void BinaryOpBothRegistersWithFeedback(BinaryOpGenerator generator) {
+    TNode<Object> lhs = LoadRegisterAtOperandIndex(0);
+    TNode<Object> rhs = LoadRegisterAtOperandIndex(2);
+    TNode<Context> context = GetContext();
+    TNode<UintPtrT> slot_index = BytecodeOperandIdx(1);
+    TNode<HeapObject> maybe_feedback_vector =
+        LoadFeedbackVectorOrUndefinedIfJitless();
+    static constexpr UpdateFeedbackMode mode = DefaultUpdateFeedbackMode();
+
+    BinaryOpAssembler binop_asm(state());
+    TNode<Object> result = (binop_asm.*generator)(
+        [=] { return context; }, lhs, rhs, slot_index,
+        [=] { return maybe_feedback_vector; }, mode, false);
+    SetAccumulator(result);
+    Dispatch();
+  }
+
   void BinaryOpSmiWithFeedback(BinaryOpGenerator generator) {
     TNode<Object> lhs = GetAccumulator();
     TNode<Smi> rhs = BytecodeOperandImmSmi(0);
@@ -903,6 +920,16 @@ IGNITION_HANDLER(Add, InterpreterBinaryOpAssembler) {
   BinaryOpWithFeedback(&BinaryOpAssembler::Generate_AddWithFeedback);
 }
 
+// LdarAdd <lhs> <slot> <rhs>
+//
+// Fused Ldar+Add superinstruction: adds register <lhs> to register <rhs> and
+// leaves the result in the accumulator, equivalent to "Ldar <rhs>; Add <lhs>,
+// <slot>" in a single dispatch.
+IGNITION_HANDLER(LdarAdd, InterpreterBinaryOpAssembler) {
+  BinaryOpBothRegistersWithFeedback(
+      &BinaryOpAssembler::Generate_AddWithFeedback);
+}
+
 // Sub <src>
 //
 // Subtract register <src> from accumulator.
@@ -4,6 +4,8 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/common/assert-scope.h"
@@ -17,6 +19,7 @@
 #include "src/objects/elements-kind.h"
 #include "src/objects/field-type.h"
 #include "src/objects/hash-table-inl.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/property-descriptor.h"
@@ -26,6 +29,23 @@
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -574,12 +594,126 @@ JsonToken GetTokenForCharacter(Char c) {
   return V8_LIKELY(c <= unibrow::Latin1::kMaxChar) ? one_char_json_tokens[c]
                                                    : JsonToken::ILLEGAL;
 }
+
+// Vectorized scanning fast paths for one-byte input. On multi-megabyte
+// payloads almost all parse time is spent skipping whitespace and scanning
+// plain string spans, so we classify 16 bytes per step with SSE/Neon and
+// leave the tail (and exact classification of the byte we stop on) to the
+// existing scalar loops. Both helpers return a cursor with the invariant
+// that every byte before it is uninteresting to the caller.
+
+#ifdef __SSE3__
+inline const uint8_t* SkipWhitespaceVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+  while (end - cursor >= 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i ws = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, cr), _mm_cmpeq_epi8(chunk, lf)));
+    uint32_t mask = _mm_movemask_epi8(ws);
+    if (mask != 0xFFFF) {
+      return cursor + base::bits::CountTrailingZeros32(~mask);
+    }
+    cursor += 16;
+  }
+  return cursor;
+}
+
+inline const uint8_t* ScanJsonStringVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i ctrl_limit = _mm_set1_epi8(0x1F);
+  while (end - cursor >= 16) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    // A byte may terminate the string span if it is '"', '\\' or an
+    // (unescaped) control character below 0x20. The unsigned min trick
+    // avoids the signedness problem of _mm_cmplt_epi8 for bytes >= 0x80.
+    __m128i terminator = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                     _mm_cmpeq_epi8(chunk, backslash)),
+        _mm_cmpeq_epi8(_mm_min_epu8(chunk, ctrl_limit), chunk));
+    uint32_t mask = _mm_movemask_epi8(terminator);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask);
+    }
+    cursor += 16;
+  }
+  return cursor;
+}
+#elif defined(V8_HOST_ARCH_ARM64)
+// Narrow a per-lane 0x00/0xFF byte mask into a 64-bit integer where each
+// input lane occupies 4 bits, so the first set lane is CountTrailingZeros / 4.
+inline uint64_t NibbleMask(uint8x16_t mask) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+}
+
+inline const uint8_t* SkipWhitespaceVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t tab = vdupq_n_u8('\t');
+  const uint8x16_t cr = vdupq_n_u8('\r');
+  const uint8x16_t lf = vdupq_n_u8('\n');
+  while (end - cursor >= 16) {
+    uint8x16_t chunk = vld1q_u8(cursor);
+    uint8x16_t ws =
+        vorrq_u8(vorrq_u8(vceqq_u8(chunk, space), vceqq_u8(chunk, tab)),
+                 vorrq_u8(vceqq_u8(chunk, cr), vceqq_u8(chunk, lf)));
+    uint64_t non_ws = ~NibbleMask(ws);
+    if (non_ws != 0) {
+      return cursor + base::bits::CountTrailingZeros64(non_ws) / 4;
+    }
+    cursor += 16;
+  }
+  return cursor;
+}
+
+inline const uint8_t* ScanJsonStringVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t ctrl_limit = vdupq_n_u8(0x20);
+  while (end - cursor >= 16) {
+    uint8x16_t chunk = vld1q_u8(cursor);
+    uint8x16_t terminator =
+        vorrq_u8(vorrq_u8(vceqq_u8(chunk, quote), vceqq_u8(chunk, backslash)),
+                 vcltq_u8(chunk, ctrl_limit));
+    uint64_t mask = NibbleMask(terminator);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros64(mask) / 4;
+    }
+    cursor += 16;
+  }
+  return cursor;
+}
+#else
+inline const uint8_t* SkipWhitespaceVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  return cursor;
+}
+
+inline const uint8_t* ScanJsonStringVectorized(const uint8_t* cursor,
+                                               const uint8_t* end) {
+  return cursor;
+}
+#endif
 }  // namespace
 
 template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  if constexpr (kIsOneByte) {
+    cursor_ = reinterpret_cast<const Char*>(
+        SkipWhitespaceVectorized(reinterpret_cast<const uint8_t*>(cursor_),
+                                 reinterpret_cast<const uint8_t*>(end_)));
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -1148,6 +1282,23 @@ class NamedPropertyValueIterator {
   const JsonProperty* end_;
 };
 
+template <typename Char>
+uint32_t JsonParser<Char>::ShapeHash(
+    const SmallVector<JsonProperty>& property_stack, size_t start) {
+  DisallowGarbageCollection no_gc;
+  size_t hash = base::hash_value(property_stack.size() - start);
+  for (size_t i = start; i < property_stack.size(); i++) {
+    const JsonString& string = property_stack[i].string;
+    if (string.is_index()) continue;
+    // Hash the raw source characters of the key; escaped spellings of the
+    // same key hash differently, which only costs a cache miss.
+    const Char* key_chars = chars_ + string.start();
+    hash = base::hash_combine(
+        hash, base::hash_range(key_chars, key_chars + string.length()));
+  }
+  return static_cast<uint32_t>(hash);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -1158,6 +1309,29 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  // Without feedback from a sibling array element, consult the isolate's
+  // cross-parse shape cache: parses of documents with identical schemas can
+  // then reuse the final map directly instead of re-walking the transition
+  // tree property by property. A colliding or stale entry is harmless, since
+  // {JSDataObjectBuilder} verifies each key against the map's descriptors.
+  bool consult_shape_cache = feedback.is_null() && named_length > 0;
+  uint32_t shape_hash = 0;
+  if (consult_shape_cache) {
+    shape_hash = ShapeHash(property_stack, start);
+    Tagged<Map> cached = isolate_->json_shape_cache()->Lookup(shape_hash);
+    // The cache is isolate-wide but maps embed a prototype, so an entry may
+    // only be reused by the native context it was created in; the builder
+    // verifies keys and representations, never the prototype.
+    if (!cached.is_null() && !cached->IsDetached(isolate_) &&
+        cached->map()->native_context_or_null() ==
+            isolate_->raw_native_context()) {
+      feedback = handle(cached, isolate_);
+      if (cached->is_deprecated()) {
+        feedback = Map::Update(isolate_, feedback);
+      }
+    }
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1240,6 +1414,13 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
     JSObject::DefineOwnPropertyIgnoreAttributes(&it, value, NONE).Check();
   }
 
+  if (consult_shape_cache) {
+    Tagged<Map> map = object->map();
+    if (!map->is_dictionary_map() && !map->IsDetached(isolate_)) {
+      isolate_->json_shape_cache()->Update(shape_hash, map);
+    }
+  }
+
   return object;
 }
 
@@ -1724,6 +1905,27 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
         // TODO(verwaest): Cache?
         return handle(Smi::FromInt(i * sign), isolate_);
       }
+
+      // Keep accumulating digits: integers of up to 15 digits are exactly
+      // representable as doubles (10^15 < 2^53), so plain integer literals
+      // beyond Smi range can still skip the re-scan through StringToDouble.
+      const int kMaxExactIntLength = 15;
+      uint64_t integer = i;
+      stop = smi_start + kMaxExactIntLength;
+      if (stop > end_) stop = end_;
+      while (cursor_ < stop && IsDecimalDigit(*cursor_)) {
+        integer = (integer * 10) + ((*cursor_) - '0');
+        cursor_++;
+      }
+      c = CurrentCharacter();
+      if (!base::IsInRange(c, 0,
+                           static_cast<int32_t>(unibrow::Latin1::kMaxChar)) ||
+          !IsNumberPart(character_json_scan_flags[c])) {
+        number = static_cast<double>(integer);
+        if (sign < 0) number = -number;
+        AllowGarbageCollection allow_for_number_allocation;
+        return factory()->NewNumber(number);
+      }
       AdvanceToNonDecimal();
     }
 
@@ -1903,6 +2105,11 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if constexpr (kIsOneByte) {
+      cursor_ = reinterpret_cast<const Char*>(
+          ScanJsonStringVectorized(reinterpret_cast<const uint8_t*>(cursor_),
+                                   reinterpret_cast<const uint8_t*>(end_)));
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -327,6 +327,10 @@ class JsonParser final {
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
+  // Hash of the property-name sequence of the object under construction, used
+  // to key the isolate's cross-parse {JsonShapeCache}.
+  uint32_t ShapeHash(const SmallVector<JsonProperty>& property_stack,
+                     size_t start);
   Handle<Object> BuildJsonArray(
       const JsonContinuation& cont,
       const SmallVector<Handle<Object>>& element_stack);
@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/string.h"
+
+namespace v8 {
+namespace internal {
+
+bool JsonStreamedSource::AppendChunk(const uint8_t* data, size_t length) {
+  DCHECK(!parsed_);
+  // A one-byte chunk sequence can only shrink during decoding, so comparing
+  // the raw byte count against kMaxLength is a conservative admission check.
+  if (buffer_.size() + length > static_cast<size_t>(String::kMaxLength)) {
+    return false;
+  }
+  buffer_.insert(buffer_.end(), data, data + length);
+  return true;
+}
+
+MaybeHandle<Object> JsonStreamedSource::Parse(Isolate* isolate) {
+  DCHECK(!parsed_);
+  parsed_ = true;
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, source,
+      isolate->factory()->NewStringFromUtf8(base::VectorOf(
+          reinterpret_cast<const char*>(buffer_.data()), buffer_.size())),
+      Object);
+  // The chunk buffer is dead weight once the source string exists; release
+  // it before parsing allocates the object graph.
+  std::vector<uint8_t>().swap(buffer_);
+  source = String::Flatten(isolate, source);
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return source->IsOneByteRepresentation()
+             ? JsonParser<uint8_t>::Parse(isolate, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
+}  // namespace internal
+}  // namespace v8
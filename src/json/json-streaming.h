@@ -0,0 +1,50 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_H_
+#define V8_JSON_JSON_STREAMING_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/handles/handles.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// Backing implementation for v8::JSON::StreamedSource. Accumulates UTF-8
+// chunks as they arrive (e.g. off a socket), so that the embedder does not
+// have to materialize the whole body itself before handing it to
+// JSON.parse. The source string is built inside V8 in a single pass over
+// the accumulated chunks when parsing starts.
+//
+// TODO(v8): Start tokenizing chunks as they arrive, like script streaming
+// does, instead of deferring all work to Parse().
+class JsonStreamedSource {
+ public:
+  JsonStreamedSource() = default;
+  JsonStreamedSource(const JsonStreamedSource&) = delete;
+  JsonStreamedSource& operator=(const JsonStreamedSource&) = delete;
+
+  // Appends a chunk of UTF-8 encoded JSON text. The bytes are copied, so the
+  // caller may release |data| on return. Returns false if the accumulated
+  // source would exceed String::kMaxLength.
+  bool AppendChunk(const uint8_t* data, size_t length);
+
+  // Decodes the accumulated chunks into a source string and parses it.
+  // May only be called once.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Parse(Isolate* isolate);
+
+ private:
+  std::vector<uint8_t> buffer_;
+  bool parsed_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_H_
@@ -12,6 +12,7 @@
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-objects.h"
 #include "src/objects/js-raw-json-inl.h"
 #include "src/objects/lookup.h"
 #include "src/objects/objects-inl.h"
@@ -354,6 +355,13 @@ class JsonStringifier {
   Result StackPush(Handle<Object> object, Handle<Object> key);
   void StackPop();
 
+  // Returns whether every own descriptor of |map| is an enumerable data
+  // field with a string key, i.e. reading the properties cannot run user
+  // code. The verdict for the most recently verified map is cached, which
+  // makes the per-object check a single map comparison for the common case
+  // of large data trees stamped out of one shape.
+  bool IsPureDataObjectMap(Tagged<Map> map);
+
   // Uses the current stack_ to provide a detailed error message of
   // the objects involved in the circular structure.
   Handle<String> ConstructCircularStructureErrorMessage(Handle<Object> last_key,
@@ -374,6 +382,8 @@ class JsonStringifier {
 
   Isolate* isolate_;
   String::Encoding encoding_;
+  // Most recently verified pure-data map, see IsPureDataObjectMap.
+  Handle<Map> pure_data_map_cache_;
   Handle<FixedArray> property_list_;
   Handle<JSReceiver> replacer_function_;
   uint8_t* one_byte_ptr_;
@@ -1225,6 +1235,24 @@ V8_INLINE bool CanFastSerializeJSObject(PtrComprCageBase cage_base,
 }
 }  // namespace
 
+bool JsonStringifier::IsPureDataObjectMap(Tagged<Map> map) {
+  DisallowGarbageCollection no_gc;
+  if (!pure_data_map_cache_.is_null() && *pure_data_map_cache_ == map) {
+    return true;
+  }
+  PtrComprCageBase cage_base(isolate_);
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(cage_base);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), cage_base)) return false;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) return false;
+    if (details.location() != PropertyLocation::kField) return false;
+    DCHECK_EQ(PropertyKind::kData, details.kind());
+  }
+  pure_data_map_cache_ = handle(map, isolate_);
+  return true;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSObject(
     Handle<JSObject> object, Handle<Object> key) {
   PtrComprCageBase cage_base(isolate_);
@@ -1259,6 +1287,50 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   AppendCharacter('{');
   Indent();
   bool comma = false;
+
+  if (IsPureDataObjectMap(*map)) {
+    // Verified pure-data shape: every own descriptor is an enumerable data
+    // field, so property access is a plain field load and cannot run user
+    // code or transition the map. Skip the per-descriptor re-checks.
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Handle<String> key_name;
+      PropertyDetails details = PropertyDetails::Empty();
+      {
+        DisallowGarbageCollection no_gc;
+        Tagged<DescriptorArray> descriptors =
+            map->instance_descriptors(cage_base);
+        key_name = handle(String::cast(descriptors->GetKey(i)), isolate_);
+        details = descriptors->GetDetails(i);
+      }
+      DCHECK_EQ(PropertyLocation::kField, details.location());
+      Handle<Object> property;
+      if (V8_LIKELY(*map == object->map(cage_base))) {
+        FieldIndex field_index = FieldIndex::ForDetails(*map, details);
+        property = JSObject::FastPropertyAt(
+            isolate_, object, details.representation(), field_index);
+      } else {
+        // A getter in a nested non-pure subtree mutated this object while we
+        // were serializing it; take the generic read path for the remainder.
+        if (!need_stack_) {
+          need_stack_ = true;
+          return NEED_STACK;
+        }
+        ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+            isolate_, property,
+            Object::GetPropertyOrElement(isolate_, object, key_name),
+            EXCEPTION);
+      }
+      Result result = SerializeProperty(property, comma, key_name);
+      if (!comma && result == SUCCESS) comma = true;
+      if (result == EXCEPTION || result == NEED_STACK) return result;
+    }
+    Unindent();
+    if (comma) NewLine();
+    AppendCharacter('}');
+    StackPop();
+    return SUCCESS;
+  }
+
   for (InternalIndex i : map->IterateOwnDescriptors()) {
     Handle<String> key_name;
     PropertyDetails details = PropertyDetails::Empty();
@@ -1303,6 +1375,31 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
+  if (contents.is_null() && IsJSObject(*object) &&
+      Handle<JSObject>::cast(object)->HasNamedInterceptor()) {
+    // An interceptor with a bulk getter reports all names and values in a
+    // single embedder callback instead of one callback per property.
+    Handle<FixedArray> pairs;
+    Maybe<bool> bulk = JSObject::GetOwnNameValuePairsWithBulkInterceptor(
+        isolate_, object, Handle<JSObject>::cast(object), &pairs);
+    if (bulk.IsNothing()) return EXCEPTION;
+    if (bulk.FromJust()) {
+      AppendCharacter('{');
+      Indent();
+      bool comma = false;
+      for (int i = 0; i < pairs->length(); i += 2) {
+        Handle<String> key(String::cast(pairs->get(i)), isolate_);
+        Handle<Object> property(pairs->get(i + 1), isolate_);
+        Result result = SerializeProperty(property, comma, key);
+        if (!comma && result == SUCCESS) comma = true;
+        if (result == EXCEPTION || result == NEED_STACK) return result;
+      }
+      Unindent();
+      if (comma) NewLine();
+      AppendCharacter('}');
+      return SUCCESS;
+    }
+  }
   if (contents.is_null()) {
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
         isolate_, contents,
@@ -144,6 +144,20 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
                                        : DefaultTimeFunction,
             priority_from_index(i));
   }
+  // When priorities are applied, each priority level has its own thread pool.
+  // Let idle workers steal queued tasks from the other pools rather than
+  // leaving cores unused. Higher-priority queues are drained first, so that
+  // e.g. GC jobs are not starved by a backlog of lower-priority compile
+  // tasks; idle high-priority workers in turn pick up starved low-priority
+  // tasks.
+  for (int i = 0; i < num_worker_runners(); i++) {
+    std::vector<DefaultWorkerThreadsTaskRunner*> victims;
+    for (int j = num_worker_runners() - 1; j >= 0; j--) {
+      if (j == i) continue;
+      victims.push_back(worker_threads_task_runners_[j].get());
+    }
+    worker_threads_task_runners_[i]->SetStealVictims(std::move(victims));
+  }
   DCHECK_NOT_NULL(worker_threads_task_runners_[0]);
 }
 
@@ -289,6 +303,21 @@ v8::ThreadIsolatedAllocator* DefaultPlatform::GetThreadIsolatedAllocator() {
   return nullptr;
 }
 
+DefaultPlatform::WorkerThreadsStatistics
+DefaultPlatform::GetWorkerThreadsStatistics(TaskPriority priority) {
+  WorkerThreadsStatistics stats;
+  std::shared_ptr<DefaultWorkerThreadsTaskRunner> runner;
+  {
+    base::MutexGuard guard(&lock_);
+    runner = worker_threads_task_runners_[priority_to_index(priority)];
+  }
+  if (runner) {
+    stats.queued_tasks = runner->NumberOfQueuedTasks();
+    stats.stolen_tasks = runner->NumberOfStolenTasks();
+  }
+  return stats;
+}
+
 void DefaultPlatform::NotifyIsolateShutdown(Isolate* isolate) {
   std::shared_ptr<DefaultForegroundTaskRunner> taskrunner;
   {
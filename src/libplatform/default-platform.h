@@ -76,6 +76,16 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void NotifyIsolateShutdown(Isolate* isolate);
 
+  // Statistics about the worker thread pool serving |priority|, for
+  // monitoring. All zero if the pool has not been initialized.
+  struct WorkerThreadsStatistics {
+    // Tasks currently queued, including delayed tasks that are not ripe yet.
+    size_t queued_tasks = 0;
+    // Tasks this pool's workers took from other pools via work stealing.
+    uint64_t stolen_tasks = 0;
+  };
+  WorkerThreadsStatistics GetWorkerThreadsStatistics(TaskPriority priority);
+
  private:
   base::Thread::Priority priority_from_index(int i) const {
     if (priority_mode_ == PriorityMode::kDontApply) {
@@ -25,6 +25,31 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
+void DefaultWorkerThreadsTaskRunner::SetStealVictims(
+    std::vector<DefaultWorkerThreadsTaskRunner*> victims) {
+  base::MutexGuard guard(&lock_);
+  steal_victims_ = std::move(victims);
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryStealTask() {
+  base::MutexGuard guard(&lock_);
+  if (terminated_) return nullptr;
+  DelayedTaskQueue::MaybeNextTask next_task = queue_.TryGetNext();
+  if (next_task.state == DelayedTaskQueue::MaybeNextTask::kTask) {
+    return std::move(next_task.task);
+  }
+  return nullptr;
+}
+
+size_t DefaultWorkerThreadsTaskRunner::NumberOfQueuedTasks() {
+  base::MutexGuard guard(&lock_);
+  return queue_.NumberOfTasks();
+}
+
+uint64_t DefaultWorkerThreadsTaskRunner::NumberOfStolenTasks() const {
+  return stolen_task_count_.load(std::memory_order_relaxed);
+}
+
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   {
     base::MutexGuard guard(&lock_);
@@ -85,6 +110,10 @@ DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
   base::MutexGuard guard(&runner_->lock_);
+  // Cleared after an unsuccessful steal attempt so that an empty queue does
+  // not make this thread spin between TryGetNext() and stealing; set again
+  // whenever a task ran or this thread was woken up.
+  bool may_steal = true;
   while (true) {
     DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
     switch (next_task.state) {
@@ -92,13 +121,24 @@ void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
         runner_->lock_.Unlock();
         next_task.task->Run();
         runner_->lock_.Lock();
+        may_steal = true;
         continue;
       case DelayedTaskQueue::MaybeNextTask::kTerminated:
         return;
-      case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
+      case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite: {
+        if (may_steal && !runner_->steal_victims_.empty()) {
+          may_steal = false;
+          if (RunStolenTask()) may_steal = true;
+          // Re-examine our own queue in any case: tasks may have been posted
+          // while the lock was released for stealing, without a notification
+          // since this thread was not registered as idle.
+          continue;
+        }
         runner_->idle_threads_.push_back(this);
         condition_var_.Wait(&runner_->lock_);
+        may_steal = true;
         continue;
+      }
       case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
         // WaitFor unfortunately doesn't care about our fake time and will wait
         // the 'real' amount of time, based on whatever clock the system call
@@ -107,11 +147,32 @@ void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
         bool notified =
             condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
         USE(notified);
+        may_steal = true;
         continue;
     }
   }
 }
 
+bool DefaultWorkerThreadsTaskRunner::WorkerThread::RunStolenTask() {
+  // Copy the victim list so that the victim's lock is only ever taken while
+  // ours is released; two runners stealing from each other while holding
+  // their own lock would deadlock.
+  std::vector<DefaultWorkerThreadsTaskRunner*> victims =
+      runner_->steal_victims_;
+  runner_->lock_.Unlock();
+  std::unique_ptr<Task> task;
+  for (DefaultWorkerThreadsTaskRunner* victim : victims) {
+    task = victim->TryStealTask();
+    if (task) break;
+  }
+  if (task) {
+    runner_->stolen_task_count_.fetch_add(1, std::memory_order_relaxed);
+    task->Run();
+  }
+  runner_->lock_.Lock();
+  return task != nullptr;
+}
+
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Notify() {
   condition_var_.NotifyAll();
 }
@@ -5,6 +5,7 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -33,6 +34,23 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Enables work stealing: workers of this runner that have run out of work
+  // take tasks from the |victims| runners, in order, instead of going idle.
+  // The victims must outlive this runner.
+  void SetStealVictims(std::vector<DefaultWorkerThreadsTaskRunner*> victims);
+
+  // Removes and returns a task that is ready to run immediately, or nullptr
+  // if there is none. Called by workers of other runners that have run out of
+  // their own work.
+  std::unique_ptr<Task> TryStealTask();
+
+  // Monitoring statistics that embedders can poll to diagnose starved or
+  // over-subscribed worker pools.
+  // Number of tasks currently queued, including not-yet-ripe delayed tasks.
+  size_t NumberOfQueuedTasks();
+  // Number of tasks this runner's workers took from other runners.
+  uint64_t NumberOfStolenTasks() const;
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -59,6 +77,11 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     void Notify();
 
    private:
+    // Runs one task taken from |runner_|'s steal victims, if any is ready.
+    // Called and returns with |runner_|'s lock held, but releases it while
+    // stealing and running the task. Returns whether a task was run.
+    bool RunStolenTask();
+
     DefaultWorkerThreadsTaskRunner* runner_;
     base::ConditionVariable condition_var_;
   };
@@ -78,6 +101,12 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   DelayedTaskQueue queue_;
   std::queue<std::unique_ptr<Task>> task_queue_;
   TimeFunction time_function_;
+  // Other runners to take tasks from when this runner's queue is empty.
+  // Guarded by |lock_|; workers copy it before stealing, since taking a
+  // victim's lock while holding ours could deadlock with a runner stealing
+  // in the opposite direction.
+  std::vector<DefaultWorkerThreadsTaskRunner*> steal_victims_;
+  std::atomic<uint64_t> stolen_task_count_{0};
 };
 
 }  // namespace platform
@@ -4,6 +4,9 @@
 
 #include "src/libplatform/delayed-task-queue.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
@@ -12,7 +15,7 @@ namespace v8 {
 namespace platform {
 
 DelayedTaskQueue::DelayedTaskQueue(TimeFunction time_function)
-    : time_function_(time_function) {}
+    : start_time_(time_function()), time_function_(time_function) {}
 
 DelayedTaskQueue::~DelayedTaskQueue() {
   DCHECK(terminated_);
@@ -23,6 +26,17 @@ double DelayedTaskQueue::MonotonicallyIncreasingTime() {
   return time_function_();
 }
 
+uint64_t DelayedTaskQueue::DeadlineToTick(double deadline) const {
+  if (deadline <= start_time_) return 0;
+  return static_cast<uint64_t>(
+      std::ceil((deadline - start_time_) * kTicksPerSecond));
+}
+
+uint64_t DelayedTaskQueue::TimeToTick(double time) const {
+  if (time <= start_time_) return 0;
+  return static_cast<uint64_t>((time - start_time_) * kTicksPerSecond);
+}
+
 void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
   DCHECK(!terminated_);
   task_queue_.push(std::move(task));
@@ -31,57 +45,169 @@ void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
 void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
                                      double delay_in_seconds) {
   DCHECK_GE(delay_in_seconds, 0.0);
+  DCHECK(!terminated_);
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
-  {
-    DCHECK(!terminated_);
-    delayed_task_queue_.emplace(deadline, std::move(task));
+  ScheduleDelayedTask({deadline, std::move(task)});
+}
+
+void DelayedTaskQueue::ScheduleDelayedTask(DelayedEntry entry) {
+  uint64_t deadline_tick = DeadlineToTick(entry.deadline);
+  if (deadline_tick <= current_tick_) {
+    // The deadline has already passed; treat the task as immediate.
+    task_queue_.push(std::move(entry.task));
+    return;
   }
+  uint64_t delta = deadline_tick - current_tick_;
+  if (delta >= kMaxWheelTicks) {
+    overflow_queue_.emplace(entry.deadline, std::move(entry.task));
+    return;
+  }
+  int level = 0;
+  while (delta >= (uint64_t{1} << (kSlotBits * (level + 1)))) level++;
+  uint64_t slot = (deadline_tick >> (kSlotBits * level)) & kSlotMask;
+  wheel_[level][slot].push_back(std::move(entry));
+  occupancy_[level] |= uint64_t{1} << slot;
+  ++wheel_task_count_;
 }
 
-DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
-  for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
-    double now = MonotonicallyIncreasingTime();
-    for (;;) {
-      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-      if (!task) break;
-      task_queue_.push(std::move(task));
+void DelayedTaskQueue::ExpireSlot(uint64_t slot) {
+  Slot& entries = wheel_[0][slot];
+  DCHECK(!entries.empty());
+  wheel_task_count_ -= entries.size();
+  for (DelayedEntry& entry : entries) {
+    task_queue_.push(std::move(entry.task));
+  }
+  entries.clear();
+  occupancy_[0] &= ~(uint64_t{1} << slot);
+}
+
+void DelayedTaskQueue::Cascade() {
+  DCHECK_EQ(0u, current_tick_ & kSlotMask);
+  // Determine the highest level whose boundary was crossed, then pull the
+  // crossed slot of each level down, from the top so that re-filed entries
+  // land in slots that have not been processed yet.
+  int highest = 1;
+  while (highest + 1 < kLevels &&
+         ((current_tick_ >> (kSlotBits * highest)) & kSlotMask) == 0) {
+    ++highest;
+  }
+  // When the top level advances, overflow tasks may fit into the wheel now.
+  if (highest == kLevels - 1) RefillFromOverflow();
+  for (int level = highest; level >= 1; --level) {
+    uint64_t slot = (current_tick_ >> (kSlotBits * level)) & kSlotMask;
+    if (!(occupancy_[level] & (uint64_t{1} << slot))) continue;
+    Slot entries = std::move(wheel_[level][slot]);
+    wheel_[level][slot].clear();
+    occupancy_[level] &= ~(uint64_t{1} << slot);
+    wheel_task_count_ -= entries.size();
+    for (DelayedEntry& entry : entries) {
+      ScheduleDelayedTask(std::move(entry));
     }
-    if (!task_queue_.empty()) {
-      std::unique_ptr<Task> task = std::move(task_queue_.front());
-      task_queue_.pop();
-      return {MaybeNextTask::kTask, std::move(task), {}};
+  }
+}
+
+void DelayedTaskQueue::RefillFromOverflow() {
+  while (!overflow_queue_.empty()) {
+    auto it = overflow_queue_.begin();
+    uint64_t deadline_tick = DeadlineToTick(it->first);
+    if (deadline_tick > current_tick_ &&
+        deadline_tick - current_tick_ >= kMaxWheelTicks) {
+      // Still out of range, and so is every task behind it.
+      return;
     }
+    DelayedEntry entry{it->first, std::move(it->second)};
+    overflow_queue_.erase(it);
+    ScheduleDelayedTask(std::move(entry));
+  }
+}
 
-    if (terminated_) {
-      return {MaybeNextTask::kTerminated, {}, {}};
+void DelayedTaskQueue::AdvanceWheel(double now) {
+  uint64_t target_tick = TimeToTick(now);
+  if (target_tick <= current_tick_) return;
+  if (wheel_task_count_ == 0) {
+    // Nothing can expire; jump straight to the target. Overflow tasks may
+    // have come into range (or become ripe) after a large jump.
+    current_tick_ = target_tick;
+    RefillFromOverflow();
+    return;
+  }
+  while (current_tick_ < target_tick) {
+    // Process level-0 slots up to the next cascade boundary. The slots for
+    // the next kSlotsPerLevel ticks map one-to-one to ticks, so simply visit
+    // the occupied ones.
+    uint64_t boundary = (current_tick_ | kSlotMask) + 1;
+    uint64_t step_end = std::min(target_tick, boundary);
+    if (occupancy_[0] != 0) {
+      for (uint64_t tick = current_tick_ + 1; tick <= step_end; ++tick) {
+        uint64_t slot = tick & kSlotMask;
+        if (occupancy_[0] & (uint64_t{1} << slot)) ExpireSlot(slot);
+      }
     }
+    current_tick_ = step_end;
+    if (current_tick_ == boundary) Cascade();
+    if (wheel_task_count_ == 0 && overflow_queue_.empty()) {
+      current_tick_ = target_tick;
+      return;
+    }
+  }
+}
 
-    if (task_queue_.empty() && !delayed_task_queue_.empty()) {
-      // Wait for the next delayed task or a newly posted task.
-      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
-      return {
-          MaybeNextTask::kWaitDelayed,
-          {},
-          base::TimeDelta::FromMicroseconds(
-              base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds)};
-    } else {
-      return {MaybeNextTask::kWaitIndefinite, {}, {}};
+bool DelayedTaskQueue::HasDelayedTasks() const {
+  return wheel_task_count_ != 0 || !overflow_queue_.empty();
+}
+
+double DelayedTaskQueue::EarliestDeadlineEstimate() const {
+  DCHECK(HasDelayedTasks());
+  // Level 0 maps the next kSlotsPerLevel ticks one-to-one to slots, so the
+  // first occupied slot gives the exact next expiry. Higher levels only
+  // yield the time their crossed slot cascades, which is a lower bound for
+  // any deadline it holds; waking up then makes the caller re-poll.
+  for (int level = 0; level < kLevels; ++level) {
+    if (occupancy_[level] == 0) continue;
+    uint64_t level_pos = current_tick_ >> (kSlotBits * level);
+    for (uint64_t distance = 1; distance <= kSlotsPerLevel; ++distance) {
+      uint64_t slot = (level_pos + distance) & kSlotMask;
+      if (occupancy_[level] & (uint64_t{1} << slot)) {
+        uint64_t tick = (level_pos + distance) << (kSlotBits * level);
+        return start_time_ + tick / kTicksPerSecond;
+      }
     }
   }
+  DCHECK(!overflow_queue_.empty());
+  return overflow_queue_.begin()->first;
 }
 
-// Gets the next task from the delayed queue for which the deadline has passed
-// according to |now|. Returns nullptr if no such task exists.
-std::unique_ptr<Task> DelayedTaskQueue::PopTaskFromDelayedQueue(double now) {
-  if (delayed_task_queue_.empty()) return nullptr;
+DelayedTaskQueue::MaybeNextTask DelayedTaskQueue::TryGetNext() {
+  // Move delayed tasks that have hit their deadline to the main queue.
+  double now = MonotonicallyIncreasingTime();
+  AdvanceWheel(now);
+  if (!task_queue_.empty()) {
+    std::unique_ptr<Task> task = std::move(task_queue_.front());
+    task_queue_.pop();
+    return {MaybeNextTask::kTask, std::move(task), {}};
+  }
 
-  auto it = delayed_task_queue_.begin();
-  if (it->first > now) return nullptr;
+  if (terminated_) {
+    return {MaybeNextTask::kTerminated, {}, {}};
+  }
+
+  if (HasDelayedTasks()) {
+    // Wait for the next delayed task or a newly posted task. The estimate is
+    // a lower bound for the earliest deadline, so waking up at that point at
+    // worst leads to another round of waiting.
+    double wait_in_seconds = EarliestDeadlineEstimate() - now;
+    return {
+        MaybeNextTask::kWaitDelayed,
+        {},
+        base::TimeDelta::FromMicroseconds(
+            base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds)};
+  } else {
+    return {MaybeNextTask::kWaitIndefinite, {}, {}};
+  }
+}
 
-  std::unique_ptr<Task> result = std::move(it->second);
-  delayed_task_queue_.erase(it);
-  return result;
+size_t DelayedTaskQueue::NumberOfTasks() const {
+  return task_queue_.size() + wheel_task_count_ + overflow_queue_.size();
 }
 
 void DelayedTaskQueue::Terminate() {
@@ -5,9 +5,11 @@
 #ifndef V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 #define V8_LIBPLATFORM_DELAYED_TASK_QUEUE_H_
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "src/base/platform/condition-variable.h"
@@ -24,6 +26,11 @@ namespace platform {
 // not provide any guarantees about ordering of tasks, except that immediate
 // tasks will be run in the order that they are posted.
 //
+// Delayed tasks are kept in a hierarchical timer wheel with millisecond
+// ticks, so that appending and expiring them is O(1) amortized regardless of
+// how many delayed tasks are pending; only deadlines beyond the range of the
+// wheel fall back to an ordered overflow queue.
+//
 // This class is not thread-safe, and should be guarded by a lock.
 class V8_PLATFORM_EXPORT DelayedTaskQueue {
  public:
@@ -58,14 +65,68 @@ class V8_PLATFORM_EXPORT DelayedTaskQueue {
   // constructor.
   MaybeNextTask TryGetNext();
 
+  // Returns the number of tasks currently in the queue, including delayed
+  // tasks whose deadline has not passed yet.
+  size_t NumberOfTasks() const;
+
   // Terminate the queue.
   void Terminate();
 
  private:
-  std::unique_ptr<Task> PopTaskFromDelayedQueue(double now);
+  // The wheel has kLevels levels of kSlotsPerLevel slots each. Level 0 holds
+  // one tick (millisecond) per slot; every higher level covers kSlotsPerLevel
+  // times the range of the level below, so the wheel spans 2^24 ticks
+  // (about 4.6 hours) in total.
+  static constexpr int kSlotBits = 6;
+  static constexpr uint64_t kSlotsPerLevel = uint64_t{1} << kSlotBits;
+  static constexpr uint64_t kSlotMask = kSlotsPerLevel - 1;
+  static constexpr int kLevels = 4;
+  static constexpr uint64_t kMaxWheelTicks = uint64_t{1}
+                                             << (kSlotBits * kLevels);
+  static constexpr double kTicksPerSecond = 1000.0;
+
+  struct DelayedEntry {
+    double deadline;
+    std::unique_ptr<Task> task;
+  };
+  using Slot = std::vector<DelayedEntry>;
+
+  // Tick in which a deadline expires (rounded up, so a slot never expires
+  // before the deadlines it holds), and the tick a current time lies in
+  // (rounded down).
+  uint64_t DeadlineToTick(double deadline) const;
+  uint64_t TimeToTick(double time) const;
+
+  // Files |entry| into the wheel level matching its remaining delay, into the
+  // overflow queue if it is further out than the wheel spans, or straight
+  // into |task_queue_| if its deadline has already passed.
+  void ScheduleDelayedTask(DelayedEntry entry);
+  // Advances the wheel to |now|, moving all expired delayed tasks to
+  // |task_queue_|.
+  void AdvanceWheel(double now);
+  // Re-files the slots of higher levels whose boundary |current_tick_| just
+  // crossed into the levels below.
+  void Cascade();
+  // Moves overflow tasks that fit into the wheel's range back into it.
+  void RefillFromOverflow();
+  // Moves all tasks of level-0 slot |slot| to |task_queue_|.
+  void ExpireSlot(uint64_t slot);
+  // Returns whether any delayed task is pending, and a lower bound for the
+  // earliest deadline among them (only valid if any is pending).
+  bool HasDelayedTasks() const;
+  double EarliestDeadlineEstimate() const;
 
   std::queue<std::unique_ptr<Task>> task_queue_;
-  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+  Slot wheel_[kLevels][kSlotsPerLevel];
+  // Bit i is set iff wheel_[level][i] is non-empty.
+  uint64_t occupancy_[kLevels] = {};
+  // Number of tasks currently held in the wheel (excluding overflow).
+  size_t wheel_task_count_ = 0;
+  // Delayed tasks too far out for the wheel, ordered by deadline.
+  std::multimap<double, std::unique_ptr<Task>> overflow_queue_;
+  // The wheel's current position; ticks are milliseconds since |start_time_|.
+  uint64_t current_tick_ = 0;
+  double start_time_;
   bool terminated_ = false;
   TimeFunction time_function_;
 };
@@ -97,11 +97,176 @@ TraceObject* TraceBufferChunk::AddTraceEvent(size_t* event_index) {
   return &chunk_[*event_index];
 }
 
+namespace {
+
+// Caches the thread's state within the buffer it most recently recorded
+// into. The id check makes stale entries (a deleted buffer, or a thread
+// switching between buffers) miss instead of dereferencing freed memory.
+struct ThreadStateCache {
+  uint64_t buffer_id = 0;
+  void* state = nullptr;
+};
+thread_local ThreadStateCache thread_state_cache;
+
+std::atomic<uint64_t> next_buffer_id{1};
+
+}  // namespace
+
+TraceBufferStreamingBuffer::TraceBufferStreamingBuffer(
+    size_t max_retired_chunks, TraceWriter* trace_writer)
+    : buffer_id_(next_buffer_id.fetch_add(1, std::memory_order_relaxed)),
+      max_retired_chunks_(max_retired_chunks) {
+  trace_writer_.reset(trace_writer);
+}
+
+TraceBufferStreamingBuffer::ThreadState*
+TraceBufferStreamingBuffer::GetThreadState() {
+  ThreadStateCache& cache = thread_state_cache;
+  if (cache.buffer_id == buffer_id_) {
+    return static_cast<ThreadState*>(cache.state);
+  }
+  auto state = std::make_unique<ThreadState>();
+  ThreadState* result = state.get();
+  {
+    base::MutexGuard guard(&registry_mutex_);
+    thread_states_.push_back(std::move(state));
+  }
+  cache.buffer_id = buffer_id_;
+  cache.state = result;
+  return result;
+}
+
+std::unique_ptr<TraceBufferChunk> TraceBufferStreamingBuffer::NewChunk() {
+  uint32_t seq = next_chunk_seq_.fetch_add(1, std::memory_order_relaxed);
+  {
+    base::MutexGuard guard(&retired_mutex_);
+    if (!spare_chunks_.empty()) {
+      std::unique_ptr<TraceBufferChunk> chunk = std::move(spare_chunks_.back());
+      spare_chunks_.pop_back();
+      chunk->Reset(seq);
+      return chunk;
+    }
+  }
+  return std::make_unique<TraceBufferChunk>(seq);
+}
+
+void TraceBufferStreamingBuffer::RetireChunk(
+    std::unique_ptr<TraceBufferChunk> chunk) {
+  {
+    base::MutexGuard guard(&retired_mutex_);
+    retired_chunks_.push_back(std::move(chunk));
+    if (retired_chunks_.size() > max_retired_chunks_) {
+      // Keep memory bounded like the ring buffer does: drop the oldest
+      // chunk, recycling its storage.
+      spare_chunks_.push_back(std::move(retired_chunks_.front()));
+      retired_chunks_.pop_front();
+    }
+  }
+  // Stream queued chunks if no other thread is writing; never block the
+  // traced thread on the writer.
+  if (writer_mutex_.TryLock()) {
+    DrainRetiredChunks();
+    writer_mutex_.Unlock();
+  }
+}
+
+void TraceBufferStreamingBuffer::DrainRetiredChunks() {
+  for (;;) {
+    std::unique_ptr<TraceBufferChunk> chunk;
+    {
+      base::MutexGuard guard(&retired_mutex_);
+      if (retired_chunks_.empty()) return;
+      chunk = std::move(retired_chunks_.front());
+      retired_chunks_.pop_front();
+    }
+    for (size_t i = 0; i < chunk->size(); ++i) {
+      trace_writer_->AppendTraceEvent(chunk->GetEventAt(i));
+    }
+    base::MutexGuard guard(&retired_mutex_);
+    spare_chunks_.push_back(std::move(chunk));
+  }
+}
+
+TraceObject* TraceBufferStreamingBuffer::AddTraceEvent(uint64_t* handle) {
+  ThreadState* state = GetThreadState();
+  std::unique_ptr<TraceBufferChunk> retired;
+  TraceObject* trace_object;
+  {
+    base::MutexGuard guard(&state->mutex);
+    if (!state->chunk || state->chunk->IsFull()) {
+      retired = std::move(state->chunk);
+      state->chunk = NewChunk();
+    }
+    size_t event_index;
+    trace_object = state->chunk->AddTraceEvent(&event_index);
+    *handle = MakeHandle(state->chunk->seq(), event_index);
+  }
+  if (retired) RetireChunk(std::move(retired));
+  return trace_object;
+}
+
+TraceObject* TraceBufferStreamingBuffer::GetEventByHandle(uint64_t handle) {
+  // Only events still in the calling thread's chunk can be looked up (which
+  // covers the duration update of a scoped event ending on the thread that
+  // recorded it); events handed to the writer are final.
+  ThreadStateCache& cache = thread_state_cache;
+  if (cache.buffer_id != buffer_id_) return nullptr;
+  ThreadState* state = static_cast<ThreadState*>(cache.state);
+  base::MutexGuard guard(&state->mutex);
+  uint32_t chunk_seq;
+  size_t event_index;
+  ExtractHandle(handle, &chunk_seq, &event_index);
+  if (!state->chunk || state->chunk->seq() != chunk_seq) return nullptr;
+  if (event_index >= state->chunk->size()) return nullptr;
+  return state->chunk->GetEventAt(event_index);
+}
+
+bool TraceBufferStreamingBuffer::Flush() {
+  base::MutexGuard writer_guard(&writer_mutex_);
+  DrainRetiredChunks();
+  std::vector<ThreadState*> states;
+  {
+    base::MutexGuard guard(&registry_mutex_);
+    for (const auto& state : thread_states_) {
+      states.push_back(state.get());
+    }
+  }
+  for (ThreadState* state : states) {
+    base::MutexGuard guard(&state->mutex);
+    if (!state->chunk) continue;
+    for (size_t i = 0; i < state->chunk->size(); ++i) {
+      trace_writer_->AppendTraceEvent(state->chunk->GetEventAt(i));
+    }
+    // Handles into the streamed chunk become unresolvable.
+    state->chunk.reset();
+  }
+  trace_writer_->Flush();
+  return true;
+}
+
+uint64_t TraceBufferStreamingBuffer::MakeHandle(uint32_t chunk_seq,
+                                                size_t event_index) const {
+  return static_cast<uint64_t>(chunk_seq) * TraceBufferChunk::kChunkSize +
+         event_index;
+}
+
+void TraceBufferStreamingBuffer::ExtractHandle(uint64_t handle,
+                                               uint32_t* chunk_seq,
+                                               size_t* event_index) const {
+  *chunk_seq = static_cast<uint32_t>(handle / TraceBufferChunk::kChunkSize);
+  *event_index = handle % TraceBufferChunk::kChunkSize;
+}
+
 TraceBuffer* TraceBuffer::CreateTraceBufferRingBuffer(
     size_t max_chunks, TraceWriter* trace_writer) {
   return new TraceBufferRingBuffer(max_chunks, trace_writer);
 }
 
+TraceBuffer* TraceBuffer::CreateTraceBufferStreamingBuffer(
+    size_t max_retired_chunks, TraceWriter* trace_writer) {
+  return new TraceBufferStreamingBuffer(max_retired_chunks, trace_writer);
+}
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 #define V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 
+#include <atomic>
+#include <list>
 #include <memory>
 #include <vector>
 
@@ -42,6 +44,72 @@ class TraceBufferRingBuffer : public TraceBuffer {
   uint32_t current_chunk_seq_ = 1;
 };
 
+// A TraceBuffer for always-on tracing: each traced thread records into its
+// own chunk, so the hot AddTraceEvent path never contends with other threads.
+// Full chunks are retired to a queue and streamed to the writer by whichever
+// thread next manages to take the writer without blocking, instead of
+// serializing the whole buffer when tracing stops. Events handed to the
+// writer are final; in particular, the duration of an event whose scope
+// outlives its chunk is not recorded.
+class TraceBufferStreamingBuffer : public TraceBuffer {
+ public:
+  // Takes ownership of |trace_writer|. At most |max_retired_chunks| full
+  // chunks are buffered before being streamed; beyond that the oldest ones
+  // are dropped.
+  TraceBufferStreamingBuffer(size_t max_retired_chunks,
+                             TraceWriter* trace_writer);
+  ~TraceBufferStreamingBuffer() override = default;
+
+  TraceObject* AddTraceEvent(uint64_t* handle) override;
+  TraceObject* GetEventByHandle(uint64_t handle) override;
+  bool Flush() override;
+
+ private:
+  struct ThreadState {
+    // Serializes the owning thread's recording with Flush(); uncontended
+    // unless a flush is in progress.
+    base::Mutex mutex;
+    std::unique_ptr<TraceBufferChunk> chunk;
+  };
+
+  uint64_t MakeHandle(uint32_t chunk_seq, size_t event_index) const;
+  void ExtractHandle(uint64_t handle, uint32_t* chunk_seq,
+                     size_t* event_index) const;
+
+  // Returns the calling thread's state, registering it on first use.
+  ThreadState* GetThreadState();
+  // Returns a chunk with a fresh, process-unique sequence number, recycling
+  // a spare chunk if possible.
+  std::unique_ptr<TraceBufferChunk> NewChunk();
+  // Queues a full chunk for streaming and tries to stream queued chunks if
+  // the writer is not busy.
+  void RetireChunk(std::unique_ptr<TraceBufferChunk> chunk);
+  // Hands all queued chunks to the writer. |writer_mutex_| must be held.
+  void DrainRetiredChunks();
+
+  // Distinguishes this buffer in the per-thread state cache, including from
+  // deleted buffers the cache may still point into.
+  const uint64_t buffer_id_;
+  const size_t max_retired_chunks_;
+  // Sequence number for the next chunk; unique across all threads, so a
+  // handle identifies its chunk unambiguously.
+  std::atomic<uint32_t> next_chunk_seq_{1};
+
+  base::Mutex registry_mutex_;
+  // All registered per-thread states; guarded by |registry_mutex_|.
+  std::vector<std::unique_ptr<ThreadState>> thread_states_;
+
+  base::Mutex retired_mutex_;
+  // Full chunks not yet streamed and empty chunks for reuse; both guarded by
+  // |retired_mutex_|.
+  std::list<std::unique_ptr<TraceBufferChunk>> retired_chunks_;
+  std::vector<std::unique_ptr<TraceBufferChunk>> spare_chunks_;
+
+  base::Mutex writer_mutex_;
+  // Only accessed with |writer_mutex_| held.
+  std::unique_ptr<TraceWriter> trace_writer_;
+};
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -217,6 +217,9 @@ namespace internal {
   HT(gc_time_to_safepoint, V8.GC.TimeToSafepoint, 10000000, MICROSECOND)       \
   HT(gc_time_to_collection_on_background, V8.GC.TimeToCollectionOnBackground,  \
      10000000, MICROSECOND)                                                    \
+  /* Hash table growth pauses (e.g. WeakMap backing stores). */                \
+  HT(object_hash_table_grow, V8.ObjectHashTableGrowMicroSeconds, 1000000,      \
+     MICROSECOND)                                                              \
   /* Maglev timers. */                                                         \
   HT(maglev_optimize_prepare, V8.MaglevOptimizePrepare, 100000, MICROSECOND)   \
   HT(maglev_optimize_execute, V8.MaglevOptimizeExecute, 100000, MICROSECOND)   \
@@ -359,6 +362,8 @@ namespace internal {
      V8.GCCompactorCausedByOldspaceExhaustion)                                 \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
+  SC(number_string_cache_hits, V8.NumberStringCacheHits)                       \
+  SC(number_string_cache_misses, V8.NumberStringCacheMisses)                   \
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
@@ -9,6 +9,7 @@
 
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/common/assert-scope.h"
@@ -19,6 +20,7 @@
 #include "src/objects/string-inl.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-stream.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
 namespace v8 {
@@ -51,13 +53,112 @@ bool LogFile::IsLoggingToTemporaryFile(std::string file_name) {
   return file_name.compare(LogFile::kLogToTemporaryFile) == 0;
 }
 
+// The background writer removes complete log lines from a circular buffer and
+// writes them to the log file. Producers append lines under the log mutex and
+// never wait on file I/O; when the buffer is full, lines are dropped and the
+// number of dropped lines is recorded at the end of the log.
+class LogFile::BackgroundWriter final : public base::Thread {
+ public:
+  explicit BackgroundWriter(FILE* output)
+      : base::Thread(Options("v8:LogWriter")),
+        output_(output),
+        buffer_(NewArray<char>(kBufferSize)),
+        buffer_semaphore_(0) {}
+
+  // Appends a complete line to the buffer. Called with the log mutex held.
+  void Enqueue(const std::string& line) {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    if (line.size() > kBufferSize - (head - tail)) {
+      dropped_lines_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    const size_t pos = head % kBufferSize;
+    const size_t chunk = std::min(line.size(), kBufferSize - pos);
+    MemCopy(buffer_.get() + pos, line.data(), chunk);
+    MemCopy(buffer_.get(), line.data() + chunk, line.size() - chunk);
+    head_.store(head + line.size(), std::memory_order_release);
+    buffer_semaphore_.Signal();  // Tell we have data.
+  }
+
+  void Run() override {
+    for (;;) {
+      buffer_semaphore_.Wait();  // Wait for data.
+      Drain();
+      if (stopped_.load(std::memory_order_acquire)) return;
+    }
+  }
+
+  // Terminates the writer thread and flushes the remaining buffer contents.
+  void Stop() {
+    stopped_.store(true, std::memory_order_release);
+    buffer_semaphore_.Signal();
+    Join();
+    Drain();
+    const size_t dropped = dropped_lines_.load(std::memory_order_relaxed);
+    if (dropped > 0) {
+      base::OS::FPrint(output_, "log-buffer-dropped-lines,%zu\n", dropped);
+    }
+  }
+
+ private:
+  static constexpr size_t kBufferSize = MB;
+
+  void Drain() {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    const size_t head = head_.load(std::memory_order_acquire);
+    while (tail != head) {
+      const size_t pos = tail % kBufferSize;
+      const size_t chunk = std::min(head - tail, kBufferSize - pos);
+      USE(fwrite(buffer_.get() + pos, 1, chunk, output_));
+      tail += chunk;
+      tail_.store(tail, std::memory_order_release);
+    }
+    fflush(output_);
+  }
+
+  FILE* const output_;
+  std::unique_ptr<char[]> buffer_;
+  // Positions are monotonic byte counts; buffer offsets are taken modulo
+  // kBufferSize. head_ is only written by producers (under the log mutex),
+  // tail_ only by the writer thread.
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<size_t> dropped_lines_{0};
+  // Semaphore used for buffer synchronization.
+  base::Semaphore buffer_semaphore_;
+  // Tells the writer thread to finish up and exit.
+  std::atomic<bool> stopped_{false};
+};
+
+std::streambuf::int_type LogFile::LineBuffer::overflow(int_type c) {
+  if (c != traits_type::eof()) line_.push_back(static_cast<char>(c));
+  return traits_type::not_eof(c);
+}
+
+std::streamsize LogFile::LineBuffer::xsputn(const char* s, std::streamsize n) {
+  line_.append(s, static_cast<size_t>(n));
+  return n;
+}
+
 LogFile::LogFile(V8FileLogger* logger, std::string file_name)
     : logger_(logger),
       file_name_(file_name),
       output_handle_(LogFile::CreateOutputHandle(file_name)),
-      os_(output_handle_ == nullptr ? stdout : output_handle_),
+      file_buf_(output_handle_ == nullptr ? stdout : output_handle_),
+      os_(&file_buf_),
       format_buffer_(NewArray<char>(kMessageBufferSize)) {
-  if (output_handle_) WriteLogHeader();
+  if (output_handle_ == nullptr) return;
+  if (v8_flags.log_buffering) {
+    background_writer_ = std::make_unique<BackgroundWriter>(output_handle_);
+    os_.rdbuf(&line_buffer_);
+    CHECK(background_writer_->Start());
+  }
+  WriteLogHeader();
+}
+
+LogFile::~LogFile() {
+  if (background_writer_) background_writer_->Stop();
 }
 
 void LogFile::WriteLogHeader() {
@@ -93,6 +194,10 @@ std::unique_ptr<LogFile::MessageBuilder> LogFile::NewMessageBuilder() {
 }
 
 FILE* LogFile::Close() {
+  if (background_writer_) {
+    background_writer_->Stop();
+    background_writer_.reset();
+  }
   FILE* result = nullptr;
   if (output_handle_ != nullptr) {
     fflush(output_handle_);
@@ -193,7 +298,7 @@ void LogFile::MessageBuilder::AppendCharacter(char c) {
 
 void LogFile::MessageBuilder::AppendSymbolName(Tagged<Symbol> symbol) {
   DCHECK(!symbol.is_null());
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   os << "symbol(";
   if (!IsUndefined(symbol->description())) {
     os << "\"";
@@ -208,7 +313,7 @@ void LogFile::MessageBuilder::AppendSymbolNameDetails(Tagged<String> str,
   if (str.is_null()) return;
 
   DisallowGarbageCollection no_gc;  // Ensure string stays valid.
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   int limit = str->length();
   if (limit > 0x1000) limit = 0x1000;
   if (show_impl_info) {
@@ -249,7 +354,15 @@ void LogFile::MessageBuilder::AppendRawString(const char* str) {
 
 void LogFile::MessageBuilder::AppendRawCharacter(char c) { log_->os_ << c; }
 
-void LogFile::MessageBuilder::WriteToLogFile() { log_->os_ << std::endl; }
+void LogFile::MessageBuilder::WriteToLogFile() {
+  if (log_->background_writer_) {
+    log_->os_ << '\n';
+    log_->background_writer_->Enqueue(log_->line_buffer_.line());
+    log_->line_buffer_.Reset();
+  } else {
+    log_->os_ << std::endl;
+  }
+}
 
 template <>
 LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<const char*>(
@@ -261,7 +374,7 @@ LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<const char*>(
 template <>
 LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<void*>(
     void* pointer) {
-  OFStream& os = log_->os_;
+  std::ostream& os = log_->os_;
   // Manually format the pointer since on Windows we do not consistently
   // get a "0x" prefix.
   os << "0x" << std::hex << reinterpret_cast<intptr_t>(pointer) << std::dec;
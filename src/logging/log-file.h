@@ -10,6 +10,7 @@
 #include <atomic>
 #include <cstdarg>
 #include <memory>
+#include <string>
 
 #include "src/base/compiler-specific.h"
 #include "src/base/optional.h"
@@ -36,6 +37,7 @@ enum class LogSeparator { kSeparator };
 class LogFile {
  public:
   explicit LogFile(V8FileLogger* logger, std::string log_file_name);
+  ~LogFile();
 
   V8_EXPORT_PRIVATE static bool IsLoggingToConsole(std::string file_name);
   V8_EXPORT_PRIVATE static bool IsLoggingToTemporaryFile(std::string file_name);
@@ -109,6 +111,26 @@ class LogFile {
   std::unique_ptr<LogFile::MessageBuilder> NewMessageBuilder();
 
  private:
+  // Collects the bytes of the log line under construction so that complete
+  // lines can be handed to the background writer in one piece. Only used with
+  // --log-buffering; mutex_ should be acquired before using it.
+  class LineBuffer final : public std::streambuf {
+   public:
+    const std::string& line() const { return line_; }
+    void Reset() { line_.clear(); }
+
+   protected:
+    int_type overflow(int_type c) override;
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+   private:
+    std::string line_;
+  };
+
+  // Writes buffered log lines to the log file on a dedicated thread; see the
+  // class comment in log-file.cc.
+  class BackgroundWriter;
+
   static FILE* CreateOutputHandle(std::string file_name);
   base::Mutex* mutex() { return &mutex_; }
 
@@ -122,7 +144,12 @@ class LogFile {
   // destination.  mutex_ should be acquired before using output_handle_.
   FILE* output_handle_;
 
-  OFStream os_;
+  OFStreamBase file_buf_;
+  LineBuffer line_buffer_;
+
+  // Streams into line_buffer_ when --log-buffering is active, and directly
+  // into file_buf_ otherwise.
+  std::ostream os_;
 
   // mutex_ is a Mutex used for enforcing exclusive
   // access to the formatting buffer and the log file or log memory buffer.
@@ -132,6 +159,10 @@ class LogFile {
   // mutex_ should be acquired before using it.
   std::unique_ptr<char[]> format_buffer_;
 
+  // Drains buffered log lines to output_handle_; null unless --log-buffering
+  // is active.
+  std::unique_ptr<BackgroundWriter> background_writer_;
+
   friend class V8FileLogger;
 };
 
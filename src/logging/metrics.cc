@@ -5,6 +5,7 @@
 #include "src/logging/metrics.h"
 
 #include "include/v8-platform.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -54,7 +55,9 @@ void Recorder::Delay(std::unique_ptr<Recorder::DelayedEventBase>&& event) {
   delayed_events_.push(std::move(event));
   if (was_empty) {
     foreground_task_runner_->PostDelayedTask(
-        std::make_unique<Task>(shared_from_this()), 1.0);
+        std::make_unique<Task>(shared_from_this()),
+        v8_flags.metrics_flush_interval_ms /
+            static_cast<double>(base::Time::kMillisecondsPerSecond));
   }
 }
 
@@ -17,6 +17,16 @@ namespace internal {
 
 base::TimeTicks (*RuntimeCallTimer::Now)() = &base::TimeTicks::Now;
 
+int RuntimeCallTimer::sampling_interval_ = 0;
+
+// static
+bool RuntimeCallTimer::SampleNextTopLevelScope() {
+  thread_local int scopes_until_sample = 0;
+  if (--scopes_until_sample > 0) return false;
+  scopes_until_sample = sampling_interval_;
+  return true;
+}
+
 base::TimeTicks RuntimeCallTimer::NowCPUTime() {
   base::ThreadTicks ticks = base::ThreadTicks::Now();
   return base::TimeTicks::FromInternalValue(ticks.ToInternalValue());
@@ -117,6 +127,9 @@ void RuntimeCallCounter::Add(RuntimeCallCounter* other) {
 }
 
 void RuntimeCallTimer::Snapshot() {
+  // In sampled mode the current activation may not be timed at all; in that
+  // case there is nothing to commit.
+  if (!IsStarted()) return;
   base::TimeTicks now = Now();
   // Pause only / topmost timer in the timer stack.
   Pause(now);
@@ -162,6 +175,9 @@ RuntimeCallStats::RuntimeCallStats(ThreadType thread_type)
     base::ThreadTicks::WaitUntilInitialized();
     RuntimeCallTimer::Now = &RuntimeCallTimer::NowCPUTime;
   }
+  if (v8_flags.rcs_sampling_interval > 0) {
+    RuntimeCallTimer::sampling_interval_ = v8_flags.rcs_sampling_interval;
+  }
 }
 
 namespace {
@@ -73,6 +73,16 @@ class RuntimeCallTimer final {
         v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING) {
       return;
     }
+    if (V8_UNLIKELY(sampling_interval_ > 0)) {
+      // Sampled mode: every scope is counted in Stop(), but timestamps are
+      // only taken for 1/N of the top-level scopes. Nested scopes inherit
+      // the decision from their parent (a timed parent is the one that is
+      // currently running), so a whole activation is either timed or not and
+      // the own-time bookkeeping below stays consistent.
+      bool timed = parent != nullptr ? parent->IsStarted()
+                                     : SampleNextTopLevelScope();
+      if (!timed) return;
+    }
     base::TimeTicks now = RuntimeCallTimer::Now();
     if (parent) parent->Pause(now);
     Resume(now);
@@ -82,7 +92,14 @@ class RuntimeCallTimer final {
   void Snapshot();
 
   inline RuntimeCallTimer* Stop() {
-    if (!IsStarted()) return parent();
+    if (!IsStarted()) {
+      // In sampled mode, scopes that did not take timestamps still count
+      // their call.
+      if (V8_UNLIKELY(sampling_interval_ > 0) && counter_ != nullptr) {
+        counter_->Increment();
+      }
+      return parent();
+    }
     base::TimeTicks now = RuntimeCallTimer::Now();
     Pause(now);
     counter_->Increment();
@@ -101,6 +118,14 @@ class RuntimeCallTimer final {
   // Helper to switch over to CPU time.
   static base::TimeTicks NowCPUTime();
 
+  // Non-zero when --rcs-sampling-interval is in use; set up alongside the
+  // time source in the RuntimeCallStats constructor.
+  V8_EXPORT_PRIVATE static int sampling_interval_;
+
+  // Returns true for one out of every sampling_interval_ calls on each
+  // thread.
+  V8_EXPORT_PRIVATE static bool SampleNextTopLevelScope();
+
  private:
   inline void Pause(base::TimeTicks now) {
     DCHECK(IsStarted());
@@ -114,7 +139,12 @@ class RuntimeCallTimer final {
   }
 
   inline void CommitTimeToCounter() {
-    counter_->Add(elapsed_);
+    if (V8_UNLIKELY(sampling_interval_ > 0)) {
+      // Each timed scope stands in for sampling_interval_ occurrences.
+      counter_->Add(elapsed_ * sampling_interval_);
+    } else {
+      counter_->Add(elapsed_);
+    }
     elapsed_ = base::TimeDelta();
   }
 
@@ -139,10 +169,12 @@ class RuntimeCallTimer final {
   V(Array_Iterate)                                         \
   V(Array_New)                                             \
   V(BigInt64Array_New)                                     \
+  V(BigInt64Array_NewBatch)                                \
   V(BigInt_NewFromWords)                                   \
   V(BigIntObject_BigIntValue)                              \
   V(BigIntObject_New)                                      \
   V(BigUint64Array_New)                                    \
+  V(BigUint64Array_NewBatch)                               \
   V(BooleanObject_BooleanValue)                            \
   V(BooleanObject_New)                                     \
   V(Context_DeepFreeze)                                    \
@@ -158,7 +190,9 @@ class RuntimeCallTimer final {
   V(Error_New)                                             \
   V(External_New)                                          \
   V(Float32Array_New)                                      \
+  V(Float32Array_NewBatch)                                 \
   V(Float64Array_New)                                      \
+  V(Float64Array_NewBatch)                                 \
   V(Function_Call)                                         \
   V(Function_New)                                          \
   V(Function_FunctionProtoToString)                        \
@@ -169,11 +203,15 @@ class RuntimeCallTimer final {
   V(FunctionTemplate_NewWithCache)                         \
   V(FunctionTemplate_NewWithFastHandler)                   \
   V(Int16Array_New)                                        \
+  V(Int16Array_NewBatch)                                   \
   V(Int32Array_New)                                        \
+  V(Int32Array_NewBatch)                                   \
   V(Int8Array_New)                                         \
+  V(Int8Array_NewBatch)                                    \
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_ParseStreamed)                                    \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
@@ -269,6 +307,7 @@ class RuntimeCallTimer final {
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
   V(String_NewFromUtf8Literal)                             \
+  V(String_NewSubStrings)                                  \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
@@ -281,9 +320,13 @@ class RuntimeCallTimer final {
   V(TryCatch_StackTrace)                                   \
   V(TypeError_New)                                         \
   V(Uint16Array_New)                                       \
+  V(Uint16Array_NewBatch)                                  \
   V(Uint32Array_New)                                       \
+  V(Uint32Array_NewBatch)                                  \
   V(Uint8Array_New)                                        \
+  V(Uint8Array_NewBatch)                                   \
   V(Uint8ClampedArray_New)                                 \
+  V(Uint8ClampedArray_NewBatch)                            \
   V(UnboundModuleScript_GetSourceMappingURL)               \
   V(UnboundModuleScript_GetSourceURL)                      \
   V(UnboundScript_GetColumnNumber)                         \
@@ -491,6 +534,7 @@ class RuntimeCallTimer final {
   V(Map_TransitionToAccessorProperty)          \
   V(Map_TransitionToDataProperty)              \
   V(MessageListenerCallback)                   \
+  V(NamedBulkGetterCallback)                   \
   V(NamedDefinerCallback)                      \
   V(NamedDeleterCallback)                      \
   V(NamedDescriptorCallback)                   \
@@ -563,6 +607,7 @@ class RuntimeCallTimer final {
   V(LoadIC_LoadNonMaskingInterceptorDH)           \
   V(LoadIC_LoadNormalDH)                          \
   V(LoadIC_LoadNormalFromPrototypeDH)             \
+  V(LoadIC_LoadProxyGetTrapDH)                    \
   V(LoadIC_NonReceiver)                           \
   V(LoadIC_SlowStub)                              \
   V(LoadIC_StringLength)                          \
@@ -1691,6 +1691,12 @@ Handle<DeoptimizationData> MaglevCodeGenerator::GenerateDeoptimizationData(
 
   Handle<DeoptimizationFrameTranslation> translations =
       frame_translation_builder_.ToFrameTranslation(local_isolate->factory());
+  // The translation cache is only accessible from the main thread; background
+  // code generation keeps its private translation array.
+  if (v8_flags.share_frame_translations && local_isolate->is_main_thread()) {
+    translations = FrameTranslationCache::Canonicalize(
+        local_isolate->GetMainThreadIsolateUnsafe(), translations);
+  }
   {
     DisallowGarbageCollection no_gc;
     Tagged<DeoptimizationData> raw_data = *data;
@@ -350,11 +350,21 @@ void MaglevConcurrentDispatcher::EnqueueJob(
     std::unique_ptr<MaglevCompilationJob>&& job) {
   DCHECK(is_enabled());
   incoming_queue_.Enqueue(std::move(job));
-  job_handle_->NotifyConcurrencyIncrease();
+  // Under tier-up spikes thousands of jobs arrive back to back, and waking
+  // the platform scheduler for each of them dominates dispatch cost. Since
+  // running workers drain the queue without further notifications and
+  // GetMaxConcurrency always reflects the full queue size, it suffices to
+  // notify for the first queued job (to get a worker running at all) and
+  // then once per batch (to let the scheduler ramp up the worker count).
+  size_t queued = incoming_queue_.size();
+  if (queued <= 1 || queued % kConcurrencyNotificationBatchSize == 0) {
+    job_handle_->NotifyConcurrencyIncrease();
+  }
 }
 
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
+  bool reenqueued_for_destruction = false;
   while (!outgoing_queue_.IsEmpty()) {
     std::unique_ptr<MaglevCompilationJob> job;
     outgoing_queue_.Dequeue(&job);
@@ -367,9 +377,10 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
     job->DisposeOnMainThread(isolate_);
     if (v8_flags.maglev_destroy_on_background) {
       // Maglev jobs aren't cheap to destruct, so re-enqueue them for
-      // destruction on a background thread.
+      // destruction on a background thread. Notify the scheduler once after
+      // the loop instead of per job.
       destruction_queue_.Enqueue(std::move(job));
-      job_handle_->NotifyConcurrencyIncrease();
+      reenqueued_for_destruction = true;
     } else {
       TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                              "V8.MaglevDestruct", job->trace_id(),
@@ -377,6 +388,9 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
       job.reset();
     }
   }
+  if (reenqueued_for_destruction) {
+    job_handle_->NotifyConcurrencyIncrease();
+  }
 }
 
 void MaglevConcurrentDispatcher::AwaitCompileJobs() {
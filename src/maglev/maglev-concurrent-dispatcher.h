@@ -117,6 +117,10 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
 
  private:
+  // How many enqueued jobs may share one NotifyConcurrencyIncrease call when
+  // tier-up promotes functions in batches, see EnqueueJob.
+  static constexpr size_t kConcurrencyNotificationBatchSize = 8;
+
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
   QueueT incoming_queue_;
@@ -90,6 +90,11 @@ ValueNode* TryGetParentContext(ValueNode* node) {
     return n->context().node();
   }
 
+  if (InlinedCreateFunctionContext* n =
+          node->TryCast<InlinedCreateFunctionContext>()) {
+    return n->context().node();
+  }
+
   if (CallRuntime* n = node->TryCast<CallRuntime>()) {
     switch (n->function_id()) {
       case Runtime::kPushBlockContext:
@@ -681,7 +686,8 @@ MaglevGraphBuilder::MaglevGraphBuilder(LocalIsolate* local_isolate,
                       ? bytecode_analysis_.osr_entry_point()
                       : 0),
       inlining_id_(inlining_id),
-      catch_block_stack_(zone()) {
+      catch_block_stack_(zone()),
+      inlined_array_iterators_(zone()) {
   memset(merge_states_, 0,
          (bytecode().length() + 1) * sizeof(InterpreterFrameState*));
   // Default construct basic block refs.
@@ -5451,6 +5457,15 @@ void MaglevGraphBuilder::VisitDefineKeyedOwnPropertyInLiteral() {
 }
 
 void MaglevGraphBuilder::VisitAdd() { VisitBinaryOperation<Operation::kAdd>(); }
+void MaglevGraphBuilder::VisitLdarAdd() {
+  // Fused Ldar+Add superinstruction. Replay the Ldar, which is just an
+  // interpreter-frame update during graph building, and reuse the Add
+  // lowering, which takes its right operand from the accumulator. The first
+  // two operands of LdarAdd match Add's layout.
+  MoveNodeBetweenRegisters(iterator_.GetRegisterOperand(2),
+                           interpreter::Register::virtual_accumulator());
+  VisitAdd();
+}
 void MaglevGraphBuilder::VisitSub() {
   VisitBinaryOperation<Operation::kSubtract>();
 }
@@ -6249,6 +6264,187 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   return GetRootConstant(RootIndex::kUndefinedValue);
 }
 
+ReduceResult MaglevGraphBuilder::BuildInlinedArrayIterator(
+    ValueNode* receiver) {
+  // The default %ArrayProto_values% works on any JSReceiver; primitive
+  // receivers would have to be boxed first, so leave those to the builtin.
+  BuildCheckJSReceiver(receiver);
+
+  compiler::MapRef iterator_map =
+      broker()->target_native_context().initial_array_iterator_map(broker());
+  ValueNode* iterator = ExtendOrReallocateCurrentRawAllocation(
+      iterator_map.instance_size(), AllocationType::kYoung);
+  BuildStoreReceiverMap(iterator, iterator_map);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {iterator, GetRootConstant(RootIndex::kEmptyFixedArray)},
+      JSObject::kPropertiesOrHashOffset);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {iterator, GetRootConstant(RootIndex::kEmptyFixedArray)},
+      JSObject::kElementsOffset);
+  BuildStoreTaggedField(iterator, receiver,
+                        JSArrayIterator::kIteratedObjectOffset);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {iterator, GetSmiConstant(0)}, JSArrayIterator::kNextIndexOffset);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {iterator, GetSmiConstant(static_cast<int>(IterationKind::kValues))},
+      JSArrayIterator::kKindOffset);
+  ClearCurrentRawAllocation();
+  // Remember which object this iterator walks over, so that calls to
+  // %ArrayIteratorPrototype%.next on it can be reduced to indexed loads.
+  inlined_array_iterators_[iterator] = receiver;
+  return iterator;
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayIteratorPrototypeNext(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // We can't reduce Function#call when there is no receiver function.
+  if (args.receiver_mode() == ConvertReceiverMode::kNullOrUndefined) {
+    return ReduceResult::Fail();
+  }
+
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+
+  // Only iterators materialized by BuildInlinedArrayIterator are known to be
+  // default "values" iterators over a tracked object.
+  auto it = inlined_array_iterators_.find(receiver);
+  if (it == inlined_array_iterators_.end()) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce ArrayIterator.prototype.next - "
+                   "iterator was not allocated in this graph"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+  ValueNode* iterated_object = it->second;
+
+  auto node_info = known_node_aspects().TryGetInfoFor(iterated_object);
+  if (!node_info || !node_info->possible_maps_are_known()) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce ArrayIterator.prototype.next - "
+                   "iterated object map is unknown"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+  const PossibleMaps& possible_maps = node_info->possible_maps();
+  if (possible_maps.is_empty()) {
+    return ReduceResult::DoneWithAbort();
+  }
+
+  ElementsKind elements_kind;
+  if (!CanInlineArrayIteratingBuiltin(broker(), possible_maps,
+                                      &elements_kind)) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce ArrayIterator.prototype.next - "
+                   "iterated object doesn't support fast array iteration"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+  // Holes are read as undefined, which is only valid as long as the
+  // prototype chain has no elements.
+  if (IsHoleyElementsKind(elements_kind) &&
+      !broker()->dependencies()->DependOnNoElementsProtector()) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce ArrayIterator.prototype.next - "
+                   "invalidated no elements protector"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  // The [[NextIndex]] is a Smi while the iterator is live; exhausting the
+  // iterator stores kMaxUInt32 (matching the builtin), so compare as
+  // Float64 rather than deopting on the sentinel.
+  ValueNode* index_tagged = AddNewNode<LoadTaggedField>(
+      {receiver}, JSArrayIterator::kNextIndexOffset);
+  ValueNode* index = GetFloat64(index_tagged);
+  ValueNode* length = GetFloat64(BuildLoadJSArrayLength(iterated_object));
+
+  MaglevSubGraphBuilder sub_graph(this, 2);
+  MaglevSubGraphBuilder::Variable var_value(0);
+  MaglevSubGraphBuilder::Variable var_done(1);
+  MaglevSubGraphBuilder::Label done_iterating(&sub_graph, 1);
+  MaglevSubGraphBuilder::Label allocate_result(
+      &sub_graph, 2,
+      std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_value,
+                                                              &var_done});
+
+  sub_graph.GotoIfFalse<BranchIfFloat64Compare>(&done_iterating,
+                                                {index, length},
+                                                Operation::kLessThan);
+
+  // In bounds, so the index is a Smi in Int32 range.
+  ValueNode* index_int32 = AddNewNode<UnsafeTruncateFloat64ToInt32>({index});
+  ValueNode* elements = AddNewNode<LoadTaggedField>({iterated_object},
+                                                    JSObject::kElementsOffset);
+  ValueNode* element;
+  if (elements_kind == HOLEY_DOUBLE_ELEMENTS) {
+    // The HoleyFloat64 representation turns the hole into undefined when the
+    // value is tagged; ConvertHoleToUndefined would not catch a hole NaN
+    // that was already boxed into a HeapNumber.
+    element =
+        AddNewNode<LoadHoleyFixedDoubleArrayElement>({elements, index_int32});
+  } else if (IsDoubleElementsKind(elements_kind)) {
+    element = AddNewNode<LoadFixedDoubleArrayElement>({elements, index_int32});
+  } else {
+    element = AddNewNode<LoadFixedArrayElement>({elements, index_int32});
+    if (IsHoleyElementsKind(elements_kind)) {
+      element = AddNewNode<ConvertHoleToUndefined>({element});
+    }
+  }
+  ValueNode* next_index_int32 =
+      AddNewNode<Int32IncrementWithOverflow>({index_int32});
+  EnsureType(next_index_int32, NodeType::kSmi);
+  ValueNode* next_index_smi;
+  GET_VALUE_OR_ABORT(next_index_smi, GetSmiValue(next_index_int32));
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {receiver, next_index_smi}, JSArrayIterator::kNextIndexOffset);
+  sub_graph.set(var_value, element);
+  sub_graph.set(var_done, GetBooleanConstant(false));
+  sub_graph.Goto(&allocate_result);
+
+  sub_graph.Bind(&done_iterating);
+  // Mark the iterator as exhausted the same way the builtin does: a
+  // [[NextIndex]] of kMaxUInt32 fails the bounds check for any possible
+  // JSArray length, even if the iterated object grows later.
+  BuildStoreTaggedField(receiver,
+                        GetTaggedValue(GetFloat64Constant(kMaxUInt32)),
+                        JSArrayIterator::kNextIndexOffset);
+  sub_graph.set(var_value, GetRootConstant(RootIndex::kUndefinedValue));
+  sub_graph.set(var_done, GetBooleanConstant(true));
+  sub_graph.Goto(&allocate_result);
+
+  sub_graph.Bind(&allocate_result);
+  ValueNode* value = GetTaggedValue(sub_graph.get(var_value));
+  ValueNode* done = sub_graph.get(var_done);
+
+  // Allocate the JSIteratorResult inline and record its fields, so that the
+  // .done/.value loads that follow fold away without touching the
+  // allocation.
+  compiler::MapRef result_map =
+      broker()->target_native_context().iterator_result_map(broker());
+  ValueNode* result = ExtendOrReallocateCurrentRawAllocation(
+      result_map.instance_size(), AllocationType::kYoung);
+  BuildStoreReceiverMap(result, result_map);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {result, GetRootConstant(RootIndex::kEmptyFixedArray)},
+      JSObject::kPropertiesOrHashOffset);
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {result, GetRootConstant(RootIndex::kEmptyFixedArray)},
+      JSObject::kElementsOffset);
+  BuildStoreTaggedField(result, value, JSIteratorResult::kValueOffset);
+  BuildStoreTaggedField(result, done, JSIteratorResult::kDoneOffset);
+  ClearCurrentRawAllocation();
+  if (!value->properties().is_conversion()) {
+    RecordKnownProperty(result, broker()->value_string(), value, false,
+                        compiler::AccessMode::kLoad);
+  }
+  RecordKnownProperty(result, broker()->done_string(), done, false,
+                      compiler::AccessMode::kLoad);
+  return result;
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceStringFromCharCode(
     compiler::JSFunctionRef target, CallArguments& args) {
   if (args.count() != 1) return ReduceResult::Fail();
@@ -6256,6 +6452,46 @@ ReduceResult MaglevGraphBuilder::TryReduceStringFromCharCode(
       args[0], ToNumberHint::kAssumeNumberOrOddball)});
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceStringPrototypeCharAt(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+  ValueNode* index;
+  if (args.count() == 0) {
+    // Index is the undefined object. ToIntegerOrInfinity(undefined) = 0.
+    index = GetInt32Constant(0);
+  } else {
+    index = GetInt32ElementIndex(args[0]);
+  }
+  // Any other argument is ignored.
+
+  // Try to constant-fold if receiver and index are constant
+  if (auto cst = TryGetConstant(receiver)) {
+    if (cst->IsString() && index->Is<Int32Constant>()) {
+      compiler::StringRef str = cst->AsString();
+      int idx = index->Cast<Int32Constant>()->value();
+      if (idx >= 0 && idx < str.length()) {
+        if (compiler::OptionalObjectRef value =
+                str.GetCharAsStringOrUndefined(broker(), idx)) {
+          return GetConstant(*value);
+        }
+      }
+    }
+  }
+
+  // Ensure that {receiver} is actually a String.
+  BuildCheckString(receiver);
+  // And index is below length.
+  ValueNode* length = AddNewNode<StringLength>({receiver});
+  AddNewNode<CheckInt32Condition>({index, length},
+                                  AssertCondition::kUnsignedLessThan,
+                                  DeoptimizeReason::kOutOfBounds);
+  ValueNode* char_code =
+      AddNewNode<BuiltinStringPrototypeCharCodeOrCodePointAt>(
+          {receiver, index},
+          BuiltinStringPrototypeCharCodeOrCodePointAt::kCharCodeAt);
+  return AddNewNode<BuiltinStringFromCharCode>({char_code});
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceStringPrototypeCharCodeAt(
     compiler::JSFunctionRef target, CallArguments& args) {
   ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
@@ -6370,6 +6606,89 @@ ReduceResult MaglevGraphBuilder::TryReduceStringPrototypeLocaleCompare(
 #endif
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceStringPrototypeIndexOf(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (args.count() != 1) return ReduceResult::Fail();
+  // Only reduce when the search element is a known string, so that no
+  // observable ToString conversion is skipped.
+  compiler::OptionalHeapObjectRef maybe_search = TryGetConstant(args[0]);
+  if (!maybe_search || !maybe_search->IsString()) return ReduceResult::Fail();
+
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+  // Ensure that {receiver} is actually a String.
+  BuildCheckString(receiver);
+  // With a string receiver, a string search element and no position, the
+  // generic builtin reduces to the string search itself; call it directly,
+  // skipping the conversions and the argument adaptation of the JS builtin.
+  return BuildCallBuiltin<Builtin::kStringIndexOf>(
+      {receiver, GetTaggedValue(args[0]), GetSmiConstant(0)});
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceStringPrototypeStartsWith(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // Only the no-position case is supported for now.
+  if (args.count() != 1) return ReduceResult::Fail();
+  compiler::OptionalHeapObjectRef maybe_search = TryGetConstant(args[0]);
+  if (!maybe_search || !maybe_search->IsString()) return ReduceResult::Fail();
+  compiler::StringRef search = maybe_search->AsString();
+  if (!search.IsContentAccessible()) return ReduceResult::Fail();
+  // Like TurboFan (JSCallReducer::kMaxInlineMatchSequence), only match short
+  // literals inline; everything else keeps calling the builtin.
+  constexpr int kMaxInlineMatchSequence = 3;
+  int search_length = search.length();
+  if (search_length > kMaxInlineMatchSequence) {
+    return ReduceResult::Fail();
+  }
+  base::SmallVector<uint16_t, 4> search_chars;
+  for (int i = 0; i < search_length; i++) {
+    base::Optional<uint16_t> c = search.GetChar(broker(), i);
+    if (!c) return ReduceResult::Fail();
+    search_chars.push_back(*c);
+  }
+
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+  // Ensure that {receiver} is actually a String.
+  BuildCheckString(receiver);
+  // Every string starts with the empty string.
+  if (search_length == 0) return GetBooleanConstant(true);
+
+  ValueNode* length = AddNewNode<StringLength>({receiver});
+
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable var_result(0);
+  // {no_match} is reached from the length check and from each character
+  // comparison.
+  MaglevSubGraphBuilder::Label no_match(&sub_graph, search_length + 1);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, 2,
+      std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_result});
+
+  // A receiver shorter than the search string cannot start with it.
+  sub_graph.GotoIfFalse<BranchIfInt32Compare>(
+      &no_match, {GetInt32Constant(search_length), length},
+      Operation::kLessThanOrEqual);
+  // Compare the search string character by character; the length check above
+  // keeps all indexes in bounds.
+  for (int i = 0; i < search_length; i++) {
+    ValueNode* char_code =
+        AddNewNode<BuiltinStringPrototypeCharCodeOrCodePointAt>(
+            {receiver, GetInt32Constant(i)},
+            BuiltinStringPrototypeCharCodeOrCodePointAt::kCharCodeAt);
+    sub_graph.GotoIfFalse<BranchIfInt32Compare>(
+        &no_match, {char_code, GetInt32Constant(search_chars[i])},
+        Operation::kEqual);
+  }
+  sub_graph.set(var_result, GetBooleanConstant(true));
+  sub_graph.Goto(&done);
+
+  sub_graph.Bind(&no_match);
+  sub_graph.set(var_result, GetBooleanConstant(false));
+  sub_graph.Goto(&done);
+
+  sub_graph.Bind(&done);
+  return sub_graph.get(var_result);
+}
+
 template <typename LoadNode>
 ReduceResult MaglevGraphBuilder::TryBuildLoadDataView(const CallArguments& args,
                                                       ExternalArrayType type) {
@@ -6890,6 +7209,34 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayPrototypePop(
   return sub_graph.get(var_value);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeValues(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // We can't reduce Function#call when there is no receiver function.
+  if (args.receiver_mode() == ConvertReceiverMode::kNullOrUndefined) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce Array.prototype.values - no receiver"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+
+  // Unconditionally checking for a JSReceiver here could cause a deopt loop
+  // for primitive receivers (which the builtin boxes), so only reduce when
+  // the receiver is already known to be a JSReceiver.
+  if (!CheckType(receiver, NodeType::kJSReceiver)) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce Array.prototype.values - receiver "
+                   "not known to be a JSReceiver"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  return BuildInlinedArrayIterator(receiver);
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceFunctionPrototypeHasInstance(
     compiler::JSFunctionRef target, CallArguments& args) {
   // We can't reduce Function#hasInstance when there is no receiver function.
@@ -7555,6 +7902,54 @@ ReduceResult MaglevGraphBuilder::ReduceCallForTarget(
   return ReduceCallForConstant(target, args, feedback_source, speculation_mode);
 }
 
+ReduceResult MaglevGraphBuilder::ReduceCallForBoundFunction(
+    ValueNode* target_node, compiler::JSBoundFunctionRef target,
+    CallArguments& args, const compiler::FeedbackSource& feedback_source,
+    SpeculationMode speculation_mode) {
+  // The bound arguments have to be spliced in front of the dynamic ones,
+  // which we only know how to do for default calls.
+  if (args.mode() != CallArguments::kDefault) {
+    // TODO(victorgomes): Maybe inline the spread stub? Or call known function
+    // directly if arguments list is an array.
+    return ReduceResult::Fail();
+  }
+
+  // Collect the bound arguments up front, so that a missing one leaves the
+  // graph untouched.
+  compiler::FixedArrayRef bound_arguments = target.bound_arguments(broker());
+  int bound_argument_count = bound_arguments.length();
+  base::SmallVector<ValueNode*, 8> new_args;
+  compiler::ObjectRef bound_this = target.bound_this(broker());
+  ConvertReceiverMode receiver_mode;
+  if (bound_this.IsNullOrUndefined()) {
+    receiver_mode = ConvertReceiverMode::kNullOrUndefined;
+  } else {
+    receiver_mode = ConvertReceiverMode::kNotNullOrUndefined;
+    new_args.push_back(GetConstant(bound_this));
+  }
+  for (int i = 0; i < bound_argument_count; i++) {
+    compiler::OptionalObjectRef bound_arg =
+        bound_arguments.TryGet(broker(), i);
+    if (!bound_arg.has_value()) return ReduceResult::Fail();
+    new_args.push_back(GetConstant(bound_arg.value()));
+  }
+  for (size_t i = 0; i < args.count(); i++) {
+    new_args.push_back(args[i]);
+  }
+
+  RETURN_IF_ABORT(BuildCheckValue(target_node, target));
+
+  // All [[Bound*]] fields are immutable, so once the target is checked we can
+  // call the bound target function with the constant-folded receiver and
+  // prefix arguments directly. Reducing the new call also flattens nested
+  // bind chains.
+  compiler::JSReceiverRef bound_target_function =
+      target.bound_target_function(broker());
+  CallArguments new_call_args(receiver_mode, std::move(new_args));
+  return ReduceCall(GetConstant(bound_target_function), new_call_args,
+                    feedback_source, speculation_mode);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallForNewClosure(
     ValueNode* target_node, ValueNode* target_context,
     compiler::SharedFunctionInfoRef shared,
@@ -7665,6 +8060,11 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
           ReduceCallForTarget(target_node, maybe_constant->AsJSFunction(), args,
                               feedback_source, speculation_mode);
       RETURN_IF_DONE(result);
+    } else if (maybe_constant->IsJSBoundFunction()) {
+      ReduceResult result = ReduceCallForBoundFunction(
+          target_node, maybe_constant->AsJSBoundFunction(), args,
+          feedback_source, speculation_mode);
+      RETURN_IF_DONE(result);
     }
   }
 
@@ -7768,6 +8168,79 @@ void MaglevGraphBuilder::VisitCallUndefinedReceiver2() {
   BuildCallFromRegisters(2, ConvertReceiverMode::kNullOrUndefined);
 }
 
+ReduceResult MaglevGraphBuilder::TryRewriteSpreadAsDirectArguments(
+    CallArguments& args) {
+  DCHECK_EQ(args.mode(), CallArguments::kWithSpread);
+  ValueNode* spread = args[args.count() - 1];
+
+  // We only know the shape of the spread array if it was created by an array
+  // literal whose allocation site has a boilerplate.
+  // TODO(victorgomes): Support literals that were lowered to inlined
+  // allocations by TryBuildFastCreateObjectOrArrayLiteral.
+  compiler::FeedbackSource array_feedback;
+  if (CreateShallowArrayLiteral* n =
+          spread->TryCast<CreateShallowArrayLiteral>()) {
+    array_feedback = n->feedback();
+  } else if (CreateArrayLiteral* n = spread->TryCast<CreateArrayLiteral>()) {
+    array_feedback = n->feedback();
+  } else {
+    return ReduceResult::Fail();
+  }
+
+  compiler::ProcessedFeedback const& processed_feedback =
+      broker()->GetFeedbackForArrayOrObjectLiteral(array_feedback);
+  if (processed_feedback.IsInsufficient()) return ReduceResult::Fail();
+  compiler::AllocationSiteRef site = processed_feedback.AsLiteral().value();
+  if (!site.boilerplate(broker()).has_value()) return ReduceResult::Fail();
+  compiler::JSArrayRef boilerplate = site.boilerplate(broker())->AsJSArray();
+
+  const int array_length =
+      boilerplate.GetBoilerplateLength(broker()).AsSmi();
+  // Avoid blowing up the arity of the expanded call.
+  static constexpr int kMaxArityForExpandedSpread = 32;
+  if (static_cast<int>(args.count()) - 1 + array_length >
+      kMaxArityForExpandedSpread) {
+    return ReduceResult::Fail();
+  }
+
+  compiler::MapRef map = boilerplate.map(broker());
+  // TODO(victorgomes): Support holey and double elements kinds, like the
+  // equivalent TurboFan reduction does.
+  if (map.elements_kind() != PACKED_SMI_ELEMENTS &&
+      map.elements_kind() != PACKED_ELEMENTS) {
+    return ReduceResult::Fail();
+  }
+  // Spreading goes through the array's iterator, so we have to guarantee that
+  // iterating {spread} just reads the elements in order.
+  if (!map.supports_fast_array_iteration(broker()) ||
+      !broker()->dependencies()->DependOnArrayIteratorProtector() ||
+      !broker()->dependencies()->DependOnNoElementsProtector()) {
+    return ReduceResult::Fail();
+  }
+
+  // The array may have been modified between its creation and the call, so
+  // deopt if its map or length changed and load the elements dynamically.
+  // Packed elements cannot become holey without a map change.
+  RETURN_IF_ABORT(BuildCheckMaps(spread, base::VectorOf({map})));
+  ValueNode* length = BuildLoadJSArrayLength(spread);
+  AddNewNode<CheckInt32Condition>(
+      {GetInt32(length), GetInt32Constant(array_length)},
+      AssertCondition::kEqual, DeoptimizeReason::kArrayLengthChanged);
+  ValueNode* elements =
+      AddNewNode<LoadTaggedField>({spread}, JSObject::kElementsOffset);
+
+  base::SmallVector<ValueNode*, 8> new_args;
+  new_args.push_back(args.receiver());
+  for (size_t i = 0; i < args.count() - 1; i++) {
+    new_args.push_back(args[i]);
+  }
+  for (int i = 0; i < array_length; i++) {
+    new_args.push_back(BuildLoadFixedArrayElement(elements, i));
+  }
+  args = CallArguments(ConvertReceiverMode::kAny, std::move(new_args));
+  return ReduceResult::Done();
+}
+
 void MaglevGraphBuilder::VisitCallWithSpread() {
   ValueNode* function = LoadRegisterTagged(0);
   interpreter::RegisterList reglist = iterator_.GetRegisterListOperand(1);
@@ -7775,6 +8248,10 @@ void MaglevGraphBuilder::VisitCallWithSpread() {
   compiler::FeedbackSource feedback_source(feedback(), slot);
   CallArguments args(ConvertReceiverMode::kAny, reglist,
                      current_interpreter_frame_, CallArguments::kWithSpread);
+  // If the spread array's shape is known from array literal feedback, pass its
+  // elements directly instead of materializing the array for the
+  // CallWithSpread builtin.
+  RETURN_VOID_IF_ABORT(TryRewriteSpreadAsDirectArguments(args));
   BuildCallWithFeedback(function, args, feedback_source);
 }
 
@@ -9325,8 +9802,13 @@ void MaglevGraphBuilder::VisitCreateCatchContext() {
 void MaglevGraphBuilder::VisitCreateFunctionContext() {
   compiler::ScopeInfoRef info = GetRefOperand<ScopeInfo>(0);
   uint32_t slot_count = iterator_.GetUnsignedImmediateOperand(1);
-  SetAccumulator(AddNewNode<CreateFunctionContext>(
-      {GetContext()}, info, slot_count, ScopeType::FUNCTION_SCOPE));
+  if (slot_count <= InlinedCreateFunctionContext::kMaxInlineSlotCount) {
+    SetAccumulator(AddNewNode<InlinedCreateFunctionContext>(
+        {GetContext()}, info, slot_count, ScopeType::FUNCTION_SCOPE));
+  } else {
+    SetAccumulator(AddNewNode<CreateFunctionContext>(
+        {GetContext()}, info, slot_count, ScopeType::FUNCTION_SCOPE));
+  }
 }
 
 void MaglevGraphBuilder::VisitCreateEvalContext() {
@@ -9334,8 +9816,12 @@ void MaglevGraphBuilder::VisitCreateEvalContext() {
   // type.
   compiler::ScopeInfoRef info = GetRefOperand<ScopeInfo>(0);
   uint32_t slot_count = iterator_.GetUnsignedImmediateOperand(1);
-  if (slot_count <= static_cast<uint32_t>(
-                        ConstructorBuiltins::MaximumFunctionContextSlots())) {
+  if (slot_count <= InlinedCreateFunctionContext::kMaxInlineSlotCount) {
+    SetAccumulator(AddNewNode<InlinedCreateFunctionContext>(
+        {GetContext()}, info, slot_count, ScopeType::EVAL_SCOPE));
+  } else if (slot_count <=
+             static_cast<uint32_t>(
+                 ConstructorBuiltins::MaximumFunctionContextSlots())) {
     SetAccumulator(AddNewNode<CreateFunctionContext>(
         {GetContext()}, info, slot_count, ScopeType::EVAL_SCOPE));
   } else {
@@ -10400,14 +10886,90 @@ void MaglevGraphBuilder::VisitResumeGenerator() {
       {generator}, JSGeneratorObject::kInputOrDebugPosOffset));
 }
 
+ReduceResult MaglevGraphBuilder::TryBuildGetIteratorFast(
+    ValueNode* receiver, FeedbackSlot load_slot, FeedbackSlot call_slot) {
+  // Only bother with the fast path when the call feedback says the iterator
+  // method is the default %ArrayProto_values%.
+  compiler::FeedbackSource call_feedback_source{feedback(), call_slot};
+  const compiler::ProcessedFeedback& call_feedback =
+      broker()->GetFeedbackForCall(call_feedback_source);
+  if (call_feedback.IsInsufficient()) return ReduceResult::Fail();
+  DCHECK_EQ(call_feedback.kind(), compiler::ProcessedFeedback::kCall);
+  if (call_feedback.AsCall().speculation_mode() ==
+      SpeculationMode::kDisallowSpeculation) {
+    return ReduceResult::Fail();
+  }
+  compiler::OptionalHeapObjectRef maybe_target =
+      call_feedback.AsCall().target();
+  if (!maybe_target.has_value() || !maybe_target->IsJSFunction()) {
+    return ReduceResult::Fail();
+  }
+  compiler::JSFunctionRef iterator_method = maybe_target->AsJSFunction();
+  compiler::SharedFunctionInfoRef shared = iterator_method.shared(broker());
+  if (!shared.HasBuiltinId() ||
+      shared.builtin_id() != Builtin::kArrayPrototypeValues) {
+    return ReduceResult::Fail();
+  }
+
+  compiler::NameRef name = broker()->iterator_symbol();
+  compiler::FeedbackSource load_feedback_source{feedback(), load_slot};
+  const compiler::ProcessedFeedback& load_feedback =
+      broker()->GetFeedbackForPropertyAccess(
+          load_feedback_source, compiler::AccessMode::kLoad, name);
+  if (load_feedback.kind() != compiler::ProcessedFeedback::kNamedAccess) {
+    return ReduceResult::Fail();
+  }
+  ZoneVector<compiler::MapRef> const& maps =
+      load_feedback.AsNamedAccess().maps();
+  if (maps.empty()) return ReduceResult::Fail();
+
+  // Prove, without emitting the @@iterator load, that looking it up on any of
+  // the maps seen by the load feedback yields exactly the function the call
+  // feedback recorded: it has to be found as a constant data property. This
+  // avoids materializing the iterator method altogether (and in particular
+  // avoids re-running a side-effecting getter should we have to fall back to
+  // the generic GetIterator node).
+  // TODO(v8:11457) Support dictionary mode holders here.
+  for (compiler::MapRef map : maps) {
+    if (!map.IsJSReceiverMap()) return ReduceResult::Fail();
+    compiler::PropertyAccessInfo access_info = broker()->GetPropertyAccessInfo(
+        map, name, compiler::AccessMode::kLoad);
+    if (access_info.IsInvalid() || access_info.HasDictionaryHolder() ||
+        !access_info.IsFastDataConstant() ||
+        access_info.field_representation().IsDouble()) {
+      return ReduceResult::Fail();
+    }
+    compiler::OptionalJSObjectRef holder = access_info.holder();
+    if (!holder.has_value()) return ReduceResult::Fail();
+    compiler::OptionalObjectRef iterator_field =
+        holder->GetOwnFastConstantDataProperty(
+            broker(), access_info.field_representation(),
+            access_info.field_index(), broker()->dependencies());
+    if (!iterator_field.has_value() ||
+        !iterator_field->equals(iterator_method)) {
+      return ReduceResult::Fail();
+    }
+    access_info.RecordDependencies(broker()->dependencies());
+    broker()->dependencies()->DependOnStablePrototypeChains(
+        access_info.lookup_start_object_maps(), kStartAtPrototype,
+        holder.value());
+  }
+
+  RETURN_IF_ABORT(BuildCheckMaps(receiver, base::VectorOf(maps)));
+  return BuildInlinedArrayIterator(receiver);
+}
+
 void MaglevGraphBuilder::VisitGetIterator() {
   // GetIterator <object>
   ValueNode* receiver = LoadRegisterTagged(0);
+  FeedbackSlot load_slot = GetSlotOperand(1);
+  FeedbackSlot call_slot = GetSlotOperand(2);
+  PROCESS_AND_RETURN_IF_DONE(
+      TryBuildGetIteratorFast(receiver, load_slot, call_slot), SetAccumulator);
   ValueNode* context = GetContext();
-  int load_slot = iterator_.GetIndexOperand(1);
-  int call_slot = iterator_.GetIndexOperand(2);
-  SetAccumulator(AddNewNode<GetIterator>({context, receiver}, load_slot,
-                                         call_slot, feedback()));
+  SetAccumulator(AddNewNode<GetIterator>({context, receiver},
+                                         load_slot.ToInt(), call_slot.ToInt(),
+                                         feedback()));
 }
 
 void MaglevGraphBuilder::VisitDebugger() {
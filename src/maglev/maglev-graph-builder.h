@@ -1767,6 +1767,7 @@ class MaglevGraphBuilder {
 
 #define MAGLEV_REDUCED_BUILTIN(V)  \
   V(ArrayForEach)                  \
+  V(ArrayIteratorPrototypeNext)    \
   V(DataViewPrototypeGetInt8)      \
   V(DataViewPrototypeSetInt8)      \
   V(DataViewPrototypeGetInt16)     \
@@ -1783,12 +1784,16 @@ class MaglevGraphBuilder {
   V(MathPow)                       \
   V(ArrayPrototypePush)            \
   V(ArrayPrototypePop)             \
+  V(ArrayPrototypeValues)          \
   V(MathRound)                     \
   V(StringConstructor)             \
   V(StringFromCharCode)            \
+  V(StringPrototypeCharAt)         \
   V(StringPrototypeCharCodeAt)     \
   V(StringPrototypeCodePointAt)    \
+  V(StringPrototypeIndexOf)        \
   V(StringPrototypeLocaleCompare)  \
+  V(StringPrototypeStartsWith)     \
   MATH_UNARY_IEEE_BUILTIN(V)
 
 #define DEFINE_BUILTIN_REDUCER(Name)                           \
@@ -1809,6 +1814,16 @@ class MaglevGraphBuilder {
   ReduceResult DoTryReduceMathRound(CallArguments& args,
                                     Float64Round::Kind kind);
 
+  // Fast path for the GetIterator bytecode when the feedback says the
+  // iterator method is the default %ArrayProto_values%: the iterator is
+  // allocated inline and remembered in {inlined_array_iterators_}, so that
+  // calls to %ArrayIteratorPrototype%.next on it can be reduced to direct
+  // indexed loads.
+  ReduceResult TryBuildGetIteratorFast(ValueNode* receiver,
+                                       FeedbackSlot load_slot,
+                                       FeedbackSlot call_slot);
+  ReduceResult BuildInlinedArrayIterator(ValueNode* receiver);
+
   template <typename CallNode, typename... Args>
   CallNode* AddNewCallNode(const CallArguments& args, Args&&... extra_args);
 
@@ -1849,6 +1864,10 @@ class MaglevGraphBuilder {
       ValueNode* target_node, compiler::JSFunctionRef target,
       CallArguments& args, const compiler::FeedbackSource& feedback_source,
       SpeculationMode speculation_mode);
+  ReduceResult ReduceCallForBoundFunction(
+      ValueNode* target_node, compiler::JSBoundFunctionRef target,
+      CallArguments& args, const compiler::FeedbackSource& feedback_source,
+      SpeculationMode speculation_mode);
   ReduceResult ReduceCallForNewClosure(
       ValueNode* target_node, ValueNode* target_context,
       compiler::SharedFunctionInfoRef shared,
@@ -1874,6 +1893,10 @@ class MaglevGraphBuilder {
       const compiler::FeedbackSource& feedback_source =
           compiler::FeedbackSource(),
       SpeculationMode speculation_mode = SpeculationMode::kDisallowSpeculation);
+  // Tries to replace the spread argument of {args} with direct loads of the
+  // spread array's elements, turning {args} into a default (non-spread) call.
+  // Returns Fail() if the shape of the spread array is not known.
+  ReduceResult TryRewriteSpreadAsDirectArguments(CallArguments& args);
   void BuildCallWithFeedback(ValueNode* target_node, CallArguments& args,
                              const compiler::FeedbackSource& feedback_source);
   void BuildCallFromRegisterList(ConvertReceiverMode receiver_mode);
@@ -2378,6 +2401,11 @@ class MaglevGraphBuilder {
   ZoneStack<HandlerTableEntry> catch_block_stack_;
   int next_handler_table_index_ = 0;
 
+  // Array iterators allocated by BuildInlinedArrayIterator, mapped to the
+  // object they iterate over. Used by TryReduceArrayIteratorPrototypeNext to
+  // turn the iterator protocol into direct indexed loads.
+  ZoneMap<ValueNode*, ValueNode*> inlined_array_iterators_;
+
 #ifdef DEBUG
   bool IsNodeCreatedForThisBytecode(ValueNode* node) const {
     return new_nodes_.find(node) != new_nodes_.end();
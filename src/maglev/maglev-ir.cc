@@ -29,6 +29,7 @@
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-graph-processor.h"
 #include "src/maglev/maglev-ir-inl.h"
+#include "src/objects/contexts.h"
 #include "src/roots/roots.h"
 
 namespace v8 {
@@ -3371,6 +3372,49 @@ void CreateFunctionContext::GenerateCode(MaglevAssembler* masm,
   masm->DefineExceptionHandlerAndLazyDeoptPoint(this);
 }
 
+void InlinedCreateFunctionContext::SetValueLocationConstraints() {
+  DCHECK_LE(slot_count(), kMaxInlineSlotCount);
+  UseRegister(context());
+  DefineAsRegister(this);
+  set_temporaries_needed(1);
+}
+void InlinedCreateFunctionContext::GenerateCode(MaglevAssembler* masm,
+                                                const ProcessingState& state) {
+  MaglevAssembler::ScratchRegisterScope temps(masm);
+  Register scratch = temps.Acquire();
+  Register previous = ToRegister(context());
+  Register new_context = ToRegister(result());
+  const int length =
+      static_cast<int>(slot_count()) + Context::MIN_CONTEXT_SLOTS;
+
+  __ Allocate(register_snapshot(), new_context, Context::SizeFor(length));
+
+  DCHECK(scope_type() == FUNCTION_SCOPE || scope_type() == EVAL_SCOPE);
+  compiler::JSHeapBroker* broker = masm->compilation_info()->broker();
+  compiler::MapRef map =
+      scope_type() == FUNCTION_SCOPE
+          ? masm->native_context().function_context_map(broker)
+          : masm->native_context().eval_context_map(broker);
+
+  // The context was just allocated in new space, so none of the stores below
+  // need a write barrier.
+  __ Move(scratch, map.object());
+  __ StoreTaggedFieldNoWriteBarrier(new_context, HeapObject::kMapOffset,
+                                    scratch);
+  __ StoreTaggedSignedField(new_context, Context::kLengthOffset,
+                            Smi::FromInt(length));
+  __ Move(scratch, scope_info().object());
+  __ StoreTaggedFieldNoWriteBarrier(new_context, Context::kScopeInfoOffset,
+                                    scratch);
+  __ StoreTaggedFieldNoWriteBarrier(new_context, Context::kPreviousOffset,
+                                    previous);
+  __ LoadRoot(scratch, RootIndex::kUndefinedValue);
+  for (int i = Context::MIN_CONTEXT_SLOTS; i < length; i++) {
+    __ StoreTaggedFieldNoWriteBarrier(new_context,
+                                      Context::OffsetOfElementAt(i), scratch);
+  }
+}
+
 int CreateRegExpLiteral::MaxCallStackArgs() const {
   using D = CallInterfaceDescriptorFor<Builtin::kCreateRegExpLiteral>::type;
   return D::GetStackParameterCount();
@@ -6362,6 +6406,11 @@ void CreateFunctionContext::PrintParams(
   os << "(" << *scope_info().object() << ", " << slot_count() << ")";
 }
 
+void InlinedCreateFunctionContext::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *scope_info().object() << ", " << slot_count() << ")";
+}
+
 void FastCreateClosure::PrintParams(std::ostream& os,
                                     MaglevGraphLabeller* graph_labeller) const {
   os << "(" << *shared_function_info().object() << ", "
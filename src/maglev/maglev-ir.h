@@ -161,6 +161,7 @@ class MergePointInterpreterFrameState;
   V(CreateObjectLiteral)                            \
   V(CreateShallowObjectLiteral)                     \
   V(CreateFunctionContext)                          \
+  V(InlinedCreateFunctionContext)                   \
   V(CreateClosure)                                  \
   V(FastCreateClosure)                              \
   V(CreateRegExpLiteral)                            \
@@ -4789,6 +4790,50 @@ class CreateFunctionContext
   ScopeType scope_type_;
 };
 
+// Inline-allocated variant of CreateFunctionContext for contexts small enough
+// that initializing the slots one by one beats calling the
+// FastNewFunctionContext builtin.
+class InlinedCreateFunctionContext
+    : public FixedInputValueNodeT<1, InlinedCreateFunctionContext> {
+  using Base = FixedInputValueNodeT<1, InlinedCreateFunctionContext>;
+
+ public:
+  explicit InlinedCreateFunctionContext(uint64_t bitfield,
+                                        compiler::ScopeInfoRef scope_info,
+                                        uint32_t slot_count,
+                                        ScopeType scope_type)
+      : Base(bitfield),
+        scope_info_(scope_info),
+        slot_count_(slot_count),
+        scope_type_(scope_type) {}
+
+  // Contexts with at most this many slots (not counting the fixed header) are
+  // allocated inline. Mirrors TurboFan's kFunctionContextAllocationLimit.
+  static constexpr uint32_t kMaxInlineSlotCount = 16;
+
+  compiler::ScopeInfoRef scope_info() const { return scope_info_; }
+  uint32_t slot_count() const { return slot_count_; }
+  ScopeType scope_type() const { return scope_type_; }
+
+  Input& context() { return input(0); }
+
+  static constexpr OpProperties kProperties = OpProperties::CanAllocate() |
+                                              OpProperties::DeferredCall() |
+                                              OpProperties::NotIdempotent();
+  static constexpr
+      typename Base::InputTypes kInputTypes{ValueRepresentation::kTagged};
+
+  int MaxCallStackArgs() const { return 0; }
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::ScopeInfoRef scope_info_;
+  const uint32_t slot_count_;
+  const ScopeType scope_type_;
+};
+
 class FastCreateClosure : public FixedInputValueNodeT<1, FastCreateClosure> {
   using Base = FixedInputValueNodeT<1, FastCreateClosure>;
 
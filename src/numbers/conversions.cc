@@ -9,6 +9,7 @@
 
 #include <cmath>
 
+#include "src/base/memory.h"
 #include "src/base/numbers/dtoa.h"
 #include "src/base/numbers/strtod.h"
 #include "src/base/small-vector.h"
@@ -902,6 +903,138 @@ parsing_done:
   return (sign == Sign::kNegative) ? -converted : converted;
 }
 
+namespace {
+
+#ifdef V8_TARGET_LITTLE_ENDIAN
+// The fast path below consumes mantissa digits eight at a time with
+// word-sized (SWAR) arithmetic; these helpers test whether a 64-bit word
+// consists entirely of ASCII digits and convert such a word to its numeric
+// value (see Lemire, "Number Parsing at a Gigabyte per Second").
+bool IsEightDecimalDigits(uint64_t chars) {
+  return ((chars & 0xF0F0F0F0F0F0F0F0) |
+          (((chars + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+         0x3333333333333333;
+}
+
+uint32_t ParseEightDecimalDigits(uint64_t chars) {
+  const uint64_t kByteMask = 0x000000FF000000FF;
+  chars -= 0x3030303030303030;           // "00000000"
+  chars = (chars * 10) + (chars >> 8);   // Pairs of digits, one per byte.
+  chars = (((chars & kByteMask) * ((uint64_t{1000000} << 32) | 100)) +
+           (((chars >> 16) & kByteMask) * ((uint64_t{10000} << 32) | 1))) >>
+          32;
+  return static_cast<uint32_t>(chars);
+}
+#endif  // V8_TARGET_LITTLE_ENDIAN
+
+// Accumulates a run of decimal digits into |value| (mod 2^64) and returns
+// the position of the first non-digit. |digit_count| is incremented once per
+// digit consumed.
+const uint8_t* ParseDecimalDigits(const uint8_t* current, const uint8_t* end,
+                                  uint64_t* value, int* digit_count) {
+#ifdef V8_TARGET_LITTLE_ENDIAN
+  while (end - current >= 8) {
+    const uint64_t chunk = base::ReadUnalignedValue<uint64_t>(
+        reinterpret_cast<Address>(current));
+    if (!IsEightDecimalDigits(chunk)) break;
+    *value = *value * 100000000 + ParseEightDecimalDigits(chunk);
+    *digit_count += 8;
+    current += 8;
+  }
+#endif
+  while (current != end && IsDecimalDigit(*current)) {
+    *value = *value * 10 + (*current - '0');
+    ++*digit_count;
+    ++current;
+  }
+  return current;
+}
+
+// Powers of ten that are exactly representable as doubles. 10^22 is the
+// largest such power; 10^23 needs more than 53 mantissa bits.
+constexpr double kExactPowersOfTen[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+constexpr int kMaxExactPowerOfTen = arraysize(kExactPowersOfTen) - 1;
+
+// Converts the common "[+-]?digits[.digits][(e|E)[+-]?digits]" shape without
+// going through the digit buffer and Strtod: the mantissa is accumulated in
+// eight-digit SWAR chunks and the result is produced with one exact
+// multiplication or division (Clinger's fast path), which is correctly
+// rounded as long as the mantissa fits 53 bits and the scaling power of ten
+// is exact. Returns false for everything else — junk, radix prefixes, too
+// many digits, out-of-range exponents — in which case the caller must run
+// the generic parser on the unmodified input.
+bool FastStringToDouble(const uint8_t* current, const uint8_t* end,
+                        double* result) {
+  if (!AdvanceToNonspace(&current, end)) return false;
+  bool negative = false;
+  if (*current == '+' || *current == '-') {
+    negative = *current == '-';
+    ++current;
+    if (current == end) return false;
+  }
+  if (!IsDecimalDigit(*current) && *current != '.') return false;
+  if (*current == '0' && end - current > 1 && current[1] != '.' &&
+      current[1] != 'e' && current[1] != 'E') {
+    // Leading zeros interact with the radix prefixes and the implicit-octal
+    // flag; leave them to the generic parser.
+    return false;
+  }
+
+  uint64_t mantissa = 0;
+  int digit_count = 0;
+  current = ParseDecimalDigits(current, end, &mantissa, &digit_count);
+
+  int exponent = 0;
+  if (current != end && *current == '.') {
+    ++current;
+    const uint8_t* fraction_start = current;
+    current = ParseDecimalDigits(current, end, &mantissa, &digit_count);
+    if (digit_count == 0) return false;  // "." without any digits.
+    exponent = -static_cast<int>(current - fraction_start);
+  }
+  if (digit_count == 0) return false;
+
+  if (current != end && (*current == 'e' || *current == 'E')) {
+    ++current;
+    bool exponent_negative = false;
+    if (current != end && (*current == '+' || *current == '-')) {
+      exponent_negative = *current == '-';
+      ++current;
+    }
+    if (current == end || !IsDecimalDigit(*current)) return false;
+    int exponent_value = 0;
+    do {
+      if (exponent_value < 1000) {
+        exponent_value = exponent_value * 10 + (*current - '0');
+      }
+      ++current;
+    } while (current != end && IsDecimalDigit(*current));
+    exponent += exponent_negative ? -exponent_value : exponent_value;
+  }
+
+  // Trailing whitespace is fine; anything else depends on the junk flag and
+  // is left to the generic parser.
+  if (AdvanceToNonspace(&current, end)) return false;
+
+  // With at most 17 digits the mantissa accumulation cannot have wrapped;
+  // above 2^53 it is no longer exactly representable as a double.
+  if (digit_count > 17) return false;
+  if (mantissa > (uint64_t{1} << 53)) return false;
+  if (exponent < -kMaxExactPowerOfTen || exponent > kMaxExactPowerOfTen) {
+    return false;
+  }
+
+  double value = static_cast<double>(mantissa);
+  value = exponent < 0 ? value / kExactPowersOfTen[-exponent]
+                       : value * kExactPowersOfTen[exponent];
+  *result = negative ? -value : value;
+  return true;
+}
+
+}  // namespace
+
 double StringToDouble(const char* str, int flags, double empty_string_val) {
   // We use {base::OneByteVector} instead of {base::CStrVector} to avoid
   // instantiating the InternalStringToDouble() template for {const char*} as
@@ -911,6 +1044,8 @@ double StringToDouble(const char* str, int flags, double empty_string_val) {
 
 double StringToDouble(base::Vector<const uint8_t> str, int flags,
                       double empty_string_val) {
+  double result;
+  if (FastStringToDouble(str.begin(), str.end(), &result)) return result;
   return InternalStringToDouble(str.begin(), str.end(), flags,
                                 empty_string_val);
 }
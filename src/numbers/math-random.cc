@@ -32,17 +32,14 @@ void MathRandom::ResetContext(Tagged<Context> native_context) {
   PodArray<State>::cast(native_context->math_random_state())->set(0, state);
 }
 
-Address MathRandom::RefillCache(Isolate* isolate, Address raw_native_context) {
-  Tagged<Context> native_context =
-      Context::cast(Tagged<Object>(raw_native_context));
-  DisallowGarbageCollection no_gc;
-  Tagged<PodArray<State>> pod =
-      PodArray<State>::cast(native_context->math_random_state());
-  State state = pod->get(0);
-  // Initialize state if not yet initialized. If a fixed random seed was
-  // requested, use it to reset our state the first time a script asks for
-  // random numbers in this context. This ensures the script sees a consistent
-  // sequence.
+namespace {
+
+// Initialize state if not yet initialized. If a fixed random seed was
+// requested, use it to reset our state the first time a script asks for
+// random numbers in this context. This ensures the script sees a consistent
+// sequence.
+MathRandom::State EnsureInitialized(Isolate* isolate,
+                                    MathRandom::State state) {
   if (state.s0 == 0 && state.s1 == 0) {
     uint64_t seed;
     if (v8_flags.random_seed != 0) {
@@ -54,6 +51,18 @@ Address MathRandom::RefillCache(Isolate* isolate, Address raw_native_context) {
     state.s1 = base::RandomNumberGenerator::MurmurHash3(~seed);
     CHECK(state.s0 != 0 || state.s1 != 0);
   }
+  return state;
+}
+
+}  // namespace
+
+Address MathRandom::RefillCache(Isolate* isolate, Address raw_native_context) {
+  Tagged<Context> native_context =
+      Context::cast(Tagged<Object>(raw_native_context));
+  DisallowGarbageCollection no_gc;
+  Tagged<PodArray<State>> pod =
+      PodArray<State>::cast(native_context->math_random_state());
+  State state = EnsureInitialized(isolate, pod->get(0));
 
   Tagged<FixedDoubleArray> cache =
       FixedDoubleArray::cast(native_context->math_random_cache());
@@ -70,5 +79,22 @@ Address MathRandom::RefillCache(Isolate* isolate, Address raw_native_context) {
   return new_index.ptr();
 }
 
+void MathRandom::FillBuffer(Isolate* isolate, Tagged<Context> native_context,
+                            double* buffer, size_t count) {
+  DisallowGarbageCollection no_gc;
+  Tagged<PodArray<State>> pod =
+      PodArray<State>::cast(native_context->math_random_state());
+  State state = EnsureInitialized(isolate, pod->get(0));
+
+  for (size_t i = 0; i < count; i++) {
+    base::RandomNumberGenerator::XorShift128(&state.s0, &state.s1);
+    buffer[i] = base::RandomNumberGenerator::ToDouble(state.s0);
+  }
+  pod->set(0, state);
+  // Values already sitting in the Math.random cache stay valid; they were
+  // produced from earlier state, so interleaved Math.random calls continue
+  // the same stream.
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -21,6 +21,12 @@ class MathRandom : public AllStatic {
   // Returns a tagged Smi as a raw Address.
   static Address RefillCache(Isolate* isolate, Address raw_native_context);
 
+  // Fills {buffer} with {count} random doubles in [0, 1), drawn from the same
+  // per-context xorshift128+ stream that backs the Math.random cache. Used by
+  // the nonstandard Math.randomFill builtin for batch generation.
+  static void FillBuffer(Isolate* isolate, Tagged<Context> native_context,
+                         double* buffer, size_t count);
+
   static const int kCacheSize = 64;
   static const int kStateSize = 2 * kInt64Size;
 
@@ -159,6 +159,17 @@ void AllocationSite::set_deopt_dependent_code(bool deopt) {
                      kRelaxedStore);
 }
 
+AllocationSite::BoilerplateFlatness AllocationSite::boilerplate_flatness()
+    const {
+  return BoilerplateFlatnessBits::decode(pretenure_data(kRelaxedLoad));
+}
+
+void AllocationSite::set_boilerplate_flatness(BoilerplateFlatness flatness) {
+  int32_t value = pretenure_data(kRelaxedLoad);
+  set_pretenure_data(BoilerplateFlatnessBits::update(value, flatness),
+                     kRelaxedStore);
+}
+
 int AllocationSite::memento_found_count() const {
   return MementoFoundCountBits::decode(pretenure_data(kRelaxedLoad));
 }
@@ -33,6 +33,15 @@ class AllocationSite : public Struct {
     kLastPretenureDecisionValue = kZombie
   };
 
+  // Cached classification of a literal boilerplate. A "flat" boilerplate
+  // contains no nested objects and no mutable-double fields, so cloning it
+  // needs no recursive fix-up walk; see runtime-literals.cc.
+  enum BoilerplateFlatness {
+    kFlatnessUnknown = 0,
+    kFlatBoilerplate = 1,
+    kNonFlatBoilerplate = 2,
+  };
+
   const char* PretenureDecisionName(PretenureDecision decision);
 
   // Contains either a Smi-encoded bitfield or a boilerplate. If it's a Smi the
@@ -76,7 +85,9 @@ class AllocationSite : public Struct {
   using MementoFoundCountBits = base::BitField<int, 0, 26>;
   using PretenureDecisionBits = base::BitField<PretenureDecision, 26, 3>;
   using DeoptDependentCodeBit = base::BitField<bool, 29, 1>;
+  using BoilerplateFlatnessBits = base::BitField<BoilerplateFlatness, 30, 2>;
   static_assert(PretenureDecisionBits::kMax >= kLastPretenureDecisionValue);
+  static_assert(BoilerplateFlatnessBits::kMax >= kNonFlatBoilerplate);
 
   // Increments the mementos found counter and returns the new count.
   inline int IncrementMementoFoundCount(int increment = 1);
@@ -93,6 +104,9 @@ class AllocationSite : public Struct {
   inline bool deopt_dependent_code() const;
   inline void set_deopt_dependent_code(bool deopt);
 
+  inline BoilerplateFlatness boilerplate_flatness() const;
+  inline void set_boilerplate_flatness(BoilerplateFlatness flatness);
+
   inline int memento_found_count() const;
   inline void set_memento_found_count(int count);
 
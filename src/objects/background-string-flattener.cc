@@ -0,0 +1,213 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/background-string-flattener.h"
+
+#include <algorithm>
+
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/init/v8.h"
+#include "src/objects/string-inl.h"
+#include "src/tasks/cancelable-task.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Characters copied per chunk. Bounds both how long main-thread string
+// content mutators can block on the worker and how long the worker defers
+// safepoints.
+constexpr int kFlattenChunkLength = 1 * MB;
+
+}  // namespace
+
+class BackgroundStringFlattener::FlattenTask final : public CancelableTask {
+ public:
+  FlattenTask(Isolate* isolate, BackgroundStringFlattener* flattener,
+              std::unique_ptr<PersistentHandles> persistent_handles,
+              Handle<String> cons)
+      : CancelableTask(isolate),
+        flattener_(flattener),
+        persistent_handles_(std::move(persistent_handles)),
+        cons_(cons) {}
+
+  void RunInternal() override {
+    flattener_->CopyOnBackground(std::move(persistent_handles_), cons_);
+  }
+
+ private:
+  BackgroundStringFlattener* const flattener_;
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+  Handle<String> cons_;
+};
+
+class BackgroundStringFlattener::InstallTask final : public CancelableTask {
+ public:
+  InstallTask(Isolate* isolate, BackgroundStringFlattener* flattener,
+              std::unique_ptr<PersistentHandles> persistent_handles,
+              Handle<String> cons, Handle<String> flat)
+      : CancelableTask(isolate),
+        flattener_(flattener),
+        persistent_handles_(std::move(persistent_handles)),
+        cons_(cons),
+        flat_(flat) {}
+
+  void RunInternal() override {
+    flattener_->InstallResult(std::move(persistent_handles_), cons_, flat_);
+  }
+
+ private:
+  BackgroundStringFlattener* const flattener_;
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+  Handle<String> cons_;
+  Handle<String> flat_;
+};
+
+BackgroundStringFlattener::BackgroundStringFlattener(Isolate* isolate)
+    : isolate_(isolate),
+      foreground_task_runner_(V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+          reinterpret_cast<v8::Isolate*>(isolate))) {}
+
+// static
+void BackgroundStringFlattener::MaybeScheduleProactiveFlatten(
+    Isolate* isolate, Handle<String> cons) {
+  DCHECK(v8_flags.background_flatten_strings);
+  BackgroundStringFlattener* flattener = isolate->background_string_flattener();
+  if (flattener == nullptr) return;
+  if (flattener->busy_.load(std::memory_order_relaxed)) return;
+  // String::kMaxLength is well below kMaxInt / 2, so this cannot overflow.
+  if (cons->length() < 2 * flattener->last_scheduled_length_) return;
+  flattener->Schedule(Handle<ConsString>::cast(cons));
+}
+
+void BackgroundStringFlattener::Schedule(Handle<ConsString> cons) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  busy_.store(true, std::memory_order_relaxed);
+  last_scheduled_length_ = cons->length();
+  std::unique_ptr<PersistentHandles> persistent_handles =
+      isolate_->NewPersistentHandles();
+  Handle<String> persistent_cons =
+      persistent_handles->NewHandle(Tagged<String>(*cons));
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::make_unique<FlattenTask>(
+      isolate_, this, std::move(persistent_handles), persistent_cons));
+}
+
+void BackgroundStringFlattener::CopyOnBackground(
+    std::unique_ptr<PersistentHandles> persistent_handles,
+    Handle<String> cons) {
+  LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&local_isolate);
+  LocalHeap* local_heap = local_isolate.heap();
+  local_heap->AttachPersistentHandles(std::move(persistent_handles));
+
+  // The main thread may have flattened or internalized the string before this
+  // task got to run; both replace the cons tree with equivalent flat content,
+  // so there is nothing left to do.
+  if (!IsConsString(*cons) || cons->IsFlat()) {
+    busy_.store(false, std::memory_order_release);
+    return;
+  }
+
+  const int length = cons->length();
+  Handle<String> flat;
+  if (cons->IsOneByteRepresentation()) {
+    Handle<SeqOneByteString> result;
+    if (!local_isolate.factory()
+             ->NewRawOneByteString(length, AllocationType::kOld)
+             .ToHandle(&result)) {
+      busy_.store(false, std::memory_order_release);
+      return;
+    }
+    for (int position = 0; position < length;
+         position += kFlattenChunkLength) {
+      const int chunk = std::min(kFlattenChunkLength, length - position);
+      {
+        base::MutexGuard guard(&content_mutex_);
+        DisallowGarbageCollection no_gc;
+        SharedStringAccessGuardIfNeeded access_guard(&local_isolate);
+        String::WriteToFlat(*cons,
+                            result->GetChars(no_gc, access_guard) + position,
+                            position, chunk, access_guard);
+      }
+      local_heap->Safepoint();
+    }
+    flat = result;
+  } else {
+    Handle<SeqTwoByteString> result;
+    if (!local_isolate.factory()
+             ->NewRawTwoByteString(length, AllocationType::kOld)
+             .ToHandle(&result)) {
+      busy_.store(false, std::memory_order_release);
+      return;
+    }
+    for (int position = 0; position < length;
+         position += kFlattenChunkLength) {
+      const int chunk = std::min(kFlattenChunkLength, length - position);
+      {
+        base::MutexGuard guard(&content_mutex_);
+        DisallowGarbageCollection no_gc;
+        SharedStringAccessGuardIfNeeded access_guard(&local_isolate);
+        String::WriteToFlat(*cons,
+                            result->GetChars(no_gc, access_guard) + position,
+                            position, chunk, access_guard);
+      }
+      local_heap->Safepoint();
+    }
+    flat = result;
+  }
+
+  Handle<String> persistent_flat = local_heap->NewPersistentHandle(flat);
+  foreground_task_runner_->PostTask(
+      std::make_unique<InstallTask>(isolate_, this,
+                                    local_heap->DetachPersistentHandles(),
+                                    cons, persistent_flat));
+}
+
+void BackgroundStringFlattener::InstallResult(
+    std::unique_ptr<PersistentHandles> persistent_handles, Handle<String> cons,
+    Handle<String> flat) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<String> raw = *cons;
+    // The main thread may have flattened the string itself (second() is
+    // empty) or internalized it to a ThinString in the meantime; in both
+    // cases the eagerly computed copy is simply dropped.
+    if (IsConsString(raw)) {
+      Tagged<ConsString> raw_cons = ConsString::cast(raw);
+      if (raw_cons->second()->length() != 0) {
+        DCHECK_EQ(raw_cons->length(), flat->length());
+        raw_cons->set_first(*flat);
+        raw_cons->set_second(ReadOnlyRoots(isolate_).empty_string());
+      }
+    }
+  }
+  busy_.store(false, std::memory_order_release);
+}
+
+BackgroundStringFlattener::MutationScope::MutationScope(Isolate* isolate) {
+  if (!v8_flags.background_flatten_strings) return;
+  BackgroundStringFlattener* flattener = isolate->background_string_flattener();
+  // busy_ only transitions from false to true on the main thread, which is
+  // the thread running this scope, so an idle flattener cannot start reading
+  // string contents while the mutation is in progress.
+  if (flattener == nullptr ||
+      !flattener->busy_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  mutex_ = &flattener->content_mutex_;
+  mutex_->Lock();
+}
+
+BackgroundStringFlattener::MutationScope::~MutationScope() {
+  if (mutex_ != nullptr) mutex_->Unlock();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,102 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_BACKGROUND_STRING_FLATTENER_H_
+#define V8_OBJECTS_BACKGROUND_STRING_FLATTENER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "src/base/platform/mutex.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+
+class TaskRunner;
+
+namespace internal {
+
+class ConsString;
+class Isolate;
+class LocalIsolate;
+class PersistentHandles;
+class String;
+
+// Proactively flattens large cons string trees on a background worker thread,
+// so that the first flat access on the main thread does not have to copy the
+// whole tree at once. The flat result is allocated in old space through the
+// worker's LocalHeap and handed back to the main thread, which installs it
+// into the ConsString exactly like String::SlowFlatten would.
+//
+// The worker reads string contents concurrently with the main thread. All
+// in-place mutations of string payloads on the main thread (flattening,
+// transitions to thin or external strings) therefore have to enter a
+// MutationScope; the worker holds the same mutex while copying a bounded
+// chunk, so mutators block for at most one chunk. Mutations of shared strings
+// from other threads are already synchronized through
+// Isolate::internalized_string_access(), which the worker acquires per chunk
+// as well.
+class V8_EXPORT_PRIVATE BackgroundStringFlattener {
+ public:
+  explicit BackgroundStringFlattener(Isolate* isolate);
+
+  // Schedules {cons} for background flattening. Called on the main thread
+  // when a large cons string is created; does nothing if a flatten is already
+  // in flight or the string has not grown enough since the last one.
+  static void MaybeScheduleProactiveFlatten(Isolate* isolate,
+                                            Handle<String> cons);
+  // Cons strings created on background threads are never scheduled.
+  static void MaybeScheduleProactiveFlatten(LocalIsolate* isolate,
+                                            Handle<String> cons) {}
+
+  // Synchronizes an in-place mutation of string contents on the main thread
+  // with a concurrent background copy. Cheap when no flatten is in flight.
+  class V8_NODISCARD MutationScope final {
+   public:
+    explicit MutationScope(Isolate* isolate);
+    // Mutations on background threads only affect shared strings, for which
+    // content accesses are synchronized through the shared string access
+    // mutex instead.
+    explicit MutationScope(LocalIsolate* isolate) {}
+    ~MutationScope();
+
+    MutationScope(const MutationScope&) = delete;
+    MutationScope& operator=(const MutationScope&) = delete;
+
+   private:
+    base::Mutex* mutex_ = nullptr;
+  };
+
+ private:
+  class FlattenTask;
+  class InstallTask;
+
+  void Schedule(Handle<ConsString> cons);
+  // Runs on a worker thread.
+  void CopyOnBackground(std::unique_ptr<PersistentHandles> persistent_handles,
+                        Handle<String> cons);
+  // Runs on the main thread.
+  void InstallResult(std::unique_ptr<PersistentHandles> persistent_handles,
+                     Handle<String> cons, Handle<String> flat);
+
+  Isolate* const isolate_;
+  std::shared_ptr<v8::TaskRunner> foreground_task_runner_;
+  // Held by the worker while copying a chunk and by main-thread string
+  // content mutators for the duration of the mutation.
+  base::Mutex content_mutex_;
+  // Whether a flatten is in flight. Set on the main thread when scheduling;
+  // cleared on the main thread after installing the result, or on the worker
+  // when the copy is abandoned.
+  std::atomic<bool> busy_{false};
+  // Length of the last scheduled string. The next flatten is only scheduled
+  // once a cons string of twice this length is created, so a tree that grows
+  // by small appends is re-flattened O(log n) times rather than after every
+  // append. Main thread only.
+  int last_scheduled_length_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_BACKGROUND_STRING_FLATTENER_H_
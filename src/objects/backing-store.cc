@@ -7,6 +7,7 @@
 #include <cstring>
 
 #include "src/base/bits.h"
+#include "src/base/platform/platform.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
 #include "src/logging/counters.h"
@@ -43,6 +44,16 @@ constexpr uint64_t kFullGuardSize64 = uint64_t{32} * GB;
 
 std::atomic<uint32_t> next_backing_store_id_{1};
 
+// Advises transparent huge pages for the committed portion of a resizable or
+// growable backing store. The full virtual range is reserved upfront, so
+// growth never moves the buffer; backing the committed pages with huge pages
+// keeps the dTLB footprint small for buffers that grow into the multi-megabyte
+// range. Advisory, Linux-only and best effort.
+void AdviseHugePagesForCommittedRange(void* start, size_t committed_length) {
+  if (!v8_flags.huge_pages_for_large_array_buffers) return;
+  base::OS::AdviseHugePages(start, committed_length);
+}
+
 // Allocation results are reported to UMA
 //
 // See wasm_memory_allocation_result in counters-definitions.h
@@ -399,6 +410,10 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
     return {};
   }
 
+  if (wasm_memory == WasmMemoryFlag::kNotWasm && committed_byte_length > 0) {
+    AdviseHugePagesForCommittedRange(buffer_start, committed_byte_length);
+  }
+
   if (isolate != nullptr) {
     RecordStatus(isolate, did_retry ? AllocationStatus::kSuccessAfterRetry
                                     : AllocationStatus::kSuccess);
@@ -649,6 +664,7 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
                          new_committed_length, PageAllocator::kReadWrite)) {
     return kFailure;
   }
+  AdviseHugePagesForCommittedRange(buffer_start_, new_committed_length);
 
   // Do per-isolate accounting for non-shared backing stores.
   reinterpret_cast<v8::Isolate*>(isolate)
@@ -696,6 +712,7 @@ BackingStore::ResizeOrGrowResult BackingStore::GrowInPlace(
                            new_committed_length, PageAllocator::kReadWrite)) {
       return kFailure;
     }
+    AdviseHugePagesForCommittedRange(buffer_start_, new_committed_length);
 
     // compare_exchange_weak updates old_byte_length.
     if (byte_length_.compare_exchange_weak(old_byte_length, new_byte_length,
@@ -5,7 +5,9 @@
 #include "src/objects/call-site-info.h"
 
 #include "src/base/strings.h"
+#include "src/objects/bytecode-array-inl.h"
 #include "src/objects/call-site-info-inl.h"
+#include "src/objects/code-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/strings/string-builder-inl.h"
 
@@ -593,6 +595,61 @@ bool CallSiteInfo::ComputeLocation(Handle<CallSiteInfo> info,
   return true;
 }
 
+// static
+bool CallSiteInfo::IsCompactStackTrace(Tagged<Object> stack_trace) {
+  if (!IsFixedArray(stack_trace)) return false;
+  Tagged<FixedArray> array = FixedArray::cast(stack_trace);
+  // Eagerly captured stack traces hold one CallSiteInfo per element, so a
+  // leading Smi (the first frame's flags) identifies the compact encoding.
+  return array->length() > 0 && IsSmi(array->get(kCompactFlagsIndex));
+}
+
+// static
+Handle<FixedArray> CallSiteInfo::MaterializeCompactStackTrace(
+    Isolate* isolate, Handle<FixedArray> compact_stack_trace) {
+  DCHECK_EQ(0, compact_stack_trace->length() % kCompactFrameSize);
+  int frame_count = compact_stack_trace->length() / kCompactFrameSize;
+  Handle<FixedArray> call_site_infos =
+      isolate->factory()->NewFixedArray(frame_count);
+  Handle<FixedArray> parameters = isolate->factory()->empty_fixed_array();
+  for (int i = 0; i < frame_count; ++i) {
+    int base = i * kCompactFrameSize;
+    int flags = Smi::ToInt(compact_stack_trace->get(base + kCompactFlagsIndex));
+    int code_offset =
+        Smi::ToInt(compact_stack_trace->get(base + kCompactCodeOffsetIndex));
+    Handle<Object> receiver_or_instance(
+        compact_stack_trace->get(base + kCompactReceiverOrInstanceIndex),
+        isolate);
+    Handle<Object> function(
+        compact_stack_trace->get(base + kCompactFunctionIndex), isolate);
+    Handle<HeapObject> code = isolate->factory()->undefined_value();
+    Tagged<Object> code_or_wrapper =
+        compact_stack_trace->get(base + kCompactCodeObjectIndex);
+    if (IsCodeWrapper(code_or_wrapper)) {
+      code = handle(CodeWrapper::cast(code_or_wrapper)->code(isolate), isolate);
+    } else if (IsBytecodeWrapper(code_or_wrapper)) {
+      code = handle(BytecodeWrapper::cast(code_or_wrapper)->bytecode(isolate),
+                    isolate);
+    } else if (!IsUndefined(code_or_wrapper, isolate)) {
+      // The bytecode was flushed and its wrapper was converted in place to an
+      // UncompiledData. Recompilation produces identical bytecode, so fall
+      // back to the function's current bytecode if there is one, and give up
+      // on the source position otherwise.
+      Tagged<SharedFunctionInfo> shared = JSFunction::cast(*function)->shared();
+      if (shared->HasBytecodeArray()) {
+        code = handle(shared->GetBytecodeArray(isolate), isolate);
+      } else {
+        code_offset = kUnknown;
+        flags |= kIsSourcePositionComputed;
+      }
+    }
+    Handle<CallSiteInfo> info = isolate->factory()->NewCallSiteInfo(
+        receiver_or_instance, function, code, code_offset, flags, parameters);
+    call_site_infos->set(i, *info);
+  }
+  return call_site_infos;
+}
+
 // static
 int CallSiteInfo::ComputeSourcePosition(Handle<CallSiteInfo> info, int offset) {
   Isolate* isolate = info->GetIsolate();
@@ -96,6 +96,25 @@ class CallSiteInfo : public TorqueGeneratedCallSiteInfo<CallSiteInfo, Struct> {
   static bool ComputeLocation(Handle<CallSiteInfo> info,
                               MessageLocation* location);
 
+  // With --lazy-error-stack-capture, stack traces are captured as a flat
+  // "compact" FixedArray with kCompactFrameSize slots per frame instead of
+  // one CallSiteInfo per frame, and the CallSiteInfos are materialized only
+  // once the stack trace is actually accessed. The Smi-tagged flags come
+  // first so that a non-empty compact stack trace can be told apart from a
+  // FixedArray of (never Smi) CallSiteInfos by its first element. The code
+  // object slot holds a CodeWrapper or BytecodeWrapper (or undefined), since
+  // Code and BytecodeArray themselves live outside the sandbox.
+  static constexpr int kCompactFlagsIndex = 0;
+  static constexpr int kCompactCodeOffsetIndex = 1;
+  static constexpr int kCompactReceiverOrInstanceIndex = 2;
+  static constexpr int kCompactFunctionIndex = 3;
+  static constexpr int kCompactCodeObjectIndex = 4;
+  static constexpr int kCompactFrameSize = 5;
+
+  static bool IsCompactStackTrace(Tagged<Object> stack_trace);
+  static Handle<FixedArray> MaterializeCompactStackTrace(
+      Isolate* isolate, Handle<FixedArray> compact_stack_trace);
+
   class BodyDescriptor;
 
  private:
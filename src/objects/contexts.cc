@@ -581,6 +581,20 @@ void NativeContext::IncrementErrorsThrown() {
 
 int NativeContext::GetErrorsThrown() { return errors_thrown().value(); }
 
+void NativeContext::SetMemoryLimit(size_t limit_in_bytes) {
+  // Round up so that a small non-zero limit does not silently become
+  // "no limit".
+  size_t limit_in_kb = (limit_in_bytes + KB - 1) / KB;
+  if (limit_in_kb > static_cast<size_t>(Smi::kMaxValue)) {
+    limit_in_kb = static_cast<size_t>(Smi::kMaxValue);
+  }
+  set_memory_limit_in_kb(Smi::FromInt(static_cast<int>(limit_in_kb)));
+}
+
+size_t NativeContext::GetMemoryLimit() {
+  return static_cast<size_t>(memory_limit_in_kb().value()) * KB;
+}
+
 static_assert(Context::MIN_CONTEXT_SLOTS == 2);
 static_assert(Context::MIN_CONTEXT_EXTENDED_SLOTS == 3);
 static_assert(NativeContext::kScopeInfoOffset ==
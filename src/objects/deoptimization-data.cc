@@ -4,9 +4,12 @@
 
 #include "src/objects/deoptimization-data.h"
 
+#include <cstring>
 #include <iomanip>
 
+#include "src/base/functional.h"
 #include "src/deoptimizer/translated-state.h"
+#include "src/execution/isolate.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/code.h"
 #include "src/objects/deoptimization-data-inl.h"
@@ -41,6 +44,41 @@ Handle<DeoptimizationData> DeoptimizationData::Empty(LocalIsolate* isolate) {
   return New(isolate, 0);
 }
 
+// static
+Handle<DeoptimizationFrameTranslation> FrameTranslationCache::Canonicalize(
+    Isolate* isolate, Handle<DeoptimizationFrameTranslation> translation) {
+  DisallowGarbageCollection no_gc;
+  const int length = translation->length();
+  if (length == 0) return translation;
+  const uint32_t hash = static_cast<uint32_t>(
+      base::hash_range(translation->begin(), translation->begin() + length));
+  const Tagged<Smi> hash_smi = Smi::FromInt(static_cast<int>(hash >> 2));
+  Tagged<FixedArray> cache = isolate->heap()->frame_translation_cache();
+  const int index = static_cast<int>(hash % kCacheSize) * kEntrySize;
+  if (cache->get(index + kHashOffset) == hash_smi) {
+    Tagged<Object> cached = cache->get(index + kTranslationOffset);
+    if (IsByteArray(cached)) {
+      Tagged<DeoptimizationFrameTranslation> cached_translation =
+          DeoptimizationFrameTranslation::cast(cached);
+      if (cached_translation->length() == length &&
+          std::memcmp(cached_translation->begin(), translation->begin(),
+                      length) == 0) {
+        return handle(cached_translation, isolate);
+      }
+    }
+  }
+  cache->set(index + kHashOffset, hash_smi);
+  cache->set(index + kTranslationOffset, *translation);
+  return translation;
+}
+
+// static
+void FrameTranslationCache::Clear(Tagged<FixedArray> cache) {
+  for (int i = 0; i < cache->length(); i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
 Tagged<SharedFunctionInfo> DeoptimizationData::GetInlinedFunction(int index) {
   if (index == -1) {
     return SharedFunctionInfo::cast(SharedFunctionInfo());
@@ -117,6 +117,25 @@ class DeoptimizationFrameTranslation::Iterator {
   int ops_since_previous_index_was_updated_ = 0;
 };
 
+// Caches recently created frame translations keyed by their byte contents so
+// that optimized code objects with identical translations share one array
+// (--share-frame-translations). Lives in a FixedArray heap root and is
+// flushed on each full GC, like the other isolate caches.
+class FrameTranslationCache final : public AllStatic {
+ public:
+  // Returns a previously cached translation with the same contents if there
+  // is one, and enters `translation` into the cache otherwise. Must only be
+  // called on the main thread.
+  static Handle<DeoptimizationFrameTranslation> Canonicalize(
+      Isolate* isolate, Handle<DeoptimizationFrameTranslation> translation);
+  static void Clear(Tagged<FixedArray> cache);
+
+  static constexpr int kCacheSize = 0x100;
+  static constexpr int kHashOffset = 0;
+  static constexpr int kTranslationOffset = 1;
+  static constexpr int kEntrySize = 2;
+};
+
 // DeoptimizationData is a fixed array used to hold the deoptimization data for
 // optimized code.  It also contains information about functions that were
 // inlined.  If N different functions were inlined then the first N elements of
@@ -116,6 +116,12 @@ PropertyDetails Dictionary<Derived, Shape>::DetailsAt(InternalIndex entry) {
 template <typename Derived, typename Shape>
 void Dictionary<Derived, Shape>::DetailsAtPut(InternalIndex entry,
                                               PropertyDetails value) {
+  // Every mutation of the key set funnels through here: SetEntry stores the
+  // details for both additions and removals, and attribute changes may affect
+  // which keys are enumerable. Value-only stores bypass this method.
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    NameDictionary::cast(*this)->clear_enum_cache();
+  }
   Shape::DetailsAtPut(Derived::cast(*this), entry, value);
 }
 
@@ -264,6 +270,19 @@ void NameDictionary::set_flags(uint32_t flags) {
   this->set(kFlagsIndex, Smi::FromInt(flags));
 }
 
+Tagged<Object> NameDictionary::enum_cache() const {
+  return this->get(kEnumCacheIndex);
+}
+
+void NameDictionary::set_enum_cache(Tagged<FixedArray> keys) {
+  this->set(kEnumCacheIndex, keys);
+}
+
+void NameDictionary::clear_enum_cache() {
+  this->set(kEnumCacheIndex, this->GetReadOnlyRoots().undefined_value(),
+            SKIP_WRITE_BARRIER);
+}
+
 BIT_FIELD_ACCESSORS(NameDictionary, flags, may_have_interesting_properties,
                     NameDictionary::MayHaveInterestingPropertiesBit)
 
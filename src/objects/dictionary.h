@@ -163,7 +163,7 @@ class BaseNameDictionaryShape : public BaseDictionaryShape<Handle<Name>> {
 
 class NameDictionaryShape : public BaseNameDictionaryShape {
  public:
-  static const int kPrefixSize = 3;
+  static const int kPrefixSize = 4;
   static const int kEntrySize = 3;
   static const bool kMatchNeedsHoleCheck = false;
 };
@@ -234,6 +234,7 @@ class V8_EXPORT_PRIVATE NameDictionary
   DECL_PRINTER(NameDictionary)
 
   static const int kFlagsIndex = kObjectHashIndex + 1;
+  static const int kEnumCacheIndex = kFlagsIndex + 1;
   static const int kEntryValueIndex = 1;
   static const int kEntryDetailsIndex = 2;
   static const int kInitialCapacity = 2;
@@ -253,6 +254,13 @@ class V8_EXPORT_PRIVATE NameDictionary
   inline uint32_t flags() const;
   inline void set_flags(uint32_t flags);
 
+  // Cached enumeration-order array of the enumerable string keys, or undefined
+  // when no valid cache exists. The cache is cleared whenever an entry is
+  // added, removed or reconfigured; value-only stores keep it intact.
+  inline Tagged<Object> enum_cache() const;
+  inline void set_enum_cache(Tagged<FixedArray> keys);
+  inline void clear_enum_cache();
+
   // Creates a new NameDictionary.
   template <typename IsolateT>
   V8_WARN_UNUSED_RESULT static Handle<NameDictionary> New(
@@ -22,6 +22,7 @@
 #include "src/objects/js-shared-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
 #include "src/utils/utils.h"
@@ -99,6 +100,17 @@ namespace {
 
 static const int kPackedSizeNotKnown = -1;
 
+// Use the SIMD search kernels from src/objects/simd.cc for searches over at
+// least this many elements. Must match the vectorization conditions of the
+// kernels themselves; see kSIMDThreshold in builtins-array-gen.cc for the
+// corresponding CSA dispatch.
+#if defined(__SSE3__) || defined(V8_HOST_ARCH_ARM64)
+static const bool kCanVectorizeSearch = true;
+#else
+static const bool kCanVectorizeSearch = false;
+#endif
+static const size_t kSIMDSearchThreshold = 48;
+
 enum Where { AT_START, AT_END };
 
 // First argument in list is the accessor class, the second argument is the
@@ -2361,8 +2373,39 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     }
     DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
 
-    for (size_t index = start; index < end; ++index) {
-      Subclass::SetImpl(receiver, InternalIndex(index), *obj_value);
+    DisallowGarbageCollection no_gc;
+    if (IsSmiOrObjectElementsKind(Subclass::kind()) && IsSmi(*obj_value)) {
+      // Smi stores need no write barrier, so the range can be filled with
+      // wide tagged stores instead of per-element SetImpl calls.
+      Tagged<FixedArray> elements = FixedArray::cast(receiver->elements());
+      MemsetTagged(elements->RawFieldOfElementAt(static_cast<int>(start)),
+                   *obj_value, end - start);
+    } else if (IsDoubleElementsKind(Subclass::kind())) {
+      CHECK(IsNumber(*obj_value));
+      double num = Object::Number(*obj_value);
+      Tagged<FixedDoubleArray> elements =
+          FixedDoubleArray::cast(receiver->elements());
+      double* data = static_cast<double*>(
+          elements->RawField(FixedDoubleArray::OffsetOfElementAt(0))
+              .ToVoidPtr());
+      if (reinterpret_cast<uintptr_t>(data) % sizeof(double) != 0) {
+        // The backing store is not aligned on a double word (possible with
+        // pointer compression); fill element-wise.
+        for (size_t index = start; index < end; ++index) {
+          elements->set(static_cast<int>(index), num);
+        }
+      } else if (base::bit_cast<uint64_t>(num) == 0) {
+        // As in TypedElementsAccessor::FillImpl, this is faster than
+        // {std::fill} for a zero bit pattern (note that -0.0 is excluded
+        // since its bit pattern is non-zero).
+        memset(data + start, 0, (end - start) * sizeof(double));
+      } else {
+        std::fill(data + start, data + end, num);
+      }
+    } else {
+      for (size_t index = start; index < end; ++index) {
+        Subclass::SetImpl(receiver, InternalIndex(index), *obj_value);
+      }
     }
     return MaybeHandle<Object>(receiver);
   }
@@ -2753,6 +2796,24 @@ class FastSmiOrObjectElementsAccessor
     Tagged<FixedArray> elements = FixedArray::cast(receiver->elements());
     static_assert(FixedArray::kMaxLength <=
                   std::numeric_limits<uint32_t>::max());
+
+    // Use the vectorized kernel from src/objects/simd.cc where a raw
+    // tagged-word comparison implements StrictEquals: searching for a Smi in
+    // a Smi array, or for a heap object that is compared by identity (i.e.
+    // not a HeapNumber, String or BigInt). HeapNumber search values are
+    // excluded because a Smi array cannot contain them, and Smi search values
+    // are excluded for object arrays because their elements may be
+    // StrictEquals-but-not-identical HeapNumbers. This mirrors the dispatch
+    // in the CSA builtin.
+    if (kCanVectorizeSearch && length - start_from >= kSIMDSearchThreshold &&
+        ((IsSmi(value) && IsSmiElementsKind(Subclass::kind())) ||
+         (!IsNumber(value) && !IsString(value) && !IsBigInt(value)))) {
+      intptr_t result = static_cast<intptr_t>(ArrayIndexOfIncludesSmiOrObject(
+          elements.ptr(), length, start_from, value.ptr()));
+      if (result < 0) return Just<int64_t>(-1);
+      return Just<int64_t>(result);
+    }
+
     for (size_t k = start_from; k < length; ++k) {
       if (Object::StrictEquals(value,
                                elements->get(static_cast<uint32_t>(k)))) {
@@ -3194,6 +3255,18 @@ class FastDoubleElementsAccessor
 
     static_assert(FixedDoubleArray::kMaxLength <=
                   std::numeric_limits<int>::max());
+
+    // Use the vectorized kernel from src/objects/simd.cc. The search value is
+    // a non-NaN number at this point, so holes (which are encoded as a NaN
+    // bit pattern) can never compare equal and need no special handling. This
+    // mirrors the dispatch in the CSA builtin.
+    if (kCanVectorizeSearch && length - start_from >= kSIMDSearchThreshold) {
+      intptr_t result = static_cast<intptr_t>(ArrayIndexOfIncludesDouble(
+          elements.ptr(), length, start_from, value.ptr()));
+      if (result < 0) return Just<int64_t>(-1);
+      return Just<int64_t>(result);
+    }
+
     for (size_t k = start_from; k < length; ++k) {
       int k_int = static_cast<int>(k);
       if (elements->is_the_hole(k_int)) {
@@ -3815,6 +3888,24 @@ class TypedElementsAccessor
                                        ElementType* dest_data_ptr,
                                        size_t length,
                                        IsSharedBuffer is_shared) {
+    if (is_shared == kUnshared) {
+      // Neither backing store can be mutated concurrently, so convert in a
+      // tight loop over the raw memory. With the per-element shared-buffer
+      // dispatch and atomic accesses out of the way, the compiler can
+      // auto-vectorize the value-preserving conversions (e.g. the widening
+      // Uint8 -> Float32 copies common in preprocessing pipelines), making
+      // them memory-bandwidth bound. Conversions that have to change the
+      // value (Float -> Int per ToInt32, clamping for Uint8Clamped) keep
+      // their scalar semantics via FromScalar.
+      for (size_t i = 0; i < length; i++) {
+        SourceElementType source_elem =
+            base::ReadUnalignedValue<SourceElementType>(
+                reinterpret_cast<Address>(source_data_ptr + i));
+        base::WriteUnalignedValue(reinterpret_cast<Address>(dest_data_ptr + i),
+                                  FromScalar(source_elem));
+      }
+      return;
+    }
     for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
@@ -5522,9 +5613,17 @@ Handle<JSArray> ElementsAccessor::Concat(Isolate* isolate,
     bool is_holey = false;
     for (uint32_t i = 0; i < concat_size; i++) {
       Tagged<Object> arg = (*args)[i];
-      ElementsKind arg_kind = JSArray::cast(arg)->GetElementsKind();
-      has_raw_doubles = has_raw_doubles || IsDoubleElementsKind(arg_kind);
-      is_holey = is_holey || IsHoleyElementsKind(arg_kind);
+      ElementsKind arg_kind;
+      if (IsJSArray(arg)) {
+        arg_kind = JSArray::cast(arg)->GetElementsKind();
+        has_raw_doubles = has_raw_doubles || IsDoubleElementsKind(arg_kind);
+        is_holey = is_holey || IsHoleyElementsKind(arg_kind);
+      } else {
+        // Non-spreadable arguments contribute themselves as a single element.
+        arg_kind = IsSmi(arg)      ? PACKED_SMI_ELEMENTS
+                   : IsNumber(arg) ? PACKED_DOUBLE_ELEMENTS
+                                   : PACKED_ELEMENTS;
+      }
       result_elements_kind =
           GetMoreGeneralElementsKind(result_elements_kind, arg_kind);
     }
@@ -5552,7 +5651,19 @@ Handle<JSArray> ElementsAccessor::Concat(Isolate* isolate,
   for (uint32_t i = 0; i < concat_size; i++) {
     // It is crucial to keep |array| in a raw pointer form to avoid
     // performance degradation.
-    Tagged<JSArray> array = JSArray::cast((*args)[i]);
+    Tagged<Object> arg = (*args)[i];
+    if (!IsJSArray(arg)) {
+      // Append the non-spreadable argument as a single element.
+      int index = static_cast<int>(insertion_index);
+      if (IsDoubleElementsKind(result_elements_kind)) {
+        FixedDoubleArray::cast(*storage)->set(index, Object::Number(arg));
+      } else {
+        FixedArray::cast(*storage)->set(index, arg);
+      }
+      insertion_index++;
+      continue;
+    }
+    Tagged<JSArray> array = JSArray::cast(arg);
     uint32_t len = 0;
     Object::ToArrayLength(array->length(), &len);
     if (len == 0) continue;
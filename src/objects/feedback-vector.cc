@@ -4,6 +4,9 @@
 
 #include "src/objects/feedback-vector.h"
 
+#include <type_traits>
+
+#include "src/base/functional.h"
 #include "src/base/optional.h"
 #include "src/common/globals.h"
 #include "src/deoptimizer/deoptimizer.h"
@@ -100,6 +103,11 @@ Handle<FeedbackMetadata> FeedbackMetadata::New(IsolateT* isolate,
     metadata->SetKind(slot, kind);
   }
 
+  if constexpr (std::is_same_v<IsolateT, Isolate>) {
+    if (V8_UNLIKELY(v8_flags.deduplicate_compilation_metadata)) {
+      return FeedbackMetadataDedupCache::Canonicalize(isolate, metadata);
+    }
+  }
   return metadata;
 }
 
@@ -108,6 +116,53 @@ template Handle<FeedbackMetadata> FeedbackMetadata::New(
 template Handle<FeedbackMetadata> FeedbackMetadata::New(
     LocalIsolate* isolate, const FeedbackVectorSpec* spec);
 
+// static
+Handle<FeedbackMetadata> FeedbackMetadataDedupCache::Canonicalize(
+    Isolate* isolate, Handle<FeedbackMetadata> metadata) {
+  DisallowGarbageCollection no_gc;
+  Tagged<FeedbackMetadata> raw = *metadata;
+  const int slot_count = raw->slot_count();
+  const int create_closure_slot_count = raw->create_closure_slot_count();
+  const int word_count = raw->length();
+  size_t running_hash =
+      base::hash_combine(slot_count, create_closure_slot_count);
+  for (int i = 0; i < word_count; ++i) {
+    running_hash = base::hash_combine(running_hash, raw->get(i));
+  }
+  const uint32_t hash = static_cast<uint32_t>(running_hash);
+  const Tagged<Smi> hash_smi = Smi::FromInt(static_cast<int>(hash >> 2));
+  Tagged<FixedArray> cache = isolate->heap()->feedback_metadata_dedup_cache();
+  const int index = static_cast<int>(hash % kCacheSize) * kEntrySize;
+  if (cache->get(index + kHashOffset) == hash_smi) {
+    Tagged<Object> cached = cache->get(index + kMetadataOffset);
+    if (IsFeedbackMetadata(cached)) {
+      Tagged<FeedbackMetadata> cached_metadata = FeedbackMetadata::cast(cached);
+      if (cached_metadata->slot_count() == slot_count &&
+          cached_metadata->create_closure_slot_count() ==
+              create_closure_slot_count) {
+        bool equals = true;
+        for (int i = 0; i < word_count; ++i) {
+          if (cached_metadata->get(i) != raw->get(i)) {
+            equals = false;
+            break;
+          }
+        }
+        if (equals) return handle(cached_metadata, isolate);
+      }
+    }
+  }
+  cache->set(index + kHashOffset, hash_smi);
+  cache->set(index + kMetadataOffset, raw);
+  return metadata;
+}
+
+// static
+void FeedbackMetadataDedupCache::Clear(Tagged<FixedArray> cache) {
+  for (int i = 0; i < cache->length(); i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
 bool FeedbackMetadata::SpecDiffersFrom(
     const FeedbackVectorSpec* other_spec) const {
   if (other_spec->slot_count() != slot_count()) {
@@ -650,6 +650,7 @@ class FeedbackMetadata : public HeapObject {
 
  private:
   friend class AccessorAssembler;
+  friend class FeedbackMetadataDedupCache;
 
   // Raw accessors to the encoded slot data.
   inline int32_t get(int index) const;
@@ -674,6 +675,25 @@ class FeedbackMetadata : public HeapObject {
   OBJECT_CONSTRUCTORS(FeedbackMetadata, HeapObject);
 };
 
+// Caches recently created FeedbackMetadata objects keyed by their slot
+// contents so that functions with identical feedback layouts share one
+// metadata object (--deduplicate-compilation-metadata). Lives in a FixedArray
+// heap root and is flushed on each full GC, like the other isolate caches.
+class FeedbackMetadataDedupCache final : public AllStatic {
+ public:
+  // Returns a previously cached metadata object with the same contents if
+  // there is one, and enters `metadata` into the cache otherwise. Must only
+  // be called on the main thread.
+  static Handle<FeedbackMetadata> Canonicalize(
+      Isolate* isolate, Handle<FeedbackMetadata> metadata);
+  static void Clear(Tagged<FixedArray> cache);
+
+  static constexpr int kCacheSize = 0x100;
+  static constexpr int kHashOffset = 0;
+  static constexpr int kMetadataOffset = 1;
+  static constexpr int kEntrySize = 2;
+};
+
 // Verify that an empty hash field looks like a tagged object, but can't
 // possibly be confused with a pointer.
 static_assert((Name::kEmptyHashField & kHeapObjectTag) == kHeapObjectTag);
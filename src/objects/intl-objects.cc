@@ -14,6 +14,8 @@
 #include <vector>
 
 #include "src/api/api-inl.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/strings.h"
 #include "src/date/date.h"
 #include "src/execution/isolate.h"
@@ -48,6 +50,7 @@
 #include "unicode/numfmt.h"
 #include "unicode/numsys.h"
 #include "unicode/timezone.h"
+#include "unicode/tztrans.h"
 #include "unicode/ures.h"
 #include "unicode/ustring.h"
 #include "unicode/uvernum.h"  // U_ICU_VERSION_MAJOR_NUM
@@ -2524,6 +2527,33 @@ std::string LookupMatcher(Isolate* isolate,
   return isolate->DefaultLocale();
 }
 
+// Resolving a locale walks the set of available locales and does several
+// ICU round trips, which is slow enough to dominate repeated formatter
+// construction. The result is deterministic given the inputs and the
+// default locale, all of which are part of the cache key, so it can be
+// memoized across constructions (and across isolates).
+class ResolvedLocaleCache {
+ public:
+  Maybe<Intl::ResolvedLocale> Get(const std::string& key) {
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return Nothing<Intl::ResolvedLocale>();
+    return Just(it->second);
+  }
+
+  void Set(const std::string& key, const Intl::ResolvedLocale& resolved) {
+    base::MutexGuard guard(&mutex_);
+    if (map_.size() > 32) {  // Cache at most 32 resolutions.
+      map_.clear();
+    }
+    map_[key] = resolved;
+  }
+
+ private:
+  std::map<std::string, Intl::ResolvedLocale> map_;
+  base::Mutex mutex_;
+};
+
 }  // namespace
 
 // This function doesn't correspond exactly with the spec. Instead
@@ -2540,9 +2570,31 @@ Maybe<Intl::ResolvedLocale> Intl::ResolveLocale(
     Isolate* isolate, const std::set<std::string>& available_locales,
     const std::vector<std::string>& requested_locales, MatcherOption matcher,
     const std::set<std::string>& relevant_extension_keys) {
+  static base::LazyInstance<ResolvedLocaleCache>::type cache =
+      LAZY_INSTANCE_INITIALIZER;
+
+  const bool best_fit = matcher == Intl::MatcherOption::kBestFit &&
+                        v8_flags.harmony_intl_best_fit_matcher;
+
+  // Each service has its own static set of available locales, so its
+  // address identifies the service in the key.
+  std::string key =
+      std::to_string(reinterpret_cast<uintptr_t>(&available_locales));
+  key += best_fit ? ":b:" : ":l:";
+  key += isolate->DefaultLocale();
+  for (const std::string& requested : requested_locales) {
+    key += ':';
+    key += requested;
+  }
+  for (const std::string& extension_key : relevant_extension_keys) {
+    key += ',';
+    key += extension_key;
+  }
+  Maybe<Intl::ResolvedLocale> cached = cache.Pointer()->Get(key);
+  if (cached.IsJust()) return cached;
+
   std::string locale;
-  if (matcher == Intl::MatcherOption::kBestFit &&
-      v8_flags.harmony_intl_best_fit_matcher) {
+  if (best_fit) {
     locale = BestFitMatcher(isolate, available_locales, requested_locales);
   } else {
     locale = LookupMatcher(isolate, available_locales, requested_locales);
@@ -2558,8 +2610,9 @@ Maybe<Intl::ResolvedLocale> Intl::ResolveLocale(
 
   // TODO(gsathya): Remove privateuse subtags from extensions.
 
-  return Just(
-      Intl::ResolvedLocale{canonicalized_locale, icu_locale, extensions});
+  Intl::ResolvedLocale resolved{canonicalized_locale, icu_locale, extensions};
+  cache.Pointer()->Set(key, resolved);
+  return Just(resolved);
 }
 
 Handle<Managed<icu::UnicodeString>> Intl::SetTextToBreakIterator(
@@ -2657,6 +2710,9 @@ class ICUTimezoneCache : public base::TimezoneCache {
 
   double LocalTimeOffset(double time_ms, bool is_utc) override;
 
+  bool LocalTimeOffsetSegment(double time_ms, double* start_ms, double* end_ms,
+                              int* offset_ms) override;
+
   void Clear(TimeZoneDetection time_zone_detection) override;
 
  private:
@@ -2722,6 +2778,34 @@ double ICUTimezoneCache::LocalTimeOffset(double time_ms, bool is_utc) {
   return raw_offset + dst_offset;
 }
 
+bool ICUTimezoneCache::LocalTimeOffsetSegment(double time_ms, double* start_ms,
+                                              double* end_ms, int* offset_ms) {
+  int32_t raw_offset, dst_offset;
+  if (!GetOffsets(time_ms, true, &raw_offset, &dst_offset)) return false;
+  *offset_ms = raw_offset + dst_offset;
+  // See the cast note in GetOffsets.
+  const icu::BasicTimeZone* basic_timezone =
+      static_cast<const icu::BasicTimeZone*>(GetTimeZone());
+  icu::TimeZoneTransition transition;
+  // When there is no transition on one side, the offset is constant all the
+  // way to the end of the representable time range; report a bound well
+  // beyond any time value a caller can ask about.
+  constexpr double kNoTransition = 1e18;
+  if (basic_timezone->getPreviousTransition(time_ms, /*inclusive=*/true,
+                                            transition)) {
+    *start_ms = transition.getTime();
+  } else {
+    *start_ms = -kNoTransition;
+  }
+  if (basic_timezone->getNextTransition(time_ms, /*inclusive=*/false,
+                                        transition)) {
+    *end_ms = transition.getTime();
+  } else {
+    *end_ms = kNoTransition;
+  }
+  return true;
+}
+
 void ICUTimezoneCache::Clear(TimeZoneDetection time_zone_detection) {
   delete timezone_;
   timezone_ = nullptr;
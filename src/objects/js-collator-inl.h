@@ -24,6 +24,9 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(JSCollator)
 
 ACCESSORS(JSCollator, icu_collator, Tagged<Managed<icu::Collator>>,
           kIcuCollatorOffset)
+ACCESSORS(JSCollator, collation_key_cache,
+          Tagged<Managed<JSCollator::CollationKeyCache>>,
+          kCollationKeyCacheOffset)
 
 }  // namespace internal
 }  // namespace v8
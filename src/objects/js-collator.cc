@@ -8,6 +8,9 @@
 
 #include "src/objects/js-collator.h"
 
+#include <cstring>
+#include <memory>
+
 #include "src/execution/isolate.h"
 #include "src/objects/js-collator-inl.h"
 #include "src/objects/js-locale.h"
@@ -543,6 +546,9 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   Handle<Managed<icu::Collator>> managed_collator =
       Managed<icu::Collator>::FromUniquePtr(isolate, 0,
                                             std::move(icu_collator));
+  Handle<Managed<JSCollator::CollationKeyCache>> managed_key_cache =
+      Managed<JSCollator::CollationKeyCache>::FromUniquePtr(
+          isolate, 0, std::make_unique<JSCollator::CollationKeyCache>());
 
   // We only need to do so if it is different from the collator would return.
   Handle<String> locale_str = isolate->factory()->NewStringFromAsciiChecked(
@@ -552,12 +558,92 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
       isolate->factory()->NewFastOrSlowJSObjectFromMap(map));
   DisallowGarbageCollection no_gc;
   collator->set_icu_collator(*managed_collator);
+  collator->set_collation_key_cache(*managed_key_cache);
   collator->set_locale(*locale_str);
 
   // 29. Return collator.
   return collator;
 }
 
+const std::string* JSCollator::CollationKeyCache::GetOrCreate(
+    Isolate* isolate, const icu::Collator& icu_collator, Handle<String> string,
+    std::string* scratch) {
+  int length = string->length();
+  if (length > kMaxCachedStringLength) return nullptr;
+  string = String::Flatten(isolate, string);
+  uint32_t hash = string->EnsureHash();
+  auto range = map_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const Entry& entry = it->second;
+    if (entry.content.size() == static_cast<size_t>(length) &&
+        string->IsEqualTo(
+            base::Vector<const base::uc16>(
+                reinterpret_cast<const base::uc16*>(entry.content.data()),
+                entry.content.size()),
+            isolate)) {
+      return &entry.key;
+    }
+  }
+
+  icu::UnicodeString unicode_string = Intl::ToICUUnicodeString(isolate, string);
+  int32_t key_length = icu_collator.getSortKey(unicode_string, nullptr, 0);
+  std::string key(static_cast<size_t>(key_length), '\0');
+  icu_collator.getSortKey(unicode_string,
+                          reinterpret_cast<uint8_t*>(key.data()), key_length);
+
+  size_t entry_bytes =
+      length * sizeof(base::uc16) + key.size() + kEntryOverhead;
+  if (total_bytes_ + entry_bytes > kMaxTotalBytes) {
+    // Budget exhausted; hand the key back without memoizing it. Entries
+    // inserted earlier keep serving hits.
+    *scratch = std::move(key);
+    return scratch;
+  }
+  total_bytes_ += entry_bytes;
+  Entry entry;
+  entry.content.resize(length);
+  String::WriteToFlat(*string,
+                      reinterpret_cast<base::uc16*>(entry.content.data()), 0,
+                      length);
+  entry.key = std::move(key);
+  // Nodes of an unordered_multimap are stable, so the returned pointer
+  // survives later insertions.
+  auto inserted = map_.emplace(hash, std::move(entry));
+  return &inserted->second.key;
+}
+
+// static
+int JSCollator::CompareWithSortKeys(Isolate* isolate,
+                                    Handle<JSCollator> collator,
+                                    Handle<String> string1,
+                                    Handle<String> string2) {
+  icu::Collator* icu_collator = collator->icu_collator()->raw();
+  CHECK_NOT_NULL(icu_collator);
+  // Sort keys canonicalize ignorable characters away, so unlike the
+  // general path an early return for identical strings is sound here; it is
+  // what comparing the (identical) keys would produce.
+  if (string1.is_identical_to(string2)) return UCollationResult::UCOL_EQUAL;
+
+  CollationKeyCache* cache = collator->collation_key_cache()->raw();
+  if (cache->ShouldMemoize()) {
+    std::string scratch1;
+    const std::string* key1 =
+        cache->GetOrCreate(isolate, *icu_collator, string1, &scratch1);
+    if (key1 != nullptr) {
+      std::string scratch2;
+      const std::string* key2 =
+          cache->GetOrCreate(isolate, *icu_collator, string2, &scratch2);
+      if (key2 != nullptr) {
+        int diff = strcmp(key1->c_str(), key2->c_str());
+        return diff < 0    ? UCollationResult::UCOL_LESS
+               : diff > 0  ? UCollationResult::UCOL_GREATER
+                           : UCollationResult::UCOL_EQUAL;
+      }
+    }
+  }
+  return Intl::CompareStrings(isolate, *icu_collator, string1, string2);
+}
+
 namespace {
 
 class CollatorAvailableLocales {
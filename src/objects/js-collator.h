@@ -11,6 +11,7 @@
 
 #include <set>
 #include <string>
+#include <unordered_map>
 
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
@@ -33,11 +34,62 @@ namespace internal {
 
 class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
  public:
+  // Memoized ICU sort keys, keyed by string content. Comparing two sort keys
+  // is a plain byte comparison, so once a string's key is cached, further
+  // comparisons against it skip ICU entirely. This turns the O(n log n) ICU
+  // calls of a collator-driven Array.prototype.sort into O(n) key
+  // generations. The cache is owned by its collator through a Managed field
+  // and dies with it.
+  class CollationKeyCache {
+   public:
+    // Returns the sort key for {string}, generating and memoizing it on
+    // first use. When the string is too long to cache or the byte budget is
+    // exhausted, the key is written to {scratch} instead; returns nullptr
+    // if no key should be used for this string at all.
+    const std::string* GetOrCreate(Isolate* isolate,
+                                   const icu::Collator& icu_collator,
+                                   Handle<String> string, std::string* scratch);
+
+    // One-shot comparisons are cheaper without key generation; only start
+    // memoizing once the collator shows the repeated-compare pattern of a
+    // sort.
+    bool ShouldMemoize() {
+      if (use_count_ >= kMemoizationThreshold) return true;
+      ++use_count_;
+      return false;
+    }
+
+   private:
+    // Long strings tend to differ early, which favors ICU's incremental
+    // comparison over whole-string sort keys.
+    static const int kMaxCachedStringLength = 1024;
+    static const size_t kMaxTotalBytes = 1 * MB;
+    // Approximate per-entry bookkeeping cost of the hash map.
+    static const size_t kEntryOverhead = 64;
+    static const int kMemoizationThreshold = 32;
+
+    struct Entry {
+      std::u16string content;
+      std::string key;  // Includes the terminating NUL byte.
+    };
+
+    std::unordered_multimap<uint32_t, Entry> map_;
+    size_t total_bytes_ = 0;
+    int use_count_ = 0;
+  };
+
   // ecma402/#sec-initializecollator
   V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT static MaybeHandle<JSCollator> New(
       Isolate* isolate, Handle<Map> map, Handle<Object> locales,
       Handle<Object> options, const char* service);
 
+  // ecma402/#sec-collator-comparestrings, backed by the sort key cache.
+  // Falls back to Intl::CompareStrings when memoization does not pay off.
+  V8_EXPORT_PRIVATE static int CompareWithSortKeys(Isolate* isolate,
+                                                   Handle<JSCollator> collator,
+                                                   Handle<String> string1,
+                                                   Handle<String> string2);
+
   // ecma402/#sec-intl.collator.prototype.resolvedoptions
   static Handle<JSObject> ResolvedOptions(Isolate* isolate,
                                           Handle<JSCollator> collator);
@@ -47,6 +99,7 @@ class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
   DECL_PRINTER(JSCollator)
 
   DECL_ACCESSORS(icu_collator, Tagged<Managed<icu::Collator>>)
+  DECL_ACCESSORS(collation_key_cache, Tagged<Managed<CollationKeyCache>>)
 
   TQ_OBJECT_CONSTRUCTORS(JSCollator)
 };
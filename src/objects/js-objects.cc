@@ -7,6 +7,7 @@
 #include "src/api/api-arguments-inl.h"
 #include "src/api/api-natives.h"
 #include "src/base/optional.h"
+#include "src/base/small-vector.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/date/date.h"
@@ -69,6 +70,7 @@
 #endif  // V8_INTL_SUPPORT
 #include "src/objects/js-raw-json-inl.h"
 #include "src/objects/js-shared-array-inl.h"
+#include "src/objects/js-shared-map-inl.h"
 #include "src/objects/js-struct-inl.h"
 #include "src/objects/js-temporal-objects-inl.h"
 #include "src/objects/js-weak-refs.h"
@@ -272,6 +274,87 @@ bool HasExcludedProperty(
   return false;
 }
 
+// Attempts to copy all own properties of |from| into a fresh |target| in one
+// batch. The result map is computed up front by walking the (cached)
+// transition tree once, after which the property backing store is allocated
+// in a single step and the values are copied over without any per-key
+// lookups. Only usable with CreateDataProperty semantics, i.e. stores that
+// never consult the prototype chain. Returns true if the copy was performed.
+bool TryBulkCopyDataProperties(Isolate* isolate, Handle<JSReceiver> target,
+                               Handle<JSObject> from, Handle<Map> source_map,
+                               PropertiesEnumerationMode mode) {
+  if (!IsJSObject(*target)) return false;
+  Handle<JSObject> target_object = Handle<JSObject>::cast(target);
+  Handle<Map> target_map(target_object->map(), isolate);
+  if (IsSpecialReceiverMap(*target_map) || target_map->is_dictionary_map() ||
+      !target_map->is_extensible() ||
+      target_map->NumberOfOwnDescriptors() != 0) {
+    return false;
+  }
+  if (IsAlwaysSharedSpaceJSObject(*target_object)) return false;
+
+  int descriptor_count = source_map->NumberOfOwnDescriptors();
+  if (descriptor_count == 0) return true;
+
+  Handle<DescriptorArray> descriptors(source_map->instance_descriptors(isolate),
+                                      isolate);
+
+  // Check that the source only holds enumerable data properties and collect
+  // their values. None of the reads can trigger user code, so the source map
+  // stays stable throughout.
+  base::SmallVector<Handle<Object>, 8> values;
+  for (InternalIndex i : source_map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.kind() != PropertyKind::kData || !details.IsEnumerable()) {
+      return false;
+    }
+    if (mode == PropertiesEnumerationMode::kEnumerationOrder &&
+        IsSymbol(descriptors->GetKey(i))) {
+      // The batch copy preserves property addition order; with enumeration
+      // order semantics symbol keys would have to be moved to the end.
+      return false;
+    }
+    if (details.location() == PropertyLocation::kDescriptor) {
+      values.push_back(handle(descriptors->GetStrongValue(i), isolate));
+    } else {
+      Representation representation = details.representation();
+      FieldIndex index = FieldIndex::ForPropertyIndex(
+          *source_map, details.field_index(), representation);
+      values.push_back(
+          JSObject::FastPropertyAt(isolate, from, representation, index));
+    }
+  }
+
+  // Compute the result map by walking the transition tree, exactly as adding
+  // the properties one at a time would. This does not touch the target, so
+  // bailing out midway is safe.
+  Handle<Map> new_map = target_map;
+  int value_index = 0;
+  for (InternalIndex i : source_map->IterateOwnDescriptors()) {
+    Handle<Name> next_key(descriptors->GetKey(i), isolate);
+    new_map = Map::TransitionToDataProperty(
+        isolate, new_map, next_key, values[value_index++], NONE,
+        PropertyConstness::kConst, StoreOrigin::kNamed);
+    if (new_map->is_dictionary_map()) return false;
+  }
+  DCHECK_EQ(descriptor_count, new_map->NumberOfOwnDescriptors());
+
+  // Allocate the backing store for the final shape in one go and fill in the
+  // values.
+  JSObject::AllocateStorageForMap(target_object, new_map);
+  DisallowGarbageCollection no_gc;
+  Tagged<DescriptorArray> new_descriptors =
+      new_map->instance_descriptors(isolate);
+  value_index = 0;
+  for (InternalIndex i : new_map->IterateOwnDescriptors()) {
+    PropertyDetails details = new_descriptors->GetDetails(i);
+    DCHECK_EQ(PropertyKind::kData, details.kind());
+    DCHECK_EQ(PropertyLocation::kField, details.location());
+    target_object->WriteToField(i, details, *values[value_index++]);
+  }
+  return true;
+}
+
 V8_WARN_UNUSED_RESULT Maybe<bool> FastAssign(
     Isolate* isolate, Handle<JSReceiver> target, Handle<Object> source,
     PropertiesEnumerationMode mode,
@@ -304,6 +387,14 @@ V8_WARN_UNUSED_RESULT Maybe<bool> FastAssign(
   // We should never try to copy properties from an object itself.
   CHECK_IMPLIES(!use_set, !target.is_identical_to(from));
 
+  // With CreateDataProperty semantics and a fresh target, the final shape of
+  // the target is determined entirely by the source, so the properties can be
+  // copied in one batch.
+  if (!use_set && excluded_properties == nullptr &&
+      TryBulkCopyDataProperties(isolate, target, from, map, mode)) {
+    return Just(true);
+  }
+
   Handle<DescriptorArray> descriptors(map->instance_descriptors(isolate),
                                       isolate);
 
@@ -2358,7 +2449,8 @@ bool JSReceiver::IsCodeLike(Isolate* isolate) const {
 // static
 MaybeHandle<JSObject> JSObject::New(Handle<JSFunction> constructor,
                                     Handle<JSReceiver> new_target,
-                                    Handle<AllocationSite> site) {
+                                    Handle<AllocationSite> site,
+                                    AllocationType allocation) {
   // If called through new, new.target can be:
   // - a subclass of constructor,
   // - a proxy wrapper around constructor, or
@@ -2379,7 +2471,7 @@ MaybeHandle<JSObject> JSObject::New(Handle<JSFunction> constructor,
                                        ? SwissNameDictionary::kInitialCapacity
                                        : NameDictionary::kInitialCapacity;
   Handle<JSObject> result = isolate->factory()->NewFastOrSlowJSObjectFromMap(
-      initial_map, initial_capacity, AllocationType::kYoung, site);
+      initial_map, initial_capacity, allocation, site);
   return result;
 }
 
@@ -2543,6 +2635,8 @@ int JSObject::GetHeaderSize(InstanceType type,
       return JSModuleNamespace::kHeaderSize;
     case JS_SHARED_ARRAY_TYPE:
       return JSSharedArray::kHeaderSize;
+    case JS_SHARED_MAP_TYPE:
+      return JSSharedMap::kHeaderSize;
     case JS_SHARED_STRUCT_TYPE:
       return JSSharedStruct::kHeaderSize;
     case JS_ATOMICS_MUTEX_TYPE:
@@ -2864,6 +2958,9 @@ void JSObject::JSObjectShortPrint(StringStream* accumulator) {
     case JS_SHARED_ARRAY_TYPE:
       accumulator->Add("<JSSharedArray>");
       break;
+    case JS_SHARED_MAP_TYPE:
+      accumulator->Add("<JSSharedMap>");
+      break;
     case JS_SHARED_STRUCT_TYPE:
       accumulator->Add("<JSSharedStruct>");
       break;
@@ -5506,6 +5603,60 @@ MaybeHandle<Object> JSObject::GetPropertyWithInterceptor(LookupIterator* it,
   return GetPropertyWithInterceptorInternal(it, it->GetInterceptor(), done);
 }
 
+Maybe<bool> JSObject::GetOwnNameValuePairsWithBulkInterceptor(
+    Isolate* isolate, Handle<JSReceiver> receiver, Handle<JSObject> object,
+    Handle<FixedArray>* result) {
+  if (!object->HasNamedInterceptor()) return Just(false);
+  Handle<InterceptorInfo> interceptor(object->GetNamedInterceptor(), isolate);
+  if (IsUndefined(interceptor->bulk_getter(), isolate)) return Just(false);
+  // The bulk result stands in for the complete own-property snapshot, so the
+  // interceptor must be the only source of the object's properties.
+  Tagged<Map> map = object->map();
+  if (map->is_access_check_needed()) return Just(false);
+  if (!object->HasFastProperties() || map->NumberOfOwnDescriptors() > 0) {
+    return Just(false);
+  }
+  if (object->HasIndexedInterceptor()) return Just(false);
+  if (object->GetElementsAccessor()->NumberOfElements(*object) > 0) {
+    return Just(false);
+  }
+
+  // Make sure that the top context does not change when doing callbacks or
+  // interceptor calls.
+  AssertNoContextChange ncc(isolate);
+  PropertyCallbackArguments args(isolate, interceptor->data(), *receiver,
+                                 *object, Just(kDontThrow));
+  Handle<JSObject> pairs_obj = args.CallNamedBulkGetter(interceptor);
+  RETURN_VALUE_IF_EXCEPTION_DETECTOR(isolate, args, Nothing<bool>());
+  if (pairs_obj.is_null()) return Just(false);
+  args.AcceptSideEffects();
+
+  // The callback contract requires an array with an even number of elements,
+  // alternating property names (strings) and values; fall back to the
+  // per-property protocol on any other shape.
+  if (!IsJSArray(*pairs_obj)) return Just(false);
+  Handle<JSArray> pairs = Handle<JSArray>::cast(pairs_obj);
+  uint32_t length;
+  if (!Object::ToArrayLength(pairs->length(), &length)) return Just(false);
+  if ((length & 1) != 0 ||
+      length > static_cast<uint32_t>(FixedArray::kMaxLength)) {
+    return Just(false);
+  }
+
+  Handle<FixedArray> entries =
+      isolate->factory()->NewFixedArray(static_cast<int>(length));
+  for (uint32_t i = 0; i < length; i++) {
+    Handle<Object> element;
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, element, JSReceiver::GetElement(isolate, pairs, i),
+        Nothing<bool>());
+    if ((i & 1) == 0 && !IsString(*element)) return Just(false);
+    entries->set(static_cast<int>(i), *element);
+  }
+  *result = entries;
+  return Just(true);
+}
+
 Maybe<bool> JSObject::HasRealNamedProperty(Isolate* isolate,
                                            Handle<JSObject> object,
                                            Handle<Name> name) {
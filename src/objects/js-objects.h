@@ -339,7 +339,8 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
 
   V8_EXPORT_PRIVATE static V8_WARN_UNUSED_RESULT MaybeHandle<JSObject> New(
       Handle<JSFunction> constructor, Handle<JSReceiver> new_target,
-      Handle<AllocationSite> site);
+      Handle<AllocationSite> site,
+      AllocationType allocation = AllocationType::kYoung);
 
   static MaybeHandle<JSObject> NewWithMap(Isolate* isolate,
                                           Handle<Map> initial_map,
@@ -571,6 +572,18 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   V8_WARN_UNUSED_RESULT static MaybeHandle<Object> GetPropertyWithInterceptor(
       LookupIterator* it, bool* done);
 
+  // Fetches all own enumerable string-keyed properties and their values with
+  // a single embedder callback when the object's named interceptor provides a
+  // bulk getter and the interceptor is the sole source of the object's
+  // properties. On success |result| holds alternating name/value pairs.
+  // Returns false (without calling into the embedder for each property) when
+  // the caller must use the per-property protocol instead.
+  V8_WARN_UNUSED_RESULT static Maybe<bool>
+  GetOwnNameValuePairsWithBulkInterceptor(Isolate* isolate,
+                                          Handle<JSReceiver> receiver,
+                                          Handle<JSObject> object,
+                                          Handle<FixedArray>* result);
+
   static void ValidateElements(Tagged<JSObject> object);
 
   // Makes sure that this object can contain HeapObject as elements.
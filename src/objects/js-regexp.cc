@@ -4,8 +4,11 @@
 
 #include "src/objects/js-regexp.h"
 
+#include <algorithm>
+
 #include "src/base/strings.h"
 #include "src/common/globals.h"
+#include "src/execution/isolate.h"
 #include "src/objects/code.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-regexp-inl.h"
@@ -118,6 +121,68 @@ Handle<JSRegExpResultIndices> JSRegExpResultIndices::BuildIndices(
   return indices;
 }
 
+// static
+MaybeHandle<Object> JSRegExpResult::GetGroups(Isolate* isolate,
+                                              Handle<JSObject> result) {
+  DCHECK(v8_flags.lazy_regexp_result_groups);
+  Handle<Object> current(result->InObjectPropertyAt(kGroupsIndex), isolate);
+  // Either the match has no named captures (undefined), or the groups object
+  // has already been materialized and cached in the slot.
+  if (!IsFixedArray(*current)) return current;
+
+  // The slot still holds the capture name map stashed by
+  // RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo; materialize the
+  // groups object from it and the captures stored in the match result.
+  Handle<FixedArray> names = Handle<FixedArray>::cast(current);
+  int num_names = names->length() >> 1;
+  Handle<HeapObject> group_names;
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    group_names = isolate->factory()->NewSwissNameDictionary(num_names);
+  } else {
+    group_names = isolate->factory()->NewNameDictionary(num_names);
+  }
+  Handle<PropertyDictionary> group_names_dict =
+      Handle<PropertyDictionary>::cast(group_names);
+  for (int i = 0; i < num_names; i++) {
+    int base_offset = i * 2;
+    int name_offset = base_offset;
+    int index_offset = base_offset + 1;
+    Handle<String> name(String::cast(names->get(name_offset)), isolate);
+    Tagged<Smi> smi_index = Smi::cast(names->get(index_offset));
+    Handle<Object> capture;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, capture,
+        Object::GetElement(isolate, result, smi_index.value()), Object);
+    InternalIndex group_entry = group_names_dict->FindEntry(isolate, name);
+    // Duplicate group entries are possible if the capture groups are in
+    // different alternatives, i.e. only one of them can actually match.
+    // Therefore when we find a duplicate entry, either the current entry is
+    // undefined (didn't match anything) or the capture for the current entry
+    // is undefined. In the latter case we don't do anything, in the former
+    // case we update the entry.
+    if (group_entry.is_found()) {
+      DCHECK(v8_flags.js_regexp_duplicate_named_groups);
+      if (!IsUndefined(*capture, isolate)) {
+        DCHECK(IsUndefined(group_names_dict->ValueAt(group_entry), isolate));
+        group_names_dict->ValueAtPut(group_entry, *capture);
+      }
+    } else {
+      group_names_dict =
+          PropertyDictionary::Add(isolate, group_names_dict, name, capture,
+                                  PropertyDetails::Empty());
+    }
+  }
+
+  Handle<FixedArrayBase> elements = isolate->factory()->empty_fixed_array();
+  Handle<HeapObject> null =
+      Handle<HeapObject>::cast(isolate->factory()->null_value());
+  Handle<JSObject> groups =
+      isolate->factory()->NewSlowJSObjectWithPropertiesAndElements(
+          null, group_names_dict, elements);
+  result->InObjectPropertyAtPut(kGroupsIndex, *groups);
+  return groups;
+}
+
 uint32_t JSRegExp::backtrack_limit() const {
   CHECK_EQ(type_tag(), IRREGEXP);
   return static_cast<uint32_t>(Smi::ToInt(DataAt(kIrregexpBacktrackLimit)));
@@ -247,6 +312,38 @@ void JSRegExp::MarkTierUpForNextExec() {
                                 Smi::zero());
 }
 
+// Accounts one interpreted execution on a subject of the given length, and
+// applies the tier-up policy. With a non-zero regexp-tier-up-cost the
+// decision is driven by the cumulative number of interpreted subject
+// characters, which approximates the time spent in the interpreter much
+// better than an execution count: a pattern run once over a huge log line
+// and a pattern run millions of times over short lines both tier up, while
+// a pattern run once over a short line never pays for compilation.
+void JSRegExp::RecordInterpretedExecution(int subject_length) {
+  DCHECK_EQ(type_tag(), JSRegExp::IRREGEXP);
+  Tagged<FixedArray> data_array = FixedArray::cast(data());
+  int exec_count = Smi::ToInt(data_array->get(kIrregexpExecCountIndex));
+  if (exec_count < Smi::kMaxValue) {
+    data_array->set(kIrregexpExecCountIndex, Smi::FromInt(exec_count + 1));
+  }
+  int interpreted_chars =
+      Smi::ToInt(data_array->get(kIrregexpInterpretedCharsIndex));
+  interpreted_chars = static_cast<int>(
+      std::min(static_cast<int64_t>(interpreted_chars) + subject_length,
+               static_cast<int64_t>(Smi::kMaxValue)));
+  data_array->set(kIrregexpInterpretedCharsIndex,
+                  Smi::FromInt(interpreted_chars));
+
+  if (!v8_flags.regexp_tier_up) return;
+  if (v8_flags.regexp_tier_up_cost > 0) {
+    if (interpreted_chars >= v8_flags.regexp_tier_up_cost) {
+      MarkTierUpForNextExec();
+    }
+  } else {
+    TierUpTick();
+  }
+}
+
 // static
 MaybeHandle<JSRegExp> JSRegExp::Initialize(Handle<JSRegExp> regexp,
                                            Handle<String> source,
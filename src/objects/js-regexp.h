@@ -130,6 +130,7 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   void ResetLastTierUpTick();
   void TierUpTick();
   void MarkTierUpForNextExec();
+  void RecordInterpretedExecution(int subject_length);
 
   bool ShouldProduceBytecode();
   inline bool HasCompiledCode() const;
@@ -213,7 +214,21 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // above to save space.
   static constexpr int kIrregexpBacktrackLimit =
       kIrregexpTicksUntilTierUpIndex + 1;
-  static constexpr int kIrregexpDataSize = kIrregexpBacktrackLimit + 1;
+  // The number of executions observed by the interpreter, and the cumulative
+  // number of subject characters those executions covered. The char count is
+  // a proxy for time spent interpreting this pattern and drives tier-up when
+  // the regexp-tier-up-cost flag is non-zero. Both counters saturate at
+  // Smi::kMaxValue and can be queried with %RegexpExecStats().
+  static constexpr int kIrregexpExecCountIndex = kIrregexpBacktrackLimit + 1;
+  static constexpr int kIrregexpInterpretedCharsIndex =
+      kIrregexpExecCountIndex + 1;
+  // A flat String holding a literal substring that every match of the
+  // pattern must contain, used as a fast prefilter in IrregexpExecRaw; the
+  // kUninitializedValue Smi before the first compilation, or Smi::zero() if
+  // no such literal could be determined.
+  static constexpr int kIrregexpPrefilterLiteralIndex =
+      kIrregexpInterpretedCharsIndex + 1;
+  static constexpr int kIrregexpDataSize = kIrregexpPrefilterLiteralIndex + 1;
 
   // TODO(mbid,v8:10765): At the moment the EXPERIMENTAL data array conforms
   // to the format of an IRREGEXP data array, with most fields set to some
@@ -279,6 +294,13 @@ class JSRegExpResult
   // JSRegExpResult, and maybe JSRegExpResultIndices, but both have the same
   // instance type as JSArray.
 
+  // When --lazy-regexp-result-groups is enabled, "groups" is an accessor
+  // property and the in-object slot holds the capture name map until the
+  // groups object is materialized on first access. Returns the cached groups
+  // object, materializing it if necessary.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> GetGroups(
+      Isolate* isolate, Handle<JSObject> result);
+
   // Indices of in-object properties.
   static constexpr int kIndexIndex = 0;
   static constexpr int kInputIndex = 1;
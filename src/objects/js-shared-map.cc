@@ -0,0 +1,136 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/js-shared-map.h"
+
+#include "src/base/bits.h"
+#include "src/objects/dictionary-inl.h"
+#include "src/objects/js-atomics-synchronization-inl.h"
+#include "src/objects/js-shared-map-inl.h"
+#include "src/objects/map-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+int StripeForKey(Tagged<String> key) {
+  DCHECK(key->IsInternalizedString());
+  // Internalized strings store their hash in-place, so all isolates in the
+  // group agree on the stripe of a key.
+  static_assert(base::bits::IsPowerOfTwo(JSSharedMap::kNumStripes));
+  return static_cast<int>(key->hash() & (JSSharedMap::kNumStripes - 1));
+}
+
+int StripeMutexIndex(int stripe) {
+  return stripe * JSSharedMap::kSlotsPerStripe + JSSharedMap::kStripeMutexSlot;
+}
+
+int StripeTableIndex(int stripe) {
+  return stripe * JSSharedMap::kSlotsPerStripe + JSSharedMap::kStripeTableSlot;
+}
+
+}  // namespace
+
+// static
+Handle<Map> JSSharedMap::CreateInstanceMap(Isolate* isolate) {
+  // The instance map is allocated in the shared heap rather than registered as
+  // a read-only root, so that adding SharedMap does not change the read-only
+  // heap layout. All instances created by one constructor share this map.
+  Handle<Map> instance_map = isolate->factory()->NewContextlessMap(
+      JS_SHARED_MAP_TYPE, JSSharedMap::kHeaderSize, DICTIONARY_ELEMENTS, 0,
+      AllocationType::kSharedMap);
+  AlwaysSharedSpaceJSObject::PrepareMapNoEnumerableProperties(*instance_map);
+  return instance_map;
+}
+
+// static
+Handle<Object> JSSharedMap::Get(Isolate* isolate,
+                                Handle<JSSharedMap> shared_map,
+                                Handle<String> key) {
+  Handle<String> unique = isolate->factory()->InternalizeString(key);
+  int stripe = StripeForKey(*unique);
+  Handle<FixedArray> stripes(shared_map->stripes(), isolate);
+  Handle<JSAtomicsMutex> mutex(
+      JSAtomicsMutex::cast(stripes->get(StripeMutexIndex(stripe))), isolate);
+  JSAtomicsMutex::LockGuard lock_guard(isolate, mutex);
+  Tagged<NameDictionary> table =
+      NameDictionary::cast(stripes->get(StripeTableIndex(stripe)));
+  InternalIndex entry = table->FindEntry(isolate, unique);
+  if (entry.is_not_found()) return isolate->factory()->undefined_value();
+  return handle(table->ValueAt(entry), isolate);
+}
+
+// static
+bool JSSharedMap::Has(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                      Handle<String> key) {
+  Handle<String> unique = isolate->factory()->InternalizeString(key);
+  int stripe = StripeForKey(*unique);
+  Handle<FixedArray> stripes(shared_map->stripes(), isolate);
+  Handle<JSAtomicsMutex> mutex(
+      JSAtomicsMutex::cast(stripes->get(StripeMutexIndex(stripe))), isolate);
+  JSAtomicsMutex::LockGuard lock_guard(isolate, mutex);
+  Tagged<NameDictionary> table =
+      NameDictionary::cast(stripes->get(StripeTableIndex(stripe)));
+  return table->FindEntry(isolate, unique).is_found();
+}
+
+// static
+Maybe<bool> JSSharedMap::Set(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                             Handle<String> key, Handle<Object> value) {
+  Handle<String> unique = isolate->factory()->InternalizeString(key);
+  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+      isolate, value, Object::Share(isolate, value, kThrowOnError),
+      Nothing<bool>());
+  SharedObjectSafePublishGuard publish_guard;
+  int stripe = StripeForKey(*unique);
+  Handle<FixedArray> stripes(shared_map->stripes(), isolate);
+  Handle<JSAtomicsMutex> mutex(
+      JSAtomicsMutex::cast(stripes->get(StripeMutexIndex(stripe))), isolate);
+  JSAtomicsMutex::LockGuard lock_guard(isolate, mutex);
+  Handle<NameDictionary> table(
+      NameDictionary::cast(stripes->get(StripeTableIndex(stripe))), isolate);
+  InternalIndex entry = table->FindEntry(isolate, unique);
+  if (entry.is_found()) {
+    table->ValueAtPut(entry, *value);
+    return Just(true);
+  }
+  // Entries are not exposed through the property machinery, so the
+  // enumeration index stays 0 and the attributes are unused.
+  PropertyDetails details(PropertyKind::kData, NONE,
+                          PropertyConstness::kMutable, 0);
+  Handle<NameDictionary> new_table = NameDictionary::EnsureCapacity(
+      isolate, table, 1, AllocationType::kSharedOld);
+  NameDictionary::UncheckedAdd(isolate, new_table, unique, value, details);
+  new_table->ElementAdded();
+  if (!new_table.is_identical_to(table)) {
+    // Publish the grown table. Other isolates only read this slot under the
+    // stripe mutex, so a plain store suffices.
+    stripes->set(StripeTableIndex(stripe), *new_table);
+  }
+  return Just(true);
+}
+
+// static
+bool JSSharedMap::Delete(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                         Handle<String> key) {
+  Handle<String> unique = isolate->factory()->InternalizeString(key);
+  int stripe = StripeForKey(*unique);
+  Handle<FixedArray> stripes(shared_map->stripes(), isolate);
+  Handle<JSAtomicsMutex> mutex(
+      JSAtomicsMutex::cast(stripes->get(StripeMutexIndex(stripe))), isolate);
+  JSAtomicsMutex::LockGuard lock_guard(isolate, mutex);
+  Tagged<NameDictionary> table =
+      NameDictionary::cast(stripes->get(StripeTableIndex(stripe)));
+  InternalIndex entry = table->FindEntry(isolate, unique);
+  if (entry.is_not_found()) return false;
+  // Clear the entry in place instead of using DeleteEntry, which may shrink
+  // into a table allocated in the local heap.
+  table->ClearEntry(entry);
+  table->ElementRemoved();
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,69 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_JS_SHARED_MAP_H_
+#define V8_OBJECTS_JS_SHARED_MAP_H_
+
+#include "src/objects/js-objects.h"
+#include "src/objects/js-struct.h"
+
+// Has to be the last include (doesn't have include guards):
+#include "src/objects/object-macros.h"
+
+namespace v8 {
+namespace internal {
+
+#include "torque-generated/src/objects/js-shared-map-tq.inc"
+
+// A concurrency-safe string-keyed hash map shared across the isolates of an
+// isolate group. The key space is partitioned into a fixed number of lock
+// stripes, each guarded by a JSAtomicsMutex and backed by a NameDictionary in
+// the shared heap, so writes to different stripes scale without contending on
+// a single lock. Keys are internalized strings (whose hashes are stored
+// in-place and thus agree across isolates); values are shared via
+// Object::Share, like shared struct field stores.
+class JSSharedMap
+    : public TorqueGeneratedJSSharedMap<JSSharedMap,
+                                        AlwaysSharedSpaceJSObject> {
+ public:
+  // Number of independently locked partitions. Must be a power of two.
+  static constexpr int kNumStripes = 8;
+  // Initial NameDictionary capacity of each stripe.
+  static constexpr int kInitialStripeCapacity = 4;
+
+  // Layout of the stripes backing array.
+  static constexpr int kSlotsPerStripe = 2;
+  static constexpr int kStripeMutexSlot = 0;
+  static constexpr int kStripeTableSlot = 1;
+
+  static Handle<Map> CreateInstanceMap(Isolate* isolate);
+
+  // Returns the value for {key}, or undefined if absent.
+  static Handle<Object> Get(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                            Handle<String> key);
+  static bool Has(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                  Handle<String> key);
+  // Inserts or overwrites the entry for {key}. Throws a TypeError if {value}
+  // cannot be shared.
+  V8_WARN_UNUSED_RESULT static Maybe<bool> Set(Isolate* isolate,
+                                               Handle<JSSharedMap> shared_map,
+                                               Handle<String> key,
+                                               Handle<Object> value);
+  // Returns whether an entry for {key} was present and removed.
+  static bool Delete(Isolate* isolate, Handle<JSSharedMap> shared_map,
+                     Handle<String> key);
+
+  DECL_CAST(JSSharedMap)
+  DECL_PRINTER(JSSharedMap)
+  EXPORT_DECL_VERIFIER(JSSharedMap)
+
+  TQ_OBJECT_CONSTRUCTORS(JSSharedMap)
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#include "src/objects/object-macros-undef.h"
+
+#endif  // V8_OBJECTS_JS_SHARED_MAP_H_
@@ -12,6 +12,7 @@
 #include "src/handles/handles-inl.h"
 #include "src/heap/factory.h"
 #include "src/objects/api-callbacks.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/elements-inl.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -741,6 +742,22 @@ Maybe<bool> KeyAccumulator::CollectInterceptorKeysInternal(
       DCHECK_EQ(type, kNamed);
       result = enum_args.CallNamedEnumerator(interceptor);
     }
+  } else if (type == kNamed &&
+             !IsUndefined(interceptor->bulk_getter(), isolate_)) {
+    // Without an enumerator the bulk getter serves as one: it reports names
+    // and values in a single embedder callback, of which only the names are
+    // needed here.
+    Handle<FixedArray> pairs;
+    Maybe<bool> handled = JSObject::GetOwnNameValuePairsWithBulkInterceptor(
+        isolate_, receiver, object, &pairs);
+    MAYBE_RETURN(handled, Nothing<bool>());
+    if (handled.FromJust()) {
+      for (int i = 0; i < pairs->length(); i += 2) {
+        Handle<Object> name(pairs->get(i), isolate_);
+        RETURN_NOTHING_IF_NOT_SUCCESSFUL(AddKey(name, DO_NOT_CONVERT));
+      }
+    }
+    return Just(true);
   }
   RETURN_VALUE_IF_EXCEPTION_DETECTOR(isolate_, enum_args, Nothing<bool>());
   if (result.is_null()) return Just(true);
@@ -924,9 +941,36 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   if (dictionary->NumberOfElements() == 0) {
     return isolate->factory()->empty_fixed_array();
   }
+  if constexpr (std::is_same_v<T, NameDictionary>) {
+    // Reuse the cached enumeration order if the dictionary has not changed
+    // since it was built. For prototype-chain walks we still have to iterate
+    // the dictionary, since shadowing (non-enumerable) keys must be reported
+    // to the accumulator.
+    if (mode == KeyCollectionMode::kOwnOnly) {
+      Tagged<Object> enum_cache = dictionary->enum_cache();
+      if (IsFixedArray(enum_cache)) {
+        Handle<FixedArray> keys(FixedArray::cast(enum_cache), isolate);
+        // An accumulator copies the keys into its own storage. Without one
+        // the result escapes to the caller; do not leak the enum cache, as it
+        // might end up as an elements backing store (see
+        // GetOwnKeysWithUninitializedEnumLength).
+        if (accumulator != nullptr) return keys;
+        return isolate->factory()->CopyFixedArray(keys);
+      }
+    }
+  }
   int length = dictionary->NumberOfEnumerableProperties();
   Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
   CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
+  if constexpr (std::is_same_v<T, NameDictionary>) {
+    // The storage contains the enumerable string keys in enumeration order
+    // regardless of {mode}.
+    dictionary->set_enum_cache(*storage);
+    if (accumulator == nullptr) {
+      // As above, hand an escaping caller a copy rather than the cache.
+      return isolate->factory()->CopyFixedArray(storage);
+    }
+  }
   return storage;
 }
 
@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_INL_H_
 #define V8_OBJECTS_LOOKUP_CACHE_INL_H_
 
+#include <utility>
+
 #include "src/objects/lookup-cache.h"
 #include "src/objects/map.h"
 #include "src/objects/name-inl.h"
@@ -18,15 +20,24 @@ int DescriptorLookupCache::Hash(Tagged<Map> source, Tagged<Name> name) {
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
   uint32_t name_hash = name->hash();
-  return (source_hash ^ name_hash) % kLength;
+  return (source_hash ^ name_hash) % kSets;
 }
 
 int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  // Pointers in the table might be stale, so use SafeEquals.
-  if (key.source.SafeEquals(source) && key.name.SafeEquals(name)) {
-    return results_[index];
+  int index = Hash(source, name) * kWays;
+  for (int way = 0; way < kWays; way++) {
+    Key& key = keys_[index + way];
+    // Pointers in the table might be stale, so use SafeEquals.
+    if (key.source.SafeEquals(source) && key.name.SafeEquals(name)) {
+      int result = results_[index + way];
+      if (way != 0) {
+        // Move the entry to the first way, so that repeated lookups hit it
+        // without probing and eviction prefers colder entries.
+        std::swap(keys_[index], keys_[index + way]);
+        std::swap(results_[index], results_[index + way]);
+      }
+      return result;
+    }
   }
   return kAbsent;
 }
@@ -34,10 +45,14 @@ int DescriptorLookupCache::Lookup(Tagged<Map> source, Tagged<Name> name) {
 void DescriptorLookupCache::Update(Tagged<Map> source, Tagged<Name> name,
                                    int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  key.source = source;
-  key.name = name;
+  static_assert(kWays == 2);
+  int index = Hash(source, name) * kWays;
+  // Insert in front, shifting the previous front entry into the second way
+  // and evicting the least recently used one.
+  keys_[index + 1] = keys_[index];
+  results_[index + 1] = results_[index];
+  keys_[index].source = source;
+  keys_[index].name = name;
   results_[index] = result;
 }
 
@@ -11,5 +11,12 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void JsonShapeCache::Clear() {
+  for (int index = 0; index < kLength; index++) {
+    hashes_[index] = 0;
+    maps_[index] = Map();
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/base/bits.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -43,7 +44,13 @@ class DescriptorLookupCache {
 
   static inline int Hash(Tagged<Map> source, Tagged<Name> name);
 
-  static const int kLength = 64;
+  // The cache is two-way set-associative with the most recently used entry
+  // of each set in the first way. A direct-mapped cache thrashes on maps
+  // with many properties, where slow-path lookups for different names on the
+  // same map keep evicting each other.
+  static const int kSets = 128;
+  static const int kWays = 2;
+  static const int kLength = kSets * kWays;
   struct Key {
     Tagged<Map> source;
     Tagged<Name> name;
@@ -55,6 +62,50 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache for mapping a hash of a JSON object's property-name sequence to the
+// final map of a previously built object with that shape. Entries are purely
+// heuristic: the JSON parser verifies every property key against the map's
+// descriptors before using it, so hash collisions and stale shapes only cost
+// the fast path, never correctness. Cleared at startup and prior to any
+// mark-compact, the only GC that can move or free maps.
+class JsonShapeCache {
+ public:
+  JsonShapeCache(const JsonShapeCache&) = delete;
+  JsonShapeCache& operator=(const JsonShapeCache&) = delete;
+
+  // Returns the cached map for {hash}, or a null map on a miss.
+  Tagged<Map> Lookup(uint32_t hash) {
+    int index = HashToIndex(hash);
+    if (hashes_[index] == hash) return maps_[index];
+    return Tagged<Map>();
+  }
+
+  // Update an element in the cache.
+  void Update(uint32_t hash, Tagged<Map> map) {
+    int index = HashToIndex(hash);
+    hashes_[index] = hash;
+    maps_[index] = map;
+  }
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  JsonShapeCache() { Clear(); }
+
+  static int HashToIndex(uint32_t hash) {
+    return static_cast<int>(hash & (kLength - 1));
+  }
+
+  static const int kLength = 256;
+  static_assert(base::bits::IsPowerOfTwo(kLength));
+
+  uint32_t hashes_[kLength];
+  Tagged<Map> maps_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
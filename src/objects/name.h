@@ -57,6 +57,15 @@ V8_OBJECT class Name : public PrimitiveHeapObject {
   // Sets the hash field only if it is empty. Otherwise does nothing.
   inline void set_raw_hash_field_if_empty(uint32_t hash);
 
+  // Sets the hash field only if it still contains {expected}. Returns false
+  // if the field was concurrently transitioned to another state (e.g. a
+  // forwarding index).
+  inline bool try_set_raw_hash_field(uint32_t expected, uint32_t hash) {
+    return raw_hash_field_.compare_exchange_strong(expected, hash,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_relaxed);
+  }
+
   // Returns a hash value used for the property table (same as Hash()), assumes
   // the hash is already computed.
   inline uint32_t hash() const;
@@ -190,6 +190,7 @@ namespace internal {
   V(JSSetIterator)                              \
   V(JSShadowRealm)                              \
   V(JSSharedArray)                              \
+  V(JSSharedMap)                                \
   V(JSSharedStruct)                             \
   V(JSSpecialObject)                            \
   V(JSStringIterator)                           \
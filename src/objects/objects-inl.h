@@ -1562,7 +1562,8 @@ bool Object::CanBeHeldWeakly(Tagged<Object> obj) {
     // to shared values in weak collections. For now, disallow them as weak
     // collection keys.
     if (v8_flags.harmony_struct) {
-      return !IsJSSharedStruct(obj) && !IsJSSharedArray(obj);
+      return !IsJSSharedStruct(obj) && !IsJSSharedArray(obj) &&
+             !IsJSSharedMap(obj);
     }
     return true;
   }
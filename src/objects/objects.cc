@@ -42,6 +42,7 @@
 #include "src/heap/read-only-heap.h"
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
+#include "src/logging/counters-scopes.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -5845,8 +5846,22 @@ Handle<Derived> ObjectHashTableBase<Derived, Shape>::Put(Isolate* isolate,
 
   RehashObjectHashTableAndGCIfNeeded(isolate, table);
 
-  // Check whether the hash table should be extended.
-  table = Derived::EnsureCapacity(isolate, table);
+  // Check whether the hash table should be extended. Growing rehashes every
+  // entry into a fresh backing store in one go, so for very large tables
+  // (e.g. WeakMap backing stores) grow by more than the default factor of
+  // two: this halves both the number of rehash pauses the mutator observes
+  // and the total number of entries copied over the table's lifetime, at the
+  // cost of some slack. The pause is recorded in a histogram so it can be
+  // spotted next to the GC timers.
+  if (V8_UNLIKELY(!table->HasSufficientCapacityToAdd(1))) {
+    constexpr int kMinCapacityForAcceleratedGrowth = 1 << 16;
+    int additional = 1;
+    if (table->Capacity() >= kMinCapacityForAcceleratedGrowth) {
+      additional = table->NumberOfElements() + 1;
+    }
+    TimedHistogramScope timer(isolate->counters()->object_hash_table_grow());
+    table = Derived::EnsureCapacity(isolate, table, additional);
+  }
   table->AddEntry(table->FindInsertionEntry(isolate, hash), *key, *value);
   return table;
 }
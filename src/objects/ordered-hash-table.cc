@@ -215,6 +215,114 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   return table;
 }
 
+// static
+bool OrderedHashSet::HasKeyWithHash(Tagged<OrderedHashSet> table,
+                                    Tagged<Object> key, int raw_hash) {
+  DisallowGarbageCollection no_gc;
+  int raw_entry = table->HashToEntryRaw(raw_hash);
+  while (raw_entry != kNotFound) {
+    if (Object::SameValueZero(table->KeyAt(InternalIndex(raw_entry)), key)) {
+      return true;
+    }
+    raw_entry = table->NextChainEntryRaw(raw_entry);
+  }
+  return false;
+}
+
+// static
+void OrderedHashSet::AddNoGrow(Tagged<OrderedHashSet> table,
+                               Tagged<Object> key, int raw_hash) {
+  DisallowGarbageCollection no_gc;
+  DCHECK_LT(table->UsedCapacity(), table->Capacity());
+  DCHECK(!HasKeyWithHash(table, key, raw_hash));
+  int bucket = table->HashToBucket(raw_hash);
+  int previous_entry = table->HashToEntryRaw(raw_hash);
+  int nof = table->NumberOfElements();
+  int new_entry = nof + table->NumberOfDeletedElements();
+  int new_index = table->EntryToIndexRaw(new_entry);
+  table->set(new_index, key);
+  table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
+  table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+  table->SetNumberOfElements(nof + 1);
+}
+
+// static
+MaybeHandle<OrderedHashSet> OrderedHashSet::Union(Isolate* isolate,
+                                                  Handle<OrderedHashSet> table,
+                                                  Handle<OrderedHashSet> other) {
+  DCHECK(!table->IsObsolete());
+  DCHECK(!other->IsObsolete());
+
+  int required = table->NumberOfElements() + other->NumberOfElements();
+  if (required > MaxCapacity()) {
+    // The sum overestimates the union size when the inputs overlap; compute
+    // the exact size so that only a genuinely oversized result throws.
+    DisallowGarbageCollection no_gc;
+    Tagged<OrderedHashSet> raw_table = *table;
+    Tagged<OrderedHashSet> raw_other = *other;
+    required = raw_table->NumberOfElements();
+    for (InternalIndex entry : raw_other->IterateEntries()) {
+      Tagged<Object> key = raw_other->KeyAt(entry);
+      if (IsHashTableHole(key, isolate)) continue;
+      int raw_hash = Smi::ToInt(Object::GetHash(key));
+      if (!HasKeyWithHash(raw_table, key, raw_hash)) required++;
+    }
+  }
+
+  if (table->UsedCapacity() + other->NumberOfElements() > table->Capacity()) {
+    // Grow (and compact) once up front instead of rehashing repeatedly while
+    // inserting. Rehash rounds the capacity up to a power of two.
+    MaybeHandle<OrderedHashSet> grown = Rehash(isolate, table, required);
+    if (!grown.ToHandle(&table)) return grown;
+  }
+
+  DisallowGarbageCollection no_gc;
+  Tagged<OrderedHashSet> raw_table = *table;
+  Tagged<OrderedHashSet> raw_other = *other;
+  for (InternalIndex entry : raw_other->IterateEntries()) {
+    Tagged<Object> key = raw_other->KeyAt(entry);
+    if (IsHashTableHole(key, isolate)) continue;
+    int raw_hash = Smi::ToInt(Object::GetHash(key));
+    if (HasKeyWithHash(raw_table, key, raw_hash)) continue;
+    AddNoGrow(raw_table, key, raw_hash);
+  }
+  return table;
+}
+
+// static
+MaybeHandle<OrderedHashSet> OrderedHashSet::Intersection(
+    Isolate* isolate, Handle<OrderedHashSet> lhs, Handle<OrderedHashSet> rhs) {
+  DCHECK(!lhs->IsObsolete());
+  DCHECK(!rhs->IsObsolete());
+
+  // Iterate the smaller input and probe the larger one. Ties keep |lhs|, so
+  // the result order matches the Torque fast path, which walks the receiver
+  // when both sizes are equal.
+  if (lhs->NumberOfElements() > rhs->NumberOfElements()) {
+    std::swap(lhs, rhs);
+  }
+
+  Handle<OrderedHashSet> result;
+  if (!Allocate(isolate, lhs->NumberOfElements()).ToHandle(&result)) {
+    return {};
+  }
+
+  DisallowGarbageCollection no_gc;
+  Tagged<OrderedHashSet> raw_lhs = *lhs;
+  Tagged<OrderedHashSet> raw_rhs = *rhs;
+  Tagged<OrderedHashSet> raw_result = *result;
+  for (InternalIndex entry : raw_lhs->IterateEntries()) {
+    Tagged<Object> key = raw_lhs->KeyAt(entry);
+    if (IsHashTableHole(key, isolate)) continue;
+    int raw_hash = Smi::ToInt(Object::GetHash(key));
+    if (!HasKeyWithHash(raw_rhs, key, raw_hash)) continue;
+    // |result| is pre-sized for the worst case and the keys of |lhs| are
+    // unique, so neither growth nor duplicate checks are needed.
+    AddNoGrow(raw_result, key, raw_hash);
+  }
+  return result;
+}
+
 Handle<FixedArray> OrderedHashSet::ConvertToKeysArray(
     Isolate* isolate, Handle<OrderedHashSet> table, GetKeysConversion convert) {
   int length = table->NumberOfElements();
@@ -353,6 +461,29 @@ bool OrderedHashTable<Derived, entrysize>::Delete(Isolate* isolate,
   InternalIndex entry = table->FindEntry(isolate, key);
   if (entry.is_not_found()) return false;
 
+  // Unlink the entry from its hash chain so that lookups in this bucket no
+  // longer have to step over it. The entry itself must stay in the data
+  // region as a hole: insertion-order iteration and the entry numbering that
+  // live iterators rely on depend on it. Without unlinking, delete-heavy
+  // tables accumulate dead links on the lookup path until the next rehash.
+  {
+    const int raw_entry = entry.as_int();
+    const int next_entry = table->NextChainEntryRaw(raw_entry);
+    const int hash = Smi::ToInt(Object::GetHash(key));
+    int current = table->HashToEntryRaw(hash);
+    if (current == raw_entry) {
+      const int bucket = table->HashToBucket(hash);
+      table->set(HashTableStartIndex() + bucket, Smi::FromInt(next_entry));
+    } else {
+      while (table->NextChainEntryRaw(current) != raw_entry) {
+        current = table->NextChainEntryRaw(current);
+        DCHECK_NE(current, kNotFound);
+      }
+      table->set(table->EntryToIndexRaw(current) + kChainOffset,
+                 Smi::FromInt(next_entry));
+    }
+  }
+
   int nof = table->NumberOfElements();
   int nod = table->NumberOfDeletedElements();
   int index = table->EntryToIndex(entry);
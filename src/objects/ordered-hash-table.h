@@ -279,6 +279,26 @@ class V8_EXPORT_PRIVATE OrderedHashSet
   static MaybeHandle<OrderedHashSet> Add(Isolate* isolate,
                                          Handle<OrderedHashSet> table,
                                          Handle<Object> value);
+
+  // Bulk kernels backing the large-set fast paths of Set.prototype.union and
+  // Set.prototype.intersection. Both compute each key's hash only once and
+  // pre-size for the worst case so that per-element growth checks are not
+  // needed.
+  //
+  // Union adds every key of |other| that is missing from |table| to |table|,
+  // growing it at most once, and returns the resulting table. The caller must
+  // exclusively own |table|, e.g. as a fresh copy of a receiver's backing
+  // that no iterator has seen yet.
+  static MaybeHandle<OrderedHashSet> Union(Isolate* isolate,
+                                           Handle<OrderedHashSet> table,
+                                           Handle<OrderedHashSet> other);
+
+  // Intersection returns a new table holding the keys present in both inputs,
+  // in the insertion order of the smaller input.
+  static MaybeHandle<OrderedHashSet> Intersection(Isolate* isolate,
+                                                  Handle<OrderedHashSet> lhs,
+                                                  Handle<OrderedHashSet> rhs);
+
   static Handle<FixedArray> ConvertToKeysArray(Isolate* isolate,
                                                Handle<OrderedHashSet> table,
                                                GetKeysConversion convert);
@@ -301,6 +321,14 @@ class V8_EXPORT_PRIVATE OrderedHashSet
   static const int kPrefixSize = 0;
 
   OBJECT_CONSTRUCTORS(OrderedHashSet, OrderedHashTable<OrderedHashSet, 1>);
+
+ private:
+  // Helpers for the bulk kernels above. |raw_hash| must be the key's hash as
+  // computed by Object::GetHash.
+  static bool HasKeyWithHash(Tagged<OrderedHashSet> table, Tagged<Object> key,
+                             int raw_hash);
+  static void AddNoGrow(Tagged<OrderedHashSet> table, Tagged<Object> key,
+                        int raw_hash);
 };
 
 class V8_EXPORT_PRIVATE OrderedHashMap
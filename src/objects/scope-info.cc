@@ -6,8 +6,13 @@
 
 #include <stdlib.h>
 
+#include <type_traits>
+
 #include "src/ast/scopes.h"
 #include "src/ast/variables.h"
+#include "src/base/functional.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-inl.h"
 #include "src/init/bootstrapper.h"
 #include "src/objects/module-inl.h"
 #include "src/objects/objects-inl.h"
@@ -420,6 +425,11 @@ Handle<ScopeInfo> ScopeInfo::Create(IsolateT* isolate, Zone* zone, Scope* scope,
   DCHECK_EQ(parameter_count, scope_info_handle->ParameterCount());
   DCHECK_EQ(scope->num_heap_slots(), scope_info_handle->ContextLength());
 
+  if constexpr (std::is_same_v<IsolateT, Isolate>) {
+    if (V8_UNLIKELY(v8_flags.deduplicate_compilation_metadata)) {
+      return ScopeInfoDedupCache::Canonicalize(isolate, scope_info_handle);
+    }
+  }
   return scope_info_handle;
 }
 
@@ -432,6 +442,54 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
                                         Scope* scope,
                                         MaybeHandle<ScopeInfo> outer_scope);
 
+// static
+Handle<ScopeInfo> ScopeInfoDedupCache::Canonicalize(
+    Isolate* isolate, Handle<ScopeInfo> scope_info) {
+  DisallowGarbageCollection no_gc;
+  Tagged<ScopeInfo> raw = *scope_info;
+  // ScopeInfos with function name slots are written to after creation when
+  // the SharedFunctionInfo they belong to is (re)named, so they have to stay
+  // per-function.
+  if (raw->HasFunctionName() || raw->HasInferredFunctionName()) {
+    return scope_info;
+  }
+  const int length = raw->length();
+  size_t running_hash = base::hash_value(length);
+  for (int i = 0; i < length; ++i) {
+    running_hash = base::hash_combine(running_hash, raw->get(i).ptr());
+  }
+  const uint32_t hash = static_cast<uint32_t>(running_hash);
+  const Tagged<Smi> hash_smi = Smi::FromInt(static_cast<int>(hash >> 2));
+  Tagged<FixedArray> cache = isolate->heap()->scope_info_dedup_cache();
+  const int index = static_cast<int>(hash % kCacheSize) * kEntrySize;
+  if (cache->get(index + kHashOffset) == hash_smi) {
+    Tagged<Object> cached = cache->get(index + kScopeInfoOffset);
+    if (IsScopeInfo(cached)) {
+      Tagged<ScopeInfo> cached_info = ScopeInfo::cast(cached);
+      if (cached_info->length() == length) {
+        bool equals = true;
+        for (int i = 0; i < length; ++i) {
+          if (cached_info->get(i) != raw->get(i)) {
+            equals = false;
+            break;
+          }
+        }
+        if (equals) return handle(cached_info, isolate);
+      }
+    }
+  }
+  cache->set(index + kHashOffset, hash_smi);
+  cache->set(index + kScopeInfoOffset, raw);
+  return scope_info;
+}
+
+// static
+void ScopeInfoDedupCache::Clear(Tagged<FixedArray> cache) {
+  for (int i = 0; i < cache->length(); i++) {
+    cache->set(i, Smi::zero());
+  }
+}
+
 // static
 Handle<ScopeInfo> ScopeInfo::CreateForWithScope(
     Isolate* isolate, MaybeHandle<ScopeInfo> outer_scope) {
@@ -384,6 +384,7 @@ class ScopeInfo : public TorqueGeneratedScopeInfo<ScopeInfo, HeapObject> {
   DEFINE_TORQUE_GENERATED_VARIABLE_PROPERTIES()
 
   friend class ScopeIterator;
+  friend class ScopeInfoDedupCache;
   friend std::ostream& operator<<(std::ostream& os, VariableAllocationInfo var);
 
   TQ_OBJECT_CONSTRUCTORS(ScopeInfo)
@@ -392,6 +393,25 @@ class ScopeInfo : public TorqueGeneratedScopeInfo<ScopeInfo, HeapObject> {
 
 std::ostream& operator<<(std::ostream& os, VariableAllocationInfo var);
 
+// Caches recently created ScopeInfos keyed by their slot contents so that
+// functions with identical scope shapes share one ScopeInfo
+// (--deduplicate-compilation-metadata). Lives in a FixedArray heap root and is
+// flushed on each full GC, like the other isolate caches.
+class ScopeInfoDedupCache final : public AllStatic {
+ public:
+  // Returns a previously cached ScopeInfo with the same contents if there is
+  // one, and enters `scope_info` into the cache otherwise. Must only be
+  // called on the main thread.
+  static Handle<ScopeInfo> Canonicalize(Isolate* isolate,
+                                        Handle<ScopeInfo> scope_info);
+  static void Clear(Tagged<FixedArray> cache);
+
+  static constexpr int kCacheSize = 0x100;
+  static constexpr int kHashOffset = 0;
+  static constexpr int kScopeInfoOffset = 1;
+  static constexpr int kEntrySize = 2;
+};
+
 }  // namespace internal
 }  // namespace v8
 
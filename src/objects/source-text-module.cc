@@ -364,6 +364,28 @@ bool SourceTextModule::PrepareInstantiate(
     }
   }
 
+  // Pre-size the export table for all local and indirect exports, so that the
+  // insertions below don't repeatedly grow and rehash it. Large module graphs
+  // instantiate thousands of modules in one go, where the incremental growth
+  // is noticeable during linking.
+  Handle<FixedArray> special_exports(module_info->special_exports(), isolate);
+  {
+    int export_count = 0;
+    for (int i = 0, n = module_info->RegularExportCount(); i < n; ++i) {
+      export_count += module_info->RegularExportExportNames(i)->length();
+    }
+    for (int i = 0, n = special_exports->length(); i < n; ++i) {
+      Tagged<SourceTextModuleInfoEntry> entry =
+          SourceTextModuleInfoEntry::cast(special_exports->get(i));
+      if (!IsUndefined(entry->export_name(), isolate)) ++export_count;
+    }
+    if (export_count > 0) {
+      Handle<ObjectHashTable> exports(module->exports(), isolate);
+      exports = ObjectHashTable::EnsureCapacity(isolate, exports, export_count);
+      module->set_exports(*exports);
+    }
+  }
+
   // Set up local exports.
   // TODO(neis): Create regular_exports array here instead of in factory method?
   for (int i = 0, n = module_info->RegularExportCount(); i < n; ++i) {
@@ -378,7 +400,6 @@ bool SourceTextModule::PrepareInstantiate(
   // table and store its SourceTextModuleInfoEntry there.  When we later find
   // the correct Cell in the module that actually provides the value, we replace
   // the SourceTextModuleInfoEntry by that Cell (see ResolveExport).
-  Handle<FixedArray> special_exports(module_info->special_exports(), isolate);
   for (int i = 0, n = special_exports->length(); i < n; ++i) {
     Handle<SourceTextModuleInfoEntry> entry(
         SourceTextModuleInfoEntry::cast(special_exports->get(i)), isolate);
@@ -92,6 +92,15 @@ class StringTable::Data {
   OffHeapStringHashSet& table() { return table_; }
   const OffHeapStringHashSet& table() const { return table_; }
 
+  // Layout description for generated-code probes, see
+  // StringTable::CapacityOffset and StringTable::ElementsOffset.
+  static constexpr int OffsetOfCapacity() {
+    return offsetof(Data, table_.capacity_);
+  }
+  static constexpr int OffsetOfElements() {
+    return offsetof(Data, table_.elements_);
+  }
+
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
@@ -171,7 +180,7 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::AdaptiveMutexGuard table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->table().number_of_elements();
   }
 }
@@ -442,7 +451,7 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::AdaptiveMutexGuard table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
     OffHeapStringHashSet& table = data->table();
@@ -668,13 +677,73 @@ Address StringTable::TryStringToIndexOrLookupExisting(Isolate* isolate,
       isolate, string, source, start);
 }
 
+template <typename Char>
+void StringTable::TryRecordInternalizedForwardingImpl(Isolate* isolate,
+                                                      Tagged<String> string,
+                                                      uint32_t raw_hash_field) {
+  DisallowGarbageCollection no_gc;
+
+  const int length = string->length();
+  SharedStringAccessGuardIfNeeded access_guard(isolate);
+  const Char* chars = string->GetDirectStringChars<Char>(no_gc, access_guard);
+  // The key is only used for probing, never for insertion, so no conversion
+  // is requested.
+  SequentialStringKey<Char> key(raw_hash_field,
+                                base::Vector<const Char>(chars, length));
+
+  // An optimistic, read-only probe of the current table, like the fast path of
+  // TryStringToIndexOrLookupExisting. A racing resize at worst causes a false
+  // miss, which just means we don't record a forwarding this time.
+  Data* data = data_.load(std::memory_order_acquire);
+  InternalIndex entry = data->table().FindEntry(isolate, &key, key.hash());
+  if (entry.is_not_found()) return;
+
+  Tagged<String> internalized =
+      String::cast(data->table().GetKey(isolate, entry));
+  const int forwarding_index =
+      isolate->string_forwarding_table()->AddForwardString(string,
+                                                           internalized);
+  // Transition the hash field to the forwarding index, unless the string was
+  // concurrently transitioned (e.g. internalized by the mutator). A lost race
+  // leaves a stale forwarding record, which the GC-time cleaner skips.
+  string->try_set_raw_hash_field(
+      raw_hash_field,
+      String::CreateInternalizedForwardingIndex(forwarding_index));
+}
+
+void StringTable::TryRecordInternalizedForwarding(Isolate* isolate,
+                                                  Tagged<String> string,
+                                                  uint32_t raw_hash_field) {
+  // Recording a forwarding index for a string that is not in the shared heap
+  // is only valid when all strings go through the forwarding table, as
+  // MakeThin-based internalization does not expect unrelated forwarding
+  // indices.
+  DCHECK(v8_flags.always_use_string_forwarding_table);
+  DCHECK(Name::IsHash(raw_hash_field));
+  DCHECK(string->IsFlat());
+
+  if (string->IsOneByteRepresentation()) {
+    TryRecordInternalizedForwardingImpl<uint8_t>(isolate, string,
+                                                 raw_hash_field);
+  } else {
+    TryRecordInternalizedForwardingImpl<uint16_t>(isolate, string,
+                                                  raw_hash_field);
+  }
+}
+
+// static
+int StringTable::CapacityOffset() { return Data::OffsetOfCapacity(); }
+
+// static
+int StringTable::ElementsOffset() { return Data::OffsetOfElements(); }
+
 void StringTable::InsertForIsolateDeserialization(
     Isolate* isolate, const std::vector<Handle<String>>& strings) {
   DCHECK_EQ(NumberOfElements(), 0);
 
   const int length = static_cast<int>(strings.size());
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::AdaptiveMutexGuard table_write_guard(&write_mutex_);
 
     Data* const data = EnsureCapacity(isolate, length);
 
@@ -696,7 +765,7 @@ void StringTable::InsertForIsolateDeserialization(
 void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
   DCHECK_EQ(NumberOfElements(), 0);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::AdaptiveMutexGuard table_write_guard(&write_mutex_);
 
     Data* const data = EnsureCapacity(isolate, 1);
 
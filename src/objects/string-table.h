@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -66,12 +68,32 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Probe the table for a string equal to {string} without modifying the
+  // table. On a hit, a forwarding entry towards the existing internalized
+  // string is recorded in the string forwarding table and {string}'s hash
+  // field is transitioned to the forwarding index, so that the string is
+  // internalized in place during the next full GC. Safe to call concurrently
+  // from background threads; the hash field transition uses a CAS from
+  // {raw_hash_field}, and a lost race merely leaves a stale forwarding record
+  // that the GC tolerates. Requires --always-use-string-forwarding-table.
+  void TryRecordInternalizedForwarding(Isolate* isolate, Tagged<String> string,
+                                       uint32_t raw_hash_field);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
   static Address TryStringToIndexOrLookupExisting(Isolate* isolate,
                                                   Address raw_string);
 
+  // Access for generated code to probe the current table without calling into
+  // C++ (see CodeStubAssembler::TryProbeStringTable). {data_address} is the
+  // address of the pointer to the current table data, and the offsets describe
+  // the table layout relative to that pointer. Such probes are read-only and
+  // concurrent with insertion; a racing resize at worst causes a false miss.
+  Address data_address() { return reinterpret_cast<Address>(&data_); }
+  static int CapacityOffset();
+  static int ElementsOffset();
+
   // Insert a range of strings. Only for use during isolate deserialization.
   void InsertForIsolateDeserialization(
       Isolate* isolate, const std::vector<Handle<String>>& strings);
@@ -96,10 +118,15 @@ class V8_EXPORT_PRIVATE StringTable {
 
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
+  template <typename Char>
+  void TryRecordInternalizedForwardingImpl(Isolate* isolate,
+                                           Tagged<String> string,
+                                           uint32_t raw_hash_field);
+
   std::atomic<Data*> data_;
   // Write mutex is mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  mutable base::AdaptiveMutex write_mutex_;
   Isolate* isolate_;
 };
 
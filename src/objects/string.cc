@@ -16,6 +16,7 @@
 #include "src/heap/memory-chunk.h"
 #include "src/heap/read-only-heap.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/background-string-flattener.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/map.h"
 #include "src/objects/oddball.h"
@@ -91,6 +92,8 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
     result = flat;
   }
   {
+    // The background string flattener may be traversing this cons tree.
+    BackgroundStringFlattener::MutationScope mutation_scope(isolate);
     DisallowGarbageCollection no_gc;
     Tagged<ConsString> raw_cons = *cons;
     raw_cons->set_first(*result);
@@ -207,6 +210,11 @@ void String::MakeThin(IsolateT* isolate, Tagged<String> internalized) {
   }
 #endif
 
+  // The transition clobbers the character payload (and, for external strings,
+  // the resource pointer), which must not be observed by a concurrent
+  // background flatten.
+  BackgroundStringFlattener::MutationScope mutation_scope(isolate);
+
   bool may_contain_recorded_slots = initial_shape.IsIndirect();
   int old_size = SizeFromMap(initial_map);
   ReadOnlyRoots roots(isolate);
@@ -432,6 +440,11 @@ bool String::MakeExternal(v8::String::ExternalStringResource* resource) {
   bool is_internalized = IsInternalizedString(this);
   bool has_pointers = StringShape(this).IsIndirect();
 
+  // Externalization overwrites the character payload in place, which must not
+  // be observed by a concurrent background flatten. The flatten worker holds
+  // the flattener's content mutex while taking the internalized-string access
+  // lock for each chunk, so the content mutex must be acquired first here.
+  BackgroundStringFlattener::MutationScope mutation_scope(isolate);
   base::SharedMutexGuardIf<base::kExclusive> shared_mutex_guard(
       isolate->internalized_string_access(), is_internalized);
   // Morph the string to an external string by replacing the map and
@@ -523,6 +536,11 @@ bool String::MakeExternal(v8::String::ExternalOneByteStringResource* resource) {
   bool is_internalized = IsInternalizedString(this);
   bool has_pointers = StringShape(this).IsIndirect();
 
+  // Externalization overwrites the character payload in place, which must not
+  // be observed by a concurrent background flatten. The flatten worker holds
+  // the flattener's content mutex while taking the internalized-string access
+  // lock for each chunk, so the content mutex must be acquired first here.
+  BackgroundStringFlattener::MutationScope mutation_scope(isolate);
   base::SharedMutexGuardIf<base::kExclusive> shared_mutex_guard(
       isolate->internalized_string_access(), is_internalized);
   // Morph the string to an external string by replacing the map and
@@ -186,6 +186,14 @@ void ObjectTemplateInfo::set_code_like(bool is_code_like) {
   return set_data(IsCodeKindBit::update(data(), is_code_like));
 }
 
+bool ObjectTemplateInfo::should_pretenure() const {
+  return ShouldPretenureBit::decode(data());
+}
+
+void ObjectTemplateInfo::set_should_pretenure(bool should_pretenure) {
+  return set_data(ShouldPretenureBit::update(data(), should_pretenure));
+}
+
 bool FunctionTemplateInfo::IsTemplateFor(Tagged<JSObject> object) const {
   return IsTemplateFor(object->map());
 }
@@ -300,11 +300,11 @@ Handle<JSObject> DictionaryTemplateInfo::NewInstance(
   }
 
   // General case: We either don't have a cached map, or it is unusuable for the
-  // values provided.
+  // values provided. Walk the transition tree to the fully populated map
+  // first, and only then allocate the object, instead of migrating a live
+  // object through every intermediate shape.
   Handle<Map> current_map = isolate->factory()->ObjectLiteralMapFromCache(
       context, num_properties_set);
-  Handle<JSObject> object = isolate->factory()->NewJSObjectFromMap(current_map);
-  int current_property_index = 0;
   for (int i = 0; i < static_cast<int>(property_values.size()); ++i) {
     Local<Value> property_value;
     if (!property_values[i].ToLocal(&property_value)) {
@@ -322,10 +322,42 @@ Handle<JSObject> DictionaryTemplateInfo::NewInstance(
       return CreateSlowJSObjectWithProperties(
           isolate, property_names, property_values, num_properties_set);
     }
-    JSObject::MigrateToMap(isolate, object, current_map);
-    PropertyDetails details = current_map->GetLastDescriptorDetails(isolate);
-    object->WriteToField(InternalIndex(current_property_index), details,
-                         *value);
+  }
+  auto descriptors = handle(current_map->instance_descriptors(), isolate);
+  // Double representation means mutable heap number; box such values so that
+  // the field owns its own storage. This must happen before the object itself
+  // is allocated: a GC triggered by the number allocation would otherwise
+  // observe a partially initialized object with non-number values in
+  // double-representation fields (just like the cached-map path above).
+  {
+    int current_property_index = 0;
+    for (int i = 0; i < static_cast<int>(property_values.size()); ++i) {
+      Local<Value> property_value;
+      if (!property_values[i].ToLocal(&property_value)) {
+        continue;
+      }
+      const auto details =
+          descriptors->GetDetails(InternalIndex(current_property_index));
+      if (details.representation().Equals(Representation::Double())) {
+        Handle<Object> value = Utils::OpenHandle(*property_value);
+        property_values[i] = ToApiHandle<v8::Object>(
+            isolate->factory()->NewHeapNumber(Object::Number(*value)));
+      }
+      current_property_index++;
+    }
+  }
+  Handle<JSObject> object = isolate->factory()->NewJSObjectFromMap(current_map);
+  DisallowGarbageCollection no_gc;
+  int current_property_index = 0;
+  for (int i = 0; i < static_cast<int>(property_values.size()); ++i) {
+    Local<Value> property_value;
+    if (!property_values[i].ToLocal(&property_value)) {
+      continue;
+    }
+    Handle<Object> value = Utils::OpenHandle(*property_value);
+    const FieldIndex index = FieldIndex::ForPropertyIndex(
+        *current_map, current_property_index, Representation::Tagged());
+    object->FastPropertyAtPut(index, *value);
     current_property_index++;
   }
   if (can_use_map_cache) {
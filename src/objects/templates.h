@@ -211,6 +211,7 @@ class ObjectTemplateInfo
   DECL_INT_ACCESSORS(embedder_field_count)
   DECL_BOOLEAN_ACCESSORS(immutable_proto)
   DECL_BOOLEAN_ACCESSORS(code_like)
+  DECL_BOOLEAN_ACCESSORS(should_pretenure)
 
   // Starting from given object template's constructor walk up the inheritance
   // chain till a function template that has an instance template is found.
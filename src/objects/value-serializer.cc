@@ -295,6 +295,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetTreatArrayBuffersAsOutOfBand(bool mode) {
+  treat_array_buffers_as_out_of_band_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -627,6 +631,7 @@ Maybe<bool> ValueSerializer::WriteJSReceiver(Handle<JSReceiver> receiver) {
       return WriteJSSharedStruct(Handle<JSSharedStruct>::cast(receiver));
     case JS_ATOMICS_MUTEX_TYPE:
     case JS_ATOMICS_CONDITION_TYPE:
+    case JS_SHARED_MAP_TYPE:
       return WriteSharedObject(receiver);
 #if V8_ENABLE_WEBASSEMBLY
     case WASM_MODULE_OBJECT_TYPE:
@@ -953,6 +958,22 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     return ThrowDataCloneError(
         MessageTemplate::kDataCloneErrorDetachedArrayBuffer);
   }
+  if (treat_array_buffers_as_out_of_band_ && delegate_ &&
+      !array_buffer->is_resizable_by_js()) {
+    // Instead of copying the contents, write only a reference; the delegate
+    // keeps the backing store alive and the receiving side registers a
+    // corresponding buffer via ValueDeserializer::TransferArrayBuffer. Note
+    // that in contrast to an explicitly transferred buffer, this buffer is
+    // not detached, so both sides end up referencing the same backing store.
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    Maybe<uint32_t> index = delegate_->GetOutOfBandArrayBufferId(
+        v8_isolate, Utils::ToLocal(array_buffer));
+    RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+
+    WriteTag(SerializationTag::kArrayBufferTransfer);
+    WriteVarint(index.FromJust());
+    return ThrowIfOutOfMemory();
+  }
   size_t byte_length = array_buffer->byte_length();
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
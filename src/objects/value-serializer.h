@@ -97,6 +97,16 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether to serialize ArrayBuffers out of band, i.e. write only
+   * an id obtained from Delegate::GetOutOfBandArrayBufferId instead of the
+   * buffer's contents. This should not be called when no Delegate was
+   * passed.
+   *
+   * The default is to copy ArrayBuffer contents into the buffer.
+   */
+  void SetTreatArrayBuffersAsOutOfBand(bool mode);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -176,6 +186,7 @@ class ValueSerializer {
   size_t buffer_capacity_ = 0;
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool treat_array_buffers_as_out_of_band_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
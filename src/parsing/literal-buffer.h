@@ -38,6 +38,18 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of ASCII code units in one go. The buffer must still be
+  // one-byte when this is called.
+  V8_INLINE void AddAsciiChars(const uint16_t* code_units, int length) {
+    DCHECK(is_one_byte());
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    for (int i = 0; i < length; i++) {
+      DCHECK(IsValidAscii(static_cast<char>(code_units[i])));
+      backing_store_[position_ + i] = static_cast<uint8_t>(code_units[i]);
+    }
+    position_ += length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
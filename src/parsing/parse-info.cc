@@ -40,6 +40,8 @@ UnoptimizedCompileFlags::UnoptimizedCompileFlags(Isolate* isolate,
       v8_flags.parallel_compile_tasks_for_eager_toplevel);
   set_post_parallel_compile_tasks_for_lazy(
       v8_flags.parallel_compile_tasks_for_lazy);
+  set_post_parallel_compile_tasks_for_streaming(
+      v8_flags.parallel_compile_tasks_for_streaming);
 }
 
 // static
@@ -189,6 +191,18 @@ ReusableUnoptimizedCompileState::ReusableUnoptimizedCompileState(
 
 ReusableUnoptimizedCompileState::~ReusableUnoptimizedCompileState() = default;
 
+void ReusableUnoptimizedCompileState::Reset() {
+  // The AstValueFactory's string table points into the AstRawString Zone, so
+  // it has to be dropped before the Zones are reset and rebuilt afterwards.
+  ast_value_factory_.reset();
+  ast_raw_string_zone_.Reset();
+  single_parse_zone_.Reset();
+  ast_value_factory_.reset(new AstValueFactory(ast_raw_string_zone(),
+                                               single_parse_zone(),
+                                               ast_string_constants(),
+                                               hash_seed()));
+}
+
 ParseInfo::ParseInfo(const UnoptimizedCompileFlags flags,
                      UnoptimizedCompileState* state,
                      ReusableUnoptimizedCompileState* reusable_state,
@@ -61,6 +61,7 @@ class Zone;
   V(allow_lazy_compile, bool, 1, _)                             \
   V(post_parallel_compile_tasks_for_eager_toplevel, bool, 1, _) \
   V(post_parallel_compile_tasks_for_lazy, bool, 1, _)           \
+  V(post_parallel_compile_tasks_for_streaming, bool, 1, _)      \
   V(collect_source_positions, bool, 1, _)                       \
   V(is_repl_mode, bool, 1, _)                                   \
   V(produce_compile_hints, bool, 1, _)                          \
@@ -199,6 +200,13 @@ class V8_EXPORT_PRIVATE ReusableUnoptimizedCompileState {
 
   void NotifySingleParseCompleted() { single_parse_zone_.Reset(); }
 
+  // Makes this state reusable by a subsequent, unrelated compile. Both Zones
+  // keep their head segment for reuse instead of returning all memory to the
+  // allocator, and the AstValueFactory is rebuilt on top of them. The
+  // AstRawStrings interned so far are dropped, since after internalization
+  // they refer to Handles whose HandleScope may no longer exist.
+  void Reset();
+
   AstValueFactory* ast_value_factory() const {
     return ast_value_factory_.get();
   }
@@ -2730,6 +2730,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       eager_compile_hint == FunctionLiteral::kShouldLazyCompile;
   const bool is_top_level = AllowsLazyParsingWithoutUnresolvedVariables();
   const bool is_eager_top_level_function = !is_lazy && is_top_level;
+  const bool is_lazy_top_level_function = is_lazy && is_top_level;
 
   RCS_SCOPE(runtime_call_stats_, RuntimeCallCounterId::kParseFunctionLiteral,
             RuntimeCallStats::kThreadSpecific);
@@ -2754,7 +2755,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
-       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
+       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()) ||
+       // Speculatively compile lazy top-level functions of streamed scripts
+       // in parallel; these are the functions most likely to be called soon
+       // after the script runs (the same functions authors mark as PIFEs),
+       // so compiling them early avoids a first-call stall. Deeper-nested
+       // functions are skipped to bound wasted work.
+       (is_lazy_top_level_function && info()->is_streaming_compilation() &&
+        flags().post_parallel_compile_tasks_for_streaming()));
 
   // Determine whether we should lazy parse the inner function. This will be
   // when either the function is lazy by inspection, or when we force it to be
@@ -153,10 +153,13 @@ template <typename Char>
 class ChunkedStream {
  public:
   explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
-      : source_(source), chunks_(std::make_shared<std::vector<Chunk>>()) {}
+      : source_(source),
+        owns_chunk_data_(!source->ChunksOwnedByEmbedder()),
+        chunks_(std::make_shared<std::vector<Chunk>>()) {}
 
   ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
       : source_(nullptr),
+        owns_chunk_data_(other.owns_chunk_data_),
         chunks_(other.chunks_) {}
 
   // The no_gc argument is only here because of the templated way this class
@@ -166,7 +169,7 @@ class ChunkedStream {
     Chunk& chunk = FindChunk(pos, stats);
     size_t buffer_end = chunk.length;
     size_t buffer_pos = std::min(buffer_end, pos - chunk.position);
-    return {&chunk.data.get()[buffer_pos], &chunk.data.get()[buffer_end]};
+    return {&chunk.data[buffer_pos], &chunk.data[buffer_end]};
   }
 
   static const bool kCanBeCloned = true;
@@ -174,12 +177,26 @@ class ChunkedStream {
 
  private:
   struct Chunk {
-    Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    std::unique_ptr<const Char[]> data;
+    Chunk(const Char* data, size_t position, size_t length, bool owned)
+        : data(data), position(position), length(length), owned(owned) {}
+    ~Chunk() {
+      if (owned) delete[] data;
+    }
+    Chunk(Chunk&& other) V8_NOEXCEPT : data(other.data),
+                                       position(other.position),
+                                       length(other.length),
+                                       owned(other.owned) {
+      other.data = nullptr;
+    }
+    Chunk(const Chunk&) = delete;
+    Chunk& operator=(const Chunk&) = delete;
+    // Deleted on destruction if {owned}; otherwise the source stream keeps
+    // ownership, see ExternalSourceStream::ChunksOwnedByEmbedder.
+    const Char* data;
     // The logical position of data.
     const size_t position;
     const size_t length;
+    const bool owned;
     size_t end_position() const { return position + length; }
   };
 
@@ -206,7 +223,7 @@ class ChunkedStream {
     // Incoming data has to be aligned to Char size.
     DCHECK_EQ(0, length % sizeof(Char));
     chunks_->emplace_back(reinterpret_cast<const Char*>(data), position,
-                          length / sizeof(Char));
+                          length / sizeof(Char), owns_chunk_data_);
   }
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
@@ -224,6 +241,7 @@ class ChunkedStream {
   }
 
   ScriptCompiler::ExternalSourceStream* source_;
+  const bool owns_chunk_data_;
 
  protected:
   std::shared_ptr<std::vector<struct Chunk>> chunks_;
@@ -520,7 +538,8 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
       ScriptCompiler::ExternalSourceStream* source_stream)
       : chunks_(std::make_shared<std::vector<Chunk>>()),
         current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
-        source_stream_(source_stream) {}
+        source_stream_(source_stream),
+        owns_chunk_data_(!source_stream->ChunksOwnedByEmbedder()) {}
   ~Utf8ExternalStreamingStream() final = default;
 
   bool can_access_heap() const final { return false; }
@@ -559,17 +578,32 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   // - The chunk data (data pointer and length), and
   // - the position at the first byte of the chunk.
   struct Chunk {
-    Chunk(const uint8_t* data, size_t length, StreamPosition start)
-        : data(data), length(length), start(start) {}
-    std::unique_ptr<const uint8_t[]> data;
+    Chunk(const uint8_t* data, size_t length, StreamPosition start, bool owned)
+        : data(data), length(length), start(start), owned(owned) {}
+    ~Chunk() {
+      if (owned) delete[] data;
+    }
+    Chunk(Chunk&& other) V8_NOEXCEPT : data(other.data),
+                                       length(other.length),
+                                       start(other.start),
+                                       owned(other.owned) {
+      other.data = nullptr;
+    }
+    Chunk(const Chunk&) = delete;
+    Chunk& operator=(const Chunk&) = delete;
+    // Deleted on destruction if {owned}; otherwise the source stream keeps
+    // ownership, see ExternalSourceStream::ChunksOwnedByEmbedder.
+    const uint8_t* data;
     size_t length;
     StreamPosition start;
+    const bool owned;
   };
 
   Utf8ExternalStreamingStream(const Utf8ExternalStreamingStream& source_stream)
       V8_NOEXCEPT : chunks_(source_stream.chunks_),
                     current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
-                    source_stream_(nullptr) {}
+                    source_stream_(nullptr),
+                    owns_chunk_data_(source_stream.owns_chunk_data_) {}
 
   // Within the current chunk, skip forward from current_ towards position.
   bool SkipToPosition(size_t position);
@@ -586,6 +620,7 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   std::shared_ptr<std::vector<Chunk>> chunks_;
   Position current_;
   ScriptCompiler::ExternalSourceStream* source_stream_;
+  const bool owns_chunk_data_;
 };
 
 bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
@@ -600,8 +635,8 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   unibrow::Utf8::State state = chunk.start.state;
   uint32_t incomplete_char = chunk.start.incomplete_char;
   size_t it = current_.pos.bytes - chunk.start.bytes;
-  const uint8_t* cursor = &chunk.data.get()[it];
-  const uint8_t* end = &chunk.data.get()[chunk.length];
+  const uint8_t* cursor = &chunk.data[it];
+  const uint8_t* end = &chunk.data[chunk.length];
 
   size_t chars = current_.pos.chars;
 
@@ -627,7 +662,7 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
     }
   }
 
-  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
+  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
   current_.pos.chars = chars;
   current_.pos.incomplete_char = incomplete_char;
   current_.pos.state = state;
@@ -667,8 +702,8 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
-  const uint8_t* cursor = chunk.data.get() + it;
-  const uint8_t* end = chunk.data.get() + chunk.length;
+  const uint8_t* cursor = chunk.data + it;
+  const uint8_t* end = chunk.data + chunk.length;
 
   // Deal with possible BOM.
   if (V8_UNLIKELY(current_.pos.bytes < 3 && current_.pos.chars == 0)) {
@@ -716,7 +751,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     output_cursor += ascii_length;
   }
 
-  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
+  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
   current_.pos.chars += (output_cursor - buffer_end_);
   current_.pos.incomplete_char = incomplete_char;
   current_.pos.state = state;
@@ -740,7 +775,7 @@ bool Utf8ExternalStreamingStream::FetchChunk() {
 
   const uint8_t* chunk = nullptr;
   size_t length = source_stream_->GetMoreData(&chunk);
-  chunks_->emplace_back(chunk, length, current_.pos);
+  chunks_->emplace_back(chunk, length, current_.pos, owns_chunk_data_);
   return length > 0;
 }
 
@@ -277,25 +277,8 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
-      });
+      c0_ = source_->AdvanceUntilAsciiIdentifierRunEnd(&next().literal_chars,
+                                                       &scan_flags);
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
@@ -329,19 +312,19 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     next().after_line_terminator = true;
   }
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
-  base::uc32 hint = ' ';
-  AdvanceUntil([this, &hint](base::uc32 c0) {
-    if (V8_LIKELY(c0 == hint)) return false;
-    if (IsWhiteSpaceOrLineTerminator(c0)) {
-      if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
-        next().after_line_terminator = true;
-      }
-      hint = c0;
-      return false;
+  // Advance as long as character is a WhiteSpace or LineTerminator. The
+  // block-wise scan only understands the ASCII whitespace characters; rare
+  // non-ASCII whitespace and the non-ASCII line terminators stop it and are
+  // handled here before resuming.
+  while (true) {
+    bool seen_line_terminator = false;
+    c0_ = source_->AdvanceUntilNonAsciiWhiteSpace(&seen_line_terminator);
+    if (seen_line_terminator) next().after_line_terminator = true;
+    if (V8_LIKELY(!IsWhiteSpaceOrLineTerminator(c0_))) break;
+    if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
+      next().after_line_terminator = true;
     }
-    return true;
-  });
+  }
 
   return Token::WHITESPACE;
 }
@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/bigint.h"
@@ -18,9 +19,301 @@
 #include "src/parsing/scanner-inl.h"
 #include "src/zone/zone.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define __SSE3__, but it does define __AVX__, which implies it.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// Neon is used on 64-bit ARM only; every ARM64 CPU has it.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Block-wise scanning for the character stream's hottest AdvanceUntil loops.
+// Each helper scans [start, end) and returns a cursor pointing at the first
+// code unit that stops the scan, or {end} if the whole range was consumed.
+// On x86/x64 SSE3 can be assumed and we process eight UTF-16 code units per
+// step; the same goes for Neon on arm64. Other targets, and the tail of the
+// range, fall back to the scalar loop.
+
+#if defined(__SSE3__) || defined(V8_HOST_ARCH_ARM64)
+constexpr int kBlockSize = 8;  // UTF-16 code units per 128-bit block.
+#endif
+
+#ifdef __SSE3__
+// Returns the address of the first 16-bit lane set in {mask}, which must have
+// at least one lane set.
+V8_INLINE const uint16_t* FirstMatch(const uint16_t* chars, __m128i mask) {
+  uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+  DCHECK_NE(bits, 0u);
+  return chars + (base::bits::CountTrailingZeros(bits) >> 1);
+}
+#elif defined(NEON64)
+// Returns the address of the first 16-bit lane set in {mask}, which must have
+// at least one lane set. The narrowing shift turns each lane into one byte of
+// a 64-bit mask that can be scanned with CountTrailingZeros.
+V8_INLINE const uint16_t* FirstMatch(const uint16_t* chars, uint16x8_t mask) {
+  uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(mask, 4)), 0);
+  DCHECK_NE(bits, 0u);
+  return chars + (base::bits::CountTrailingZeros(bits) >> 3);
+}
+#endif
+
+// Finds the first line terminator (LF, CR, LS or PS) in [start, end).
+const uint16_t* FindLineTerminator(const uint16_t* start, const uint16_t* end) {
+#ifdef __SSE3__
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i cr = _mm_set1_epi16('\r');
+  // U+2028 (LS) and U+2029 (PS) differ only in the lowest bit.
+  const __m128i ls_ps = _mm_set1_epi16(0x2028);
+  const __m128i drop_low_bit = _mm_set1_epi16(static_cast<int16_t>(0xFFFE));
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i mask = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(block, lf), _mm_cmpeq_epi16(block, cr)),
+        _mm_cmpeq_epi16(_mm_and_si128(block, drop_low_bit), ls_ps));
+    if (_mm_movemask_epi8(mask) != 0) return FirstMatch(start, mask);
+  }
+#elif defined(NEON64)
+  const uint16x8_t lf = vdupq_n_u16('\n');
+  const uint16x8_t cr = vdupq_n_u16('\r');
+  const uint16x8_t ls_ps = vdupq_n_u16(0x2028);
+  const uint16x8_t drop_low_bit = vdupq_n_u16(0xFFFE);
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    uint16x8_t block = vld1q_u16(start);
+    uint16x8_t mask = vorrq_u16(
+        vorrq_u16(vceqq_u16(block, lf), vceqq_u16(block, cr)),
+        vceqq_u16(vandq_u16(block, drop_low_bit), ls_ps));
+    if (vmaxvq_u16(mask) != 0) return FirstMatch(start, mask);
+  }
+#endif
+  while (start != end && !unibrow::IsLineTerminator(*start)) start++;
+  return start;
+}
+
+// Finds the first code unit in [start, end) that is not ASCII whitespace
+// (TAB, VT, FF, SP) or a '\n'/'\r' line terminator. Sets
+// {*seen_line_terminator} if the skipped prefix contained '\n' or '\r'.
+const uint16_t* FindNonAsciiWhiteSpace(const uint16_t* start,
+                                       const uint16_t* end,
+                                       bool* seen_line_terminator) {
+#ifdef __SSE3__
+  // TAB through CR form the contiguous range [0x09, 0x0D].
+  const __m128i tab = _mm_set1_epi16(0x09);
+  const __m128i range = _mm_set1_epi16(0x0D - 0x09);
+  const __m128i space = _mm_set1_epi16(' ');
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i cr = _mm_set1_epi16('\r');
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i in_range = _mm_cmpeq_epi16(
+        _mm_subs_epu16(_mm_sub_epi16(block, tab), range), _mm_setzero_si128());
+    __m128i is_ws = _mm_or_si128(in_range, _mm_cmpeq_epi16(block, space));
+    // Finish partially-whitespace blocks with the scalar loop below.
+    if (_mm_movemask_epi8(is_ws) != 0xFFFF) break;
+    if (!*seen_line_terminator &&
+        _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(block, lf),
+                                       _mm_cmpeq_epi16(block, cr))) != 0) {
+      *seen_line_terminator = true;
+    }
+  }
+#elif defined(NEON64)
+  const uint16x8_t tab = vdupq_n_u16(0x09);
+  const uint16x8_t range = vdupq_n_u16(0x0D - 0x09);
+  const uint16x8_t space = vdupq_n_u16(' ');
+  const uint16x8_t lf = vdupq_n_u16('\n');
+  const uint16x8_t cr = vdupq_n_u16('\r');
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    uint16x8_t block = vld1q_u16(start);
+    uint16x8_t in_range =
+        vceqq_u16(vqsubq_u16(vsubq_u16(block, tab), range), vdupq_n_u16(0));
+    uint16x8_t is_ws = vorrq_u16(in_range, vceqq_u16(block, space));
+    // Finish partially-whitespace blocks with the scalar loop below.
+    if (vminvq_u16(is_ws) == 0) break;
+    if (!*seen_line_terminator &&
+        vmaxvq_u16(vorrq_u16(vceqq_u16(block, lf), vceqq_u16(block, cr))) !=
+            0) {
+      *seen_line_terminator = true;
+    }
+  }
+#endif
+  while (start != end) {
+    uint16_t c = *start;
+    if (c == '\n' || c == '\r') {
+      *seen_line_terminator = true;
+    } else if (c != ' ' && !base::IsInRange(c, 0x09, 0x0D)) {
+      break;
+    }
+    start++;
+  }
+  return start;
+}
+
+// Finds the first code unit in [start, end) that cannot continue an ASCII
+// identifier. Clears {*can_be_keyword} if the scanned run is known not to
+// spell a keyword; the vector path only checks for characters outside
+// 'a'..'z', which may leave {*can_be_keyword} set for a non-keyword — that is
+// fine, since the perfect-hash keyword lookup rejects such literals anyway.
+const uint16_t* FindAsciiIdentifierRunEnd(const uint16_t* start,
+                                          const uint16_t* end,
+                                          bool* can_be_keyword) {
+#ifdef __SSE3__
+  const __m128i lower_a = _mm_set1_epi16('a');
+  const __m128i letter_range = _mm_set1_epi16('z' - 'a');
+  const __m128i digit_0 = _mm_set1_epi16('0');
+  const __m128i digit_range = _mm_set1_epi16('9' - '0');
+  const __m128i to_lower = _mm_set1_epi16(0x20);
+  const __m128i underscore = _mm_set1_epi16('_');
+  const __m128i dollar = _mm_set1_epi16('$');
+  const __m128i zero = _mm_setzero_si128();
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i is_letter = _mm_cmpeq_epi16(
+        _mm_subs_epu16(_mm_sub_epi16(_mm_or_si128(block, to_lower), lower_a),
+                       letter_range),
+        zero);
+    __m128i is_digit = _mm_cmpeq_epi16(
+        _mm_subs_epu16(_mm_sub_epi16(block, digit_0), digit_range), zero);
+    __m128i is_id = _mm_or_si128(
+        _mm_or_si128(is_letter, is_digit),
+        _mm_or_si128(_mm_cmpeq_epi16(block, underscore),
+                     _mm_cmpeq_epi16(block, dollar)));
+    // Finish partially-identifier blocks with the scalar loop below.
+    if (_mm_movemask_epi8(is_id) != 0xFFFF) break;
+    if (*can_be_keyword) {
+      __m128i is_lower = _mm_cmpeq_epi16(
+          _mm_subs_epu16(_mm_sub_epi16(block, lower_a), letter_range), zero);
+      if (_mm_movemask_epi8(is_lower) != 0xFFFF) *can_be_keyword = false;
+    }
+  }
+#elif defined(NEON64)
+  const uint16x8_t lower_a = vdupq_n_u16('a');
+  const uint16x8_t letter_range = vdupq_n_u16('z' - 'a');
+  const uint16x8_t digit_0 = vdupq_n_u16('0');
+  const uint16x8_t digit_range = vdupq_n_u16('9' - '0');
+  const uint16x8_t to_lower = vdupq_n_u16(0x20);
+  const uint16x8_t underscore = vdupq_n_u16('_');
+  const uint16x8_t dollar = vdupq_n_u16('$');
+  const uint16x8_t zero = vdupq_n_u16(0);
+  for (; start + kBlockSize <= end; start += kBlockSize) {
+    uint16x8_t block = vld1q_u16(start);
+    uint16x8_t is_letter = vceqq_u16(
+        vqsubq_u16(vsubq_u16(vorrq_u16(block, to_lower), lower_a),
+                   letter_range),
+        zero);
+    uint16x8_t is_digit =
+        vceqq_u16(vqsubq_u16(vsubq_u16(block, digit_0), digit_range), zero);
+    uint16x8_t is_id =
+        vorrq_u16(vorrq_u16(is_letter, is_digit),
+                  vorrq_u16(vceqq_u16(block, underscore),
+                            vceqq_u16(block, dollar)));
+    // Finish partially-identifier blocks with the scalar loop below.
+    if (vminvq_u16(is_id) == 0) break;
+    if (*can_be_keyword) {
+      uint16x8_t is_lower = vceqq_u16(
+          vqsubq_u16(vsubq_u16(block, lower_a), letter_range), zero);
+      if (vminvq_u16(is_lower) == 0) *can_be_keyword = false;
+    }
+  }
+#endif
+  while (start != end) {
+    uint16_t c = *start;
+    if (c >= arraysize(character_scan_flags)) break;
+    uint8_t char_flags = character_scan_flags[c];
+    if (TerminatesLiteral(char_flags)) break;
+    if (!CanBeKeyword(char_flags)) *can_be_keyword = false;
+    start++;
+  }
+  return start;
+}
+
+}  // namespace
+
+base::uc32 Utf16CharacterStream::AdvanceUntilLineTerminator() {
+  while (true) {
+    const uint16_t* cursor = FindLineTerminator(buffer_cursor_, buffer_end_);
+    if (cursor == buffer_end_) {
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    } else {
+      buffer_cursor_ = cursor + 1;
+      return static_cast<base::uc32>(*cursor);
+    }
+  }
+}
+
+base::uc32 Utf16CharacterStream::AdvanceUntilNonAsciiWhiteSpace(
+    bool* seen_line_terminator) {
+  while (true) {
+    const uint16_t* cursor = FindNonAsciiWhiteSpace(buffer_cursor_, buffer_end_,
+                                                    seen_line_terminator);
+    if (cursor == buffer_end_) {
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    } else {
+      buffer_cursor_ = cursor + 1;
+      return static_cast<base::uc32>(*cursor);
+    }
+  }
+}
+
+base::uc32 Utf16CharacterStream::AdvanceUntilAsciiIdentifierRunEnd(
+    LiteralBuffer* literal, uint8_t* scan_flags) {
+  bool can_be_keyword = true;
+  base::uc32 result = kEndOfInput;
+  while (true) {
+    const uint16_t* run_start = buffer_cursor_;
+    const uint16_t* cursor =
+        FindAsciiIdentifierRunEnd(run_start, buffer_end_, &can_be_keyword);
+    literal->AddAsciiChars(run_start, static_cast<int>(cursor - run_start));
+    if (cursor == buffer_end_) {
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        result = kEndOfInput;
+        break;
+      }
+    } else {
+      base::uc32 c0 = static_cast<base::uc32>(*cursor);
+      buffer_cursor_ = cursor + 1;
+      if (c0 >= arraysize(character_scan_flags)) {
+        // Matches the one-at-a-time scan: a non-ASCII character sends the
+        // identifier to the slow path.
+        *scan_flags |=
+            static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+      } else {
+        *scan_flags |= character_scan_flags[c0];
+      }
+      result = c0;
+      break;
+    }
+  }
+  if (!can_be_keyword) {
+    *scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+  }
+  return result;
+}
+
 class Scanner::ErrorState {
  public:
   ErrorState(MessageTemplate* message_stack, Scanner::Location* location_stack)
@@ -210,7 +503,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  c0_ = source_->AdvanceUntilLineTerminator();
 
   return Token::WHITESPACE;
 }
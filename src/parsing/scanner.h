@@ -95,6 +95,26 @@ class Utf16CharacterStream {
     }
   }
 
+  // Specialization of AdvanceUntil for line terminators: returns and advances
+  // past the next line terminator, or returns kEndOfInput. Scans the buffer
+  // block-wise (vectorized where the target supports it) instead of testing
+  // one code unit at a time.
+  base::uc32 AdvanceUntilLineTerminator();
+
+  // Advances past a run of ASCII whitespace and line terminators and returns
+  // the first code unit that is neither, or kEndOfInput. Sets
+  // {seen_line_terminator} if the skipped run contained '\n' or '\r'. Rare
+  // non-ASCII whitespace and the non-ASCII line terminators stop the scan and
+  // are left for the caller to handle.
+  base::uc32 AdvanceUntilNonAsciiWhiteSpace(bool* seen_line_terminator);
+
+  // Advances past a run of ASCII identifier characters, appending the run to
+  // {literal}, and returns the code unit that terminated it (or kEndOfInput).
+  // The character scan flags of the run and of the terminating code unit are
+  // ORed into {scan_flags}, as in the one-at-a-time identifier scan loop.
+  base::uc32 AdvanceUntilAsciiIdentifierRunEnd(LiteralBuffer* literal,
+                                               uint8_t* scan_flags);
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
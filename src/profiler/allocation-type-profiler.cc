@@ -0,0 +1,79 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/allocation-type-profiler.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/heap.h"
+#include "src/objects/instance-type-inl.h"
+#include "src/objects/map-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const char* InstanceTypeName(InstanceType instance_type) {
+  // JS API objects cover a range of instance types; report them under a
+  // single name.
+  if (InstanceTypeChecker::IsJSApiObject(instance_type)) {
+    return "JS_API_OBJECT_TYPE";
+  }
+  switch (instance_type) {
+#define TYPE_NAME(TYPE) \
+  case TYPE:            \
+    return #TYPE;
+    INSTANCE_TYPE_LIST(TYPE_NAME)
+#undef TYPE_NAME
+  }
+  return "(unknown instance type)";
+}
+
+}  // namespace
+
+AllocationTypeProfiler::AllocationTypeProfiler(Heap* heap, uint64_t rate)
+    : isolate_(Isolate::FromHeap(heap)),
+      heap_(heap),
+      allocation_observer_(this, static_cast<intptr_t>(rate)) {
+  CHECK_GT(rate, 0u);
+  heap_->AddAllocationObserversToAllSpaces(&allocation_observer_,
+                                           &allocation_observer_);
+}
+
+AllocationTypeProfiler::~AllocationTypeProfiler() {
+  heap_->RemoveAllocationObserversFromAllSpaces(&allocation_observer_,
+                                                &allocation_observer_);
+}
+
+void AllocationTypeProfiler::Observer::Step(int bytes_allocated,
+                                            Address soon_object, size_t size) {
+  if (soon_object == kNullAddress) return;
+  profiler_->SampleObject(soon_object, size);
+}
+
+void AllocationTypeProfiler::SampleObject(Address soon_object, size_t size) {
+  DisallowGarbageCollection no_gc;
+  Tagged<HeapObject> heap_object = HeapObject::FromAddress(soon_object);
+  // The sampled area starts with an initialized map, see the corresponding
+  // check in SamplingHeapProfiler::SampleObject.
+  DCHECK(IsMap(heap_object->map(isolate_), isolate_));
+  TypeStats& stats = stats_[heap_object->map(isolate_)->instance_type()];
+  stats.count++;
+  stats.bytes += size;
+}
+
+std::vector<v8::HeapProfiler::AllocationTypeHistogramEntry>
+AllocationTypeProfiler::TakeDelta() {
+  std::vector<v8::HeapProfiler::AllocationTypeHistogramEntry> result;
+  result.reserve(stats_.size());
+  for (const auto& it : stats_) {
+    result.push_back({InstanceTypeName(static_cast<InstanceType>(it.first)),
+                      it.second.count, it.second.bytes});
+  }
+  stats_.clear();
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,64 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_ALLOCATION_TYPE_PROFILER_H_
+#define V8_PROFILER_ALLOCATION_TYPE_PROFILER_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-profiler.h"
+#include "src/heap/allocation-observer.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class Isolate;
+
+// Records a histogram of sampled allocations keyed by instance type. Unlike
+// SamplingHeapProfiler it captures no stack traces and keeps no per-sample
+// state, so it is cheap enough to stay enabled in production.
+class AllocationTypeProfiler {
+ public:
+  AllocationTypeProfiler(Heap* heap, uint64_t rate);
+  ~AllocationTypeProfiler();
+  AllocationTypeProfiler(const AllocationTypeProfiler&) = delete;
+  AllocationTypeProfiler& operator=(const AllocationTypeProfiler&) = delete;
+
+  // Returns the entries accumulated since the previous call and resets the
+  // histogram.
+  std::vector<v8::HeapProfiler::AllocationTypeHistogramEntry> TakeDelta();
+
+ private:
+  class Observer : public AllocationObserver {
+   public:
+    Observer(AllocationTypeProfiler* profiler, intptr_t step_size)
+        : AllocationObserver(step_size), profiler_(profiler) {}
+
+   protected:
+    void Step(int bytes_allocated, Address soon_object, size_t size) override;
+
+   private:
+    AllocationTypeProfiler* const profiler_;
+  };
+
+  void SampleObject(Address soon_object, size_t size);
+
+  struct TypeStats {
+    size_t count = 0;
+    size_t bytes = 0;
+  };
+
+  Isolate* const isolate_;
+  Heap* const heap_;
+  Observer allocation_observer_;
+  // Keyed by InstanceType.
+  std::unordered_map<int, TypeStats> stats_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_ALLOCATION_TYPE_PROFILER_H_
@@ -15,6 +15,7 @@
 #include "src/heap/heap.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/profiler/allocation-tracker.h"
+#include "src/profiler/allocation-type-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/sampling-heap-profiler.h"
 
@@ -100,7 +101,7 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
 
     HeapSnapshotGenerator generator(result, options.control,
                                     options.global_object_name_resolver, heap(),
-                                    options.stack_state);
+                                    options.stack_state, options.gc_mode);
     if (!generator.GenerateSnapshot()) {
       delete result;
       result = nullptr;
@@ -147,7 +148,7 @@ void HeapProfiler::WriteSnapshotToDiskAfterGC() {
         new HeapSnapshot(this, options.snapshot_mode, options.numerics_mode));
     HeapSnapshotGenerator generator(result.get(), options.control,
                                     options.global_object_name_resolver, heap(),
-                                    options.stack_state);
+                                    options.stack_state, options.gc_mode);
     if (!generator.GenerateSnapshotAfterGC()) return;
     FileOutputStream stream(filename.c_str());
     HeapSnapshotJSONSerializer serializer(result.get());
@@ -186,6 +187,23 @@ v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
   }
 }
 
+bool HeapProfiler::StartAllocationTypeHistogram(uint64_t sample_interval) {
+  if (allocation_type_profiler_) return false;
+  allocation_type_profiler_.reset(
+      new AllocationTypeProfiler(heap(), sample_interval));
+  return true;
+}
+
+std::vector<v8::HeapProfiler::AllocationTypeHistogramEntry>
+HeapProfiler::GetAllocationTypeHistogramDelta() {
+  if (!allocation_type_profiler_) return {};
+  return allocation_type_profiler_->TakeDelta();
+}
+
+void HeapProfiler::StopAllocationTypeHistogram() {
+  allocation_type_profiler_.reset();
+}
+
 void HeapProfiler::StartHeapObjectsTracking(bool track_allocations) {
   ids_->UpdateHeapObjectsMap();
   if (native_move_listener_) {
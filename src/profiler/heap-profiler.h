@@ -19,6 +19,7 @@ namespace internal {
 
 // Forward declarations.
 class AllocationTracker;
+class AllocationTypeProfiler;
 class HeapObjectsMap;
 class HeapProfiler;
 class HeapSnapshot;
@@ -73,6 +74,11 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
 
+  bool StartAllocationTypeHistogram(uint64_t sample_interval);
+  std::vector<v8::HeapProfiler::AllocationTypeHistogramEntry>
+  GetAllocationTypeHistogramDelta();
+  void StopAllocationTypeHistogram();
+
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
   AllocationTracker* allocation_tracker() const {
@@ -146,6 +152,7 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   bool is_taking_snapshot_;
   base::Mutex profiler_mutex_;
   std::unique_ptr<SamplingHeapProfiler> sampling_heap_profiler_;
+  std::unique_ptr<AllocationTypeProfiler> allocation_type_profiler_;
   std::vector<std::pair<v8::HeapProfiler::BuildEmbedderGraphCallback, void*>>
       build_embedder_graph_callbacks_;
   std::pair<v8::HeapProfiler::GetDetachednessCallback, void*>
@@ -2943,13 +2943,15 @@ bool NativeObjectsExplorer::IterateAndExtractReferences(
 HeapSnapshotGenerator::HeapSnapshotGenerator(
     HeapSnapshot* snapshot, v8::ActivityControl* control,
     v8::HeapProfiler::ObjectNameResolver* resolver, Heap* heap,
-    cppgc::EmbedderStackState stack_state)
+    cppgc::EmbedderStackState stack_state,
+    v8::HeapProfiler::GarbageCollectionMode gc_mode)
     : snapshot_(snapshot),
       control_(control),
       v8_heap_explorer_(snapshot_, this, resolver),
       dom_explorer_(snapshot_, this),
       heap_(heap),
-      stack_state_(stack_state) {}
+      stack_state_(stack_state),
+      gc_mode_(gc_mode) {}
 
 namespace {
 class V8_NODISCARD NullContextForSnapshotScope {
@@ -2979,7 +2981,12 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
 
   EmbedderStackStateScope stack_scope(
       heap_, EmbedderStackStateScope::kImplicitThroughTask, stack_state_);
-  heap_->CollectAllAvailableGarbage(GarbageCollectionReason::kHeapProfiler);
+  if (gc_mode_ == v8::HeapProfiler::GarbageCollectionMode::kFull) {
+    heap_->CollectAllAvailableGarbage(GarbageCollectionReason::kHeapProfiler);
+  }
+  // With GarbageCollectionMode::kNone the heap traversal below may visit
+  // objects that are no longer reachable; the HeapObjectIterator still makes
+  // the heap iterable, so they are well-formed objects.
 
   // No allocation that could trigger GC from here onwards. We cannot use a
   // DisallowGarbageCollection scope as the HeapObjectIterator used during
@@ -624,7 +624,8 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
 
   HeapSnapshotGenerator(HeapSnapshot* snapshot, v8::ActivityControl* control,
                         v8::HeapProfiler::ObjectNameResolver* resolver,
-                        Heap* heap, cppgc::EmbedderStackState stack_state);
+                        Heap* heap, cppgc::EmbedderStackState stack_state,
+                        v8::HeapProfiler::GarbageCollectionMode gc_mode);
   HeapSnapshotGenerator(const HeapSnapshotGenerator&) = delete;
   HeapSnapshotGenerator& operator=(const HeapSnapshotGenerator&) = delete;
   bool GenerateSnapshot();
@@ -703,6 +704,7 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   uint32_t progress_total_;
   Heap* heap_;
   cppgc::EmbedderStackState stack_state_;
+  v8::HeapProfiler::GarbageCollectionMode gc_mode_;
 
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
   std::unordered_map<HeapEntry*, HeapThing> reverse_entries_map_;
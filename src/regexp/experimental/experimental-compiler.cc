@@ -5,6 +5,7 @@
 #include "src/regexp/experimental/experimental-compiler.h"
 
 #include "src/base/strings.h"
+#include "src/flags/flags.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/zone/zone-list-inl.h"
 
@@ -35,10 +36,11 @@ class CanBeHandledVisitor final : private RegExpVisitor {
 
   static bool AreSuitableFlags(RegExpFlags flags) {
     // TODO(mbid, v8:10765): We should be able to support all flags in the
-    // future.
+    // future.  kHasIndices only affects how the match result is built from
+    // the capture registers, not matching itself, so it is allowed.
     static constexpr RegExpFlags kAllowedFlags =
         RegExpFlag::kGlobal | RegExpFlag::kSticky | RegExpFlag::kMultiline |
-        RegExpFlag::kDotAll | RegExpFlag::kLinear;
+        RegExpFlag::kDotAll | RegExpFlag::kLinear | RegExpFlag::kHasIndices;
     // We support Unicode iff kUnicode is among the supported flags.
     static_assert(ExperimentalRegExp::kSupportsUnicode ==
                   IsUnicode(kAllowedFlags));
@@ -103,15 +105,18 @@ class CanBeHandledVisitor final : private RegExpVisitor {
     // of replicatons grows exponentially in how deeply quantifiers are nested.
     // `replication_factor_` keeps track of how often the current node will
     // have to be replicated in the generated bytecode, and we don't allow this
-    // to exceed some small value.
-    static constexpr int kMaxReplicationFactor = 16;
+    // to exceed some small budget.  The budget is a flag so that embedders
+    // routing everything through the experimental engine can trade bytecode
+    // size for coverage of larger counted repetitions.
+    const int max_replication_factor =
+        v8_flags.experimental_regexp_quantifier_limit;
 
     // First we rule out values for min and max that are too big even before
     // taking into account the ambient replication_factor_.  This also guards
-    // against overflows in `local_replication` or `replication_factor_`.
-    if (node->min() > kMaxReplicationFactor ||
+    // against overflows in `local_replication`.
+    if (node->min() > max_replication_factor ||
         (node->max() != RegExpTree::kInfinity &&
-         node->max() > kMaxReplicationFactor)) {
+         node->max() > max_replication_factor)) {
       result_ = false;
       return nullptr;
     }
@@ -132,11 +137,15 @@ class CanBeHandledVisitor final : private RegExpVisitor {
       local_replication = node->max();
     }
 
-    replication_factor_ *= local_replication;
-    if (replication_factor_ > kMaxReplicationFactor) {
+    // The multiplication is performed in 64 bits to rule out overflow for
+    // large values of the budget flag.
+    int64_t new_replication_factor =
+        static_cast<int64_t>(replication_factor_) * local_replication;
+    if (new_replication_factor > max_replication_factor) {
       result_ = false;
       return nullptr;
     }
+    replication_factor_ = static_cast<int>(new_replication_factor);
 
     switch (node->quantifier_type()) {
       case RegExpQuantifier::GREEDY:
@@ -1059,7 +1059,7 @@ IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, Tagged<JSRegExp> regexp, Tagged<String> subject_string,
     int* output_registers, int output_register_count, int start_position,
     RegExp::CallOrigin call_origin) {
-  if (v8_flags.regexp_tier_up) regexp->TierUpTick();
+  regexp->RecordInterpretedExecution(subject_string->length());
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
   Tagged<ByteArray> code_array = ByteArray::cast(regexp->bytecode(is_one_byte));
@@ -540,6 +540,49 @@ Handle<FixedArray> RegExp::CreateCaptureNameMap(
   return array;
 }
 
+namespace {
+
+// Returns the longest literal substring that every match of |tree| must
+// contain, or an empty vector if none can be determined. The walk is
+// deliberately conservative: disjunctions, lookarounds, backreferences and
+// optional parts contribute nothing.
+base::Vector<const base::uc16> FindMandatoryLiteral(RegExpTree* tree) {
+  if (tree->IsAtom()) return tree->AsAtom()->data();
+  if (tree->IsText()) {
+    base::Vector<const base::uc16> best;
+    ZoneList<TextElement>* elements = tree->AsText()->elements();
+    for (int i = 0; i < elements->length(); i++) {
+      TextElement element = elements->at(i);
+      if (element.text_type() != TextElement::ATOM) continue;
+      base::Vector<const base::uc16> candidate = element.atom()->data();
+      if (candidate.length() > best.length()) best = candidate;
+    }
+    return best;
+  }
+  if (tree->IsAlternative()) {
+    // A concatenation: every node must match, so any node's mandatory
+    // literal is mandatory for the whole expression.
+    base::Vector<const base::uc16> best;
+    ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+    for (int i = 0; i < nodes->length(); i++) {
+      base::Vector<const base::uc16> candidate =
+          FindMandatoryLiteral(nodes->at(i));
+      if (candidate.length() > best.length()) best = candidate;
+    }
+    return best;
+  }
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() < 1) return {};
+    return FindMandatoryLiteral(quantifier->body());
+  }
+  if (tree->IsCapture()) return FindMandatoryLiteral(tree->AsCapture()->body());
+  if (tree->IsGroup()) return FindMandatoryLiteral(tree->AsGroup()->body());
+  return {};
+}
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -609,6 +652,29 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  // On first compilation, try to extract a mandatory literal substring which
+  // IrregexpExecRaw uses to cheaply reject non-matching subjects. Skipped for
+  // ignore-case patterns, where a literal comparison would be wrong.
+  Tagged<Object> prefilter =
+      data->get(JSRegExp::kIrregexpPrefilterLiteralIndex);
+  if (IsSmi(prefilter) &&
+      Smi::ToInt(prefilter) == JSRegExp::kUninitializedValue) {
+    base::Vector<const base::uc16> literal;
+    if (v8_flags.regexp_literal_prefilter && !IsIgnoreCase(flags)) {
+      literal = FindMandatoryLiteral(compile_data.tree);
+    }
+    // Single characters are left to the engine's own scan loops.
+    static constexpr int kMinPrefilterLiteralLength = 2;
+    if (literal.length() >= kMinPrefilterLiteralLength) {
+      Handle<String> literal_string =
+          isolate->factory()->NewStringFromTwoByte(literal).ToHandleChecked();
+      DCHECK(literal_string->IsFlat());
+      data->set(JSRegExp::kIrregexpPrefilterLiteralIndex, *literal_string);
+    } else {
+      data->set(JSRegExp::kIrregexpPrefilterLiteralIndex, Smi::zero());
+    }
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -683,6 +749,43 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
+  // If compilation found a literal substring that every match must contain,
+  // reject the subject with a wide substring search before entering the
+  // backtracking engine. This makes miss-heavy workloads (grep-like scans
+  // where most subjects don't match) cheap: the engine is never entered when
+  // the mandatory literal is absent.
+  if (v8_flags.regexp_literal_prefilter) {
+    Tagged<Object> maybe_literal =
+        regexp->DataAt(JSRegExp::kIrregexpPrefilterLiteralIndex);
+    if (IsString(maybe_literal)) {
+      DisallowGarbageCollection no_gc;
+      Tagged<String> needle = String::cast(maybe_literal);
+      int needle_len = needle->length();
+      // Any match starts at or after |index| and contains the literal, so it
+      // suffices to search the subject from |index| on.
+      if (index + needle_len > subject->length()) {
+        return RegExp::RE_FAILURE;
+      }
+      String::FlatContent needle_content = needle->GetFlatContent(no_gc);
+      String::FlatContent subject_content = subject->GetFlatContent(no_gc);
+      DCHECK(needle_content.IsFlat());
+      DCHECK(subject_content.IsFlat());
+      int found =
+          (needle_content.IsOneByte()
+               ? (subject_content.IsOneByte()
+                      ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                     needle_content.ToOneByteVector(), index)
+                      : SearchString(isolate, subject_content.ToUC16Vector(),
+                                     needle_content.ToOneByteVector(), index))
+               : (subject_content.IsOneByte()
+                      ? SearchString(isolate, subject_content.ToOneByteVector(),
+                                     needle_content.ToUC16Vector(), index)
+                      : SearchString(isolate, subject_content.ToUC16Vector(),
+                                     needle_content.ToUC16Vector(), index)));
+      if (found == -1) return RegExp::RE_FAILURE;
+    }
+  }
+
   if (!regexp->ShouldProduceBytecode()) {
     do {
       EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
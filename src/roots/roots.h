@@ -280,6 +280,9 @@ class RootVisitor;
   /* Caches */                                                                 \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, frame_translation_cache, FrameTranslationCache)                \
+  V(FixedArray, scope_info_dedup_cache, ScopeInfoDedupCache)                   \
+  V(FixedArray, feedback_metadata_dedup_cache, FeedbackMetadataDedupCache)     \
   /* Indirection lists for isolate-independent builtins */                     \
   V(FixedArray, builtins_constants_table, BuiltinsConstantsTable)              \
   /* Internal SharedFunctionInfos */                                           \
@@ -31,6 +31,32 @@ RUNTIME_FUNCTION(Runtime_OrderedHashSetGrow) {
   return *table;
 }
 
+RUNTIME_FUNCTION(Runtime_OrderedHashSetUnion) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<OrderedHashSet> table = args.at<OrderedHashSet>(0);
+  Handle<OrderedHashSet> other = args.at<OrderedHashSet>(1);
+  Handle<OrderedHashSet> result;
+  if (!OrderedHashSet::Union(isolate, table, other).ToHandle(&result)) {
+    DCHECK(isolate->has_exception());
+    return ReadOnlyRoots(isolate).exception();
+  }
+  return *result;
+}
+
+RUNTIME_FUNCTION(Runtime_OrderedHashSetIntersection) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<OrderedHashSet> lhs = args.at<OrderedHashSet>(0);
+  Handle<OrderedHashSet> rhs = args.at<OrderedHashSet>(1);
+  Handle<OrderedHashSet> result;
+  if (!OrderedHashSet::Intersection(isolate, lhs, rhs).ToHandle(&result)) {
+    DCHECK(isolate->has_exception());
+    return ReadOnlyRoots(isolate).exception();
+  }
+  return *result;
+}
+
 RUNTIME_FUNCTION(Runtime_SetGrow) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -332,6 +332,70 @@ MaybeHandle<JSObject> DeepCopy(Handle<JSObject> object,
   return copy;
 }
 
+// A boilerplate is "flat" when the recursive walk in DeepCopy would not
+// rewrite any slot: fast properties whose fields hold neither nested objects
+// nor mutable doubles, and elements without nested objects. Cloning a flat
+// boilerplate is just the block copy done by CopyJSObjectWithAllocationSite,
+// so the walk can be skipped entirely.
+bool ComputeBoilerplateFlatness(Isolate* isolate, Tagged<JSObject> object) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Map> map = object->map(isolate);
+  // Arrays only have the "length" property; see StructureWalk.
+  if (!IsJSArray(object, isolate)) {
+    if (!object->HasFastProperties(isolate)) return false;
+    Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate);
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      PropertyDetails details = descriptors->GetDetails(i);
+      if (details.location() != PropertyLocation::kField) return false;
+      if (details.representation().IsDouble()) return false;
+      FieldIndex index = FieldIndex::ForPropertyIndex(
+          map, details.field_index(), details.representation());
+      if (IsJSObject(object->RawFastPropertyAt(isolate, index), isolate)) {
+        return false;
+      }
+    }
+  }
+  switch (object->GetElementsKind(isolate)) {
+    case PACKED_SMI_ELEMENTS:
+    case HOLEY_SMI_ELEMENTS:
+    case PACKED_DOUBLE_ELEMENTS:
+    case HOLEY_DOUBLE_ELEMENTS:
+    case NO_ELEMENTS:
+      return true;
+    case PACKED_ELEMENTS:
+    case HOLEY_ELEMENTS: {
+      Tagged<FixedArray> elements =
+          FixedArray::cast(object->elements(isolate));
+      for (int i = 0; i < elements->length(); i++) {
+        if (IsJSObject(elements->get(i), isolate)) return false;
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Returns whether |boilerplate| may be cloned with a plain block copy,
+// consulting the classification cached on |site| and computing it on first
+// use. A deprecated map sends the clone through the walk (which migrates the
+// boilerplate and may change its layout), so the cache is invalidated then.
+bool IsFlatBoilerplate(Isolate* isolate, Handle<AllocationSite> site,
+                       Handle<JSObject> boilerplate) {
+  if (boilerplate->map(isolate)->is_deprecated()) {
+    site->set_boilerplate_flatness(AllocationSite::kFlatnessUnknown);
+    return false;
+  }
+  AllocationSite::BoilerplateFlatness flatness = site->boilerplate_flatness();
+  if (flatness == AllocationSite::kFlatnessUnknown) {
+    flatness = ComputeBoilerplateFlatness(isolate, *boilerplate)
+                   ? AllocationSite::kFlatBoilerplate
+                   : AllocationSite::kNonFlatBoilerplate;
+    site->set_boilerplate_flatness(flatness);
+  }
+  return flatness == AllocationSite::kFlatBoilerplate;
+}
+
 Handle<JSObject> CreateObjectLiteral(
     Isolate* isolate,
     Handle<ObjectBoilerplateDescription> object_boilerplate_description,
@@ -569,7 +633,18 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
   // Copy the existing boilerplate.
   AllocationSiteUsageContext usage_context(isolate, site, enable_mementos);
   usage_context.EnterNewScope();
-  MaybeHandle<JSObject> copy = DeepCopy(boilerplate, &usage_context);
+  MaybeHandle<JSObject> copy;
+  if (IsFlatBoilerplate(isolate, site, boilerplate)) {
+    // Flat boilerplates clone with a single block copy; no walk needed.
+    Handle<AllocationSite> site_to_pass;
+    if (usage_context.ShouldCreateMemento(boilerplate)) {
+      site_to_pass = usage_context.current();
+    }
+    copy = isolate->factory()->CopyJSObjectWithAllocationSite(boilerplate,
+                                                              site_to_pass);
+  } else {
+    copy = DeepCopy(boilerplate, &usage_context);
+  }
   usage_context.ExitScope(site, boilerplate);
   return copy;
 }
@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/objects/js-array-buffer-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -57,6 +60,49 @@ RUNTIME_FUNCTION(Runtime_StringParseFloat) {
   return *isolate->factory()->NewNumber(value);
 }
 
+// Converts an array of strings to a new Float64Array in a single call,
+// amortizing the per-call dispatch and handle overhead over the whole batch.
+// Each element is converted with Number() semantics. Arrays with holes,
+// dictionary elements or non-string elements return undefined, telling the
+// caller to fall back to element-wise conversion.
+RUNTIME_FUNCTION(Runtime_StringArrayToFloat64Array) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  Handle<JSArray> array = args.at<JSArray>(0);
+
+  const ElementsKind kind = array->GetElementsKind();
+  if ((kind != PACKED_ELEMENTS && kind != PACKED_SMI_ELEMENTS) ||
+      !IsSmi(array->length())) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+  const int length = Smi::ToInt(array->length());
+
+  Handle<JSArrayBuffer> buffer;
+  if (!isolate->factory()
+           ->NewJSArrayBufferAndBackingStore(length * sizeof(double),
+                                             InitializedFlag::kUninitialized)
+           .ToHandle(&buffer)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kArrayBufferAllocationFailed));
+  }
+  Handle<JSTypedArray> result = isolate->factory()->NewJSTypedArray(
+      kExternalFloat64Array, buffer, 0, length);
+
+  const int flags = ALLOW_HEX | ALLOW_OCTAL | ALLOW_BINARY;
+  Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate);
+  for (int i = 0; i < length; i++) {
+    Tagged<Object> element = elements->get(i);
+    if (!IsString(element)) return ReadOnlyRoots(isolate).undefined_value();
+    Handle<String> string(String::cast(element), isolate);
+    // Flattening may allocate; the result's backing store is off-heap, so
+    // re-reading DataPtr() per element is all that is needed.
+    string = String::Flatten(isolate, string);
+    static_cast<double*>(result->DataPtr())[i] =
+        FlatStringToDouble(*string, flags, 0.0);
+  }
+  return *result;
+}
+
 RUNTIME_FUNCTION(Runtime_NumberToStringSlow) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -1661,6 +1661,22 @@ RUNTIME_FUNCTION(Runtime_DisallowCodegenFromStrings) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_RegexpExecStats) {
+  HandleScope scope(isolate);
+  if (args.length() != 1) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  Handle<JSRegExp> regexp = args.at<JSRegExp>(0);
+  if (regexp->type_tag() != JSRegExp::IRREGEXP) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+  // Returns [interpreted execution count, interpreted subject characters].
+  Handle<FixedArray> stats = isolate->factory()->NewFixedArray(2);
+  stats->set(0, regexp->DataAt(JSRegExp::kIrregexpExecCountIndex));
+  stats->set(1, regexp->DataAt(JSRegExp::kIrregexpInterpretedCharsIndex));
+  return *isolate->factory()->NewJSArrayWithElements(stats);
+}
+
 RUNTIME_FUNCTION(Runtime_RegexpHasBytecode) {
   SealHandleScope shs(isolate);
   if (args.length() != 2) {
@@ -2,10 +2,20 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "src/base/atomicops.h"
+#include "src/base/ieee754.h"
+#include "src/builtins/builtins.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
+#include "src/numbers/conversions.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
@@ -64,6 +74,121 @@ RUNTIME_FUNCTION(Runtime_TypedArrayGetBuffer) {
   return *holder->GetBuffer();
 }
 
+RUNTIME_FUNCTION(Runtime_TypedArrayJoinFloat64) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<JSTypedArray> array = args.at<JSTypedArray>(0);
+  Handle<String> separator = args.at<String>(1);
+  size_t length;
+  CHECK(TryNumberToSize(args[2], &length));
+  DCHECK_EQ(kExternalFloat64Array, array->type());
+
+  if (length == 0) return ReadOnlyRoots(isolate).empty_string();
+
+  // The separator's ToString may have run arbitrary JS since the length was
+  // read. Returning undefined makes the Torque caller fall back to the
+  // element-wise path, which handles these cases.
+  if (array->WasDetached() || array->IsOutOfBounds() ||
+      length > array->GetLength()) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+  separator = String::Flatten(isolate, separator);
+  if (!separator->IsOneByteRepresentation()) {
+    return ReadOnlyRoots(isolate).undefined_value();
+  }
+
+  // Serialize all elements into a single off-heap buffer, so the result
+  // string is allocated exactly once and no per-element strings are created.
+  std::vector<uint8_t> chars;
+  chars.reserve(length * 8);
+  bool too_long = false;
+  {
+    DisallowGarbageCollection no_gc;
+    const double* data = static_cast<const double*>(array->DataPtr());
+    String::FlatContent separator_content = separator->GetFlatContent(no_gc);
+    base::Vector<const uint8_t> sep = separator_content.ToOneByteVector();
+    char number_buffer[kDoubleToCStringMinBufferSize];
+    base::Vector<char> buffer(number_buffer, arraysize(number_buffer));
+    for (size_t i = 0; i < length; i++) {
+      if (i > 0) chars.insert(chars.end(), sep.begin(), sep.end());
+      const char* string = DoubleToCString(data[i], buffer);
+      chars.insert(chars.end(), string, string + strlen(string));
+      if (V8_UNLIKELY(chars.size() >
+                      static_cast<size_t>(String::kMaxLength))) {
+        too_long = true;
+        break;
+      }
+    }
+  }
+  if (too_long) {
+    THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+  }
+  RETURN_RESULT_OR_FAILURE(
+      isolate, isolate->factory()->NewStringFromOneByte(base::VectorOf(chars)));
+}
+
+namespace {
+
+// Resolves the scalar implementation backing a Math builtin. Must stay in
+// sync with the ExternalReferences used by the corresponding TFJ builtins so
+// that the batched path is bit-identical to the element-wise one.
+double (*MathUnaryImpl(Builtin builtin))(double) {
+  switch (builtin) {
+    case Builtin::kMathSin:
+#ifdef V8_USE_LIBM_TRIG_FUNCTIONS
+      return v8_flags.use_libm_trig_functions ? base::ieee754::libm_sin
+                                              : base::ieee754::fdlibm_sin;
+#else
+      return base::ieee754::sin;
+#endif
+    case Builtin::kMathCos:
+#ifdef V8_USE_LIBM_TRIG_FUNCTIONS
+      return v8_flags.use_libm_trig_functions ? base::ieee754::libm_cos
+                                              : base::ieee754::fdlibm_cos;
+#else
+      return base::ieee754::cos;
+#endif
+    case Builtin::kMathExp:
+      return base::ieee754::exp;
+    default:
+      UNREACHABLE();
+  }
+}
+
+}  // namespace
+
+// Fast path for Float64Array.prototype.map(Math.sin) and friends: computes
+// all elements in one tight C++ loop instead of dispatching a JS call per
+// element. The caller has already verified the receiver and that the species
+// protector is intact, so plain Float64Array construction is spec-compliant.
+RUNTIME_FUNCTION(Runtime_TypedArrayMapMathUnary) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<JSTypedArray> source = args.at<JSTypedArray>(0);
+  Builtin builtin = Builtins::FromInt(args.smi_value_at(1));
+  DCHECK_EQ(kExternalFloat64Array, source->type());
+  DCHECK(!source->WasDetached());
+
+  double (*impl)(double) = MathUnaryImpl(builtin);
+  const size_t length = source->GetLength();
+  Handle<JSArrayBuffer> buffer;
+  if (!isolate->factory()
+           ->NewJSArrayBufferAndBackingStore(length * sizeof(double),
+                                             InitializedFlag::kUninitialized)
+           .ToHandle(&buffer)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kArrayBufferAllocationFailed));
+  }
+  Handle<JSTypedArray> result = isolate->factory()->NewJSTypedArray(
+      kExternalFloat64Array, buffer, 0, length);
+
+  DisallowGarbageCollection no_gc;
+  const double* src = static_cast<const double*>(source->DataPtr());
+  double* dst = static_cast<double*>(result->DataPtr());
+  for (size_t i = 0; i < length; i++) dst[i] = impl(src[i]);
+  return *result;
+}
+
 RUNTIME_FUNCTION(Runtime_GrowableSharedArrayBufferByteLength) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -95,6 +220,83 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Runs |process_item| for every index in [0, num_items), distributing the
+// items over the platform's worker threads and the joining thread.
+class ParallelSortPhaseTask final : public v8::JobTask {
+ public:
+  ParallelSortPhaseTask(size_t num_items,
+                        std::function<void(size_t)> process_item)
+      : num_items_(num_items), process_item_(std::move(process_item)) {}
+
+  void Run(v8::JobDelegate* delegate) override {
+    do {
+      const size_t item = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (item >= num_items_) return;
+      process_item_(item);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    const size_t next_item = next_item_.load(std::memory_order_relaxed);
+    return num_items_ - std::min(num_items_, next_item);
+  }
+
+ private:
+  const size_t num_items_;
+  const std::function<void(size_t)> process_item_;
+  std::atomic<size_t> next_item_{0};
+};
+
+void RunParallelSortPhase(size_t num_items,
+                          std::function<void(size_t)> process_item) {
+  std::unique_ptr<v8::JobHandle> job_handle =
+      V8::GetCurrentPlatform()->CreateJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<ParallelSortPhaseTask>(num_items,
+                                                  std::move(process_item)));
+  job_handle->Join();
+}
+
+// Sorts |data| with a parallel merge sort: equally-sized chunks are sorted
+// concurrently through the platform's job system and then merged pairwise
+// until a single sorted run remains. The calling thread participates in
+// every phase and joins it before starting the next one, so the sort is
+// synchronous from the caller's point of view.
+template <typename T, typename Compare>
+void ParallelSort(T* data, size_t length, Compare comp) {
+  // Chunks below this element count are not worth the scheduling overhead.
+  // The chunk count is a power of two so that the merge phases pair up runs
+  // evenly.
+  constexpr size_t kMaxChunkSize = size_t{256} * 1024;
+  size_t num_chunks = 1;
+  while (num_chunks * kMaxChunkSize < length) num_chunks *= 2;
+  const size_t chunk_size = (length + num_chunks - 1) / num_chunks;
+
+  RunParallelSortPhase(num_chunks, [=](size_t chunk) {
+    const size_t begin = chunk * chunk_size;
+    const size_t end = std::min(begin + chunk_size, length);
+    if (begin < end) std::sort(data + begin, data + end, comp);
+  });
+
+  if (num_chunks == 1) return;
+
+  std::unique_ptr<T[]> scratch(new T[length]);
+  T* from = data;
+  T* to = scratch.get();
+  for (size_t run = chunk_size; run < length; run *= 2) {
+    const size_t num_pairs = (length + 2 * run - 1) / (2 * run);
+    RunParallelSortPhase(num_pairs, [=](size_t pair) {
+      const size_t begin = pair * 2 * run;
+      const size_t middle = std::min(begin + run, length);
+      const size_t end = std::min(begin + 2 * run, length);
+      std::merge(from + begin, from + middle, from + middle, from + end,
+                 to + begin, comp);
+    });
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -142,6 +344,13 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
                          static_cast<base::Atomic8*>(array->DataPtr()), bytes);
   }
 
+  // A parallel sort only pays off once the array is large enough to amortize
+  // the job scheduling overhead, and requires worker threads.
+  constexpr size_t kMinParallelSortLength = size_t{512} * 1024;
+  const bool parallel_sort = v8_flags.parallel_array_sort &&
+                             !v8_flags.single_threaded &&
+                             length >= kMinParallelSortLength;
+
   DisallowGarbageCollection no_gc;
 
   switch (array->type()) {
@@ -155,6 +364,8 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
                   UnalignedSlot<ctype>(data + length), CompareNum<ctype>); \
+      } else if (parallel_sort) {                                          \
+        ParallelSort(data, length, CompareNum<ctype>);                     \
       } else {                                                             \
         std::sort(data, data + length, CompareNum<ctype>);                 \
       }                                                                    \
@@ -163,6 +374,8 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
                   UnalignedSlot<ctype>(data + length));                    \
+      } else if (parallel_sort) {                                          \
+        ParallelSort(data, length, std::less<ctype>());                    \
       } else {                                                             \
         std::sort(data, data + length);                                    \
       }                                                                    \
@@ -101,6 +101,8 @@ namespace internal {
   F(MapGrow, 1, 1)                           \
   F(MapShrink, 1, 1)                         \
   F(OrderedHashSetGrow, 2, 1)                \
+  F(OrderedHashSetIntersection, 2, 1)        \
+  F(OrderedHashSetUnion, 2, 1)               \
   F(SetGrow, 1, 1)                           \
   F(SetShrink, 1, 1)                         \
   F(OrderedHashSetShrink, 1, 1)              \
@@ -298,6 +300,7 @@ namespace internal {
   F(IsSmi, 1, 1)                         \
   F(MaxSmi, 0, 1)                        \
   F(NumberToStringSlow, 1, 1)            \
+  F(StringArrayToFloat64Array, 1, 1)     \
   F(StringParseFloat, 1, 1)              \
   F(StringParseInt, 2, 1)                \
   F(StringToNumber, 1, 1)
@@ -591,6 +594,7 @@ namespace internal {
   F(PrintWithNameForAssert, 2, 1)             \
   F(PromiseSpeciesProtector, 0, 1)            \
   F(RegExpSpeciesProtector, 0, 1)             \
+  F(RegexpExecStats, 1, 1)                    \
   F(RegexpHasBytecode, 2, 1)                  \
   F(RegexpHasNativeCode, 2, 1)                \
   F(RegexpIsUnmodified, 1, 1)                 \
@@ -623,6 +627,8 @@ namespace internal {
   F(GrowableSharedArrayBufferByteLength, 1, 1) \
   F(TypedArrayCopyElements, 3, 1)              \
   F(TypedArrayGetBuffer, 1, 1)                 \
+  F(TypedArrayJoinFloat64, 3, 1)               \
+  F(TypedArrayMapMathUnary, 2, 1)              \
   F(TypedArraySet, 2, 1)                       \
   F(TypedArraySortFast, 1, 1)
 
@@ -0,0 +1,79 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/code-cache-directory.h"
+
+#include <limits>
+#include <string>
+
+#include "src/execution/isolate.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/shared-function-info.h"
+#include "src/objects/string.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::string EntryPath(Isolate* isolate, Handle<String> source,
+                      ScriptOriginOptions origin_options) {
+  uint32_t key = SerializedCodeData::SourceHash(source, origin_options);
+  char filename[16];
+  base::OS::SNPrintF(filename, sizeof(filename), "%08x.vcache", key);
+  return isolate->code_cache_directory() + "/" + filename;
+}
+
+}  // namespace
+
+CodeCacheDirectory::Entry::Entry(
+    std::unique_ptr<base::OS::MemoryMappedFile> mapping,
+    std::unique_ptr<AlignedCachedData> cached_data)
+    : mapping_(std::move(mapping)), cached_data_(std::move(cached_data)) {}
+
+CodeCacheDirectory::Entry::~Entry() = default;
+
+// static
+std::unique_ptr<CodeCacheDirectory::Entry> CodeCacheDirectory::Load(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  DCHECK(!isolate->code_cache_directory().empty());
+  std::string path = EntryPath(isolate, source, origin_options);
+  std::unique_ptr<base::OS::MemoryMappedFile> mapping(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!mapping || mapping->size() == 0 ||
+      mapping->size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    return nullptr;
+  }
+  // Mapped files are page-aligned, so this does not copy the data; the
+  // version, flag and source hash checks happen when the data is consumed.
+  auto cached_data = std::make_unique<AlignedCachedData>(
+      reinterpret_cast<const uint8_t*>(mapping->memory()),
+      static_cast<int>(mapping->size()));
+  return std::make_unique<Entry>(std::move(mapping), std::move(cached_data));
+}
+
+// static
+void CodeCacheDirectory::Store(Isolate* isolate,
+                               Handle<SharedFunctionInfo> shared) {
+  DCHECK(!isolate->code_cache_directory().empty());
+  DCHECK(shared->is_toplevel());
+  if (!shared->is_compiled()) return;
+  Tagged<Script> script = Script::cast(shared->script());
+  Handle<String> source(String::cast(script->source()), isolate);
+  ScriptOriginOptions origin_options = script->origin_options();
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(isolate, shared));
+  if (!cached_data) return;
+
+  std::string path = EntryPath(isolate, source, origin_options);
+  delete base::OS::MemoryMappedFile::create(
+      path.c_str(), cached_data->length,
+      const_cast<uint8_t*>(cached_data->data));
+}
+
+}  // namespace internal
+}  // namespace v8
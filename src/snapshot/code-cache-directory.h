@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+#define V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+
+#include <memory>
+
+#include "src/base/platform/platform.h"
+#include "src/handles/handles.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+// A V8-managed on-disk cache of per-script code cache entries, enabled via
+// v8::ScriptCompiler::SetCodeCacheDirectory. Entries are keyed by a hash of
+// the script source and origin options, stored as one file per script, and
+// memory-mapped on load. Stale entries (version or flag mismatches) are
+// detected by the regular SerializedCodeData sanity check on consumption and
+// rewritten after recompilation.
+class V8_EXPORT_PRIVATE CodeCacheDirectory : public AllStatic {
+ public:
+  // A loaded cache entry. Keeps the underlying file mapping alive for as long
+  // as the cached data is in use.
+  class Entry {
+   public:
+    Entry(std::unique_ptr<base::OS::MemoryMappedFile> mapping,
+          std::unique_ptr<AlignedCachedData> cached_data);
+    ~Entry();
+
+    AlignedCachedData* cached_data() { return cached_data_.get(); }
+
+   private:
+    std::unique_ptr<base::OS::MemoryMappedFile> mapping_;
+    std::unique_ptr<AlignedCachedData> cached_data_;
+  };
+
+  // Returns the cached entry for {source}, or nullptr if there is none.
+  static std::unique_ptr<Entry> Load(Isolate* isolate, Handle<String> source,
+                                     ScriptOriginOptions origin_options);
+
+  // Serializes {shared} (which must be top-level) and writes it to the cache
+  // directory, overwriting any existing entry for its script. Inner functions
+  // that have been compiled by the time of the call are included, so
+  // rewriting an entry after warm-up also persists lazily-compiled function
+  // bytecode.
+  static void Store(Isolate* isolate, Handle<SharedFunctionInfo> shared);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
@@ -178,7 +178,19 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       }
       if (v8_flags.profile_guided_optimization) {
         cached_tiering_decision = sfi->cached_tiering_decision();
-        sfi->set_cached_tiering_decision(CachedTieringDecision::kPending);
+        // Early tiering decisions may be persisted in the cache, so that
+        // deserializing processes request Maglev/Turbofan at the early
+        // optimization budget instead of re-learning the profile from
+        // scratch. Everything else is serialized as kPending; in particular
+        // kNormal is not persisted, so functions that weren't optimized
+        // early get a chance to re-learn.
+        const bool serialize_decision =
+            v8_flags.serialize_cached_tiering_decisions &&
+            (cached_tiering_decision == CachedTieringDecision::kEarlyMaglev ||
+             cached_tiering_decision == CachedTieringDecision::kEarlyTurbofan);
+        if (!serialize_decision) {
+          sfi->set_cached_tiering_decision(CachedTieringDecision::kPending);
+        }
       }
     }
     SerializeGeneric(obj, slot_type);
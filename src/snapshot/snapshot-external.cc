@@ -20,9 +20,7 @@ namespace internal {
 
 static base::LazyMutex external_startup_data_mutex = LAZY_MUTEX_INITIALIZER;
 static v8::StartupData external_startup_blob = {nullptr, 0};
-#ifdef V8_TARGET_OS_ANDROID
 static bool external_startup_checksum_verified = false;
-#endif
 
 void SetSnapshotFromFile(StartupData* snapshot_blob) {
   base::MutexGuard lock_guard(external_startup_data_mutex.Pointer());
@@ -32,25 +30,21 @@ void SetSnapshotFromFile(StartupData* snapshot_blob) {
   DCHECK(!external_startup_blob.data);
   DCHECK(Snapshot::SnapshotIsValid(snapshot_blob));
   external_startup_blob = *snapshot_blob;
-#ifdef V8_TARGET_OS_ANDROID
   external_startup_checksum_verified = false;
-#endif
 }
 
 bool Snapshot::ShouldVerifyChecksum(const v8::StartupData* data) {
-#ifdef V8_TARGET_OS_ANDROID
   base::MutexGuard lock_guard(external_startup_data_mutex.Pointer());
   if (data != &external_startup_blob) {
     return v8_flags.verify_snapshot_checksum;
   }
-  // Verify the external snapshot maximally once per process due to the
-  // additional overhead.
+  // Verify the external snapshot maximally once per process: the blob is
+  // immutable after SetSnapshotFromFile, and re-checksumming it walks the
+  // whole blob, which shows up as spawn latency and resident pages for
+  // embedders creating thousands of short-lived isolates.
   if (external_startup_checksum_verified) return false;
   external_startup_checksum_verified = true;
   return true;
-#else
-  return v8_flags.verify_snapshot_checksum;
-#endif
 }
 
 const v8::StartupData* Snapshot::DefaultSnapshotBlob() {
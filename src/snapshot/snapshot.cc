@@ -402,6 +402,30 @@ void Snapshot::SerializeDeserializeAndVerifyForTesting(
       });
 }
 
+// static
+v8::StartupData Snapshot::CreateWarmStartupBlob(
+    Isolate* isolate, Handle<Context> context,
+    SerializeInternalFieldsCallback embedder_fields_serializer) {
+  isolate->heap()->CollectAllAvailableGarbage(
+      GarbageCollectionReason::kSnapshotCreator);
+
+  SafepointKind safepoint_kind = isolate->has_shared_space()
+                                     ? SafepointKind::kGlobal
+                                     : SafepointKind::kIsolate;
+  SafepointScope safepoint_scope(isolate, safepoint_kind);
+  DisallowGarbageCollection no_gc;
+
+  SerializerFlags flags(
+      kAllowActiveIsolateForTesting |
+      ((isolate->has_shared_space() || ReadOnlyHeap::IsReadOnlySpaceShared())
+           ? kReconstructReadOnlyAndSharedObjectCachesForTesting
+           : 0));
+  std::vector<Tagged<Context>> contexts{*context};
+  std::vector<SerializeInternalFieldsCallback> callbacks{
+      embedder_fields_serializer};
+  return Create(isolate, &contexts, callbacks, safepoint_scope, no_gc, flags);
+}
+
 // static
 v8::StartupData Snapshot::Create(
     Isolate* isolate, std::vector<Tagged<Context>>* contexts,
@@ -74,6 +74,19 @@ class Snapshot : public AllStatic {
       const DisallowGarbageCollection& no_gc,
       SerializerFlags flags = kDefaultSerializerFlags);
 
+  // Captures a warmed context from a running isolate into a startup blob, so
+  // embedders can snapshot a context after installing their native bindings
+  // and deserialize it in subsequently created isolates instead of paying for
+  // ApiNatives instantiation on every Context::New. This uses the permissive
+  // serializer mode originally introduced for testing (see
+  // kAllowActiveIsolateForTesting); the caller is responsible for capturing
+  // at a quiescent point, i.e. with no pending microtasks or in-flight
+  // background compilations, and for registering all external references.
+  // The caller owns the returned data.
+  V8_EXPORT_PRIVATE static v8::StartupData CreateWarmStartupBlob(
+      Isolate* isolate, Handle<Context> context,
+      SerializeInternalFieldsCallback embedder_fields_serializer);
+
   // ---------------- Deserialization -----------------------------------------
 
   // Initialize the Isolate from the internal snapshot. Returns false if no
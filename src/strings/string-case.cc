@@ -5,10 +5,31 @@
 #include "src/strings/string-case.h"
 
 #include "src/base/logging.h"
+#include "src/codegen/cpu-features.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -58,11 +79,133 @@ static inline word_t AsciiRangeMask(word_t w, char m, char n) {
   return (tmp1 & tmp2 & (kOneInEveryByte * 0x80));
 }
 
+// The SIMD helpers below convert as many full vectors as possible and stop
+// before the first vector that contains a non-ASCII byte; the scalar tail in
+// FastAsciiConvert then locates the exact index of that byte. They advance
+// *src and *dst past the converted prefix and or conversion activity into
+// *changed. Unaligned loads and stores are used throughout, and since every
+// vector is fully read before it is written the helpers also support
+// converting in place (dst == src).
+
+#ifdef __SSE3__
+
+template <bool is_lower>
+inline void AsciiConvertSse(char** dst, const char** src, const char* limit,
+                            bool* changed) {
+  const __m128i lo = _mm_set1_epi8(is_lower ? 'A' - 1 : 'a' - 1);
+  const __m128i hi = _mm_set1_epi8(is_lower ? 'Z' + 1 : 'z' + 1);
+  const __m128i case_bit = _mm_set1_epi8(1 << 5);
+  __m128i changed_acc = _mm_setzero_si128();
+  const char* s = *src;
+  char* d = *dst;
+  while (s <= limit - 16) {
+    const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    if (_mm_movemask_epi8(w) != 0) break;  // Non-ASCII byte in this vector.
+    // All bytes are ASCII, so signed comparisons are exact.
+    const __m128i m =
+        _mm_and_si128(_mm_cmpgt_epi8(w, lo), _mm_cmplt_epi8(w, hi));
+    changed_acc = _mm_or_si128(changed_acc, m);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d),
+                     _mm_xor_si128(w, _mm_and_si128(m, case_bit)));
+    s += 16;
+    d += 16;
+  }
+  if (_mm_movemask_epi8(changed_acc) != 0) *changed = true;
+  *src = s;
+  *dst = d;
+}
+
+#if defined(_MSC_VER) && defined(__clang__)
+// Generating AVX2 code with Clang on Windows without the /arch:AVX2 flag does
+// not seem possible at the moment.
+#define IS_CLANG_WIN 1
+#endif
+
+// Since we don't compile with -mavx or -mavx2 (or /arch:AVX2 on MSVC), Clang
+// and MSVC do not define __AVX__ nor __AVX2__. Thus, if __SSE3__ is defined,
+// we generate the AVX2 code, and, at runtime, we'll decide to call it or not,
+// depending on whether the CPU supports AVX2.
+#if !defined(_M_IX86) && !defined(IS_CLANG_WIN)
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+template <bool is_lower>
+TARGET_AVX2 inline void AsciiConvertAvx2(char** dst, const char** src,
+                                         const char* limit, bool* changed) {
+  const __m256i lo = _mm256_set1_epi8(is_lower ? 'A' - 1 : 'a' - 1);
+  const __m256i hi = _mm256_set1_epi8(is_lower ? 'Z' + 1 : 'z' + 1);
+  const __m256i case_bit = _mm256_set1_epi8(1 << 5);
+  __m256i changed_acc = _mm256_setzero_si256();
+  const char* s = *src;
+  char* d = *dst;
+  while (s <= limit - 32) {
+    const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    if (_mm256_movemask_epi8(w) != 0) break;  // Non-ASCII byte in this vector.
+    const __m256i m = _mm256_and_si256(_mm256_cmpgt_epi8(w, lo),
+                                       _mm256_cmpgt_epi8(hi, w));
+    changed_acc = _mm256_or_si256(changed_acc, m);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(d),
+                        _mm256_xor_si256(w, _mm256_and_si256(m, case_bit)));
+    s += 32;
+    d += 32;
+  }
+  if (_mm256_movemask_epi8(changed_acc) != 0) *changed = true;
+  *src = s;
+  *dst = d;
+}
+
+#undef TARGET_AVX2
+#else
+
+template <bool is_lower>
+inline void AsciiConvertAvx2(char** dst, const char** src, const char* limit,
+                             bool* changed) {
+  // Falling back to the SSE version.
+  AsciiConvertSse<is_lower>(dst, src, limit, changed);
+}
+
+#endif  // !defined(_M_IX86) && !defined(IS_CLANG_WIN)
+#undef IS_CLANG_WIN
+
+#elif defined(NEON64)
+
+template <bool is_lower>
+inline void AsciiConvertNeon(char** dst, const char** src, const char* limit,
+                             bool* changed) {
+  const uint8x16_t lo = vdupq_n_u8(is_lower ? 'A' : 'a');
+  const uint8x16_t hi = vdupq_n_u8(is_lower ? 'Z' : 'z');
+  const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+  uint8x16_t changed_acc = vdupq_n_u8(0);
+  const char* s = *src;
+  char* d = *dst;
+  while (s <= limit - 16) {
+    const uint8x16_t w = vld1q_u8(reinterpret_cast<const uint8_t*>(s));
+    if (vmaxvq_u8(w) > 0x7F) break;  // Non-ASCII byte in this vector.
+    const uint8x16_t m = vandq_u8(vcgeq_u8(w, lo), vcleq_u8(w, hi));
+    changed_acc = vorrq_u8(changed_acc, m);
+    vst1q_u8(reinterpret_cast<uint8_t*>(d),
+             veorq_u8(w, vandq_u8(m, case_bit)));
+    s += 16;
+    d += 16;
+  }
+  if (vmaxvq_u8(changed_acc) != 0) *changed = true;
+  *src = s;
+  *dst = d;
+}
+
+#endif  // __SSE3__
+
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length,
                      bool* changed_out) {
 #ifdef DEBUG
   char* saved_dst = dst;
+  // In-place conversion overwrites the source, so the post-condition can only
+  // be verified against a distinct source buffer.
+  const bool can_check = dst != src;
 #endif
   const char* saved_src = src;
   DisallowGarbageCollection no_gc;
@@ -75,10 +218,28 @@ int FastAsciiConvert(char* dst, const char* src, int length,
   bool changed = false;
   const char* const limit = src + length;
 
-  // dst is newly allocated and always aligned.
-  DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
-  // Only attempt processing one word at a time if src is also aligned.
-  if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
+#if defined(__SSE3__)
+  // Process the bulk of the input 32 (AVX2) or 16 (SSE) bytes at a time.
+#if defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64)
+  const bool has_avx2 = CpuFeatures::IsSupported(AVX2);
+#else
+  // Simulator builds run on x86 hosts but only initialize the target's CPU
+  // feature set.
+  const bool has_avx2 = false;
+#endif
+  if (has_avx2) {
+    AsciiConvertAvx2<is_lower>(&dst, &src, limit, &changed);
+  }
+  AsciiConvertSse<is_lower>(&dst, &src, limit, &changed);
+#elif defined(NEON64)
+  // Process the bulk of the input 16 bytes at a time.
+  AsciiConvertNeon<is_lower>(&dst, &src, limit, &changed);
+#else
+  // No byte-wide SIMD available. Only attempt processing one word at a time
+  // if both strings are aligned, which holds for sequential string data
+  // (whether dst is freshly allocated or aliases src).
+  if (IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)) &&
+      IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
     // Process the prefix of the input that requires no conversion one aligned
     // (machine) word at a time.
     while (src <= limit - sizeof(word_t)) {
@@ -106,8 +267,12 @@ int FastAsciiConvert(char* dst, const char* src, int length,
       dst += sizeof(word_t);
     }
   }
-  // Process the last few bytes of the input (or the whole input if
-  // unaligned access is not supported).
+#endif  // defined(__SSE3__)
+
+  // Process the last few bytes of the input, or the whole input if no
+  // vectorized prefix could be processed, one character at a time. This also
+  // locates the exact position of the first non-ASCII character, at which
+  // conversion stops.
   while (src < limit) {
     char c = *src;
     if ((c & kAsciiMask) != 0) return static_cast<int>(src - saved_src);
@@ -120,8 +285,8 @@ int FastAsciiConvert(char* dst, const char* src, int length,
     ++dst;
   }
 
-  DCHECK(
-      CheckFastAsciiConvert(saved_dst, saved_src, length, changed, is_lower));
+  DCHECK_IMPLIES(can_check, CheckFastAsciiConvert(saved_dst, saved_src, length,
+                                                  changed, is_lower));
 
   *changed_out = changed;
   return length;
@@ -0,0 +1,122 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include <cstring>
+
+#include "src/base/bits.h"
+
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+#if defined(__SSE3__) || defined(NEON64)
+
+namespace {
+
+// Verifies a candidate whose first and last characters already matched.
+inline bool VerifyCandidate(const uint8_t* subject, const uint8_t* pattern,
+                            int pattern_length) {
+  return memcmp(subject + 1, pattern + 1, pattern_length - 2) == 0;
+}
+
+}  // namespace
+
+bool SimdOneByteFilterSearchAvailable() { return true; }
+
+int SimdOneByteFilterSearch(const uint8_t* subject, int subject_length,
+                            const uint8_t* pattern, int pattern_length,
+                            int index) {
+  DCHECK_GE(pattern_length, 2);
+  // Last valid start position of a match, inclusive.
+  const int max_start = subject_length - pattern_length;
+  const uint8_t first_char = pattern[0];
+  const uint8_t last_char = pattern[pattern_length - 1];
+  int i = index;
+
+#if defined(__SSE3__)
+  const __m128i first = _mm_set1_epi8(first_char);
+  const __m128i last = _mm_set1_epi8(last_char);
+  for (; i + 16 <= max_start + 1; i += 16) {
+    const __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    const __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + pattern_length - 1));
+    uint32_t mask = _mm_movemask_epi8(_mm_and_si128(
+        _mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+    while (mask != 0) {
+      const int pos = i + base::bits::CountTrailingZeros32(mask);
+      if (VerifyCandidate(subject + pos, pattern, pattern_length)) return pos;
+      mask &= mask - 1;
+    }
+  }
+#elif defined(NEON64)
+  const uint8x16_t first = vdupq_n_u8(first_char);
+  const uint8x16_t last = vdupq_n_u8(last_char);
+  for (; i + 16 <= max_start + 1; i += 16) {
+    const uint8x16_t block_first = vld1q_u8(subject + i);
+    const uint8x16_t block_last = vld1q_u8(subject + i + pattern_length - 1);
+    const uint8x16_t eq = vandq_u8(vceqq_u8(block_first, first),
+                                   vceqq_u8(block_last, last));
+    // Neon has no movemask; narrow each 8-bit lane to a nibble so the whole
+    // vector fits a 64-bit mask with 4 bits per lane.
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    while (mask != 0) {
+      const int lane = base::bits::CountTrailingZeros64(mask) >> 2;
+      const int pos = i + lane;
+      if (VerifyCandidate(subject + pos, pattern, pattern_length)) return pos;
+      mask &= ~(uint64_t{0xF} << (lane * 4));
+    }
+  }
+#endif
+
+  // Scalar tail: fewer than a full vector of start positions left.
+  for (; i <= max_start; i++) {
+    if (subject[i] == first_char &&
+        subject[i + pattern_length - 1] == last_char &&
+        VerifyCandidate(subject + i, pattern, pattern_length)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+#else  // !(defined(__SSE3__) || defined(NEON64))
+
+bool SimdOneByteFilterSearchAvailable() { return false; }
+
+int SimdOneByteFilterSearch(const uint8_t* subject, int subject_length,
+                            const uint8_t* pattern, int pattern_length,
+                            int index) {
+  // Never selected as a strategy when unavailable.
+  UNREACHABLE();
+}
+
+#endif  // defined(__SSE3__) || defined(NEON64)
+
+#undef NEON64
+
+}  // namespace internal
+}  // namespace v8
@@ -53,6 +53,20 @@ class StringSearchBase {
   friend class Isolate;
 };
 
+// SIMD-filtered search over one-byte subject and pattern: compares the
+// pattern's first and last characters against whole vectors of the subject
+// and only verifies the rare positions where both match, as in modern memmem
+// implementations. Defined out of line (string-search.cc) so this header
+// does not pull in SIMD headers. Returns the index of the first match at or
+// after |index|, or -1.
+V8_EXPORT_PRIVATE int SimdOneByteFilterSearch(const uint8_t* subject,
+                                              int subject_length,
+                                              const uint8_t* pattern,
+                                              int pattern_length, int index);
+
+// Whether this build has a vectorized SimdOneByteFilterSearch.
+V8_EXPORT_PRIVATE bool SimdOneByteFilterSearchAvailable();
+
 template <typename PatternChar, typename SubjectChar>
 class StringSearch : private StringSearchBase {
  public:
@@ -72,6 +86,16 @@ class StringSearch : private StringSearchBase {
         strategy_ = &SingleCharSearch;
         return;
       }
+      // Patterns too short for Boyer-Moore(-Horspool) shifts scan nearly
+      // every subject character; for flat one-byte subject/pattern pairs the
+      // wide first+last character filter turns that scan into vector
+      // compares. Longer patterns keep the shift-based strategies, which
+      // skip most of the subject entirely.
+      if (sizeof(PatternChar) == 1 && sizeof(SubjectChar) == 1 &&
+          SimdOneByteFilterSearchAvailable()) {
+        strategy_ = &SimdFilterSearch;
+        return;
+      }
       strategy_ = &LinearSearch;
       return;
     }
@@ -110,6 +134,10 @@ class StringSearch : private StringSearchBase {
                           base::Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int SimdFilterSearch(StringSearch<PatternChar, SubjectChar>* search,
+                              base::Vector<const SubjectChar> subject,
+                              int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            base::Vector<const SubjectChar> subject,
                            int start_index);
@@ -289,6 +317,24 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// SIMD-filtered Search Strategy
+//---------------------------------------------------------------------
+
+// Only selected for flat one-byte subject/pattern pairs; see
+// SimdOneByteFilterSearch.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::SimdFilterSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    base::Vector<const SubjectChar> subject, int index) {
+  DCHECK_EQ(1, sizeof(PatternChar));
+  DCHECK_EQ(1, sizeof(SubjectChar));
+  return SimdOneByteFilterSearch(
+      reinterpret_cast<const uint8_t*>(subject.begin()), subject.length(),
+      reinterpret_cast<const uint8_t*>(search->pattern_.begin()),
+      search->pattern_.length(), index);
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
@@ -76,9 +76,17 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip over whole ASCII runs with wide compares. ASCII characters are
+      // never surrogates, so tracking the run's last character as |previous|
+      // is enough for the surrogate pair checks.
+      size_t run = 1;
+      if (static_cast<size_t>(end - cursor) >=
+          unibrow::Utf8::kMinAsciiScanLength) {
+        run = unibrow::Utf8::AsciiPrefixLength(cursor, end - cursor);
+      }
+      previous = cursor[run - 1];
+      utf16_length_ += static_cast<int>(run);
+      cursor += run;
       continue;
     }
 
@@ -144,6 +152,16 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
+      // Copy whole ASCII runs at once; for one-byte output this is a memcpy.
+      if (static_cast<size_t>(end - cursor) >=
+          unibrow::Utf8::kMinAsciiScanLength) {
+        const size_t run =
+            unibrow::Utf8::AsciiPrefixLength(cursor, end - cursor);
+        CopyChars(out, cursor, run);
+        out += run;
+        cursor += run;
+        continue;
+      }
       *(out++) = static_cast<Char>(*cursor);
       cursor++;
       continue;
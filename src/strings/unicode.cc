@@ -21,6 +21,26 @@
 #include "unicode/uchar.h"
 #endif
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace unibrow {
 
 #ifndef V8_INTL_SUPPORT
@@ -231,11 +251,55 @@ uchar Utf8::ValueOfIncrementalFinish(State* state) {
   }
 }
 
+// static
+size_t Utf8::AsciiPrefixLength(const uint8_t* bytes, size_t length) {
+  size_t i = 0;
+#if defined(__SSE3__)
+  while (i + 16 <= length) {
+    const __m128i w =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+    if (_mm_movemask_epi8(w) != 0) break;  // Non-ASCII byte in this vector.
+    i += 16;
+  }
+#elif defined(NEON64)
+  while (i + 16 <= length) {
+    if (vmaxvq_u8(vld1q_u8(bytes + i)) > kMaxOneByteChar) break;
+    i += 16;
+  }
+#else
+  // No byte-wide SIMD available; scan one aligned machine word at a time.
+  const uintptr_t kNonAsciiMask = (~uintptr_t{0} / 0xFF) * 0x80;
+  while (i < length &&
+         reinterpret_cast<uintptr_t>(bytes + i) % sizeof(uintptr_t) != 0) {
+    if (bytes[i] > kMaxOneByteChar) return i;
+    i++;
+  }
+  while (i + sizeof(uintptr_t) <= length) {
+    if (*reinterpret_cast<const uintptr_t*>(bytes + i) & kNonAsciiMask) break;
+    i += sizeof(uintptr_t);
+  }
+#endif
+  // Scalar tail; also locates the exact position of the non-ASCII byte the
+  // loops above stopped in front of.
+  while (i < length && bytes[i] <= kMaxOneByteChar) i++;
+  return i;
+}
+
 bool Utf8::ValidateEncoding(const uint8_t* bytes, size_t length) {
   State state = State::kAccept;
   Utf8IncrementalBuffer throw_away = 0;
-  for (size_t i = 0; i < length && state != State::kReject; i++) {
+  size_t i = 0;
+  while (i < length) {
+    // Between sequences, skip whole ASCII runs with wide compares instead of
+    // feeding the DFA one byte at a time.
+    if (state == State::kAccept && length - i >= kMinAsciiScanLength &&
+        bytes[i] <= kMaxOneByteChar) {
+      i += AsciiPrefixLength(bytes + i, length - i);
+      continue;
+    }
     Utf8DfaDecoder::Decode(bytes[i], &state, &throw_away);
+    if (state == State::kReject) return false;
+    i++;
   }
   return state == State::kAccept;
 }
@@ -277,7 +341,19 @@ bool Wtf8::ValidateEncoding(const uint8_t* bytes, size_t length) {
   auto state = State::kAccept;
   uint32_t current = 0;
   uint32_t previous = 0;
-  for (size_t i = 0; i < length; i++) {
+  size_t i = 0;
+  while (i < length) {
+    // Between sequences, skip whole ASCII runs with wide compares. ASCII
+    // characters are never surrogates, so tracking the run's last character
+    // as |previous| is enough for the pair check below.
+    if (state == State::kAccept && length - i >= Utf8::kMinAsciiScanLength &&
+        bytes[i] <= Utf8::kMaxOneByteChar) {
+      DCHECK_EQ(0u, current);
+      const size_t run = Utf8::AsciiPrefixLength(bytes + i, length - i);
+      previous = bytes[i + run - 1];
+      i += run;
+      continue;
+    }
     GeneralizedUtf8DfaDecoder::Decode(bytes[i], &state, &current);
     if (state == State::kReject) return false;
     if (state == State::kAccept) {
@@ -288,6 +364,7 @@ bool Wtf8::ValidateEncoding(const uint8_t* bytes, size_t length) {
       previous = current;
       current = 0;
     }
+    i++;
   }
   return state == State::kAccept;
 }
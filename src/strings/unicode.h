@@ -224,6 +224,12 @@ class V8_EXPORT_PRIVATE Utf8 {
   // - absence of surrogates,
   // - valid code point range.
   static bool ValidateEncoding(const uint8_t* str, size_t length);
+
+  // Returns the length of the longest pure-ASCII prefix of [str, str+length).
+  // Vectorized where byte-wide SIMD is available; for inputs shorter than
+  // kMinAsciiScanLength a plain byte loop is cheaper than the call.
+  static size_t AsciiPrefixLength(const uint8_t* str, size_t length);
+  static const size_t kMinAsciiScanLength = 16;
 };
 
 #if V8_ENABLE_WEBASSEMBLY
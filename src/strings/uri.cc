@@ -6,11 +6,37 @@
 
 #include <vector>
 
+#include "src/base/bits.h"
+#include "src/base/lazy-instance.h"
 #include "src/execution/isolate-inl.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-search.h"
 #include "src/strings/unicode-inl.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3 or SSSE3. However, it does define AVX, and AVX
+// implies both.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#ifndef __SSSE3__
+#define __SSSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -73,6 +99,42 @@ int TwoDigitHex(base::uc16 character1, base::uc16 character2) {
   return (high << 4) + low;
 }
 
+// Returns the index of the first character at or after |i| that cannot be
+// copied to the output verbatim during decoding: a '%' starting an escape
+// sequence, or a non-ASCII character (which switches to the two-byte path).
+// Scans 16 bytes per stride where byte-wide SIMD is available.
+int FindNextDecodeSpecial(const uint8_t* chars, int length, int i) {
+#if defined(__SSE3__)
+  const __m128i percent = _mm_set1_epi8('%');
+  while (i + 16 <= length) {
+    const __m128i w =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    const int special =
+        _mm_movemask_epi8(w) | _mm_movemask_epi8(_mm_cmpeq_epi8(w, percent));
+    if (special != 0) return i + base::bits::CountTrailingZeros32(special);
+    i += 16;
+  }
+#elif defined(NEON64)
+  const uint8x16_t percent = vdupq_n_u8('%');
+  while (i + 16 <= length) {
+    const uint8x16_t w = vld1q_u8(chars + i);
+    const uint8x16_t special =
+        vorrq_u8(vcgtq_u8(w, vdupq_n_u8(0x7F)), vceqq_u8(w, percent));
+    // Neon has no movemask; narrow each 8-bit lane to a nibble so the whole
+    // vector fits a 64-bit mask with 4 bits per lane.
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(special), 4)), 0);
+    if (mask != 0) return i + (base::bits::CountTrailingZeros64(mask) >> 2);
+    i += 16;
+  }
+#endif
+  while (i < length && chars[i] != '%' &&
+         chars[i] <= unibrow::Utf8::kMaxOneByteChar) {
+    i++;
+  }
+  return i;
+}
+
 template <typename T>
 void AddToBuffer(base::uc16 decoded, String::FlatContent* uri_content,
                  int index, bool is_uri, std::vector<T>* buffer) {
@@ -143,6 +205,41 @@ bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
   String::FlatContent uri_content = uri->GetFlatContent(no_gc);
 
   int uri_length = uri->length();
+  if (uri_content.IsOneByte()) {
+    // Fast path: bulk-copy the spans between escape sequences instead of
+    // pushing one character at a time.
+    const uint8_t* chars = uri_content.ToOneByteVector().begin();
+    int k = 0;
+    while (k < uri_length) {
+      const int special = FindNextDecodeSpecial(chars, uri_length, k);
+      if (special > k) {
+        one_byte_buffer->insert(one_byte_buffer->end(), chars + k,
+                                chars + special);
+        k = special;
+      }
+      if (k >= uri_length) break;
+      const base::uc16 code = chars[k];
+      if (code > unibrow::Utf8::kMaxOneByteChar) {
+        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
+                           two_byte_buffer);
+      }
+      DCHECK_EQ('%', code);
+      int two_digits;
+      if (k + 2 >= uri_length ||
+          (two_digits = TwoDigitHex(chars[k + 1], chars[k + 2])) < 0) {
+        return false;
+      }
+      const base::uc16 decoded = static_cast<base::uc16>(two_digits);
+      if (decoded > unibrow::Utf8::kMaxOneByteChar) {
+        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
+                           two_byte_buffer);
+      }
+      AddToBuffer(decoded, &uri_content, k, is_uri, one_byte_buffer);
+      k += 3;
+    }
+    return true;
+  }
+
   for (int k = 0; k < uri_length; k++) {
     base::uc16 code = uri_content.Get(k);
     if (code == '%') {
@@ -276,6 +373,113 @@ void EncodePair(base::uc16 cc1, base::uc16 cc2, std::vector<uint8_t>* buffer) {
   }
 }
 
+// Per-character "may be copied verbatim" tables for one-byte strings, plus
+// nibble-indexed bitmasks of the same sets for the vectorized classifier: an
+// ASCII character c is clean iff lo_bits[c & 0xF] has bit (c >> 4) set.
+// Characters above 0x7F always need escaping.
+struct UriEncodeTables {
+  UriEncodeTables() {
+    for (int c = 0; c < 256; c++) {
+      const base::uc16 character = static_cast<base::uc16>(c);
+      component_clean[c] = c <= unibrow::Utf8::kMaxOneByteChar &&
+                           IsUnescapePredicateInUriComponent(character);
+      uri_clean[c] = component_clean[c] || (c <= unibrow::Utf8::kMaxOneByteChar
+                                                ? IsUriSeparator(character)
+                                                : false);
+    }
+    for (int c = 0; c <= unibrow::Utf8::kMaxOneByteChar; c++) {
+      if (component_clean[c]) component_lo_bits[c & 0xF] |= 1 << (c >> 4);
+      if (uri_clean[c]) uri_lo_bits[c & 0xF] |= 1 << (c >> 4);
+    }
+  }
+
+  bool component_clean[256];
+  bool uri_clean[256];
+  uint8_t component_lo_bits[16] = {};
+  uint8_t uri_lo_bits[16] = {};
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(UriEncodeTables, GetUriEncodeTables)
+
+// Returns the index of the first character at or after |i| that needs
+// escaping, i.e. is not in the clean set described by |tables| and |is_uri|.
+// Scans 16 bytes per stride where a byte-shuffle instruction is available.
+int FindNextEscapedChar(const uint8_t* chars, int length, int i,
+                        const UriEncodeTables& tables, bool is_uri) {
+  const bool* clean = is_uri ? tables.uri_clean : tables.component_clean;
+#if defined(__SSSE3__)
+  const uint8_t* lo_bits =
+      is_uri ? tables.uri_lo_bits : tables.component_lo_bits;
+  const __m128i lo_table =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(lo_bits));
+  const __m128i hi_bit_table =
+      _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i low_nibble = _mm_set1_epi8(0x0F);
+  while (i + 16 <= length) {
+    const __m128i w =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    const __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(w, low_nibble));
+    // Characters above 0x7F index the zeroed upper half of |hi_bit_table| and
+    // are therefore classified as escaped.
+    const __m128i hi = _mm_shuffle_epi8(
+        hi_bit_table, _mm_and_si128(_mm_srli_epi16(w, 4), low_nibble));
+    const int escaped = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128()));
+    if (escaped != 0) return i + base::bits::CountTrailingZeros32(escaped);
+    i += 16;
+  }
+#elif defined(NEON64)
+  const uint8_t* lo_bits =
+      is_uri ? tables.uri_lo_bits : tables.component_lo_bits;
+  const uint8x16_t lo_table = vld1q_u8(lo_bits);
+  static const uint8_t kHiBitTable[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                          0, 0, 0, 0, 0,  0,  0,  0};
+  const uint8x16_t hi_bit_table = vld1q_u8(kHiBitTable);
+  while (i + 16 <= length) {
+    const uint8x16_t w = vld1q_u8(chars + i);
+    const uint8x16_t lo = vqtbl1q_u8(lo_table, vandq_u8(w, vdupq_n_u8(0x0F)));
+    const uint8x16_t hi = vqtbl1q_u8(hi_bit_table, vshrq_n_u8(w, 4));
+    const uint8x16_t escaped = vceqq_u8(vandq_u8(lo, hi), vdupq_n_u8(0));
+    // Neon has no movemask; narrow each 8-bit lane to a nibble so the whole
+    // vector fits a 64-bit mask with 4 bits per lane.
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(escaped), 4)), 0);
+    if (mask != 0) return i + (base::bits::CountTrailingZeros64(mask) >> 2);
+    i += 16;
+  }
+#endif
+  while (i < length && clean[chars[i]]) i++;
+  return i;
+}
+
+// One-byte strings contain no surrogates, so encoding cannot fail: copy spans
+// of characters that survive escaping verbatim and escape the rest.
+void EncodeOneByte(base::Vector<const uint8_t> vector, bool is_uri,
+                   std::vector<uint8_t>* buffer) {
+  const UriEncodeTables& tables = *GetUriEncodeTables();
+  const uint8_t* chars = vector.begin();
+  const int length = vector.length();
+  int i = 0;
+  while (i < length) {
+    const int escaped = FindNextEscapedChar(chars, length, i, tables, is_uri);
+    if (escaped > i) {
+      buffer->insert(buffer->end(), chars + i, chars + escaped);
+      i = escaped;
+    }
+    if (i >= length) break;
+    const uint8_t c = chars[i];
+    if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      const uint8_t escaped_octet[3] = {'%', base::HexCharOfValue(c >> 4),
+                                        base::HexCharOfValue(c & 0x0F)};
+      buffer->insert(buffer->end(), escaped_octet, escaped_octet + 3);
+    } else {
+      // Latin-1 characters above 0x7F encode to two UTF-8 bytes.
+      EncodeSingle(c, buffer);
+    }
+    i++;
+  }
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
@@ -290,32 +494,36 @@ MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
     DisallowGarbageCollection no_gc;
     String::FlatContent uri_content = uri->GetFlatContent(no_gc);
 
-    for (int k = 0; k < uri_length; k++) {
-      base::uc16 cc1 = uri_content.Get(k);
-      if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
-        k++;
-        if (k < uri_length) {
-          base::uc16 cc2 = uri->Get(k);
-          if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
-            EncodePair(cc1, cc2, &buffer);
-            continue;
+    if (uri_content.IsOneByte()) {
+      EncodeOneByte(uri_content.ToOneByteVector(), is_uri, &buffer);
+    } else {
+      for (int k = 0; k < uri_length; k++) {
+        base::uc16 cc1 = uri_content.Get(k);
+        if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
+          k++;
+          if (k < uri_length) {
+            base::uc16 cc2 = uri->Get(k);
+            if (unibrow::Utf16::IsTrailSurrogate(cc2)) {
+              EncodePair(cc1, cc2, &buffer);
+              continue;
+            }
           }
+        } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
+          if (IsUnescapePredicateInUriComponent(cc1) ||
+              (is_uri && IsUriSeparator(cc1))) {
+            buffer.push_back(cc1);
+          } else {
+            EncodeSingle(cc1, &buffer);
+          }
+          continue;
         }
-      } else if (!unibrow::Utf16::IsTrailSurrogate(cc1)) {
-        if (IsUnescapePredicateInUriComponent(cc1) ||
-            (is_uri && IsUriSeparator(cc1))) {
-          buffer.push_back(cc1);
-        } else {
-          EncodeSingle(cc1, &buffer);
-        }
-        continue;
-      }
 
-      // String::FlatContent DCHECKs its contents did not change during its
-      // lifetime. Throwing the error inside the loop may cause GC and move the
-      // string contents.
-      throw_error = true;
-      break;
+        // String::FlatContent DCHECKs its contents did not change during its
+        // lifetime. Throwing the error inside the loop may cause GC and move
+        // the string contents.
+        throw_error = true;
+        break;
+      }
     }
   }
 
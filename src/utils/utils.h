@@ -389,6 +389,24 @@ V8_INLINE bool SimdMemEqual(const Char* lhs, const Char* rhs, size_t count) {
     }
   }
 }
+// Compares one-byte chars against two-byte chars by widening eight one-byte
+// characters per step, for the mixed-representation comparisons that
+// String::SlowEquals performs when a flat one-byte string is compared with a
+// flat two-byte string.
+V8_ALLOW_UNUSED inline bool SimdMemEqualWide(const uint8_t* lhs,
+                                             const uint16_t* rhs,
+                                             size_t chars) {
+  size_t i = 0;
+  for (; chars - i >= 8; i += 8) {
+    const uint16x8_t widened = vmovl_u8(vld1_u8(lhs + i));
+    const uint16x8_t wide = vld1q_u16(rhs + i);
+    if (vmaxvq_u16(veorq_u16(widened, wide)) != 0) return false;
+  }
+  for (; i < chars; i++) {
+    if (lhs[i] != rhs[i]) return false;
+  }
+  return true;
+}
 #endif  // defined(V8_OPTIMIZE_WITH_NEON)
 
 // Compare 8bit/16bit chars to 8bit/16bit chars.
@@ -406,6 +424,15 @@ inline bool CompareCharsEqualUnsigned(const lchar* lhs, const rchar* rhs,
     // memcmp compares byte-by-byte, but for equality it doesn't matter whether
     // two-byte char comparison is little- or big-endian.
     return memcmp(lhs, rhs, chars * sizeof(*lhs)) == 0;
+  } else {
+#if defined(V8_OPTIMIZE_WITH_NEON)
+    if constexpr (sizeof(*lhs) == 1 && sizeof(*rhs) == 2) {
+      return SimdMemEqualWide(lhs, rhs, chars);
+    }
+    if constexpr (sizeof(*lhs) == 2 && sizeof(*rhs) == 1) {
+      return SimdMemEqualWide(rhs, lhs, chars);
+    }
+#endif
   }
   for (const lchar* limit = lhs + chars; lhs < limit; ++lhs, ++rhs) {
     if (*lhs != *rhs) return false;
@@ -800,6 +800,13 @@ class CompilationStateImpl {
   size_t bytes_since_last_chunk_ = 0;
   std::vector<uint8_t> compilation_progress_;
 
+  // Functions the profile marked as tiered-up, as {func_index, priority}
+  // pairs in ascending index order. Populated by
+  // {ApplyPgoInfoToInitialProgress} and consumed by
+  // {InitializeCompilationUnits}, which schedules them as top-tier priority
+  // units so TurboFan compiles hot functions first.
+  std::vector<std::pair<int, int>> pgo_top_tier_priority_units_;
+
   // The timestamp of the last top-tier compilation.
   // This field is updated on every publishing of top-tier code, and is reset
   // once caching is triggered. Hence it also informs whether a caching task is
@@ -993,6 +1000,21 @@ const WasmCompilationHint* GetCompilationHint(const WasmModule* module,
 CompileStrategy GetCompileStrategy(const WasmModule* module,
                                    WasmFeatures enabled_features,
                                    uint32_t func_index, bool lazy_module) {
+  // A compilation policy requested via the JS API overrides both the
+  // process-wide flag and any compilation hints embedded in the module.
+  switch (module->compile_policy) {
+    case CompilePolicy::kEager:
+      return CompileStrategy::kEager;
+    case CompilePolicy::kLazy:
+      return CompileStrategy::kLazy;
+    case CompilePolicy::kHybrid:
+      return std::binary_search(module->eager_functions.begin(),
+                                module->eager_functions.end(), func_index)
+                 ? CompileStrategy::kEager
+                 : CompileStrategy::kLazy;
+    case CompilePolicy::kDefault:
+      break;
+  }
   if (lazy_module) return CompileStrategy::kLazy;
   if (!enabled_features.has_compilation_hints()) {
     return CompileStrategy::kDefault;
@@ -1161,6 +1183,16 @@ enum OnlyLazyFunctions : bool {
 };
 
 bool IsLazyModule(const WasmModule* module) {
+  switch (module->compile_policy) {
+    case CompilePolicy::kLazy:
+      return true;
+    case CompilePolicy::kEager:
+    case CompilePolicy::kHybrid:
+      // Hybrid modules are handled per function in {GetCompileStrategy}.
+      return false;
+    case CompilePolicy::kDefault:
+      break;
+  }
   return v8_flags.wasm_lazy_compilation ||
          (v8_flags.asm_wasm_lazy_compilation && is_asmjs_module(module));
 }
@@ -1509,6 +1541,31 @@ void TriggerTierUp(Tagged<WasmTrustedInstanceData> trusted_instance_data,
   compilation_state->AddTopTierPriorityCompilationUnit(tiering_unit, priority);
 }
 
+void TriggerTierUp(NativeModule* native_module, int func_index) {
+  // Unlike the variant above, this is not called from a frame of the function
+  // itself, but e.g. from the tiering sampler thread. There is no instance at
+  // hand, so no tiering budget is reset and no type feedback is processed;
+  // top-tier compilation makes do with whatever feedback has been collected.
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  const WasmModule* module = native_module->module();
+  int priority;
+  {
+    base::SharedMutexGuard<base::kExclusive> mutex_guard(
+        &module->type_feedback.mutex);
+    int& stored_priority =
+        module->type_feedback.feedback_for_function[func_index].tierup_priority;
+    if (stored_priority < kMaxInt) ++stored_priority;
+    priority = stored_priority;
+  }
+  // See the comment in the variant above for the meaning of this check.
+  if (priority == 2 || !base::bits::IsPowerOfTwo(priority)) return;
+
+  WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
+                                   kNotForDebugging};
+  compilation_state->AddTopTierPriorityCompilationUnit(tiering_unit, priority);
+}
+
 void TierUpNowForTesting(Isolate* isolate,
                          Tagged<WasmTrustedInstanceData> trusted_instance_data,
                          int func_index) {
@@ -1541,11 +1598,15 @@ bool IsI8Array(wasm::ValueType type, const WasmModule* module) {
 }
 
 // Validates the signatures of recognized compile-time imports, and stores
-// them on the {module}'s {well_known_imports} list.
+// them on the {module}'s {well_known_imports} list. Also transfers the
+// requested compilation policy onto the {module}, where the compile strategy
+// helpers can consult it.
 WasmError ValidateAndSetBuiltinImports(const WasmModule* module,
                                        base::Vector<const uint8_t> wire_bytes,
                                        CompileTimeImports imports) {
   DCHECK_EQ(module->origin, kWasmOrigin);
+  module->compile_policy = imports.compile_policy();
+  module->eager_functions = imports.eager_functions();
   if (imports.empty()) return {};
 
   static constexpr ValueType kRefExtern = ValueType::Ref(HeapType::kExtern);
@@ -1908,6 +1969,15 @@ std::unique_ptr<CompilationUnitBuilder> InitializeCompilation(
 
 bool MayCompriseLazyFunctions(const WasmModule* module,
                               WasmFeatures enabled_features) {
+  switch (module->compile_policy) {
+    case CompilePolicy::kEager:
+      return false;
+    case CompilePolicy::kLazy:
+    case CompilePolicy::kHybrid:
+      return true;
+    case CompilePolicy::kDefault:
+      break;
+  }
   if (IsLazyModule(module)) return true;
   if (enabled_features.has_compilation_hints()) return true;
 #ifdef ENABLE_SLOW_DCHECKS
@@ -2912,6 +2982,17 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
                            false, kWasmOrigin, counters_, metrics_recorder_,
                            job->context_id(), DecodingMethod::kAsync);
 
+      // Check compile-time imports before validating lazy functions, so that
+      // the compilation policy is set on the module and determines which
+      // functions count as lazy.
+      if (result.ok()) {
+        const WasmModule* module = result.value().get();
+        if (WasmError link_error = ValidateAndSetBuiltinImports(
+                module, job->wire_bytes_.module_bytes(),
+                job->compile_imports_)) {
+          result = ModuleResult{std::move(link_error)};
+        }
+      }
       // Validate lazy functions here if requested.
       if (result.ok() && !v8_flags.wasm_lazy_validation) {
         const WasmModule* module = result.value().get();
@@ -2921,14 +3002,6 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
           result = ModuleResult{std::move(validation_error)};
         }
       }
-      if (result.ok()) {
-        const WasmModule* module = result.value().get();
-        if (WasmError link_error = ValidateAndSetBuiltinImports(
-                module, job->wire_bytes_.module_bytes(),
-                job->compile_imports_)) {
-          result = ModuleResult{std::move(link_error)};
-        }
-      }
     }
     if (result.failed()) {
       // Decoding failure; reject the promise and clean up.
@@ -3154,6 +3227,12 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
     return true;
   }
 
+  // {ValidateAndSetBuiltinImports} only runs at the end of the stream, but
+  // the compile strategy of each incoming function body is decided in
+  // {ProcessFunctionBody}, so transfer the compilation policy already here.
+  decoder_.module()->compile_policy = job_->compile_imports_.compile_policy();
+  decoder_.module()->eager_functions = job_->compile_imports_.eager_functions();
+
   // Execute the PrepareAndStartCompile step immediately and not in a separate
   // task.
   int num_imported_functions =
@@ -3528,7 +3607,7 @@ void CompilationStateImpl::ApplyPgoInfoToInitialProgress(
 
   // Functions that were tiered up during PGO generation are eagerly compiled to
   // TurboFan (in the background, not blocking instantiation).
-  for (int func_index : pgo_info->tiered_up_functions()) {
+  for (auto [func_index, priority] : pgo_info->tiered_up_functions()) {
     uint8_t& progress =
         compilation_progress_[declared_function_index(module, func_index)];
     ExecutionTier old_baseline_tier =
@@ -3540,8 +3619,12 @@ void CompilationStateImpl::ApplyPgoInfoToInitialProgress(
     if (old_top_tier == ExecutionTier::kTurbofan) continue;
 
     // Set top tier to TurboFan, so we eagerly trigger compilation in the
-    // background.
+    // background. Remember the function together with its profiled tier-up
+    // priority; {InitializeCompilationUnits} schedules these as top-tier
+    // priority units so that hot functions leave Liftoff first.
     progress = RequiredTopTierField::update(progress, ExecutionTier::kTurbofan);
+    pgo_top_tier_priority_units_.emplace_back(static_cast<int>(func_index),
+                                              priority);
   }
 }
 
@@ -3578,7 +3661,7 @@ void CompilationStateImpl::ApplyPgoInfoLate(ProfileInformation* pgo_info) {
 
   // Functions that were tiered up during PGO generation are eagerly compiled to
   // TurboFan in the background.
-  for (int func_index : pgo_info->tiered_up_functions()) {
+  for (auto [func_index, priority] : pgo_info->tiered_up_functions()) {
     uint8_t& progress =
         compilation_progress_[declared_function_index(module, func_index)];
     ExecutionTier old_baseline_tier =
@@ -3593,9 +3676,15 @@ void CompilationStateImpl::ApplyPgoInfoLate(ProfileInformation* pgo_info) {
     ExecutionTier reached_tier = ReachedTierField::decode(progress);
     if (reached_tier == ExecutionTier::kTurbofan) continue;
 
-    // Set top tier to TurboFan and schedule a compilation unit.
+    // Set top tier to TurboFan and schedule a priority compilation unit, so
+    // that the hottest profiled functions are compiled before the regular
+    // tiering units, in order of descending tier-up priority.
     progress = RequiredTopTierField::update(progress, ExecutionTier::kTurbofan);
-    builder.AddTopTierUnit(func_index, ExecutionTier::kTurbofan);
+    WasmCompilationUnit tiering_unit{static_cast<int>(func_index),
+                                     ExecutionTier::kTurbofan,
+                                     kNotForDebugging};
+    AddTopTierPriorityCompilationUnit(tiering_unit,
+                                      static_cast<size_t>(priority));
   }
   builder.Commit();
 }
@@ -3624,8 +3713,10 @@ void CompilationStateImpl::InitializeCompilationProgress(
     outstanding_baseline_units_ += module->num_declared_functions;
   }
 
-  // Apply compilation hints, if enabled.
-  if (native_module_->enabled_features().has_compilation_hints()) {
+  // Apply compilation hints, if enabled. A compilation policy requested via
+  // the JS API overrides any embedded hints.
+  if (module->compile_policy == CompilePolicy::kDefault &&
+      native_module_->enabled_features().has_compilation_hints()) {
     size_t num_hints = std::min(module->compilation_hints.size(),
                                 size_t{module->num_declared_functions});
     for (size_t hint_idx = 0; hint_idx < num_hints; ++hint_idx) {
@@ -3634,6 +3725,26 @@ void CompilationStateImpl::InitializeCompilationProgress(
     }
   }
 
+  // For hybrid modules, downgrade all functions outside the eager list to
+  // lazy compilation. The default progress was computed for a non-lazy
+  // module, so the eager functions keep their default tiers.
+  if (module->compile_policy == CompilePolicy::kHybrid) {
+    DCHECK_NE(ExecutionTier::kNone, default_tiers.baseline_tier);
+    constexpr uint8_t kProgressForLazyFunctions =
+        RequiredBaselineTierField::encode(ExecutionTier::kNone) |
+        RequiredTopTierField::encode(ExecutionTier::kNone) |
+        ReachedTierField::encode(ExecutionTier::kNone);
+    for (uint32_t i = 0; i < module->num_declared_functions; ++i) {
+      uint32_t func_index = module->num_imported_functions + i;
+      if (std::binary_search(module->eager_functions.begin(),
+                             module->eager_functions.end(), func_index)) {
+        continue;
+      }
+      compilation_progress_[i] = kProgressForLazyFunctions;
+      outstanding_baseline_units_--;
+    }
+  }
+
   // Apply PGO information, if available.
   if (pgo_info) ApplyPgoInfoToInitialProgress(pgo_info);
 
@@ -3669,16 +3780,43 @@ void CompilationStateImpl::AddCompilationUnitInternal(
 void CompilationStateImpl::InitializeCompilationUnits(
     std::unique_ptr<CompilationUnitBuilder> builder) {
   int offset = native_module_->module()->num_imported_functions;
+  std::vector<std::pair<int, int>> pgo_priority_units;
   {
     base::MutexGuard guard(&callbacks_mutex_);
+    pgo_priority_units = std::move(pgo_top_tier_priority_units_);
+    pgo_top_tier_priority_units_.clear();
 
+    // Both {pgo_priority_units} and this loop are in ascending function index
+    // order, so a single cursor finds the functions that get a priority unit.
+    auto pgo_it = pgo_priority_units.begin();
     for (size_t i = 0, e = compilation_progress_.size(); i < e; ++i) {
       uint8_t function_progress = compilation_progress_[i];
       int func_index = offset + static_cast<int>(i);
+      if (pgo_it != pgo_priority_units.end() && pgo_it->first == func_index) {
+        // This function gets a top-tier priority unit below; drop the top-tier
+        // requirement from the progress passed to the builder so we do not
+        // also schedule a regular top-tier unit for it.
+        // {compilation_progress_} itself keeps the TurboFan requirement.
+        function_progress = RequiredTopTierField::update(
+            function_progress,
+            RequiredBaselineTierField::decode(function_progress));
+        ++pgo_it;
+      }
       AddCompilationUnitInternal(builder.get(), func_index, function_progress);
     }
   }
   builder->Commit();
+
+  // Schedule TurboFan compilation of functions that were hot in the profiling
+  // run as priority units. These are picked up before the regular tiering
+  // units above, in order of descending tier-up priority, so hot functions do
+  // not stay in Liftoff until background tiering reaches their index.
+  for (auto [func_index, priority] : pgo_priority_units) {
+    WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
+                                     kNotForDebugging};
+    AddTopTierPriorityCompilationUnit(tiering_unit,
+                                      static_cast<size_t>(priority));
+  }
 }
 
 void CompilationStateImpl::AddCompilationUnit(CompilationUnitBuilder* builder,
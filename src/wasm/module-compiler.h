@@ -93,6 +93,11 @@ void ThrowLazyCompilationError(Isolate* isolate,
 // triggered, we instead increase the priority with exponential back-off.
 V8_EXPORT_PRIVATE void TriggerTierUp(Tagged<WasmTrustedInstanceData>,
                                      int func_index);
+// Variant of the above that can be called without a specific instance, e.g.
+// from the tiering sampler thread. Does not reset any tiering budget and does
+// not process type feedback.
+V8_EXPORT_PRIVATE void TriggerTierUp(NativeModule* native_module,
+                                     int func_index);
 // Synchronous version of the above.
 void TierUpNowForTesting(Isolate*, Tagged<WasmTrustedInstanceData>,
                          int func_index);
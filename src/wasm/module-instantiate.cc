@@ -1652,6 +1652,20 @@ void InstanceBuilder::SanitizeImports() {
       }
     }
 
+    if (import.kind == kExternalGlobal &&
+        module_object_->native_module()
+            ->compile_imports()
+            .has_string_constants(wire_bytes.SubVector(
+                import.module_name.offset(), import.module_name.end_offset()))) {
+      // Imported string constant: the field name is the string value. The
+      // extracted name is internalized and therefore flat, so the import is
+      // resolved without consulting the imports object and without copying
+      // the string contents. {ProcessImportedGlobal} type-checks the global
+      // as usual, so a mutable or non-externref declaration fails to link.
+      sanitized_imports_.push_back({module_name, import_name, import_name});
+      continue;
+    }
+
     if (ffi_.is_null()) {
       // No point in continuing if we don't have an imports object.
       thrower_->TypeError(
@@ -2138,17 +2152,15 @@ void InstanceBuilder::CompileImportWrappers(
                num_imports);
   NativeModule* native_module =
       trusted_instance_data->module_object()->native_module();
-  WasmImportWrapperCache::ModificationScope cache_scope(
-      native_module->import_wrapper_cache());
   const WellKnownImportsList& preknown_imports =
       module_->type_feedback.well_known_imports;
 
-  // Compilation is done in two steps:
-  // 1) Insert nullptr entries in the cache for wrappers that need to be
-  // compiled. 2) Compile wrappers in background tasks using the
-  // ImportWrapperQueue. This way the cache won't invalidate other iterators
-  // when inserting a new WasmCode, since the key will already be there.
-  ImportWrapperQueue import_wrapper_queue;
+  // First resolve the set of wrappers required by this instantiation. This
+  // does not need the exclusive cache lock; repeated instantiations of a
+  // module (potentially shared with other isolates via the NativeModuleCache)
+  // typically find all wrappers already compiled and never take it.
+  std::vector<std::pair<WasmImportWrapperCache::CacheKey, const FunctionSig*>>
+      required_wrappers;
   for (int index = 0; index < num_imports; ++index) {
     Handle<Object> value = sanitized_imports_[index].value;
     if (module_->import_table[index].kind != kExternalFunction ||
@@ -2185,12 +2197,41 @@ void InstanceBuilder::CompileImportWrappers(
     }
     WasmImportWrapperCache::CacheKey key(kind, canonical_type_index,
                                          expected_arity, resolved.suspend());
+    required_wrappers.emplace_back(key, sig);
+  }
+
+  // Fast path: all required wrappers were already compiled by an earlier
+  // instantiation. {MaybeGet} returns nullptr both for absent keys and for
+  // entries whose compilation is still in progress under another thread's
+  // {ModificationScope}; either way we fall through to the slow path, which
+  // rechecks under the lock.
+  WasmImportWrapperCache* cache = native_module->import_wrapper_cache();
+  bool all_cached = true;
+  for (auto& entry : required_wrappers) {
+    const WasmImportWrapperCache::CacheKey& key = entry.first;
+    if (cache->MaybeGet(key.kind, key.canonical_type_index, key.expected_arity,
+                        key.suspend) == nullptr) {
+      all_cached = false;
+      break;
+    }
+  }
+  if (all_cached) return;
+
+  // Compilation is done in two steps:
+  // 1) Insert nullptr entries in the cache for wrappers that need to be
+  // compiled. 2) Compile wrappers in background tasks using the
+  // ImportWrapperQueue. This way the cache won't invalidate other iterators
+  // when inserting a new WasmCode, since the key will already be there.
+  WasmImportWrapperCache::ModificationScope cache_scope(cache);
+  ImportWrapperQueue import_wrapper_queue;
+  for (auto& [key, sig] : required_wrappers) {
     if (cache_scope[key] != nullptr) {
       // Cache entry already exists, no need to compile it again.
       continue;
     }
     import_wrapper_queue.insert(key, sig);
   }
+  if (import_wrapper_queue.size() == 0) return;
 
   auto compile_job_task = std::make_unique<CompileImportWrapperJob>(
       isolate_->counters(), native_module, &import_wrapper_queue, &cache_scope);
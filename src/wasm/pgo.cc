@@ -90,6 +90,10 @@ class ProfileGenerator {
       // TODO(13209): Make this less V8-specific for productionization.
       buffer.write_u8((was_executed ? kFunctionExecutedBit : 0) |
                       (was_tiered_up ? kFunctionTieredUpBit : 0));
+      // For tiered-up functions, also store the reached tier-up priority.
+      // This ranks functions by hotness, so that the next run can compile the
+      // hottest functions to TurboFan first.
+      if (was_tiered_up) buffer.write_u32v(static_cast<uint32_t>(prio));
     }
   }
 
@@ -160,7 +164,7 @@ void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
 std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
     Decoder& decoder, const WasmModule* module) {
   std::vector<uint32_t> executed_functions;
-  std::vector<uint32_t> tiered_up_functions;
+  std::vector<ProfiledTieredUpFunction> tiered_up_functions;
   uint32_t start = module->num_imported_functions;
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
@@ -168,7 +172,11 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
     CHECK_EQ(0, tiering_info & ~3);
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
-    if (was_tiered_up) tiered_up_functions.push_back(func_index);
+    if (was_tiered_up) {
+      int tierup_priority =
+          static_cast<int>(decoder.consume_u32v("tierup priority"));
+      tiered_up_functions.push_back({func_index, tierup_priority});
+    }
     if (was_executed) executed_functions.push_back(func_index);
   }
 
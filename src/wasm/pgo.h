@@ -17,10 +17,19 @@ namespace v8::internal::wasm {
 
 struct WasmModule;
 
+// A function that was tiered up in the profiling run, plus the tier-up
+// priority it had reached (the number of times it exhausted its tiering
+// budget; higher means hotter). The priority is used to compile hot functions
+// first during background tiering on the next run.
+struct ProfiledTieredUpFunction {
+  uint32_t func_index;
+  int tierup_priority;
+};
+
 class ProfileInformation {
  public:
   ProfileInformation(std::vector<uint32_t> executed_functions,
-                     std::vector<uint32_t> tiered_up_functions)
+                     std::vector<ProfiledTieredUpFunction> tiered_up_functions)
       : executed_functions_(std::move(executed_functions)),
         tiered_up_functions_(std::move(tiered_up_functions)) {}
 
@@ -31,13 +40,13 @@ class ProfileInformation {
   base::Vector<const uint32_t> executed_functions() const {
     return base::VectorOf(executed_functions_);
   }
-  base::Vector<const uint32_t> tiered_up_functions() const {
+  base::Vector<const ProfiledTieredUpFunction> tiered_up_functions() const {
     return base::VectorOf(tiered_up_functions_);
   }
 
  private:
   const std::vector<uint32_t> executed_functions_;
-  const std::vector<uint32_t> tiered_up_functions_;
+  const std::vector<ProfiledTieredUpFunction> tiered_up_functions_;
 };
 
 void DumpProfileToFile(const WasmModule* module,
@@ -6,9 +6,64 @@
 
 #include "src/base/platform/platform.h"
 #include "src/execution/simulator.h"
+#include "src/wasm/wasm-engine.h"
 
 namespace v8::internal::wasm {
 
+StackPool::~StackPool() {
+  if (v8_flags.trace_wasm_stack_switching) {
+    PrintF("Stack pool: %zu segments recycled, %zu reused, peak %zu KB\n",
+           recycled_segments_, reused_segments_, peak_retained_bytes_ / KB);
+  }
+  ReleaseAll();
+}
+
+uint8_t* StackPool::TryTakeSegment(size_t size) {
+  base::MutexGuard lock(&mutex_);
+  auto it = segments_.find(size);
+  if (it == segments_.end() || it->second.empty()) return nullptr;
+  uint8_t* segment = it->second.back();
+  it->second.pop_back();
+  retained_bytes_ -= size;
+  reused_segments_++;
+  return segment;
+}
+
+void StackPool::RecycleSegment(uint8_t* limit, size_t size) {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  base::MutexGuard lock(&mutex_);
+  recycled_segments_++;
+  // Return the physical pages to the OS, but keep the mapping and its
+  // read-write permissions, so the segment can be handed out again without a
+  // new mapping. If the pool is full or the discard fails, unmap the segment
+  // instead.
+  if (retained_bytes_ + size > kMaxRetainedBytes ||
+      !allocator->DiscardSystemPages(limit, size)) {
+    FreePages(allocator, limit, size);
+    return;
+  }
+  segments_[size].push_back(limit);
+  retained_bytes_ += size;
+  peak_retained_bytes_ = std::max(peak_retained_bytes_, retained_bytes_);
+}
+
+void StackPool::ReleaseAll() {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  base::MutexGuard lock(&mutex_);
+  for (auto& [size, segments] : segments_) {
+    for (uint8_t* segment : segments) {
+      FreePages(allocator, segment, size);
+    }
+  }
+  segments_.clear();
+  retained_bytes_ = 0;
+}
+
+size_t StackPool::RetainedBytes() const {
+  base::MutexGuard lock(&mutex_);
+  return retained_bytes_;
+}
+
 // static
 StackMemory* StackMemory::GetCurrentStackView(Isolate* isolate) {
   base::Vector<uint8_t> view = SimulatorStack::GetCurrentStackView(isolate);
@@ -19,9 +74,8 @@ StackMemory::~StackMemory() {
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Delete stack #%d\n", id_);
   }
-  PageAllocator* allocator = GetPlatformPageAllocator();
-  if (owned_ && !allocator->DecommitPages(limit_, size_)) {
-    V8::FatalProcessOutOfMemory(nullptr, "Decommit stack memory");
+  if (owned_) {
+    GetWasmEngine()->stack_pool().RecycleSegment(limit_, size_);
   }
   // We don't need to handle removing the last stack from the list (next_ ==
   // this). This only happens on isolate tear down, otherwise there is always
@@ -45,6 +99,14 @@ StackMemory::StackMemory(Isolate* isolate) : isolate_(isolate), owned_(true) {
   int kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
   size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
   size_ = RoundUp(size_, allocator->AllocatePageSize());
+  limit_ = GetWasmEngine()->stack_pool().TryTakeSegment(size_);
+  if (limit_ != nullptr) {
+    if (v8_flags.trace_wasm_stack_switching) {
+      PrintF("Reuse stack #%d from pool (limit: %p, base: %p)\n", id_, limit_,
+             limit_ + size_);
+    }
+    return;
+  }
   limit_ = static_cast<uint8_t*>(
       allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
                                PageAllocator::kReadWrite));
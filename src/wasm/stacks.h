@@ -9,6 +9,10 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/utils/allocation.h"
 
@@ -18,6 +22,55 @@ class Isolate;
 
 namespace v8::internal::wasm {
 
+// A pool of recycled stack segments, owned by the {WasmEngine}. Suspend-heavy
+// workloads (e.g. JSPI) create and drop many short-lived stacks, and paying a
+// fresh mapping plus page faults for each one is expensive. Freed segments
+// keep their mapping but return their physical pages to the OS lazily
+// (MADV_FREE-style, via {DiscardSystemPages}), so pooled segments cost no
+// memory while they sit idle and reuse pays page faults only for the pages a
+// continuation actually touches.
+class StackPool {
+ public:
+  StackPool() = default;
+  ~StackPool();
+
+  StackPool(const StackPool&) = delete;
+  StackPool& operator=(const StackPool&) = delete;
+
+  // Returns a recycled segment of exactly {size} bytes, or nullptr if none is
+  // available. Segments are kept in per-size free lists, so a change of
+  // {wasm_stack_switching_stack_size} does not hand out stale sizes.
+  uint8_t* TryTakeSegment(size_t size);
+
+  // Hands a stack segment back to the pool. Its pages are discarded but its
+  // mapping is retained for reuse, unless the pool already holds
+  // {kMaxRetainedBytes}; then the segment is unmapped instead.
+  void RecycleSegment(uint8_t* limit, size_t size);
+
+  // Unmaps all retained segments.
+  void ReleaseAll();
+
+  size_t RetainedBytes() const;
+
+  // Growth statistics.
+  size_t reused_segments() const { return reused_segments_; }
+  size_t recycled_segments() const { return recycled_segments_; }
+  size_t peak_retained_bytes() const { return peak_retained_bytes_; }
+
+ private:
+  // Retain at most 32MB of discarded mappings; beyond that, freed segments
+  // are unmapped immediately.
+  static constexpr size_t kMaxRetainedBytes = 32 * MB;
+
+  mutable base::Mutex mutex_;
+  // Free lists of discarded segments, keyed by segment size.
+  std::map<size_t, std::vector<uint8_t*>> segments_;
+  size_t retained_bytes_ = 0;
+  size_t reused_segments_ = 0;
+  size_t recycled_segments_ = 0;
+  size_t peak_retained_bytes_ = 0;
+};
+
 struct JumpBuffer {
   Address sp;
   Address fp;
@@ -34,6 +34,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-tiering-sampler.h"
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 #include "src/debug/wasm/gdb-server/gdb-server.h"
@@ -449,6 +450,10 @@ struct WasmEngine::IsolateInfo {
   // TODO(wasm): Remove this once we can use the generic js-to-wasm wrapper
   // everywhere.
   std::shared_ptr<OperationsBarrier> wrapper_compilation_barrier_;
+
+  // Samples the isolate's main thread to drive tier-up of loop-dominated
+  // functions (if --wasm-tiering-sampler is set).
+  std::unique_ptr<WasmTieringSampler> tiering_sampler;
 };
 
 void WasmEngine::ClearWeakScriptHandle(Isolate* isolate,
@@ -572,7 +577,7 @@ MaybeHandle<AsmWasmData> WasmEngine::SyncCompileTranslatedAsmJs(
   {
     // Register the script with the isolate. We do this unconditionally for
     // consistency; it is in particular required for logging lazy-compiled code.
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     auto& scripts = isolates_[isolate]->scripts;
     // If the same asm.js module is instantiated repeatedly, then we
@@ -637,7 +642,7 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
 #ifdef DEBUG
   // Ensure that code GC will check this isolate for live code.
   {
-    base::MutexGuard lock(&mutex_);
+    base::AdaptiveMutexGuard lock(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     DCHECK_EQ(1, isolates_[isolate]->native_modules.count(native_module.get()));
     DCHECK_EQ(1, native_modules_.count(native_module.get()));
@@ -813,7 +818,7 @@ void WasmEngine::EnterDebuggingForIsolate(Isolate* isolate) {
   // {AddPotentiallyDeadCode}. Therefore {RemoveCompiledCode} has to be
   // called outside the lock.
   {
-    base::MutexGuard lock(&mutex_);
+    base::AdaptiveMutexGuard lock(&mutex_);
     if (isolates_[isolate]->keep_in_debug_state) return;
     isolates_[isolate]->keep_in_debug_state = true;
     for (auto* native_module : isolates_[isolate]->native_modules) {
@@ -836,7 +841,7 @@ void WasmEngine::LeaveDebuggingForIsolate(Isolate* isolate) {
   // needs recompilation for tier up.
   std::vector<std::pair<std::shared_ptr<NativeModule>, bool>> native_modules;
   {
-    base::MutexGuard lock(&mutex_);
+    base::AdaptiveMutexGuard lock(&mutex_);
     isolates_[isolate]->keep_in_debug_state = false;
     auto can_remove_debug_code = [this](NativeModule* native_module) {
       DCHECK_EQ(1, native_modules_.count(native_module));
@@ -996,7 +1001,7 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   Handle<WasmModuleObject> module_object =
       WasmModuleObject::New(isolate, std::move(shared_native_module), script);
   {
-    base::MutexGuard lock(&mutex_);
+    base::AdaptiveMutexGuard lock(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     IsolateInfo* isolate_info = isolates_.find(isolate)->second.get();
     isolate_info->native_modules.insert(native_module);
@@ -1020,7 +1025,7 @@ void WasmEngine::FlushCode() {
 
 std::shared_ptr<CompilationStatistics>
 WasmEngine::GetOrCreateTurboStatistics() {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   if (compilation_stats_ == nullptr) {
     compilation_stats_.reset(new CompilationStatistics());
   }
@@ -1028,7 +1033,7 @@ WasmEngine::GetOrCreateTurboStatistics() {
 }
 
 void WasmEngine::DumpAndResetTurboStatistics() {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   if (compilation_stats_ != nullptr) {
     StdoutStream os;
     os << AsPrintableStatistics{"Turbofan Wasm", *compilation_stats_, false}
@@ -1038,7 +1043,7 @@ void WasmEngine::DumpAndResetTurboStatistics() {
 }
 
 void WasmEngine::DumpTurboStatistics() {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   if (compilation_stats_ != nullptr) {
     StdoutStream os;
     os << AsPrintableStatistics{"Turbofan Wasm", *compilation_stats_, false}
@@ -1047,7 +1052,7 @@ void WasmEngine::DumpTurboStatistics() {
 }
 
 CodeTracer* WasmEngine::GetCodeTracer() {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   if (code_tracer_ == nullptr) code_tracer_.reset(new CodeTracer(-1));
   return code_tracer_.get();
 }
@@ -1062,14 +1067,14 @@ AsyncCompileJob* WasmEngine::CreateAsyncCompileJob(
       isolate, enabled, compile_imports, std::move(bytes), context,
       incumbent_context, api_method_name, std::move(resolver), compilation_id);
   // Pass ownership to the unique_ptr in {async_compile_jobs_}.
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   async_compile_jobs_[job] = std::unique_ptr<AsyncCompileJob>(job);
   return job;
 }
 
 std::unique_ptr<AsyncCompileJob> WasmEngine::RemoveCompileJob(
     AsyncCompileJob* job) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   auto item = async_compile_jobs_.find(job);
   DCHECK(item != async_compile_jobs_.end());
   std::unique_ptr<AsyncCompileJob> result = std::move(item->second);
@@ -1078,7 +1083,7 @@ std::unique_ptr<AsyncCompileJob> WasmEngine::RemoveCompileJob(
 }
 
 bool WasmEngine::HasRunningCompileJob(Isolate* isolate) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   DCHECK_EQ(1, isolates_.count(isolate));
   for (auto& entry : async_compile_jobs_) {
     if (entry.first->isolate() == isolate) return true;
@@ -1091,7 +1096,7 @@ void WasmEngine::DeleteCompileJobsOnContext(Handle<Context> context) {
   // the mutex, such that deletion can reenter the WasmEngine.
   std::vector<std::unique_ptr<AsyncCompileJob>> jobs_to_delete;
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     for (auto it = async_compile_jobs_.begin();
          it != async_compile_jobs_.end();) {
       if (!it->first->context().is_identical_to(context)) {
@@ -1111,7 +1116,7 @@ void WasmEngine::DeleteCompileJobsOnIsolate(Isolate* isolate) {
   std::vector<std::weak_ptr<NativeModule>> modules_in_isolate;
   std::shared_ptr<OperationsBarrier> wrapper_compilation_barrier;
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     for (auto it = async_compile_jobs_.begin();
          it != async_compile_jobs_.end();) {
       if (it->first->isolate() != isolate) {
@@ -1146,17 +1151,24 @@ void WasmEngine::DeleteCompileJobsOnIsolate(Isolate* isolate) {
 }
 
 OperationsBarrier::Token WasmEngine::StartWrapperCompilation(Isolate* isolate) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   auto isolate_info_it = isolates_.find(isolate);
   if (isolate_info_it == isolates_.end()) return {};
   return isolate_info_it->second->wrapper_compilation_barrier_->TryLock();
 }
 
 void WasmEngine::AddIsolate(Isolate* isolate) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   DCHECK_EQ(0, isolates_.count(isolate));
   isolates_.emplace(isolate, std::make_unique<IsolateInfo>(isolate));
 
+  if (v8_flags.wasm_tiering_sampler) {
+    // The sampler is constructed here, on the isolate's thread, so that this
+    // thread is the one being sampled.
+    isolates_[isolate]->tiering_sampler =
+        std::make_unique<WasmTieringSampler>(isolate);
+  }
+
 #if defined(V8_COMPRESS_POINTERS)
   // The null value is not accessible on mksnapshot runs.
   if (isolate->snapshot_available()) {
@@ -1174,7 +1186,7 @@ void WasmEngine::AddIsolate(Isolate* isolate) {
     Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
     Counters* counters = isolate->counters();
     WasmEngine* engine = GetWasmEngine();
-    base::MutexGuard lock(&engine->mutex_);
+    base::AdaptiveMutexGuard lock(&engine->mutex_);
     DCHECK_EQ(1, engine->isolates_.count(isolate));
     for (auto* native_module : engine->isolates_[isolate]->native_modules) {
       native_module->SampleCodeSize(counters);
@@ -1196,11 +1208,22 @@ void WasmEngine::RemoveIsolate(Isolate* isolate) {
   }
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
+  // Stop the tiering sampler (if any) before taking {mutex_} below: the
+  // sampling thread releases wasm code references, which can take {mutex_}
+  // when code dies, so joining the thread under the lock could deadlock.
+  std::unique_ptr<WasmTieringSampler> tiering_sampler;
+  {
+    base::AdaptiveMutexGuard guard(&mutex_);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    tiering_sampler = std::move(isolates_[isolate]->tiering_sampler);
+  }
+  tiering_sampler.reset();
+
   // Keep a WasmCodeRefScope which dies after the {mutex_} is released, to avoid
   // deadlock when code actually dies, as that requires taking the {mutex_}.
   WasmCodeRefScope code_ref_scope_for_dead_code;
 
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
 
   // Lookup the IsolateInfo; do not remove it yet (that happens below).
   auto isolates_it = isolates_.find(isolate);
@@ -1265,7 +1288,7 @@ void WasmEngine::LogCode(base::Vector<WasmCode*> code_vec) {
       std::pair<std::shared_ptr<v8::TaskRunner>, std::unique_ptr<LogCodesTask>>;
   std::vector<TaskToSchedule> to_schedule;
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, native_modules_.count(native_module));
     NativeModuleInfo* native_module_info =
         native_modules_.find(native_module)->second.get();
@@ -1323,7 +1346,7 @@ void WasmEngine::LogCode(base::Vector<WasmCode*> code_vec) {
 }
 
 void WasmEngine::EnableCodeLogging(Isolate* isolate) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   auto it = isolates_.find(isolate);
   DCHECK_NE(isolates_.end(), it);
   IsolateInfo* info = it->second.get();
@@ -1340,7 +1363,7 @@ void WasmEngine::LogOutstandingCodesForIsolate(Isolate* isolate) {
   // the ref count without holding the mutex.
   std::unordered_map<int, IsolateInfo::CodeToLogPerScript> code_to_log;
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     code_to_log.swap(isolates_[isolate]->code_to_log);
   }
@@ -1378,7 +1401,7 @@ std::shared_ptr<NativeModule> WasmEngine::NewNativeModule(
       GetWasmCodeManager()->NewNativeModule(isolate, enabled, compile_imports,
                                             code_size_estimate,
                                             std::move(module));
-  base::MutexGuard lock(&mutex_);
+  base::AdaptiveMutexGuard lock(&mutex_);
   if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_to_file)) {
     if (!native_modules_kept_alive_for_pgo) {
       native_modules_kept_alive_for_pgo =
@@ -1428,7 +1451,7 @@ std::shared_ptr<NativeModule> WasmEngine::MaybeGetNativeModule(
   bool remove_all_code = false;
   if (native_module) {
     TRACE_EVENT0("v8.wasm", "CacheHit");
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     auto& native_module_info = native_modules_[native_module.get()];
     if (!native_module_info) {
       native_module_info = std::make_unique<NativeModuleInfo>(native_module);
@@ -1462,7 +1485,7 @@ std::shared_ptr<NativeModule> WasmEngine::UpdateNativeModuleCache(
   if (prev == native_module.get()) return native_module;
   bool remove_all_code = false;
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, native_modules_.count(native_module.get()));
     native_modules_[native_module.get()]->isolates.insert(isolate);
     DCHECK_EQ(1, isolates_.count(isolate));
@@ -1503,7 +1526,7 @@ void WasmEngine::StreamingCompilationFailed(
 }
 
 void WasmEngine::FreeNativeModule(NativeModule* native_module) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   auto module = native_modules_.find(native_module);
   DCHECK_NE(native_modules_.end(), module);
   for (Isolate* isolate : module->second->isolates) {
@@ -1564,7 +1587,7 @@ void WasmEngine::ReportLiveCodeForGC(Isolate* isolate,
   TRACE_EVENT0("v8.wasm", "wasm.ReportLiveCodeForGC");
   TRACE_CODE_GC("Isolate %d reporting %zu live code objects.\n", isolate->id(),
                 live_code.size());
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   // This report might come in late (note that we trigger both a stack guard and
   // a foreground task). In that case, ignore it.
   if (current_gc_info_ == nullptr) return;
@@ -1634,7 +1657,7 @@ void WasmEngine::ReportLiveCodeFromStackForGC(Isolate* isolate) {
 }
 
 bool WasmEngine::AddPotentiallyDeadCode(WasmCode* code) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   auto it = native_modules_.find(code->native_module());
   DCHECK_NE(native_modules_.end(), it);
   NativeModuleInfo* info = it->second.get();
@@ -1672,7 +1695,7 @@ bool WasmEngine::AddPotentiallyDeadCode(WasmCode* code) {
 }
 
 void WasmEngine::FreeDeadCode(const DeadCodeMap& dead_code) {
-  base::MutexGuard guard(&mutex_);
+  base::AdaptiveMutexGuard guard(&mutex_);
   FreeDeadCodeLocked(dead_code);
 }
 
@@ -1698,7 +1721,7 @@ Handle<Script> WasmEngine::GetOrCreateScript(
     Isolate* isolate, const std::shared_ptr<NativeModule>& native_module,
     base::Vector<const char> source_url) {
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     auto& scripts = isolates_[isolate]->scripts;
     auto it = scripts.find(native_module.get());
@@ -1714,7 +1737,7 @@ Handle<Script> WasmEngine::GetOrCreateScript(
   // Temporarily release the mutex to let the GC collect native modules.
   auto script = CreateWasmScript(isolate, native_module, source_url);
   {
-    base::MutexGuard guard(&mutex_);
+    base::AdaptiveMutexGuard guard(&mutex_);
     DCHECK_EQ(1, isolates_.count(isolate));
     auto& scripts = isolates_[isolate]->scripts;
     DCHECK_EQ(0, scripts.count(native_module.get()));
@@ -1810,14 +1833,16 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
 }
 
 size_t WasmEngine::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmEngine, 720);
+  UPDATE_WHEN_CLASS_CHANGES(WasmEngine, 824);
   UPDATE_WHEN_CLASS_CHANGES(IsolateInfo, 192);
   UPDATE_WHEN_CLASS_CHANGES(NativeModuleInfo, 144);
   UPDATE_WHEN_CLASS_CHANGES(CurrentGCInfo, 96);
   size_t result = sizeof(WasmEngine);
   result += type_canonicalizer_.EstimateCurrentMemoryConsumption();
+  // Retained stack segments are discarded (MADV_FREE'd), so they are counted
+  // as address space held, not as used memory. Do not add them here.
   {
-    base::MutexGuard lock(&mutex_);
+    base::AdaptiveMutexGuard lock(&mutex_);
     result += ContentSize(async_compile_jobs_);
     result += async_compile_jobs_.size() * sizeof(AsyncCompileJob);
 
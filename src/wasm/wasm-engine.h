@@ -21,6 +21,7 @@
 #include "src/tasks/cancelable-task.h"
 #include "src/tasks/operations-barrier.h"
 #include "src/wasm/canonical-types.h"
+#include "src/wasm/stacks.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-tier.h"
 #include "src/zone/accounting-allocator.h"
@@ -88,8 +89,7 @@ class NativeModuleCache {
         return prefix_hash < other.prefix_hash;
       }
       if (compile_imports != other.compile_imports) {
-        return compile_imports.ToIntegral() <
-               other.compile_imports.ToIntegral();
+        return compile_imports.compare(other.compile_imports) < 0;
       }
       if (bytes.size() != other.bytes.size()) {
         return bytes.size() < other.bytes.size();
@@ -235,6 +235,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   AccountingAllocator* allocator() { return &allocator_; }
 
+  // Pool of recycled stack segments for stack switching. Engine-wide, since
+  // the segments are isolate-agnostic memory.
+  StackPool& stack_pool() { return stack_pool_; }
+
   // Compilation statistics for TurboFan compilations. Returns a shared_ptr
   // so that background compilation jobs can hold on to it while the main thread
   // shuts down.
@@ -438,9 +442,11 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   compiler::WasmCallDescriptors call_descriptors_;
 
+  StackPool stack_pool_;
+
   // This mutex protects all information which is mutated concurrently or
   // fields that are initialized lazily on the first access.
-  mutable base::Mutex mutex_;
+  mutable base::AdaptiveMutex mutex_;
 
   //////////////////////////////////////////////////////////////////////////////
   // Protected by {mutex_}:
@@ -18,6 +18,11 @@
   /* V8 side owner: clemensb */                                                \
   V(compilation_hints, "compilation hints section", false)                     \
                                                                                \
+  /* No official proposal (V8-only JS API extension). */                       \
+  /* V8 side owner: clemensb */                                                \
+  V(compilation_policy,                                                        \
+    "per-module compilation policy in the JS API compile options", false)      \
+                                                                               \
   /* Instruction Tracing tool convention (early prototype, might change) */    \
   /* Tool convention: https://github.com/WebAssembly/tool-conventions */       \
   /* V8 side owner: jabraham */                                                \
@@ -9,7 +9,12 @@
 #ifndef V8_WASM_WASM_FEATURES_H_
 #define V8_WASM_WASM_FEATURES_H_
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 // The feature flags are declared in their own header.
+#include "src/base/vector.h"
 #include "src/common/globals.h"
 #include "src/wasm/wasm-feature-flags.h"
 
@@ -90,6 +95,7 @@ constexpr WasmFeatures WasmFeatures::ForAsmjs() { return {}; }
 
 enum class CompileTimeImport {
   kJsString,
+  kStringConstants,
   kTextEncoder,
   kTextDecoder,
 };
@@ -98,7 +104,91 @@ inline std::ostream& operator<<(std::ostream& os, CompileTimeImport imp) {
   return os << static_cast<int>(imp);
 }
 
-using CompileTimeImports = base::EnumSet<CompileTimeImport, int>;
+// Per-module compilation policy, requested via the {compilePolicy} compile
+// option. {kDefault} defers to the process-wide flags and any compilation
+// hints embedded in the module.
+enum class CompilePolicy : uint8_t {
+  kDefault,
+  kEager,
+  kLazy,
+  kHybrid,
+};
+
+// The set of compile-time options requested for a module: compile-time
+// imports, the name of the module from which string constants are imported
+// (only relevant when {kStringConstants} is in the set), and the per-module
+// compilation policy.
+class CompileTimeImports {
+ public:
+  CompileTimeImports() = default;
+
+  bool empty() const { return bits_.empty(); }
+  bool contains(CompileTimeImport imp) const { return bits_.contains(imp); }
+
+  bool operator==(const CompileTimeImports& other) const {
+    return bits_ == other.bits_ &&
+           constants_module_ == other.constants_module_ &&
+           compile_policy_ == other.compile_policy_ &&
+           eager_functions_ == other.eager_functions_;
+  }
+  bool operator!=(const CompileTimeImports& other) const {
+    return !(*this == other);
+  }
+
+  // Total order, for use as a cache key.
+  int compare(const CompileTimeImports& other) const {
+    if (bits_.ToIntegral() != other.bits_.ToIntegral()) {
+      return bits_.ToIntegral() < other.bits_.ToIntegral() ? -1 : 1;
+    }
+    if (int diff = constants_module_.compare(other.constants_module_)) {
+      return diff;
+    }
+    if (compile_policy_ != other.compile_policy_) {
+      return compile_policy_ < other.compile_policy_ ? -1 : 1;
+    }
+    if (eager_functions_ != other.eager_functions_) {
+      return eager_functions_ < other.eager_functions_ ? -1 : 1;
+    }
+    return 0;
+  }
+
+  void Add(CompileTimeImport imp) { bits_.Add(imp); }
+
+  int bits() const { return bits_.ToIntegral(); }
+  static CompileTimeImports FromBits(int bits) {
+    CompileTimeImports result;
+    result.bits_ = base::EnumSet<CompileTimeImport, int>::FromIntegral(bits);
+    return result;
+  }
+
+  std::string& constants_module() { return constants_module_; }
+  const std::string& constants_module() const { return constants_module_; }
+
+  CompilePolicy compile_policy() const { return compile_policy_; }
+  void set_compile_policy(CompilePolicy policy) { compile_policy_ = policy; }
+
+  // Sorted, deduplicated list of eagerly compiled function indexes; only
+  // non-empty for {CompilePolicy::kHybrid}.
+  std::vector<uint32_t>& eager_functions() { return eager_functions_; }
+  const std::vector<uint32_t>& eager_functions() const {
+    return eager_functions_;
+  }
+
+  // Returns true if string constants are enabled and {module_name} is the
+  // module they are imported from.
+  bool has_string_constants(base::Vector<const uint8_t> module_name) const {
+    return bits_.contains(CompileTimeImport::kStringConstants) &&
+           constants_module_.size() == module_name.size() &&
+           std::equal(module_name.begin(), module_name.end(),
+                      constants_module_.begin());
+  }
+
+ private:
+  base::EnumSet<CompileTimeImport, int> bits_;
+  std::string constants_module_;
+  CompilePolicy compile_policy_ = CompilePolicy::kDefault;
+  std::vector<uint32_t> eager_functions_;
+};
 
 }  // namespace wasm
 }  // namespace internal
@@ -4,6 +4,7 @@
 
 #include "src/wasm/wasm-js.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 
@@ -37,6 +38,7 @@
 #include "src/wasm/wasm-serialization.h"
 #include "src/wasm/wasm-value.h"
 
+using v8::internal::wasm::CompilePolicy;
 using v8::internal::wasm::CompileTimeImport;
 using v8::internal::wasm::CompileTimeImports;
 using v8::internal::wasm::ErrorThrower;
@@ -528,56 +530,145 @@ void RecordCompilationMethod(i::Isolate* isolate, CompilationMethod method) {
   isolate->counters()->wasm_compilation_method()->AddSample(method);
 }
 
+// Parses the {compilePolicy} and {eagerFunctions} compile options into
+// {result}. A {compilePolicy} string ("eager", "lazy" or "hybrid") selects
+// the per-module compilation policy; "hybrid" compiles the functions listed
+// in {eagerFunctions} eagerly and everything else lazily.
+CompileTimeImports ParseCompilePolicyOptions(
+    i::Isolate* isolate, i::wasm::WasmFeatures enabled_features,
+    i::Handle<i::JSReceiver> receiver, CompileTimeImports result) {
+  if (!enabled_features.has_compilation_policy()) return result;
+  i::Handle<i::Object> policy;
+  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+      isolate, policy,
+      i::JSReceiver::GetProperty(isolate, receiver, "compilePolicy"), {});
+  if (i::IsString(*policy)) {
+    i::Tagged<i::String> policy_str = i::String::cast(*policy);
+    if (policy_str->IsEqualTo(base::CStrVector("eager"))) {
+      result.set_compile_policy(CompilePolicy::kEager);
+    } else if (policy_str->IsEqualTo(base::CStrVector("lazy"))) {
+      result.set_compile_policy(CompilePolicy::kLazy);
+    } else if (policy_str->IsEqualTo(base::CStrVector("hybrid"))) {
+      result.set_compile_policy(CompilePolicy::kHybrid);
+    }
+  }
+  if (result.compile_policy() != CompilePolicy::kHybrid) return result;
+  i::Handle<i::Object> eager;
+  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+      isolate, eager,
+      i::JSReceiver::GetProperty(isolate, receiver, "eagerFunctions"), {});
+  if (i::IsJSReceiver(*eager)) {
+    i::Handle<i::Object> length_obj;
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, length_obj,
+        i::Object::GetLengthFromArrayLike(
+            isolate, i::Handle<i::JSReceiver>::cast(eager)),
+        {});
+    double raw_length = i::Object::Number(*length_obj);
+    // Saturating to-uint32 conversion, as for the builtins list above.
+    uint32_t len = raw_length >= i::kMaxUInt32
+                       ? i::kMaxUInt32
+                       : static_cast<uint32_t>(raw_length);
+    for (uint32_t i = 0; i < len; i++) {
+      i::LookupIterator it(isolate, eager, i);
+      Maybe<bool> maybe_found = i::JSReceiver::HasProperty(&it);
+      MAYBE_RETURN(maybe_found, {});
+      if (!maybe_found.FromJust()) continue;
+      i::Handle<i::Object> value;
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(isolate, value,
+                                       i::Object::GetProperty(&it), {});
+      uint32_t func_index;
+      if (i::Object::ToUint32(*value, &func_index)) {
+        result.eager_functions().push_back(func_index);
+      }
+    }
+    std::sort(result.eager_functions().begin(),
+              result.eager_functions().end());
+    result.eager_functions().erase(
+        std::unique(result.eager_functions().begin(),
+                    result.eager_functions().end()),
+        result.eager_functions().end());
+  }
+  return result;
+}
+
 CompileTimeImports ArgumentToCompileOptions(
     Local<Value> arg_value, i::Isolate* isolate,
     i::wasm::WasmFeatures enabled_features) {
-  if (!enabled_features.has_imported_strings()) return {};
+  if (!enabled_features.has_imported_strings() &&
+      !enabled_features.has_compilation_policy()) {
+    return {};
+  }
   i::Handle<i::Object> arg = Utils::OpenHandle(*arg_value);
   if (!i::IsJSReceiver(*arg)) return {};
   i::Handle<i::JSReceiver> receiver = i::Handle<i::JSReceiver>::cast(arg);
+  CompileTimeImports result;
+  if (!enabled_features.has_imported_strings()) {
+    return ParseCompilePolicyOptions(isolate, enabled_features, receiver,
+                                     std::move(result));
+  }
   i::Handle<i::Object> builtins;
   ASSIGN_RETURN_ON_EXCEPTION_VALUE(
       isolate, builtins,
       i::JSReceiver::GetProperty(isolate, receiver, "builtins"), {});
-  if (!i::IsJSReceiver(*builtins)) return {};
-  i::Handle<i::Object> length_obj;
-  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
-      isolate, length_obj,
-      i::Object::GetLengthFromArrayLike(
-          isolate, i::Handle<i::JSReceiver>::cast(builtins)),
-      {});
-  double raw_length = i::Object::Number(*length_obj);
-  // Technically we should probably iterate up to 2^53-1 if {length_obj} says
-  // so, but lengths above 2^32 probably don't happen in practice (and would be
-  // very slow if they do), so just use a saturating to-uint32 conversion
-  // for simplicity.
-  uint32_t len = raw_length >= i::kMaxUInt32
-                     ? i::kMaxUInt32
-                     : static_cast<uint32_t>(raw_length);
-  CompileTimeImports result;
-  for (uint32_t i = 0; i < len; i++) {
-    i::LookupIterator it(isolate, builtins, i);
-    Maybe<bool> maybe_found = i::JSReceiver::HasProperty(&it);
-    MAYBE_RETURN(maybe_found, {});
-    if (!maybe_found.FromJust()) continue;
-    i::Handle<i::Object> value;
-    ASSIGN_RETURN_ON_EXCEPTION_VALUE(isolate, value,
-                                     i::Object::GetProperty(&it), {});
-    if (i::IsString(*value)) {
-      i::Tagged<i::String> builtin = i::String::cast(*value);
-      // TODO(jkummerow): We could make other string comparisons to known
-      // constants in this file more efficient by migrating them to this
-      // style (rather than `...->StringEquals(v8_str(...))`).
-      if (builtin->IsEqualTo(base::CStrVector("js-string"))) {
-        result.Add(CompileTimeImport::kJsString);
-      } else if (builtin->IsEqualTo(base::CStrVector("text-encoder"))) {
-        result.Add(CompileTimeImport::kTextEncoder);
-      } else if (builtin->IsEqualTo(base::CStrVector("text-decoder"))) {
-        result.Add(CompileTimeImport::kTextDecoder);
+  if (i::IsJSReceiver(*builtins)) {
+    i::Handle<i::Object> length_obj;
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate, length_obj,
+        i::Object::GetLengthFromArrayLike(
+            isolate, i::Handle<i::JSReceiver>::cast(builtins)),
+        {});
+    double raw_length = i::Object::Number(*length_obj);
+    // Technically we should probably iterate up to 2^53-1 if {length_obj} says
+    // so, but lengths above 2^32 probably don't happen in practice (and would
+    // be very slow if they do), so just use a saturating to-uint32 conversion
+    // for simplicity.
+    uint32_t len = raw_length >= i::kMaxUInt32
+                       ? i::kMaxUInt32
+                       : static_cast<uint32_t>(raw_length);
+    for (uint32_t i = 0; i < len; i++) {
+      i::LookupIterator it(isolate, builtins, i);
+      Maybe<bool> maybe_found = i::JSReceiver::HasProperty(&it);
+      MAYBE_RETURN(maybe_found, {});
+      if (!maybe_found.FromJust()) continue;
+      i::Handle<i::Object> value;
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(isolate, value,
+                                       i::Object::GetProperty(&it), {});
+      if (i::IsString(*value)) {
+        i::Tagged<i::String> builtin = i::String::cast(*value);
+        // TODO(jkummerow): We could make other string comparisons to known
+        // constants in this file more efficient by migrating them to this
+        // style (rather than `...->StringEquals(v8_str(...))`).
+        if (builtin->IsEqualTo(base::CStrVector("js-string"))) {
+          result.Add(CompileTimeImport::kJsString);
+        } else if (builtin->IsEqualTo(base::CStrVector("text-encoder"))) {
+          result.Add(CompileTimeImport::kTextEncoder);
+        } else if (builtin->IsEqualTo(base::CStrVector("text-decoder"))) {
+          result.Add(CompileTimeImport::kTextDecoder);
+        }
       }
     }
   }
-  return result;
+
+  // An {importedStringConstants} string names the module from which immutable
+  // externref globals are materialized as string constants: the import's
+  // field name is the (flat, internalized) string value, with no lookup in
+  // the imports object and no copy at the language boundary.
+  i::Handle<i::Object> constants_module;
+  ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+      isolate, constants_module,
+      i::JSReceiver::GetProperty(isolate, receiver, "importedStringConstants"),
+      {});
+  if (i::IsString(*constants_module)) {
+    i::Handle<i::String> name = i::Handle<i::String>::cast(constants_module);
+    result.Add(CompileTimeImport::kStringConstants);
+    int length = 0;
+    std::unique_ptr<char[]> utf8 =
+        name->ToCString(i::ALLOW_NULLS, i::FAST_STRING_TRAVERSAL, &length);
+    result.constants_module().assign(utf8.get(), length);
+  }
+  return ParseCompilePolicyOptions(isolate, enabled_features, receiver,
+                                   std::move(result));
 }
 }  // namespace
 
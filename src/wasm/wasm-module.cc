@@ -646,7 +646,7 @@ int GetSourcePosition(const WasmModule* module, uint32_t func_index,
 }
 
 size_t WasmModule::EstimateStoredSize() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmModule, 848);
+  UPDATE_WHEN_CLASS_CHANGES(WasmModule, 880);
   return sizeof(WasmModule) +                            // --
          signature_zone.allocation_size_for_tracing() +  // --
          ContentSize(types) +                            // --
@@ -663,6 +663,7 @@ size_t WasmModule::EstimateStoredSize() const {
          ContentSize(stringref_literals) +               // --
          ContentSize(elem_segments) +                    // --
          ContentSize(compilation_hints) +                // --
+         ContentSize(eager_functions) +                  // --
          ContentSize(branch_hints) +                     // --
          ContentSize(inst_traces) +                      // --
          (num_declared_functions + 7) / 8;               // validated_functions
@@ -719,7 +720,7 @@ size_t TypeFeedbackStorage::EstimateCurrentMemoryConsumption() const {
 }
 
 size_t WasmModule::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmModule, 848);
+  UPDATE_WHEN_CLASS_CHANGES(WasmModule, 880);
   size_t result = EstimateStoredSize();
 
   result += type_feedback.EstimateCurrentMemoryConsumption();
@@ -23,6 +23,7 @@
 #include "src/wasm/constant-expression.h"
 #include "src/wasm/struct-types.h"
 #include "src/wasm/wasm-constants.h"
+#include "src/wasm/wasm-features.h"
 #include "src/wasm/wasm-init-expr.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/well-known-imports.h"
@@ -633,6 +634,15 @@ struct V8_EXPORT_PRIVATE WasmModule {
   std::vector<WasmStringRefLiteral> stringref_literals;
   std::vector<WasmElemSegment> elem_segments;
   std::vector<WasmCompilationHint> compilation_hints;
+  // Compilation policy requested via the JS API compile options. Like
+  // {type_feedback} below, this is not a decoded representation of the wire
+  // bytes; it is copied onto the freshly decoded module before compilation
+  // starts (hence mutable), and overrides both {compilation_hints} and the
+  // process-wide lazy compilation flag.
+  mutable CompilePolicy compile_policy = CompilePolicy::kDefault;
+  // Sorted list of eagerly compiled function indexes; only non-empty for
+  // {CompilePolicy::kHybrid}.
+  mutable std::vector<uint32_t> eager_functions;
   BranchHintInfo branch_hints;
   // Pairs of module offsets and mark id.
   std::vector<std::pair<uint32_t, uint32_t>> inst_traces;
@@ -194,6 +194,21 @@ uint32_t GetWasmCalleeTag(RelocInfo* rinfo) {
 constexpr size_t kHeaderSize = sizeof(size_t) +  // total code size
                                sizeof(bool);     // all functions validated
 
+// All instruction bytes are stored in one contiguous code section, aligned to
+// this boundary relative to the start of the serialized artifact. An embedder
+// that stores the artifact at a page-aligned file offset can thus map the
+// code section with page granularity; it also lets deserialization read one
+// dense region instead of code interleaved with metadata.
+constexpr size_t kCodeSectionAlignment = 4 * KB;
+
+// Returns the number of padding bytes required to bring {offset} (relative to
+// the start of the serialized artifact, i.e. including the
+// {WasmSerializer::kHeaderSize} bytes of version header) up to
+// {kCodeSectionAlignment}.
+size_t CodeSectionPadding(size_t offset) {
+  return RoundUp<kCodeSectionAlignment>(offset) - offset;
+}
+
 constexpr size_t kCodeHeaderSize = sizeof(uint8_t) +  // code kind
                                    sizeof(int) +      // offset of constant pool
                                    sizeof(int) +  // offset of safepoint table
@@ -290,9 +305,10 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   bool Write(Writer* writer);
 
  private:
-  size_t MeasureCode(const WasmCode*) const;
+  size_t MeasureCodeMetadata(const WasmCode*) const;
   void WriteHeader(Writer*, size_t total_code_size);
-  void WriteCode(const WasmCode*, Writer*);
+  void WriteCodeMetadata(const WasmCode*, Writer*);
+  void WriteCodeInstructions(const WasmCode*, Writer*);
   void WriteTieringBudget(Writer* writer);
 
   const NativeModule* const native_module_;
@@ -314,29 +330,44 @@ NativeModuleSerializer::NativeModuleSerializer(
   // the unique ones, i.e. the cache.
 }
 
-size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
+size_t NativeModuleSerializer::MeasureCodeMetadata(const WasmCode* code) const {
   if (code == nullptr) return sizeof(uint8_t);
   DCHECK_EQ(WasmCode::kWasmFunction, code->kind());
   if (code->tier() != ExecutionTier::kTurbofan) {
     return sizeof(uint8_t);
   }
-  return kCodeHeaderSize + code->instructions().size() +
-         code->reloc_info().size() + code->source_positions().size() +
-         code->inlining_positions().size() +
+  return kCodeHeaderSize + code->reloc_info().size() +
+         code->source_positions().size() + code->inlining_positions().size() +
          code->protected_instructions_data().size();
 }
 
 size_t NativeModuleSerializer::Measure() const {
-  size_t size = kHeaderSize;
+  size_t metadata_size = kHeaderSize;
+  size_t code_size = 0;
   for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+    metadata_size += MeasureCodeMetadata(code);
+    if (code != nullptr && code->tier() == ExecutionTier::kTurbofan) {
+      code_size += code->instructions().size();
+    }
   }
   // Add the size of the well-known imports status.
-  size += import_statuses_.size() * sizeof(WellKnownImport);
+  metadata_size += import_statuses_.size() * sizeof(WellKnownImport);
+  // Add the size of the compile-time imports.
+  metadata_size += sizeof(int) + sizeof(uint32_t) +
+                   native_module_->compile_imports().constants_module().size();
+  // Add the size of the compilation policy.
+  metadata_size +=
+      sizeof(uint8_t) + sizeof(uint32_t) +
+      native_module_->compile_imports().eager_functions().size() *
+          sizeof(uint32_t);
+
+  // The code section is aligned within the artifact, which also accounts for
+  // the version header preceding the data measured here.
+  size_t code_section_offset = WasmSerializer::kHeaderSize + metadata_size;
+  size_t size = metadata_size + CodeSectionPadding(code_section_offset) +
+                code_size;
   // Add the size of the tiering budget.
   size += native_module_->module()->num_declared_functions * sizeof(uint32_t);
-  // Add the size of the compile-time imports.
-  size += sizeof(typename CompileTimeImports::StorageType);
 
   return size;
 }
@@ -346,7 +377,16 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
   // TODO(eholk): We need to properly preserve the flag whether the trap
   // handler was used or not when serializing.
 
-  writer->Write(native_module_->compile_imports().ToIntegral());
+  const CompileTimeImports& compile_imports =
+      native_module_->compile_imports();
+  const std::string& constants_module = compile_imports.constants_module();
+  writer->Write(compile_imports.bits());
+  writer->Write(static_cast<uint32_t>(constants_module.size()));
+  writer->WriteVector(base::VectorOf(constants_module));
+  writer->Write(static_cast<uint8_t>(compile_imports.compile_policy()));
+  writer->Write(
+      static_cast<uint32_t>(compile_imports.eager_functions().size()));
+  writer->WriteVector(base::VectorOf(compile_imports.eager_functions()));
   writer->Write(total_code_size);
 
   // We do not ship lazy validation, so in most cases all functions will be
@@ -366,7 +406,8 @@ void NativeModuleSerializer::WriteHeader(Writer* writer,
   writer->WriteVector(base::VectorOf(import_statuses_));
 }
 
-void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
+void NativeModuleSerializer::WriteCodeMetadata(const WasmCode* code,
+                                               Writer* writer) {
   if (code == nullptr) {
     writer->Write(kLazyFunction);
     return;
@@ -409,17 +450,24 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   writer->Write(code->kind());
   writer->Write(code->tier());
 
-  // Get a pointer to the destination buffer, to hold relocated code.
-  uint8_t* serialized_code_start = writer->current_buffer().begin();
-  uint8_t* code_start = serialized_code_start;
-  size_t code_size = code->instructions().size();
-  writer->Skip(code_size);
   // Write the reloc info, source positions, inlining positions and protected
-  // code.
+  // code. The instruction bytes follow in the contiguous code section, see
+  // {WriteCodeInstructions}.
   writer->WriteVector(code->reloc_info());
   writer->WriteVector(code->source_positions());
   writer->WriteVector(code->inlining_positions());
   writer->WriteVector(code->protected_instructions_data());
+}
+
+void NativeModuleSerializer::WriteCodeInstructions(const WasmCode* code,
+                                                   Writer* writer) {
+  if (code == nullptr || code->tier() != ExecutionTier::kTurbofan) return;
+
+  // Get a pointer to the destination buffer, to hold relocated code.
+  uint8_t* serialized_code_start = writer->current_buffer().begin();
+  uint8_t* code_start = serialized_code_start;
+  size_t code_size = code->instructions().size();
+  writer->Skip(code_size);
 #if V8_TARGET_ARCH_MIPS64 || V8_TARGET_ARCH_ARM || V8_TARGET_ARCH_PPC ||      \
     V8_TARGET_ARCH_PPC64 || V8_TARGET_ARCH_S390X || V8_TARGET_ARCH_RISCV32 || \
     V8_TARGET_ARCH_RISCV64
@@ -510,12 +558,26 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   }
   WriteHeader(writer, total_code_size);
 
+  // Write all code metadata first, then pad to {kCodeSectionAlignment} and
+  // write all instruction bytes as one contiguous code section.
   for (WasmCode* code : code_table_) {
-    WriteCode(code, writer);
+    WriteCodeMetadata(code, writer);
   }
   // If not a single function was written, serialization was not successful.
   if (num_turbofan_functions_ == 0) return false;
 
+  // {writer} spans the whole buffer, so {bytes_written} already includes the
+  // {WasmSerializer::kHeaderSize} bytes of version header.
+  size_t padding = CodeSectionPadding(writer->bytes_written());
+  // Zero the padding to keep the artifact deterministic and to avoid leaking
+  // heap contents into it.
+  memset(writer->current_location(), 0, padding);
+  writer->Skip(padding);
+
+  for (WasmCode* code : code_table_) {
+    WriteCodeInstructions(code, writer);
+  }
+
   // Make sure that the serialized total code size was correct.
   CHECK_EQ(total_written_code_, total_code_size);
 
@@ -715,6 +777,27 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
 
   WasmCodeRefScope wasm_code_ref_scope;
 
+  size_t total_code_size = remaining_code_size_;
+
+  // First read the metadata of all functions; the instruction bytes follow in
+  // one contiguous, page-aligned code section.
+  std::vector<DeserializationUnit> all_units;
+  for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    DeserializationUnit unit = ReadCode(i, reader);
+    if (!unit.code) continue;
+    all_units.emplace_back(std::move(unit));
+  }
+
+  // We should have read the expected amount of code now, and should have fully
+  // utilized the allocated code space.
+  DCHECK_EQ(0, remaining_code_size_);
+  DCHECK_EQ(0, current_code_space_.size());
+
+  // Skip the padding before the code section. {reader} starts after the
+  // version header, so add its size to get the offset within the artifact.
+  reader->Skip(
+      CodeSectionPadding(reader->bytes_read() + WasmSerializer::kHeaderSize));
+
   DeserializationQueue reloc_queue;
 
   // Create a new job without any workers; those are spawned on
@@ -726,15 +809,16 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   // Choose a batch size such that we do not create too small batches (>=100k
   // code bytes), but also not too many (<=100 batches).
   constexpr size_t kMinBatchSizeInBytes = 100000;
-  size_t batch_limit =
-      std::max(kMinBatchSizeInBytes, remaining_code_size_ / 100);
+  size_t batch_limit = std::max(kMinBatchSizeInBytes, total_code_size / 100);
 
+  // Assign each unit its slice of the code section, and dispatch batches for
+  // parallel copying and relocation.
   std::vector<DeserializationUnit> batch;
   size_t batch_size = 0;
-  for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
-    DeserializationUnit unit = ReadCode(i, reader);
-    if (!unit.code) continue;
-    batch_size += unit.code->instructions().size();
+  for (DeserializationUnit& unit : all_units) {
+    size_t code_size = unit.code->instructions().size();
+    unit.src_code_buffer = reader->ReadVector<uint8_t>(code_size);
+    batch_size += code_size;
     batch.emplace_back(std::move(unit));
     if (batch_size >= batch_limit) {
       reloc_queue.Add(std::move(batch));
@@ -743,11 +827,7 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
       job_handle->NotifyConcurrencyIncrease();
     }
   }
-
-  // We should have read the expected amount of code now, and should have fully
-  // utilized the allocated code space.
-  DCHECK_EQ(0, remaining_code_size_);
-  DCHECK_EQ(0, current_code_space_.size());
+  all_units.clear();
 
   if (!batch.empty()) {
     reloc_queue.Add(std::move(batch));
@@ -762,8 +842,19 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
 }
 
 void NativeModuleDeserializer::ReadHeader(Reader* reader) {
-  auto compile_imports = reader->Read<CompileTimeImports::StorageType>();
-  compile_imports_ = CompileTimeImports::FromIntegral(compile_imports);
+  compile_imports_ = CompileTimeImports::FromBits(reader->Read<int>());
+  uint32_t constants_module_size = reader->Read<uint32_t>();
+  base::Vector<const char> constants_module =
+      reader->ReadVector<char>(constants_module_size);
+  compile_imports_.constants_module().assign(constants_module.begin(),
+                                             constants_module.end());
+  compile_imports_.set_compile_policy(
+      static_cast<CompilePolicy>(reader->Read<uint8_t>()));
+  uint32_t num_eager_functions = reader->Read<uint32_t>();
+  compile_imports_.eager_functions().reserve(num_eager_functions);
+  for (uint32_t i = 0; i < num_eager_functions; ++i) {
+    compile_imports_.eager_functions().push_back(reader->Read<uint32_t>());
+  }
 
   remaining_code_size_ = reader->Read<size_t>();
   all_functions_validated_ = reader->Read<bool>();
@@ -819,7 +910,8 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
   }
 
   DeserializationUnit unit;
-  unit.src_code_buffer = reader->ReadVector<uint8_t>(code_size);
+  // The instruction bytes live in the contiguous code section following all
+  // metadata; {src_code_buffer} is assigned in {Read}.
   auto reloc_info = reader->ReadVector<uint8_t>(reloc_size);
   auto source_pos = reader->ReadVector<uint8_t>(source_position_size);
   auto inlining_pos = reader->ReadVector<uint8_t>(inlining_position_size);
@@ -0,0 +1,110 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-tiering-sampler.h"
+
+#include "include/v8-unwinder.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/wasm/module-compiler.h"
+#include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-engine.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+// Number of consecutive samples that have to hit the same Liftoff function
+// before we request top-tier compilation for it.
+constexpr int kSamplesBeforeTierUp = 4;
+}  // namespace
+
+class WasmTieringSampler::SamplingThread final : public base::Thread {
+ public:
+  explicit SamplingThread(WasmTieringSampler* sampler)
+      : base::Thread(base::Thread::Options("WasmTieringSampler")),
+        sampler_(sampler) {}
+
+  void Run() override {
+    base::TimeDelta interval = base::TimeDelta::FromMilliseconds(
+        std::max(1, v8_flags.wasm_tiering_sampler_interval.value()));
+    while (!stop_requested_.load(std::memory_order_relaxed)) {
+      sampler_->DoSample();
+      // Sleep before processing, to give the signal handler on the sampled
+      // thread time to record the pc.
+      base::OS::Sleep(interval);
+      sampler_->ProcessLastSample();
+    }
+  }
+
+  void Stop() {
+    stop_requested_.store(true, std::memory_order_relaxed);
+    Join();
+  }
+
+ private:
+  WasmTieringSampler* const sampler_;
+  std::atomic<bool> stop_requested_{false};
+};
+
+WasmTieringSampler::WasmTieringSampler(Isolate* isolate)
+    : sampler::Sampler(reinterpret_cast<v8::Isolate*>(isolate)),
+      thread_(std::make_unique<SamplingThread>(this)) {
+  Start();
+  CHECK(thread_->Start());
+}
+
+WasmTieringSampler::~WasmTieringSampler() {
+  // Join the sampling thread before deactivating the sampler, so that no
+  // {DoSample} call can happen after {Stop}.
+  thread_->Stop();
+  Stop();
+}
+
+void WasmTieringSampler::SampleStack(const v8::RegisterState& regs) {
+  last_pc_.store(reinterpret_cast<Address>(regs.pc),
+                 std::memory_order_relaxed);
+}
+
+void WasmTieringSampler::ProcessLastSample() {
+  Address pc = last_pc_.exchange(kNullAddress, std::memory_order_relaxed);
+  WasmCodeRefScope code_ref_scope;
+  WasmCode* code =
+      pc == kNullAddress ? nullptr : GetWasmCodeManager()->LookupCode(pc);
+  if (code == nullptr || code->kind() != WasmCode::kWasmFunction ||
+      code->tier() != ExecutionTier::kLiftoff ||
+      code->for_debugging() != kNotForDebugging) {
+    last_native_module_ = nullptr;
+    last_func_index_ = -1;
+    consecutive_samples_ = 0;
+    return;
+  }
+  NativeModule* native_module = code->native_module();
+  int func_index = code->index();
+  if (native_module != last_native_module_ ||
+      func_index != last_func_index_) {
+    last_native_module_ = native_module;
+    last_func_index_ = func_index;
+    consecutive_samples_ = 1;
+    return;
+  }
+  if (++consecutive_samples_ < kSamplesBeforeTierUp) return;
+  consecutive_samples_ = 0;
+  // If a top-tier version was already published (the sampled frame just keeps
+  // executing the old Liftoff code until the next call), don't request
+  // another compilation.
+  WasmCode* published_code = native_module->GetCode(func_index);
+  if (published_code != nullptr &&
+      published_code->tier() == ExecutionTier::kTurbofan) {
+    return;
+  }
+  TriggerTierUp(native_module, func_index);
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
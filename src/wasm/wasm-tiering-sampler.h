@@ -0,0 +1,60 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_WASM_TIERING_SAMPLER_H_
+#define V8_WASM_WASM_TIERING_SAMPLER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "src/common/globals.h"
+#include "src/libsampler/sampler.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class NativeModule;
+
+// Drives wasm tier-up by sampled real time instead of call and backedge
+// budgets: a background thread periodically samples the pc of the thread
+// this sampler was created on, and when several consecutive samples hit the
+// same Liftoff function, top-tier compilation of that function is requested.
+// This promotes loop-dominated functions whose budget-based checks translate
+// poorly into wall-clock time. Enabled by --wasm-tiering-sampler.
+class WasmTieringSampler : public sampler::Sampler {
+ public:
+  // Must be constructed on the thread that should be sampled (i.e. the
+  // isolate's main thread).
+  explicit WasmTieringSampler(Isolate* isolate);
+  ~WasmTieringSampler() override;
+
+  // Called from the signal handler on the sampled thread; must remain
+  // async-signal-safe.
+  void SampleStack(const v8::RegisterState& regs) override;
+
+ private:
+  class SamplingThread;
+
+  // Called on the sampling thread after each tick.
+  void ProcessLastSample();
+
+  std::atomic<Address> last_pc_{kNullAddress};
+  std::unique_ptr<SamplingThread> thread_;
+
+  // The fields below are only accessed on the sampling thread.
+  NativeModule* last_native_module_ = nullptr;
+  int last_func_index_ = -1;
+  int consecutive_samples_ = 0;
+};
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_WASM_TIERING_SAMPLER_H_
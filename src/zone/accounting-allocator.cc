@@ -4,11 +4,14 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -63,6 +66,31 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
   return allocator;
 }
 
+// Returns the pool bucket whose segments are guaranteed to satisfy a request
+// of {bytes}, or a value >= kSegmentPoolBuckets if no bucket can.
+size_t BucketForRequest(size_t bytes, size_t min_size, size_t num_buckets) {
+  size_t bucket_size = min_size;
+  for (size_t i = 0; i < num_buckets; i++, bucket_size *= 2) {
+    if (bytes <= bucket_size) return i;
+  }
+  return num_buckets;
+}
+
+// Returns the pool bucket a segment of {total_size} belongs into, i.e. the
+// largest bucket whose size it covers, or a value >= kSegmentPoolBuckets if
+// the segment is too small or too large to be pooled.
+size_t BucketForSegment(size_t total_size, size_t min_size,
+                        size_t num_buckets) {
+  if (total_size < min_size || total_size >= min_size << num_buckets) {
+    return num_buckets;
+  }
+  size_t bucket = 0;
+  while (bucket + 1 < num_buckets && total_size >= min_size << (bucket + 1)) {
+    bucket++;
+  }
+  return bucket;
+}
+
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
@@ -79,7 +107,7 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ClearPool(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -90,19 +118,17 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
+    if (Segment* segment = TryGetPooledSegment(bytes)) {
+      AccountAllocation(segment->total_size());
+      return segment;
+    }
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
     bytes = result.count;
   }
   if (memory == nullptr) return nullptr;
 
-  size_t current =
-      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
-  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
-  while (current > max && !max_memory_usage_.compare_exchange_weak(
-                              max, current, std::memory_order_relaxed)) {
-    // {max} was updated by {compare_exchange_weak}; retry.
-  }
+  AccountAllocation(bytes);
   DCHECK_LE(sizeof(Segment), bytes);
   return new (memory) Segment(bytes);
 }
@@ -112,13 +138,111 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
   } else {
+    if (TryReturnToPool(segment)) return;
+    segment->ZapHeader();
     free(segment);
   }
 }
 
+void AccountingAllocator::AccountAllocation(size_t bytes) {
+  size_t current =
+      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
+  while (current > max && !max_memory_usage_.compare_exchange_weak(
+                              max, current, std::memory_order_relaxed)) {
+    // {max} was updated by {compare_exchange_weak}; retry.
+  }
+}
+
+AccountingAllocator::PoolShard&
+AccountingAllocator::GetPoolShardForThisThread() {
+  size_t thread_id = static_cast<size_t>(base::OS::GetCurrentThreadId());
+  return pool_shards_[thread_id % kSegmentPoolShards];
+}
+
+Segment* AccountingAllocator::TryGetPooledSegment(size_t bytes) {
+  if (v8_flags.zone_segment_pool_high_watermark == 0) return nullptr;
+  size_t bucket =
+      BucketForRequest(bytes, kMinPooledSegmentSize, kSegmentPoolBuckets);
+  if (bucket >= kSegmentPoolBuckets) return nullptr;
+
+  Segment* segment = nullptr;
+  PoolShard& shard = GetPoolShardForThisThread();
+  {
+    base::MutexGuard lock(&shard.mutex);
+    // Prefer an exact fit, but accept a segment from a larger bucket rather
+    // than going back to the backing allocator.
+    for (; bucket < kSegmentPoolBuckets && segment == nullptr; bucket++) {
+      segment = shard.buckets[bucket];
+      if (segment != nullptr) {
+        shard.buckets[bucket] = segment->next();
+        shard.cached_bytes -= segment->total_size();
+      }
+    }
+  }
+  if (segment == nullptr) {
+    pool_misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  pooled_bytes_.fetch_sub(segment->total_size(), std::memory_order_relaxed);
+  pool_hits_.fetch_add(1, std::memory_order_relaxed);
+  segment->set_next(nullptr);
+  return segment;
+}
+
+bool AccountingAllocator::TryReturnToPool(Segment* segment) {
+  size_t high_watermark = v8_flags.zone_segment_pool_high_watermark;
+  if (high_watermark == 0) return false;
+  size_t bucket = BucketForSegment(segment->total_size(),
+                                   kMinPooledSegmentSize, kSegmentPoolBuckets);
+  if (bucket >= kSegmentPoolBuckets) return false;
+
+  size_t shard_high = high_watermark / kSegmentPoolShards;
+  size_t shard_low = std::min<size_t>(v8_flags.zone_segment_pool_low_watermark,
+                                      high_watermark) /
+                     kSegmentPoolShards;
+  size_t segment_size = segment->total_size();
+
+  PoolShard& shard = GetPoolShardForThisThread();
+  base::MutexGuard lock(&shard.mutex);
+  if (shard.cached_bytes + segment_size > shard_high) {
+    TrimPoolShard(&shard, shard_low);
+    if (shard.cached_bytes + segment_size > shard_high) return false;
+  }
+  segment->set_zone(nullptr);
+  segment->set_next(shard.buckets[bucket]);
+  shard.buckets[bucket] = segment;
+  shard.cached_bytes += segment_size;
+  pooled_bytes_.fetch_add(segment_size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::TrimPoolShard(PoolShard* shard, size_t target_bytes) {
+  for (size_t bucket = kSegmentPoolBuckets;
+       bucket-- > 0 && shard->cached_bytes > target_bytes;) {
+    while (shard->cached_bytes > target_bytes &&
+           shard->buckets[bucket] != nullptr) {
+      Segment* segment = shard->buckets[bucket];
+      shard->buckets[bucket] = segment->next();
+      shard->cached_bytes -= segment->total_size();
+      pooled_bytes_.fetch_sub(segment->total_size(),
+                              std::memory_order_relaxed);
+      segment->ZapHeader();
+      free(segment);
+    }
+  }
+}
+
+void AccountingAllocator::ClearPool() {
+  for (PoolShard& shard : pool_shards_) {
+    base::MutexGuard lock(&shard.mutex);
+    TrimPoolShard(&shard, 0);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -10,6 +10,8 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +48,24 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Number of bytes currently held in the segment pool, waiting for reuse.
+  size_t GetPooledMemory() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+
+  // Returns all segments held in the pool to the backing allocator.
+  void ClearPool();
+
+  // Number of segment allocations that were served from the pool resp. had to
+  // fall through to the backing allocator. Useful for sizing the pool via
+  // --zone-segment-pool-high-watermark.
+  size_t GetSegmentPoolHits() const {
+    return pool_hits_.load(std::memory_order_relaxed);
+  }
+  size_t GetSegmentPoolMisses() const {
+    return pool_misses_.load(std::memory_order_relaxed);
+  }
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,9 +87,42 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // The segment pool caches recently returned uncompressed segments for reuse,
+  // avoiding malloc/munmap churn when many compilation jobs create and destroy
+  // zones concurrently. It is sharded by the calling thread so that a segment
+  // is preferentially reused by the thread that returned it, which keeps
+  // reused memory local to the allocating core (and, on NUMA machines, to its
+  // node) without requiring an explicit NUMA API.
+  static constexpr size_t kSegmentPoolShards = 8;
+  // One bucket each for 8, 16 and 32 KB segments, matching
+  // Zone::kMinimumSegmentSize..Zone::kMaximumSegmentSize. Oversized segments
+  // backing large single allocations are never pooled.
+  static constexpr size_t kMinPooledSegmentSize = 8 * KB;
+  static constexpr size_t kSegmentPoolBuckets = 3;
+
+  struct PoolShard {
+    base::Mutex mutex;
+    Segment* buckets[kSegmentPoolBuckets] = {nullptr, nullptr, nullptr};
+    size_t cached_bytes = 0;
+  };
+
+  void AccountAllocation(size_t bytes);
+
+  PoolShard& GetPoolShardForThisThread();
+  Segment* TryGetPooledSegment(size_t bytes);
+  bool TryReturnToPool(Segment* segment);
+  // Frees cached segments, largest first, until {shard} holds at most
+  // {target_bytes}. The shard's mutex must be held by the caller.
+  void TrimPoolShard(PoolShard* shard, size_t target_bytes);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  PoolShard pool_shards_[kSegmentPoolShards];
+  std::atomic<size_t> pooled_bytes_{0};
+  std::atomic<size_t> pool_hits_{0};
+  std::atomic<size_t> pool_misses_{0};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
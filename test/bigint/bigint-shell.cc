@@ -308,6 +308,23 @@ class Runner {
         (*count)++;
       }
     }
+    {
+      // One large sample to cover the multi-threaded pointwise
+      // multiplication, which only kicks in for big inputs.
+      constexpr int kParallelSize = 80000;
+      ScratchDigits A(kParallelSize);
+      ScratchDigits B(kParallelSize);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_toom(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      processor()->MultiplyFFT(result, A, B);
+      processor()->MultiplyToomCook(result_toom, A, B);
+      AssertEquals(A, B, result_toom, result);
+      if (error_) return;
+      (*count)++;
+    }
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
@@ -55,6 +55,7 @@
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/parked-scope.h"
@@ -71,16 +72,20 @@
 #include "src/objects/managed-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots.h"
+#include "src/objects/string-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/transitions.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/snapshot.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "src/utils/ostreams.h"
+#include "src/zone/accounting-allocator.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/feedback-vector-helper.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/test-transitions.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -1226,6 +1231,79 @@ TEST(TestMultiReferencedBytecodeFlushingWithSparkplug) {
   TestMultiReferencedBytecodeFlushing(/*sparkplug_compile=*/true);
 }
 
+TEST(TestSourcePositionFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.flush_source_positions = true;
+  i::v8_flags.enable_lazy_source_positions = true;
+  i::v8_flags.allow_natives_syntax = true;
+
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    // This compile will add the code to the compilation cache.
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    // Check function is compiled.
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(IsJSFunction(*func_value));
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    Handle<SharedFunctionInfo> shared = handle(function->shared(), i_isolate);
+    CHECK(shared->is_compiled());
+
+    // Collect source positions and make a copy of the SharedFunctionInfo that
+    // points to the same bytecode, so that aging the original keeps the
+    // bytecode alive.
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(i_isolate, shared);
+    CHECK(shared->GetBytecodeArray(i_isolate)->HasSourcePositionTable());
+    Handle<SharedFunctionInfo> copy =
+        i_isolate->factory()->CloneSharedFunctionInfo(shared);
+
+    i::SharedFunctionInfo::EnsureOldForTesting(*shared);
+    heap::InvokeMajorGC(CcTest::heap());
+
+    // The bytecode is kept alive by {copy}, but its source position table has
+    // been flushed.
+    CHECK(shared->is_compiled());
+    CHECK(copy->is_compiled());
+    CHECK(!shared->GetBytecodeArray(i_isolate)->HasSourcePositionTable());
+    CHECK_GT(CcTest::heap()->flushed_source_position_size(), 0u);
+
+    // Source positions are recollected on demand.
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(i_isolate, shared);
+    CHECK(shared->GetBytecodeArray(i_isolate)->HasSourcePositionTable());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::v8_flags.flush_bytecode = true;
   i::v8_flags.allow_natives_syntax = true;
@@ -5205,6 +5283,74 @@ HEAP_TEST(NumberStringCacheSize) {
            heap->number_string_cache()->length());
 }
 
+HEAP_TEST(NumberStringCacheConfiguredSize) {
+  // --number-string-cache-size overrides the heap-size-derived capacity and
+  // is rounded up to a power of two.
+  FlagScope<int> cache_size(&v8_flags.number_string_cache_size, 48);
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  // 64 entries, with a number and a string per entry.
+  CHECK_EQ(64 * 2, heap->MaxNumberToStringCacheSize());
+}
+
+HEAP_TEST(NumberStringCacheAdaptiveGrowth) {
+  FlagScope<bool> adaptive(&v8_flags.adaptive_number_string_cache, true);
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  // Negative and fractional values are cached like any other number.
+  Handle<Object> negative(Smi::FromInt(-42), isolate);
+  CHECK_EQ(*factory->NumberToString(negative),
+           *factory->NumberToString(negative));
+  Handle<Object> fractional = factory->NewNumber(-2.5);
+  CHECK_EQ(*factory->NumberToString(fractional),
+           *factory->NumberToString(fractional));
+
+  // A stream of distinct values keeps the hit rate at zero, so the cache
+  // grows geometrically instead of jumping to the maximum size on the first
+  // conflict.
+  const int initial_length = heap->number_string_cache()->length();
+  const int max_length = heap->MaxNumberToStringCacheSize();
+  for (int i = 0; i < 10000; i++) {
+    Handle<Object> number = factory->NewNumber(i + 0.5);
+    factory->NumberToString(number);
+  }
+  CHECK_GT(heap->number_string_cache()->length(), initial_length);
+  CHECK_LE(heap->number_string_cache()->length(), max_length);
+}
+
+HEAP_TEST(TrimMemory) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  // Create old-space garbage so that the GC leaves free memory behind.
+  {
+    HandleScope scope(isolate);
+    for (int i = 0; i < 100; i++) {
+      isolate->factory()->NewFixedArray(10000, AllocationType::kOld);
+    }
+  }
+  heap::InvokeMajorGC(heap);
+  heap->EnsureSweepingCompleted(
+      Heap::SweepingForcedFinalizationMode::kUnifiedHeap);
+
+  // An already expired deadline does no work at all.
+  CHECK_EQ(0u, heap->TrimMemory(heap->MonotonicallyIncreasingTimeInMs() - 1));
+
+  v8::Isolate::TrimMemoryReport report;
+  const size_t released =
+      heap->TrimMemory(heap->MonotonicallyIncreasingTimeInMs() + 100, &report);
+  CHECK_EQ(released, report.pooled_pages_bytes + report.free_list_pages_bytes +
+                         report.new_space_bytes + report.zone_segment_bytes);
+  // All buffered memory was given back.
+  CHECK_EQ(0u, heap->memory_allocator()->pool()->CommittedBufferedMemory());
+  CHECK_EQ(0u, isolate->allocator()->GetPooledMemory());
+}
 
 TEST(Regress3877) {
   CcTest::InitializeVM();
@@ -5442,6 +5588,48 @@ TEST(OldSpaceAllocationCounter) {
   }
 }
 
+TEST(ConcurrentStringInternalizationForwarding) {
+  // Concurrently recorded forwarding indices are only valid when all strings
+  // go through the forwarding table.
+  FlagScope<bool> always_use_forwarding_table(
+      &v8_flags.always_use_string_forwarding_table, true);
+  FlagScope<bool> concurrent_internalization(
+      &v8_flags.concurrent_string_internalization, true);
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* raw = "concurrent-internalization-key";
+  Handle<String> interned = factory->InternalizeUtf8String(raw);
+  CHECK(IsInternalizedString(*interned));
+
+  // An equal old-generation flat string with a computed hash is eligible for
+  // in-place internalization.
+  Handle<String> duplicate =
+      factory->NewStringFromAsciiChecked(raw, AllocationType::kOld);
+  CHECK(!IsInternalizedString(*duplicate));
+  const uint32_t raw_hash_field = duplicate->EnsureRawHash();
+  CHECK(Name::IsHash(raw_hash_field));
+
+  // Drive the probe directly; the concurrent marker invokes it the same way
+  // for eligible strings it visits.
+  isolate->string_table()->TryRecordInternalizedForwarding(isolate, *duplicate,
+                                                           raw_hash_field);
+  CHECK(duplicate->HasInternalizedForwardingIndex(kAcquireLoad));
+
+  // The recorded forwarding is resolved during the next full GC that
+  // transitions strings.
+  {
+    FlagScope<bool> transition_with_stack(
+        &v8_flags.transition_strings_during_gc_with_stack, true);
+    heap::InvokeMajorGC(CcTest::heap());
+  }
+  CHECK(IsThinString(*duplicate));
+  CHECK_EQ(ThinString::cast(*duplicate)->actual(), *interned);
+}
+
 static void CheckLeak(const v8::FunctionCallbackInfo<v8::Value>& info) {
   CHECK(i::ValidateCallbackInfo(info));
   Isolate* isolate = CcTest::i_isolate();
@@ -275,6 +275,54 @@ TEST(PartiallyInitializedContext) {
   isolate->RegisterDeserializerFinished();
 }
 
+TEST(ContextMemoryLimitRoundTrip) {
+  LocalContext env;
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<NativeContext> native_context = GetNativeContext(isolate, env.local());
+  CHECK_EQ(0u, native_context->GetMemoryLimit());
+  env.local()->SetMemoryLimit(4 * MB);
+  CHECK_EQ(4 * MB, native_context->GetMemoryLimit());
+  // Sub-KB limits round up instead of silently disabling the limit.
+  env.local()->SetMemoryLimit(100);
+  CHECK_EQ(1 * KB, native_context->GetMemoryLimit());
+  env.local()->SetMemoryLimit(0);
+  CHECK_EQ(0u, native_context->GetMemoryLimit());
+}
+
+namespace {
+
+int memory_limit_callback_count = 0;
+size_t memory_limit_callback_usage = 0;
+size_t memory_limit_callback_limit = 0;
+
+void MemoryLimitCallback(v8::Local<v8::Context> context, size_t usage,
+                         size_t limit) {
+  memory_limit_callback_count++;
+  memory_limit_callback_usage = usage;
+  memory_limit_callback_limit = limit;
+}
+
+}  // anonymous namespace
+
+TEST(ContextMemoryLimitCallback) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  isolate->SetContextMemoryLimitCallback(MemoryLimitCallback);
+  // Any context exceeds a 1 KB limit.
+  env.local()->SetMemoryLimit(1);
+  CompileRun("globalThis.retained = new Array(1000).fill('x');");
+  InvokeMajorGC(CcTest::heap());
+  while (v8::platform::PumpMessageLoop(v8::internal::V8::GetCurrentPlatform(),
+                                       isolate)) {
+  }
+  CHECK_GE(memory_limit_callback_count, 1);
+  CHECK_EQ(1 * KB, memory_limit_callback_limit);
+  CHECK_GT(memory_limit_callback_usage, memory_limit_callback_limit);
+  env.local()->SetMemoryLimit(0);
+  isolate->SetContextMemoryLimitCallback(nullptr);
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
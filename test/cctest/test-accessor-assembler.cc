@@ -34,9 +34,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
-    } else {
-      CHECK_EQ(StubCache::kSecondary, table);
+    } else if (table == StubCache::kSecondary) {
       result = m.StubCacheSecondaryOffsetForTesting(name, map);
+    } else {
+      CHECK_EQ(StubCache::kTertiary, table);
+      result = m.StubCacheTertiaryOffsetForTesting(name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -76,8 +78,10 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
         int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
-        } else {
+        } else if (table == StubCache::kSecondary) {
           expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+        } else {
+          expected_result = StubCache::TertiaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -98,6 +102,10 @@ TEST(StubCacheSecondaryOffset) {
   TestStubCacheOffsetCalculation(StubCache::kSecondary);
 }
 
+TEST(StubCacheTertiaryOffset) {
+  TestStubCacheOffsetCalculation(StubCache::kTertiary);
+}
+
 namespace {
 
 Handle<Code> CreateCodeOfKind(CodeKind kind) {
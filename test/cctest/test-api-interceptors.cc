@@ -4219,6 +4219,94 @@ THREADED_TEST(Enumerators) {
             .FromJust());
 }
 
+int bulk_getter_call_count = 0;
+int bulk_getter_per_property_calls = 0;
+
+static void BulkGetterPairs(const v8::PropertyCallbackInfo<v8::Array>& info) {
+  ApiTestFuzzer::Fuzz();
+  bulk_getter_call_count++;
+  v8::Isolate* isolate = info.GetIsolate();
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> result = v8::Array::New(isolate, 4);
+  CHECK(result->Set(context, 0, v8_str("foo")).FromJust());
+  CHECK(result->Set(context, 1, v8::Integer::New(isolate, 1)).FromJust());
+  CHECK(result->Set(context, 2, v8_str("bar")).FromJust());
+  CHECK(result->Set(context, 3, v8::Integer::New(isolate, 2)).FromJust());
+  info.GetReturnValue().Set(result);
+}
+
+static void BulkGetterDeclining(
+    const v8::PropertyCallbackInfo<v8::Array>& info) {
+  ApiTestFuzzer::Fuzz();
+  bulk_getter_call_count++;
+  // Don't set a return value; this makes V8 fall back to the per-property
+  // protocol.
+}
+
+static void BulkGetterPerPropertyGetter(
+    Local<Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  ApiTestFuzzer::Fuzz();
+  bulk_getter_per_property_calls++;
+  info.GetReturnValue().Set(v8::Integer::New(info.GetIsolate(), 42));
+}
+
+THREADED_TEST(NamedBulkGetter) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::ObjectTemplate> obj = ObjectTemplate::New(isolate);
+  v8::NamedPropertyHandlerConfiguration config(BulkGetterPerPropertyGetter);
+  config.bulk_getter = BulkGetterPairs;
+  obj->SetHandler(config);
+  LocalContext context;
+  context->Global()
+      ->Set(context.local(), v8_str("obj"),
+            obj->NewInstance(context.local()).ToLocalChecked())
+      .FromJust();
+
+  // With no enumerator installed, own-key enumeration uses the bulk getter
+  // and crosses the API boundary once.
+  bulk_getter_call_count = 0;
+  bulk_getter_per_property_calls = 0;
+  ExpectString("Object.keys(obj).join()", "foo,bar");
+  CHECK_EQ(1, bulk_getter_call_count);
+  CHECK_EQ(0, bulk_getter_per_property_calls);
+
+  // JSON.stringify gets both names and values from the single callback.
+  bulk_getter_call_count = 0;
+  ExpectString("JSON.stringify(obj)", "{\"foo\":1,\"bar\":2}");
+  CHECK_EQ(1, bulk_getter_call_count);
+  CHECK_EQ(0, bulk_getter_per_property_calls);
+
+  // Individual reads still use the per-property getter.
+  bulk_getter_call_count = 0;
+  ExpectInt32("obj.foo", 42);
+  CHECK_EQ(0, bulk_getter_call_count);
+  CHECK_EQ(1, bulk_getter_per_property_calls);
+}
+
+THREADED_TEST(NamedBulkGetterFallback) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::ObjectTemplate> obj = ObjectTemplate::New(isolate);
+  v8::NamedPropertyHandlerConfiguration config(
+      BulkGetterPerPropertyGetter, nullptr, nullptr, nullptr, NamedEnum);
+  config.bulk_getter = BulkGetterDeclining;
+  obj->SetHandler(config);
+  LocalContext context;
+  context->Global()
+      ->Set(context.local(), v8_str("obj"),
+            obj->NewInstance(context.local()).ToLocalChecked())
+      .FromJust();
+
+  // A declined bulk request falls back to the enumerator and one getter
+  // call per property.
+  bulk_getter_call_count = 0;
+  bulk_getter_per_property_calls = 0;
+  ExpectString("JSON.stringify(obj)", "{\"foo\":42,\"bar\":42,\"baz\":42}");
+  CHECK_EQ(1, bulk_getter_call_count);
+  CHECK_EQ(3, bulk_getter_per_property_calls);
+}
+
 v8::Global<Value> call_ic_function_global;
 v8::Global<Value> call_ic_function2_global;
 v8::Global<Value> call_ic_function3_global;
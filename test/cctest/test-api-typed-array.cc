@@ -440,6 +440,38 @@ THREADED_TEST(Uint8ClampedArray) {
       i::kExternalUint8ClampedArray, 0, 0xFF);
 }
 
+THREADED_TEST(TypedArrayNewBatch) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, 1024);
+  const size_t byte_offsets[] = {0, 8, 256};
+  const size_t lengths[] = {1, 16, 4};
+  Local<v8::Float64Array> views[3];
+  CHECK(v8::Float64Array::NewBatch(ab, byte_offsets, lengths, 3, views));
+  for (int i = 0; i < 3; i++) {
+    CheckInternalFieldsAreZero<v8::ArrayBufferView>(views[i]);
+    CHECK_EQ(byte_offsets[i], views[i]->ByteOffset());
+    CHECK_EQ(lengths[i], views[i]->Length());
+    CHECK(ab->Equals(env.local(), views[i]->Buffer()).FromJust());
+    i::Handle<i::JSTypedArray> i_ta = v8::Utils::OpenHandle(*views[i]);
+    CHECK(!i_ta->is_length_tracking());
+    CHECK(!i_ta->is_backed_by_rab());
+  }
+
+  // Views in a batch behave like individually created ones.
+  Local<v8::Float64Array> single =
+      v8::Float64Array::New(ab, byte_offsets[1], lengths[1]);
+  reinterpret_cast<double*>(ab->GetBackingStore()->Data())[1] = 1.5;
+  CHECK_EQ(views[1]->Get(env.local(), 0).ToLocalChecked()
+               ->NumberValue(env.local())
+               .FromJust(),
+           single->Get(env.local(), 0).ToLocalChecked()
+               ->NumberValue(env.local())
+               .FromJust());
+}
+
 THREADED_TEST(DataView) {
   const int kSize = 50;
 
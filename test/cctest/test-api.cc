@@ -8375,6 +8375,40 @@ int GetUtf8Length(v8::Isolate* isolate, Local<String> str) {
 }
 
 
+THREADED_TEST(StringValueView) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  {
+    Local<String> one_byte = v8_str("hello");
+    String::ValueView view(isolate, one_byte);
+    CHECK(view.is_one_byte());
+    CHECK_EQ(5u, view.length());
+    CHECK_EQ(0, memcmp(view.data8(), "hello", 5));
+  }
+  {
+    const uint16_t two_byte_data[] = {0x5728, 0x4E2D};
+    Local<String> two_byte =
+        String::NewFromTwoByte(isolate, two_byte_data,
+                               v8::NewStringType::kNormal, 2)
+            .ToLocalChecked();
+    String::ValueView view(isolate, two_byte);
+    CHECK(!view.is_one_byte());
+    CHECK_EQ(2u, view.length());
+    CHECK_EQ(0x5728, view.data16()[0]);
+    CHECK_EQ(0x4E2D, view.data16()[1]);
+  }
+  {
+    // Non-flat strings are flattened by the view.
+    Local<String> cons = String::Concat(isolate, v8_str("foo"), v8_str("bar"));
+    String::ValueView view(isolate, cons);
+    CHECK(view.is_one_byte());
+    CHECK_EQ(6u, view.length());
+    CHECK_EQ(0, memcmp(view.data8(), "foobar", 6));
+  }
+}
+
 THREADED_TEST(StringWrite) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -20485,6 +20519,46 @@ TEST(StaticGetters) {
   CHECK(*v8::Utils::OpenDirectHandle(*v8::False(isolate)) == *false_value);
 }
 
+namespace {
+
+struct SelfTimeResult {
+  size_t entries = 0;
+  size_t ticks = 0;
+};
+
+void CountSelfTime(const v8::Isolate::FunctionSelfTime& entry, void* data) {
+  SelfTimeResult* result = static_cast<SelfTimeResult*>(data);
+  CHECK_NOT_NULL(entry.name);
+  result->entries++;
+  result->ticks += entry.ticks;
+}
+
+}  // namespace
+
+TEST(FunctionSelfTimeAttribution) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  isolate->StartFunctionSelfTimeAttribution();
+  // Enough loop iterations to exhaust the bytecode interrupt budget several
+  // times over.
+  CompileRun(
+      "function self_time_busy() {"
+      "  let sum = 0;"
+      "  for (let i = 0; i < 10000; i++) sum += i;"
+      "  return sum;"
+      "}"
+      "for (let j = 0; j < 1000; j++) self_time_busy();");
+  SelfTimeResult result;
+  isolate->GetFunctionSelfTimeAttribution(CountSelfTime, &result);
+  CHECK_LT(0u, result.entries);
+  CHECK_LT(0u, result.ticks);
+  isolate->StopFunctionSelfTimeAttribution();
+  SelfTimeResult after_stop;
+  isolate->GetFunctionSelfTimeAttribution(CountSelfTime, &after_stop);
+  CHECK_EQ(0u, after_stop.entries);
+}
+
 UNINITIALIZED_TEST(IsolateEmbedderData) {
   v8::Isolate::CreateParams create_params;
   create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
@@ -20824,6 +20898,53 @@ THREADED_TEST(JSONParseObject) {
   ExpectString("JSON.stringify(obj)", "{\"x\":42}");
 }
 
+namespace {
+v8::Local<Value> GetObjectPrototype(v8::Local<Context> context) {
+  return context->Global()
+      ->Get(context, v8_str("Object"))
+      .ToLocalChecked()
+      .As<v8::Object>()
+      ->Get(context, v8_str("prototype"))
+      .ToLocalChecked();
+}
+}  // namespace
+
+TEST(JSONParseObjectPrototypeAcrossContexts) {
+  // The isolate-wide JSON shape cache must not reuse maps across native
+  // contexts: objects parsed in one context would otherwise inherit from
+  // another context's Object.prototype.
+  v8::Isolate* isolate = CcTest::isolate();
+  HandleScope scope(isolate);
+  const char* source = "{\"a\":1,\"b\":2}";
+  Local<Context> context_a = Context::New(isolate);
+  Local<Context> context_b = Context::New(isolate);
+  {
+    // Warm the shape cache in context A.
+    v8::Context::Scope context_scope(context_a);
+    for (int i = 0; i < 3; i++) {
+      Local<Value> obj =
+          v8::JSON::Parse(context_a, v8_str(source)).ToLocalChecked();
+      CHECK(obj.As<v8::Object>()->GetPrototype()->StrictEquals(
+          GetObjectPrototype(context_a)));
+    }
+  }
+  {
+    v8::Context::Scope context_scope(context_b);
+    Local<Value> obj =
+        v8::JSON::Parse(context_b, v8_str(source)).ToLocalChecked();
+    CHECK(obj.As<v8::Object>()->GetPrototype()->StrictEquals(
+        GetObjectPrototype(context_b)));
+  }
+  {
+    // Context A keeps getting its own prototype afterwards, too.
+    v8::Context::Scope context_scope(context_a);
+    Local<Value> obj =
+        v8::JSON::Parse(context_a, v8_str(source)).ToLocalChecked();
+    CHECK(obj.As<v8::Object>()->GetPrototype()->StrictEquals(
+        GetObjectPrototype(context_a)));
+  }
+}
+
 THREADED_TEST(JSONParseNumber) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -25609,6 +25730,25 @@ THREADED_TEST(ImmutableProto) {
             .FromJust());
 }
 
+THREADED_TEST(PretenuredObjectTemplate) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  CHECK(!templ->IsPretenured());
+  templ->SetPretenured();
+  CHECK(templ->IsPretenured());
+
+  // Instantiate twice so that both the uncached and the cached instantiation
+  // paths are exercised.
+  for (int i = 0; i < 2; i++) {
+    Local<v8::Object> object =
+        templ->NewInstance(context.local()).ToLocalChecked();
+    CHECK(!i::Heap::InYoungGeneration(*v8::Utils::OpenDirectHandle(*object)));
+  }
+}
+
 namespace {
 
 v8::Global<v8::Context> call_eval_context_global;
@@ -930,6 +930,28 @@ TEST(CollectCpuProfileSamples) {
   profile->Delete();
 }
 
+// Checks that the frame pointer unwind mode still produces samples. The
+// resulting stacks are coarser than with the full stack walk, so only the
+// sample count is checked.
+TEST(CollectCpuProfileFramePointerUnwind) {
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.cpu_profiler_frame_pointer_unwind = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args));
+
+  CHECK_LT(0, profile->GetSamplesCount());
+  profile->Delete();
+}
+
 static const char* cpu_profiler_test_source2 =
     "%NeverOptimizeFunction(loop);\n"
     "%NeverOptimizeFunction(delay);\n"
@@ -4014,6 +4014,35 @@ TEST(SamplingHeapProfilerLargeInterval) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(AllocationTypeHistogram) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  CHECK(heap_profiler->StartAllocationTypeHistogram(256));
+  // A second recording cannot be started while one is active.
+  CHECK(!heap_profiler->StartAllocationTypeHistogram(256));
+
+  for (int i = 0; i < 1024; ++i) {
+    CcTest::i_isolate()->factory()->NewFixedArray(128);
+  }
+
+  auto delta = heap_profiler->GetAllocationTypeHistogramDelta();
+  CHECK(!delta.empty());
+  size_t total_count = 0;
+  size_t total_bytes = 0;
+  for (const auto& entry : delta) {
+    CHECK_NOT_NULL(entry.type_name);
+    total_count += entry.count;
+    total_bytes += entry.bytes;
+  }
+  CHECK_GT(total_count, 0u);
+  CHECK_GT(total_bytes, 0u);
+
+  heap_profiler->StopAllocationTypeHistogram();
+  CHECK(heap_profiler->GetAllocationTypeHistogramDelta().empty());
+}
+
 TEST(HeapSnapshotPrototypeNotJSReceiver) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -4269,6 +4298,22 @@ TEST(HeapSnapshotDeleteDuringTakeSnapshot) {
   CHECK_EQ(gc_calls, 1);
 }
 
+TEST(HeapSnapshotWithoutForcedGC) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  CompileRun("var a = { name: 'A' };");
+
+  // Taking a snapshot without a preparatory GC must still produce a valid,
+  // fully connected snapshot.
+  v8::HeapProfiler::HeapSnapshotOptions options;
+  options.gc_mode = v8::HeapProfiler::GarbageCollectionMode::kNone;
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot(options);
+  CHECK(ValidateSnapshot(snapshot));
+  CHECK(GetGlobalObject(snapshot));
+}
+
 TEST(ObjectRetainedInHandle) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -1838,6 +1838,70 @@ void TestCodeSerializerOnePlusOneImpl(bool verify_builtins_count = true) {
 
 TEST(CodeSerializerOnePlusOne) { TestCodeSerializerOnePlusOneImpl(); }
 
+TEST(CodeSerializerPreparseData) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  // A lazy outer function with an inner function, so that preparsing the
+  // outer function records skippable-function data for the inner one.
+  const char* source =
+      "function outer(a) {"
+      "  function inner(b) { return a + b; }"
+      "  return inner;"
+      "}"
+      "outer";
+
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  AlignedCachedData* cache = nullptr;
+
+  ScriptDetails default_script_details;
+  CompileScriptAndProduceCache(isolate, orig_source, default_script_details,
+                               &cache, v8::ScriptCompiler::kNoCompileOptions);
+
+  Handle<SharedFunctionInfo> copy;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    copy = CompileScript(isolate, copy_source, default_script_details, cache,
+                         v8::ScriptCompiler::kConsumeCodeCache);
+  }
+
+  // The lazy outer function must come out of the cache with its preparse
+  // data, so that compiling it on the consuming side doesn't have to preparse
+  // the inner function again.
+  bool found_lazy_function = false;
+  SharedFunctionInfo::ScriptIterator iter(isolate,
+                                          Script::cast(copy->script()));
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (info->is_toplevel()) continue;
+    CHECK(!info->is_compiled());
+    CHECK(info->HasUncompiledDataWithPreparseData());
+    found_lazy_function = true;
+  }
+  CHECK(found_lazy_function);
+
+  Handle<JSFunction> copy_fun =
+      Factory::JSFunctionBuilder{isolate, copy, isolate->native_context()}
+          .Build();
+  Handle<JSObject> global(isolate->context()->global_object(), isolate);
+  Handle<Object> copy_result =
+      Execution::CallScript(isolate, copy_fun, global,
+                            isolate->factory()->empty_fixed_array())
+          .ToHandleChecked();
+  CHECK(IsJSFunction(*copy_result));
+
+  delete cache;
+}
+
 // See bug v8:9122
 TEST(CodeSerializerOnePlusOneWithInterpretedFramesNativeStack) {
   v8_flags.interpreted_frames_native_stack = true;
@@ -3007,6 +3071,63 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(SharedCompilationCacheAcrossIsolates) {
+  v8_flags.shared_compilation_cache = true;
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Compiling in the first isolate publishes serialized code into the
+  // process-wide cache.
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    USE(script);
+
+    Isolate* i_isolate1 = reinterpret_cast<Isolate*>(isolate1);
+    HandleScope i_scope(i_isolate1);
+    const uint64_t key = SharedCompilationCache::Key(
+        i_isolate1, v8::Utils::OpenHandle(*v8_str(js_source)),
+        LanguageMode::kSloppy, v8::ScriptOriginOptions().Flags());
+    CHECK_NOT_NULL(SharedCompilationCache::GetInstance()->Lookup(key).get());
+  }
+  isolate1->Dispose();
+
+  // The second isolate consumes the shared entry instead of compiling.
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source));
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate2, &source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
@@ -3189,6 +3310,108 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+TEST(CodeCacheDirectory) {
+  i::v8_flags.verify_snapshot_checksum = true;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* js_source = "function ccd() { return 21; }; ccd() * 2";
+
+  // The entry lives at <directory>/<source hash>.vcache.
+  Handle<String> source_handle =
+      isolate->factory()
+          ->NewStringFromUtf8(base::CStrVector(js_source))
+          .ToHandleChecked();
+  uint32_t key =
+      SerializedCodeData::SourceHash(source_handle, ScriptOriginOptions());
+  char entry_path[32];
+  base::OS::SNPrintF(entry_path, sizeof(entry_path), "./%08x.vcache", key);
+  base::OS::Remove(entry_path);
+
+  v8::ScriptCompiler::SetCodeCacheDirectory(CcTest::isolate(), ".");
+
+  auto compile = [&]() {
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptCompiler::Source source(source_str);
+    return v8::ScriptCompiler::CompileUnboundScript(
+               CcTest::isolate(), &source,
+               v8::ScriptCompiler::kNoCompileOptions)
+        .ToLocalChecked();
+  };
+  auto run = [&](v8::Local<v8::UnboundScript> script) {
+    v8::Local<v8::Context> ctx = CcTest::isolate()->GetCurrentContext();
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(ctx).ToLocalChecked();
+    CHECK_EQ(42, result->Int32Value(ctx).FromJust());
+  };
+  auto entry_size = [&]() -> long {
+    FILE* file = base::OS::FOpen(entry_path, "rb");
+    if (file == nullptr) return -1;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+  };
+  auto overwrite_entry = [&](const uint8_t* data, size_t length) {
+    FILE* file = base::OS::FOpen(entry_path, "wb");
+    CHECK_NOT_NULL(file);
+    CHECK_EQ(length, fwrite(data, 1, length, file));
+    fclose(file);
+  };
+
+  // The first compile misses the directory and writes an entry back.
+  CHECK_EQ(-1, entry_size());
+  run(compile());
+  long valid_size = entry_size();
+  CHECK_GT(valid_size, 0);
+
+  // The second compile consumes the entry instead of compiling. Running
+  // still lazily compiles the inner function, so only the script compile
+  // itself is in the no-compile scope.
+  v8::Local<v8::UnboundScript> script;
+  {
+    DisallowCompilation no_compile_expected(isolate);
+    script = compile();
+  }
+  run(script);
+
+  // A truncated entry is rejected, the script is recompiled, and the entry
+  // is rewritten.
+  const uint8_t junk[] = {1, 2, 3, 4};
+  overwrite_entry(junk, sizeof(junk));
+  run(compile());
+  CHECK_GT(entry_size(), static_cast<long>(sizeof(junk)));
+
+  // A well-formed entry for a different script fails the source hash check
+  // and compilation proceeds normally.
+  v8::ScriptCompiler::CachedData* other_cache =
+      CompileRunAndProduceCache("function f() { return 'abc'; }; f() + 'def'");
+  overwrite_entry(other_cache->data, other_cache->length);
+  delete other_cache;
+  run(compile());
+
+  // A bit flip in the entry trips the checksum.
+  {
+    long size = entry_size();
+    CHECK_GT(size, 0);
+    std::vector<uint8_t> bytes(size);
+    FILE* file = base::OS::FOpen(entry_path, "rb");
+    CHECK_NOT_NULL(file);
+    CHECK_EQ(bytes.size(), fread(bytes.data(), 1, bytes.size(), file));
+    fclose(file);
+    bytes[bytes.size() / 2] ^= 0x40;
+    overwrite_entry(bytes.data(), bytes.size());
+  }
+  run(compile());
+
+  base::OS::Remove(entry_path);
+  v8::ScriptCompiler::SetCodeCacheDirectory(CcTest::isolate(), nullptr);
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
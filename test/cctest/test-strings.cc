@@ -1323,6 +1323,49 @@ TEST(SliceFromCons) {
   CHECK(slice->IsFlat());
 }
 
+TEST(SliceShortWithLoweredMinLength) {
+  if (!v8_flags.string_slices) return;
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  CcTest::isolate()->SetSlicedStringMinLength(4);
+  Handle<String> parent =
+      factory->NewStringFromStaticChars("parentparentparent");
+  Handle<String> shorter = factory->NewSubString(parent, 1, 5);
+  CHECK(IsSlicedString(*shorter));
+  CHECK_EQ(4, shorter->length());
+  CHECK_EQ('a', shorter->Get(0));
+  // Lengths below the clamped minimum of 3 still come from the string caches.
+  Handle<String> tiny = factory->NewSubString(parent, 1, 3);
+  CHECK(!IsSlicedString(*tiny));
+  CcTest::isolate()->SetSlicedStringMinLength(SlicedString::kMinLength);
+}
+
+TEST(BulkSubStrings) {
+  if (!v8_flags.string_slices) return;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::String> parent =
+      v8::String::NewFromUtf8Literal(isolate, "abcdefghijklmnopqrstuvwxyz");
+  const v8::String::SubStringRange ranges[] = {
+      {0, 26}, {1, 13}, {3, 2}, {5, 0}, {20, 7}};
+  v8::Local<v8::String> out[5];
+  // The last range is out of bounds, so nothing must be created.
+  CHECK(!v8::String::NewSubStrings(isolate, parent, ranges, 5, out));
+  CHECK(v8::String::NewSubStrings(isolate, parent, ranges, 4, out));
+  Handle<String> full = v8::Utils::OpenHandle(*out[0]);
+  CHECK_EQ(26, full->length());
+  Handle<String> slice = v8::Utils::OpenHandle(*out[1]);
+  CHECK(IsSlicedString(*slice));
+  CHECK_EQ(13, slice->length());
+  CHECK_EQ('b', slice->Get(0));
+  Handle<String> two = v8::Utils::OpenHandle(*out[2]);
+  CHECK(!IsSlicedString(*two));
+  CHECK_EQ(2, two->length());
+  CHECK_EQ(0, v8::Utils::OpenHandle(*out[3])->length());
+}
+
 class OneByteVectorResource : public v8::String::ExternalOneByteStringResource {
  public:
   explicit OneByteVectorResource(v8::base::Vector<const char> vector)
@@ -0,0 +1,109 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A collator's compare function switches to memoized sort keys after enough
+// comparisons. The answers must not change when it does.
+
+// Record every pairwise result while the collator is cold, then re-ask after
+// driving it far past the memoization threshold.
+(function testCrossThresholdConsistency() {
+  var strings = ['März', 'Fuße', 'FUSSE', 'Fluße', 'Flusse',
+                 'flusse', 'fluße', 'flüße', 'flüsse'];
+  var collator = new Intl.Collator('de');
+  var cold = [];
+  for (var i = 0; i < strings.length; i++) {
+    for (var j = 0; j < strings.length; j++) {
+      cold.push(Math.sign(collator.compare(strings[i], strings[j])));
+    }
+  }
+  // Warm the collator well past the threshold.
+  for (var k = 0; k < 100; k++) collator.compare('warm' + k, 'warm');
+  var warm = [];
+  for (var i = 0; i < strings.length; i++) {
+    for (var j = 0; j < strings.length; j++) {
+      warm.push(Math.sign(collator.compare(strings[i], strings[j])));
+    }
+  }
+  assertEquals(cold, warm);
+})();
+
+// A sort large enough to cross the threshold mid-way produces the expected
+// order, with every element compared both before and after the switch.
+(function testSortAcrossThreshold() {
+  var expected = ['flusse', 'Flusse', 'fluße', 'Fluße', 'flüsse',
+                  'flüße', 'FUSSE', 'Fuße', 'März'];
+  var strings = [];
+  for (var copy = 0; copy < 20; copy++) {
+    for (var i = 0; i < expected.length; i++) {
+      strings.push(expected[i]);
+    }
+  }
+  var collator = new Intl.Collator('de');
+  strings.sort(collator.compare);
+  for (var i = 0; i < strings.length; i++) {
+    assertEquals(expected[Math.floor(i / 20)], strings[i],
+                 'position ' + i);
+  }
+})();
+
+// Two-byte strings, including duplicates that must hit the cached key via
+// the content-equality probe.
+(function testTwoByteStrings() {
+  var expected = ['άλφα', 'βήτα', 'γάμμα', 'δέλτα', 'ζήτα'];
+  var strings = [];
+  for (var copy = 0; copy < 20; copy++) {
+    for (var i = 0; i < expected.length; i++) {
+      strings.push(expected[i]);
+    }
+  }
+  var collator = new Intl.Collator('el');
+  strings.sort(collator.compare);
+  for (var i = 0; i < strings.length; i++) {
+    assertEquals(expected[Math.floor(i / 20)], strings[i],
+                 'position ' + i);
+  }
+  // Equal strings stay equal after warm-up, whether or not they are the
+  // same object.
+  assertEquals(0, collator.compare('άλφα', 'άλφα'));
+  assertEquals(0, collator.compare('άλφα', 'άλφα'));
+})();
+
+// Enough distinct medium-length strings to blow the per-collator key cache
+// budget; comparisons past that point fall back to freshly generated keys
+// and must stay correct.
+(function testCacheBudgetFallback() {
+  function pad(n) {
+    return ('00000' + n).slice(-5);
+  }
+  var filler = new Array(512).join('x');
+  var strings = [];
+  for (var i = 0; i < 2000; i++) {
+    strings.push(pad(i) + filler);
+  }
+  // Shuffle deterministically.
+  for (var i = strings.length - 1; i > 0; i--) {
+    var j = (i * 7919) % (i + 1);
+    var tmp = strings[i];
+    strings[i] = strings[j];
+    strings[j] = tmp;
+  }
+  var collator = new Intl.Collator('en');
+  strings.sort(collator.compare);
+  for (var i = 0; i < strings.length; i++) {
+    assertEquals(pad(i), strings[i].slice(0, 5), 'position ' + i);
+  }
+})();
+
+// Strings above the per-string length limit bypass the cache entirely.
+(function testLongStringsBypass() {
+  var filler = new Array(1500).join('y');
+  var a = filler + 'a';
+  var b = filler + 'b';
+  var collator = new Intl.Collator('en');
+  for (var i = 0; i < 50; i++) {
+    assertTrue(collator.compare(a, b) < 0);
+    assertTrue(collator.compare(b, a) > 0);
+    assertEquals(0, collator.compare(a, filler + 'a'));
+  }
+})();
@@ -266,3 +266,28 @@ for (var i = 0; i < 100; i++) {
 var r4 = [0].concat(arr3, arr3);
 assertEquals(1 + arr3.length * 2, r4.length);
 assertEquals(expectedTrace, trace);
+
+// An object with a proxy in its prototype chain must have its
+// @@isConcatSpreadable looked up through the proxy, even when all other
+// arguments are fast arrays.
+(function testProxyInPrototypeChain() {
+  var getTrap = [];
+  var target = {};
+  var proxy = new Proxy(target, {
+    get(t, key, receiver) {
+      getTrap.push(key);
+      if (key === Symbol.isConcatSpreadable) return true;
+      if (key === 'length') return 2;
+      if (key === '0') return 'a';
+      if (key === '1') return 'b';
+      return Reflect.get(t, key, receiver);
+    },
+    has(t, key) {
+      return true;
+    }
+  });
+  var obj = Object.create(proxy);
+  var r = [1, 2].concat(obj, [3]);
+  assertTrue(getTrap.includes(Symbol.isConcatSpreadable));
+  assertEquals([1, 2, 'a', 'b', 3], r);
+})();
@@ -0,0 +1,125 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Cloning a large packed array may share the backing store copy-on-write
+// with the source. Writes through either array must trigger the deferred
+// copy and never be observable through the other one.
+
+// Large enough that the backing store exceeds the regular-object size limit
+// on all configurations.
+const kLength = 40000;
+
+function MakeLargeSmiArray() {
+  var a = new Array(kLength);
+  for (var i = 0; i < kLength; i++) a[i] = i;
+  assertTrue(%HasSmiElements(a));
+  return a;
+}
+
+function MakeLargeObjectArray() {
+  var a = new Array(kLength);
+  for (var i = 0; i < kLength; i++) a[i] = 's' + (i & 7);
+  assertTrue(%HasObjectElements(a));
+  return a;
+}
+
+(function testCloneThenMutateSource() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice();
+  src[5] = -1;
+  src[kLength - 1] = -1;
+  assertEquals(5, clone[5]);
+  assertEquals(kLength - 1, clone[kLength - 1]);
+  assertEquals(-1, src[5]);
+})();
+
+(function testCloneThenMutateClone() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice(0);
+  clone[7] = -1;
+  clone.push(-2);
+  assertEquals(7, src[7]);
+  assertEquals(kLength, src.length);
+  assertEquals(kLength + 1, clone.length);
+})();
+
+(function testCloneThenShrinkSourceLength() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice();
+  src.length = 10;
+  assertEquals(kLength, clone.length);
+  assertEquals(kLength - 1, clone[kLength - 1]);
+  assertEquals(123, clone[123]);
+  assertEquals(undefined, src[11]);
+})();
+
+(function testSortOnSharedStore() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice();
+  src.sort(function(x, y) { return y - x; });
+  assertEquals(kLength - 1, src[0]);
+  assertEquals(0, src[kLength - 1]);
+  // The clone keeps ascending order.
+  assertEquals(0, clone[0]);
+  assertEquals(1, clone[1]);
+  assertEquals(kLength - 1, clone[kLength - 1]);
+})();
+
+(function testFillOnSharedStore() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice();
+  clone.fill(7);
+  assertEquals(7, clone[0]);
+  assertEquals(7, clone[kLength - 1]);
+  assertEquals(0, src[0]);
+  assertEquals(kLength - 1, src[kLength - 1]);
+})();
+
+(function testCopyWithinOnSharedStore() {
+  var src = MakeLargeSmiArray();
+  var clone = src.slice();
+  src.copyWithin(0, 1000);
+  assertEquals(1000, src[0]);
+  assertEquals(0, clone[0]);
+  assertEquals(999, clone[999]);
+})();
+
+// The same aliasing rules hold for PACKED_ELEMENTS stores, which the
+// literal-based COW machinery never produced before.
+(function testPackedElementsClone() {
+  var src = MakeLargeObjectArray();
+  var clone = src.slice();
+  src[3] = 'mutated';
+  assertEquals('s3', clone[3]);
+  clone[4] = 'mutated-clone';
+  assertEquals('s4', src[4]);
+  clone.fill('x', 0, 100);
+  assertEquals('s0', src[0]);
+})();
+
+// Chained clones of the same source must all be independent.
+(function testMultipleClones() {
+  var src = MakeLargeSmiArray();
+  var clone1 = src.slice();
+  var clone2 = src.slice();
+  var clone3 = clone1.slice();
+  clone1[0] = -1;
+  clone2[0] = -2;
+  src[0] = -3;
+  assertEquals(-1, clone1[0]);
+  assertEquals(-2, clone2[0]);
+  assertEquals(-3, src[0]);
+  assertEquals(0, clone3[0]);
+})();
+
+// The concat clone fast path shares the same mechanism.
+(function testConcatClone() {
+  var src = MakeLargeSmiArray();
+  var clone = [].concat(src);
+  assertEquals(kLength, clone.length);
+  src[42] = -1;
+  assertEquals(42, clone[42]);
+})();
@@ -0,0 +1,62 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --async-stack-traces
+
+// Async stack traces should survive additional reactions being attached to
+// an awaited promise (for example monitoring or logging handlers): the walk
+// follows the first (oldest) reaction, which is the await.
+
+// Extra fulfill reaction attached after the await.
+(function() {
+  async function one(x) {
+    const p = two(x);
+    p.then(() => {});
+    await p;
+  }
+
+  async function two(x) {
+    await x;
+    throw new Error();
+  }
+
+  async function test(f) {
+    try {
+      await f(1);
+      assertUnreachable();
+    } catch (e) {
+      assertInstanceof(e, Error);
+      assertMatches(/Error.+at two.+at async one.+at async test/ms, e.stack);
+    }
+  }
+
+  assertPromiseResult(test(one));
+})();
+
+// Several extra reactions attached after the await.
+(function() {
+  async function one(x) {
+    const p = two(x);
+    p.catch(() => {});
+    p.then(() => {}, () => {});
+    await p;
+  }
+
+  async function two(x) {
+    await x;
+    throw new Error();
+  }
+
+  async function test(f) {
+    try {
+      await f(1);
+      assertUnreachable();
+    } catch (e) {
+      assertInstanceof(e, Error);
+      assertMatches(/Error.+at two.+at async one.+at async test/ms, e.stack);
+    }
+  }
+
+  assertPromiseResult(test(one));
+})();
@@ -0,0 +1,29 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --background-flatten-strings --background-flatten-min-length=1024
+
+// Smoke test for proactive background flattening: grow a cons string well
+// past the scheduling threshold by repeated appends, keep accessing it, and
+// check that the content always matches a flat reference string.
+
+(function TestGrowingConsString() {
+  const piece = 'abcdefghijklmnopqrstuvwxyz0123456789';
+  const pieces = [];
+  let cons = '';
+  for (let i = 0; i < 4096; i++) {
+    const part = piece + i;
+    pieces.push(part);
+    cons += part;
+    if (i % 512 === 0) {
+      // Force a flat access somewhere in the middle of the string while a
+      // background flatten may be in flight.
+      assertEquals('a', cons[0]);
+    }
+  }
+  const expected = pieces.join('');
+  assertEquals(expected.length, cons.length);
+  assertEquals(expected, cons);
+  assertEquals(expected.charCodeAt(100000), cons.charCodeAt(100000));
+})();
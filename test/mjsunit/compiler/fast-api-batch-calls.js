@@ -0,0 +1,76 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file exercises CFunction batch variants: the batch entry point is
+// published as an arity-distinguished overload of the scalar function, so a
+// call site that passes a TypedArray and a count compiles to a single batched
+// fast call instead of one fast call per element.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// --always-turbofan is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+const fast_c_api = new d8.test.FastCAPI();
+
+// ----------- add_all_batch -----------
+// `add_all_batch` has the following overloads:
+// double add_all_batch(double)                        - scalar
+// double add_all_batch(Float64Array values, uint32_t) - batch
+
+const values = new Float64Array([1.5, 2.5, 3.5, 4.5]);
+const expected = 1.5 + 2.5 + 3.5 + 4.5;
+
+// A per-element loop over the scalar overload.
+function sum_scalar_loop(array) {
+  let sum = 0;
+  for (let i = 0; i < array.length; i++) {
+    sum += fast_c_api.add_all_batch(array[i]);
+  }
+  return sum;
+}
+
+// The same computation as a single batched call.
+function sum_batched(array) {
+  return fast_c_api.add_all_batch(array, array.length);
+}
+
+%PrepareFunctionForOptimization(sum_scalar_loop);
+assertEquals(expected, sum_scalar_loop(values));
+%OptimizeFunctionOnNextCall(sum_scalar_loop);
+
+%PrepareFunctionForOptimization(sum_batched);
+assertEquals(expected, sum_batched(values));
+%OptimizeFunctionOnNextCall(sum_batched);
+
+if (fast_c_api.supports_fp_params) {
+  // The scalar overload makes one fast call per element.
+  fast_c_api.reset_counts();
+  assertEquals(expected, sum_scalar_loop(values));
+  assertOptimized(sum_scalar_loop);
+  assertEquals(values.length, fast_c_api.fast_call_count());
+  assertEquals(0, fast_c_api.slow_call_count());
+
+  // The batch overload makes a single fast call for the whole array.
+  fast_c_api.reset_counts();
+  assertEquals(expected, sum_batched(values));
+  assertOptimized(sum_batched);
+  assertEquals(1, fast_c_api.fast_call_count());
+  assertEquals(0, fast_c_api.slow_call_count());
+
+  // A partial count only sums a prefix of the array.
+  fast_c_api.reset_counts();
+  assertEquals(1.5 + 2.5, fast_c_api.add_all_batch(values, 2));
+} else {
+  // Without fp params support both shapes hit the slow path, which
+  // implements the same semantics.
+  fast_c_api.reset_counts();
+  assertEquals(expected, sum_scalar_loop(values));
+  assertEquals(expected, sum_batched(values));
+  assertEquals(0, fast_c_api.fast_call_count());
+  assertEquals(values.length + 1, fast_c_api.slow_call_count());
+}
@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Promise.resolve on a value known to be a native promise returns the value
+// itself, so the optimized code elides the wrapper promise allocation. Check
+// that identity is preserved and that non-native promises still get wrapped.
+
+(function TestNativePromiseIdentity() {
+  function foo(p) { return Promise.resolve(p); }
+  const p = Promise.resolve(1);
+  %PrepareFunctionForOptimization(foo);
+  assertSame(p, foo(p));
+  assertSame(p, foo(p));
+  %OptimizeFunctionOnNextCall(foo);
+  assertSame(p, foo(p));
+  assertOptimized(foo);
+})();
+
+(function TestNativePromiseResult() {
+  function foo(p) { return Promise.resolve(p); }
+  %PrepareFunctionForOptimization(foo);
+  assertPromiseResult(foo(Promise.resolve(1)), v => assertEquals(1, v));
+  assertPromiseResult(foo(Promise.resolve(2)), v => assertEquals(2, v));
+  %OptimizeFunctionOnNextCall(foo);
+  assertPromiseResult(foo(Promise.resolve(3)), v => assertEquals(3, v));
+})();
+
+(function TestSubclassPromiseStillWrapped() {
+  class MyPromise extends Promise {}
+  function foo(p) { return Promise.resolve(p); }
+  %PrepareFunctionForOptimization(foo);
+  const p1 = MyPromise.resolve(1);
+  assertNotSame(p1, foo(p1));
+  assertNotSame(p1, foo(p1));
+  %OptimizeFunctionOnNextCall(foo);
+  const p2 = MyPromise.resolve(2);
+  const wrapped = foo(p2);
+  assertNotSame(p2, wrapped);
+  assertPromiseResult(wrapped, v => assertEquals(2, v));
+})();
@@ -0,0 +1,46 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --serialize-array-buffers-out-of-band
+
+// With --serialize-array-buffers-out-of-band, postMessage conveys
+// ArrayBuffers by sharing their backing stores instead of copying the bytes.
+// Unlike an explicit transfer, the sender's buffer stays usable.
+
+if (this.Worker) {
+  const workerScript = `onmessage = function(msg) {
+    const view = new Uint8Array(msg.buffer);
+    postMessage({first: view[0], last: view[view.length - 1],
+                 byteLength: msg.buffer.byteLength});
+  };`;
+
+  const w = new Worker(workerScript, {type: 'string'});
+
+  const buffer = new ArrayBuffer(1024);
+  const view = new Uint8Array(buffer);
+  view[0] = 11;
+  view[view.length - 1] = 42;
+
+  // No transfer list: the buffer is picked up out of band automatically.
+  w.postMessage({buffer: buffer});
+  const reply = w.getMessage();
+  assertEquals(11, reply.first);
+  assertEquals(42, reply.last);
+  assertEquals(1024, reply.byteLength);
+
+  // The sender's buffer was shared, not detached.
+  assertEquals(1024, buffer.byteLength);
+  assertEquals(42, view[view.length - 1]);
+
+  // Explicit transfers still detach and must coexist with out-of-band
+  // buffers in the same message.
+  const transferred = new ArrayBuffer(16);
+  const kept = new ArrayBuffer(8);
+  new Uint8Array(transferred)[0] = 7;
+  new Uint8Array(kept)[0] = 5;
+  w.postMessage({buffer: kept, transferred: transferred}, [transferred]);
+  w.terminate();
+  assertEquals(0, transferred.byteLength);
+  assertEquals(8, kept.byteLength);
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --worker-pool --stress-runs=1
+
+// Workers created sequentially recycle pooled threads and isolates; each one
+// must still get a fresh context.
+
+if (this.Worker) {
+  const script = `
+    globalThis.leak = globalThis.leak || 0;
+    globalThis.leak++;
+    onmessage = function(msg) {
+      postMessage({seen: globalThis.leak, echo: msg});
+    };`;
+
+  for (let i = 0; i < 10; i++) {
+    const w = new Worker(script, {type: 'string'});
+    w.postMessage(i);
+    const reply = w.getMessage();
+    // A recycled isolate must not leak globals from the previous worker.
+    assertEquals(1, reply.seen);
+    assertEquals(i, reply.echo);
+    w.terminate();
+  }
+
+  // Terminating a worker mid-run must not poison the pooled isolate for
+  // the next worker.
+  const spinner = new Worker('postMessage(1); while (true) {}',
+                             {type: 'string'});
+  assertEquals(1, spinner.getMessage());
+  spinner.terminate();
+  const after = new Worker('postMessage(2)', {type: 'string'});
+  assertEquals(2, after.getMessage());
+}
@@ -0,0 +1,84 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Tests for the enumeration-order cache of dictionary-mode objects.
+
+function MakeSlowObject() {
+  var o = {a: 1, b: 2, c: 3};
+  delete o.c;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+// Repeated enumeration returns the same keys in the same order.
+(function testStableOrder() {
+  var o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  assertEquals(['a', 'b'], Object.keys(o));
+  var forIn = [];
+  for (var k in o) forIn.push(k);
+  assertEquals(['a', 'b'], forIn);
+})();
+
+// The arrays handed to JS must not alias the cache: mutating a result of
+// Object.keys must affect neither the object nor later enumerations.
+(function testResultsDoNotAlias() {
+  var o = MakeSlowObject();
+  var keys1 = Object.keys(o);
+  keys1[0] = 'clobbered';
+  keys1.length = 1;
+  var keys2 = Object.keys(o);
+  assertEquals(['a', 'b'], keys2);
+  keys2[1] = 'clobbered-too';
+  assertEquals(['a', 'b'], Object.keys(o));
+  assertEquals(['a', 'b'], Object.getOwnPropertyNames(o));
+})();
+
+// Adding a property invalidates the cached order.
+(function testAddInvalidates() {
+  var o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  o.d = 4;
+  assertEquals(['a', 'b', 'd'], Object.keys(o));
+})();
+
+// So does deleting one.
+(function testDeleteInvalidates() {
+  var o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  delete o.a;
+  assertEquals(['b'], Object.keys(o));
+})();
+
+// And redefining enumerability.
+(function testReconfigureInvalidates() {
+  var o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  Object.defineProperty(o, 'a', {enumerable: false});
+  assertEquals(['b'], Object.keys(o));
+  Object.defineProperty(o, 'a', {enumerable: true});
+  assertEquals(['a', 'b'], Object.keys(o));
+})();
+
+// Value-only writes keep the cache valid and the contents fresh.
+(function testValueStores() {
+  var o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  o.a = 42;
+  assertEquals(['a', 'b'], Object.keys(o));
+  assertEquals(42, o.a);
+})();
+
+// Dictionary objects used as prototypes still report shadowing keys.
+(function testPrototypeWalk() {
+  var proto = MakeSlowObject();
+  Object.defineProperty(proto, 'hidden', {enumerable: false, value: 1});
+  var o = Object.create(proto);
+  o.own = 1;
+  var forIn = [];
+  for (var k in o) forIn.push(k);
+  assertEquals(['own', 'a', 'b'], forIn);
+})();
@@ -0,0 +1,81 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+d8.file.execute('test/mjsunit/test-async.js');
+
+// Promise.all pre-sizes its values array from the length of a fast-array
+// iterable. The length is only a capacity hint: the result must still match
+// exactly what the iterator produced.
+
+// Plain fast array.
+(function() {
+  testAsync(assert => {
+    assert.plan(1);
+    Promise.all([1, 2, 3, 4]).then(
+        v => assert.equals([1, 2, 3, 4], v), assert.unexpectedRejection());
+  });
+})();
+
+// The array shrinks while it is being iterated, so fewer elements are
+// produced than the hint promised.
+(function() {
+  const arr = [1, 2, 3, 4];
+  class MyPromise extends Promise {
+    static resolve(v) {
+      arr.length = 2;
+      return super.resolve(v);
+    }
+  };
+  testAsync(assert => {
+    assert.plan(2);
+    MyPromise.all(arr).then(v => {
+      assert.equals(2, v.length);
+      assert.equals([1, 2], v);
+    }, assert.unexpectedRejection());
+  });
+})();
+
+// The array grows while it is being iterated, so more elements are produced
+// than the hint promised.
+(function() {
+  const arr = [1, 2];
+  class MyPromise extends Promise {
+    static resolve(v) {
+      if (arr.length < 4) arr.push(arr.length + 1);
+      return super.resolve(v);
+    }
+  };
+  testAsync(assert => {
+    assert.plan(1);
+    MyPromise.all(arr).then(
+        v => assert.equals([1, 2, 3, 4], v), assert.unexpectedRejection());
+  });
+})();
+
+// Resolve callbacks invoked right away during iteration must write into the
+// pre-sized array.
+(function() {
+  class MyPromise extends Promise {
+    constructor(executor, id) {
+      super(executor);
+      this.id = id;
+    }
+
+    then(resolve, reject) {
+      if (this.id) return resolve(this.id);
+      return super.then(resolve, reject);
+    }
+  };
+  const a = new MyPromise(() => {}, 'a');
+  const b = new MyPromise(() => {}, 'b');
+  const c = new MyPromise(() => {}, 'c');
+  testAsync(assert => {
+    assert.plan(1);
+    MyPromise.all([a, b, c]).then(
+        v => assert.equals(['a', 'b', 'c'], v),
+        assert.unexpectedRejection());
+  });
+})();
@@ -281,3 +281,19 @@
 
   assertEquals([43], Array.from(firstSet.intersection(evil)));
 })();
+
+(function TestIntersectionLargeSets() {
+  const firstSet = new Set();
+  const otherSet = new Set();
+  for (let i = 0; i < 2000; i++) {
+    firstSet.add(i);
+    otherSet.add(2 * i);
+  }
+
+  const intersection = firstSet.intersection(otherSet);
+  assertEquals(1000, intersection.size);
+  const intersectionArray = Array.from(intersection);
+  for (let i = 0; i < 1000; i++) {
+    assertEquals(2 * i, intersectionArray[i]);
+  }
+})();
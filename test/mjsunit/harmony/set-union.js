@@ -251,3 +251,36 @@
 
   assertEquals(resultArray, unionArray);
 })();
+
+(function TestUnionLargeSets() {
+  const firstSet = new Set();
+  const otherSet = new Set();
+  for (let i = 0; i < 2000; i++) {
+    firstSet.add(i);
+    otherSet.add(i + 1000);
+  }
+
+  const union = firstSet.union(otherSet);
+  assertEquals(3000, union.size);
+  const unionArray = Array.from(union);
+  for (let i = 0; i < 3000; i++) {
+    assertEquals(i, unionArray[i]);
+  }
+})();
+
+(function TestUnionLargeSetsWithDeletions() {
+  const firstSet = new Set();
+  const otherSet = new Set();
+  for (let i = 0; i < 1500; i++) {
+    firstSet.add(i);
+    otherSet.add(2 * i);
+  }
+  for (let i = 0; i < 1500; i += 3) {
+    otherSet.delete(2 * i);
+  }
+
+  const expected = new Set(firstSet);
+  for (const v of otherSet) expected.add(v);
+
+  assertEquals(Array.from(expected), Array.from(firstSet.union(otherSet)));
+})();
@@ -0,0 +1,48 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --finalization-registry-cleanup-batch-size=1
+
+// With a batch size of 1, each cleanup task only processes a single cell and
+// requeues the registry; all holdings must still be delivered eventually.
+
+(async function () {
+
+  let cleanup_called = 0;
+  let holdings_list = [];
+  let cleanup = function (holdings) {
+    holdings_list.push(holdings);
+    cleanup_called++;
+  }
+
+  let fg = new FinalizationRegistry(cleanup);
+
+  // Only access the targets inside a function to prevent references from
+  // temporary registers keeping them alive.
+  (function () {
+    for (let i = 0; i < 3; i++) {
+      fg.register({}, i);
+    }
+  })();
+
+  // Invoke GC asynchronously and wait for it to finish, so that it doesn't
+  // need to scan the stack.
+  await gc({ type: 'major', execution: 'async' });
+  assertEquals(0, cleanup_called);
+
+  // The cleanup tasks run when we return to the event loop; keep doing so
+  // until every holding was delivered.
+  let rounds = 0;
+  let check = function () {
+    if (cleanup_called < 3 && ++rounds < 100) {
+      setTimeout(check, 0);
+      return;
+    }
+    assertEquals(3, cleanup_called);
+    assertEquals([0, 1, 2], holdings_list.sort());
+  }
+  setTimeout(check, 0);
+
+})();
@@ -0,0 +1,59 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-error-stack-capture
+
+// With --lazy-error-stack-capture, stack frames are recorded in a compact
+// form at throw time and only materialized when the stack trace is read.
+// The observable output must match eager capture.
+
+function inner() { throw new Error('boom'); }
+function middle() { inner(); }
+function outer() { middle(); }
+
+(function TestStackString() {
+  try {
+    outer();
+  } catch (e) {
+    const lines = e.stack.split('\n');
+    assertEquals('Error: boom', lines[0]);
+    assertTrue(lines[1].includes('inner'));
+    assertTrue(lines[2].includes('middle'));
+    assertTrue(lines[3].includes('outer'));
+    // Repeated reads return the same formatted stack.
+    assertEquals(e.stack, e.stack);
+  }
+})();
+
+(function TestPrepareStackTrace() {
+  Error.prepareStackTrace = (error, frames) => frames;
+  let frames;
+  try {
+    outer();
+  } catch (e) {
+    frames = e.stack;
+  }
+  Error.prepareStackTrace = undefined;
+  assertEquals('inner', frames[0].getFunctionName());
+  assertEquals('middle', frames[1].getFunctionName());
+  assertTrue(frames[0].getLineNumber() > 0);
+})();
+
+(function TestStackTraceLimit() {
+  Error.stackTraceLimit = 2;
+  try {
+    outer();
+  } catch (e) {
+    // The message line plus two frames.
+    assertEquals(3, e.stack.split('\n').length);
+  }
+  Error.stackTraceLimit = 10;
+})();
+
+(function TestCaptureStackTrace() {
+  const o = {};
+  function capture() { Error.captureStackTrace(o, capture); }
+  capture();
+  assertTrue(o.stack.includes('TestCaptureStackTrace'));
+})();
@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+function sum(...args) {
+  let total = 0;
+  for (let arg of args) total += arg;
+  return total;
+}
+
+function spreadOnly() {
+  return sum(...[1, 2, 3]);
+}
+
+function spreadWithLeadingArgs(a, b) {
+  return sum(a, b, ...[10, 20, 30]);
+}
+
+function spreadObjects(x) {
+  return [x, ...['a', 'b']].join('');
+}
+
+%PrepareFunctionForOptimization(sum);
+%PrepareFunctionForOptimization(spreadOnly);
+assertEquals(6, spreadOnly());
+assertEquals(6, spreadOnly());
+%OptimizeMaglevOnNextCall(spreadOnly);
+assertEquals(6, spreadOnly());
+
+%PrepareFunctionForOptimization(spreadWithLeadingArgs);
+assertEquals(63, spreadWithLeadingArgs(1, 2));
+assertEquals(65, spreadWithLeadingArgs(2, 3));
+%OptimizeMaglevOnNextCall(spreadWithLeadingArgs);
+assertEquals(67, spreadWithLeadingArgs(3, 4));
+
+%PrepareFunctionForOptimization(spreadObjects);
+assertEquals('xab', spreadObjects('x'));
+assertEquals('yab', spreadObjects('y'));
+%OptimizeMaglevOnNextCall(spreadObjects);
+assertEquals('zab', spreadObjects('z'));
+
+// Patching the array iterator invalidates the protector; spread calls must
+// still see the modified iteration result.
+(function () {
+  function add3(a, b, c) {
+    return a + (b | 0) + (c | 0);
+  }
+  function tagged(x) {
+    return add3(x, ...[1, 2]);
+  }
+  %PrepareFunctionForOptimization(add3);
+  %PrepareFunctionForOptimization(tagged);
+  assertEquals(4, tagged(1));
+  %OptimizeMaglevOnNextCall(tagged);
+  assertEquals(5, tagged(2));
+
+  Array.prototype[Symbol.iterator] = function* () {
+    yield 7;
+  };
+  assertEquals(10, tagged(3));
+})();
@@ -0,0 +1,115 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev
+
+// Destructuring of arrays with the default iterator should behave the same
+// with the inlined iterator fast path as with the generic protocol.
+
+function destructure_smi(a) {
+  let [x, y] = a;
+  return x + y;
+}
+%PrepareFunctionForOptimization(destructure_smi);
+assertEquals(3, destructure_smi([1, 2]));
+assertEquals(3, destructure_smi([1, 2]));
+%OptimizeMaglevOnNextCall(destructure_smi);
+assertEquals(3, destructure_smi([1, 2]));
+assertEquals(7, destructure_smi([3, 4, 5]));
+
+function destructure_double(a) {
+  let [x, y] = a;
+  return x + y;
+}
+%PrepareFunctionForOptimization(destructure_double);
+assertEquals(4, destructure_double([1.5, 2.5]));
+assertEquals(4, destructure_double([1.5, 2.5]));
+%OptimizeMaglevOnNextCall(destructure_double);
+assertEquals(4, destructure_double([1.5, 2.5]));
+
+function destructure_object(a) {
+  let [x, y] = a;
+  return x.v + y.v;
+}
+%PrepareFunctionForOptimization(destructure_object);
+assertEquals(3, destructure_object([{v: 1}, {v: 2}]));
+assertEquals(3, destructure_object([{v: 1}, {v: 2}]));
+%OptimizeMaglevOnNextCall(destructure_object);
+assertEquals(3, destructure_object([{v: 1}, {v: 2}]));
+
+// Destructuring past the end of the array produces undefined.
+function destructure_short(a) {
+  let [x, y, z] = a;
+  return [x, y, z];
+}
+%PrepareFunctionForOptimization(destructure_short);
+assertEquals([1, undefined, undefined], destructure_short([1]));
+assertEquals([1, undefined, undefined], destructure_short([1]));
+%OptimizeMaglevOnNextCall(destructure_short);
+assertEquals([1, undefined, undefined], destructure_short([1]));
+assertEquals([undefined, undefined, undefined], destructure_short([]));
+
+// Holes read as undefined (guarded by the no-elements protector).
+function destructure_holey(a) {
+  let [x, y] = a;
+  return [x, y];
+}
+%PrepareFunctionForOptimization(destructure_holey);
+assertEquals([1, undefined], destructure_holey([1, , 3]));
+assertEquals([1, undefined], destructure_holey([1, , 3]));
+%OptimizeMaglevOnNextCall(destructure_holey);
+assertEquals([1, undefined], destructure_holey([1, , 3]));
+
+// Holes in double arrays must not leak as NaN.
+function destructure_holey_double(a) {
+  let [x, y] = a;
+  return [x, y];
+}
+%PrepareFunctionForOptimization(destructure_holey_double);
+assertEquals([1.5, undefined], destructure_holey_double([1.5, , 3.5]));
+assertEquals([1.5, undefined], destructure_holey_double([1.5, , 3.5]));
+%OptimizeMaglevOnNextCall(destructure_holey_double);
+assertEquals([1.5, undefined], destructure_holey_double([1.5, , 3.5]));
+
+// For-of uses the same protocol.
+function sum_for_of(a) {
+  let sum = 0;
+  for (let v of a) sum += v;
+  return sum;
+}
+%PrepareFunctionForOptimization(sum_for_of);
+assertEquals(6, sum_for_of([1, 2, 3]));
+assertEquals(6, sum_for_of([1, 2, 3]));
+%OptimizeMaglevOnNextCall(sum_for_of);
+assertEquals(6, sum_for_of([1, 2, 3]));
+assertEquals(10, sum_for_of([1, 2, 3, 4]));
+
+// Spread too.
+function spread(a) {
+  return [...a];
+}
+%PrepareFunctionForOptimization(spread);
+assertEquals([1, 2], spread([1, 2]));
+assertEquals([1, 2], spread([1, 2]));
+%OptimizeMaglevOnNextCall(spread);
+assertEquals([1, 2], spread([1, 2]));
+
+// An overridden Symbol.iterator must still win; the feedback change deopts
+// the fast path.
+function destructure_custom(a) {
+  let [x, y] = a;
+  return [x, y];
+}
+%PrepareFunctionForOptimization(destructure_custom);
+assertEquals([1, 2], destructure_custom([1, 2]));
+assertEquals([1, 2], destructure_custom([1, 2]));
+%OptimizeMaglevOnNextCall(destructure_custom);
+assertEquals([1, 2], destructure_custom([1, 2]));
+let custom = [1, 2];
+custom[Symbol.iterator] = function* () {
+  yield 42;
+  yield 43;
+};
+assertEquals([42, 43], destructure_custom(custom));
+assertEquals([1, 2], destructure_custom([1, 2]));
@@ -0,0 +1,135 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+// String.prototype.charAt in-bounds.
+(function() {
+  function foo(s, i) {
+    return s.charAt(i);
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals("b", foo("abc", 1));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals("b", foo("abc", 1));
+  assertEquals("a", foo("abc", 0));
+  assertEquals("c", foo("abc", 2));
+})();
+
+// charAt with no argument defaults to index 0.
+(function() {
+  function foo(s) {
+    return s.charAt();
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals("a", foo("abc"));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals("a", foo("abc"));
+})();
+
+// Out-of-bounds charAt returns the empty string via the deopt path.
+(function() {
+  function foo(s, i) {
+    return s.charAt(i);
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals("b", foo("abc", 1));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals("b", foo("abc", 1));
+  assertEquals("", foo("abc", 3));
+  assertEquals("", foo("abc", -1));
+  assertEquals("", foo("", 0));
+})();
+
+// A non-string receiver deopts and still returns the right answer.
+(function() {
+  function foo(s) {
+    return s.charAt(1);
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals("b", foo("abc"));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals("b", foo("abc"));
+  assertEquals("b", foo(new String("abc")));
+  assertEquals(
+      "y", foo({charAt: String.prototype.charAt, toString() { return "xyz"; }}));
+})();
+
+// String.prototype.indexOf with a constant search string.
+(function() {
+  function foo(s) {
+    return s.indexOf("lo");
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo("hello"));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(3, foo("hello"));
+  assertEquals(-1, foo("help"));
+  assertEquals(0, foo("lolo"));
+})();
+
+// indexOf with a non-string receiver deopts gracefully.
+(function() {
+  function foo(s) {
+    return s.indexOf("2");
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo("123"));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(1, foo("123"));
+  assertEquals(1, foo(new String("123")));
+})();
+
+// String.prototype.startsWith with constant literals at the inlining
+// boundary lengths: the empty string and three characters.
+(function() {
+  function startsEmpty(s) {
+    return s.startsWith("");
+  }
+  function startsThree(s) {
+    return s.startsWith("abc");
+  }
+  %PrepareFunctionForOptimization(startsEmpty);
+  %PrepareFunctionForOptimization(startsThree);
+  assertTrue(startsEmpty("x"));
+  assertTrue(startsThree("abcd"));
+  %OptimizeMaglevOnNextCall(startsEmpty);
+  %OptimizeMaglevOnNextCall(startsThree);
+  assertTrue(startsEmpty("x"));
+  assertTrue(startsEmpty(""));
+  assertTrue(startsThree("abcd"));
+  assertTrue(startsThree("abc"));
+  assertFalse(startsThree("ab"));
+  assertFalse(startsThree(""));
+  assertFalse(startsThree("abd"));
+  assertFalse(startsThree("xbc"));
+})();
+
+// startsWith against cons and two-byte receivers.
+(function() {
+  function foo(s) {
+    return s.startsWith("my");
+  }
+  %PrepareFunctionForOptimization(foo);
+  let cons = "my";
+  cons += " string";
+  assertTrue(foo(cons));
+  %OptimizeMaglevOnNextCall(foo);
+  assertTrue(foo(cons));
+  assertTrue(foo("my ⚡tring"));
+  assertFalse(foo("⚡y string"));
+})();
+
+// startsWith with a non-string receiver deopts gracefully.
+(function() {
+  function foo(s) {
+    return s.startsWith("1");
+  }
+  %PrepareFunctionForOptimization(foo);
+  assertTrue(foo("12"));
+  %OptimizeMaglevOnNextCall(foo);
+  assertTrue(foo("12"));
+  assertTrue(foo(new String("12")));
+  assertFalse(foo(new String("21")));
+})();
@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Repeatedly cloned literals take a block-copy fast path once their
+// boilerplate is classified as flat; every clone must still be independent.
+
+function makeFlat() {
+  return {a: 1, b: 'two', c: true, d: null};
+}
+
+function makeDouble() {
+  return {x: 1.5, y: 2.5};
+}
+
+function makeNested() {
+  return {inner: {value: 1}, list: [1, 2, 3]};
+}
+
+function makeFlatArray() {
+  return [1, 2, 3, 4];
+}
+
+function makeObjectArray() {
+  return [{n: 1}, {n: 2}];
+}
+
+for (let i = 0; i < 100; i++) {
+  const flat = makeFlat();
+  flat.a = i;
+  assertEquals(1, makeFlat().a);
+  assertEquals('two', flat.b);
+
+  // Mutable double fields must not be shared between clones.
+  const d1 = makeDouble();
+  const d2 = makeDouble();
+  d1.x = i + 0.25;
+  assertEquals(1.5, d2.x);
+  assertEquals(2.5, d2.y);
+
+  // Nested objects and element-held objects must be deep-copied.
+  const n1 = makeNested();
+  const n2 = makeNested();
+  n1.inner.value = i;
+  n1.list[0] = i;
+  assertEquals(1, n2.inner.value);
+  assertEquals(1, n2.list[0]);
+
+  const a1 = makeFlatArray();
+  a1[2] = i;
+  assertEquals(3, makeFlatArray()[2]);
+
+  const o1 = makeObjectArray();
+  o1[0].n = i;
+  assertEquals(1, makeObjectArray()[0].n);
+}
+
+// A boilerplate whose elements transition after classification still clones
+// correctly.
+function makeTransitioning() {
+  return [1, 2, 3];
+}
+for (let i = 0; i < 20; i++) makeTransitioning();
+const t = makeTransitioning();
+t[0] = 0.5;  // Transitions the site to double elements.
+for (let i = 0; i < 20; i++) {
+  const u = makeTransitioning();
+  u[1] = i + 0.5;
+  assertEquals(2, makeTransitioning()[1]);
+}
@@ -0,0 +1,134 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Tests for copying data properties from plain objects via object spread,
+// covering the batched fast path and its bail-outs.
+
+// A plain fast source produces a detached fast clone, and the clone's shape
+// depends only on the property set, not on how the source was built.
+(function testPlainClone() {
+  var src1 = {a: 1, b: 2, c: 3};
+  var src2 = {};
+  src2.a = 1;
+  src2.b = 2;
+  src2.c = 3;
+  var clone1 = {...src1};
+  var clone2 = {...src2};
+  assertEquals(['a', 'b', 'c'], Object.keys(clone1));
+  assertEquals(1, clone1.a);
+  assertEquals(2, clone1.b);
+  assertEquals(3, clone1.c);
+  assertTrue(%HasFastProperties(clone1));
+  assertTrue(%HaveSameMap(clone1, clone2));
+  clone1.a = 42;
+  assertEquals(1, src1.a);
+  delete clone1.b;
+  assertEquals(2, src1.b);
+})();
+
+// Mixed representations survive the copy and later generalizing stores.
+(function testRepresentations() {
+  var src = {smi: 1, dbl: 2.5, str: 'x', obj: {nested: true}};
+  var clone = {...src};
+  assertEquals(1, clone.smi);
+  assertEquals(2.5, clone.dbl);
+  assertEquals('x', clone.str);
+  assertTrue(clone.obj === src.obj);
+  clone.smi = 1.5;
+  assertEquals(1.5, clone.smi);
+  assertEquals(1, src.smi);
+  clone.dbl = 'now a string';
+  assertEquals(2.5, src.dbl);
+})();
+
+// Accessors on the source are read through, once per clone, and turn into
+// plain writable data properties.
+(function testAccessorSource() {
+  var log = [];
+  var src = {
+    a: 1,
+    get b() { log.push('b'); return 2; },
+    c: 3
+  };
+  var clone = {...src};
+  assertEquals(['b'], log);
+  assertEquals([1, 2, 3], [clone.a, clone.b, clone.c]);
+  var desc = Object.getOwnPropertyDescriptor(clone, 'b');
+  assertEquals(2, desc.value);
+  assertTrue(desc.writable);
+  assertEquals(undefined, desc.get);
+})();
+
+// A getter that mutates the source mid-copy: later keys observe the
+// mutation, exactly like a key-by-key copy.
+(function testMutatingGetter() {
+  var src = {
+    a: 1,
+    get b() { src.c = 99; return 2; },
+    c: 3
+  };
+  var clone = {...src};
+  assertEquals(1, clone.a);
+  assertEquals(2, clone.b);
+  assertEquals(99, clone.c);
+})();
+
+// Symbol keys are copied with their values and keep the string-then-symbol
+// own-key ordering on the clone.
+(function testSymbolKeys() {
+  var sym = Symbol('s');
+  var src = {};
+  src[sym] = 1;
+  src.a = 2;
+  src.b = 3;
+  var clone = {...src};
+  assertEquals(['a', 'b', sym], Reflect.ownKeys(clone));
+  assertEquals(1, clone[sym]);
+  assertEquals(2, clone.a);
+  assertEquals(3, clone.b);
+})();
+
+// Non-enumerable properties are not copied.
+(function testNonEnumerable() {
+  var src = {a: 1};
+  Object.defineProperty(src, 'hidden', {value: 2, enumerable: false});
+  var clone = {...src};
+  assertFalse('hidden' in clone);
+  assertEquals(['a'], Object.keys(clone));
+})();
+
+// Enough properties to spill out of the in-object area.
+(function testManyProperties() {
+  var src = {};
+  for (var i = 0; i < 100; i++) src['p' + i] = i;
+  assertTrue(%HasFastProperties(src));
+  var clone = {...src};
+  for (var i = 0; i < 100; i++) assertEquals(i, clone['p' + i]);
+  assertEquals(100, Object.keys(clone).length);
+  clone.p0 = -1;
+  assertEquals(0, src.p0);
+})();
+
+// A very wide literal source; the clone may legitimately fall back to
+// dictionary mode, but must still carry every property.
+(function testHugeLiteral() {
+  var code = '({';
+  for (var i = 0; i < 240; i++) code += 'q' + i + ':' + i + ',';
+  code += '})';
+  var src = eval(code);
+  var clone = {...src};
+  for (var i = 0; i < 240; i++) assertEquals(i, clone['q' + i]);
+  assertEquals(240, Object.keys(clone).length);
+})();
+
+// Spreading into a null-prototype literal.
+(function testNullProtoTarget() {
+  var src = {a: 1, b: 2};
+  var clone = {__proto__: null, ...src};
+  assertEquals(null, Object.getPrototypeOf(clone));
+  assertEquals(1, clone.a);
+  assertEquals(2, clone.b);
+})();
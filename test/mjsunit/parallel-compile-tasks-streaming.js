@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --stress-background-compile --parallel-compile-tasks-for-streaming
+
+// Lazy top-level functions of a streamed script are speculatively compiled
+// on dispatcher threads; calling them afterwards must observe the same
+// behavior as a regular lazy compile.
+
+var outer_var = 42;
+
+function lazy_toplevel() {
+  return outer_var;
+}
+
+function lazy_with_inner() {
+  function inner(a) {
+    return a + 1;
+  }
+  return inner(outer_var);
+}
+
+var lazy_arrow = (a, b) => a + b;
+
+var lazy_generator = function*() {
+  yield 1;
+  yield 2;
+};
+
+assertEquals(42, lazy_toplevel());
+assertEquals(43, lazy_with_inner());
+assertEquals(3, lazy_arrow(1, 2));
+
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+// Functions that are never called should also survive being enqueued.
+function lazy_never_called() {
+  class foo {}
+  return new foo();
+}
@@ -0,0 +1,138 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Tests for IC'ed property loads through proxies with a "get" trap: the
+// LoadIC may cache the location of the trap on the handler object, so every
+// way the cached information can go stale must be covered.
+
+function WarmLoad(p) {
+  var r;
+  for (var i = 0; i < 10; i++) r = p.x;
+  return r;
+}
+
+(function testBasicTrap() {
+  var trapArgs;
+  var target = {x: 'from-target'};
+  var handler = {
+    get(t, name, receiver) {
+      trapArgs = [t, name, receiver];
+      return 'from-trap';
+    }
+  };
+  var p = new Proxy(target, handler);
+  assertEquals('from-trap', WarmLoad(p));
+  assertSame(target, trapArgs[0]);
+  assertEquals('x', trapArgs[1]);
+  assertSame(p, trapArgs[2]);
+})();
+
+// Overwriting the trap with another function must be observed: only the
+// trap's location may be cached, never its value.
+(function testTrapOverwrite() {
+  var handler = {get() { return 1; }};
+  var p = new Proxy({}, handler);
+  assertEquals(1, WarmLoad(p));
+  handler.get = function() { return 2; };
+  assertEquals(2, WarmLoad(p));
+})();
+
+// Overwriting the trap with a non-callable throws, warm or cold.
+(function testTrapOverwrittenNonCallable() {
+  var handler = {get() { return 1; }};
+  var p = new Proxy({}, handler);
+  assertEquals(1, WarmLoad(p));
+  handler.get = 42;
+  assertThrows(() => p.x, TypeError);
+  assertThrows(() => WarmLoad(p), TypeError);
+})();
+
+// Overwriting the trap with undefined falls through to the target.
+(function testTrapOverwrittenUndefined() {
+  var handler = {get() { return 'trapped'; }};
+  var p = new Proxy({x: 'direct'}, handler);
+  assertEquals('trapped', WarmLoad(p));
+  handler.get = undefined;
+  assertEquals('direct', WarmLoad(p));
+})();
+
+// Deleting the trap changes the handler's shape; loads forward to the
+// target afterwards.
+(function testTrapDeleted() {
+  var handler = {get() { return 'trapped'; }};
+  var p = new Proxy({x: 'direct'}, handler);
+  assertEquals('trapped', WarmLoad(p));
+  delete handler.get;
+  assertEquals('direct', WarmLoad(p));
+})();
+
+// Revoking the proxy must throw on the next load.
+(function testRevocation() {
+  var {proxy, revoke} = Proxy.revocable({}, {get() { return 1; }});
+  assertEquals(1, WarmLoad(proxy));
+  revoke();
+  assertThrows(() => proxy.x, TypeError);
+  assertThrows(() => WarmLoad(proxy), TypeError);
+})();
+
+// A site that sees proxies with differently shaped handler objects keeps
+// returning the right answers once the specialized handler gives up.
+(function testHandlerShapeThrash() {
+  function load(p) { return p.x; }
+  var proxies = [];
+  for (var i = 0; i < 8; i++) {
+    var handler = {};
+    handler['pad' + i] = i;
+    handler.get = (function(n) { return function() { return n; }; })(i);
+    proxies.push(new Proxy({}, handler));
+  }
+  for (var round = 0; round < 5; round++) {
+    for (var i = 0; i < proxies.length; i++) {
+      assertEquals(i, load(proxies[i]));
+    }
+  }
+})();
+
+// Has ICs use the "has" trap and must not call the cached "get" trap.
+(function testHasFallThrough() {
+  var getCalls = 0;
+  var hasCalls = 0;
+  var handler = {
+    get() { getCalls++; return 1; },
+    has() { hasCalls++; return true; }
+  };
+  var p = new Proxy({}, handler);
+  assertEquals(1, WarmLoad(p));
+  getCalls = 0;
+  var seen;
+  for (var i = 0; i < 10; i++) seen = 'x' in p;
+  assertTrue(seen);
+  assertEquals(0, getCalls);
+  assertEquals(10, hasCalls);
+})();
+
+// The trap invariants still hold when the IC dispatches the trap call: a
+// non-configurable non-writable data property on the target pins the result.
+(function testInvariantCheck() {
+  var target = {};
+  Object.defineProperty(target, 'x', {value: 7, writable: false});
+  var handler = {get() { return 8; }};
+  var p = new Proxy(target, handler);
+  assertThrows(() => p.x, TypeError);
+  assertThrows(() => WarmLoad(p), TypeError);
+})();
+
+// A proxy in the prototype chain (not the lookup start object) keeps
+// trapping loads of properties the receiver does not have.
+(function testProxyOnPrototypeChain() {
+  var p = new Proxy({}, {get(t, name) { return 'proto:' + name; }});
+  var o = Object.create(p);
+  o.own = 1;
+  function load(obj) { return [obj.own, obj.x]; }
+  for (var i = 0; i < 10; i++) {
+    assertEquals([1, 'proto:x'], load(o));
+  }
+})();
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-quantifier-limit=64
+
+// The 'd' (hasIndices) flag only affects how results are built and doesn't
+// prevent linear execution.
+{
+  let re = /(a)(b)?c/d;
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(re));
+  let result = re.exec("xacx");
+  assertArrayEquals(["ac", "a", undefined], result);
+  assertArrayEquals([1, 3], result.indices[0]);
+  assertArrayEquals([1, 2], result.indices[1]);
+  assertEquals(undefined, result.indices[2]);
+}
+
+// 'd' combined with an explicit 'l' flag must not throw.
+{
+  let re = new RegExp("a(b)", "dl");
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(re));
+  assertArrayEquals([1, 2], re.exec("xab").indices[1]);
+}
+
+// Counted repetition within the configured replication budget runs on the
+// linear engine; the default budget of 16 would reject this pattern.
+{
+  let re = /a{20}b/;
+  assertEquals("EXPERIMENTAL", %RegexpTypeTag(re));
+  assertEquals("a".repeat(20) + "b", re.exec("x" + "a".repeat(25) + "b")[0]);
+}
+
+// Nested repetition whose total replication exceeds the budget falls back to
+// the backtracking engines but still matches.
+{
+  let re = /(?:a{10}){10}/;
+  assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(re));
+  assertTrue(re.test("a".repeat(100)));
+}
+
+// Backreferences remain ineligible.
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(a*)\1/));
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --lazy-regexp-result-groups
+
+// Basic named captures.
+{
+  const m = /(?<year>\d{4})-(?<month>\d{2})/.exec("2024-08-31");
+  assertEquals("2024", m.groups.year);
+  assertEquals("08", m.groups.month);
+  // The groups object is cached after the first access.
+  assertSame(m.groups, m.groups);
+  assertEquals(null, Object.getPrototypeOf(m.groups));
+}
+
+// No named captures yields undefined, matching the eager behavior.
+{
+  const m = /(\d{4})-(\d{2})/.exec("2024-08-31");
+  assertEquals(undefined, m.groups);
+}
+
+// Unmatched named groups are present with value undefined.
+{
+  const m = /(?<a>x)|(?<b>y)/.exec("y");
+  assertEquals(undefined, m.groups.a);
+  assertEquals("y", m.groups.b);
+  assertTrue("a" in m.groups);
+}
+
+// Replacement via $<name> reads the groups object.
+{
+  assertEquals("08/2024",
+               "2024-08".replace(/(?<y>\d{4})-(?<m>\d{2})/, "$<m>/$<y>"));
+}
+
+// String.prototype.matchAll results.
+{
+  const matches = [..."a1b2".matchAll(/(?<char>[ab])(?<digit>\d)/g)];
+  assertEquals(2, matches.length);
+  assertEquals("a", matches[0].groups.char);
+  assertEquals("2", matches[1].groups.digit);
+}
+
+// Assigning to groups reconfigures it to a plain data property.
+{
+  const m = /(?<x>a)/.exec("a");
+  m.groups = 42;
+  assertEquals(42, m.groups);
+}
+
+// The /d flag still produces eager indices alongside lazy groups.
+{
+  const m = /(?<x>a)(?<y>b)/d.exec("ab");
+  assertEquals([0, 1], m.indices.groups.x);
+  assertEquals("a", m.groups.x);
+  assertEquals("b", m.groups.y);
+}
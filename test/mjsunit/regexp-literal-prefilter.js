@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-literal-prefilter
+
+// Patterns with a mandatory literal substring; the prefilter must not change
+// observable behavior for hits or misses.
+assertFalse(/foo\d+bar/.test("a".repeat(1000)));
+assertTrue(/foo\d+bar/.test("xxfoo123barxx"));
+assertEquals(2, "xxfoo123barxx".match(/foo\d+bar/).index);
+
+// The literal can come from inside a capture group or a non-optional
+// quantifier body.
+assertFalse(/(needle)+\d/.test("haystack without it"));
+assertTrue(/(needle)+\d/.test("xneedleneedle7"));
+
+// Optional parts and disjunctions must not be treated as mandatory.
+assertTrue(/(?:maybe)?x/.test("x"));
+assertTrue(/(?:foo|x)/.test("x"));
+
+// Global matching finds all occurrences.
+assertEquals(["ab1", "ab2"], "ab1 cd ab2".match(/ab\d/g));
+assertNull("cd cd cd".match(/ab\d/g));
+
+// Sticky and anchored patterns.
+assertFalse(/^foo\d/.test("barfoo1"));
+assertTrue(/^foo\d/.test("foo1bar"));
+
+// Ignore-case patterns take no prefilter and still match.
+assertTrue(/foo\d/i.test("xFOO1"));
+
+// Two-byte subjects and needles.
+assertTrue(/πρ\d/.test("xxπρ9"));
+assertFalse(/πρ\d/.test("xxπ9"));
+
+// Matching after lastIndex only searches the remaining subject.
+let re = /ab\d/g;
+re.lastIndex = 4;
+assertEquals("ab2", re.exec("ab1 ab2")[0]);
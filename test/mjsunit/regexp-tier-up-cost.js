@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tier-up driven by the subject-length-weighted cost model instead of a
+// fixed execution count.
+// Flags: --regexp-tier-up --regexp-tier-up-cost=100
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+// Flags: --no-enable-experimental-regexp-engine
+
+const kLatin1 = true;
+
+// A pattern executed a few times on short subjects stays interpreted, since
+// the accumulated subject characters are below the cost threshold.
+let cheap = /a./;
+cheap.test("ab");
+assertTrue(%RegexpHasBytecode(cheap, kLatin1));
+for (let i = 0; i < 10; i++) cheap.test("ab");
+assertTrue(%RegexpHasBytecode(cheap, kLatin1));
+assertFalse(%RegexpHasNativeCode(cheap, kLatin1));
+
+// Execution stats track executions and interpreted subject characters.
+let stats = %RegexpExecStats(cheap);
+assertEquals(11, stats[0]);
+assertEquals(22, stats[1]);
+
+// Once the cumulative interpreted characters exceed the threshold, the next
+// execution runs native code.
+let hot = /b./;
+for (let i = 0; i < 51; i++) hot.test("bc");  // 102 chars > 100.
+assertTrue(%RegexpHasNativeCode(hot, kLatin1));
+
+// A single execution over a long subject is enough to cross the threshold.
+let longSubject = /c./;
+longSubject.test("cd".repeat(51));
+longSubject.test("cd");
+assertTrue(%RegexpHasNativeCode(longSubject, kLatin1));
+
+// Atom regexps have no irregexp stats.
+assertEquals(undefined, %RegexpExecStats(/abc/));
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct
+
+'use strict';
+
+if (this.Worker) {
+  (function TestSharedMapPostMessage() {
+    let workerScript = `onmessage = function(map) {
+         SharedMap.set(map, 'worker', 'hello');
+         for (let i = 0; i < 100; i++) {
+           SharedMap.set(map, 'worker' + i, i);
+         }
+         postMessage("done");
+       };
+       postMessage("started");`;
+
+    let worker = new Worker(workerScript, {type: 'string'});
+    assertEquals('started', worker.getMessage());
+
+    let map = new SharedMap();
+    SharedMap.set(map, 'main', 'ping');
+    worker.postMessage(map);
+    assertEquals('done', worker.getMessage());
+
+    // Writes made by the worker are visible here without any copying.
+    assertEquals('hello', SharedMap.get(map, 'worker'));
+    for (let i = 0; i < 100; i++) {
+      assertEquals(i, SharedMap.get(map, 'worker' + i));
+    }
+    assertEquals('ping', SharedMap.get(map, 'main'));
+
+    worker.terminate();
+  })();
+}
@@ -0,0 +1,92 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct
+
+'use strict';
+
+(function TestNoPrototype() {
+  // Like the other shared objects, shared maps don't have a prototype.
+  assertNull(Object.getPrototypeOf(new SharedMap()));
+
+  assertNull(SharedMap.prototype);
+
+  assertThrows(() => {
+    SharedMap.prototype = {};
+  });
+})();
+
+(function TestIsSharedMap() {
+  assertTrue(SharedMap.isSharedMap(new SharedMap()));
+  assertFalse(SharedMap.isSharedMap(new Map()));
+  assertFalse(SharedMap.isSharedMap({}));
+})();
+
+(function TestGetSetHasDelete() {
+  let map = new SharedMap();
+  assertFalse(SharedMap.has(map, 'a'));
+  assertEquals(undefined, SharedMap.get(map, 'a'));
+
+  SharedMap.set(map, 'a', 42);
+  assertTrue(SharedMap.has(map, 'a'));
+  assertEquals(42, SharedMap.get(map, 'a'));
+
+  // Overwrite.
+  SharedMap.set(map, 'a', 'foo');
+  assertEquals('foo', SharedMap.get(map, 'a'));
+
+  assertTrue(SharedMap.delete(map, 'a'));
+  assertFalse(SharedMap.delete(map, 'a'));
+  assertFalse(SharedMap.has(map, 'a'));
+})();
+
+(function TestManyKeys() {
+  // Grow the stripes past their initial capacities.
+  let map = new SharedMap();
+  for (let i = 0; i < 256; i++) {
+    SharedMap.set(map, 'key' + i, i);
+  }
+  for (let i = 0; i < 256; i++) {
+    assertEquals(i, SharedMap.get(map, 'key' + i));
+  }
+})();
+
+(function TestPrimitiveValues() {
+  let test_values =
+      [42, -0, Math.random(), undefined, null, true, false, 'foo'];
+  let map = new SharedMap();
+  let i = 0;
+  for (let prim of test_values) {
+    SharedMap.set(map, 'k' + i, prim);
+    assertEquals(prim, SharedMap.get(map, 'k' + i));
+    i++;
+  }
+})();
+
+(function TestSharedValues() {
+  let map = new SharedMap();
+  // Shared objects cannot point to non-shared objects.
+  assertThrows(() => {
+    SharedMap.set(map, 'a', []);
+  });
+  assertThrows(() => {
+    SharedMap.set(map, 'b', {});
+  });
+  // Shared values are fine, including nested shared maps.
+  SharedMap.set(map, 'arr', new SharedArray(1));
+  SharedMap.set(map, 'map', new SharedMap());
+  assertTrue(SharedMap.isSharedMap(SharedMap.get(map, 'map')));
+})();
+
+(function TestNonStringKeysThrow() {
+  let map = new SharedMap();
+  assertThrows(() => SharedMap.get(map, 1), TypeError);
+  assertThrows(() => SharedMap.set(map, Symbol(), 1), TypeError);
+  assertThrows(() => SharedMap.has(map, {}), TypeError);
+})();
+
+(function TestWrongReceiverThrows() {
+  assertThrows(() => SharedMap.get({}, 'a'), TypeError);
+  assertThrows(() => SharedMap.set(new Map(), 'a', 1), TypeError);
+})();
@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// %StringArrayToFloat64Array converts an array of strings in one runtime
+// call; each element must agree with Number().
+
+function check(strings) {
+  const result = %StringArrayToFloat64Array(strings);
+  assertInstanceof(result, Float64Array);
+  assertEquals(strings.length, result.length);
+  for (let i = 0; i < strings.length; i++) {
+    assertEquals(Number(strings[i]), result[i], strings[i]);
+  }
+}
+
+check([]);
+check(['0', '-0', '123', '-42.5', '.5', '1.', '3.141592653589793']);
+check(['12345678', '123456789', '12345678.12345678', '25e9', '1e22',
+       '1e-22', '1e23', '1e-300', '9007199254740993']);
+check(['', ' ', '  1.5  ', '0x10', '0o17', '0b101', 'Infinity',
+       '-Infinity', 'NaN', 'junk', '1.5x', '12345678901234567890']);
+
+// -0 must survive the round trip.
+assertEquals(-Infinity, 1 / %StringArrayToFloat64Array(['-0'])[0]);
+
+// Arrays the fast path cannot handle make it return undefined so callers can
+// fall back to element-wise conversion.
+assertEquals(undefined, %StringArrayToFloat64Array(['1', , '3']));
+assertEquals(undefined, %StringArrayToFloat64Array(['1', 2, '3']));
+assertEquals(undefined, %StringArrayToFloat64Array([1.5, 2.5]));
@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The Float64Array join fast path serializes the whole array in one runtime
+// call; compare it against element-wise stringification.
+
+(function TestBasic() {
+  const array = new Float64Array([1, 2.5, -3, 0.1]);
+  assertEquals('1,2.5,-3,0.1', array.join());
+  assertEquals('12.5-30.1', array.join(''));
+  assertEquals('1--2.5---3--0.1', array.join('--'));
+})();
+
+(function TestSpecialValues() {
+  const array = new Float64Array([NaN, Infinity, -Infinity, -0, 1e21, 1e-7]);
+  assertEquals('NaN,Infinity,-Infinity,0,1e+21,1e-7', array.join());
+})();
+
+(function TestEmptyAndSingle() {
+  assertEquals('', new Float64Array(0).join());
+  assertEquals('42', new Float64Array([42]).join());
+})();
+
+(function TestMatchesElementWise() {
+  const array = new Float64Array(1000);
+  for (let i = 0; i < array.length; i++) array[i] = i * 1.25;
+  const expected = Array.from(array).map(String).join(';');
+  assertEquals(expected, array.join(';'));
+})();
+
+(function TestTwoByteSeparator() {
+  // A two-byte separator takes the element-wise fallback path.
+  const array = new Float64Array([1.5, 2.5]);
+  assertEquals('1.5€2.5', array.join('€'));
+})();
+
+(function TestSeparatorToStringDetaches() {
+  const rab = new ArrayBuffer(8 * 4);
+  const array = new Float64Array(rab);
+  array.fill(1.5);
+  const separator = {
+    toString() {
+      %ArrayBufferDetach(rab);
+      return ',';
+    }
+  };
+  // After detaching, all elements read as undefined and stringify to ''.
+  assertEquals(',,,', array.join(separator));
+})();
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The Float64Array map fast path computes Math.sin/cos/exp in one batched
+// runtime call; its results must be indistinguishable from element-wise
+// invocation of the builtin.
+
+(function TestMatchesElementWise() {
+  const array = new Float64Array(256);
+  for (let i = 0; i < array.length; i++) array[i] = (i - 128) * 0.1;
+  for (const fn of [Math.sin, Math.cos, Math.exp]) {
+    const mapped = array.map(fn);
+    assertInstanceof(mapped, Float64Array);
+    assertEquals(array.length, mapped.length);
+    for (let i = 0; i < array.length; i++) {
+      assertEquals(fn(array[i]), mapped[i]);
+    }
+  }
+})();
+
+(function TestSpecialValues() {
+  const array = new Float64Array([NaN, Infinity, -Infinity, -0, 0, 1e308]);
+  for (const fn of [Math.sin, Math.cos, Math.exp]) {
+    const mapped = array.map(fn);
+    for (let i = 0; i < array.length; i++) {
+      assertEquals(fn(array[i]), mapped[i]);
+    }
+  }
+})();
+
+(function TestEmpty() {
+  const mapped = new Float64Array(0).map(Math.sin);
+  assertInstanceof(mapped, Float64Array);
+  assertEquals(0, mapped.length);
+})();
+
+(function TestOtherCallbacksStillWork() {
+  const array = new Float64Array([1, 2, 3]);
+  assertEquals(new Float64Array([2, 4, 6]), array.map(x => x * 2));
+  // A non-batched Math builtin takes the generic path.
+  assertEquals(new Float64Array([1, 2, 3]), array.map(Math.abs));
+})();
+
+(function TestCustomSpecies() {
+  // A custom @@species constructor invalidates the protector; the generic
+  // path must honor it.
+  class MyFloat64Array extends Float64Array {}
+  const array = new MyFloat64Array([0.5]);
+  const mapped = array.map(Math.sin);
+  assertInstanceof(mapped, MyFloat64Array);
+  assertEquals(Math.sin(0.5), mapped[0]);
+})();
@@ -0,0 +1,52 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-array-sort
+
+// Large enough to take the parallel sort path in Runtime_TypedArraySortFast.
+const kLength = 1 << 20;
+
+(function TestFloat64() {
+  const array = new Float64Array(kLength);
+  let seed = 1;
+  for (let i = 0; i < kLength; i++) {
+    // Simple LCG; includes negative values and fractions.
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    array[i] = (seed - 1073741824) / 65536;
+  }
+  array[0] = NaN;
+  array[1] = -0;
+  array[2] = 0;
+  array.sort();
+  for (let i = 1; i < kLength; i++) {
+    // NaNs sort to the end; everything before is ordered.
+    if (Number.isNaN(array[i])) {
+      assertEquals(kLength - 1, i);
+      break;
+    }
+    assertTrue(array[i - 1] <= array[i]);
+  }
+  assertTrue(Number.isNaN(array[kLength - 1]));
+})();
+
+(function TestInt32() {
+  const array = new Int32Array(kLength);
+  let seed = 42;
+  for (let i = 0; i < kLength; i++) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    array[i] = seed - 1073741824;
+  }
+  array.sort();
+  for (let i = 1; i < kLength; i++) {
+    assertTrue(array[i - 1] <= array[i]);
+  }
+})();
+
+(function TestWithComparatorUnaffected() {
+  const array = new Int32Array(kLength);
+  for (let i = 0; i < kLength; i++) array[i] = kLength - i;
+  array.sort((a, b) => b - a);
+  assertEquals(kLength, array[0]);
+  assertEquals(1, array[kLength - 1]);
+})();
@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests of URI encoding and decoding on long strings, exercising the
+// block-at-a-time fast paths for one-byte strings.
+
+function roundtrip(string) {
+  assertEquals(string, decodeURIComponent(encodeURIComponent(string)));
+  assertEquals(string, decodeURI(encodeURI(string)));
+}
+
+// Long fully-clean spans of every length around the 16-byte block size.
+for (let length = 1; length < 70; length++) {
+  const clean = 'a'.repeat(length);
+  assertEquals(clean, encodeURIComponent(clean));
+  assertEquals(clean, decodeURIComponent(clean));
+  roundtrip(clean);
+}
+
+// A character needing escaping at every position of a clean span.
+for (let position = 0; position < 40; position++) {
+  const string = 'a'.repeat(position) + ' ' + 'b'.repeat(40 - position);
+  const encoded = 'a'.repeat(position) + '%20' + 'b'.repeat(40 - position);
+  assertEquals(encoded, encodeURIComponent(string));
+  assertEquals(string, decodeURIComponent(encoded));
+}
+
+// An escape sequence at every position of a long decode input.
+for (let position = 0; position < 40; position++) {
+  const encoded = 'x'.repeat(position) + '%2F' + 'y'.repeat(40 - position);
+  const decoded = 'x'.repeat(position) + '/' + 'y'.repeat(40 - position);
+  assertEquals(decoded, decodeURIComponent(encoded));
+}
+
+// encodeURI leaves separators alone where encodeURIComponent escapes them.
+const separators = '#:;/?$&+,@=';
+const mixed = 'a'.repeat(20) + separators + 'b'.repeat(20);
+assertEquals(mixed, encodeURI(mixed));
+assertEquals('a'.repeat(20) + '%23%3A%3B%2F%3F%24%26%2B%2C%40%3D' +
+                 'b'.repeat(20),
+             encodeURIComponent(mixed));
+
+// decodeURI keeps reserved characters escaped.
+assertEquals('x'.repeat(20) + '%2F' + 'y'.repeat(20),
+             decodeURI('x'.repeat(20) + '%2F' + 'y'.repeat(20)));
+
+// Latin-1 characters above 0x7F take the two-byte UTF-8 encoding and, on
+// decode, divert a one-byte input to the two-byte path.
+const latin1 = 'a'.repeat(30) + 'é' + 'b'.repeat(30);
+assertEquals('a'.repeat(30) + '%C3%A9' + 'b'.repeat(30),
+             encodeURIComponent(latin1));
+roundtrip(latin1);
+
+// Two-byte strings still work and agree with the one-byte path on the
+// ASCII-only suffix.
+const twoByte = 'ሴ' + 'a'.repeat(30) + ' ' + 'b'.repeat(30);
+roundtrip(twoByte);
+assertEquals(encodeURIComponent('a'.repeat(30) + ' ' + 'b'.repeat(30)),
+             encodeURIComponent(twoByte).slice('%E1%88%B4'.length));
+
+// Malformed escape sequences throw, wherever they sit in a long string.
+assertThrows(() => decodeURIComponent('a'.repeat(40) + '%'), URIError);
+assertThrows(() => decodeURIComponent('a'.repeat(40) + '%G0'), URIError);
+assertThrows(() => decodeURIComponent('a'.repeat(40) + '%E1%88'), URIError);
@@ -0,0 +1,93 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+
+using IsolatePoolTest = TestWithPlatform;
+
+namespace {
+
+int32_t RunInt32(Isolate* isolate, const char* source) {
+  Isolate::Scope isolate_scope(isolate);
+  HandleScope handle_scope(isolate);
+  Local<Context> context = Context::New(isolate);
+  Context::Scope context_scope(context);
+  Local<Script> script =
+      Script::Compile(context,
+                      String::NewFromUtf8(isolate, source).ToLocalChecked())
+          .ToLocalChecked();
+  return script->Run(context)
+      .ToLocalChecked()
+      ->Int32Value(context)
+      .FromJust();
+}
+
+}  // namespace
+
+TEST_F(IsolatePoolTest, ReuseAfterRelease) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  IsolatePool pool(params, 2);
+  pool.Prewarm(1);
+
+  Isolate* isolate = pool.Acquire();
+  EXPECT_EQ(6 * 7, RunInt32(isolate, "6 * 7"));
+  EXPECT_TRUE(pool.Release(isolate));
+
+  // The released isolate is handed out again and is fully usable.
+  Isolate* reused = pool.Acquire();
+  EXPECT_EQ(isolate, reused);
+  EXPECT_EQ(4, RunInt32(reused, "2 + 2"));
+  EXPECT_TRUE(pool.Release(reused));
+}
+
+TEST_F(IsolatePoolTest, AcquireFromEmptyPool) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  IsolatePool pool(params, 1);
+
+  // Without prewarming, Acquire falls back to creating a fresh isolate.
+  Isolate* isolate = pool.Acquire();
+  EXPECT_EQ(3, RunInt32(isolate, "1 + 2"));
+  EXPECT_TRUE(pool.Release(isolate));
+}
+
+TEST_F(IsolatePoolTest, ReleaseFailsWhenContextSurvives) {
+  std::unique_ptr<ArrayBuffer::Allocator> allocator(
+      ArrayBuffer::Allocator::NewDefaultAllocator());
+  Isolate::CreateParams params;
+  params.array_buffer_allocator = allocator.get();
+  IsolatePool pool(params, 1);
+
+  Isolate* isolate = pool.Acquire();
+  {
+    Isolate::Scope isolate_scope(isolate);
+    HandleScope handle_scope(isolate);
+    Local<Context> context = Context::New(isolate);
+    // Keep the context alive past Release(). The Global is deliberately
+    // leaked: Release() disposes the isolate, after which the handle must
+    // never be touched again.
+    new Global<Context>(isolate, context);
+  }
+  // The surviving context fails the reset verification and the isolate is
+  // disposed instead of being pooled.
+  EXPECT_FALSE(pool.Release(isolate));
+}
+
+}  // namespace v8
@@ -50,6 +50,37 @@ TEST(Mutex, LockGuardLazyRecursiveMutex) {
 }
 
 
+TEST(Mutex, LockGuardAdaptiveMutex) {
+  AdaptiveMutex adaptive_mutex;
+  { AdaptiveMutexGuard lock_guard(&adaptive_mutex); }
+  { AdaptiveMutexGuard lock_guard(&adaptive_mutex); }
+  EXPECT_EQ(0u, adaptive_mutex.contended_locks());
+}
+
+TEST(Mutex, AdaptiveMutexThreads) {
+  AdaptiveMutex adaptive_mutex;
+  int counter = 0;
+
+  constexpr int kThreads = 4;
+  constexpr int kIncrementsPerThread = 10000;
+  std::thread threads[kThreads];
+  for (int i = 0; i < kThreads; i++) {
+    threads[i] = std::thread([&] {
+      for (int j = 0; j < kIncrementsPerThread; j++) {
+        AdaptiveMutexGuard lock_guard(&adaptive_mutex);
+        counter++;
+      }
+    });
+  }
+  for (int i = 0; i < kThreads; i++) threads[i].join();
+
+  EXPECT_EQ(kThreads * kIncrementsPerThread, counter);
+  // Spin acquisitions are a subset of the contended lock operations. Whether
+  // any lock operation was contended at all depends on scheduling.
+  EXPECT_GE(adaptive_mutex.contended_locks(),
+            adaptive_mutex.spin_acquisitions());
+}
+
 TEST(Mutex, MultipleMutexes) {
   Mutex mutex1;
   Mutex mutex2;
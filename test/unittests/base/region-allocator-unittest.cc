@@ -372,6 +372,41 @@ TEST(RegionAllocatorTest, TrimRegion) {
   CHECK_EQ(ra.AllocateRegion(kSize), kBegin);
 }
 
+TEST(RegionAllocatorTest, FreeRegionStats) {
+  const size_t kPageSize = 4 * KB;
+  const size_t kPageCount = 64;
+  const size_t kSize = kPageSize * kPageCount;
+  const Address kBegin = static_cast<Address>(kPageSize * 153);
+
+  RegionAllocator ra(kBegin, kSize, kPageSize);
+  CHECK_EQ(ra.free_region_count(), 1);
+  CHECK_EQ(ra.largest_free_region_size(), kSize);
+
+  // Allocate the whole region.
+  for (size_t i = 0; i < kPageCount; i++) {
+    CHECK_NE(ra.AllocateRegion(kPageSize), RegionAllocator::kAllocationFailure);
+  }
+  CHECK_EQ(ra.free_region_count(), 0);
+  CHECK_EQ(ra.largest_free_region_size(), 0);
+
+  // Free every second page, maximizing fragmentation.
+  for (size_t i = 0; i < kPageCount; i += 2) {
+    CHECK_EQ(ra.FreeRegion(kBegin + kPageSize * i), kPageSize);
+  }
+  CHECK_EQ(ra.free_region_count(), kPageCount / 2);
+  CHECK_EQ(ra.largest_free_region_size(), kPageSize);
+  // A request larger than any hole must fail despite sufficient free size.
+  CHECK_EQ(ra.free_size(), kSize / 2);
+  CHECK_EQ(ra.AllocateRegion(2 * kPageSize), RegionAllocator::kAllocationFailure);
+
+  // Freeing the remaining pages coalesces everything back into one region.
+  for (size_t i = 1; i < kPageCount; i += 2) {
+    CHECK_EQ(ra.FreeRegion(kBegin + kPageSize * i), kPageSize);
+  }
+  CHECK_EQ(ra.free_region_count(), 1);
+  CHECK_EQ(ra.largest_free_region_size(), kSize);
+}
+
 TEST(RegionAllocatorTest, AllocateExcluded) {
   const size_t kPageSize = 4 * KB;
   const size_t kPageCount = 64;
@@ -192,6 +192,46 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// A count budget caps the number of Microtasks that run in one round; the
+// rest stay in the queue in order.
+TEST_P(MicrotaskQueueTest, RunMicrotasksWithCountBudget) {
+  int count = 0;
+  for (int i = 0; i < 5; ++i) {
+    microtask_queue()->EnqueueMicrotask(
+        *NewMicrotask([&count, i] { EXPECT_EQ(i, count++); }));
+  }
+
+  EXPECT_EQ(2, microtask_queue()->RunMicrotasks(isolate(), 2));
+  EXPECT_EQ(2, count);
+  EXPECT_EQ(3, microtask_queue()->size());
+
+  EXPECT_EQ(3, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(5, count);
+  EXPECT_EQ(0, microtask_queue()->size());
+}
+
+// The embedder-visible budgeted checkpoint reports drained and remaining
+// counts.
+TEST_P(MicrotaskQueueTest, PerformCheckpointWithBudget) {
+  int count = 0;
+  for (int i = 0; i < 4; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([&count] { count++; }));
+  }
+
+  v8::MicrotaskQueue::Budget budget;
+  budget.max_count = 3;
+  EXPECT_EQ(
+      3, microtask_queue()->PerformCheckpointWithBudget(v8_isolate(), budget));
+  EXPECT_EQ(3, count);
+  EXPECT_EQ(1u, microtask_queue()->PendingMicrotaskCount());
+
+  // A default Budget has no limits and drains the queue.
+  EXPECT_EQ(1, microtask_queue()->PerformCheckpointWithBudget(
+                   v8_isolate(), v8::MicrotaskQueue::Budget()));
+  EXPECT_EQ(4, count);
+  EXPECT_EQ(0u, microtask_queue()->PendingMicrotaskCount());
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
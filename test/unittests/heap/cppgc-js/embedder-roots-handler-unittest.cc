@@ -58,6 +58,48 @@ class ClearingEmbedderRootsHandler final : public v8::EmbedderRootsHandler {
   }
 };
 
+// Like ClearingEmbedderRootsHandler, but answers liveness queries through the
+// batched span-based protocol only.
+class BatchedClearingEmbedderRootsHandler final
+    : public v8::EmbedderRootsHandler {
+ public:
+  BatchedClearingEmbedderRootsHandler()
+      : EmbedderRootsHandler(EmbedderRootsHandler::RootHandling::
+                                 kQueryEmbedderForNonDroppableReferences) {}
+
+  bool IsRoot(const v8::TracedReference<v8::Value>& handle) final {
+    return v8::Object::GetAlignedPointerFromInternalField(
+               handle.As<v8::Object>(), 0) == nullptr;
+  }
+
+  void ResetRoot(const v8::TracedReference<v8::Value>& handle) final {
+    // All resets must arrive through ResetRoots().
+    UNREACHABLE();
+  }
+
+  void AreRoots(v8::MemorySpan<const v8::TracedReference<v8::Value>> handles,
+                v8::MemorySpan<bool> is_root) final {
+    CHECK_EQ(handles.size(), is_root.size());
+    for (size_t i = 0; i < handles.size(); ++i) {
+      is_root[i] = IsRoot(handles[i]);
+    }
+  }
+
+  void ResetRoots(
+      v8::MemorySpan<const v8::TracedReference<v8::Value>> handles) final {
+    for (const auto& handle : handles) {
+      CHECK(!IsRoot(handle));
+      // Convention for test: Objects that are optimized have their first field
+      // set as a back pointer.
+      BasicTracedReference<v8::Value>* original_handle =
+          reinterpret_cast<BasicTracedReference<v8::Value>*>(
+              v8::Object::GetAlignedPointerFromInternalField(
+                  handle.As<v8::Object>(), 0));
+      original_handle->Reset();
+    }
+  }
+};
+
 template <typename T>
 void SetupOptimizedAndNonOptimizedHandle(v8::Isolate* isolate,
                                          T* optimized_handle,
@@ -108,6 +150,35 @@ TEST_F(EmbedderRootsHandlerTest,
   EXPECT_EQ(initial_count, traced_handles->used_node_count());
 }
 
+TEST_F(EmbedderRootsHandlerTest,
+       TracedReferenceReclaimedOnScavengeWithBatchedHandler) {
+  if (v8_flags.single_generation) return;
+
+  ManualGCScope manual_gc(i_isolate());
+  v8::HandleScope scope(v8_isolate());
+
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap());
+
+  BatchedClearingEmbedderRootsHandler handler;
+  TemporaryEmbedderRootsHandleScope roots_handler_scope(v8_isolate(), &handler);
+
+  auto* traced_handles = i_isolate()->traced_handles();
+  const size_t initial_count = traced_handles->used_node_count();
+  auto* optimized_handle = new v8::TracedReference<v8::Value>();
+  auto* non_optimized_handle = new v8::TracedReference<v8::Value>();
+  SetupOptimizedAndNonOptimizedHandle(v8_isolate(), optimized_handle,
+                                      non_optimized_handle);
+  EXPECT_EQ(initial_count + 2, traced_handles->used_node_count());
+  InvokeMinorGC();
+  EXPECT_EQ(initial_count + 1, traced_handles->used_node_count());
+  EXPECT_TRUE(optimized_handle->IsEmpty());
+  delete optimized_handle;
+  EXPECT_FALSE(non_optimized_handle->IsEmpty());
+  non_optimized_handle->Reset();
+  delete non_optimized_handle;
+  EXPECT_EQ(initial_count, traced_handles->used_node_count());
+}
+
 namespace {
 
 void ConstructJSObject(v8::Isolate* isolate, v8::Local<v8::Context> context,
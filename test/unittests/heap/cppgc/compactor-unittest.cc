@@ -132,6 +132,25 @@ TEST_F(CompactorTest, NothingToCompact) {
       GCConfig::SweepingType::kAtomic);
 }
 
+TEST_F(CompactorTest, EnableForNextGCCarriedOverWhenCompactionNotPossible) {
+  compactor().EnableForNextGC();
+  // Garbage collections that may observe pointers on the stack cannot use
+  // compaction; the request is carried over to the next cycle.
+  compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kAtomic,
+                                        StackState::kMayContainHeapPointers);
+  EXPECT_FALSE(compactor().IsEnabledForTesting());
+  compactor().InitializeIfShouldCompact(GCConfig::MarkingType::kIncremental,
+                                        StackState::kNoHeapPointers);
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  heap()->stats_collector()->NotifyMarkingStarted(
+      CollectionType::kMajor, GCConfig::MarkingType::kAtomic,
+      GCConfig::IsForcedGC::kNotForced);
+  heap()->stats_collector()->NotifyMarkingCompleted(0);
+  FinishCompaction();
+  heap()->stats_collector()->NotifySweepingCompleted(
+      GCConfig::SweepingType::kAtomic);
+}
+
 TEST_F(CompactorTest, NonEmptySpaceAllLive) {
   static constexpr int kNumObjects = 10;
   Persistent<CompactableHolder<kNumObjects>> holder =
@@ -207,6 +226,27 @@ TEST_F(CompactorTest, CompactAcrossPages) {
   EXPECT_EQ(reference, holder->objects[0]);
 }
 
+TEST_F(CompactorTest, ReleasedBytesReportedAfterCompaction) {
+  Persistent<CompactableHolder<1>> holder =
+      MakeGarbageCollected<CompactableHolder<1>>(GetAllocationHandle(),
+                                                 GetAllocationHandle());
+  CompactableGCed* reference = holder->objects[0];
+  static constexpr size_t kObjectsPerPage =
+      kPageSize / (sizeof(CompactableGCed) + sizeof(HeapObjectHeader));
+  for (size_t i = 0; i < kObjectsPerPage; ++i) {
+    holder->objects[0] =
+        MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+  }
+  EXPECT_NE(BasePage::FromInnerAddress(heap(), reference),
+            BasePage::FromInnerAddress(heap(), holder->objects[0]));
+  StartGC();
+  EndGC();
+  // The remaining live object is compacted onto the first page and the
+  // emptied page is released.
+  EXPECT_EQ(reference, holder->objects[0]);
+  EXPECT_GE(compactor().released_bytes_for_last_gc(), kPageSize);
+}
+
 TEST_F(CompactorTest, InteriorSlotToPreviousObject) {
   static constexpr int kNumObjects = 3;
   Persistent<CompactableHolder<kNumObjects>> holder =
@@ -23,6 +23,7 @@ class MockGarbageCollector : public GarbageCollector {
   MOCK_METHOD(size_t, epoch, (), (const, override));
   MOCK_METHOD(const EmbedderStackState*, override_stack_state, (),
               (const, override));
+  MOCK_METHOD(bool, generational_gc_supported, (), (const, override));
 };
 
 class MockTaskRunner : public cppgc::TaskRunner {
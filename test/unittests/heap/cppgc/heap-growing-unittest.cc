@@ -21,9 +21,12 @@ class FakeGarbageCollector : public GarbageCollector {
       : stats_collector_(stats_collector) {}
 
   void SetLiveBytes(size_t live_bytes) { live_bytes_ = live_bytes; }
+  void SetGenerationalGCSupported(bool supported) {
+    generational_gc_supported_ = supported;
+  }
 
   void CollectGarbage(GCConfig config) override {
-    stats_collector_->NotifyMarkingStarted(CollectionType::kMajor,
+    stats_collector_->NotifyMarkingStarted(config.collection_type,
                                            GCConfig::MarkingType::kAtomic,
                                            GCConfig::IsForcedGC::kNotForced);
     stats_collector_->NotifyMarkingCompleted(live_bytes_);
@@ -39,11 +42,15 @@ class FakeGarbageCollector : public GarbageCollector {
   const EmbedderStackState* override_stack_state() const override {
     return nullptr;
   }
+  bool generational_gc_supported() const override {
+    return generational_gc_supported_;
+  }
 
  private:
   StatsCollector* stats_collector_;
   size_t live_bytes_ = 0;
   size_t callcount_ = 0;
+  bool generational_gc_supported_ = false;
 };
 
 class MockGarbageCollector : public GarbageCollector {
@@ -53,6 +60,7 @@ class MockGarbageCollector : public GarbageCollector {
   MOCK_METHOD(size_t, epoch, (), (const, override));
   MOCK_METHOD(const EmbedderStackState*, override_stack_state, (),
               (const, override));
+  MOCK_METHOD(bool, generational_gc_supported, (), (const, override));
 };
 
 void FakeAllocate(StatsCollector* stats_collector, size_t bytes) {
@@ -172,5 +180,67 @@ TEST(HeapGrowingTest, IncrementalGCFinalized) {
   FakeAllocate(&stats_collector, StatsCollector::kAllocationThresholdBytes);
 }
 
+TEST(HeapGrowingTest, MinorGCInvokedForGenerationalHeap) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_CALL(gc, generational_gc_supported())
+      .WillRepeatedly(::testing::Return(true));
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(&GCConfig::collection_type,
+                                                  CollectionType::kMinor)));
+  // Exceed the limit for minor GC but stay below the limit for incremental GC.
+  FakeAllocate(&stats_collector, growing.limit_for_minor_gc() + 1);
+}
+
+TEST(HeapGrowingTest, NoMinorGCWithoutGenerationalSupport) {
+  StatsCollector stats_collector(kNoPlatform);
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  EXPECT_CALL(gc, generational_gc_supported())
+      .WillRepeatedly(::testing::Return(false));
+  EXPECT_CALL(gc, CollectGarbage(::testing::_)).Times(0);
+  EXPECT_CALL(gc, StartIncrementalGarbageCollection(::testing::_)).Times(0);
+  FakeAllocate(&stats_collector, growing.limit_for_minor_gc() + 1);
+}
+
+TEST(HeapGrowingTest, YoungCapacityGrowsOnHighSurvival) {
+  StatsCollector stats_collector(kNoPlatform);
+  FakeGarbageCollector gc(&stats_collector);
+  gc.SetGenerationalGCSupported(true);
+  cppgc::Heap::ResourceConstraints constraints;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  const size_t limit_before = growing.limit_for_minor_gc();
+  // Let the whole young generation survive the minor GC.
+  gc.SetLiveBytes(limit_before);
+  FakeAllocate(&stats_collector, limit_before + 1);
+  EXPECT_EQ(1u, gc.epoch());
+  EXPECT_GT(growing.limit_for_minor_gc(), limit_before);
+}
+
+TEST(HeapGrowingTest, YoungCapacityShrinksOnLowSurvival) {
+  StatsCollector stats_collector(kNoPlatform);
+  FakeGarbageCollector gc(&stats_collector);
+  gc.SetGenerationalGCSupported(true);
+  cppgc::Heap::ResourceConstraints constraints;
+  HeapGrowing growing(&gc, &stats_collector, constraints,
+                      cppgc::Heap::MarkingType::kIncrementalAndConcurrent,
+                      cppgc::Heap::SweepingType::kIncrementalAndConcurrent);
+  const size_t limit_before = growing.limit_for_minor_gc();
+  // Let almost nothing survive the minor GC.
+  gc.SetLiveBytes(1);
+  FakeAllocate(&stats_collector, limit_before + 1);
+  EXPECT_EQ(1u, gc.epoch());
+  EXPECT_LT(growing.limit_for_minor_gc(), limit_before);
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -27,6 +27,9 @@
 
 #include "src/handles/global-handles.h"
 
+#include <atomic>
+#include <vector>
+
 #include "include/v8-embedder-heap.h"
 #include "include/v8-function.h"
 #include "src/api/api-inl.h"
@@ -299,6 +302,30 @@ TEST_F(GlobalHandlesTest, PhantomHandlesWithoutCallbacks) {
   CHECK(g2.IsEmpty());
 }
 
+TEST_F(GlobalHandlesTest, ReserveCapacityBulkCreation) {
+  v8::Isolate* isolate = v8_isolate();
+  GlobalHandles* global_handles = i_isolate()->global_handles();
+  constexpr size_t kHandleCount = 1000;
+
+  isolate->ReserveGlobalHandleCapacity(kHandleCount);
+  isolate->ReserveTracedHandleCapacity(kHandleCount);
+
+  const size_t initial_count = global_handles->handles_count();
+  std::vector<v8::Global<v8::Object>> handles(kHandleCount);
+  {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Object> o = v8::Object::New(isolate);
+    for (auto& handle : handles) handle.Reset(isolate, o);
+  }
+  CHECK_EQ(initial_count + kHandleCount, global_handles->handles_count());
+  for (auto& handle : handles) handle.Reset();
+  CHECK_EQ(initial_count, global_handles->handles_count());
+
+  // Reserving is cheap when enough capacity is already on the free list.
+  isolate->ReserveGlobalHandleCapacity(kHandleCount);
+  CHECK_EQ(initial_count, global_handles->handles_count());
+}
+
 TEST_F(GlobalHandlesTest, WeakHandleToUnmodifiedJSObjectDiesOnScavenge) {
   if (v8_flags.single_generation) return;
 
@@ -565,6 +592,45 @@ TEST_F(GlobalHandlesTest, SecondPassPhantomCallbacks) {
   CHECK(fp.flag);
 }
 
+namespace {
+
+std::atomic<size_t> thread_safe_first_pass_count{0};
+
+void CountingThreadSafeCallback(
+    const v8::WeakCallbackInfo<v8::Global<v8::Object>>& data) {
+  data.GetParameter()->Reset();
+  thread_safe_first_pass_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+TEST_F(GlobalHandlesTest, ParallelFirstPassCallbacks) {
+  v8::Isolate* isolate = v8_isolate();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate()->heap());
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  // Enough handles to exceed the parallel dispatch threshold several times
+  // over.
+  constexpr size_t kHandleCount = 256;
+  std::vector<v8::Global<v8::Object>> handles(kHandleCount);
+  {
+    v8::HandleScope inner_scope(isolate);
+    for (auto& handle : handles) {
+      handle.Reset(isolate, v8::Object::New(isolate));
+      handle.SetWeak(&handle, CountingThreadSafeCallback,
+                     v8::WeakCallbackType::kParameterThreadSafe);
+    }
+  }
+  thread_safe_first_pass_count = 0;
+  InvokeMajorGC();
+  // All callbacks must have run before weak handle processing completes.
+  CHECK_EQ(kHandleCount, thread_safe_first_pass_count.load());
+  for (auto& handle : handles) CHECK(handle.IsEmpty());
+}
+
 TEST_F(GlobalHandlesTest, MoveStrongGlobal) {
   v8::Isolate* isolate = v8_isolate();
   v8::HandleScope scope(isolate);
@@ -12,6 +12,7 @@
 #include "include/v8-object.h"
 #include "src/flags/flags.h"
 #include "src/handles/handles-inl.h"
+#include "src/heap/factory-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/marking-state-inl.h"
 #include "src/heap/memory-chunk.h"
@@ -173,6 +174,56 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
   EXPECT_GE(heap->external_memory_limit(), kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, GCPauseBudget) {
+  Heap* heap = i_isolate()->heap();
+  EXPECT_TRUE(heap->gc_pause_budget().IsZero());
+  v8_isolate()->SetGCPauseBudget(1.5);
+  EXPECT_EQ(1500, heap->gc_pause_budget().InMicroseconds());
+  EXPECT_EQ(v8::TaskPriority::kUserBlocking,
+            i_isolate()->background_gc_task_priority());
+  v8_isolate()->SetGCPauseBudget(0);
+  EXPECT_TRUE(heap->gc_pause_budget().IsZero());
+  EXPECT_EQ(v8::TaskPriority::kUserVisible,
+            i_isolate()->background_gc_task_priority());
+}
+
+TEST_F(HeapTest, DeduplicateHeapNumbers) {
+  if (v8_flags.single_generation) return;
+  ManualGCScope manual_gc_scope(i_isolate());
+  SaveFlags save_flags;
+  v8_flags.deduplicate_heap_numbers = true;
+  // Disable compaction so that old-space HeapNumbers are guaranteed to be
+  // valid canonical targets.
+  v8_flags.compact = false;
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+  Handle<FixedArray> array =
+      factory->NewFixedArray(2, AllocationType::kOld);
+  array->set(0, *factory->NewHeapNumber<AllocationType::kOld>(0.5));
+  array->set(1, *factory->NewHeapNumber<AllocationType::kOld>(0.5));
+  CHECK_NE(array->get(0), array->get(1));
+  InvokeMajorGC();
+  // Both slots must now reference the same canonical HeapNumber.
+  CHECK_EQ(array->get(0), array->get(1));
+  CHECK_EQ(0.5, HeapNumber::cast(array->get(0))->value());
+}
+
+TEST_F(HeapTest, ObjectFactoryScope) {
+  Heap* heap = i_isolate()->heap();
+  EXPECT_TRUE(heap->IsAllocationObserverActive());
+  {
+    v8::ObjectFactoryScope scope(v8_isolate());
+    EXPECT_FALSE(heap->IsAllocationObserverActive());
+    {
+      // Scopes nest; observers stay paused until the outermost scope closes.
+      v8::ObjectFactoryScope inner_scope(v8_isolate());
+      EXPECT_FALSE(heap->IsAllocationObserverActive());
+    }
+    EXPECT_FALSE(heap->IsAllocationObserverActive());
+  }
+  EXPECT_TRUE(heap->IsAllocationObserverActive());
+}
+
 #ifdef V8_COMPRESS_POINTERS
 TEST_F(HeapTest, HeapLayout) {
   // Produce some garbage.
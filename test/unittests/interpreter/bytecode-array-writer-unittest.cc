@@ -54,6 +54,9 @@ class BytecodeArrayWriterUnittest : public TestWithIsolateAndZone {
                      BytecodeSourceInfo info = BytecodeSourceInfo());
 
   BytecodeArrayWriter* writer() { return &bytecode_array_writer_; }
+  void EnableSuperinstructionFusion() {
+    writer()->fuse_superinstructions_ = true;
+  }
   ZoneVector<unsigned char>* bytecodes() { return writer()->bytecodes(); }
   SourcePositionTableBuilder* source_position_table_builder() {
     return writer()->source_position_table_builder();
@@ -303,6 +306,54 @@ TEST_F(BytecodeArrayWriterUnittest, ElideNoneffectfulBytecodes) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, FuseSuperinstructions) {
+  EnableSuperinstructionFusion();
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0  55 S> */ B(LdarAdd), R8(1), U8(2), R8(0),
+      /*  4        */ B(Star), R8(2),
+      /*  6  60 S> */ B(Ldar), R8(0),
+      /*  8  65 S> */ B(Add), R8(1), U8(2),
+      /* 11  75 S> */ B(Return),
+      // clang-format on
+  };
+
+  static const PositionTableEntry expected_positions[] = {
+      {0, 55, true}, {6, 60, true}, {8, 65, true}, {11, 75, true}};
+
+  Write(Bytecode::kLdar, Register(0).ToOperand());  // Should be fused.
+  Write(Bytecode::kAdd, Register(1).ToOperand(), 2, {55, true});
+  Write(Bytecode::kStar, Register(2).ToOperand());
+  // Not fused because the Ldar carries a source position.
+  Write(Bytecode::kLdar, Register(0).ToOperand(), {60, true});
+  Write(Bytecode::kAdd, Register(1).ToOperand(), 2, {65, true});
+  Write(Bytecode::kReturn, {75, true});
+
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+
+  Handle<TrustedByteArray> handler_table = factory()->NewTrustedByteArray(0);
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(isolate(), 0, 0, handler_table);
+  bytecode_array->set_source_position_table(
+      *writer()->ToSourcePositionTable(isolate()), kReleaseStore);
+  SourcePositionTableIterator source_iterator(
+      bytecode_array->SourcePositionTable());
+  for (size_t i = 0; i < arraysize(expected_positions); ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.code_offset(), expected.code_offset);
+    CHECK_EQ(source_iterator.source_position().ScriptOffset(),
+             expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+}
+
 TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   static const uint8_t expected_bytes[] = {
       // clang-format off
@@ -222,6 +222,26 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTaskOrder2) {
   ASSERT_EQ(1, order[2]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTaskFarFuture) {
+  FakeClock::set_time(0.0);
+  DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
+
+  base::Semaphore task_semaphore(0);
+  // A 20000s delay is beyond the range of the delayed task queue's timer
+  // wheel and lands in its overflow queue.
+  runner.PostDelayedTask(
+      std::make_unique<TestTask>([&] { task_semaphore.Signal(); }), 20000);
+
+  FakeClock::set_time_and_wake_up_runner(19999, &runner);
+  bool signalled =
+      task_semaphore.WaitFor(base::TimeDelta::FromMilliseconds(100));
+  ASSERT_FALSE(signalled);
+
+  FakeClock::set_time_and_wake_up_runner(20001, &runner);
+  task_semaphore.Wait();
+  runner.Terminate();
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   FakeClock::set_time(0.0);
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
@@ -268,6 +288,29 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   ASSERT_EQ(1, order[0]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, WorkStealing) {
+  // The victim has no threads of its own, so its task can only ever be run
+  // by the thief's worker.
+  DefaultWorkerThreadsTaskRunner victim(0, RealTime);
+  DefaultWorkerThreadsTaskRunner thief(1, RealTime);
+  thief.SetStealVictims({&victim});
+
+  base::Semaphore stolen_task_semaphore(0);
+  victim.PostTask(
+      std::make_unique<TestTask>([&] { stolen_task_semaphore.Signal(); }));
+  // Wake the thief's worker; once its own task has run and its queue is
+  // empty, it should take the victim's task instead of going idle.
+  thief.PostTask(std::make_unique<TestTask>([] {}));
+
+  stolen_task_semaphore.Wait();
+  ASSERT_EQ(1UL, thief.NumberOfStolenTasks());
+  ASSERT_EQ(0UL, victim.NumberOfQueuedTasks());
+  ASSERT_EQ(0UL, victim.NumberOfStolenTasks());
+
+  thief.Terminate();
+  victim.Terminate();
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
 
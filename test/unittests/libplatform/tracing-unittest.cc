@@ -143,6 +143,53 @@ TEST_F(PlatformTracingTest, TestTraceBufferRingBuffer) {
   }
   delete ring_buffer;
 }
+
+TEST_F(PlatformTracingTest, TestTraceBufferStreamingBuffer) {
+  const int HANDLES_COUNT = TraceBufferChunk::kChunkSize * 2 + 1;
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* streaming_buffer =
+      TraceBuffer::CreateTraceBufferStreamingBuffer(2, writer);
+  std::string names[HANDLES_COUNT];
+  for (int i = 0; i < HANDLES_COUNT; ++i) {
+    names[i] = "Test.EventNo" + std::to_string(i);
+  }
+
+  std::vector<uint64_t> handles(HANDLES_COUNT);
+  uint8_t category_enabled_flag = 41;
+  for (size_t i = 0; i < handles.size(); ++i) {
+    TraceObject* trace_object = streaming_buffer->AddTraceEvent(&handles[i]);
+    CHECK_NOT_NULL(trace_object);
+    trace_object->Initialize('X', &category_enabled_flag, names[i].c_str(),
+                             "Test.Scope", 42, 123, 0, nullptr, nullptr,
+                             nullptr, nullptr, 0, 1729, 4104);
+  }
+
+  // Full chunks are streamed to the writer as soon as they are retired, so
+  // all but the events in the active chunk have already been written out.
+  CHECK_EQ(2 * TraceBufferChunk::kChunkSize, writer->events().size());
+
+  // Streamed events are final; only the event still in the thread's active
+  // chunk can be looked up.
+  for (size_t i = 0; i < 2 * TraceBufferChunk::kChunkSize; ++i) {
+    CHECK_NULL(streaming_buffer->GetEventByHandle(handles[i]));
+  }
+  TraceObject* trace_object =
+      streaming_buffer->GetEventByHandle(handles.back());
+  CHECK_NOT_NULL(trace_object);
+  CHECK_EQ('X', trace_object->phase());
+  CHECK_EQ(names[HANDLES_COUNT - 1], std::string(trace_object->name()));
+  CHECK_EQ(category_enabled_flag, *trace_object->category_enabled_flag());
+
+  // Flush() streams the remaining partial chunk; no events are lost and the
+  // stream preserves recording order.
+  streaming_buffer->Flush();
+  auto events = writer->events();
+  CHECK_EQ(static_cast<size_t>(HANDLES_COUNT), events.size());
+  for (size_t i = 0; i < handles.size(); ++i) {
+    CHECK_EQ(names[i], events[i]);
+  }
+  delete streaming_buffer;
+}
 #endif  // !defined(V8_USE_PERFETTO)
 
 // Perfetto has an internal JSON exporter.
@@ -476,6 +476,38 @@ TEST_F(LogTest, Issue539892) {
   }
 }
 
+class LogBufferingTest : public LogTest {
+ public:
+  static void SetUpTestSuite() {
+    i::v8_flags.log_buffering = true;
+    LogTest::SetUpTestSuite();
+  }
+
+  static void TearDownTestSuite() {
+    TestWithIsolate::TearDownTestSuite();
+    i::v8_flags.log_buffering = false;
+  }
+};
+
+TEST_F(LogBufferingTest, LogBuffering) {
+  {
+    ScopedLoggerInitializer logger(isolate());
+
+    RunJS("(function buffered(a, b) { return a + b; })(1, 2);");
+    logger.StopLogging();
+
+    // All lines that went through the background writer must be present once
+    // logging is stopped.
+    v8::base::EmbeddedVector<char, 100> line_buffer;
+    v8::base::SNPrintF(line_buffer, "%d,%d,%d,%d,%d", i::Version::GetMajor(),
+                       i::Version::GetMinor(), i::Version::GetBuild(),
+                       i::Version::GetPatch(), i::Version::IsCandidate());
+    CHECK(
+        logger.ContainsLine({"v8-version,", std::string(line_buffer.begin())}));
+    CHECK(logger.ContainsLine({"code-creation,"}));
+  }
+}
+
 class LogAllTest : public LogTest {
  public:
   static void SetUpTestSuite() {
@@ -301,6 +301,47 @@ TEST_F(ConversionsTest, ExponentNumberStr) {
   CHECK_EQ(1e-106, StringToDouble(".000001e-100", NO_CONVERSION_FLAGS));
 }
 
+TEST_F(ConversionsTest, FastPathNumberStr) {
+  // Shapes served by the SWAR fast path in StringToDouble; the expected
+  // values double as a check that it agrees with the generic parser.
+  CHECK_EQ(0.0, StringToDouble("0", NO_CONVERSION_FLAGS));
+  CHECK_EQ(-0.0, StringToDouble("-0", NO_CONVERSION_FLAGS));
+  CHECK_EQ(123.0, StringToDouble("123", NO_CONVERSION_FLAGS));
+  CHECK_EQ(-42.5, StringToDouble("-42.5", NO_CONVERSION_FLAGS));
+  CHECK_EQ(0.5, StringToDouble(".5", NO_CONVERSION_FLAGS));
+  CHECK_EQ(1.0, StringToDouble("1.", NO_CONVERSION_FLAGS));
+  CHECK_EQ(3.1415926535897931, StringToDouble("3.141592653589793",
+                                              NO_CONVERSION_FLAGS));
+
+  // Mantissas crossing the eight-digit chunk boundaries.
+  CHECK_EQ(12345678.0, StringToDouble("12345678", NO_CONVERSION_FLAGS));
+  CHECK_EQ(123456789.0, StringToDouble("123456789", NO_CONVERSION_FLAGS));
+  CHECK_EQ(1234567812345678.0,
+           StringToDouble("1234567812345678", NO_CONVERSION_FLAGS));
+  CHECK_EQ(12345678.12345678, StringToDouble("12345678.12345678",
+                                             NO_CONVERSION_FLAGS));
+
+  // The largest mantissa still exactly representable, and the first that is
+  // not (which takes the slow path and must round correctly).
+  CHECK_EQ(9007199254740992.0,
+           StringToDouble("9007199254740992", NO_CONVERSION_FLAGS));
+  CHECK_EQ(9007199254740992.0,
+           StringToDouble("9007199254740993", NO_CONVERSION_FLAGS));
+
+  // Exponents at the edge of the exact powers-of-ten table.
+  CHECK_EQ(1e22, StringToDouble("1e22", NO_CONVERSION_FLAGS));
+  CHECK_EQ(1e-22, StringToDouble("1e-22", NO_CONVERSION_FLAGS));
+  CHECK_EQ(1e23, StringToDouble("1e23", NO_CONVERSION_FLAGS));
+  CHECK_EQ(2.5e10, StringToDouble("25e9", NO_CONVERSION_FLAGS));
+
+  // Surrounding whitespace is accepted; junk and radix prefixes are not
+  // mistaken for plain decimals.
+  CHECK_EQ(1.5, StringToDouble("  1.5  ", NO_CONVERSION_FLAGS));
+  CHECK_EQ(16.0, StringToDouble("0x10", ALLOW_HEX));
+  CHECK_EQ(8.0, StringToDouble("010", ALLOW_IMPLICIT_OCTAL));
+  CHECK(std::isnan(StringToDouble("1.5x", NO_CONVERSION_FLAGS)));
+}
+
 using OneBit1 = base::BitField<uint32_t, 0, 1>;
 using OneBit2 = base::BitField<uint32_t, 7, 1>;
 using EightBit1 = base::BitField<uint32_t, 0, 8>;
@@ -488,6 +488,139 @@ TEST_F(FeedbackVectorTest, VectorLoadICStates) {
   CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, VectorLoadICExtendedPolymorphism) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.max_extended_polymorphic_map_count = 16;
+  v8_flags.extended_polymorphism_invocation_threshold = 64;
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  TryRunJS(
+      "function f(a) { return a.foo; }"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "%NeverOptimizeFunction(f);"
+      "var shapes = ["
+      "  {a1: 1, foo: 2}, {a2: 1, foo: 2}, {a3: 1, foo: 2},"
+      "  {a4: 1, foo: 2}, {a5: 1, foo: 2}, {a6: 1, foo: 2}];"
+      // Make the site hot before growing the map set.
+      "for (var i = 0; i < 100; i++) f(shapes[0]);");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
+  CHECK_GE(feedback_vector->invocation_count(),
+           v8_flags.extended_polymorphism_invocation_threshold);
+
+  // A hot named site whose maps are all stable keeps collecting maps past
+  // the base polymorphic limit instead of going megamorphic.
+  TryRunJS("for (var i = 1; i < 6; i++) f(shapes[i]);");
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+  MapHandles maps;
+  nexus.ExtractMaps(&maps);
+  CHECK_EQ(6, maps.size());
+}
+
+TEST_F(FeedbackVectorTest, VectorLoadICNoExtensionWhenCold) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.max_extended_polymorphic_map_count = 16;
+  v8_flags.extended_polymorphism_invocation_threshold = 64;
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  // A site far below the invocation threshold keeps the base limit.
+  TryRunJS(
+      "function g(a) { return a.foo; }"
+      "%EnsureFeedbackVectorForFunction(g);"
+      "%NeverOptimizeFunction(g);"
+      "g({b1: 1, foo: 2}); g({b2: 1, foo: 2});"
+      "g({b3: 1, foo: 2}); g({b4: 1, foo: 2});");
+  Handle<JSFunction> g = GetFunction("g");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(g->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+
+  TryRunJS("g({b5: 1, foo: 2});");
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+}
+
+TEST_F(FeedbackVectorTest, VectorKeyedLoadICNoExtension) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.max_extended_polymorphic_map_count = 16;
+  v8_flags.extended_polymorphism_invocation_threshold = 64;
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  // Keyed sites never grow past the base limit, no matter how hot.
+  TryRunJS(
+      "function k(a, key) { return a[key]; }"
+      "%EnsureFeedbackVectorForFunction(k);"
+      "%NeverOptimizeFunction(k);"
+      "var kshapes = ["
+      "  {c1: 1, foo: 2}, {c2: 1, foo: 2}, {c3: 1, foo: 2},"
+      "  {c4: 1, foo: 2}, {c5: 1, foo: 2}];"
+      "for (var i = 0; i < 100; i++) k(kshapes[0], 'foo');");
+  Handle<JSFunction> k = GetFunction("k");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(k->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
+  CHECK_GE(feedback_vector->invocation_count(),
+           v8_flags.extended_polymorphism_invocation_threshold);
+
+  TryRunJS("for (var i = 1; i < 5; i++) k(kshapes[i], 'foo');");
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+}
+
+TEST_F(FeedbackVectorTest, VectorLoadICExtensionSkipsDeprecatedMaps) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.max_extended_polymorphic_map_count = 16;
+  v8_flags.extended_polymorphism_invocation_threshold = 64;
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  TryRunJS(
+      "function h(a) { return a.foo; }"
+      "%EnsureFeedbackVectorForFunction(h);"
+      "%NeverOptimizeFunction(h);"
+      "var hshapes = ["
+      "  {d1: 1, foo: 2}, {d2: 1, foo: 2}, {d3: 1, foo: 2},"
+      "  {d4: 1, foo: 2}, {d5: 1, foo: 2}, {d6: 1, foo: 2}];"
+      "for (var i = 0; i < 100; i++) h(hshapes[0]);"
+      "for (var i = 1; i < 5; i++) h(hshapes[i]);");
+  Handle<JSFunction> h = GetFunction("h");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(h->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+
+  // Deprecate the first shape's map by generalizing the representation of
+  // {foo}. Deprecated maps are unstable but must not block further growth;
+  // they are skipped when checking the recorded map set for stability.
+  TryRunJS(
+      "var stale = {d1: 1, foo: 2};"
+      "stale.foo = 1.5;"
+      "h(hshapes[5]);");
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+}
+
 TEST_F(FeedbackVectorTest, VectorLoadGlobalICSlotSharing) {
   if (!i::v8_flags.use_ic) return;
   if (i::v8_flags.always_turbofan) return;
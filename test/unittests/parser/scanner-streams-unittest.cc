@@ -170,6 +170,51 @@ TEST_F(ScannerStreamsTest, Utf8StreamAsciiOnly) {
   } while (c != v8::internal::Utf16CharacterStream::kEndOfInput);
 }
 
+// Chunk source that retains ownership of its chunks and hands out pointers
+// into a single backing buffer, see
+// ExternalSourceStream::ChunksOwnedByEmbedder.
+class EmbedderOwnedChunkSource
+    : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  EmbedderOwnedChunkSource(const char* data, size_t chunk_size)
+      : data_(reinterpret_cast<const uint8_t*>(data)),
+        len_(strlen(data)),
+        chunk_size_(chunk_size) {}
+  size_t GetMoreData(const uint8_t** src) override {
+    if (position_ == len_) return 0;
+    const size_t len = std::min(chunk_size_, len_ - position_);
+    *src = data_ + position_;
+    position_ += len;
+    return len;
+  }
+  bool ChunksOwnedByEmbedder() const override { return true; }
+
+ private:
+  const uint8_t* const data_;
+  const size_t len_;
+  const size_t chunk_size_;
+  size_t position_ = 0;
+};
+
+TEST_F(ScannerStreamsTest, EmbedderOwnedChunks) {
+  const char* data = "abcdefghij";
+  for (auto encoding : {v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                        v8::ScriptCompiler::StreamedSource::UTF8,
+                        v8::ScriptCompiler::StreamedSource::WINDOWS_1252}) {
+    EmbedderOwnedChunkSource chunk_source(data, 3);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(&chunk_source, encoding));
+
+    // The stream serves the embedder-owned bytes and must not free them on
+    // destruction (the latter is covered by ASAN runs).
+    for (size_t i = 0; i < strlen(data); i++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(data[i]), stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8StreamMaxNonSurrogateCharCode) {
   const char* chunks[] = {"\uffff\uffff", ""};
   ChunkSource chunk_source(chunks);
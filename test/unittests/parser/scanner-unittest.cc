@@ -110,5 +110,35 @@ TEST_F(ScannerTest, AllThePushbacks) {
   }
 }
 
+TEST_F(ScannerTest, BlockWiseScanning) {
+  // Exercises the block-wise scanning paths for identifier runs, whitespace
+  // skipping and line-comment termination, with runs both shorter and longer
+  // than one vector block, and with and without line terminators in the
+  // skipped whitespace.
+  auto scanner = make_scanner(
+      "averylongidentifier_1234$XYZ   \t \t   q\n"
+      "// a line comment that runs on for quite a while\n"
+      "instanceof instanceofbutlonger          done");
+
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("averylongidentifier_1234$XYZ"));
+  CHECK(!scanner->HasLineTerminatorBeforeNext());
+
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("q"));
+  CHECK(scanner->HasLineTerminatorBeforeNext());
+
+  CHECK_TOK(Token::INSTANCEOF, scanner->Next());
+  CHECK(!scanner->HasLineTerminatorBeforeNext());
+
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("instanceofbutlonger"));
+
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("done"));
+
+  CHECK_TOK(Token::EOS, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
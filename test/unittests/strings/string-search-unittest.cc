@@ -0,0 +1,83 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include <cstring>
+
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+int Search(Isolate* isolate, const char* subject, const char* pattern,
+           int index) {
+  return SearchString(
+      isolate,
+      base::Vector<const uint8_t>(reinterpret_cast<const uint8_t*>(subject),
+                                  static_cast<int>(strlen(subject))),
+      base::Vector<const uint8_t>(reinterpret_cast<const uint8_t*>(pattern),
+                                  static_cast<int>(strlen(pattern))),
+      index);
+}
+
+}  // namespace
+
+using StringSearchTest = TestWithIsolate;
+
+TEST_F(StringSearchTest, OneByteShortPatterns) {
+  Isolate* isolate = i_isolate();
+  EXPECT_EQ(0, Search(isolate, "abcabc", "ab", 0));
+  EXPECT_EQ(3, Search(isolate, "abcabc", "ab", 1));
+  EXPECT_EQ(-1, Search(isolate, "abcabc", "ab", 4));
+  EXPECT_EQ(2, Search(isolate, "aaabaa", "ab", 0));
+  EXPECT_EQ(-1, Search(isolate, "abcabc", "cd", 0));
+  // First and last pattern characters match at many positions, but the
+  // middle differs; candidates must be verified in full.
+  EXPECT_EQ(9, Search(isolate, "axbaybazbacb", "acb", 0));
+  // Match at the very end of the subject.
+  EXPECT_EQ(4, Search(isolate, "xxxxabc", "abc", 0));
+  // Pattern longer than subject.
+  EXPECT_EQ(-1, Search(isolate, "ab", "abc", 0));
+}
+
+TEST_F(StringSearchTest, OneByteLongSubject) {
+  Isolate* isolate = i_isolate();
+  // A subject long enough to exercise whole-vector candidate filtering plus
+  // the scalar tail.
+  std::string subject(1000, 'x');
+  subject += "needle";
+  subject += std::string(7, 'y');  // Odd tail length.
+  EXPECT_EQ(1000, Search(isolate, subject.c_str(), "needle", 0));
+  EXPECT_EQ(1000, Search(isolate, subject.c_str(), "needle", 1000));
+  EXPECT_EQ(-1, Search(isolate, subject.c_str(), "needle", 1001));
+  EXPECT_EQ(-1, Search(isolate, subject.c_str(), "nxedle", 0));
+  // Overlapping near-matches sharing first and last characters.
+  std::string tricky(500, 'n');
+  tricky += "nedle";  // "n...nnedle": no "needle" anywhere.
+  EXPECT_EQ(-1, Search(isolate, tricky.c_str(), "needle", 0));
+}
+
+TEST_F(StringSearchTest, SimdOneByteFilterSearchDirect) {
+  if (!SimdOneByteFilterSearchAvailable()) return;
+  const char* subject = "abab_abab_abab_abab_abab_abab_abXb";
+  const char* pattern = "abXb";
+  const int subject_length = static_cast<int>(strlen(subject));
+  EXPECT_EQ(30, SimdOneByteFilterSearch(
+                    reinterpret_cast<const uint8_t*>(subject), subject_length,
+                    reinterpret_cast<const uint8_t*>(pattern), 4, 0));
+  EXPECT_EQ(-1, SimdOneByteFilterSearch(
+                    reinterpret_cast<const uint8_t*>(subject), subject_length,
+                    reinterpret_cast<const uint8_t*>(pattern), 4, 31));
+  // Two-character pattern: nothing between first and last to verify.
+  EXPECT_EQ(2, SimdOneByteFilterSearch(
+                   reinterpret_cast<const uint8_t*>(subject), subject_length,
+                   reinterpret_cast<const uint8_t*>("ab"), 2, 1));
+}
+
+}  // namespace internal
+}  // namespace v8
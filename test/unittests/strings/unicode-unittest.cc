@@ -110,6 +110,62 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, AsciiPrefixLength) {
+  // Exercise both the vectorized loop and the scalar tail by placing the
+  // first non-ASCII byte at every position of a buffer spanning several
+  // vectors.
+  constexpr size_t kLength = 70;
+  for (size_t pos = 0; pos <= kLength; pos++) {
+    std::vector<uint8_t> bytes(kLength, 'a');
+    if (pos < kLength) bytes[pos] = 0xC3;
+    CHECK_EQ(pos, unibrow::Utf8::AsciiPrefixLength(bytes.data(), kLength));
+  }
+}
+
+TEST(UnicodeTest, ValidateEncodingWithLongAsciiRuns) {
+  // Long ASCII runs take the wide-compare fast path between sequences; make
+  // sure multibyte sequences and errors embedded in them are still handled.
+  std::string valid(100, 'x');
+  valid += "\xC3\xA9";  // U+00E9.
+  valid += std::string(100, 'y');
+  CHECK(unibrow::Utf8::ValidateEncoding(
+      reinterpret_cast<const uint8_t*>(valid.data()), valid.size()));
+
+  std::string truncated(100, 'x');
+  truncated += "\xC3";  // Incomplete sequence at the end.
+  CHECK(!unibrow::Utf8::ValidateEncoding(
+      reinterpret_cast<const uint8_t*>(truncated.data()), truncated.size()));
+
+  std::string interrupted(100, 'x');
+  interrupted += "\xC3";
+  interrupted += std::string(100, 'y');  // ASCII interrupts the sequence.
+  CHECK(!unibrow::Utf8::ValidateEncoding(
+      reinterpret_cast<const uint8_t*>(interrupted.data()),
+      interrupted.size()));
+}
+
+TEST(UnicodeTest, DecodeLongAsciiRuns) {
+  // A subject mixing long ASCII runs with multibyte sequences; classification
+  // and decoding must agree with the byte-at-a-time reference decoder.
+  std::vector<uint8_t> bytes(50, 'a');
+  bytes.insert(bytes.end(), {0xC3, 0xA9});  // U+00E9, still Latin-1.
+  bytes.insert(bytes.end(), 50, 'b');
+  {
+    Utf8Decoder decoder(base::VectorOf(bytes));
+    CHECK(decoder.is_one_byte());
+    CHECK(!decoder.is_ascii());
+    CHECK_EQ(101, decoder.utf16_length());
+  }
+  std::vector<unibrow::uchar> output_normal;
+  std::vector<unibrow::uchar> output_utf16;
+  DecodeNormally(bytes, &output_normal);
+  DecodeUtf16(bytes, &output_utf16);
+  CHECK_EQ(output_normal.size(), output_utf16.size());
+  for (size_t i = 0; i < output_normal.size(); i++) {
+    CHECK_EQ(output_normal[i], output_utf16[i]);
+  }
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/accounting-allocator.h"
+
+#include "src/zone/zone-segment.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class AccountingAllocatorTest : public TestWithPlatform {};
+
+TEST_F(AccountingAllocatorTest, SegmentPoolReuse) {
+  FlagScope<size_t> high(&v8_flags.zone_segment_pool_high_watermark, 8 * MB);
+  FlagScope<size_t> low(&v8_flags.zone_segment_pool_low_watermark, 4 * MB);
+  AccountingAllocator allocator;
+
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(segment, nullptr);
+  allocator.ReturnSegment(segment, false);
+  EXPECT_GT(allocator.GetPooledMemory(), 0u);
+
+  // The next allocation of the same size on the same thread must be served
+  // from the pool and hand back the very same segment.
+  Segment* reused = allocator.AllocateSegment(8 * KB, false);
+  EXPECT_EQ(reused, segment);
+  EXPECT_EQ(allocator.GetSegmentPoolHits(), 1u);
+  EXPECT_EQ(allocator.GetPooledMemory(), 0u);
+  allocator.ReturnSegment(reused, false);
+}
+
+TEST_F(AccountingAllocatorTest, SegmentPoolDisabled) {
+  FlagScope<size_t> high(&v8_flags.zone_segment_pool_high_watermark, 0);
+  AccountingAllocator allocator;
+
+  Segment* segment = allocator.AllocateSegment(8 * KB, false);
+  ASSERT_NE(segment, nullptr);
+  allocator.ReturnSegment(segment, false);
+  EXPECT_EQ(allocator.GetPooledMemory(), 0u);
+  EXPECT_EQ(allocator.GetSegmentPoolHits(), 0u);
+  EXPECT_EQ(allocator.GetSegmentPoolMisses(), 0u);
+}
+
+TEST_F(AccountingAllocatorTest, SegmentPoolWatermarkTrimming) {
+  // Watermarks are spread over the pool shards; all returns below come from
+  // the same thread and thus hit a single shard.
+  constexpr size_t kShards = 8;
+  FlagScope<size_t> high(&v8_flags.zone_segment_pool_high_watermark,
+                         kShards * 16 * KB);
+  FlagScope<size_t> low(&v8_flags.zone_segment_pool_low_watermark, 0);
+  AccountingAllocator allocator;
+
+  Segment* segments[4];
+  for (Segment*& segment : segments) {
+    segment = allocator.AllocateSegment(8 * KB, false);
+    ASSERT_NE(segment, nullptr);
+  }
+  for (Segment* segment : segments) {
+    allocator.ReturnSegment(segment, false);
+    EXPECT_LE(allocator.GetPooledMemory(), 16 * KB);
+  }
+  EXPECT_GT(allocator.GetPooledMemory(), 0u);
+}
+
+}  // namespace internal
+}  // namespace v8